@@ -374,10 +374,16 @@ class DMenuCommand : public AbstractCommandLineCommand {
   }
 
   bool run(CLI::App *) override {
+#ifdef _WIN32
+    // pipes are read synchronously there, so the input can't be read while waiting for replies
     m_req.rawContent = vicinae::slurp(std::cin);
 
     const auto res =
         cli::IpcClient::connect().and_then([&](cli::IpcClient client) { return client.dmenu(m_req); });
+#else
+    const auto res = cli::IpcClient::connect().and_then(
+        [&](cli::IpcClient client) { return client.streamDMenu(m_req, STDIN_FILENO); });
+#endif
 
     if (!res) {
       std::println(std::cerr, "Failed to invoke dmenu: {}", res.error());
@@ -1,6 +1,9 @@
 #pragma once
 #include <common/common.hpp>
 #include <common/enumerate.hpp>
+#include <algorithm>
+#include <array>
+#include <chrono>
 #include <expected>
 #include <format>
 #include <optional>
@@ -8,6 +11,13 @@
 #include "local-socket.hpp"
 #include "generated/ipc-client.hpp"
 
+#ifndef _WIN32
+#include <cerrno>
+#include <cstring>
+#include <poll.h>
+#include <unistd.h>
+#endif
+
 namespace cli {
 
 class IpcClient {
@@ -76,6 +86,80 @@ public:
     return call<ipc::DMenuResponse>([&](auto cb) { m_client.ipc().dmenu(req, std::move(cb)); });
   }
 
+#ifndef _WIN32
+  /**
+   * Same as `dmenu`, with entries read from `input` and sent as they come in rather than once it is
+   * closed: the list shows up, and can be filtered and picked from, while the input is still being
+   * produced. Whole lines are sent, in batches, until the input ends or an entry is picked.
+   */
+  std::expected<ipc::DMenuResponse, std::string> streamDMenu(ipc::DMenuRequest req, int input) {
+    static constexpr size_t STREAM_BATCH_SIZE = 1 << 16;
+    static constexpr auto STREAM_BATCH_DELAY = std::chrono::milliseconds(50);
+    using Clock = std::chrono::steady_clock;
+
+    std::optional<std::expected<ipc::DMenuResponse, std::string>> result;
+    std::string pending;
+    auto lastSent = Clock::now();
+    char buf[STREAM_BATCH_SIZE];
+
+    req.stream = true;
+    m_client.ipc().dmenu(req, [&result](auto res) { result = std::move(res); });
+
+    while (!result) {
+      auto const sinceSent = Clock::now() - lastSent;
+      int timeout = -1;
+
+      if (!pending.empty()) {
+        auto const left = STREAM_BATCH_DELAY - sinceSent;
+        timeout = static_cast<int>(
+            std::max<int64_t>(0, std::chrono::duration_cast<std::chrono::milliseconds>(left).count()));
+      }
+
+      // a negative descriptor is left out, once the input is done
+      std::array<pollfd, 2> fds{{{.fd = m_sock.fd(), .events = POLLIN}, {.fd = input, .events = POLLIN}}};
+
+      if (::poll(fds.data(), fds.size(), timeout) == -1) {
+        if (errno == EINTR) continue;
+        return std::unexpected(std::format("Failed to wait for input: {}", strerror(errno)));
+      }
+
+      // replies to the appends, and eventually the one to the dmenu itself
+      if (fds[0].revents != 0) {
+        auto data = recv();
+        if (!data) return std::unexpected(data.error());
+        if (auto res = m_client.route(*data); !res) return std::unexpected(res.error());
+        continue;
+      }
+
+      bool done = false;
+
+      if (fds[1].revents != 0) {
+        auto const n = ::read(input, buf, sizeof(buf));
+        if (n == -1 && errno == EINTR) continue;
+        if (n == -1) return std::unexpected(std::format("Failed to read input: {}", strerror(errno)));
+        if (n == 0) done = true;
+        pending.append(buf, static_cast<size_t>(n > 0 ? n : 0));
+      }
+
+      if (!done && pending.size() < STREAM_BATCH_SIZE && Clock::now() - lastSent < STREAM_BATCH_DELAY) {
+        continue;
+      }
+
+      // a line is only sent once it is complete, unless the input is done
+      size_t const cut = done ? pending.size() : pending.rfind('\n') + 1;
+
+      if (cut > 0 || done) {
+        m_client.ipc().dmenuAppend(pending.substr(0, cut), done, [](auto) {});
+        pending.erase(0, cut);
+      }
+      lastSent = Clock::now();
+      if (done) input = -1;
+    }
+
+    return *result;
+  }
+#endif
+
 private:
   IpcClient(LocalSocket sock)
       : m_sock(std::move(sock)), m_transport(m_sock), m_rpc(m_transport), m_client(m_rpc) {}
@@ -18,6 +18,11 @@ public:
   bool writeAll(const void *data, size_t n);
   bool readAll(void *data, size_t n);
 
+#ifndef _WIN32
+  // for polling, reads and writes still go through the socket
+  int fd() const { return m_fd; }
+#endif
+
 private:
 #ifdef _WIN32
   explicit LocalSocket(void *handle) : m_handle(handle) {}
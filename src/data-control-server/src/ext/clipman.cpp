@@ -40,7 +40,7 @@ void ExtClipman::selection(ExtDataDevice &, ExtDataOffer &offer) {
   auto &mimes = offer.mimes();
   if (std::ranges::find(mimes, Clipboard::CONCEALED_MIME_TYPE) != mimes.end()) return;
 
-  auto selection = Selection::buildSelection(Selection::filterMimes(mimes), offer);
+  auto selection = Selection::buildSelection(Selection::filterMimes(mimes), offer, m_inlineLimit);
   m_writer(selection);
 }
 
@@ -96,12 +96,13 @@ void ExtClipman::start() {
   }
 }
 
-ExtClipman *ExtClipman::instance(SelectionWriter writer) {
-  static ExtClipman app{writer};
+ExtClipman *ExtClipman::instance(SelectionWriter writer, size_t inlineLimit) {
+  static ExtClipman app{writer, inlineLimit};
   return &app;
 }
 
-ExtClipman::ExtClipman(SelectionWriter writer) : m_writer(writer), _dcm(nullptr), _seat(nullptr) {
+ExtClipman::ExtClipman(SelectionWriter writer, size_t inlineLimit)
+    : m_writer(writer), m_inlineLimit(inlineLimit), _dcm(nullptr), _seat(nullptr) {
   _registry = registry();
   _registry->addListener(this);
 }
@@ -9,21 +9,26 @@
 #include <wayland-util.h>
 #include "data-control-client.hpp"
 #include "wayland/display.hpp"
+#include "selection.hpp"
 #include "common/clipboard-protocol.hpp"
 
-using SelectionWriter = void (*)(const clipboard_proto::Selection &);
+using SelectionWriter = void (*)(Selection::ReceivedSelection &);
 
 class ExtClipman : public WaylandDisplay, public WaylandRegistry::Listener, public ExtDataDevice::Listener {
 
 public:
   virtual ~ExtClipman() = default;
-  static ExtClipman *instance(SelectionWriter writer = nullptr);
+  /**
+   * Offers larger than `inlineLimit` are handed to the writer spooled, rather than in the selection.
+   */
+  static ExtClipman *instance(SelectionWriter writer = nullptr, size_t inlineLimit = SIZE_MAX);
   void start();
   void setClipboard(const clipboard_proto::Selection &selection);
-  ExtClipman(SelectionWriter writer);
+  ExtClipman(SelectionWriter writer, size_t inlineLimit);
 
 private:
   SelectionWriter m_writer;
+  size_t m_inlineLimit;
   std::unique_ptr<WaylandRegistry> _registry;
   std::unique_ptr<ExtDataControlManager> _dcm;
   std::unique_ptr<WaylandSeat> _seat;
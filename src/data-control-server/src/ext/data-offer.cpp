@@ -1,6 +1,9 @@
 #include "data-offer.hpp"
 #include "clipman.hpp"
 #include <cstring>
+#include <fcntl.h>
+
+static constexpr int RECEIVE_PIPE_SIZE = 1 << 20;
 
 ExtDataOffer::ExtDataOffer(ext_data_control_offer_v1 *offer) : _offer(offer) {
   ext_data_control_offer_v1_add_listener(offer, &_listener, this);
@@ -14,26 +17,41 @@ void ExtDataOffer::offer(void *data, ext_data_control_offer_v1 *, const char *mi
   self->_mimes.emplace_back(mime);
 }
 
-std::string ExtDataOffer::receive(const std::string &mime) {
-  std::string data;
+int ExtDataOffer::requestReceive(const std::string &mime) {
   int pipefd[2];
 
-  if (pipe(pipefd) == -1) { throw std::runtime_error(std::string("Failed to pipe(): ") + strerror(errno)); }
+  if (pipe2(pipefd, O_CLOEXEC) == -1) {
+    throw std::runtime_error(std::string("Failed to pipe(): ") + strerror(errno));
+  }
+
+  // fewer wakeups for large offers, the default is only 64K
+  fcntl(pipefd[0], F_SETPIPE_SZ, RECEIVE_PIPE_SIZE);
 
+  // the request holds its own copy of the write end until it is sent
   ext_data_control_offer_v1_receive(_offer, mime.c_str(), pipefd[1]);
-  // Important, otherwise we will block on read forever
-  ExtClipman::instance()->flush();
   close(pipefd[1]);
 
+  return pipefd[0];
+}
+
+// Important, otherwise we will block on read forever
+void ExtDataOffer::flush() { ExtClipman::instance()->flush(); }
+
+std::string ExtDataOffer::receive(const std::string &mime) {
+  std::string data;
+  int const fd = requestReceive(mime);
+
+  flush();
+
   int rc = 0;
 
-  while ((rc = read(pipefd[0], _buf, sizeof(_buf))) > 0) {
+  while ((rc = read(fd, _buf, sizeof(_buf))) > 0) {
     data += std::string_view(_buf, rc);
   }
 
   if (rc == -1) { perror("failed to read read end of the pipe"); }
 
-  close(pipefd[0]);
+  close(fd);
 
   return data;
 }
@@ -23,6 +23,8 @@ public:
    * processing it.
    */
   std::string receive(const std::string &mime) override;
+  int requestReceive(const std::string &mime) override;
+  void flush() override;
   const std::vector<std::string> &mimes() const override;
   ext_data_control_offer_v1 *pointer() const { return _offer; }
 
@@ -1,13 +1,68 @@
 #include <iostream>
+#include <cerrno>
 #include <cstring>
+#include <charconv>
 #include <netinet/in.h>
+#include <string_view>
+#include <sys/socket.h>
 #include <wayland-client.h>
 #include <glaze/glaze.hpp>
 #include "ext-data-control-v1-client-protocol.h"
 #include "ext/clipman.hpp"
 #include "common/clipboard-protocol.hpp"
 
-static void writeSelection(const clipboard_proto::Selection &selection) {
+// offers past this size are passed as memfds, when the server gave us a socket to pass them on
+static constexpr size_t INLINE_LIMIT = 64 * 1024;
+
+static int fdSocket = -1;
+static uint64_t selectionSequence = 0;
+
+static bool sendFd(int socket, int fd, clipboard_proto::SpooledOffer spooled) {
+  iovec iov{.iov_base = &spooled, .iov_len = sizeof(spooled)};
+  alignas(cmsghdr) char control[CMSG_SPACE(sizeof(int))] = {};
+  msghdr msg{};
+
+  msg.msg_iov = &iov;
+  msg.msg_iovlen = 1;
+  msg.msg_control = control;
+  msg.msg_controllen = sizeof(control);
+
+  cmsghdr *cmsg = CMSG_FIRSTHDR(&msg);
+  cmsg->cmsg_level = SOL_SOCKET;
+  cmsg->cmsg_type = SCM_RIGHTS;
+  cmsg->cmsg_len = CMSG_LEN(sizeof(int));
+  std::memcpy(CMSG_DATA(cmsg), &fd, sizeof(int));
+
+  while (sendmsg(socket, &msg, MSG_NOSIGNAL) == -1) {
+    if (errno != EINTR) return false;
+  }
+
+  return true;
+}
+
+static void writeSelection(Selection::ReceivedSelection &received) {
+  auto &selection = received.selection;
+  auto spool = received.spools.begin();
+
+  selection.sequence = ++selectionSequence;
+
+  // memfds go first so that they are waiting on the socket by the time the server reads the selection
+  for (size_t i = 0; i != selection.offers.size(); ++i) {
+    auto &offer = selection.offers[i];
+
+    if (!offer.spooled) continue;
+
+    clipboard_proto::SpooledOffer const spooled{.selection = selection.sequence,
+                                                .offer = static_cast<uint32_t>(i)};
+
+    if (fdSocket == -1 || !sendFd(fdSocket, spool->fd(), spooled)) {
+      std::cerr << "Failed to pass offer as a memfd, inlining it: " << strerror(errno) << std::endl;
+      offer.data = spool->takeData();
+      offer.spooled = false;
+    }
+    ++spool;
+  }
+
   std::string buf;
   if (auto err = glz::write_beve(selection, buf)) {
     std::cerr << "Failed to serialize clipboard selection" << std::endl;
@@ -58,14 +113,20 @@ static bool detectProtocol() {
   return found;
 }
 
-int main(int, char **) {
+int main(int argc, char **argv) {
+  for (int i = 1; i + 1 < argc; ++i) {
+    if (std::string_view(argv[i]) != clipboard_proto::FD_SOCKET_ARG) continue;
+    std::string_view const value = argv[i + 1];
+    std::from_chars(value.data(), value.data() + value.size(), fdSocket);
+  }
+
   if (!detectProtocol()) {
     std::cerr << "ext-data-control-v1 protocol not available" << std::endl;
     return 1;
   }
 
   try {
-    ExtClipman::instance(&writeSelection)->start();
+    ExtClipman::instance(&writeSelection, fdSocket == -1 ? SIZE_MAX : INLINE_LIMIT)->start();
   } catch (const std::exception &e) {
     std::cerr << "Fatal error: " << e.what() << std::endl;
     return 1;
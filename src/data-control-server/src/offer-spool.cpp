@@ -0,0 +1,112 @@
+#include <cerrno>
+#include <cstdio>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <utility>
+#include "offer-spool.hpp"
+
+static constexpr size_t READ_SIZE = 1 << 16;
+static constexpr size_t SPLICE_SIZE = 1 << 20;
+
+OfferSpool::OfferSpool(OfferSpool &&other) noexcept
+    : m_inlineLimit(other.m_inlineLimit), m_data(std::move(other.m_data)),
+      m_fd(std::exchange(other.m_fd, -1)), m_canSplice(other.m_canSplice) {}
+
+OfferSpool &OfferSpool::operator=(OfferSpool &&other) noexcept {
+  if (this != &other) {
+    if (m_fd != -1) close(m_fd);
+    m_inlineLimit = other.m_inlineLimit;
+    m_data = std::move(other.m_data);
+    m_fd = std::exchange(other.m_fd, -1);
+    m_canSplice = other.m_canSplice;
+  }
+  return *this;
+}
+
+OfferSpool::~OfferSpool() {
+  if (m_fd != -1) close(m_fd);
+}
+
+ssize_t OfferSpool::readFrom(int fd) {
+  // straight from the pipe to the memfd, without going through userspace
+  if (spooled() && m_canSplice) {
+    ssize_t const n = splice(fd, nullptr, m_fd, nullptr, SPLICE_SIZE, SPLICE_F_MOVE | SPLICE_F_NONBLOCK);
+    if (n >= 0 || errno != EINVAL) return n;
+    m_canSplice = false;
+  }
+
+  uint8_t buf[READ_SIZE];
+  ssize_t const n = read(fd, buf, sizeof(buf));
+
+  if (n <= 0) return n;
+  if (spooled()) return writeAll(buf, n) ? n : -1;
+
+  m_data.insert(m_data.end(), buf, buf + n);
+  if (m_data.size() > m_inlineLimit && !spill()) return -1;
+
+  return n;
+}
+
+bool OfferSpool::spill() {
+  m_fd = memfd_create("vicinae-clipboard-offer", MFD_CLOEXEC | MFD_ALLOW_SEALING);
+
+  if (m_fd == -1) {
+    perror("memfd_create() failed, keeping offer in memory");
+    m_inlineLimit = SIZE_MAX;
+    return true;
+  }
+
+  if (!writeAll(m_data.data(), m_data.size())) return false;
+
+  m_data = {};
+
+  return true;
+}
+
+bool OfferSpool::writeAll(const uint8_t *data, size_t size) {
+  size_t written = 0;
+
+  while (written < size) {
+    ssize_t const n = write(m_fd, data + written, size - written);
+    if (n < 0) {
+      if (errno == EINTR) continue;
+      perror("failed to write offer to memfd");
+      return false;
+    }
+    written += n;
+  }
+
+  return true;
+}
+
+bool OfferSpool::seal() {
+  if (!spooled()) return true;
+  return fcntl(m_fd, F_ADD_SEALS, F_SEAL_SHRINK | F_SEAL_GROW | F_SEAL_WRITE | F_SEAL_SEAL) == 0;
+}
+
+std::vector<uint8_t> OfferSpool::takeData() {
+  if (!spooled()) return std::move(m_data);
+
+  struct stat st{};
+  std::vector<uint8_t> data;
+
+  if (fstat(m_fd, &st) == 0) {
+    data.resize(st.st_size);
+
+    size_t done = 0;
+    while (done < data.size()) {
+      ssize_t const n = pread(m_fd, data.data() + done, data.size() - done, static_cast<off_t>(done));
+      if (n < 0 && errno == EINTR) continue;
+      if (n <= 0) break;
+      done += n;
+    }
+    data.resize(done);
+  }
+
+  close(m_fd);
+  m_fd = -1;
+
+  return data;
+}
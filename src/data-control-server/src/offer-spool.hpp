@@ -0,0 +1,46 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <sys/types.h>
+#include <vector>
+
+/**
+ * Data of an offer as it is received. It stays in memory while small and moves to a memfd once it grows
+ * past the inline limit, so that large offers can be handed over as a file descriptor instead of being
+ * copied through the selection message.
+ */
+class OfferSpool {
+public:
+  explicit OfferSpool(size_t inlineLimit) : m_inlineLimit(inlineLimit) {}
+  OfferSpool(OfferSpool &&other) noexcept;
+  OfferSpool &operator=(OfferSpool &&other) noexcept;
+  OfferSpool(const OfferSpool &) = delete;
+  OfferSpool &operator=(const OfferSpool &) = delete;
+  ~OfferSpool();
+
+  /**
+   * Move what is readable from `fd` into the spool.
+   * Returns like read(2): the number of bytes moved, 0 at end of file and -1 on error.
+   */
+  ssize_t readFrom(int fd);
+
+  /**
+   * Seal the memfd, if the data went to one, so that the receiver knows it can't change under it.
+   */
+  bool seal();
+
+  bool spooled() const { return m_fd != -1; }
+  int fd() const { return m_fd; }
+
+  // all of the data, read back from the memfd if it went to one
+  std::vector<uint8_t> takeData();
+
+private:
+  bool spill();
+  bool writeAll(const uint8_t *data, size_t size);
+
+  size_t m_inlineLimit;
+  std::vector<uint8_t> m_data;
+  int m_fd = -1;
+  bool m_canSplice = true;
+};
@@ -1,4 +1,7 @@
 #include "selection.hpp"
+#include <cerrno>
+#include <cstdio>
+#include <poll.h>
 
 namespace Selection {
 
@@ -35,20 +38,81 @@ std::set<std::string> filterMimes(const std::vector<std::string> &offerMimes) {
   return filteredMimes;
 }
 
-clipboard_proto::Selection buildSelection(const std::set<std::string> &filteredMimes, OfferReceiver &offer) {
-  clipboard_proto::Selection selection;
-  selection.offers.reserve(filteredMimes.size());
+ReceivedSelection buildSelection(const std::set<std::string> &filteredMimes, OfferReceiver &offer,
+                                 size_t inlineLimit) {
+  struct Transfer {
+    size_t index;
+    int fd;
+    OfferSpool spool;
+  };
+
+  ReceivedSelection received;
+  std::vector<Transfer> transfers;
+  auto &offers = received.selection.offers;
+
+  offers.reserve(filteredMimes.size());
 
+  // all requests go out at once so that the source can answer them in any order, instead of paying a
+  // round trip per offer and waiting on the slowest one before asking for the next
   for (const auto &mime : filteredMimes) {
-    std::vector<uint8_t> data;
     if (!Wayland::isFlagMime(mime)) {
-      auto raw = offer.receive(mime);
-      data.assign(raw.begin(), raw.end());
+      transfers.emplace_back(Transfer{
+          .index = offers.size(), .fd = offer.requestReceive(mime), .spool = OfferSpool(inlineLimit)});
+    }
+    offers.emplace_back(clipboard_proto::Offer{.mime_type = mime});
+  }
+
+  offer.flush();
+
+  std::vector<pollfd> fds;
+  std::vector<Transfer *> active;
+
+  for (;;) {
+    fds.clear();
+    active.clear();
+
+    for (auto &transfer : transfers) {
+      if (transfer.fd == -1) continue;
+      fds.push_back({.fd = transfer.fd, .events = POLLIN, .revents = 0});
+      active.push_back(&transfer);
+    }
+
+    if (fds.empty()) break;
+
+    if (poll(fds.data(), fds.size(), -1) < 0) {
+      if (errno == EINTR) continue;
+      perror("poll() failed while receiving offers");
+      break;
+    }
+
+    for (size_t i = 0; i != fds.size(); ++i) {
+      if (fds[i].revents == 0) continue;
+
+      auto &transfer = *active[i];
+      ssize_t const n = transfer.spool.readFrom(transfer.fd);
+
+      if (n > 0 || (n < 0 && (errno == EINTR || errno == EAGAIN))) continue;
+      if (n < 0) perror("failed to read offer data");
+
+      close(transfer.fd);
+      transfer.fd = -1;
+    }
+  }
+
+  for (auto &transfer : transfers) {
+    auto &target = offers[transfer.index];
+
+    if (transfer.fd != -1) close(transfer.fd);
+
+    if (transfer.spool.spooled() && transfer.spool.seal()) {
+      target.spooled = true;
+      received.spools.emplace_back(std::move(transfer.spool));
+    } else {
+      target.data = transfer.spool.takeData();
     }
-    selection.offers.emplace_back(clipboard_proto::Offer{.mime_type = mime, .data = std::move(data)});
   }
 
-  return selection;
+  return received;
 }
 
 void printDebug(const std::set<std::string> &filteredMimes, OfferReceiver &offer, const char *label) {
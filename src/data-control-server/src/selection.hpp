@@ -8,6 +8,7 @@
 #include <optional>
 #include <unistd.h>
 #include "wayland/mime.hpp"
+#include "offer-spool.hpp"
 #include "common/clipboard-protocol.hpp"
 
 class OfferReceiver {
@@ -15,6 +16,13 @@ public:
   virtual ~OfferReceiver() = default;
   virtual const std::vector<std::string> &mimes() const = 0;
   virtual std::string receive(const std::string &mime) = 0;
+
+  /**
+   * Ask for the data of `mime` without waiting for it, returning the read end of the pipe it is going to
+   * be written to. Requests only go out on `flush`, so that many can be in flight at once.
+   */
+  virtual int requestReceive(const std::string &mime) = 0;
+  virtual void flush() = 0;
 };
 
 namespace Selection {
@@ -22,8 +30,20 @@ namespace Selection {
 inline const std::vector<std::string_view> preferredImageTypes = {"image/gif", "image/png", "image/jpeg",
                                                                   "image/jpg", "image/webp"};
 
+struct ReceivedSelection {
+  clipboard_proto::Selection selection;
+  // the data of the offers marked as spooled, in the same order
+  std::vector<OfferSpool> spools;
+};
+
 std::set<std::string> filterMimes(const std::vector<std::string> &offerMimes);
-clipboard_proto::Selection buildSelection(const std::set<std::string> &filteredMimes, OfferReceiver &offer);
+
+/**
+ * Receive every offer of the selection concurrently. Offers larger than `inlineLimit` are spooled to
+ * memfds instead of being kept in the selection.
+ */
+ReceivedSelection buildSelection(const std::set<std::string> &filteredMimes, OfferReceiver &offer,
+                                 size_t inlineLimit = SIZE_MAX);
 void printDebug(const std::set<std::string> &filteredMimes, OfferReceiver &offer, const char *label);
 void printPrimarySelectionDebug(OfferReceiver &offer);
 
@@ -0,0 +1,82 @@
+#include <catch2/catch_test_macros.hpp>
+#include <cstdint>
+#include <fcntl.h>
+#include <string>
+#include <string_view>
+#include <unistd.h>
+#include <vector>
+#include "offer-spool.hpp"
+
+namespace {
+
+// the read end of a pipe holding `data`, closed on the write side
+int pipeOf(std::string_view data) {
+  int fds[2];
+
+  REQUIRE(pipe(fds) == 0);
+  REQUIRE(write(fds[1], data.data(), data.size()) == static_cast<ssize_t>(data.size()));
+  close(fds[1]);
+
+  return fds[0];
+}
+
+void readAll(OfferSpool &spool, int fd) {
+  while (spool.readFrom(fd) > 0) {}
+  close(fd);
+}
+
+std::string asString(const std::vector<uint8_t> &data) { return {data.begin(), data.end()}; }
+
+} // namespace
+
+TEST_CASE("offer spool keeps small offers in memory") {
+  OfferSpool spool(16);
+
+  readAll(spool, pipeOf("hello"));
+
+  CHECK_FALSE(spool.spooled());
+  CHECK(spool.seal());
+  CHECK(asString(spool.takeData()) == "hello");
+}
+
+TEST_CASE("offer spool moves offers past the inline limit to a sealed memfd") {
+  OfferSpool spool(16);
+  std::string const data(40000, 'x');
+
+  readAll(spool, pipeOf(data));
+
+  REQUIRE(spool.spooled());
+  REQUIRE(spool.seal());
+
+  int const seals = fcntl(spool.fd(), F_GET_SEALS);
+  CHECK((seals & F_SEAL_WRITE) != 0);
+  CHECK((seals & F_SEAL_SHRINK) != 0);
+  CHECK(write(spool.fd(), "y", 1) == -1);
+
+  CHECK(asString(spool.takeData()) == data);
+  CHECK_FALSE(spool.spooled());
+}
+
+TEST_CASE("offer spool keeps reading into the memfd once it spilled") {
+  OfferSpool spool(4);
+
+  readAll(spool, pipeOf("first part"));
+  REQUIRE(spool.spooled());
+  readAll(spool, pipeOf(", second part"));
+
+  CHECK(asString(spool.takeData()) == "first part, second part");
+}
+
+TEST_CASE("offer spool hands its memfd over when moved") {
+  OfferSpool spool(4);
+
+  readAll(spool, pipeOf("spooled data"));
+  REQUIRE(spool.spooled());
+
+  int const fd = spool.fd();
+  OfferSpool moved = std::move(spool);
+
+  CHECK(moved.fd() == fd);
+  CHECK_FALSE(spool.spooled());
+  CHECK(asString(moved.takeData()) == "spooled data");
+}
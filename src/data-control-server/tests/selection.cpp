@@ -0,0 +1,102 @@
+#include <catch2/catch_test_macros.hpp>
+#include <map>
+#include <string>
+#include <unistd.h>
+#include <vector>
+#include "common/clipboard-formats.hpp"
+#include "selection.hpp"
+
+namespace {
+
+/**
+ * Offer whose data is written to the pipes of all requests on `flush`, the last requested first, as a
+ * source is free to answer in any order.
+ */
+class FakeOffer : public OfferReceiver {
+public:
+  explicit FakeOffer(std::map<std::string, std::string> data) : m_data(std::move(data)) {
+    for (const auto &[mime, _] : m_data) {
+      m_mimes.emplace_back(mime);
+    }
+  }
+
+  const std::vector<std::string> &mimes() const override { return m_mimes; }
+  std::string receive(const std::string &mime) override { return m_data.at(mime); }
+
+  int requestReceive(const std::string &mime) override {
+    int fds[2];
+
+    REQUIRE(pipe(fds) == 0);
+    m_pending.push_back({mime, fds[1]});
+    requested.emplace_back(mime);
+
+    return fds[0];
+  }
+
+  void flush() override {
+    for (auto it = m_pending.rbegin(); it != m_pending.rend(); ++it) {
+      const auto &data = m_data.at(it->first);
+      REQUIRE(write(it->second, data.data(), data.size()) == static_cast<ssize_t>(data.size()));
+      close(it->second);
+    }
+    m_pending.clear();
+  }
+
+  std::vector<std::string> requested;
+
+private:
+  std::map<std::string, std::string> m_data;
+  std::vector<std::string> m_mimes;
+  std::vector<std::pair<std::string, int>> m_pending;
+};
+
+std::string asString(const std::vector<uint8_t> &data) { return {data.begin(), data.end()}; }
+
+} // namespace
+
+TEST_CASE("selection offers are received inline when no limit applies") {
+  FakeOffer offer({{"text/plain;charset=utf-8", "hello"}, {"text/html", "<b>hello</b>"}});
+
+  auto received = Selection::buildSelection(Selection::filterMimes(offer.mimes()), offer);
+  const auto &offers = received.selection.offers;
+
+  REQUIRE(offers.size() == 2);
+  CHECK(offers[0].mime_type == "text/html");
+  CHECK(asString(offers[0].data) == "<b>hello</b>");
+  CHECK(offers[1].mime_type == "text/plain;charset=utf-8");
+  CHECK(asString(offers[1].data) == "hello");
+  CHECK(received.spools.empty());
+}
+
+TEST_CASE("selection offers past the inline limit are spooled in offer order") {
+  std::string const image(30000, 'i');
+  std::string const html(20000, 'h');
+  FakeOffer offer({{"image/png", image}, {"text/html", html}, {"text/plain;charset=utf-8", "short"}});
+
+  auto received = Selection::buildSelection(Selection::filterMimes(offer.mimes()), offer, 1024);
+  auto &offers = received.selection.offers;
+
+  REQUIRE(offers.size() == 3);
+  CHECK(offers[0].spooled);
+  CHECK(offers[0].data.empty());
+  CHECK(offers[1].spooled);
+  CHECK_FALSE(offers[2].spooled);
+  CHECK(asString(offers[2].data) == "short");
+
+  REQUIRE(received.spools.size() == 2);
+  CHECK(asString(received.spools[0].takeData()) == image);
+  CHECK(asString(received.spools[1].takeData()) == html);
+}
+
+TEST_CASE("selection flag offers are kept without asking for their data") {
+  FakeOffer offer({{Clipboard::PASSWORD_HINT_MIME_TYPE, "secret"}, {"text/plain;charset=utf-8", "hunter2"}});
+
+  auto received = Selection::buildSelection(Selection::filterMimes(offer.mimes()), offer);
+  const auto &offers = received.selection.offers;
+
+  CHECK(offer.requested == std::vector<std::string>{"text/plain;charset=utf-8"});
+  REQUIRE(offers.size() == 2);
+  CHECK(offers[0].mime_type == "text/plain;charset=utf-8");
+  CHECK(offers[1].mime_type == Clipboard::PASSWORD_HINT_MIME_TYPE);
+  CHECK(offers[1].data.empty());
+}
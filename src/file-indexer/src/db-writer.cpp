@@ -123,6 +123,20 @@ void DbWriter::indexEvents(std::vector<FileEvent> events) {
   submit([events = std::move(events)](FileIndexerDatabase &db) { db.indexEvents(events); }, true);
 }
 
+void DbWriter::loadPathIndex(std::shared_ptr<file_indexer::PathIndex> index) {
+  submit([index = std::move(index)](FileIndexerDatabase &db) {
+    db.attachPathIndex(index);
+    db.loadPathIndex();
+  });
+}
+
+void DbWriter::detachPathIndex(std::shared_ptr<file_indexer::PathIndex> index) {
+  submit([index = std::move(index)](FileIndexerDatabase &db) {
+    db.attachPathIndex(nullptr);
+    index->clear();
+  });
+}
+
 void DbWriter::rebuildSpellfixVocabulary() {
   if (m_vocabRebuildQueued.exchange(true)) return;
 
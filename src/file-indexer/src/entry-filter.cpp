@@ -5,6 +5,7 @@
 #include <array>
 #include <fstream>
 #include <fnmatch.h>
+#include <mutex>
 #include <ranges>
 #include <string>
 #include <unordered_set>
@@ -182,7 +183,11 @@ void EntryFilter::setExcludedFilenames(std::vector<std::string> filenames) {
   m_excludedFilenames = std::move(filenames);
 }
 
-void EntryFilter::setIgnoreFiles(std::vector<std::string> files) { m_ignoreFiles = std::move(files); }
+void EntryFilter::setIgnoreFiles(std::vector<std::string> files) {
+  m_ignoreFiles = std::move(files);
+  std::unique_lock const lock(m_ignoreCacheMutex);
+  m_ignoreCache.clear();
+}
 
 void EntryFilter::setIgnoreHiddenPaths(bool value) { m_ignoreHiddenPaths = value; }
 
@@ -190,14 +195,10 @@ bool EntryFilter::isIgnored(const fs::path &path) const {
   if (m_ignoreFiles.empty()) return false;
 
   fs::path p = path.parent_path();
-  std::error_code ec;
 
   while (p != p.root_directory()) {
-    for (const auto &name : m_ignoreFiles) {
-      fs::path const ignorePath = p / name;
-
-      if (!fs::is_regular_file(ignorePath, ec)) continue;
-      if (GitIgnoreReader(ignorePath).matches(path)) { return true; }
+    for (const auto &reader : *ignoreReadersIn(p)) {
+      if (reader.matches(path)) { return true; }
     }
 
     p = p.parent_path();
@@ -206,6 +207,28 @@ bool EntryFilter::isIgnored(const fs::path &path) const {
   return false;
 }
 
+EntryFilter::IgnoreReaders EntryFilter::ignoreReadersIn(const fs::path &dir) const {
+  {
+    std::shared_lock const lock(m_ignoreCacheMutex);
+    if (auto it = m_ignoreCache.find(dir.native()); it != m_ignoreCache.end()) return it->second;
+  }
+
+  auto readers = std::make_shared<std::vector<GitIgnoreReader>>();
+  std::error_code ec;
+
+  for (const auto &name : m_ignoreFiles) {
+    fs::path const ignorePath = dir / name;
+    if (fs::is_regular_file(ignorePath, ec)) { readers->emplace_back(ignorePath); }
+  }
+
+  std::unique_lock const lock(m_ignoreCacheMutex);
+
+  // walks go depth-first, so dropping everything now and then only costs a few re-reads
+  if (m_ignoreCache.size() >= IGNORE_CACHE_MAX_ENTRIES) { m_ignoreCache.clear(); }
+
+  return m_ignoreCache.try_emplace(dir.native(), std::move(readers)).first->second;
+}
+
 bool EntryFilter::isExcludedPath(const fs::path &path) const {
   return std::ranges::find(m_excludedPaths, path) != m_excludedPaths.end();
 }
@@ -215,8 +238,10 @@ bool EntryFilter::shouldVisit(const fs::directory_entry &entry) const {
 
   if (entry.is_symlink(ec)) return false;
 
-  const auto &path = entry.path();
+  return shouldVisit(entry.path(), entry.is_directory(ec));
+}
 
+bool EntryFilter::shouldVisit(const fs::path &path, bool isDirectory) const {
   if (m_ignoreHiddenPaths && file_indexer::isHiddenPath(path)) return false;
   if (excludedPaths().contains(path.native())) return false;
 
@@ -225,7 +250,7 @@ bool EntryFilter::shouldVisit(const fs::directory_entry &entry) const {
 
   if (std::ranges::contains(EXCLUDED_FILENAMES, filename) || filename.ends_with(".noindex")) return false;
   if (std::ranges::find(m_excludedFilenames, filename) != m_excludedFilenames.end()) return false;
-  if (entry.is_directory(ec) && isMachineTrashDirectory(path)) return false;
+  if (isDirectory && isMachineTrashDirectory(path)) return false;
 
   if (isIgnored(path)) return false;
   if (isExcludedPath(path)) return false;
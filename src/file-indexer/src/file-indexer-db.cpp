@@ -1,6 +1,7 @@
 #include "file-indexer/file-indexer-db.hpp"
 #include "file-indexer/scan.hpp"
 #include "file-indexer/migrations.hpp"
+#include "file-indexer/path-index.hpp"
 #include "file-indexer/util.hpp"
 #include "file-indexer/vocabulary.hpp"
 #include "file-indexer/log.hpp"
@@ -70,6 +71,37 @@ std::pair<std::string, std::string> subtreeRange(const fs::path &path) {
   return {std::move(lower), std::move(upper)};
 }
 
+// the (directory, basename) pair a path is stored as; a path without a parent sits under the
+// empty directory
+std::pair<fs::path, std::string> splitPath(const fs::path &path) {
+  auto parent = path.parent_path();
+  if (parent == path || !path.has_filename()) return {fs::path{}, path.native()};
+  return {std::move(parent), path.filename().native()};
+}
+
+constexpr const char *FIND_DIRECTORY_SQL =
+    "SELECT id FROM directory WHERE parent_id = :parent_id AND name = :name";
+
+constexpr const char *UPSERT_DIRECTORY_SQL =
+    "INSERT INTO directory(parent_id, name) VALUES (:parent_id, :name) "
+    "ON CONFLICT(parent_id, name) DO UPDATE SET name = excluded.name "
+    "RETURNING id";
+
+// rows below a directory: the recursive CTE walks :dir_id and every directory beneath it
+constexpr const char *DELETE_SUBTREE_FILES_SQL = R"(
+  WITH RECURSIVE subtree(id) AS (
+    SELECT :dir_id UNION ALL SELECT d.id FROM directory d JOIN subtree s ON d.parent_id = s.id
+  )
+  DELETE FROM indexed_file WHERE dir_id IN (SELECT id FROM subtree) RETURNING name
+)";
+
+constexpr const char *DELETE_SUBTREE_DIRECTORIES_SQL = R"(
+  WITH RECURSIVE subtree(id) AS (
+    SELECT :dir_id UNION ALL SELECT d.id FROM directory d JOIN subtree s ON d.parent_id = s.id
+  )
+  DELETE FROM directory WHERE id IN (SELECT id FROM subtree)
+)";
+
 std::string skeletonDocument(const fs::path &path) {
   auto tokens = file_indexer::vocab::tokenizeFilename(path.native());
   std::string document;
@@ -87,6 +119,70 @@ std::string skeletonDocument(const fs::path &path) {
   return document;
 }
 
+void countVocabulary(std::unordered_map<std::string, int64_t> &counts, std::string_view path,
+                     int64_t change) {
+  for (auto &token : file_indexer::vocab::tokenizeFilename(file_indexer::vocab::basenameView(path))) {
+    counts[std::move(token)] += change;
+  }
+}
+
+// writes the path_idx and skeleton_idx documents of a newly inserted indexed_file row
+class SearchDocumentWriter {
+public:
+  explicit SearchDocumentWriter(const db::Database &db)
+      : m_pathStmt(db.prepare("INSERT INTO path_idx(rowid, path) VALUES (:id, :path)")),
+        m_skeletonStmt(db.prepare("INSERT INTO skeleton_idx(rowid, skeleton) VALUES (:id, :skeleton)")) {}
+
+  bool insert(int64_t id, const fs::path &path) {
+    m_pathStmt.bind(":id", id);
+    m_pathStmt.bind(":path", path.native());
+    m_skeletonStmt.bind(":id", id);
+    m_skeletonStmt.bind(":skeleton", skeletonDocument(path));
+
+    return m_pathStmt.exec() && m_skeletonStmt.exec();
+  }
+
+private:
+  db::Statement m_pathStmt;
+  db::Statement m_skeletonStmt;
+};
+
+// deletes an indexed path and everything below it, uncounting the basenames of removed rows
+class PathDeleter {
+public:
+  explicit PathDeleter(const db::Database &db)
+      : m_fileStmt(
+            db.prepare("DELETE FROM indexed_file WHERE dir_id = :dir_id AND name = :name RETURNING name")),
+        m_subtreeFilesStmt(db.prepare(DELETE_SUBTREE_FILES_SQL)),
+        m_subtreeDirectoriesStmt(db.prepare(DELETE_SUBTREE_DIRECTORIES_SQL)) {}
+
+  // parentId is the directory holding the path, dirId the path itself as a directory; either is
+  // unset when no such directory row exists
+  bool erase(std::optional<int64_t> parentId, std::string_view name, std::optional<int64_t> dirId,
+             std::unordered_map<std::string, int64_t> &vocabulary) {
+    auto uncount = [&](db::Statement &row) { countVocabulary(vocabulary, row.columnText(0), -1); };
+
+    if (parentId) {
+      m_fileStmt.bind(":dir_id", *parentId);
+      m_fileStmt.bind(":name", name);
+      if (!m_fileStmt.forEachRow(uncount)) return false;
+    }
+
+    if (dirId) {
+      m_subtreeFilesStmt.bind(":dir_id", *dirId);
+      m_subtreeDirectoriesStmt.bind(":dir_id", *dirId);
+      if (!m_subtreeFilesStmt.forEachRow(uncount) || !m_subtreeDirectoriesStmt.exec()) return false;
+    }
+
+    return true;
+  }
+
+private:
+  db::Statement m_fileStmt;
+  db::Statement m_subtreeFilesStmt;
+  db::Statement m_subtreeDirectoriesStmt;
+};
+
 void bindSearchOptions(db::Statement &stmt, const FileIndexerDatabase::SearchOptions &options) {
   if (options.category) {
     stmt.bind(":category", static_cast<int>(*options.category));
@@ -106,20 +202,19 @@ std::string searchFiltersSql() {
 fs::path FileIndexerDatabase::getDatabasePath() { return file_indexer::databasePath(); }
 
 std::optional<int64_t> FileIndexerDatabase::retrieveFileId(const std::filesystem::path &path) const {
-  auto stmt = m_db.prepare("SELECT id FROM indexed_file WHERE path = :path");
-  stmt.bind(":path", path.c_str());
+  auto stmt = m_db.prepare("SELECT id FROM indexed_file WHERE dir_id = :dir_id AND name = :name");
 
-  if (!stmt.step()) { return std::nullopt; }
+  if (!bindFilePath(stmt, path) || !stmt.step()) { return std::nullopt; }
 
   return stmt.columnInt64(0);
 }
 
 std::optional<int64_t>
 FileIndexerDatabase::retrieveIndexedLastModified(const std::filesystem::path &path) const {
-  auto stmt = m_db.prepare("SELECT last_modified_at FROM indexed_file WHERE path = :path");
-  stmt.bind(":path", path.c_str());
+  auto stmt =
+      m_db.prepare("SELECT last_modified_at FROM indexed_file WHERE dir_id = :dir_id AND name = :name");
 
-  if (!stmt.step()) { return std::nullopt; }
+  if (!bindFilePath(stmt, path) || !stmt.step()) { return std::nullopt; }
   if (stmt.isNull(0)) { return std::nullopt; }
 
   return static_cast<int64_t>(stmt.columnUInt64(0));
@@ -127,45 +222,252 @@ FileIndexerDatabase::retrieveIndexedLastModified(const std::filesystem::path &pa
 
 std::optional<int64_t>
 FileIndexerDatabase::retrieveIndexedSizeBytes(const std::filesystem::path &path) const {
-  auto stmt = m_db.prepare("SELECT size_bytes FROM indexed_file WHERE path = :path");
-  stmt.bind(":path", path.c_str());
+  auto stmt = m_db.prepare("SELECT size_bytes FROM indexed_file WHERE dir_id = :dir_id AND name = :name");
 
-  if (!stmt.step() || stmt.isNull(0)) { return std::nullopt; }
+  if (!bindFilePath(stmt, path) || !stmt.step() || stmt.isNull(0)) { return std::nullopt; }
 
   return stmt.columnInt64(0);
 }
 
 std::optional<int64_t> FileIndexerDatabase::retrieveIndexedAt(const std::filesystem::path &path) const {
-  auto stmt = m_db.prepare("SELECT indexed_at FROM indexed_file WHERE path = :path");
-  stmt.bind(":path", path.c_str());
+  auto stmt = m_db.prepare("SELECT indexed_at FROM indexed_file WHERE dir_id = :dir_id AND name = :name");
 
-  if (!stmt.step() || stmt.isNull(0)) { return std::nullopt; }
+  if (!bindFilePath(stmt, path) || !stmt.step() || stmt.isNull(0)) { return std::nullopt; }
 
   return stmt.columnInt64(0);
 }
 
 std::unordered_set<std::filesystem::path>
 FileIndexerDatabase::listIndexedDirectoryFiles(const std::filesystem::path &path) const {
-  auto dirId = retrieveFileId(path);
+  auto dirId = findDirectoryId(path);
   if (!dirId) { return {}; }
 
-  auto stmt = m_db.prepare("SELECT path FROM indexed_file WHERE parent_id = :parent_id");
-  stmt.bind(":parent_id", *dirId);
+  auto stmt = m_db.prepare("SELECT name FROM indexed_file WHERE dir_id = :dir_id");
+  stmt.bind(":dir_id", *dirId);
 
   std::unordered_set<fs::path> paths;
 
   while (stmt.step()) {
-    paths.emplace(stmt.columnText(0));
+    paths.emplace(path / stmt.columnText(0));
   }
 
   return paths;
 }
 
+std::unordered_map<std::string, FileIndexerDatabase::IndexedEntry>
+FileIndexerDatabase::listIndexedDirectoryEntries(const std::filesystem::path &path) const {
+  auto dirId = findDirectoryId(path);
+  if (!dirId) { return {}; }
+
+  auto stmt = m_db.prepare(
+      "SELECT name, last_modified_at, size_bytes, type FROM indexed_file WHERE dir_id = :dir_id");
+  stmt.bind(":dir_id", *dirId);
+
+  std::unordered_map<std::string, IndexedEntry> entries;
+
+  auto optionalInt = [&](int column) {
+    return stmt.isNull(column) ? std::nullopt : std::optional<int64_t>{stmt.columnInt64(column)};
+  };
+
+  while (stmt.step()) {
+    entries.emplace(stmt.columnText(0), IndexedEntry{.lastModified = optionalInt(1),
+                                                     .sizeBytes = optionalInt(2),
+                                                     .isDirectory = stmt.columnInt(3) == 1});
+  }
+
+  return entries;
+}
+
+std::unordered_set<std::filesystem::path>
+FileIndexerDatabase::listIndexedSubdirectories(const std::filesystem::path &root) const {
+  auto rootId = findDirectoryId(root);
+  if (!rootId) { return {}; }
+
+  // paths are joined in SQL while descending the directory rows, rtrim keeps "/" from doubling
+  auto stmt = m_db.prepare(R"(
+    WITH RECURSIVE subtree(id, path) AS (
+      SELECT :root_id, :root
+      UNION ALL
+      SELECT d.id, rtrim(s.path, '/') || '/' || d.name
+      FROM directory d JOIN subtree s ON d.parent_id = s.id
+    )
+    SELECT rtrim(s.path, '/') || '/' || f.name FROM subtree s JOIN indexed_file f ON f.dir_id = s.id
+    WHERE f.type = 1
+  )");
+  stmt.bind(":root_id", *rootId);
+  stmt.bind(":root", root.native());
+
+  std::unordered_set<fs::path> dirs;
+
+  while (stmt.step()) {
+    dirs.emplace(stmt.columnText(0));
+  }
+
+  return dirs;
+}
+
 bool FileIndexerDatabase::tracksFile(const std::filesystem::path &path) const {
-  auto stmt = m_db.prepare("SELECT COUNT(*) FROM indexed_file WHERE path = :path");
-  stmt.bind(":path", path.c_str());
-  if (stmt.step()) { return stmt.columnInt(0) != 0; }
-  return false;
+  return retrieveFileId(path).has_value();
+}
+
+bool FileIndexerDatabase::bindFilePath(db::Statement &stmt, const fs::path &path) const {
+  auto const [dir, name] = splitPath(path);
+  auto const dirId = findDirectoryId(dir);
+
+  if (!dirId) return false;
+
+  stmt.bind(":dir_id", *dirId);
+  stmt.bind(":name", name);
+  return true;
+}
+
+std::optional<int64_t> FileIndexerDatabase::findDirectoryId(const fs::path &dir) const {
+  return resolveDirectory(dir, FIND_DIRECTORY_SQL);
+}
+
+std::optional<int64_t> FileIndexerDatabase::directoryIdFor(const fs::path &dir) {
+  return resolveDirectory(dir, UPSERT_DIRECTORY_SQL);
+}
+
+std::optional<int64_t> FileIndexerDatabase::resolveDirectory(const fs::path &dir, const char *sql) const {
+  validateDirectoryIds();
+
+  if (auto it = m_directoryIds.find(dir.native()); it != m_directoryIds.end()) { return it->second; }
+
+  db::Statement stmt;
+  fs::path prefix;
+  int64_t id = 0;
+
+  // walk down from the top, resolving each component under its parent
+  for (const auto &component : dir) {
+    if (component.empty()) continue;
+
+    prefix /= component;
+
+    if (auto it = m_directoryIds.find(prefix.native()); it != m_directoryIds.end()) {
+      id = it->second;
+      continue;
+    }
+
+    if (!stmt) { stmt = m_db.prepare(sql); }
+
+    std::optional<int64_t> childId;
+
+    stmt.bind(":parent_id", id);
+    stmt.bind(":name", component.native());
+
+    if (!stmt.forEachRow([&](db::Statement &row) { childId = row.columnInt64(0); })) {
+      flog::warn() << "Failed to resolve directory" << prefix.c_str() << stmt.lastError();
+      return std::nullopt;
+    }
+
+    if (!childId) return std::nullopt;
+
+    id = *childId;
+    cacheDirectory(prefix, id);
+  }
+
+  return id;
+}
+
+std::optional<fs::path> FileIndexerDatabase::directoryPath(int64_t id) const {
+  if (id == 0) return fs::path{};
+  if (auto const *cached = cachedDirectoryPath(id)) { return *cached; }
+
+  auto stmt = m_db.prepare("SELECT parent_id, name FROM directory WHERE id = :id");
+  std::vector<std::pair<int64_t, std::string>> chain;
+  fs::path path;
+
+  // climb until a cached ancestor or the top, then rebuild the path downwards
+  for (int64_t next = id; next != 0;) {
+    if (auto const *cached = cachedDirectoryPath(next)) {
+      path = *cached;
+      break;
+    }
+
+    std::optional<std::pair<int64_t, std::string>> row;
+
+    stmt.bind(":id", next);
+    if (!stmt.forEachRow([&](db::Statement &r) { row.emplace(r.columnInt64(0), r.columnText(1)); }) || !row) {
+      return std::nullopt;
+    }
+
+    chain.emplace_back(next, std::move(row->second));
+    next = row->first;
+  }
+
+  for (auto &[dirId, name] : chain | std::views::reverse) {
+    path /= name;
+    cacheDirectory(path, dirId);
+  }
+
+  return path;
+}
+
+void FileIndexerDatabase::validateDirectoryIds() const {
+  if (!m_dataVersionStmt) { m_dataVersionStmt = m_db.prepare("PRAGMA data_version"); }
+
+  std::optional<int64_t> version;
+
+  if (!m_dataVersionStmt.forEachRow([&](db::Statement &row) { version = row.columnInt64(0); })) {
+    version.reset();
+  }
+
+  // the version only moves on commits by other connections, which may have deleted and
+  // recreated a directory under a new id
+  if (!version || version != m_directoryIdsVersion) { m_directoryIds.clear(); }
+
+  m_directoryIdsVersion = version;
+}
+
+const fs::path *FileIndexerDatabase::cachedDirectoryPath(int64_t id) const {
+  auto it = m_directoryPaths.find(id);
+  if (it == m_directoryPaths.end()) return nullptr;
+
+  m_directoryUses.splice(m_directoryUses.begin(), m_directoryUses, it->second.use);
+
+  return &it->second.path;
+}
+
+void FileIndexerDatabase::cacheDirectory(const fs::path &dir, int64_t id) const {
+  if (auto it = m_directoryPaths.find(id); it != m_directoryPaths.end()) {
+    m_directoryUses.splice(m_directoryUses.begin(), m_directoryUses, it->second.use);
+  } else {
+    if (m_directoryPaths.size() >= DIRECTORY_CACHE_MAX_ENTRIES) {
+      auto const evicted = m_directoryPaths.find(m_directoryUses.back());
+
+      if (auto idIt = m_directoryIds.find(evicted->second.path.native());
+          idIt != m_directoryIds.end() && idIt->second == evicted->first) {
+        m_directoryIds.erase(idIt);
+      }
+
+      m_directoryPaths.erase(evicted);
+      m_directoryUses.pop_back();
+    }
+
+    m_directoryUses.emplace_front(id);
+    m_directoryPaths.emplace(id, CachedDirectory{.path = dir, .use = m_directoryUses.begin()});
+  }
+
+  m_directoryIds.insert_or_assign(dir.native(), id);
+}
+
+void FileIndexerDatabase::clearDirectoryCache() {
+  m_directoryIds.clear();
+  m_directoryPaths.clear();
+  m_directoryUses.clear();
+}
+
+void FileIndexerDatabase::forgetDirectorySubtree(const fs::path &dir) {
+  auto [lower, upper] = subtreeRange(dir);
+
+  m_directoryIds.erase(dir.native());
+  m_directoryIds.erase(m_directoryIds.lower_bound(lower), m_directoryIds.lower_bound(upper));
+}
+
+void FileIndexerDatabase::rollback(db::Transaction &tx) {
+  tx.rollback();
+  clearDirectoryCache();
 }
 
 void FileIndexerDatabase::init() {
@@ -354,7 +656,7 @@ FileIndexerDatabase::searchCandidates(std::string_view searchQuery, int limit, c
   if (searchQuery.empty() || limit <= 0) return {};
 
   std::string sql = R"(
-    SELECT f.path, f.category, mt.name
+    SELECT f.dir_id, f.name, f.category, mt.name, f.type
     FROM indexed_file f
     JOIN path_idx ON path_idx.rowid = f.id
     LEFT JOIN mime_type mt ON mt.id = f.mime_type_id
@@ -370,15 +672,24 @@ FileIndexerDatabase::searchCandidates(std::string_view searchQuery, int limit, c
   stmt.bind(":limit", limit);
   bindSearchOptions(stmt, options);
 
+  return readSearchCandidates(stmt, limit);
+}
+
+std::vector<FileIndexerDatabase::SearchCandidate>
+FileIndexerDatabase::readSearchCandidates(db::Statement &stmt, int limit) const {
   std::vector<SearchCandidate> results;
 
   results.reserve(limit);
 
   while (stmt.step()) {
+    auto dir = directoryPath(stmt.columnInt64(0));
+    if (!dir) continue;
+
     results.emplace_back(SearchCandidate{
-        .path = stmt.columnText(0),
-        .category = static_cast<IndexedFileCategory>(stmt.columnInt(1)),
-        .mimeType = stmt.isNull(2) ? std::nullopt : std::optional<std::string>{stmt.columnText(2)}});
+        .path = *dir / stmt.columnText(1),
+        .category = static_cast<IndexedFileCategory>(stmt.columnInt(2)),
+        .mimeType = stmt.isNull(3) ? std::nullopt : std::optional<std::string>{stmt.columnText(3)},
+        .isDirectory = stmt.columnInt(4) == 1});
   }
 
   return results;
@@ -390,7 +701,7 @@ FileIndexerDatabase::searchSkeletonCandidates(std::string_view searchQuery, int
   if (searchQuery.empty() || limit <= 0) return {};
 
   std::string sql = R"(
-    SELECT f.path, f.category, mt.name
+    SELECT f.dir_id, f.name, f.category, mt.name, f.type
     FROM indexed_file f
     JOIN skeleton_idx ON skeleton_idx.rowid = f.id
     LEFT JOIN mime_type mt ON mt.id = f.mime_type_id
@@ -409,46 +720,61 @@ FileIndexerDatabase::searchSkeletonCandidates(std::string_view searchQuery, int
   stmt.bind(":limit", limit);
   bindSearchOptions(stmt, options);
 
-  std::vector<SearchCandidate> results;
-
-  results.reserve(limit);
-
-  while (stmt.step()) {
-    results.emplace_back(SearchCandidate{
-        .path = stmt.columnText(0),
-        .category = static_cast<IndexedFileCategory>(stmt.columnInt(1)),
-        .mimeType = stmt.isNull(2) ? std::nullopt : std::optional<std::string>{stmt.columnText(2)}});
-  }
-
-  return results;
+  return readSearchCandidates(stmt, limit);
 }
 void FileIndexerDatabase::deleteIndexedFiles(const std::vector<fs::path> &paths) {
   auto tx = m_db.transaction();
 
-  auto stmt = m_db.prepare("DELETE FROM indexed_file WHERE path = :path");
-  auto subtreeStmt = m_db.prepare("DELETE FROM indexed_file WHERE path >= :lower AND path < :upper");
+  PathDeleter deleter{m_db};
+  file_indexer::PathIndex::Batch indexBatch;
+  VocabularyDelta vocabulary;
 
   for (const auto &path : paths) {
-    auto [lower, upper] = subtreeRange(path);
-
-    stmt.bind(":path", path.c_str());
-    subtreeStmt.bind(":lower", lower);
-    subtreeStmt.bind(":upper", upper);
+    auto const [dir, name] = splitPath(path);
 
-    if (!stmt.exec() || !subtreeStmt.exec()) {
+    if (!deleter.erase(findDirectoryId(dir), name, findDirectoryId(path), vocabulary)) {
       flog::error() << "Failed to delete indexed file" << path.c_str();
-      tx.rollback();
+      rollback(tx);
       return;
     }
+
+    forgetDirectorySubtree(path);
+    indexBatch.erase(path);
   }
 
-  if (!tx.commit()) { flog::error() << "Failed to commit"; }
+  if (!applyVocabularyDelta(vocabulary)) {
+    flog::error() << "Failed to update spellfix vocabulary" << m_db.lastError();
+    rollback(tx);
+    return;
+  }
+
+  if (!tx.commit()) {
+    flog::error() << "Failed to commit";
+    return;
+  }
+
+  if (m_pathIndex) { m_pathIndex->apply(indexBatch); }
 }
 
 void FileIndexerDatabase::deleteAllIndexedFiles() {
-  if (!m_db.exec("DELETE FROM indexed_file")) {
+  auto tx = m_db.transaction();
+
+  if (!m_db.exec("DELETE FROM indexed_file") || !m_db.exec("DELETE FROM directory") ||
+      !resetSpellfixVocabulary()) {
     flog::error() << "Failed to delete all indexed files" << m_db.lastError();
+    rollback(tx);
+    return;
+  }
+
+  if (!tx.commit()) {
+    flog::error() << "Failed to commit" << m_db.lastError();
+    return;
   }
+
+  m_directoryIds.clear();
+
+  // an empty load leaves a ready, empty index
+  if (m_pathIndex && m_pathIndex->isReady()) { m_pathIndex->load(); }
 }
 
 bool FileIndexerDatabase::needsCompaction() const {
@@ -470,6 +796,20 @@ bool FileIndexerDatabase::needsCompaction() const {
 void FileIndexerDatabase::compact() {
   flog::info() << "Compacting file indexer database";
 
+  // directories whose files were all deleted one by one are left behind by the writes
+  if (!m_db.exec(R"(
+    DELETE FROM directory WHERE id NOT IN (
+      WITH RECURSIVE used(id) AS (
+        SELECT dir_id FROM indexed_file UNION SELECT d.parent_id FROM directory d JOIN used u ON d.id = u.id
+      )
+      SELECT id FROM used
+    )
+  )")) {
+    flog::warn() << "Failed to drop unused directories" << m_db.lastError();
+  }
+
+  m_directoryIds.clear();
+
   // merge the incremental FTS b-trees first so VACUUM can reclaim the pages they free
   if (!m_db.exec("INSERT INTO path_idx(path_idx) VALUES('optimize')")) {
     flog::warn() << "path_idx optimize failed" << m_db.lastError();
@@ -492,38 +832,26 @@ void FileIndexerDatabase::rebuildSpellfixVocabulary() {
   using namespace std::chrono;
 
   auto const start = steady_clock::now();
-  std::unordered_map<std::string, int64_t> counts;
+  VocabularyDelta counts;
 
   {
-    auto stmt = m_db.prepare("SELECT path FROM indexed_file");
+    auto stmt = m_db.prepare("SELECT name FROM indexed_file");
 
     while (stmt.step()) {
-      auto const path = stmt.columnText(0);
-
-      for (auto &token : file_indexer::vocab::tokenizeFilename(file_indexer::vocab::basenameView(path))) {
-        ++counts[std::move(token)];
-      }
+      countVocabulary(counts, stmt.columnText(0), 1);
     }
   }
 
   auto tx = m_db.transaction();
 
-  if (!m_db.exec("DROP TABLE IF EXISTS spellfix_vocab") ||
-      !m_db.exec("CREATE VIRTUAL TABLE spellfix_vocab USING spellfix1")) {
+  if (!resetSpellfixVocabulary()) {
     flog::error() << "Failed to recreate spellfix_vocab" << m_db.lastError();
     return;
   }
 
-  auto insert = m_db.prepare("INSERT INTO spellfix_vocab(word, rank) VALUES (:word, :rank)");
-
-  for (const auto &[word, count] : counts) {
-    insert.bind(":word", word);
-    insert.bind(":rank", count);
-
-    if (!insert.exec()) {
-      flog::error() << "Failed to insert vocabulary word" << m_db.lastError();
-      return;
-    }
+  if (!applyVocabularyDelta(counts)) {
+    flog::error() << "Failed to insert vocabulary word" << m_db.lastError();
+    return;
   }
 
   if (!tx.commit()) {
@@ -537,10 +865,78 @@ void FileIndexerDatabase::rebuildSpellfixVocabulary() {
 }
 
 bool FileIndexerDatabase::hasSpellfixVocabulary() {
-  auto stmt = m_db.prepare("SELECT 1 FROM spellfix_vocab_vocab LIMIT 1");
+  auto stmt = m_db.prepare("SELECT 1 FROM vocab_token LIMIT 1");
   return static_cast<bool>(stmt) && stmt.step();
 }
 
+bool FileIndexerDatabase::resetSpellfixVocabulary() {
+  return m_db.exec("DROP TABLE IF EXISTS spellfix_vocab") &&
+         m_db.exec("CREATE VIRTUAL TABLE spellfix_vocab USING spellfix1") &&
+         m_db.exec("DELETE FROM vocab_token");
+}
+
+bool FileIndexerDatabase::applyVocabularyDelta(const VocabularyDelta &delta) {
+  if (delta.empty()) return true;
+
+  auto select = m_db.prepare("SELECT count, spellfix_id FROM vocab_token WHERE word = :word");
+  auto insertWord = m_db.prepare("INSERT INTO spellfix_vocab(word, rank) VALUES (:word, :rank)");
+  auto insertToken =
+      m_db.prepare("INSERT INTO vocab_token(word, count, spellfix_id) VALUES (:word, :count, :spellfix_id)");
+  auto updateToken = m_db.prepare("UPDATE vocab_token SET count = :count WHERE word = :word");
+  // straight to the shadow table: going through the virtual table would re-derive the phonetic keys
+  auto updateRank = m_db.prepare("UPDATE spellfix_vocab_vocab SET rank = :rank WHERE id = :spellfix_id");
+  auto deleteToken = m_db.prepare("DELETE FROM vocab_token WHERE word = :word");
+  auto deleteWord = m_db.prepare("DELETE FROM spellfix_vocab WHERE rowid = :spellfix_id");
+
+  for (const auto &[word, change] : delta) {
+    if (change == 0) continue;
+
+    int64_t count = 0;
+    std::optional<int64_t> spellfixId;
+
+    select.bind(":word", word);
+    if (!select.forEachRow([&](db::Statement &row) {
+          count = row.columnInt64(0);
+          spellfixId = row.columnInt64(1);
+        })) {
+      return false;
+    }
+
+    count += change;
+
+    if (count <= 0) {
+      if (!spellfixId) continue;
+
+      deleteWord.bind(":spellfix_id", *spellfixId);
+      deleteToken.bind(":word", word);
+      if (!deleteWord.exec() || !deleteToken.exec()) return false;
+    } else if (!spellfixId) {
+      insertWord.bind(":word", word);
+      insertWord.bind(":rank", count);
+      if (!insertWord.exec()) return false;
+
+      insertToken.bind(":word", word);
+      insertToken.bind(":count", count);
+      insertToken.bind(":spellfix_id", m_db.lastInsertRowId());
+      if (!insertToken.exec()) return false;
+    } else {
+      updateToken.bind(":word", word);
+      updateToken.bind(":count", count);
+      updateRank.bind(":spellfix_id", *spellfixId);
+      updateRank.bind(":rank", count);
+      if (!updateToken.exec() || !updateRank.exec()) return false;
+    }
+  }
+
+  return true;
+}
+
+int64_t FileIndexerDatabase::lastFileId() const {
+  auto stmt = m_db.prepare("SELECT coalesce(max(id), 0) FROM indexed_file");
+  if (!stmt.step()) return 0;
+  return stmt.columnInt64(0);
+}
+
 std::optional<int64_t> FileIndexerDatabase::mimeTypeIdFor(std::string_view name) {
   if (name.empty()) return std::nullopt;
 
@@ -600,68 +996,80 @@ void FileIndexerDatabase::indexEvents(const std::vector<FileEvent> &events) {
 
   auto modifyStmt = m_db.prepare(R"(
     INSERT INTO
-      indexed_file (path, skeleton_path, parent_id, last_modified_at, type, category, size_bytes, mime_type_id)
+      indexed_file (dir_id, name, last_modified_at, type, category, size_bytes, mime_type_id)
     VALUES
-      (:path, :skeleton_path, :parent_id, :last_modified_at, :type, :category, :size_bytes, :mime_type_id)
-    ON CONFLICT (path) DO UPDATE SET last_modified_at = excluded.last_modified_at,
-      skeleton_path = excluded.skeleton_path, parent_id = excluded.parent_id, type = excluded.type,
-      category = excluded.category, size_bytes = excluded.size_bytes, mime_type_id = excluded.mime_type_id,
-      indexed_at = unixepoch()
+      (:dir_id, :name, :last_modified_at, :type, :category, :size_bytes, :mime_type_id)
+    ON CONFLICT (dir_id, name) DO UPDATE SET last_modified_at = excluded.last_modified_at,
+      type = excluded.type, category = excluded.category, size_bytes = excluded.size_bytes,
+      mime_type_id = excluded.mime_type_id, indexed_at = unixepoch()
+    RETURNING id
   )");
 
-  auto deleteStmt = m_db.prepare("DELETE FROM indexed_file WHERE path = :path");
-  auto deleteSubtreeStmt = m_db.prepare("DELETE FROM indexed_file WHERE path >= :lower AND path < :upper");
-
-  std::unordered_map<std::string, std::optional<int64_t>> parentIds;
-
-  auto resolveParent = [&](const fs::path &path) -> std::optional<int64_t> {
-    auto parent = path.parent_path();
-    if (parent.empty() || parent == path) { return std::nullopt; }
-    auto [it, inserted] = parentIds.try_emplace(parent.native());
-    if (inserted) { it->second = retrieveFileId(parent); }
-    return it->second;
-  };
+  SearchDocumentWriter documents{m_db};
+  PathDeleter deleter{m_db};
+  file_indexer::PathIndex::Batch indexBatch;
+  VocabularyDelta vocabulary;
+  int64_t lastId = lastFileId();
 
   for (const auto &event : events) {
+    auto const [dir, name] = splitPath(event.path);
     bool ok = false;
 
     switch (event.type) {
     case FileEventType::Modify: {
-      using namespace std::chrono;
-      auto const secondsSinceEpoch =
-          static_cast<int64_t>(duration_cast<seconds>(event.eventTime.time_since_epoch()).count());
-      modifyStmt.bind(":last_modified_at", secondsSinceEpoch);
-      modifyStmt.bind(":path", event.path.c_str());
-      modifyStmt.bind(":skeleton_path", skeletonDocument(event.path));
-      modifyStmt.bind(":parent_id", resolveParent(event.path));
+      auto const dirId = directoryIdFor(dir);
+      if (!dirId) break;
+
+      modifyStmt.bind(":last_modified_at", file_indexer::epochSeconds(event.eventTime));
+      modifyStmt.bind(":dir_id", *dirId);
+      modifyStmt.bind(":name", name);
+      auto const category = indexedFileCategoryFor(event.path, event.isDirectory);
+      auto const mimeType = mimeTypeNameFor(event.path, event.isDirectory);
       modifyStmt.bind(":type", event.isDirectory ? 1 : 0);
-      modifyStmt.bind(":category", static_cast<int>(indexedFileCategoryFor(event.path, event.isDirectory)));
+      modifyStmt.bind(":category", static_cast<int>(category));
       modifyStmt.bind(":size_bytes", event.sizeBytes);
-      modifyStmt.bind(":mime_type_id", mimeTypeIdFor(mimeTypeNameFor(event.path, event.isDirectory)));
-      ok = modifyStmt.exec();
+      modifyStmt.bind(":mime_type_id", mimeTypeIdFor(mimeType));
+      int64_t id = 0;
+      ok = modifyStmt.forEachRow([&](db::Statement &row) { id = row.columnInt64(0); });
+
+      // ids only grow, so one past the last known id is an insert rather than an update
+      if (ok && id > lastId) {
+        lastId = id;
+        countVocabulary(vocabulary, name, 1);
+        ok = documents.insert(id, event.path);
+      }
+
+      indexBatch.upsert(event.path, event.isDirectory, category, mimeType);
       break;
     }
 
     case FileEventType::Delete: {
-      auto [lower, upper] = subtreeRange(event.path);
-
-      deleteStmt.bind(":path", event.path.c_str());
-      deleteSubtreeStmt.bind(":lower", lower);
-      deleteSubtreeStmt.bind(":upper", upper);
-
-      ok = deleteStmt.exec() && deleteSubtreeStmt.exec();
+      ok = deleter.erase(findDirectoryId(dir), name, findDirectoryId(event.path), vocabulary);
+      forgetDirectorySubtree(event.path);
+      indexBatch.erase(event.path);
       break;
     }
     }
 
     if (!ok) {
       flog::error() << "Failed to index event for" << event.path.string() << m_db.lastError();
-      tx.rollback();
+      rollback(tx);
       return;
     }
   }
 
-  if (!tx.commit()) { flog::error() << "Failed to commit"; }
+  if (!applyVocabularyDelta(vocabulary)) {
+    flog::error() << "Failed to update spellfix vocabulary" << m_db.lastError();
+    rollback(tx);
+    return;
+  }
+
+  if (!tx.commit()) {
+    flog::error() << "Failed to commit";
+    return;
+  }
+
+  if (m_pathIndex) { m_pathIndex->apply(indexBatch); }
 }
 
 void FileIndexerDatabase::indexFiles(const std::vector<std::filesystem::path> &paths) {
@@ -669,59 +1077,123 @@ void FileIndexerDatabase::indexFiles(const std::vector<std::filesystem::path> &p
 
   auto stmt = m_db.prepare(R"(
     INSERT INTO
-      indexed_file (path, skeleton_path, parent_id, last_modified_at, type, category, size_bytes, mime_type_id)
+      indexed_file (dir_id, name, last_modified_at, type, category, size_bytes, mime_type_id)
     VALUES
-      (:path, :skeleton_path, :parent_id, :last_modified_at, :type, :category, :size_bytes, :mime_type_id)
-    ON CONFLICT (path) DO UPDATE SET last_modified_at = excluded.last_modified_at,
-      skeleton_path = excluded.skeleton_path, parent_id = excluded.parent_id, type = excluded.type,
-      category = excluded.category, size_bytes = excluded.size_bytes, mime_type_id = excluded.mime_type_id,
-      indexed_at = unixepoch()
+      (:dir_id, :name, :last_modified_at, :type, :category, :size_bytes, :mime_type_id)
+    ON CONFLICT (dir_id, name) DO UPDATE SET last_modified_at = excluded.last_modified_at,
+      type = excluded.type, category = excluded.category, size_bytes = excluded.size_bytes,
+      mime_type_id = excluded.mime_type_id, indexed_at = unixepoch()
+    RETURNING id
   )");
 
   std::error_code ec;
-  double score = 1.0;
-  std::unordered_map<std::string, std::optional<int64_t>> parentIds;
-
-  auto resolveParent = [&](const fs::path &path) -> std::optional<int64_t> {
-    auto parent = path.parent_path();
-    if (parent.empty() || parent == path) { return std::nullopt; }
-    auto [it, inserted] = parentIds.try_emplace(parent.native());
-    if (inserted) { it->second = retrieveFileId(parent); }
-    return it->second;
-  };
+  SearchDocumentWriter documents{m_db};
+  file_indexer::PathIndex::Batch indexBatch;
+  VocabularyDelta vocabulary;
+  int64_t lastId = lastFileId();
 
   for (const auto &path : paths) {
-    if (auto lastModified = fs::last_write_time(path, ec); !ec) {
-      using namespace std::chrono;
-      auto sctp = clock_cast<system_clock>(lastModified);
-      auto const epoch = static_cast<int64_t>(duration_cast<seconds>(sctp.time_since_epoch()).count());
+    auto const [dir, name] = splitPath(path);
+    auto const dirId = directoryIdFor(dir);
 
-      stmt.bind(":last_modified_at", epoch);
+    if (!dirId) {
+      flog::error() << "Failed to insert directory in index" << dir.string() << m_db.lastError();
+      rollback(tx);
+      return;
+    }
+
+    if (auto lastModified = fs::last_write_time(path, ec); !ec) {
+      stmt.bind(":last_modified_at", file_indexer::epochSeconds(lastModified));
     } else {
       stmt.bindNull(":last_modified_at");
     }
 
-    stmt.bind(":path", path.c_str());
-    stmt.bind(":skeleton_path", skeletonDocument(path));
-    stmt.bind(":parent_id", resolveParent(path));
+    stmt.bind(":dir_id", *dirId);
+    stmt.bind(":name", name);
     bool const isDirectory = fs::is_directory(path, ec);
+    auto const category = indexedFileCategoryFor(path, isDirectory);
+    auto const mimeType = mimeTypeNameFor(path, isDirectory);
     stmt.bind(":type", isDirectory ? 1 : 0);
-    stmt.bind(":category", static_cast<int>(indexedFileCategoryFor(path, isDirectory)));
+    stmt.bind(":category", static_cast<int>(category));
     stmt.bind(":size_bytes", file_indexer::fileSizeBytesFor(path, isDirectory));
-    stmt.bind(":mime_type_id", mimeTypeIdFor(mimeTypeNameFor(path, isDirectory)));
+    stmt.bind(":mime_type_id", mimeTypeIdFor(mimeType));
+
+    int64_t id = 0;
 
-    if (!stmt.exec()) {
+    if (!stmt.forEachRow([&](db::Statement &row) { id = row.columnInt64(0); })) {
       flog::error() << "Failed to insert file in index" << path.string() << stmt.lastError();
-      tx.rollback();
+      rollback(tx);
       return;
     }
+
+    // ids only grow, so one past the last known id is an insert rather than an update
+    if (id > lastId) {
+      lastId = id;
+      countVocabulary(vocabulary, name, 1);
+
+      if (!documents.insert(id, path)) {
+        flog::error() << "Failed to index file path" << path.string() << m_db.lastError();
+        rollback(tx);
+        return;
+      }
+    }
+
+    indexBatch.upsert(path, isDirectory, category, mimeType);
   }
 
-  if (!tx.commit()) { flog::error() << "Failed to commit batchIndex" << m_db.lastError(); }
+  if (!applyVocabularyDelta(vocabulary)) {
+    flog::error() << "Failed to update spellfix vocabulary" << m_db.lastError();
+    rollback(tx);
+    return;
+  }
+
+  if (!tx.commit()) {
+    flog::error() << "Failed to commit batchIndex" << m_db.lastError();
+    return;
+  }
+
+  if (m_pathIndex) { m_pathIndex->apply(indexBatch); }
+}
+
+void FileIndexerDatabase::attachPathIndex(std::shared_ptr<file_indexer::PathIndex> index) {
+  m_pathIndex = std::move(index);
+}
+
+void FileIndexerDatabase::loadPathIndex() {
+  using namespace std::chrono;
+
+  if (!m_pathIndex) return;
+
+  auto const start = steady_clock::now();
+  auto stmt = m_db.prepare(R"(
+    SELECT f.dir_id, f.name, f.type, f.category, mt.name
+    FROM indexed_file f
+    LEFT JOIN mime_type mt ON mt.id = f.mime_type_id
+  )");
+  size_t count = 0;
+
+  {
+    auto loader = m_pathIndex->load();
+
+    while (stmt.step()) {
+      auto const dir = directoryPath(stmt.columnInt64(0));
+      if (!dir) continue;
+
+      auto const mimeType = stmt.isNull(4) ? std::string{} : stmt.columnText(4);
+
+      auto const category = static_cast<IndexedFileCategory>(stmt.columnInt(3));
+
+      loader.add((*dir / stmt.columnText(1)).native(), stmt.columnInt(2) == 1, category, mimeType);
+      ++count;
+    }
+  }
+
+  auto const elapsed = duration_cast<milliseconds>(steady_clock::now() - start);
+  flog::info() << "Loaded resident path index: " << count << " files in " << elapsed.count() << "ms";
 }
 
 std::vector<fs::path> FileIndexerDatabase::listRecentDirectories(int limit) const {
-  auto stmt = m_db.prepare("SELECT path FROM indexed_file WHERE type = 1 "
+  auto stmt = m_db.prepare("SELECT dir_id, name FROM indexed_file WHERE type = 1 "
                            "ORDER BY last_modified_at DESC LIMIT :limit");
   stmt.bind(":limit", limit);
 
@@ -730,7 +1202,7 @@ std::vector<fs::path> FileIndexerDatabase::listRecentDirectories(int limit) cons
   dirs.reserve(limit);
 
   while (stmt.step()) {
-    dirs.emplace_back(stmt.columnText(0));
+    if (auto dir = directoryPath(stmt.columnInt64(0))) { dirs.emplace_back(*dir / stmt.columnText(1)); }
   }
 
   return dirs;
@@ -1,5 +1,8 @@
 #include "file-indexer/file-indexer-query-engine.hpp"
+#include "file-indexer/db-writer.hpp"
 #include "file-indexer/log.hpp"
+#include "file-indexer/path-stat.hpp"
+#include "file-indexer/scoring-pool.hpp"
 #include "file-indexer/vocabulary.hpp"
 #include "fuzzy/fzf.hpp"
 #include "fuzzy/scored.hpp"
@@ -9,11 +12,11 @@
 #include <filesystem>
 #include <functional>
 #include <iomanip>
+#include <optional>
 #include <ranges>
+#include <span>
 #include <string>
 #include <string_view>
-#include <system_error>
-#include <thread>
 #include <unordered_set>
 #include <utility>
 #include <vector>
@@ -23,6 +26,7 @@ namespace fs = std::filesystem;
 namespace {
 
 using namespace file_indexer::query;
+using file_indexer::CancellationToken;
 
 using SC = FileIndexerDatabase::SearchCandidate;
 using Scorer = std::function<int(const SC &)>;
@@ -30,6 +34,11 @@ using Scorer = std::function<int(const SC &)>;
 constexpr const auto SCORING_BATCH_SIZE = 500;
 constexpr const auto FZF_CUTOFF = 0;
 constexpr const auto CANDIDATE_LIMIT = 10000;
+// how long the candidates of a session's last query stay usable, bounding how long files indexed since
+// go unnoticed by the queries narrowing it down
+constexpr const auto SESSION_CANDIDATES_TTL = std::chrono::seconds(10);
+// resident results are stat'ed after the index is released, from this many times `limit` copies
+constexpr const size_t RESIDENT_STAT_HEADROOM = 2;
 constexpr const auto SUGGESTION_FETCH_COUNT = 20;
 constexpr const auto MAX_CORRECTIONS_PER_WORD = 3;
 constexpr const auto MIN_CORRECTABLE_WORD_LENGTH = 3;
@@ -40,6 +49,42 @@ constexpr const double CORRECTION_FULL_PAGE_CONFIDENCE_THRESHOLD = 0.5;
 
 enum class SubstringMatch { None, Inner, TokenStart };
 
+// a path split at its last separator, so resident index entries are scored without being joined
+struct PathView {
+  std::string_view dirname;
+  std::string_view filename;
+
+  size_t size() const { return dirname.size() + 1 + filename.size(); }
+  char front() const { return dirname.empty() ? '/' : dirname.front(); }
+  std::string_view extension() const {
+    if (auto const pos = filename.rfind('.'); pos != std::string_view::npos) return filename.substr(pos + 1);
+    return {};
+  }
+};
+
+PathView pathViewOf(const SC &candidate) {
+  return {.dirname = file_indexer::vocab::dirnameView(candidate.path.c_str()),
+          .filename = file_indexer::vocab::basenameView(candidate.path.c_str())};
+}
+
+// lexicographic order of the joined paths, without joining them
+bool pathLess(const PathView &a, const PathView &b) {
+  auto const joined = [](const PathView &p, size_t i) {
+    if (i < p.dirname.size()) return p.dirname[i];
+    if (i == p.dirname.size()) return '/';
+    return p.filename[i - p.dirname.size() - 1];
+  };
+  size_t const common = std::min(a.size(), b.size());
+
+  for (size_t i = 0; i != common; ++i) {
+    auto const ca = static_cast<unsigned char>(joined(a, i));
+    auto const cb = static_cast<unsigned char>(joined(b, i));
+    if (ca != cb) return ca < cb;
+  }
+
+  return a.size() < b.size();
+}
+
 struct SkeletonMergeDecision {
   bool shouldMerge = true;
   std::string_view reason = "no-strict-candidates";
@@ -49,6 +94,21 @@ struct SkeletonMergeDecision {
   double confidence = 0;
 };
 
+// routes cancellation of the token to the statements run while in scope
+class InterruptScope {
+public:
+  InterruptScope(db::Database &db, const CancellationToken &token) : m_db(db) {
+    m_db.setInterruptFlag(token.flag());
+  }
+  ~InterruptScope() { m_db.setInterruptFlag(nullptr); }
+
+  InterruptScope(const InterruptScope &) = delete;
+  InterruptScope &operator=(const InterruptScope &) = delete;
+
+private:
+  db::Database &m_db;
+};
+
 bool isSingleTokenQuery(std::string_view query) {
   return !query.empty() && std::ranges::none_of(query, [](unsigned char c) { return std::isspace(c); });
 }
@@ -95,11 +155,10 @@ SubstringMatch substringMatch(std::string_view text, std::string_view query) {
   return hasInnerMatch ? SubstringMatch::Inner : SubstringMatch::None;
 }
 
-double computeSubstringMatchMultiplier(const SC &candidate, std::string_view query) {
+double computeSubstringMatchMultiplier(const PathView &path, std::string_view query) {
   if (!isSingleTokenQuery(query)) return 1.0;
 
-  auto match = std::max(substringMatch(file_indexer::vocab::basenameView(candidate.path.c_str()), query),
-                        substringMatch(file_indexer::vocab::dirnameView(candidate.path.c_str()), query));
+  auto match = std::max(substringMatch(path.filename, query), substringMatch(path.dirname, query));
 
   switch (match) {
   case SubstringMatch::TokenStart:
@@ -113,16 +172,15 @@ double computeSubstringMatchMultiplier(const SC &candidate, std::string_view que
   return 1.0;
 }
 
-double computeFileRelevanceMultiplier(const SC &candidate) {
-  auto pcstr = std::string_view{candidate.path.c_str()};
-  auto ext = file_indexer::vocab::fileExtensionView(candidate.path.c_str());
+double computeFileRelevanceMultiplier(const PathView &path) {
+  auto ext = path.extension();
 
-  if (pcstr.starts_with("#") && pcstr.ends_with("#")) { return 0.1; }
+  if (path.front() == '#' && path.filename.ends_with("#")) { return 0.1; }
   if (ext.starts_with("#")) return 0.1;
 
   if (ext == "o") { return 0.5; }
 
-  if (pcstr.ends_with("~")) return 0.3;
+  if (path.filename.ends_with("~")) return 0.3;
   if (ext == "swp") return 0.5;
   if (ext == "swo") return 0.5;
   if (ext == "swm") return 0.5;
@@ -130,16 +188,16 @@ double computeFileRelevanceMultiplier(const SC &candidate) {
   return 1.0;
 }
 
-int scoreCandidate(const SC &candidate, const fzf::Query &query) {
+int scorePath(const PathView &path, const fzf::Query &query) {
   const auto &ranker = fzf::threadLocalMatcher();
-  auto pcstr = candidate.path.c_str();
-  auto filename = file_indexer::vocab::basenameView(pcstr);
-  auto dirname = file_indexer::vocab::dirnameView(pcstr);
-  std::initializer_list<fzf::WeightedString> strs = {{filename, 1}, {dirname, 0.7}};
+  std::initializer_list<fzf::WeightedString> strs = {{path.filename, 1}, {path.dirname, 0.7}};
   int score = ranker.score_query(strs, query).weighted;
 
-  return score * computeFileRelevanceMultiplier(candidate) *
-         computeSubstringMatchMultiplier(candidate, query.text);
+  return score * computeFileRelevanceMultiplier(path) * computeSubstringMatchMultiplier(path, query.text);
+}
+
+int scoreCandidate(const SC &candidate, const fzf::Query &query) {
+  return scorePath(pathViewOf(candidate), query);
 }
 
 int scoreCandidate(const SC &candidate, const CorrectionPlan &plan) {
@@ -175,9 +233,8 @@ void sortCandidates(std::vector<ScoredRef<SC>> &ranked) {
     const auto psB = b.data->path.native().size();
     if (psA != psB) return std::cmp_less(psA, psB);
 
-    std::error_code ec;
-    auto typeA = fs::is_directory(a.data->path, ec) ? 0 : 1;
-    auto typeB = fs::is_directory(b.data->path, ec) ? 0 : 1;
+    auto typeA = a.data->isDirectory ? 0 : 1;
+    auto typeB = b.data->isDirectory ? 0 : 1;
 
     if (typeA != typeB) return std::cmp_greater(typeA, typeB);
 
@@ -185,54 +242,86 @@ void sortCandidates(std::vector<ScoredRef<SC>> &ranked) {
   });
 }
 
-std::vector<ScoredRef<SC>> scoreCandidatesParallel(std::span<const SC> candidates, const Scorer &scorer) {
-  size_t const threadCount =
-      std::min<size_t>((candidates.size() + SCORING_BATCH_SIZE - 1) / SCORING_BATCH_SIZE,
-                       std::max(1u, std::thread::hardware_concurrency()));
-  size_t const chunkSize = (candidates.size() + threadCount - 1) / threadCount;
-  std::vector<Scored<const SC *>> ranked;
+// Takes results from the top of the ranking, checking existence one window of missing results at a
+// time so that only about `limit` paths are ever stat'ed. Paths that are gone go to `stale`; paths
+// that could not be stat'ed for any other reason are left out of the results but kept in the index.
+template <typename T, typename PathOf, typename ToResult>
+std::vector<IndexerFileResult> existingResults(std::span<const ScoredRef<T>> ranked, int limit,
+                                               const PathOf &pathOf, const ToResult &toResult,
+                                               std::vector<fs::path> &stale) {
+  if (limit <= 0) return {};
 
-  ranked.resize(candidates.size());
+  auto const wanted = static_cast<size_t>(limit);
+  std::vector<IndexerFileResult> results;
+
+  results.reserve(wanted);
+
+  while (results.size() < wanted && !ranked.empty()) {
+    auto const window = ranked.first(std::min(wanted - results.size(), ranked.size()));
+    auto paths = window | std::views::transform(pathOf) | std::ranges::to<std::vector>();
+    auto const states = file_indexer::pathStates(paths);
+
+    for (size_t i = 0; i != window.size(); ++i) {
+      switch (states[i]) {
+      case file_indexer::PathState::Exists:
+        results.emplace_back(toResult(window[i], std::move(paths[i])));
+        break;
+      case file_indexer::PathState::Missing:
+        stale.emplace_back(std::move(paths[i]));
+        break;
+      case file_indexer::PathState::Unknown:
+        break;
+      }
+    }
+
+    ranked = ranked.subspan(window.size());
+  }
+
+  return results;
+}
 
-  std::vector<std::thread> threads;
+// unsorted, with candidates at or under FZF_CUTOFF dropped; empty once the token got cancelled
+template <typename T, typename ScoreFn>
+std::vector<ScoredRef<T>> scoreCandidatesParallel(std::span<const T> candidates, const ScoreFn &scorer,
+                                                  const CancellationToken &token) {
+  size_t const chunkSize = SCORING_BATCH_SIZE;
+  size_t const chunkCount = (candidates.size() + chunkSize - 1) / chunkSize;
+  std::vector<ScoredRef<T>> ranked;
   std::vector<size_t> cutCounts;
 
-  threads.resize(threadCount);
-  cutCounts.resize(threadCount);
+  ranked.resize(candidates.size());
+  cutCounts.resize(chunkCount);
 
-  flog::debug() << "scoring " << candidates.size() << " candidates using " << threads.size() << " threads\n";
+  flog::debug() << "scoring " << candidates.size() << " candidates in " << chunkCount << " chunks\n";
 
-  for (auto [idx, thread] : threads | std::views::enumerate) {
-    thread = std::thread{[&, idx]() {
-      const auto start = idx * chunkSize;
-      const auto end = std::min(static_cast<size_t>(start + chunkSize), ranked.size());
-      auto &z = cutCounts[idx];
-      z = 0;
+  auto scoreChunk = [&](size_t chunk) {
+    const auto start = chunk * chunkSize;
+    const auto end = std::min(start + chunkSize, ranked.size());
+    auto &z = cutCounts[chunk];
+    z = 0;
 
-      for (auto i = start; i != end; ++i) {
-        auto &candidate = candidates[i];
-        auto score = scorer(candidate);
-        ranked[i] = {&candidate, score};
-        if (score <= FZF_CUTOFF) z += 1;
-      }
-    }};
-  }
+    for (auto i = start; i != end; ++i) {
+      auto &candidate = candidates[i];
+      auto score = scorer(candidate);
+      ranked[i] = {&candidate, score};
+      if (score <= FZF_CUTOFF) z += 1;
+    }
+  };
 
-  for (auto &thread : threads) {
-    thread.join();
-  }
+  if (!file_indexer::ScoringPool::shared().run(chunkCount, scoreChunk, token)) return {};
 
   auto cutCount = std::ranges::fold_left(cutCounts, 0, std::plus{});
 
-  sortCandidates(ranked);
-  ranked.resize(ranked.size() - cutCount);
+  if (cutCount > 0) { std::erase_if(ranked, [](const auto &scored) { return scored.score <= FZF_CUTOFF; }); }
 
   return ranked;
 }
 
-std::vector<ScoredRef<SC>> scoreCandidates(std::span<const SC> candidates, const Scorer &scorer) {
+template <typename T, typename ScoreFn>
+std::vector<ScoredRef<T>> scoreAll(std::span<const T> candidates, const ScoreFn &scorer,
+                                   const CancellationToken &token) {
   if (candidates.size() < SCORING_BATCH_SIZE) {
-    std::vector<ScoredRef<SC>> ranked;
+    std::vector<ScoredRef<T>> ranked;
 
     ranked.reserve(candidates.size());
 
@@ -241,40 +330,37 @@ std::vector<ScoredRef<SC>> scoreCandidates(std::span<const SC> candidates, const
       if (score > FZF_CUTOFF) ranked.push_back({&candidate, score});
     }
 
-    sortCandidates(ranked);
-
     return ranked;
   }
 
-  return scoreCandidatesParallel(candidates, scorer);
+  return scoreCandidatesParallel(candidates, scorer, token);
 }
 
-std::vector<IndexerFileResult> resultsFromRankedCandidates(const std::vector<ScoredRef<SC>> &ranked,
-                                                           int limit) {
-  if (limit <= 0) return {};
-
-  std::error_code ec;
-  std::vector<IndexerFileResult> results;
-
-  results.reserve(static_cast<size_t>(limit));
+std::vector<ScoredRef<SC>> scoreCandidates(std::span<const SC> candidates, const Scorer &scorer,
+                                           const CancellationToken &token) {
+  auto ranked = scoreAll(candidates, scorer, token);
+  sortCandidates(ranked);
+  return ranked;
+}
 
-  for (const auto &scored : ranked) {
-    if (fs::exists(scored.data->path, ec)) {
-      results.emplace_back(IndexerFileResult{.path = std::move(scored.data->path),
-                                             .rank = static_cast<double>(scored.score),
-                                             .category = scored.data->category,
-                                             .mimeType = scored.data->mimeType});
-      if (results.size() == static_cast<size_t>(limit)) break;
-    }
-  }
+std::vector<IndexerFileResult> resultsFromRankedCandidates(const std::vector<ScoredRef<SC>> &ranked,
+                                                           int limit, std::vector<fs::path> &stale) {
+  auto pathOf = [](const ScoredRef<SC> &scored) { return scored.data->path; };
+  auto toResult = [](const ScoredRef<SC> &scored, fs::path path) {
+    return IndexerFileResult{.path = std::move(path),
+                             .rank = static_cast<double>(scored.score),
+                             .category = scored.data->category,
+                             .mimeType = scored.data->mimeType};
+  };
 
-  return results;
+  return existingResults(std::span{ranked}, limit, pathOf, toResult, stale);
 }
 
-std::vector<IndexerFileResult> rankCandidates(std::vector<SC> candidates, const Scorer &scorer, int limit) {
-  const auto ranked = scoreCandidates(std::span<const SC>{candidates}, scorer);
+std::vector<IndexerFileResult> rankCandidates(std::vector<SC> candidates, const Scorer &scorer, int limit,
+                                              const CancellationToken &token, std::vector<fs::path> &stale) {
+  const auto ranked = scoreCandidates(std::span<const SC>{candidates}, scorer, token);
 
-  return resultsFromRankedCandidates(ranked, limit);
+  return resultsFromRankedCandidates(ranked, limit, stale);
 }
 
 int idealScoreForQuery(std::string_view query) {
@@ -316,14 +402,11 @@ bool acceptsCorrectionResults(const std::vector<ScoredRef<SC>> &ranked, const Co
           confidence >= CORRECTION_FULL_PAGE_CONFIDENCE_THRESHOLD);
 }
 
-SkeletonMergeDecision skeletonMergeDecision(const std::vector<ScoredRef<SC>> &ranked, std::string_view query,
+SkeletonMergeDecision skeletonMergeDecision(int bestScore, size_t rankedCount, std::string_view query,
                                             int limit) {
-  if (ranked.empty()) return {};
+  if (rankedCount == 0) return {};
 
-  SkeletonMergeDecision decision{.shouldMerge = false,
-                                 .reason = "strict-confident",
-                                 .bestPath = ranked.front().data->path,
-                                 .bestScore = ranked.front().score};
+  SkeletonMergeDecision decision{.shouldMerge = false, .reason = "strict-confident", .bestScore = bestScore};
 
   int const idealScore = idealScoreForQuery(query);
   decision.idealScore = idealScore;
@@ -335,7 +418,7 @@ SkeletonMergeDecision skeletonMergeDecision(const std::vector<ScoredRef<SC>> &ra
   if (decision.confidence < SKELETON_CONFIDENCE_THRESHOLD) {
     decision.shouldMerge = true;
     decision.reason = "low-strict-confidence";
-  } else if (ranked.size() < static_cast<size_t>(limit) && isAbbreviationLikeQuery(query)) {
+  } else if (rankedCount < static_cast<size_t>(limit) && isAbbreviationLikeQuery(query)) {
     decision.shouldMerge = true;
     decision.reason = "sparse-abbreviation-query";
   }
@@ -343,9 +426,55 @@ SkeletonMergeDecision skeletonMergeDecision(const std::vector<ScoredRef<SC>> &ra
   return decision;
 }
 
+SkeletonMergeDecision skeletonMergeDecision(const std::vector<ScoredRef<SC>> &ranked, std::string_view query,
+                                            int limit) {
+  if (ranked.empty()) return {};
+
+  auto decision = skeletonMergeDecision(ranked.front().score, ranked.size(), query, limit);
+  decision.bestPath = ranked.front().data->path;
+
+  return decision;
+}
+
+using file_indexer::PathIndex;
+using EntryId = PathIndex::EntryId;
+
+void sortResidentCandidates(std::vector<ScoredRef<EntryId>> &ranked, const PathIndex::Reader &index) {
+  std::ranges::sort(ranked, [&](auto &&a, auto &&b) {
+    if (a.score != b.score) return std::cmp_greater(a.score, b.score);
+
+    PathView const pathA{.dirname = index.dirname(*a.data), .filename = index.basename(*a.data)};
+    PathView const pathB{.dirname = index.dirname(*b.data), .filename = index.basename(*b.data)};
+
+    if (pathA.size() != pathB.size()) return std::cmp_less(pathA.size(), pathB.size());
+
+    auto typeA = index.isDirectory(*a.data) ? 0 : 1;
+    auto typeB = index.isDirectory(*b.data) ? 0 : 1;
+
+    if (typeA != typeB) return std::cmp_greater(typeA, typeB);
+
+    return pathLess(pathA, pathB);
+  });
+}
+
+// Copies the top of the ranking out of the index so that it can be stat'ed once the reader, and
+// with it the lock the writer waits on, is released.
+std::vector<SC> materializeResidentCandidates(std::span<const ScoredRef<EntryId>> ranked,
+                                              const PathIndex::Reader &index, size_t count) {
+  return ranked.first(std::min(count, ranked.size())) |
+         std::views::transform([&](const ScoredRef<EntryId> &scored) {
+           return SC{.path = index.path(*scored.data),
+                     .category = index.category(*scored.data),
+                     .mimeType = index.mimeType(*scored.data),
+                     .isDirectory = index.isDirectory(*scored.data)};
+         }) |
+         std::ranges::to<std::vector>();
+}
+
 std::vector<IndexerFileResult> queryWithCorrections(FileIndexerDatabase &db, std::string_view q, int limit,
                                                     const FileIndexerDatabase::SearchOptions &options,
-                                                    bool trustKnownWords) {
+                                                    bool trustKnownWords, const CancellationToken &token,
+                                                    std::vector<fs::path> &stale) {
   auto words =
       splitQueryWords(q) |
       std::views::transform([](std::string_view word) { return QueryWord{.word = std::string{word}}; }) |
@@ -376,6 +505,8 @@ std::vector<IndexerFileResult> queryWithCorrections(FileIndexerDatabase &db, std
   if (plans.empty()) return {};
 
   for (const auto &plan : plans) {
+    if (token.isCancelled()) return {};
+
     auto correctionQuery = prepareCorrectionSearchQuery(plan);
 
     if (correctionQuery.empty()) continue;
@@ -386,8 +517,8 @@ std::vector<IndexerFileResult> queryWithCorrections(FileIndexerDatabase &db, std
                   << " candidates)\n";
 
     auto scorer = [&](const SC &candidate) { return scoreCandidate(candidate, plan); };
-    auto ranked = scoreCandidates(std::span<const SC>{candidates}, scorer);
-    auto results = resultsFromRankedCandidates(ranked, limit);
+    auto ranked = scoreCandidates(std::span<const SC>{candidates}, scorer, token);
+    auto results = resultsFromRankedCandidates(ranked, limit, stale);
 
     if (results.empty()) continue;
 
@@ -408,10 +539,122 @@ std::vector<IndexerFileResult> queryWithCorrections(FileIndexerDatabase &db, std
                                                                      : std::vector<IndexerFileResult>{};
 }
 
+using CandidateSet = FileIndexerQueryEngine::CandidateSet;
+
+std::shared_ptr<const CandidateSet> makeCandidateSet(std::string_view q,
+                                                     const FileIndexerDatabase::SearchOptions &options,
+                                                     const std::vector<SC> &candidates) {
+  return std::make_shared<const CandidateSet>(CandidateSet{
+      .text = std::string{q},
+      .options = options,
+      .candidates = candidates,
+      .foldedPaths = candidates |
+                     std::views::transform([](const SC &c) { return PathIndex::fold(c.path.native()); }) |
+                     std::ranges::to<std::vector>(),
+      .createdAt = std::chrono::steady_clock::now(),
+  });
+}
+
+// the candidates of `previous` that are strict candidates of `q`, or nullptr when they may not all be
+std::shared_ptr<const CandidateSet> narrowCandidates(const CandidateSet &previous, std::string_view q,
+                                                     const FileIndexerDatabase::SearchOptions &options) {
+  if (previous.options.category != options.category) return nullptr;
+  if (previous.candidates.size() >= static_cast<size_t>(CANDIDATE_LIMIT)) return nullptr;
+  if (std::chrono::steady_clock::now() - previous.createdAt > SESSION_CANDIDATES_TTL) return nullptr;
+  if (!narrowsQuery(previous.text, q)) return nullptr;
+
+  auto const words = splitQueryWords(q) |
+                     std::views::transform([](std::string_view word) { return PathIndex::fold(word); }) |
+                     std::ranges::to<std::vector>();
+  CandidateSet narrowed{.text = std::string{q}, .options = options, .createdAt = previous.createdAt};
+
+  for (size_t i = 0; i != previous.candidates.size(); ++i) {
+    std::string_view const folded = previous.foldedPaths[i];
+
+    if (std::ranges::all_of(words, [&](const std::string &word) { return folded.contains(word); })) {
+      narrowed.candidates.emplace_back(previous.candidates[i]);
+      narrowed.foldedPaths.emplace_back(folded);
+    }
+  }
+
+  return std::make_shared<const CandidateSet>(std::move(narrowed));
+}
+
 } // namespace
 
+std::optional<std::vector<IndexerFileResult>>
+FileIndexerQueryEngine::queryResident(std::string_view q, int limit, const QueryOptions &options,
+                                      const CancellationToken &token) {
+  if (!m_pathIndex || !m_pathIndex->isReady()) return std::nullopt;
+
+  std::vector<SC> top;
+  std::vector<ScoredRef<SC>> ranked;
+
+  {
+    auto const index = m_pathIndex->read();
+    auto const words = splitQueryWords(q);
+    auto candidates = index.search(words, CANDIDATE_LIMIT, options);
+
+    // nothing selective enough to look up, or nothing found: corrections and skeleton
+    // matching still need the SQL pipeline
+    if (!candidates || candidates->empty()) return std::nullopt;
+
+    flog::debug() << "resident index: " << candidates->size() << " candidates for" << std::quoted(q);
+
+    fzf::Query const fuzzyQuery{q};
+    auto scorer = [&](EntryId id) {
+      return scorePath({.dirname = index.dirname(id), .filename = index.basename(id)}, fuzzyQuery);
+    };
+    auto residentRanked = scoreAll(std::span<const EntryId>{*candidates}, scorer, token);
+
+    if (token.isCancelled()) return std::vector<IndexerFileResult>{};
+    if (residentRanked.empty()) return std::nullopt;
+
+    sortResidentCandidates(residentRanked, index);
+
+    // a low-confidence strict match is where skeleton candidates change the outcome
+    if (skeletonMergeDecision(residentRanked.front().score, residentRanked.size(), q, limit).shouldMerge) {
+      return std::nullopt;
+    }
+
+    top = materializeResidentCandidates(residentRanked, index,
+                                        static_cast<size_t>(std::max(limit, 0)) * RESIDENT_STAT_HEADROOM);
+    ranked.reserve(top.size());
+    for (size_t i = 0; i != top.size(); ++i) {
+      ranked.push_back({&top[i], residentRanked[i].score});
+    }
+  }
+
+  auto results = resultsFromRankedCandidates(ranked, limit, m_stalePaths);
+
+  if (results.empty()) return std::nullopt;
+
+  return results;
+}
+
 std::vector<IndexerFileResult> FileIndexerQueryEngine::query(std::string_view q, int limit,
-                                                             const QueryOptions &options) {
+                                                             const QueryOptions &options,
+                                                             const CancellationToken &token,
+                                                             SessionCandidates *session) {
+  auto results = search(q, limit, options, token, session);
+
+  if (!m_stalePaths.empty()) {
+    // the strict and merged rankings can both run into the same stale path
+    std::ranges::sort(m_stalePaths);
+    m_stalePaths.erase(std::ranges::unique(m_stalePaths).begin(), m_stalePaths.end());
+
+    flog::debug() << "dropping " << m_stalePaths.size() << " stale paths from the index\n";
+    if (m_writer) { m_writer->deleteIndexedFiles(std::move(m_stalePaths)); }
+    m_stalePaths.clear();
+  }
+
+  return results;
+}
+
+std::vector<IndexerFileResult> FileIndexerQueryEngine::search(std::string_view q, int limit,
+                                                              const QueryOptions &options,
+                                                              const CancellationToken &token,
+                                                              SessionCandidates *session) {
   FileIndexerDatabase &db = m_db;
   if (!db.isOpen()) return {};
 
@@ -419,18 +662,45 @@ std::vector<IndexerFileResult> FileIndexerQueryEngine::query(std::string_view q,
 
   if (dbQuery.empty()) return {};
 
-  flog::debug() << "searching" << std::quoted(dbQuery) << "\n";
+  if (auto results = queryResident(q, limit, options, token)) {
+    if (session && !token.isCancelled()) session->reset();
+    return std::move(*results);
+  }
+
+  // a cancelled token interrupts the statement in flight, which then reads as a short result set:
+  // bail out after every SQL step rather than acting on it
+  InterruptScope const interrupt{db.database(), token};
+  std::vector<SC> candidates;
+
+  if (auto narrowed = session && *session ? narrowCandidates(**session, q, options) : nullptr) {
+    flog::debug() << "narrowed " << (*session)->candidates.size() << " candidates of"
+                  << std::quoted((*session)->text) << "to" << narrowed->candidates.size();
+    candidates = narrowed->candidates;
+    *session = std::move(narrowed);
+  } else {
+    flog::debug() << "searching" << std::quoted(dbQuery) << "\n";
+
+    candidates = db.searchCandidates(dbQuery, CANDIDATE_LIMIT, options);
 
-  auto candidates = db.searchCandidates(dbQuery, CANDIDATE_LIMIT, options);
+    if (token.isCancelled()) return {};
+
+    // only worth keeping when complete and the next keystroke can narrow it down
+    if (session) {
+      bool const reusable = candidates.size() < static_cast<size_t>(CANDIDATE_LIMIT) && narrowsQuery(q, q);
+      *session = reusable ? makeCandidateSet(q, options, candidates) : nullptr;
+    }
+  }
 
   flog::debug() << "got " << candidates.size() << " candidates\n";
 
   auto tryCorrections = [&] {
-    if (auto results = queryWithCorrections(db, q, limit, options, true); !results.empty()) {
+    if (auto results = queryWithCorrections(db, q, limit, options, true, token, m_stalePaths);
+        !results.empty()) {
       return results;
     }
+    if (token.isCancelled()) return std::vector<IndexerFileResult>{};
 
-    return queryWithCorrections(db, q, limit, options, false);
+    return queryWithCorrections(db, q, limit, options, false, token, m_stalePaths);
   };
 
   bool triedCorrections = false;
@@ -446,11 +716,16 @@ std::vector<IndexerFileResult> FileIndexerQueryEngine::query(std::string_view q,
 
   if (!candidates.empty()) {
     auto scorer = [&](const SC &candidate) { return scoreCandidate(candidate, fuzzyQuery); };
-    auto ranked = scoreCandidates(std::span<const SC>{candidates}, scorer);
+    auto ranked = scoreCandidates(std::span<const SC>{candidates}, scorer, token);
+
+    if (token.isCancelled()) return {};
+
     skeletonDecision = skeletonMergeDecision(ranked, q, limit);
 
     if (!skeletonDecision.shouldMerge) {
-      if (auto results = resultsFromRankedCandidates(ranked, limit); !results.empty()) { return results; }
+      if (auto results = resultsFromRankedCandidates(ranked, limit, m_stalePaths); !results.empty()) {
+        return results;
+      }
       skeletonDecision.shouldMerge = true;
       skeletonDecision.reason = "strict-results-stale";
     }
@@ -463,6 +738,8 @@ std::vector<IndexerFileResult> FileIndexerQueryEngine::query(std::string_view q,
 
     auto skeletonCandidates = db.searchSkeletonCandidates(dbQuery, CANDIDATE_LIMIT, options);
 
+    if (token.isCancelled()) return {};
+
     flog::debug() << "skeleton merge: '" << q << "' reason=" << skeletonDecision.reason << " best='"
                   << skeletonDecision.bestPath.c_str() << "' score=" << skeletonDecision.bestScore
                   << " ideal=" << skeletonDecision.idealScore << " confidence=" << skeletonDecision.confidence
@@ -476,12 +753,13 @@ std::vector<IndexerFileResult> FileIndexerQueryEngine::query(std::string_view q,
   if (!candidates.empty()) {
     auto scorer = [&](const SC &candidate) { return scoreCandidate(candidate, fuzzyQuery); };
 
-    if (auto results = rankCandidates(std::move(candidates), scorer, limit); !results.empty()) {
+    if (auto results = rankCandidates(std::move(candidates), scorer, limit, token, m_stalePaths);
+        !results.empty()) {
       return results;
     }
   }
 
-  if (triedCorrections) return {};
+  if (triedCorrections || token.isCancelled()) return {};
 
   return tryCorrections();
 }
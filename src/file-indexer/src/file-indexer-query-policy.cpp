@@ -12,6 +12,7 @@ namespace {
 
 constexpr double RANK_LOG_WEIGHT = 10.0;
 constexpr int64_t TRUSTED_WORD_MIN_RANK = 3;
+constexpr size_t TRIGRAM_LENGTH = 3;
 
 } // namespace
 
@@ -30,6 +31,20 @@ std::vector<std::string_view> splitQueryWords(std::string_view query) {
          std::ranges::to<std::vector>();
 }
 
+bool narrowsQuery(std::string_view previous, std::string_view next) {
+  if (!next.starts_with(previous)) return false;
+
+  // the fuzzy_trigram tokenizer matches shorter words as whole tokens
+  auto const trigramMatched = [](std::string_view query) {
+    auto const words = splitQueryWords(query);
+    return !words.empty() && std::ranges::all_of(words, [](std::string_view word) {
+      return file_indexer::PathIndex::fold(word).size() >= TRIGRAM_LENGTH;
+    });
+  };
+
+  return trigramMatched(previous) && trigramMatched(next);
+}
+
 std::string prepareCandidateSearchQuery(std::string_view query) {
   auto words = splitQueryWords(query);
   auto enquote = [](auto &&w) { return std::format("\"{}\"", w); };
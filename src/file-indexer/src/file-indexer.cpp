@@ -120,7 +120,7 @@ void FileIndexer::start() {
     return;
   }
 
-  // make typo corrections available before the first scan of this session completes
+  // seeds the vocabulary of indexes created before it was maintained incrementally
   if (!m_db.hasSpellfixVocabulary()) { m_writer->rebuildSpellfixVocabulary(); }
 
   bool needsFullScan = false;
@@ -271,23 +271,31 @@ void FileIndexer::applyConfig(std::vector<fs::path> paths, std::vector<fs::path>
   if (plan.deleteSubtrees.empty() && plan.scanRoots.empty()) { startFileSystemWatcher(); }
 }
 
+void FileIndexer::setResidentIndexEnabled(bool enabled) {
+  if (enabled == m_residentIndexEnabled) return;
+
+  m_residentIndexEnabled = enabled;
+
+  if (enabled) {
+    flog::info() << "Loading resident path index";
+    m_writer->loadPathIndex(m_pathIndex);
+    return;
+  }
+
+  // clearing from here could run ahead of a load still queued on the writer, which would then
+  // mark the index ready with nothing left to keep it in sync
+  m_writer->detachPathIndex(m_pathIndex);
+}
+
 std::vector<IndexerFileResult> FileIndexer::query(std::string_view view, int limit,
                                                   const FileIndexerQueryEngine::QueryOptions &options) {
   if (!m_db.isOpen() || !m_queryEngine.isAvailable()) return {};
   return m_queryEngine.query(view, limit, options);
 }
 
-bool FileIndexer::shouldRebuildVocabulary() {
-  std::scoped_lock const l(m_vocabRebuildMtx);
-  auto const now = std::chrono::steady_clock::now();
-
-  if (now - m_lastVocabRebuild < VOCAB_REBUILD_MIN_INTERVAL) return false;
-
-  m_lastVocabRebuild = now;
-  return true;
-}
-
-FileIndexer::FileIndexer() : m_writer(std::make_shared<DbWriter>()), m_dispatcher(m_writer) {
+FileIndexer::FileIndexer()
+    : m_writer(std::make_shared<DbWriter>()), m_pathIndex(std::make_shared<file_indexer::PathIndex>()),
+      m_queryEngine(m_pathIndex, m_writer), m_dispatcher(m_writer) {
   if (m_db.isOpen()) {
     m_db.init();
     m_writer->pruneScanHistory(
@@ -300,9 +308,6 @@ FileIndexer::FileIndexer() : m_writer(std::make_shared<DbWriter>()), m_dispatche
       markFullScanSucceeded(event.entrypoint);
     }
 
-    if (event.status == ScanStatus::Succeeded && shouldRebuildVocabulary()) {
-      m_writer->rebuildSpellfixVocabulary();
-    }
     if (event.status == ScanStatus::Succeeded && event.type == ScanType::Full && !hasPendingFullScanRoots()) {
       startFileSystemWatcher();
     }
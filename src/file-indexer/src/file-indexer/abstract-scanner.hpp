@@ -8,10 +8,12 @@
 #include <functional>
 #include <memory>
 #include <utility>
+#include <vector>
 
 class AbstractScanner {
 public:
-  using StatusCallback = std::function<void(ScanStatus, size_t processedCount)>;
+  using StatusCallback = std::function<void(ScanStatus, size_t processedCount,
+                                            const std::vector<WalkerThroughput> &workerThroughput)>;
 
 protected:
   std::shared_ptr<DbWriter> m_writer;
@@ -33,14 +35,14 @@ protected:
     if (!result.has_value()) {
       flog::warn() << "Not scanning" << m_scan.path.native()
                    << "because scan record creation failed with error" << result.error();
-      m_statusCallback(ScanStatus::Failed, m_processedCount);
+      m_statusCallback(ScanStatus::Failed, m_processedCount, workerThroughput());
       return;
     }
 
     m_recordId = result->id;
     m_writer->updateScanStatus(m_recordId, ScanStatus::Started);
     m_lastProgressNotify = std::chrono::steady_clock::now();
-    m_statusCallback(ScanStatus::Started, m_processedCount);
+    m_statusCallback(ScanStatus::Started, m_processedCount, workerThroughput());
   }
 
   void reportProgress(size_t count = 1) {
@@ -50,7 +52,7 @@ protected:
     if (now - m_lastProgressNotify < PROGRESS_NOTIFY_INTERVAL) return;
 
     m_lastProgressNotify = now;
-    m_statusCallback(ScanStatus::Started, m_processedCount);
+    m_statusCallback(ScanStatus::Started, m_processedCount, workerThroughput());
   }
 
   void finish() {
@@ -58,20 +60,22 @@ protected:
     if (m_recordId >= 0) {
       m_writer->finalizeScan(m_recordId, status, static_cast<int64_t>(m_processedCount));
     }
-    m_statusCallback(status, m_processedCount);
+    m_statusCallback(status, m_processedCount, workerThroughput());
   }
 
   void fail() {
     if (m_recordId >= 0) {
       m_writer->finalizeScan(m_recordId, ScanStatus::Failed, static_cast<int64_t>(m_processedCount));
     }
-    m_statusCallback(ScanStatus::Failed, m_processedCount);
+    m_statusCallback(ScanStatus::Failed, m_processedCount, workerThroughput());
   }
 
   void setInterruptFlag() { m_interrupted = true; }
 
   bool isInterrupted() const { return m_interrupted; }
 
+  virtual std::vector<WalkerThroughput> workerThroughput() const { return {}; }
+
 public:
   AbstractScanner(std::shared_ptr<DbWriter> writer, Scan scan, StatusCallback callback)
       : m_writer(std::move(writer)), m_scan(std::move(scan)), m_statusCallback(std::move(callback)) {}
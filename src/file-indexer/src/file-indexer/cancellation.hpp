@@ -0,0 +1,33 @@
+#pragma once
+#include <atomic>
+#include <memory>
+#include <utility>
+
+namespace file_indexer {
+
+// Shared flag a superseded query is told to stop through. Copies observe the same flag; a
+// default-constructed token can never be cancelled.
+class CancellationToken {
+public:
+  CancellationToken() = default;
+
+  static CancellationToken create() { return CancellationToken{std::make_shared<std::atomic<bool>>(false)}; }
+
+  void cancel() const {
+    if (m_flag) m_flag->store(true, std::memory_order_relaxed);
+  }
+
+  bool isCancelled() const { return m_flag && m_flag->load(std::memory_order_relaxed); }
+
+  // the underlying flag, or null for a token that can't be cancelled
+  const std::atomic<bool> *flag() const { return m_flag.get(); }
+
+  bool operator==(const CancellationToken &) const = default;
+
+private:
+  explicit CancellationToken(std::shared_ptr<std::atomic<bool>> flag) : m_flag(std::move(flag)) {}
+
+  std::shared_ptr<std::atomic<bool>> m_flag;
+};
+
+} // namespace file_indexer
@@ -12,6 +12,7 @@
 #include <vector>
 #include "file-indexer/file-indexer-db.hpp"
 #include "file-indexer/io-pacer.hpp"
+#include "file-indexer/path-index.hpp"
 
 class DbWriter {
 public:
@@ -67,4 +68,10 @@ public:
   void rebuildSpellfixVocabulary();
 
   void indexEvents(std::vector<FileEvent> events);
+
+  // loads the resident index on the writer thread, so it observes every write queued before it
+  // and is kept in sync with every write queued after
+  void loadPathIndex(std::shared_ptr<file_indexer::PathIndex> index);
+  // stops syncing the index and empties it, in order with any load queued before
+  void detachPathIndex(std::shared_ptr<file_indexer::PathIndex> index);
 };
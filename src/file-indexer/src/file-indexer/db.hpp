@@ -1,6 +1,7 @@
 #pragma once
 #include <sqlcipher/sqlite3.h>
 
+#include <atomic>
 #include <cstdint>
 #include <expected>
 #include <filesystem>
@@ -16,6 +17,7 @@ extern "C" int vicinaeFuzzyTrigramInit(sqlite3 *, char **, const void *);
 extern "C" int vicinaeSpellfixInit(sqlite3 *, char **, const void *);
 
 static constexpr int BUSY_TIMEOUT_MS = 5000;
+static constexpr int INTERRUPT_CHECK_INSTRUCTIONS = 1000;
 
 class Statement {
   sqlite3_stmt *m_stmt = nullptr;
@@ -113,6 +115,18 @@ public:
     return false;
   }
 
+  // steps to completion, handing every row to fn. False if the statement failed.
+  template <typename Fn> bool forEachRow(Fn &&fn) {
+    if (!m_stmt) return false;
+    int rc = SQLITE_OK;
+    while ((rc = sqlite3_step(m_stmt)) == SQLITE_ROW) {
+      fn(*this);
+    }
+    sqlite3_reset(m_stmt);
+    sqlite3_clear_bindings(m_stmt);
+    return rc == SQLITE_DONE;
+  }
+
   void reset() {
     if (!m_stmt) return;
     sqlite3_reset(m_stmt);
@@ -272,6 +286,23 @@ public:
     return sqlite3_errmsg(m_handle);
   }
 
+  // Statements running on this connection fail with SQLITE_INTERRUPT once *flag is set, until the
+  // flag is reset to null.
+  void setInterruptFlag(const std::atomic<bool> *flag) {
+    if (!m_handle) return;
+    if (!flag) {
+      sqlite3_progress_handler(m_handle, 0, nullptr, nullptr);
+      return;
+    }
+
+    auto handler = [](void *data) -> int {
+      return static_cast<const std::atomic<bool> *>(data)->load(std::memory_order_relaxed) ? 1 : 0;
+    };
+
+    sqlite3_progress_handler(m_handle, INTERRUPT_CHECK_INSTRUCTIONS, handler,
+                             const_cast<std::atomic<bool> *>(flag));
+  }
+
   sqlite3 *handle() { return m_handle; }
   bool isOpen() const { return m_handle != nullptr; }
 
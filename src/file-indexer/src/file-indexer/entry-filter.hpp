@@ -1,6 +1,9 @@
 #pragma once
 #include <filesystem>
+#include <memory>
+#include <shared_mutex>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 class GitIgnoreReader {
@@ -24,6 +27,8 @@ public:
   void setIgnoreHiddenPaths(bool value);
 
   bool shouldVisit(const std::filesystem::directory_entry &entry) const;
+  // For callers that already know the entry type. Symlinks must be rejected beforehand.
+  bool shouldVisit(const std::filesystem::path &path, bool isDirectory) const;
 
   static bool isCacheDirTag(const std::filesystem::path &entryPath);
 
@@ -33,6 +38,14 @@ private:
   std::vector<std::string> m_ignoreFiles;
   bool m_ignoreHiddenPaths = false;
 
+  using IgnoreReaders = std::shared_ptr<const std::vector<GitIgnoreReader>>;
+
+  // ignore files found in a directory, shared by all the threads walking with this filter
+  static constexpr size_t IGNORE_CACHE_MAX_ENTRIES = 16 * 1024;
+  mutable std::shared_mutex m_ignoreCacheMutex;
+  mutable std::unordered_map<std::string, IgnoreReaders> m_ignoreCache;
+
+  IgnoreReaders ignoreReadersIn(const std::filesystem::path &dir) const;
   bool isIgnored(const std::filesystem::path &path) const;
   bool isExcludedPath(const std::filesystem::path &path) const;
 };
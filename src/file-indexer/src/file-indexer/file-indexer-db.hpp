@@ -4,12 +4,20 @@
 #include <cstdint>
 #include <expected>
 #include <filesystem>
+#include <functional>
+#include <list>
+#include <map>
+#include <memory>
 #include <optional>
 #include <string>
 #include <unordered_map>
 #include <unordered_set>
 #include <vector>
 
+namespace file_indexer {
+class PathIndex;
+}
+
 enum class IndexedFileCategory {
   Other,
   Directory,
@@ -24,13 +32,55 @@ enum class IndexedFileCategory {
 class FileIndexerDatabase {
   static constexpr int64_t COMPACT_MIN_DB_BYTES = 32 * 1024 * 1024;
   static constexpr int64_t COMPACT_MIN_FREE_PERCENT = 25;
+  static constexpr size_t DIRECTORY_CACHE_MAX_ENTRIES = 64 * 1024;
+
+  struct CachedDirectory {
+    std::filesystem::path path;
+    std::list<int64_t>::iterator use;
+  };
 
   db::Database m_db;
   std::unordered_map<std::string, int64_t> m_mimeTypeIds;
+  std::shared_ptr<file_indexer::PathIndex> m_pathIndex;
+  // ordered so that the entries of a deleted subtree can be dropped as one range. Only this
+  // connection's own writes keep it current: it is flushed whenever another connection commits.
+  mutable std::map<std::string, int64_t, std::less<>> m_directoryIds;
+  // ids are never reused, so this one never goes stale. Once full, the least recently used
+  // directories make room, so that the hot part of the tree stays resolved.
+  mutable std::unordered_map<int64_t, CachedDirectory> m_directoryPaths;
+  // most recently used first
+  mutable std::list<int64_t> m_directoryUses;
+  // PRAGMA data_version at the time m_directoryIds was last known to be current
+  mutable std::optional<int64_t> m_directoryIdsVersion;
+  mutable db::Statement m_dataVersionStmt;
 
   std::optional<int64_t> retrieveFileId(const std::filesystem::path &path) const;
   std::optional<int64_t> mimeTypeIdFor(std::string_view name);
 
+  // id of an existing directory row, 0 for the empty path
+  std::optional<int64_t> findDirectoryId(const std::filesystem::path &dir) const;
+  // same, creating the missing components
+  std::optional<int64_t> directoryIdFor(const std::filesystem::path &dir);
+  std::optional<int64_t> resolveDirectory(const std::filesystem::path &dir, const char *sql) const;
+  std::optional<std::filesystem::path> directoryPath(int64_t id) const;
+  const std::filesystem::path *cachedDirectoryPath(int64_t id) const;
+  // drops m_directoryIds if another connection committed since it was filled
+  void validateDirectoryIds() const;
+  // binds :dir_id and :name to the row of path, false if its directory has never been indexed
+  bool bindFilePath(db::Statement &stmt, const std::filesystem::path &path) const;
+  void cacheDirectory(const std::filesystem::path &dir, int64_t id) const;
+  void clearDirectoryCache();
+  void forgetDirectorySubtree(const std::filesystem::path &dir);
+  // ids handed out by a rolled back transaction may be reused
+  void rollback(db::Transaction &tx);
+
+  // per-word change of vocab_token counts accumulated by a write transaction
+  using VocabularyDelta = std::unordered_map<std::string, int64_t>;
+
+  int64_t lastFileId() const;
+  bool resetSpellfixVocabulary();
+  bool applyVocabularyDelta(const VocabularyDelta &delta);
+
 public:
   struct ScanRecord {
     int id;
@@ -46,6 +96,7 @@ public:
     std::filesystem::path path;
     IndexedFileCategory category = IndexedFileCategory::Other;
     std::optional<std::string> mimeType;
+    bool isDirectory = false;
   };
 
   struct SearchOptions {
@@ -79,6 +130,19 @@ public:
   listIndexedDirectoryFiles(const std::filesystem::path &path) const;
   bool tracksFile(const std::filesystem::path &path) const;
 
+  struct IndexedEntry {
+    std::optional<int64_t> lastModified;
+    std::optional<int64_t> sizeBytes;
+    bool isDirectory = false;
+  };
+
+  // direct children of `path` as indexed, keyed by basename, in one query
+  std::unordered_map<std::string, IndexedEntry>
+  listIndexedDirectoryEntries(const std::filesystem::path &path) const;
+  // every directory indexed anywhere below `root`, in one query
+  std::unordered_set<std::filesystem::path>
+  listIndexedSubdirectories(const std::filesystem::path &root) const;
+
   std::vector<std::filesystem::path> listRecentDirectories(int limit) const;
 
   struct SpellfixSuggestion {
@@ -91,6 +155,7 @@ public:
   void deleteAllIndexedFiles();
   bool needsCompaction() const;
   void compact();
+  // recounts the vocabulary from scratch; writes keep it up to date afterwards
   void rebuildSpellfixVocabulary();
   bool hasSpellfixVocabulary();
   std::vector<SpellfixSuggestion> spellfixSuggestions(std::string_view word, int top, bool prefix);
@@ -107,6 +172,10 @@ public:
 
   void indexEvents(const std::vector<FileEvent> &events);
 
+  // committed writes are mirrored into the index once it has been loaded
+  void attachPathIndex(std::shared_ptr<file_indexer::PathIndex> index);
+  void loadPathIndex();
+
   void init();
   bool isOpen() const;
 
@@ -114,4 +183,8 @@ public:
 
   FileIndexerDatabase();
   ~FileIndexerDatabase() = default;
+
+private:
+  // rows of dir_id, name, category, mime type and type, turned into candidates
+  std::vector<SearchCandidate> readSearchCandidates(db::Statement &stmt, int limit) const;
 };
@@ -1,12 +1,18 @@
 #pragma once
+#include "file-indexer/cancellation.hpp"
 #include "file-indexer/file-indexer-db.hpp"
+#include "file-indexer/path-index.hpp"
+#include <chrono>
 #include <filesystem>
+#include <memory>
 #include <optional>
 #include <span>
 #include <string>
 #include <string_view>
 #include <vector>
 
+class DbWriter;
+
 struct IndexerFileResult {
   std::filesystem::path path;
   double rank;
@@ -51,15 +57,55 @@ pickCorrections(std::span<const FileIndexerDatabase::SpellfixSuggestion> suggest
 
 std::vector<CorrectionPlan> buildCorrectionPlans(std::span<const QueryWord> words, size_t maxPlans);
 
+// Whether every strict candidate of `next` is a strict candidate of `previous`: `next` extends it and
+// every word of both is long enough to be matched as a substring of the folded path, rather than as a
+// short token of its own.
+bool narrowsQuery(std::string_view previous, std::string_view next);
+
 } // namespace file_indexer::query
 
 class FileIndexerQueryEngine {
 public:
   using QueryOptions = FileIndexerDatabase::SearchOptions;
 
-  std::vector<IndexerFileResult> query(std::string_view q, int limit, const QueryOptions &options = {});
+  // The strict candidates of a client's last query, along with their folded paths. A query narrowing
+  // it down is answered by filtering them instead of running the FTS lookup again.
+  struct CandidateSet {
+    std::string text;
+    QueryOptions options;
+    std::vector<FileIndexerDatabase::SearchCandidate> candidates;
+    std::vector<std::string> foldedPaths;
+    std::chrono::steady_clock::time_point createdAt;
+  };
+
+  // Carried from one query of a client session to the next: read, then replaced with the candidates
+  // of the query, or reset when they are not worth keeping.
+  using SessionCandidates = std::shared_ptr<const CandidateSet>;
+
+  // results found to no longer exist on disk are deleted from the index through the writer, if any
+  explicit FileIndexerQueryEngine(std::shared_ptr<const file_indexer::PathIndex> pathIndex = nullptr,
+                                  std::shared_ptr<DbWriter> writer = nullptr)
+      : m_pathIndex(std::move(pathIndex)), m_writer(std::move(writer)) {}
+
+  // A cancelled token stops the SQL step and the scoring in flight; the results are then empty, and
+  // the session should be dropped rather than carried to the next query.
+  std::vector<IndexerFileResult> query(std::string_view q, int limit, const QueryOptions &options = {},
+                                       const file_indexer::CancellationToken &token = {},
+                                       SessionCandidates *session = nullptr);
   bool isAvailable() const { return m_db.isOpen(); }
 
 private:
   FileIndexerDatabase m_db;
+  std::shared_ptr<const file_indexer::PathIndex> m_pathIndex;
+  std::shared_ptr<DbWriter> m_writer;
+  std::vector<std::filesystem::path> m_stalePaths; // gathered while a query runs
+
+  std::vector<IndexerFileResult> search(std::string_view q, int limit, const QueryOptions &options,
+                                        const file_indexer::CancellationToken &token,
+                                        SessionCandidates *session);
+
+  // answers from the resident index alone, or nullopt when the SQL pipeline has to run
+  std::optional<std::vector<IndexerFileResult>> queryResident(std::string_view q, int limit,
+                                                              const QueryOptions &options,
+                                                              const file_indexer::CancellationToken &token);
 };
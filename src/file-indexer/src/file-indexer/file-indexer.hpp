@@ -2,6 +2,7 @@
 #include "file-indexer/file-indexer-query-engine.hpp"
 #include "file-indexer/file-system-watcher.hpp"
 #include "file-indexer/file-indexer-db.hpp"
+#include "file-indexer/path-index.hpp"
 #include "file-indexer/scan-dispatcher.hpp"
 #include <chrono>
 #include <filesystem>
@@ -18,6 +19,8 @@ public:
   std::vector<std::filesystem::path> m_entrypoints;
   std::vector<std::filesystem::path> m_excludedPaths;
   std::vector<std::string> m_excludedFilenames;
+  std::shared_ptr<file_indexer::PathIndex> m_pathIndex;
+  bool m_residentIndexEnabled = false;
   FileIndexerQueryEngine m_queryEngine;
   FileIndexerDatabase m_db;
 
@@ -42,11 +45,6 @@ public:
                           const std::vector<std::filesystem::path> &exclusions);
 
   static constexpr std::chrono::days SCAN_HISTORY_MAX_AGE{7};
-  static constexpr std::chrono::minutes VOCAB_REBUILD_MIN_INTERVAL{10};
-  std::mutex m_vocabRebuildMtx;
-  std::chrono::steady_clock::time_point m_lastVocabRebuild{};
-
-  bool shouldRebuildVocabulary();
 
 public:
   void startFullScan();
@@ -58,6 +56,10 @@ public:
   }
   void rebuildIndex();
   void setConfig(std::vector<std::filesystem::path> paths, std::vector<std::filesystem::path> excludedPaths);
+  // keeps a resident copy of the index in memory to answer queries without SQLite
+  void setResidentIndexEnabled(bool enabled);
+  std::shared_ptr<const file_indexer::PathIndex> pathIndex() const { return m_pathIndex; }
+  std::shared_ptr<DbWriter> writer() const { return m_writer; }
   void applyConfig(std::vector<std::filesystem::path> paths,
                    std::vector<std::filesystem::path> excludedPaths);
   std::vector<IndexerFileResult> query(std::string_view view, int limit,
@@ -0,0 +1,63 @@
+#pragma once
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <span>
+#include <string>
+#include <string_view>
+#include <sys/uio.h>
+#include <vector>
+
+namespace file_indexer {
+
+// Frames are a native-endian uint32 payload size followed by the payload.
+constexpr size_t FRAME_HEADER_SIZE = sizeof(uint32_t);
+
+// Decodes the frames read from a file descriptor. Reads land directly in a single buffer, complete
+// frames are handed out as views into it, and only the trailing partial frame is moved back to the
+// front, once per read.
+class FrameReader {
+public:
+  // The payload is only valid for the duration of the call.
+  using FrameCallback = std::function<void(std::string_view payload)>;
+
+  explicit FrameReader(int fd);
+
+  // Reads once and calls back for every frame completed by the read. Returns false once the input is
+  // closed or cannot be read anymore.
+  bool readFrames(const FrameCallback &callback);
+
+private:
+  static constexpr size_t MIN_READ_SIZE = 64 * 1024;
+
+  int m_fd;
+  std::vector<char> m_buffer;
+  // undecoded bytes live in [m_begin, m_end)
+  size_t m_begin = 0;
+  size_t m_end = 0;
+
+  void reserveForRead();
+};
+
+// Writes frames to a file descriptor from any thread. A thread with nothing ahead of it writes its
+// frame straight from the payload with writev. Frames sent while another thread is writing are
+// appended to a single buffer, which the writing thread flushes in one write before returning, so a
+// burst of replies costs one syscall rather than one flush each.
+class FrameWriter {
+public:
+  explicit FrameWriter(int fd);
+
+  void send(std::string_view payload);
+
+private:
+  int m_fd;
+  std::mutex m_mutex;
+  std::string m_pending;
+  // only touched by the writing thread, swapped with m_pending to keep both allocations around
+  std::string m_writing;
+  bool m_isWriting = false;
+
+  void write(std::span<iovec> buffers);
+};
+
+} // namespace file_indexer
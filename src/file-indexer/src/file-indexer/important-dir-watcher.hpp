@@ -19,9 +19,14 @@ public:
 
   virtual std::vector<std::filesystem::path> rootDirectories() const = 0;
 
+  // whether every change below dir is reported, rather than the watched subset only
+  virtual bool followsRecursively(const std::filesystem::path &dir) const { return false; }
+
   virtual std::vector<std::filesystem::path> watchedDirectories() const = 0;
 
   virtual void setDynamicDirectories(const std::vector<std::filesystem::path> &dirs) = 0;
 
+  // a filesystem-wide fanotify watcher where permitted, inotify watches on the important directories
+  // otherwise
   static std::unique_ptr<ImportantDirectoryWatcher> create(Callback cb);
 };
@@ -3,6 +3,7 @@
 #include "file-indexer/abstract-scanner.hpp"
 #include "file-indexer/entry-filter.hpp"
 #include "file-indexer/io-pacer.hpp"
+#include "file-indexer/path-stat.hpp"
 #include <cstdint>
 #include <functional>
 #include <memory>
@@ -11,21 +12,21 @@
 #include <vector>
 
 class IncrementalScanner : public AbstractScanner, file_indexer::NonCopyable {
-  using EntryCallback = std::function<void(const std::filesystem::directory_entry &entry, bool isNew)>;
+  using EntryCallback =
+      std::function<void(const std::filesystem::path &path, const file_indexer::PathStat &stat, bool isNew)>;
 
   FileIndexerDatabase &m_readDb;
   EntryFilter m_filter;
   file_indexer::IoPacer m_pacer;
-  std::unordered_set<std::filesystem::path> m_currentEntries;
 
   std::vector<std::filesystem::path>
   getScannableDirectories(const std::filesystem::path &path, std::optional<size_t> maxDepth,
                           const std::vector<std::filesystem::path> &excludedPaths);
 
-  // diffs the direct contents of `path` against the index; `isNew` flags entries
-  // that were previously unindexed
+  // diffs the direct contents of `path` against the index, stat'ing them as one batch, and only
+  // writes the entries that changed; `isNew` flags entries that were previously unindexed
   void processDirectory(const std::filesystem::path &path, const EntryCallback &onEntry = {});
-  bool shouldProcessEntry(const std::filesystem::directory_entry &entry, int64_t cutOffSeconds) const;
+  static bool modifiedSince(const std::filesystem::directory_entry &entry, int64_t cutOffSeconds);
 
   void scan(const std::filesystem::path &path, const IncrementalScan &scan);
   void exhaustiveScan(const std::filesystem::path &path, const IncrementalScan &scan);
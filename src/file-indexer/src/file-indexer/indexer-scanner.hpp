@@ -1,7 +1,7 @@
 #pragma once
 #include "file-indexer/util.hpp"
 #include "file-indexer/abstract-scanner.hpp"
-#include "file-indexer/filesystem-walker.hpp"
+#include "file-indexer/parallel-walker.hpp"
 #include <memory>
 
 class IndexerScanner : public AbstractScanner, public file_indexer::NonCopyable {
@@ -12,10 +12,13 @@ public:
   void run() override;
   void interrupt() override;
 
+protected:
+  std::vector<WalkerThroughput> workerThroughput() const override;
+
 private:
   static constexpr size_t INDEX_BATCH_SIZE = 5'000;
 
   void scan(const Scan &scan);
 
-  FileSystemWalker m_walker;
+  ParallelWalker m_walker;
 };
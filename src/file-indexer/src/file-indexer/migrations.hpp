@@ -3,7 +3,7 @@
 
 namespace file_indexer {
 
-inline constexpr int SCHEMA_VERSION = 1;
+inline constexpr int SCHEMA_VERSION = 2;
 
 inline constexpr std::string_view INIT_SQL = R"sql(
 CREATE TABLE IF NOT EXISTS scan_history (
@@ -21,17 +21,27 @@ CREATE TABLE IF NOT EXISTS scan_history (
 CREATE INDEX IF NOT EXISTS scan_history_entrypoint_idx
 	ON scan_history(entrypoint, status, created_at);
 
+-- one row per path component of every directory holding indexed entries, so a prefix shared
+-- by a whole tree is stored once. Full paths are rebuilt by walking parent_id (0 at the top);
+-- AUTOINCREMENT keeps ids from being reused, so cached id -> path mappings never go stale.
+CREATE TABLE IF NOT EXISTS directory (
+	id INTEGER PRIMARY KEY AUTOINCREMENT,
+	parent_id INT NOT NULL,
+	name TEXT NOT NULL,
+	UNIQUE (parent_id, name)
+);
+
 CREATE TABLE IF NOT EXISTS indexed_file (
 	id INTEGER PRIMARY KEY AUTOINCREMENT,
-	path TEXT UNIQUE NOT NULL,
-	skeleton_path TEXT NOT NULL,
-	parent_id INT,
+	dir_id INT NOT NULL, -- directory.id of the parent path
+	name TEXT NOT NULL, -- basename
 	last_modified_at INT,
 	indexed_at INT NOT NULL DEFAULT (unixepoch()),
 	type INT NOT NULL DEFAULT 0, -- 0 file, 1 directory
 	category INT NOT NULL DEFAULT 0,
 	size_bytes INT,
-	mime_type_id INT
+	mime_type_id INT,
+	UNIQUE (dir_id, name)
 );
 
 CREATE TABLE IF NOT EXISTS mime_type (
@@ -39,8 +49,6 @@ CREATE TABLE IF NOT EXISTS mime_type (
 	name TEXT UNIQUE NOT NULL
 );
 
-CREATE INDEX IF NOT EXISTS indexed_file_parent_id_idx ON indexed_file(parent_id);
-
 -- serves the recently-active-directories query backing the dynamic watch set
 CREATE INDEX IF NOT EXISTS indexed_file_dir_mtime_idx
 	ON indexed_file(last_modified_at DESC) WHERE type = 1;
@@ -48,36 +56,39 @@ CREATE INDEX IF NOT EXISTS indexed_file_dir_mtime_idx
 CREATE INDEX IF NOT EXISTS indexed_file_category_idx ON indexed_file(category);
 CREATE INDEX IF NOT EXISTS indexed_file_mime_type_idx ON indexed_file(mime_type_id);
 
+-- Both search indexes are contentless: only the terms are stored, never the path itself.
+-- Documents are written by C++ when a row is inserted, as full paths only exist there, and
+-- never change afterwards since (dir_id, name) is the row's identity.
 CREATE VIRTUAL TABLE IF NOT EXISTS path_idx USING fts5(
-	path, content=indexed_file, tokenize='fuzzy_trigram remove_diacritics 2'
+	path, content='', contentless_delete=1, tokenize='fuzzy_trigram remove_diacritics 2'
 );
 
-CREATE TRIGGER IF NOT EXISTS path_idx_ai AFTER INSERT ON indexed_file BEGIN
-  INSERT INTO path_idx(rowid, path) VALUES (new.id, new.path);END;
-
 CREATE TRIGGER IF NOT EXISTS path_idx_ad AFTER DELETE ON indexed_file BEGIN
-  INSERT INTO path_idx(path_idx, rowid, path) VALUES('delete', old.id, old.path);END;
+  DELETE FROM path_idx WHERE rowid = old.id;END;
 
 -- trigram index over compact per-component abbreviation skeletons. Documents are
 -- generated by C++ as skeletonized path tokens ("vicinae/settings.json" ->
 -- "vcn stngs jsn") while the tokenizer skeletonizes queries and adds skip-grams.
 CREATE VIRTUAL TABLE IF NOT EXISTS skeleton_idx USING fts5(
-	skeleton_path, content=indexed_file, tokenize='fuzzy_trigram remove_diacritics 2 skeleton 1 skipgrams 1'
+	skeleton, content='', contentless_delete=1,
+	tokenize='fuzzy_trigram remove_diacritics 2 skeleton 1 skipgrams 1'
 );
 
-CREATE TRIGGER IF NOT EXISTS skeleton_idx_ai AFTER INSERT ON indexed_file BEGIN
-  INSERT INTO skeleton_idx(rowid, skeleton_path) VALUES (new.id, new.skeleton_path);END;
-
-CREATE TRIGGER IF NOT EXISTS skeleton_idx_au AFTER UPDATE ON indexed_file BEGIN
-  INSERT INTO skeleton_idx(skeleton_idx, rowid, skeleton_path) VALUES('delete', old.id, old.skeleton_path);
-  INSERT INTO skeleton_idx(rowid, skeleton_path) VALUES (new.id, new.skeleton_path);END;
-
 CREATE TRIGGER IF NOT EXISTS skeleton_idx_ad AFTER DELETE ON indexed_file BEGIN
-  INSERT INTO skeleton_idx(skeleton_idx, rowid, skeleton_path) VALUES('delete', old.id, old.skeleton_path);END;
+  DELETE FROM skeleton_idx WHERE rowid = old.id;END;
 
--- spellfix1 typo-correction vocabulary, fully rebuilt from indexed_file basenames
--- after successful scans. Derived data: no schema version bump needed.
+-- spellfix1 typo-correction vocabulary over indexed_file basename tokens. Derived
+-- data: no schema version bump needed, a missing vocabulary is rebuilt on startup.
 CREATE VIRTUAL TABLE IF NOT EXISTS spellfix_vocab USING spellfix1;
+
+-- how many indexed basenames each spellfix_vocab word occurs in, updated by every
+-- write to indexed_file so only words whose count changed touch spellfix_vocab.
+-- spellfix_id is the rowid of the word in spellfix_vocab.
+CREATE TABLE IF NOT EXISTS vocab_token (
+	word TEXT PRIMARY KEY,
+	count INT NOT NULL,
+	spellfix_id INT NOT NULL
+) WITHOUT ROWID;
 )sql";
 
 }; // namespace file_indexer
@@ -0,0 +1,96 @@
+#pragma once
+#include "file-indexer/entry-filter.hpp"
+#include "file-indexer/io-pacer.hpp"
+#include "file-indexer/scan.hpp"
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <filesystem>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <span>
+#include <string>
+#include <vector>
+
+struct WalkEntry {
+  std::filesystem::path path;
+  bool isDirectory = false;
+  std::filesystem::file_time_type lastModified;
+  std::optional<int64_t> sizeBytes;
+};
+
+// Work-stealing walker for full scans. Each worker opens directories relative to their parent's
+// fd, reads them with getdents64 and stats entries relative to the directory fd, pushes
+// subdirectories on its own queue and steals from the other queues once its own runs dry, sleeping
+// until more work is pushed when there is none to steal. All workers share the entry filter; each
+// is paced by its own IoPacer.
+class ParallelWalker {
+public:
+  // Called concurrently from the worker threads, with at most CALLBACK_BATCH_SIZE entries of a
+  // single directory at a time. The callee may move out of the entries.
+  using BatchCallback = std::function<void(std::span<WalkEntry> entries)>;
+
+  static constexpr size_t CALLBACK_BATCH_SIZE = 1024;
+
+  ParallelWalker();
+
+  void setIgnoreFiles(const std::vector<std::string> &files);
+  void setIgnoreHiddenPaths(bool value);
+  void setExcludedPaths(const std::vector<std::filesystem::path> &paths);
+  void setThreadCount(size_t count);
+
+  void walk(const std::filesystem::path &root, const BatchCallback &callback);
+  void stop();
+
+  // Safe to call from the walk callback and once the walk is over.
+  std::vector<WalkerThroughput> throughput() const;
+
+private:
+  static constexpr size_t GETDENTS_BUFFER_SIZE = 256 * 1024;
+
+  struct DirectoryName {
+    std::string name;
+    unsigned char type;
+  };
+
+  class DirectoryFd;
+
+  // a queued directory keeps its parent open, so that it can be opened with openat
+  struct PendingDirectory {
+    std::filesystem::path path;
+    std::shared_ptr<const DirectoryFd> parent;
+  };
+
+  struct Worker {
+    std::mutex mutex;
+    std::deque<PendingDirectory> queue;
+    std::atomic<size_t> entryCount = 0;
+    std::atomic<int64_t> busyNanos = 0;
+  };
+
+  EntryFilter m_filter;
+  size_t m_threadCount;
+  std::vector<std::unique_ptr<Worker>> m_workers;
+  // directories queued or being read, across all workers
+  std::atomic<size_t> m_pending = 0;
+  // directories queued and not taken yet
+  std::atomic<size_t> m_queued = 0;
+  std::atomic<size_t> m_sleeping = 0;
+  std::mutex m_idleMutex;
+  std::condition_variable m_idleCv;
+  std::atomic<bool> m_alive = true;
+
+  void runWorker(size_t index, const BatchCallback &callback);
+  std::optional<PendingDirectory> takeDirectory(size_t index);
+  void push(Worker &worker, PendingDirectory dir);
+  // sleeps until a directory is queued, the walk is over or stopped
+  void waitForWork();
+  void wakeAll();
+  void readDirectory(Worker &worker, file_indexer::IoPacer &pacer, const PendingDirectory &dir,
+                     std::span<std::byte> buffer, std::vector<DirectoryName> &names,
+                     const BatchCallback &callback);
+};
@@ -0,0 +1,181 @@
+#pragma once
+#include "file-indexer/file-indexer-db.hpp"
+#include <atomic>
+#include <cstdint>
+#include <filesystem>
+#include <functional>
+#include <map>
+#include <optional>
+#include <shared_mutex>
+#include <span>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace file_indexer {
+
+// Optional in-memory mirror of indexed_file for the query hot path. Paths are split at their last
+// separator: directories are interned once, basenames live in a flat arena and both are covered by
+// byte-trigram posting lists over their folded form (lowercase, diacritics removed, separators and
+// punctuation dropped, like the fuzzy_trigram tokenizer). The trigrams straddling the last separator
+// get postings of their own, so that a word such as "src/main" (folded to "srcmain") matches across
+// it as it does in path_idx. A query yields entry ids; paths are only joined for the results that are
+// actually returned.
+//
+// Only mutated from the DbWriter thread, after the matching transaction committed. Readers hold a
+// shared lock for the duration of a query.
+class PathIndex {
+public:
+  using EntryId = uint32_t;
+  using DirId = uint32_t;
+
+  // ordered write operations, recorded while a transaction runs and applied once it committed
+  class Batch {
+  public:
+    void upsert(const std::filesystem::path &path, bool isDirectory, IndexedFileCategory category,
+                std::string_view mimeType);
+    void erase(const std::filesystem::path &path);
+
+    bool empty() const { return m_ops.empty(); }
+    void clear() { m_ops.clear(); }
+
+  private:
+    friend class PathIndex;
+
+    struct Op {
+      std::string path;
+      std::string mimeType;
+      IndexedFileCategory category = IndexedFileCategory::Other;
+      bool isDirectory = false;
+      bool erase = false;
+    };
+
+    std::vector<Op> m_ops;
+  };
+
+  class Reader {
+  public:
+    // Candidate ids matching every query word, in the spirit of the path_idx MATCH query:
+    // words of 3+ folded characters are looked up through the trigram postings, shorter ones
+    // are verified on the survivors. Returns nullopt when no word is selective enough to
+    // drive the lookup, in which case the caller should ask SQLite instead.
+    std::optional<std::vector<EntryId>> search(std::span<const std::string_view> words, size_t limit,
+                                               const FileIndexerDatabase::SearchOptions &options) const;
+
+    std::string_view basename(EntryId id) const;
+    std::string_view dirname(EntryId id) const;
+    bool isDirectory(EntryId id) const;
+    IndexedFileCategory category(EntryId id) const;
+    std::optional<std::string> mimeType(EntryId id) const;
+    std::filesystem::path path(EntryId id) const;
+
+    size_t size() const;
+
+  private:
+    friend class PathIndex;
+
+    explicit Reader(const PathIndex &index) : m_index(index), m_lock(index.m_mtx) {}
+
+    const PathIndex &m_index;
+    std::shared_lock<std::shared_mutex> m_lock;
+  };
+
+  // Bulk (re)population. Holds the write lock until destroyed, after which the index is ready.
+  class Loader {
+  public:
+    void add(std::string_view path, bool isDirectory, IndexedFileCategory category,
+             std::string_view mimeType);
+
+    ~Loader();
+
+    Loader(const Loader &) = delete;
+    Loader &operator=(const Loader &) = delete;
+
+  private:
+    friend class PathIndex;
+
+    explicit Loader(PathIndex &index);
+
+    PathIndex &m_index;
+    std::unique_lock<std::shared_mutex> m_lock;
+  };
+
+  Reader read() const { return Reader{*this}; }
+  Loader load() { return Loader{*this}; }
+
+  // no-op until a load completed: writes issued before the load are picked up by the load itself
+  void apply(const Batch &batch);
+
+  // drops everything and marks the index as not ready
+  void clear();
+
+  bool isReady() const { return m_ready.load(std::memory_order_acquire); }
+
+  static std::string fold(std::string_view text);
+
+private:
+  static constexpr uint16_t NO_MIME_TYPE = 0;
+  // tombstones are reclaimed once they outnumber live entries
+  static constexpr size_t COMPACT_MIN_DEAD_ENTRIES = 4096;
+
+  enum EntryFlag : uint8_t { Alive = 1 << 0, Directory = 1 << 1 };
+
+  using Postings = std::unordered_map<uint32_t, std::vector<uint32_t>>;
+
+  mutable std::shared_mutex m_mtx;
+  std::atomic<bool> m_ready = false;
+
+  // directories, indexed by DirId
+  std::map<std::string, DirId, std::less<>> m_dirIds;
+  std::vector<const std::string *> m_dirPaths;
+  std::vector<uint32_t> m_dirFoldOffsets; // into m_dirFolds, one past the end for the last dir
+  std::string m_dirFolds;
+  std::vector<std::vector<EntryId>> m_dirChildren;
+
+  // entries, indexed by EntryId
+  std::vector<DirId> m_entryDir;
+  std::vector<uint32_t> m_nameOffsets;
+  std::vector<uint16_t> m_nameLengths;
+  std::vector<uint32_t> m_foldOffsets;
+  std::vector<uint16_t> m_foldLengths;
+  std::vector<uint8_t> m_flags;
+  std::vector<uint8_t> m_categories;
+  std::vector<uint16_t> m_mimeTypeIds;
+  std::string m_names;
+  std::string m_foldedNames;
+
+  std::vector<std::string> m_mimeTypes{""};
+  std::unordered_map<std::string, uint16_t> m_mimeTypeIdsByName;
+
+  std::unordered_multimap<uint64_t, EntryId> m_entryLookup; // (dir, basename) hash -> entry
+  Postings m_namePostings;                                  // trigram -> entries
+  Postings m_dirPostings;                                   // trigram -> directories
+  Postings m_boundaryPostings;                              // trigram across last separator -> entries
+  size_t m_deadCount = 0;
+
+  static uint64_t entryKey(DirId dir, std::string_view name);
+  static void addPostings(Postings &postings, std::string_view folded, uint32_t id);
+  static std::vector<uint32_t> lookup(const Postings &postings, std::string_view folded);
+
+  DirId internDirectory(std::string_view path);
+  uint16_t internMimeType(std::string_view name);
+  std::optional<EntryId> findEntry(DirId dir, std::string_view name) const;
+
+  std::string_view foldedName(EntryId id) const;
+  std::string_view foldedDir(DirId id) const;
+  bool alive(EntryId id) const { return m_flags[id] & Alive; }
+  bool matchesWord(EntryId id, std::string_view folded) const;
+  // the end of the folded dirname followed by the start of the folded basename
+  bool matchesAcross(EntryId id, std::string_view folded, size_t split) const;
+  bool matchesAcross(EntryId id, std::string_view folded) const;
+
+  void upsertLocked(std::string_view path, bool isDirectory, IndexedFileCategory category,
+                    std::string_view mimeType);
+  void eraseLocked(std::string_view path);
+  void killEntry(EntryId id);
+  void clearLocked();
+  void compactLocked();
+};
+
+} // namespace file_indexer
@@ -0,0 +1,34 @@
+#pragma once
+#include <cstdint>
+#include <filesystem>
+#include <optional>
+#include <span>
+#include <vector>
+
+namespace file_indexer {
+
+enum class PathState : uint8_t {
+  Exists,
+  // ENOENT or ENOTDIR: the path is gone for good
+  Missing,
+  // any other error (EACCES, EIO, a stale or unreachable mount...): nothing can be concluded
+  Unknown,
+};
+
+// State of each path, following symlinks. The lookups run concurrently on a small pool of their own, so a hung mount
+// cannot starve scoring, and ask statx for no attributes without forcing a sync, so network and
+// FUSE mounts can answer from their attribute cache.
+std::vector<PathState> pathStates(std::span<const std::filesystem::path> paths);
+
+struct PathStat {
+  std::filesystem::file_time_type lastModified;
+  bool isDirectory = false;
+  // regular files only
+  std::optional<int64_t> sizeBytes;
+};
+
+// Attributes of each path, following symlinks, or nullopt when it cannot be stat'ed. Runs on the
+// same pool as pathStates, one statx per path instead of a stat for each attribute.
+std::vector<std::optional<PathStat>> statPaths(std::span<const std::filesystem::path> paths);
+
+} // namespace file_indexer
@@ -1,11 +1,14 @@
 #pragma once
+#include "file-indexer/cancellation.hpp"
 #include "file-indexer/file-indexer-query-engine.hpp"
 #include <condition_variable>
 #include <deque>
 #include <functional>
+#include <memory>
 #include <mutex>
 #include <string>
 #include <thread>
+#include <unordered_map>
 #include <vector>
 
 class QueryPool {
@@ -14,10 +17,14 @@ public:
     std::string text;
     int limit;
     FileIndexerQueryEngine::QueryOptions options;
+    // jobs of the same non-empty session supersede each other: submitting one cancels the previous
+    std::string session;
     std::function<void(std::vector<IndexerFileResult>)> onResult;
+    file_indexer::CancellationToken token;
   };
 
-  explicit QueryPool(size_t workerCount);
+  explicit QueryPool(size_t workerCount, std::shared_ptr<const file_indexer::PathIndex> pathIndex = nullptr,
+                     std::shared_ptr<DbWriter> writer = nullptr);
   ~QueryPool();
 
   QueryPool(const QueryPool &) = delete;
@@ -30,8 +37,13 @@ private:
 
   static constexpr size_t MAX_PENDING = 8;
 
+  std::shared_ptr<const file_indexer::PathIndex> m_pathIndex;
+  std::shared_ptr<DbWriter> m_writer;
   std::vector<std::thread> m_workers;
   std::deque<Job> m_queue;
+  std::unordered_map<std::string, file_indexer::CancellationToken> m_sessions; // latest job per session
+  // candidates of the last completed query per session, whichever worker ran it
+  std::unordered_map<std::string, FileIndexerQueryEngine::SessionCandidates> m_sessionCandidates;
   std::mutex m_mtx;
   std::condition_variable m_cv;
   bool m_stop = false;
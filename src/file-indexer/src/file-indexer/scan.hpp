@@ -1,4 +1,5 @@
 #pragma once
+#include <chrono>
 #include <cstdint>
 #include <filesystem>
 #include <optional>
@@ -47,12 +48,25 @@ struct Scan {
   bool operator<(const Scan &other) const { return path < other.path; }
 };
 
+// Entries one walker thread of a full scan went through, and the time it spent reading them.
+struct WalkerThroughput {
+  size_t entryCount = 0;
+  std::chrono::milliseconds busyTime{0};
+
+  double entriesPerSecond() const {
+    if (busyTime.count() == 0) return 0;
+    return static_cast<double>(entryCount) / std::chrono::duration<double>(busyTime).count();
+  }
+};
+
 struct ScanEvent {
   int scanId;
   ScanType type;
   ScanStatus status;
   std::filesystem::path entrypoint;
   size_t processedFileCount;
+  // one per walker thread, full scans only
+  std::vector<WalkerThroughput> workerThroughput;
 };
 
 enum class FileEventType { Modify, Delete };
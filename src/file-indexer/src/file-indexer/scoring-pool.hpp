@@ -0,0 +1,59 @@
+#pragma once
+#include "file-indexer/cancellation.hpp"
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace file_indexer {
+
+// Persistent workers scoring candidate chunks for every query engine of the process. Each run()
+// queues a job; idle workers take one chunk at a time from the job at the front and rotate it to
+// the back, so concurrent queries share the cores instead of spawning threads of their own. The
+// submitting thread works through its own job as well and never waits on a queue to drain.
+class ScoringPool {
+public:
+  using ChunkFn = std::function<void(size_t chunk)>;
+
+  explicit ScoringPool(size_t workerCount);
+  ~ScoringPool();
+
+  ScoringPool(const ScoringPool &) = delete;
+  ScoringPool &operator=(const ScoringPool &) = delete;
+
+  // Calls fn for every chunk in [0, chunkCount) and returns once they are all done. Chunks not
+  // started by the time the token is cancelled are skipped, in which case false is returned.
+  bool run(size_t chunkCount, const ChunkFn &fn, const CancellationToken &token = {});
+
+  size_t workerCount() const { return m_workers.size(); }
+
+  // one worker per core, minus the one the submitting thread runs on
+  static ScoringPool &shared();
+
+private:
+  struct Job {
+    const ChunkFn &fn;
+    const CancellationToken &token;
+    size_t chunkCount;
+    size_t next = 0;
+    size_t finished = 0;
+    bool skipped = false;
+  };
+
+  std::vector<std::thread> m_workers;
+  std::deque<Job *> m_jobs; // jobs with chunks left to claim
+  std::mutex m_mtx;
+  std::condition_variable m_cv;
+  std::condition_variable m_doneCv;
+  bool m_stop = false;
+
+  // claims the next chunk of the job, unqueuing it once every chunk has been claimed
+  size_t claim(Job &job);
+  void execute(std::unique_lock<std::mutex> &lock, Job &job, size_t chunk);
+  void workerLoop();
+};
+
+} // namespace file_indexer
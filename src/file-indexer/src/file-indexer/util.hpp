@@ -1,8 +1,10 @@
 #pragma once
 #include <algorithm>
+#include <chrono>
 #include <cstdint>
 #include <cstdlib>
 #include <filesystem>
+#include <format>
 #include <limits>
 #include <optional>
 #include <system_error>
@@ -29,6 +31,12 @@ inline std::filesystem::path cacheDir() { return xdgpp::cacheHome() / "vicinae"
 
 inline std::filesystem::path databasePath() { return cacheDir() / "file-indexer.db"; }
 
+// seconds since the unix epoch, as stored in indexed_file.last_modified_at
+inline int64_t epochSeconds(std::filesystem::file_time_type time) {
+  using namespace std::chrono;
+  return duration_cast<seconds>(clock_cast<system_clock>(time).time_since_epoch()).count();
+}
+
 inline std::filesystem::path normalizePath(const std::filesystem::path &path) {
   return std::filesystem::absolute(path).lexically_normal();
 }
@@ -63,6 +63,9 @@ void FileSystemWatcher::timerLoop() {
     if (now - lastSweep >= BACKGROUND_UPDATE_INTERVAL) {
       lastSweep = now;
       for (const auto &entrypoint : m_entrypoints) {
+        // already followed change by change, overflows trigger their own rescan
+        if (m_watcher->followsRecursively(entrypoint)) continue;
+
         if (fs::is_directory(entrypoint, ec)) {
           auto scan = incrementalScan();
           scan.maxDepth = BACKGROUND_UPDATE_DEPTH;
@@ -0,0 +1,123 @@
+#include "file-indexer/frame-io.hpp"
+#include "file-indexer/log.hpp"
+#include <algorithm>
+#include <array>
+#include <cerrno>
+#include <cstring>
+#include <unistd.h>
+
+namespace file_indexer {
+
+FrameReader::FrameReader(int fd) : m_fd(fd), m_buffer(MIN_READ_SIZE) {}
+
+bool FrameReader::readFrames(const FrameCallback &callback) {
+  reserveForRead();
+
+  ssize_t n = 0;
+  do {
+    n = ::read(m_fd, m_buffer.data() + m_end, m_buffer.size() - m_end);
+  } while (n < 0 && errno == EINTR);
+
+  if (n <= 0) return false;
+
+  m_end += n;
+
+  while (m_end - m_begin >= FRAME_HEADER_SIZE) {
+    uint32_t frameSize = 0;
+    std::memcpy(&frameSize, m_buffer.data() + m_begin, FRAME_HEADER_SIZE);
+
+    if (m_end - m_begin - FRAME_HEADER_SIZE < frameSize) break;
+
+    callback({m_buffer.data() + m_begin + FRAME_HEADER_SIZE, frameSize});
+    m_begin += FRAME_HEADER_SIZE + frameSize;
+  }
+
+  if (m_begin == m_end) m_begin = m_end = 0;
+
+  return true;
+}
+
+void FrameReader::reserveForRead() {
+  size_t needed = MIN_READ_SIZE;
+
+  // a partial frame larger than the buffer gets all the room it needs for the next read
+  if (m_end - m_begin >= FRAME_HEADER_SIZE) {
+    uint32_t frameSize = 0;
+    std::memcpy(&frameSize, m_buffer.data() + m_begin, FRAME_HEADER_SIZE);
+    needed = std::max(needed, FRAME_HEADER_SIZE + frameSize - (m_end - m_begin));
+  }
+
+  if (m_buffer.size() - m_end >= needed) return;
+
+  if (m_begin > 0) {
+    std::memmove(m_buffer.data(), m_buffer.data() + m_begin, m_end - m_begin);
+    m_end -= m_begin;
+    m_begin = 0;
+  }
+
+  if (m_buffer.size() - m_end < needed) m_buffer.resize(std::max(m_buffer.size() * 2, m_end + needed));
+}
+
+FrameWriter::FrameWriter(int fd) : m_fd(fd) {}
+
+void FrameWriter::send(std::string_view payload) {
+  uint32_t const size = payload.size();
+  std::unique_lock lock(m_mutex);
+
+  // the thread already writing picks this frame up once its current write is done
+  if (m_isWriting) {
+    m_pending.append(reinterpret_cast<const char *>(&size), FRAME_HEADER_SIZE);
+    m_pending.append(payload);
+    return;
+  }
+
+  m_isWriting = true;
+  lock.unlock();
+
+  std::array<iovec, 2> frame{{
+      {.iov_base = const_cast<uint32_t *>(&size), .iov_len = FRAME_HEADER_SIZE},
+      {.iov_base = const_cast<char *>(payload.data()), .iov_len = payload.size()},
+  }};
+  write(frame);
+
+  lock.lock();
+
+  while (!m_pending.empty()) {
+    std::swap(m_pending, m_writing);
+    lock.unlock();
+
+    std::array<iovec, 1> pending{{{.iov_base = m_writing.data(), .iov_len = m_writing.size()}}};
+    write(pending);
+    m_writing.clear();
+
+    lock.lock();
+  }
+
+  m_isWriting = false;
+}
+
+void FrameWriter::write(std::span<iovec> buffers) {
+  while (!buffers.empty()) {
+    auto const n = ::writev(m_fd, buffers.data(), buffers.size());
+
+    if (n < 0) {
+      if (errno == EINTR) continue;
+      flog::warn() << "Failed to write frames:" << std::strerror(errno);
+      return;
+    }
+
+    // skip what was fully written and resume from the middle of a partially written buffer
+    size_t written = n;
+    while (!buffers.empty() && written >= buffers.front().iov_len) {
+      written -= buffers.front().iov_len;
+      buffers = buffers.subspan(1);
+    }
+
+    if (written > 0) {
+      buffers.front().iov_base = static_cast<char *>(buffers.front().iov_base) + written;
+      buffers.front().iov_len -= written;
+    }
+  }
+}
+
+} // namespace file_indexer
@@ -3,17 +3,26 @@
 #include "file-indexer/log.hpp"
 #include "file-indexer/util.hpp"
 #include "xdgpp/env/env.hpp"
+#include <climits>
 #include <cstdint>
+#include <cstring>
 #include <deque>
+#include <fcntl.h>
+#include <format>
 #include <mutex>
+#include <optional>
 #include <poll.h>
 #include <ranges>
+#include <string>
 #include <sys/eventfd.h>
+#include <sys/fanotify.h>
 #include <sys/inotify.h>
+#include <sys/stat.h>
 #include <thread>
 #include <unistd.h>
 #include <unordered_map>
 #include <unordered_set>
+#include <vector>
 
 namespace fs = std::filesystem;
 
@@ -275,8 +284,202 @@ public:
   }
 };
 
+// Reports every entry created, deleted, moved or written to on the filesystem holding the home
+// directory, identified by the handle of its parent directory and its name (FAN_REPORT_DFID_NAME).
+// Other filesystems mounted below home are not covered. Needs
+// CAP_SYS_ADMIN for the filesystem mark, in the initial namespace or the one owning the mount, and
+// CAP_DAC_READ_SEARCH to turn handles back into paths.
+class FanotifyDirectoryWatcher : public ImportantDirectoryWatcher {
+  static constexpr uint64_t EVENT_MASK =
+      FAN_CREATE | FAN_DELETE | FAN_MOVED_FROM | FAN_MOVED_TO | FAN_MODIFY | FAN_ONDIR;
+  static constexpr size_t READ_BUFFER_SIZE = 64 * 1024;
+
+  Callback m_cb;
+  EntryFilter m_filter;
+  fs::path m_home;
+  // hidden, so rejected by the filter, but indexed nonetheless
+  std::vector<fs::path> m_hiddenRoots = {xdgpp::configHome(), xdgpp::dataHome()};
+  int m_fanFd = -1;
+  // any descriptor on the watched filesystem, for open_by_handle_at
+  int m_mountFd = -1;
+  dev_t m_device = 0;
+  int m_wakeFd = -1;
+  std::vector<char> m_buffer = std::vector<char>(READ_BUFFER_SIZE);
+  std::thread m_thread;
+
+  std::optional<fs::path> resolveHandle(const std::string &handleBytes) const {
+    alignas(file_handle) char storage[sizeof(file_handle) + MAX_HANDLE_SZ];
+
+    if (handleBytes.size() > sizeof(storage)) return std::nullopt;
+    std::memcpy(storage, handleBytes.data(), handleBytes.size());
+
+    // fails once the directory itself is gone, its parent reports that separately
+    int const fd =
+        open_by_handle_at(m_mountFd, reinterpret_cast<file_handle *>(storage), O_PATH | O_CLOEXEC);
+    if (fd < 0) return std::nullopt;
+
+    char target[PATH_MAX];
+    auto const len = readlink(std::format("/proc/self/fd/{}", fd).c_str(), target, sizeof(target));
+
+    close(fd);
+    if (len <= 0 || static_cast<size_t>(len) == sizeof(target)) return std::nullopt;
+
+    return fs::path(std::string(target, len));
+  }
+
+  bool isWanted(const fs::path &dir) const {
+    if (!file_indexer::isSameOrDescendantOf(dir, m_home)) return false;
+    if (dir == m_home || file_indexer::isCoveredByAny(dir, m_hiddenRoots)) return true;
+    return m_filter.shouldVisit(dir, true);
+  }
+
+  // events are coalesced per parent directory over everything readable at once, and only
+  // resolved to a path once per batch
+  void drainEvents() {
+    std::unordered_set<std::string> changedDirs;
+    bool overflowed = false;
+    ssize_t len = 0;
+
+    while ((len = read(m_fanFd, m_buffer.data(), m_buffer.size())) > 0) {
+      auto *meta = reinterpret_cast<fanotify_event_metadata *>(m_buffer.data());
+
+      for (; FAN_EVENT_OK(meta, len); meta = FAN_EVENT_NEXT(meta, len)) {
+        if (meta->vers != FANOTIFY_METADATA_VERSION) continue;
+
+        if (meta->mask & FAN_Q_OVERFLOW) {
+          overflowed = true;
+          continue;
+        }
+
+        auto const *info = reinterpret_cast<const fanotify_event_info_fid *>(meta + 1);
+        if (meta->event_len < sizeof(*meta) + sizeof(*info)) continue;
+        if (info->hdr.info_type != FAN_EVENT_INFO_TYPE_DFID_NAME) continue;
+
+        auto const *handle = reinterpret_cast<const file_handle *>(info->handle);
+        changedDirs.emplace(reinterpret_cast<const char *>(handle),
+                            sizeof(file_handle) + handle->handle_bytes);
+      }
+    }
+
+    if (overflowed) m_cb({Event::Kind::Degraded, {}});
+
+    for (const auto &handle : changedDirs) {
+      auto dir = resolveHandle(handle);
+
+      if (!dir || !isWanted(*dir)) continue;
+      m_cb({Event::Kind::DirectoryChanged, std::move(*dir)});
+    }
+  }
+
+  void eventLoop() {
+    pollfd fds[2] = {{m_fanFd, POLLIN, 0}, {m_wakeFd, POLLIN, 0}};
+
+    while (true) {
+      if (poll(fds, 2, -1) < 0) {
+        if (errno != EINTR)
+          break;
+        else
+          continue;
+      }
+
+      if (fds[1].revents & POLLIN) break;
+      if (fds[0].revents & POLLIN) drainEvents();
+    }
+  }
+
+  FanotifyDirectoryWatcher(Callback cb, fs::path home, int fanFd, int mountFd, dev_t device, int wakeFd)
+      : m_cb(std::move(cb)), m_home(std::move(home)), m_fanFd(fanFd), m_mountFd(mountFd),
+        m_device(device), m_wakeFd(wakeFd) {
+    m_thread = std::thread([this] { eventLoop(); });
+  }
+
+  // the filesystem mark is granted without CAP_DAC_READ_SEARCH, but no event could be resolved then
+  static bool canResolveHandles(int mountFd) {
+    alignas(file_handle) char storage[sizeof(file_handle) + MAX_HANDLE_SZ];
+    auto *handle = reinterpret_cast<file_handle *>(storage);
+    int mountId = 0;
+
+    handle->handle_bytes = MAX_HANDLE_SZ;
+    if (name_to_handle_at(mountFd, "", handle, &mountId, AT_EMPTY_PATH) < 0) return false;
+
+    int const fd = open_by_handle_at(mountFd, handle, O_PATH | O_CLOEXEC);
+    if (fd < 0) return false;
+
+    close(fd);
+    return true;
+  }
+
+public:
+  // nullptr where fanotify filesystem marks are not permitted, or not supported by the kernel
+  static std::unique_ptr<FanotifyDirectoryWatcher> tryCreate(Callback cb) {
+    auto home = file_indexer::homeDir();
+    if (home.empty()) return nullptr;
+
+    int const fanFd = fanotify_init(FAN_CLASS_NOTIF | FAN_CLOEXEC | FAN_NONBLOCK | FAN_REPORT_DFID_NAME,
+                                    O_RDONLY | O_CLOEXEC);
+
+    if (fanFd < 0) {
+      flog::info() << "fanotify unavailable, falling back to inotify:" << std::strerror(errno);
+      return nullptr;
+    }
+
+    int const mountFd = open(home.c_str(), O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+    int const wakeFd = eventfd(0, EFD_CLOEXEC);
+    struct stat st{};
+
+    auto fail = [&](const char *reason) -> std::unique_ptr<FanotifyDirectoryWatcher> {
+      flog::info() << reason << ", falling back to inotify:" << std::strerror(errno);
+      if (wakeFd >= 0) close(wakeFd);
+      if (mountFd >= 0) close(mountFd);
+      close(fanFd);
+      return nullptr;
+    };
+
+    if (mountFd < 0 || fstat(mountFd, &st) < 0) return fail("Failed to open the home directory");
+    if (wakeFd < 0) return fail("Failed to create fanotify watcher wake descriptor");
+
+    if (fanotify_mark(fanFd, FAN_MARK_ADD | FAN_MARK_FILESYSTEM, EVENT_MASK, AT_FDCWD, home.c_str()) < 0) {
+      return fail("fanotify filesystem mark refused");
+    }
+
+    if (!canResolveHandles(mountFd)) return fail("fanotify file handles cannot be opened");
+
+    flog::info() << "Watching the filesystem of" << home.c_str() << "with fanotify";
+
+    return std::unique_ptr<FanotifyDirectoryWatcher>(new FanotifyDirectoryWatcher(
+        std::move(cb), std::move(home), fanFd, mountFd, st.st_dev, wakeFd));
+  }
+
+  ~FanotifyDirectoryWatcher() override {
+    if (m_thread.joinable()) {
+      uint64_t const one = 1;
+      std::ignore = write(m_wakeFd, &one, sizeof(one));
+      m_thread.join();
+    }
+    if (m_fanFd >= 0) close(m_fanFd);
+    if (m_mountFd >= 0) close(m_mountFd);
+    if (m_wakeFd >= 0) close(m_wakeFd);
+  }
+
+  std::vector<fs::path> rootDirectories() const override { return {m_home}; }
+
+  // a filesystem mounted below home is not covered by the mark
+  bool followsRecursively(const fs::path &dir) const override {
+    struct stat st{};
+
+    if (!file_indexer::isSameOrDescendantOf(dir, m_home)) return false;
+    return stat(dir.c_str(), &st) == 0 && st.st_dev == m_device;
+  }
+
+  std::vector<fs::path> watchedDirectories() const override { return {m_home}; }
+
+  // everything is watched already
+  void setDynamicDirectories(const std::vector<fs::path> &) override {}
+};
+
 } // namespace
 
 std::unique_ptr<ImportantDirectoryWatcher> ImportantDirectoryWatcher::create(Callback cb) {
+  if (auto watcher = FanotifyDirectoryWatcher::tryCreate(cb)) return watcher;
   return std::make_unique<LinuxImportantDirectoryWatcher>(std::move(cb));
 }
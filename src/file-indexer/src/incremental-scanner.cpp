@@ -12,35 +12,61 @@ namespace fs = std::filesystem;
 void IncrementalScanner::processDirectory(const fs::path &root, const EntryCallback &onEntry) {
   m_pacer.checkpoint();
 
-  auto indexedFiles = m_readDb.listIndexedDirectoryFiles(root);
+  // whatever is left in there once the listing is done has been deleted
+  auto indexed = m_readDb.listIndexedDirectoryEntries(root);
+  std::vector<fs::path> paths;
   std::vector<fs::path> deletedFiles;
   std::vector<FileEvent> events;
   std::error_code ec;
 
-  m_currentEntries.clear();
-  m_currentEntries.insert(root);
-  events.emplace_back(FileEventType::Modify, root, fs::last_write_time(root, ec), true, std::nullopt);
+  paths.emplace_back(root);
 
   for (const auto &entry : fs::directory_iterator(root, ec)) {
     if (ec) continue;
     if (!m_filter.shouldVisit(entry)) continue;
+    paths.emplace_back(entry.path());
+  }
+
+  auto const stats = file_indexer::statPaths(paths);
+
+  for (size_t i = 0; i != paths.size(); ++i) {
+    const auto &path = paths[i];
+    bool const isRoot = i == 0;
+    std::optional<FileIndexerDatabase::IndexedEntry> previous;
+
+    if (isRoot) {
+      // the root is listed in its parent, which this pass does not read
+      if (auto lastModified = m_readDb.retrieveIndexedLastModified(root)) {
+        previous = FileIndexerDatabase::IndexedEntry{.lastModified = lastModified, .isDirectory = true};
+      }
+    } else if (auto it = indexed.find(path.filename().native()); it != indexed.end()) {
+      previous = it->second;
+      indexed.erase(it);
+    }
+
+    // gone or unreadable since it was listed, the next pass will tell
+    if (!stats[i]) continue;
 
-    bool const isDirectory = entry.is_directory(ec);
-    m_currentEntries.insert(entry.path());
-    events.emplace_back(FileEventType::Modify, entry.path(), entry.last_write_time(ec), isDirectory,
-                        file_indexer::fileSizeBytesFor(entry.path(), isDirectory));
+    const auto &stat = *stats[i];
+    bool const changed = !previous || previous->isDirectory != stat.isDirectory ||
+                         previous->lastModified != file_indexer::epochSeconds(stat.lastModified) ||
+                         previous->sizeBytes != stat.sizeBytes;
 
-    if (onEntry) { onEntry(entry, !indexedFiles.contains(entry.path())); }
+    if (changed) {
+      events.emplace_back(FileEventType::Modify, path, stat.lastModified, stat.isDirectory, stat.sizeBytes);
+    }
+
+    if (onEntry && !isRoot) { onEntry(path, stat, !previous); }
   }
 
-  for (const auto &path : indexedFiles) {
-    if (!m_currentEntries.contains(path)) { deletedFiles.emplace_back(path); }
+  for (const auto &name : indexed | std::views::keys) {
+    deletedFiles.emplace_back(root / name);
   }
 
-  auto const processedCount = events.size();
+  auto const processedCount = paths.size();
 
-  m_writer->deleteIndexedFiles(std::move(deletedFiles));
-  m_writer->indexEvents(std::move(events));
+  if (!deletedFiles.empty()) m_writer->deleteIndexedFiles(std::move(deletedFiles));
+  if (!events.empty()) m_writer->indexEvents(std::move(events));
   reportProgress(processedCount);
 }
 
@@ -59,28 +85,26 @@ IncrementalScanner::getScannableDirectories(const fs::path &path, std::optional<
     return scannableDirs;
   }
 
+  auto const indexedDirs = m_readDb.listIndexedSubdirectories(path);
+
   walker.setMaxDepth(maxDepth);
   walker.setExcludedPaths(excludedPaths);
   walker.walk(path, [&](const fs::directory_entry &entry) {
     reportProgress();
     if (!entry.is_directory(ec)) return;
-    bool const shouldProcess = shouldProcessEntry(entry, lastSuccessfulScan->createdAt);
-    if (shouldProcess) { scannableDirs.emplace_back(entry.path()); }
+    if (!indexedDirs.contains(entry.path()) || modifiedSince(entry, lastSuccessfulScan->createdAt)) {
+      scannableDirs.emplace_back(entry.path());
+    }
   });
 
   return scannableDirs;
 }
 
-bool IncrementalScanner::shouldProcessEntry(const fs::directory_entry &entry, int64_t cutOffSeconds) const {
+bool IncrementalScanner::modifiedSince(const fs::directory_entry &entry, int64_t cutOffSeconds) {
   std::error_code ec;
 
   if (auto lastModified = fs::last_write_time(entry, ec); !ec) {
-    using namespace std::chrono;
-    auto sctp = clock_cast<system_clock>(lastModified);
-    auto const lastModifiedSeconds =
-        static_cast<int64_t>(duration_cast<seconds>(sctp.time_since_epoch()).count());
-
-    return lastModifiedSeconds >= cutOffSeconds || !m_readDb.tracksFile(entry.path());
+    return file_indexer::epochSeconds(lastModified) >= cutOffSeconds;
   }
 
   return true;
@@ -89,10 +113,9 @@ bool IncrementalScanner::shouldProcessEntry(const fs::directory_entry &entry, in
 void IncrementalScanner::exhaustiveScan(const fs::path &path, const IncrementalScan &scan) {
   std::deque<fs::path> newDirs;
   std::unordered_set<fs::path> processed;
-  std::error_code ec;
 
-  auto collectNewDirs = [&](const fs::directory_entry &entry, bool isNew) {
-    if (isNew && entry.is_directory(ec)) { newDirs.emplace_back(entry.path()); }
+  auto collectNewDirs = [&](const fs::path &entry, const file_indexer::PathStat &stat, bool isNew) {
+    if (isNew && stat.isDirectory) { newDirs.emplace_back(entry); }
   };
 
   for (const auto &dir : getScannableDirectories(path, scan.maxDepth, scan.excludedPaths)) {
@@ -122,11 +145,12 @@ void IncrementalScanner::prunedScan(const fs::path &scanPath, const IncrementalS
   }
 
   std::deque<fs::path> queue;
-  std::error_code ec;
 
-  auto collectChangedDirs = [&](const fs::directory_entry &entry, bool isNew) {
-    if (!entry.is_directory(ec)) return;
-    if (isNew || shouldProcessEntry(entry, cutOffSeconds)) { queue.emplace_back(entry.path()); }
+  auto collectChangedDirs = [&](const fs::path &entry, const file_indexer::PathStat &stat, bool isNew) {
+    if (!stat.isDirectory) return;
+    if (isNew || file_indexer::epochSeconds(stat.lastModified) >= cutOffSeconds) {
+      queue.emplace_back(entry);
+    }
   };
 
   queue.emplace_back(scanPath);
@@ -1,6 +1,7 @@
 #include "file-indexer/indexer-scanner.hpp"
 #include "file-indexer/abstract-scanner.hpp"
 #include "file-indexer/log.hpp"
+#include <mutex>
 #include <utility>
 
 namespace fs = std::filesystem;
@@ -18,12 +19,18 @@ void IndexerScanner::scan(const Scan &scan) {
                               std::nullopt);
   }
 
-  m_walker.walk(scan.path, [&](const fs::directory_entry &entry) {
-    std::error_code ec;
-    reportProgress();
-    bool const isDirectory = entry.is_directory(ec);
-    batchedIndex.emplace_back(FileEventType::Modify, entry.path(), entry.last_write_time(ec), isDirectory,
-                              file_indexer::fileSizeBytesFor(entry.path(), isDirectory));
+  // the walker calls back from all of its threads
+  std::mutex batchMutex;
+
+  m_walker.walk(scan.path, [&](std::span<WalkEntry> entries) {
+    std::scoped_lock const lock(batchMutex);
+
+    for (auto &entry : entries) {
+      batchedIndex.emplace_back(FileEventType::Modify, std::move(entry.path), entry.lastModified,
+                                entry.isDirectory, entry.sizeBytes);
+    }
+
+    reportProgress(entries.size());
 
     if (batchedIndex.size() >= INDEX_BATCH_SIZE) {
       m_writer->indexEvents(std::move(batchedIndex));
@@ -53,6 +60,8 @@ void IndexerScanner::run() {
   failed ? fail() : finish();
 }
 
+std::vector<WalkerThroughput> IndexerScanner::workerThroughput() const { return m_walker.throughput(); }
+
 void IndexerScanner::interrupt() {
   setInterruptFlag();
   m_walker.stop();
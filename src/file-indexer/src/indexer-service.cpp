@@ -1,8 +1,9 @@
 #include "file-indexer/indexer-service.hpp"
+#include "file-indexer/frame-io.hpp"
 #include <cstdint>
-#include <cstring>
 #include <filesystem>
 #include <functional>
+#include <optional>
 #include <unistd.h>
 #include <vector>
 
@@ -82,13 +83,24 @@ static file_indexer_gen::FileCategory toFileCategory(IndexedFileCategory categor
 static constexpr size_t QUERY_WORKER_COUNT = 3;
 
 IndexerService::IndexerService(file_indexer_gen::RpcTransport &transport)
-    : file_indexer_gen::AbstractFileIndexer(transport), m_queryPool(QUERY_WORKER_COUNT) {
+    : file_indexer_gen::AbstractFileIndexer(transport),
+      m_queryPool(QUERY_WORKER_COUNT, m_indexer.pathIndex(), m_indexer.writer()) {
   m_indexer.setScanEventCallback([this](const ScanEvent &event) {
+    std::optional<std::vector<double>> workerRates;
+
+    if (!event.workerThroughput.empty()) {
+      workerRates.emplace();
+      for (const auto &throughput : event.workerThroughput) {
+        workerRates->emplace_back(throughput.entriesPerSecond());
+      }
+    }
+
     emitscanStatusChanged({.scan_id = event.scanId,
                            .kind = toScanKind(event.type),
                            .state = toScanState(event.status),
                            .entrypoint = event.entrypoint.string(),
-                           .processed_file_count = static_cast<uint32_t>(event.processedFileCount)});
+                           .processed_file_count = static_cast<uint32_t>(event.processedFileCount),
+                           .worker_entries_per_second = std::move(workerRates)});
   });
 }
 
@@ -102,6 +114,8 @@ static std::vector<fs::path> toPaths(const std::vector<std::string> &values) {
 }
 
 std::expected<void, std::string> IndexerService::configure(file_indexer_gen::IndexerConfig config) {
+  m_indexer.setResidentIndexEnabled(config.resident_index.value_or(false));
+
   if (!m_started) {
     m_indexer.setConfig(toPaths(config.paths), toPaths(config.excluded_paths));
     m_started = true;
@@ -127,6 +141,7 @@ void IndexerService::query(
   m_queryPool.submit({.text = std::move(req.text),
                       .limit = req.limit,
                       .options = options,
+                      .session = req.session.value_or(""),
                       .onResult = [reply = std::move(reply)](std::vector<IndexerFileResult> results) {
                         file_indexer_gen::QueryResponse response;
                         response.matches.reserve(results.size());
@@ -143,29 +158,9 @@ void IndexerService::query(
 }
 
 void IndexerService::listen(file_indexer_gen::Server &server) {
-  std::vector<char> buffer;
-  char tmp[4096];
-
-  while (true) {
-    const ssize_t n = read(STDIN_FILENO, tmp, sizeof(tmp));
-    if (n <= 0) break;
-
-    buffer.insert(buffer.end(), tmp, tmp + n);
+  FrameReader reader{STDIN_FILENO};
 
-    constexpr size_t HEADER_SIZE = sizeof(uint32_t);
-
-    while (buffer.size() >= HEADER_SIZE) {
-      uint32_t frameLen = 0;
-      std::memcpy(&frameLen, buffer.data(), HEADER_SIZE);
-
-      if (buffer.size() - HEADER_SIZE < frameLen) break;
-
-      std::string_view payload{buffer.data() + HEADER_SIZE, frameLen};
-      server.route(payload);
-
-      buffer.erase(buffer.begin(), buffer.begin() + HEADER_SIZE + frameLen);
-    }
-  }
+  while (reader.readFrames([&](std::string_view payload) { server.route(payload); })) {}
 }
 
 }; // namespace file_indexer
@@ -1,9 +1,7 @@
-#include <cstdint>
 #include <filesystem>
-#include <iostream>
-#include <mutex>
 #include <unistd.h>
 #include "file-indexer/file-indexer-db.hpp"
+#include "file-indexer/frame-io.hpp"
 #include "file-indexer/indexer-service.hpp"
 #include "file-indexer/log.hpp"
 #include "file-indexer/migrations.hpp"
@@ -32,15 +30,9 @@ bool shouldPurgeDatabase() {
 } // namespace
 
 class StdoutTransport : public file_indexer_gen::AbstractTransport {
-  std::mutex m_mtx;
-
-  void send(std::string_view data) override {
-    std::scoped_lock const lock(m_mtx);
-    uint32_t size = data.size();
-    std::cout.write(reinterpret_cast<const char *>(&size), sizeof(size));
-    std::cout.write(data.data(), data.size());
-    std::cout.flush();
-  }
+  file_indexer::FrameWriter m_writer{STDOUT_FILENO};
+
+  void send(std::string_view data) override { m_writer.send(data); }
 };
 
 int main(int, char **) {
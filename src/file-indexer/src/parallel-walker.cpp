@@ -0,0 +1,316 @@
+#include "file-indexer/parallel-walker.hpp"
+#include "file-indexer/background-thread.hpp"
+#include "file-indexer/log.hpp"
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <dirent.h>
+#include <exception>
+#include <fcntl.h>
+#include <format>
+#include <ranges>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <thread>
+#include <unistd.h>
+
+namespace fs = std::filesystem;
+
+namespace {
+
+constexpr size_t MAX_DEFAULT_THREAD_COUNT = 4;
+constexpr std::string_view CACHEDIR_TAG = "CACHEDIR.TAG";
+constexpr int DIRECTORY_OPEN_FLAGS = O_RDONLY | O_DIRECTORY | O_CLOEXEC | O_NOFOLLOW;
+
+fs::file_time_type toFileTime(const struct timespec &ts) {
+  using namespace std::chrono;
+  auto const sinceEpoch = seconds(ts.tv_sec) + nanoseconds(ts.tv_nsec);
+  return clock_cast<fs::file_time_type::clock>(
+      system_clock::time_point(duration_cast<system_clock::duration>(sinceEpoch)));
+}
+
+} // namespace
+
+class ParallelWalker::DirectoryFd {
+public:
+  explicit DirectoryFd(int fd) : m_fd(fd) {}
+  ~DirectoryFd() {
+    if (m_fd >= 0) close(m_fd);
+  }
+
+  DirectoryFd(const DirectoryFd &) = delete;
+  DirectoryFd &operator=(const DirectoryFd &) = delete;
+
+  int get() const { return m_fd; }
+
+private:
+  int m_fd;
+};
+
+ParallelWalker::ParallelWalker()
+    : m_threadCount(std::clamp<size_t>(std::thread::hardware_concurrency(), 1, MAX_DEFAULT_THREAD_COUNT)) {}
+
+void ParallelWalker::setIgnoreFiles(const std::vector<std::string> &files) { m_filter.setIgnoreFiles(files); }
+
+void ParallelWalker::setIgnoreHiddenPaths(bool value) { m_filter.setIgnoreHiddenPaths(value); }
+
+void ParallelWalker::setExcludedPaths(const std::vector<fs::path> &paths) {
+  m_filter.setExcludedPaths(paths);
+}
+
+void ParallelWalker::setThreadCount(size_t count) { m_threadCount = std::max<size_t>(count, 1); }
+
+void ParallelWalker::walk(const fs::path &root, const BatchCallback &callback) {
+  using namespace std::chrono;
+
+  auto const start = steady_clock::now();
+  std::error_code ec;
+
+  if (!fs::is_directory(root, ec)) {
+    flog::warn() << "ParallelWalker needs to be passed a readable directory as its root entrypoint"
+                 << (ec ? ec.message().c_str() : "");
+    return;
+  }
+
+  m_workers.clear();
+  for (size_t i = 0; i != m_threadCount; ++i) {
+    m_workers.emplace_back(std::make_unique<Worker>());
+  }
+
+  push(*m_workers.front(), {.path = root, .parent = nullptr});
+
+  std::mutex errorMutex;
+  std::exception_ptr error;
+
+  auto run = [&](size_t index) {
+    try {
+      runWorker(index, callback);
+    } catch (...) {
+      std::scoped_lock const lock(errorMutex);
+      if (!error) error = std::current_exception();
+      // the other workers may be asleep waiting for directories this one would have pushed
+      stop();
+    }
+  };
+
+  {
+    std::vector<std::jthread> threads;
+
+    threads.reserve(m_threadCount - 1);
+    for (size_t i = 1; i < m_threadCount; ++i) {
+      threads.emplace_back([&run, i] {
+        file_indexer::setBackgroundThreadPriority();
+        run(i);
+      });
+    }
+
+    run(0);
+  }
+
+  if (error) std::rethrow_exception(error);
+
+  auto const stats = throughput();
+  auto const total = std::ranges::fold_left(stats, size_t{0}, [](size_t sum, const WalkerThroughput &t) {
+    return sum + t.entryCount;
+  });
+  std::string rates;
+
+  for (const auto &t : stats) {
+    rates += std::format("{}{:.0f}/s", rates.empty() ? "" : ", ", t.entriesPerSecond());
+  }
+
+  flog::debug() << std::format("Done walking file tree at {}. Processed {} entries in {}ms on {} threads "
+                               "({}).",
+                               root.string(), total,
+                               duration_cast<milliseconds>(steady_clock::now() - start).count(),
+                               stats.size(), rates);
+}
+
+void ParallelWalker::stop() {
+  m_alive = false;
+  wakeAll();
+}
+
+std::vector<WalkerThroughput> ParallelWalker::throughput() const {
+  using namespace std::chrono;
+
+  return m_workers | std::views::transform([](const auto &worker) {
+           return WalkerThroughput{
+               .entryCount = worker->entryCount.load(),
+               .busyTime = duration_cast<milliseconds>(nanoseconds(worker->busyNanos.load()))};
+         }) |
+         std::ranges::to<std::vector>();
+}
+
+void ParallelWalker::runWorker(size_t index, const BatchCallback &callback) {
+  using namespace std::chrono;
+
+  auto &worker = *m_workers[index];
+  file_indexer::IoPacer pacer;
+  std::vector<std::byte> buffer(GETDENTS_BUFFER_SIZE);
+  std::vector<DirectoryName> names;
+
+  while (m_alive) {
+    auto dir = takeDirectory(index);
+
+    if (!dir) {
+      // whoever holds the last pending directories may still push subdirectories
+      if (m_pending == 0) break;
+      waitForWork();
+      continue;
+    }
+
+    auto const started = steady_clock::now();
+    readDirectory(worker, pacer, *dir, buffer, names, callback);
+    worker.busyNanos += duration_cast<nanoseconds>(steady_clock::now() - started).count();
+
+    if (--m_pending == 0) wakeAll();
+  }
+}
+
+void ParallelWalker::waitForWork() {
+  std::unique_lock lock(m_idleMutex);
+
+  ++m_sleeping;
+  m_idleCv.wait(lock, [&] { return !m_alive || m_pending == 0 || m_queued > 0; });
+  --m_sleeping;
+}
+
+void ParallelWalker::wakeAll() {
+  { std::scoped_lock const lock(m_idleMutex); }
+  m_idleCv.notify_all();
+}
+
+std::optional<ParallelWalker::PendingDirectory> ParallelWalker::takeDirectory(size_t index) {
+  // our own queue is consumed depth-first, thieves take the oldest and shallowest directories,
+  // which tend to hold the largest subtrees
+  {
+    auto &own = *m_workers[index];
+    std::scoped_lock const lock(own.mutex);
+
+    if (!own.queue.empty()) {
+      auto dir = std::move(own.queue.back());
+      own.queue.pop_back();
+      --m_queued;
+      return dir;
+    }
+  }
+
+  for (size_t i = 1; i < m_workers.size(); ++i) {
+    auto &victim = *m_workers[(index + i) % m_workers.size()];
+    std::scoped_lock const lock(victim.mutex);
+
+    if (!victim.queue.empty()) {
+      auto dir = std::move(victim.queue.front());
+      victim.queue.pop_front();
+      --m_queued;
+      return dir;
+    }
+  }
+
+  return std::nullopt;
+}
+
+void ParallelWalker::push(Worker &worker, PendingDirectory dir) {
+  ++m_pending;
+
+  {
+    std::scoped_lock const lock(worker.mutex);
+    worker.queue.emplace_back(std::move(dir));
+  }
+
+  ++m_queued;
+
+  // a sleeper registers before checking m_queued, so one of the two always sees the other
+  if (m_sleeping > 0) {
+    { std::scoped_lock const lock(m_idleMutex); }
+    m_idleCv.notify_one();
+  }
+}
+
+void ParallelWalker::readDirectory(Worker &worker, file_indexer::IoPacer &pacer,
+                                   const PendingDirectory &pending, std::span<std::byte> buffer,
+                                   std::vector<DirectoryName> &names, const BatchCallback &callback) {
+  const auto &dir = pending.path;
+  int rawFd = pending.parent ? openat(pending.parent->get(), dir.filename().c_str(), DIRECTORY_OPEN_FLAGS)
+                             : open(dir.c_str(), DIRECTORY_OPEN_FLAGS & ~O_NOFOLLOW);
+
+  // out of descriptors with many parents held open: the absolute path still works
+  if (rawFd < 0 && errno == EMFILE) rawFd = open(dir.c_str(), DIRECTORY_OPEN_FLAGS);
+
+  if (rawFd < 0) {
+    flog::warn() << "walk error" << dir.c_str() << std::strerror(errno);
+    return;
+  }
+
+  auto const fd = std::make_shared<const DirectoryFd>(rawFd);
+
+  names.clear();
+
+  while (true) {
+    auto const bytes = syscall(SYS_getdents64, fd->get(), buffer.data(), buffer.size());
+
+    if (bytes < 0) flog::warn() << "walk error" << dir.c_str() << std::strerror(errno);
+    if (bytes <= 0) break;
+
+    for (long offset = 0; offset < bytes;) {
+      auto const *entry = reinterpret_cast<const struct dirent64 *>(buffer.data() + offset);
+      std::string_view const name = entry->d_name;
+
+      offset += entry->d_reclen;
+
+      if (name == "." || name == "..") continue;
+      if (name == CACHEDIR_TAG && EntryFilter::isCacheDirTag(dir / name)) return;
+
+      names.emplace_back(std::string{name}, entry->d_type);
+    }
+  }
+
+  std::vector<WalkEntry> batch;
+
+  batch.reserve(std::min(names.size(), CALLBACK_BATCH_SIZE));
+
+  auto flush = [&] {
+    worker.entryCount += batch.size();
+    callback(batch);
+    batch.clear();
+  };
+
+  for (auto &[name, type] : names) {
+    if (!m_alive) return;
+
+    pacer.checkpoint();
+
+    struct stat st {};
+    bool hasStat = false;
+
+    // some filesystems do not fill d_type
+    if (type == DT_UNKNOWN) {
+      if (fstatat(fd->get(), name.c_str(), &st, AT_SYMLINK_NOFOLLOW) != 0) continue;
+      hasStat = true;
+      type = IFTODT(st.st_mode);
+    }
+
+    if (type == DT_LNK) continue;
+
+    bool const isDirectory = type == DT_DIR;
+    auto path = dir / name;
+
+    if (!m_filter.shouldVisit(path, isDirectory)) continue;
+    // gone since it was listed
+    if (!hasStat && fstatat(fd->get(), name.c_str(), &st, AT_SYMLINK_NOFOLLOW) != 0) continue;
+
+    if (isDirectory) push(worker, {.path = path, .parent = fd});
+
+    batch.emplace_back(WalkEntry{
+        .path = std::move(path),
+        .isDirectory = isDirectory,
+        .lastModified = toFileTime(st.st_mtim),
+        .sizeBytes = S_ISREG(st.st_mode) ? std::optional<int64_t>{st.st_size} : std::nullopt,
+    });
+
+    if (batch.size() == CALLBACK_BATCH_SIZE) flush();
+  }
+
+  if (!batch.empty()) flush();
+}
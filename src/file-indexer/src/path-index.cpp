@@ -0,0 +1,490 @@
+#include "file-indexer/path-index.hpp"
+#include "file-indexer/log.hpp"
+#include "file-indexer/vocabulary.hpp"
+#include "fuzzy/normalize.hpp"
+#include <algorithm>
+#include <array>
+#include <cctype>
+#include <chrono>
+#include <limits>
+#include <utility>
+
+namespace fs = std::filesystem;
+
+namespace file_indexer {
+
+namespace {
+
+constexpr size_t TRIGRAM_LENGTH = 3;
+// names from filesystems that store UTF-16 can take up to 765 bytes once in UTF-8
+constexpr size_t MAX_COMPONENT_LENGTH = std::numeric_limits<uint16_t>::max();
+
+uint32_t trigramAt(std::string_view folded, size_t pos) {
+  return static_cast<uint32_t>(static_cast<unsigned char>(folded[pos])) << 16 |
+         static_cast<uint32_t>(static_cast<unsigned char>(folded[pos + 1])) << 8 |
+         static_cast<uint32_t>(static_cast<unsigned char>(folded[pos + 2]));
+}
+
+bool isAsciiWordChar(unsigned char c) {
+  return (c >= '0' && c <= '9') || (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z');
+}
+
+} // namespace
+
+void PathIndex::Batch::upsert(const fs::path &path, bool isDirectory, IndexedFileCategory category,
+                              std::string_view mimeType) {
+  m_ops.emplace_back(Op{.path = path.native(),
+                        .mimeType = std::string{mimeType},
+                        .category = category,
+                        .isDirectory = isDirectory});
+}
+
+void PathIndex::Batch::erase(const fs::path &path) {
+  m_ops.emplace_back(Op{.path = path.native(), .erase = true});
+}
+
+std::string PathIndex::fold(std::string_view text) {
+  std::string folded;
+  folded.reserve(text.size());
+
+  size_t i = 0;
+
+  while (i < text.size()) {
+    auto const c = static_cast<unsigned char>(text[i]);
+
+    if (c < 0x80) {
+      if (isAsciiWordChar(c)) { folded.push_back(static_cast<char>(std::tolower(c))); }
+      ++i;
+      continue;
+    }
+
+    auto const [cp, len] = fzf::decodeUtf8(text, i);
+
+    if (char const ascii = fzf::foldDiacritic(cp); ascii != 0) {
+      if (isAsciiWordChar(static_cast<unsigned char>(ascii))) {
+        folded.push_back(static_cast<char>(std::tolower(static_cast<unsigned char>(ascii))));
+      }
+    } else {
+      std::array<char, 4> encoded{};
+      int const encodedLen = fzf::encodeUtf8(fzf::foldScriptCase(cp), encoded);
+      folded.append(encoded.data(), static_cast<size_t>(encodedLen));
+    }
+
+    i += static_cast<size_t>(len);
+  }
+
+  return folded;
+}
+
+uint64_t PathIndex::entryKey(DirId dir, std::string_view name) {
+  return std::hash<std::string_view>{}(name) ^ (static_cast<uint64_t>(dir) * 0x9E3779B97F4A7C15ULL);
+}
+
+void PathIndex::addPostings(Postings &postings, std::string_view folded, uint32_t id) {
+  if (folded.size() < TRIGRAM_LENGTH) return;
+
+  for (size_t i = 0; i + TRIGRAM_LENGTH <= folded.size(); ++i) {
+    auto &list = postings[trigramAt(folded, i)];
+    // ids only ever grow, so a repeated trigram of the same id is always at the back
+    if (list.empty() || list.back() != id) { list.push_back(id); }
+  }
+}
+
+std::vector<uint32_t> PathIndex::lookup(const Postings &postings, std::string_view folded) {
+  std::vector<const std::vector<uint32_t> *> lists;
+  lists.reserve(folded.size());
+
+  for (size_t i = 0; i + TRIGRAM_LENGTH <= folded.size(); ++i) {
+    auto it = postings.find(trigramAt(folded, i));
+    if (it == postings.end()) return {};
+    lists.emplace_back(&it->second);
+  }
+
+  if (lists.empty()) return {};
+
+  std::ranges::sort(lists, std::less{}, [](const auto *list) { return list->size(); });
+  auto [first, last] = std::ranges::unique(lists);
+  lists.erase(first, last);
+
+  std::vector<uint32_t> result = *lists.front();
+  std::vector<uint32_t> scratch;
+
+  for (size_t i = 1; i < lists.size() && !result.empty(); ++i) {
+    scratch.clear();
+    std::ranges::set_intersection(result, *lists[i], std::back_inserter(scratch));
+    std::swap(result, scratch);
+  }
+
+  return result;
+}
+
+PathIndex::DirId PathIndex::internDirectory(std::string_view path) {
+  if (auto it = m_dirIds.find(path); it != m_dirIds.end()) return it->second;
+
+  auto const id = static_cast<DirId>(m_dirPaths.size());
+  auto const [it, _] = m_dirIds.emplace(std::string{path}, id);
+  auto const folded = fold(path);
+
+  m_dirPaths.emplace_back(&it->first);
+  m_dirFoldOffsets.emplace_back(static_cast<uint32_t>(m_dirFolds.size()));
+  m_dirFolds += folded;
+  m_dirChildren.emplace_back();
+  addPostings(m_dirPostings, folded, id);
+
+  return id;
+}
+
+uint16_t PathIndex::internMimeType(std::string_view name) {
+  if (name.empty()) return NO_MIME_TYPE;
+
+  std::string key{name};
+
+  if (auto it = m_mimeTypeIdsByName.find(key); it != m_mimeTypeIdsByName.end()) return it->second;
+  if (m_mimeTypes.size() > std::numeric_limits<uint16_t>::max()) return NO_MIME_TYPE;
+
+  auto const id = static_cast<uint16_t>(m_mimeTypes.size());
+  m_mimeTypes.emplace_back(key);
+  m_mimeTypeIdsByName.emplace(std::move(key), id);
+
+  return id;
+}
+
+std::optional<PathIndex::EntryId> PathIndex::findEntry(DirId dir, std::string_view name) const {
+  auto [begin, end] = m_entryLookup.equal_range(entryKey(dir, name));
+
+  for (auto it = begin; it != end; ++it) {
+    EntryId const id = it->second;
+    if (m_entryDir[id] != dir) continue;
+    if (std::string_view{m_names}.substr(m_nameOffsets[id], m_nameLengths[id]) == name) return id;
+  }
+
+  return std::nullopt;
+}
+
+std::string_view PathIndex::foldedName(EntryId id) const {
+  return std::string_view{m_foldedNames}.substr(m_foldOffsets[id], m_foldLengths[id]);
+}
+
+std::string_view PathIndex::foldedDir(DirId id) const {
+  auto const begin = m_dirFoldOffsets[id];
+  auto const end = id + 1 < m_dirFoldOffsets.size() ? m_dirFoldOffsets[id + 1] : m_dirFolds.size();
+  return std::string_view{m_dirFolds}.substr(begin, end - begin);
+}
+
+bool PathIndex::matchesWord(EntryId id, std::string_view folded) const {
+  return foldedName(id).find(folded) != std::string_view::npos ||
+         foldedDir(m_entryDir[id]).find(folded) != std::string_view::npos || matchesAcross(id, folded);
+}
+
+bool PathIndex::matchesAcross(EntryId id, std::string_view folded, size_t split) const {
+  return foldedDir(m_entryDir[id]).ends_with(folded.substr(0, split)) &&
+         foldedName(id).starts_with(folded.substr(split));
+}
+
+bool PathIndex::matchesAcross(EntryId id, std::string_view folded) const {
+  for (size_t split = 1; split < folded.size(); ++split) {
+    if (matchesAcross(id, folded, split)) return true;
+  }
+
+  return false;
+}
+
+void PathIndex::upsertLocked(std::string_view path, bool isDirectory, IndexedFileCategory category,
+                             std::string_view mimeType) {
+  auto const name = vocab::basenameView(path);
+  auto const dirname = vocab::dirnameView(path);
+
+  if (name.empty()) return;
+
+  if (name.size() > MAX_COMPONENT_LENGTH) {
+    flog::warn() << "Not indexing " << path << ": name is longer than " << MAX_COMPONENT_LENGTH << " bytes";
+    return;
+  }
+
+  DirId const dir = internDirectory(dirname);
+  uint8_t const flags = Alive | (isDirectory ? Directory : 0);
+
+  if (auto existing = findEntry(dir, name)) {
+    m_flags[*existing] = flags;
+    m_categories[*existing] = static_cast<uint8_t>(category);
+    m_mimeTypeIds[*existing] = internMimeType(mimeType);
+    return;
+  }
+
+  auto const id = static_cast<EntryId>(m_entryDir.size());
+  auto folded = fold(name);
+
+  if (folded.size() > MAX_COMPONENT_LENGTH) { folded.resize(MAX_COMPONENT_LENGTH); }
+
+  m_entryDir.emplace_back(dir);
+  m_nameOffsets.emplace_back(static_cast<uint32_t>(m_names.size()));
+  m_nameLengths.emplace_back(static_cast<uint16_t>(name.size()));
+  m_foldOffsets.emplace_back(static_cast<uint32_t>(m_foldedNames.size()));
+  m_foldLengths.emplace_back(static_cast<uint16_t>(folded.size()));
+  m_flags.emplace_back(flags);
+  m_categories.emplace_back(static_cast<uint8_t>(category));
+  m_mimeTypeIds.emplace_back(internMimeType(mimeType));
+  m_names += name;
+  m_foldedNames += folded;
+
+  m_dirChildren[dir].emplace_back(id);
+  m_entryLookup.emplace(entryKey(dir, name), id);
+  addPostings(m_namePostings, folded, id);
+
+  // only the trigrams with a character on each side of the separator
+  auto const dirFolded = foldedDir(dir);
+  auto const dirTail = dirFolded.substr(dirFolded.size() - std::min<size_t>(dirFolded.size(), 2));
+  std::string const joint = std::string{dirTail} + folded.substr(0, 2);
+
+  for (size_t i = 0; i + TRIGRAM_LENGTH <= joint.size(); ++i) {
+    if (i < dirTail.size() && i + TRIGRAM_LENGTH > dirTail.size()) {
+      addPostings(m_boundaryPostings, std::string_view{joint}.substr(i, TRIGRAM_LENGTH), id);
+    }
+  }
+}
+
+void PathIndex::killEntry(EntryId id) {
+  if (!alive(id)) return;
+
+  auto const name = std::string_view{m_names}.substr(m_nameOffsets[id], m_nameLengths[id]);
+  auto [begin, end] = m_entryLookup.equal_range(entryKey(m_entryDir[id], name));
+
+  for (auto it = begin; it != end; ++it) {
+    if (it->second == id) {
+      m_entryLookup.erase(it);
+      break;
+    }
+  }
+
+  m_flags[id] &= ~Alive;
+  ++m_deadCount;
+}
+
+void PathIndex::eraseLocked(std::string_view path) {
+  auto const name = vocab::basenameView(path);
+
+  if (auto dir = m_dirIds.find(vocab::dirnameView(path)); dir != m_dirIds.end()) {
+    if (auto id = findEntry(dir->second, name)) { killEntry(*id); }
+  }
+
+  // the subtree: the directory itself and every directory below it
+  std::string const lower = std::string{path} + '/';
+  std::string const upper = std::string{path} + static_cast<char>('/' + 1);
+  auto killChildren = [&](DirId dir) {
+    for (EntryId const child : m_dirChildren[dir]) {
+      killEntry(child);
+    }
+    m_dirChildren[dir].clear();
+  };
+
+  if (auto self = m_dirIds.find(path); self != m_dirIds.end()) { killChildren(self->second); }
+
+  for (auto it = m_dirIds.lower_bound(lower); it != m_dirIds.end() && it->first < upper; ++it) {
+    killChildren(it->second);
+  }
+}
+
+void PathIndex::clearLocked() {
+  m_dirIds.clear();
+  m_dirPaths.clear();
+  m_dirFoldOffsets.clear();
+  m_dirFolds.clear();
+  m_dirChildren.clear();
+  m_entryDir.clear();
+  m_nameOffsets.clear();
+  m_nameLengths.clear();
+  m_foldOffsets.clear();
+  m_foldLengths.clear();
+  m_flags.clear();
+  m_categories.clear();
+  m_mimeTypeIds.clear();
+  m_names.clear();
+  m_foldedNames.clear();
+  m_mimeTypes.assign(1, "");
+  m_mimeTypeIdsByName.clear();
+  m_entryLookup.clear();
+  m_namePostings.clear();
+  m_dirPostings.clear();
+  m_boundaryPostings.clear();
+  m_deadCount = 0;
+}
+
+void PathIndex::compactLocked() {
+  using namespace std::chrono;
+
+  auto const start = steady_clock::now();
+
+  struct Live {
+    std::string path;
+    std::string mimeType;
+    IndexedFileCategory category;
+    bool isDirectory;
+  };
+
+  std::vector<Live> live;
+  live.reserve(m_entryDir.size() - m_deadCount);
+
+  for (EntryId id = 0; id < m_entryDir.size(); ++id) {
+    if (!alive(id)) continue;
+
+    std::string path = *m_dirPaths[m_entryDir[id]];
+    path += '/';
+    path += std::string_view{m_names}.substr(m_nameOffsets[id], m_nameLengths[id]);
+
+    live.emplace_back(Live{.path = std::move(path),
+                           .mimeType = m_mimeTypes[m_mimeTypeIds[id]],
+                           .category = static_cast<IndexedFileCategory>(m_categories[id]),
+                           .isDirectory = static_cast<bool>(m_flags[id] & Directory)});
+  }
+
+  clearLocked();
+
+  for (const auto &entry : live) {
+    upsertLocked(entry.path, entry.isDirectory, entry.category, entry.mimeType);
+  }
+
+  auto const elapsed = duration_cast<milliseconds>(steady_clock::now() - start);
+  flog::debug() << "Compacted resident path index: " << live.size() << " entries in " << elapsed.count()
+                << "ms";
+}
+
+void PathIndex::apply(const Batch &batch) {
+  if (batch.empty() || !isReady()) return;
+
+  std::unique_lock const lock(m_mtx);
+
+  for (const auto &op : batch.m_ops) {
+    if (op.erase) {
+      eraseLocked(op.path);
+    } else {
+      upsertLocked(op.path, op.isDirectory, op.category, op.mimeType);
+    }
+  }
+
+  if (m_deadCount >= COMPACT_MIN_DEAD_ENTRIES && m_deadCount * 2 > m_entryDir.size()) { compactLocked(); }
+}
+
+void PathIndex::clear() {
+  std::unique_lock const lock(m_mtx);
+  m_ready.store(false, std::memory_order_release);
+  clearLocked();
+}
+
+PathIndex::Loader::Loader(PathIndex &index) : m_index(index), m_lock(index.m_mtx) {
+  m_index.m_ready.store(false, std::memory_order_release);
+  m_index.clearLocked();
+}
+
+PathIndex::Loader::~Loader() { m_index.m_ready.store(true, std::memory_order_release); }
+
+void PathIndex::Loader::add(std::string_view path, bool isDirectory, IndexedFileCategory category,
+                            std::string_view mimeType) {
+  m_index.upsertLocked(path, isDirectory, category, mimeType);
+}
+
+std::optional<std::vector<PathIndex::EntryId>>
+PathIndex::Reader::search(std::span<const std::string_view> words, size_t limit,
+                          const FileIndexerDatabase::SearchOptions &options) const {
+  const auto &index = m_index;
+
+  if (!index.isReady() || limit == 0) return std::nullopt;
+
+  std::vector<std::string> folded;
+  folded.reserve(words.size());
+
+  for (auto word : words) {
+    if (auto f = fold(word); !f.empty()) { folded.emplace_back(std::move(f)); }
+  }
+
+  // the longest word is usually the most selective one: it drives the posting lookup
+  auto driver = std::ranges::max_element(folded, std::less{}, &std::string::size);
+
+  if (driver == folded.end() || driver->size() < TRIGRAM_LENGTH) return std::nullopt;
+
+  std::string const key = *driver;
+  folded.erase(driver);
+
+  std::vector<EntryId> ids;
+
+  auto accept = [&](EntryId id) {
+    if (!index.alive(id)) return false;
+    if (options.category && index.m_categories[id] != static_cast<uint8_t>(*options.category)) return false;
+    return std::ranges::all_of(folded, [&](const std::string &word) { return index.matchesWord(id, word); });
+  };
+
+  for (EntryId const id : lookup(index.m_namePostings, key)) {
+    if (ids.size() == limit) return ids;
+    if (index.foldedName(id).find(key) == std::string_view::npos) continue;
+    if (accept(id)) { ids.emplace_back(id); }
+  }
+
+  for (DirId const dir : lookup(index.m_dirPostings, key)) {
+    if (index.foldedDir(dir).find(key) == std::string_view::npos) continue;
+
+    for (EntryId const id : index.m_dirChildren[dir]) {
+      if (ids.size() == limit) return ids;
+      // already collected through its own basename
+      if (index.foldedName(id).find(key) != std::string_view::npos) continue;
+      if (accept(id)) { ids.emplace_back(id); }
+    }
+  }
+
+  // the key spanning the last separator: any such match contains the trigram of the key that
+  // straddles the split point
+  for (size_t split = 1; split < key.size(); ++split) {
+    auto const trigram = std::string_view{key}.substr(std::min(split - 1, key.size() - TRIGRAM_LENGTH),
+                                                      TRIGRAM_LENGTH);
+
+    for (EntryId const id : lookup(index.m_boundaryPostings, trigram)) {
+      if (ids.size() == limit) return ids;
+      if (!index.matchesAcross(id, key, split)) continue;
+      // already collected through its basename, its directory or an earlier split
+      if (index.foldedName(id).find(key) != std::string_view::npos) continue;
+      if (index.foldedDir(index.m_entryDir[id]).find(key) != std::string_view::npos) continue;
+      if (std::ranges::any_of(std::views::iota(size_t{1}, split),
+                              [&](size_t earlier) { return index.matchesAcross(id, key, earlier); })) {
+        continue;
+      }
+      if (accept(id)) { ids.emplace_back(id); }
+    }
+  }
+
+  return ids;
+}
+
+std::string_view PathIndex::Reader::basename(EntryId id) const {
+  return std::string_view{m_index.m_names}.substr(m_index.m_nameOffsets[id], m_index.m_nameLengths[id]);
+}
+
+std::string_view PathIndex::Reader::dirname(EntryId id) const {
+  return *m_index.m_dirPaths[m_index.m_entryDir[id]];
+}
+
+bool PathIndex::Reader::isDirectory(EntryId id) const { return m_index.m_flags[id] & Directory; }
+
+IndexedFileCategory PathIndex::Reader::category(EntryId id) const {
+  return static_cast<IndexedFileCategory>(m_index.m_categories[id]);
+}
+
+std::optional<std::string> PathIndex::Reader::mimeType(EntryId id) const {
+  auto const mimeTypeId = m_index.m_mimeTypeIds[id];
+  if (mimeTypeId == NO_MIME_TYPE) return std::nullopt;
+  return m_index.m_mimeTypes[mimeTypeId];
+}
+
+fs::path PathIndex::Reader::path(EntryId id) const {
+  auto const dir = dirname(id);
+  auto const name = basename(id);
+  std::string path;
+
+  path.reserve(dir.size() + 1 + name.size());
+  path += dir;
+  path += '/';
+  path += name;
+
+  return path;
+}
+
+size_t PathIndex::Reader::size() const { return m_index.m_entryDir.size() - m_index.m_deadCount; }
+
+} // namespace file_indexer
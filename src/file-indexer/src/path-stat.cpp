@@ -0,0 +1,67 @@
+#include "file-indexer/path-stat.hpp"
+#include "file-indexer/scoring-pool.hpp"
+#include <cerrno>
+#include <chrono>
+#include <fcntl.h>
+#include <sys/stat.h>
+
+namespace file_indexer {
+
+namespace {
+
+// stat calls block on IO rather than burn CPU, and any of them can hang on an unreachable mount:
+// they get a bounded pool of their own instead of the one sized to the cores
+constexpr size_t STAT_WORKER_COUNT = 4;
+
+ScoringPool &statPool() {
+  static ScoringPool pool{STAT_WORKER_COUNT};
+  return pool;
+}
+
+PathState pathState(const std::filesystem::path &path) {
+  struct statx stx;
+
+  // followed like fs::exists did: a dangling symlink is as good as gone
+  if (statx(AT_FDCWD, path.c_str(), AT_STATX_DONT_SYNC, 0, &stx) == 0) {
+    return PathState::Exists;
+  }
+
+  return errno == ENOENT || errno == ENOTDIR ? PathState::Missing : PathState::Unknown;
+}
+
+std::optional<PathStat> pathStat(const std::filesystem::path &path) {
+  using namespace std::chrono;
+  struct statx stx;
+
+  if (statx(AT_FDCWD, path.c_str(), 0, STATX_TYPE | STATX_MTIME | STATX_SIZE, &stx) != 0) return std::nullopt;
+
+  auto const sinceEpoch = seconds(stx.stx_mtime.tv_sec) + nanoseconds(stx.stx_mtime.tv_nsec);
+  bool const isRegular = S_ISREG(stx.stx_mode);
+
+  return PathStat{
+      .lastModified = clock_cast<std::filesystem::file_time_type::clock>(
+          system_clock::time_point(duration_cast<system_clock::duration>(sinceEpoch))),
+      .isDirectory = S_ISDIR(stx.stx_mode),
+      .sizeBytes = isRegular ? std::optional<int64_t>{static_cast<int64_t>(stx.stx_size)} : std::nullopt,
+  };
+}
+
+} // namespace
+
+std::vector<PathState> pathStates(std::span<const std::filesystem::path> paths) {
+  std::vector<PathState> states(paths.size(), PathState::Unknown);
+
+  statPool().run(paths.size(), [&](size_t i) { states[i] = pathState(paths[i]); });
+
+  return states;
+}
+
+std::vector<std::optional<PathStat>> statPaths(std::span<const std::filesystem::path> paths) {
+  std::vector<std::optional<PathStat>> stats(paths.size());
+
+  statPool().run(paths.size(), [&](size_t i) { stats[i] = pathStat(paths[i]); });
+
+  return stats;
+}
+
+} // namespace file_indexer
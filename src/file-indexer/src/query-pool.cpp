@@ -1,7 +1,9 @@
 #include "file-indexer/query-pool.hpp"
 #include <utility>
 
-QueryPool::QueryPool(size_t workerCount) {
+QueryPool::QueryPool(size_t workerCount, std::shared_ptr<const file_indexer::PathIndex> pathIndex,
+                     std::shared_ptr<DbWriter> writer)
+    : m_pathIndex(std::move(pathIndex)), m_writer(std::move(writer)) {
   m_workers.reserve(workerCount);
   for (size_t i = 0; i < workerCount; ++i) {
     m_workers.emplace_back([this] { workerLoop(); });
@@ -21,6 +23,33 @@ QueryPool::~QueryPool() {
 
 void QueryPool::submit(Job job) {
   std::unique_lock lock(m_mtx);
+  std::vector<Job> superseded;
+
+  if (!job.session.empty()) {
+    job.token = file_indexer::CancellationToken::create();
+
+    auto &latest = m_sessions[job.session];
+    latest.cancel();
+    latest = job.token;
+
+    // a superseded job still waiting for a worker is answered right away
+    for (auto it = m_queue.begin(); it != m_queue.end();) {
+      if (it->session == job.session) {
+        superseded.emplace_back(std::move(*it));
+        it = m_queue.erase(it);
+      } else {
+        ++it;
+      }
+    }
+  }
+
+  if (!superseded.empty()) {
+    lock.unlock();
+    for (auto &stale : superseded) {
+      stale.onResult({});
+    }
+    lock.lock();
+  }
 
   if (m_queue.size() >= MAX_PENDING) {
     Job stale = std::move(m_queue.front());
@@ -35,10 +64,11 @@ void QueryPool::submit(Job job) {
 }
 
 void QueryPool::workerLoop() {
-  FileIndexerQueryEngine engine;
+  FileIndexerQueryEngine engine{m_pathIndex, m_writer};
 
   while (true) {
     Job job;
+    FileIndexerQueryEngine::SessionCandidates candidates;
 
     {
       std::unique_lock lock(m_mtx);
@@ -46,8 +76,31 @@ void QueryPool::workerLoop() {
       if (m_stop && m_queue.empty()) return;
       job = std::move(m_queue.front());
       m_queue.pop_front();
+
+      if (auto it = m_sessionCandidates.find(job.session); it != m_sessionCandidates.end()) {
+        candidates = it->second;
+      }
+    }
+
+    auto results = engine.query(job.text, job.limit, job.options, job.token,
+                                job.session.empty() ? nullptr : &candidates);
+
+    if (!job.session.empty()) {
+      std::scoped_lock const lock(m_mtx);
+      if (auto it = m_sessions.find(job.session); it != m_sessions.end() && it->second == job.token) {
+        m_sessions.erase(it);
+      }
+
+      // a superseded query may have stopped anywhere: the previous candidates stay
+      if (!job.token.isCancelled()) {
+        if (candidates) {
+          m_sessionCandidates[job.session] = std::move(candidates);
+        } else {
+          m_sessionCandidates.erase(job.session);
+        }
+      }
     }
 
-    job.onResult(engine.query(job.text, job.limit, job.options));
+    job.onResult(std::move(results));
   }
 }
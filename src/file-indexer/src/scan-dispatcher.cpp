@@ -58,13 +58,15 @@ int ScanDispatcher::enqueue(const Scan &scan) {
 std::unique_ptr<AbstractScanner> ScanDispatcher::makeScanner(int scanId, const Scan &scan,
                                                              FileIndexerDatabase &readDb) {
   auto handler = [this, scanId, path = scan.path, type = scan.type(),
-                  notify = scan.notify](ScanStatus status, size_t processedCount) {
+                  notify = scan.notify](ScanStatus status, size_t processedCount,
+                                        const std::vector<WalkerThroughput> &workerThroughput) {
     if (notify && m_eventCallback) {
       m_eventCallback({.scanId = scanId,
                        .type = type,
                        .status = status,
                        .entrypoint = path,
-                       .processedFileCount = processedCount});
+                       .processedFileCount = processedCount,
+                       .workerThroughput = workerThroughput});
     }
   };
 
@@ -0,0 +1,90 @@
+#include "file-indexer/scoring-pool.hpp"
+#include <algorithm>
+
+namespace file_indexer {
+
+ScoringPool::ScoringPool(size_t workerCount) {
+  m_workers.reserve(workerCount);
+  for (size_t i = 0; i < workerCount; ++i) {
+    m_workers.emplace_back([this] { workerLoop(); });
+  }
+}
+
+ScoringPool::~ScoringPool() {
+  {
+    std::scoped_lock const lock(m_mtx);
+    m_stop = true;
+  }
+  m_cv.notify_all();
+  for (auto &worker : m_workers) {
+    if (worker.joinable()) worker.join();
+  }
+}
+
+ScoringPool &ScoringPool::shared() {
+  static ScoringPool pool{std::max(1u, std::thread::hardware_concurrency()) - 1};
+  return pool;
+}
+
+bool ScoringPool::run(size_t chunkCount, const ChunkFn &fn, const CancellationToken &token) {
+  if (chunkCount == 0) return !token.isCancelled();
+
+  Job job{.fn = fn, .token = token, .chunkCount = chunkCount};
+  std::unique_lock lock(m_mtx);
+
+  if (chunkCount > 1 && !m_workers.empty()) {
+    m_jobs.push_back(&job);
+    m_cv.notify_all();
+  }
+
+  while (job.next < job.chunkCount) {
+    execute(lock, job, claim(job));
+  }
+
+  m_doneCv.wait(lock, [&] { return job.finished == job.chunkCount; });
+
+  return !job.skipped;
+}
+
+size_t ScoringPool::claim(Job &job) {
+  size_t const chunk = job.next++;
+
+  if (job.next == job.chunkCount) { std::erase(m_jobs, &job); }
+
+  return chunk;
+}
+
+void ScoringPool::execute(std::unique_lock<std::mutex> &lock, Job &job, size_t chunk) {
+  bool const cancelled = job.token.isCancelled();
+
+  if (!cancelled) {
+    lock.unlock();
+    job.fn(chunk);
+    lock.lock();
+  }
+
+  job.skipped |= cancelled;
+  if (++job.finished == job.chunkCount) m_doneCv.notify_all();
+}
+
+void ScoringPool::workerLoop() {
+  std::unique_lock lock(m_mtx);
+
+  while (true) {
+    m_cv.wait(lock, [this] { return m_stop || !m_jobs.empty(); });
+    if (m_stop) return;
+
+    Job *job = m_jobs.front();
+    size_t const chunk = claim(*job);
+
+    // round-robin between the queries in flight
+    if (!m_jobs.empty() && m_jobs.front() == job) {
+      m_jobs.pop_front();
+      m_jobs.push_back(job);
+    }
+
+    execute(lock, *job, chunk);
+  }
+}
+
+} // namespace file_indexer
@@ -0,0 +1,228 @@
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <fcntl.h>
+#include <format>
+#include <string>
+#include <sys/mman.h>
+#include <thread>
+#include <unistd.h>
+#include <vector>
+#include "file-indexer-server.hpp"
+#include "file-indexer/frame-io.hpp"
+
+using file_indexer::FrameReader;
+using file_indexer::FrameWriter;
+
+namespace {
+
+std::string frame(std::string_view payload) {
+  std::string bytes(file_indexer::FRAME_HEADER_SIZE, '\0');
+  uint32_t const size = payload.size();
+
+  std::memcpy(bytes.data(), &size, sizeof(size));
+  bytes += payload;
+
+  return bytes;
+}
+
+class Pipe {
+public:
+  Pipe() { REQUIRE(pipe2(m_fds, O_CLOEXEC) == 0); }
+  ~Pipe() {
+    closeWrite();
+    close(m_fds[0]);
+  }
+
+  Pipe(const Pipe &) = delete;
+  Pipe &operator=(const Pipe &) = delete;
+
+  int readFd() const { return m_fds[0]; }
+  int writeFd() const { return m_fds[1]; }
+
+  // no assertions in here, it runs off the test thread
+  void write(std::string_view bytes) {
+    while (!bytes.empty()) {
+      auto const n = ::write(m_fds[1], bytes.data(), bytes.size());
+      if (n <= 0) return;
+      bytes.remove_prefix(n);
+    }
+  }
+
+  void closeWrite() {
+    if (m_fds[1] >= 0) close(m_fds[1]);
+    m_fds[1] = -1;
+  }
+
+private:
+  int m_fds[2];
+};
+
+std::vector<std::string> readAll(FrameReader &reader) {
+  std::vector<std::string> frames;
+
+  while (reader.readFrames([&](std::string_view payload) { frames.emplace_back(payload); })) {}
+
+  return frames;
+}
+
+class StubIndexer : public file_indexer_gen::AbstractFileIndexer {
+public:
+  using AbstractFileIndexer::AbstractFileIndexer;
+
+  std::expected<void, std::string> configure(file_indexer_gen::IndexerConfig) override { return {}; }
+  std::expected<void, std::string> rebuildIndex() override { return {}; }
+
+  void query(
+      file_indexer_gen::QueryRequest req,
+      std::function<void(std::expected<file_indexer_gen::QueryResponse, std::string>)> reply) override {
+    file_indexer_gen::QueryResponse response;
+    response.matches.emplace_back(file_indexer_gen::FileMatch{
+        .path = std::format("/home/user/{}.pdf", req.text),
+        .rank = 1.0,
+        .category = file_indexer_gen::FileCategory::Document,
+    });
+    reply(response);
+  }
+};
+
+class FrameTransport : public file_indexer_gen::AbstractTransport {
+public:
+  explicit FrameTransport(int fd) : m_writer(fd) {}
+
+  size_t sentCount() const { return m_sent; }
+
+  void send(std::string_view data) override {
+    ++m_sent;
+    m_writer.send(data);
+  }
+
+private:
+  FrameWriter m_writer;
+  std::atomic<size_t> m_sent = 0;
+};
+
+} // namespace
+
+TEST_CASE("frame reader decodes frames split across and packed into reads") {
+  Pipe pipe;
+  FrameReader reader{pipe.readFd()};
+  std::vector<std::string> frames;
+  auto collect = [&](std::string_view payload) { frames.emplace_back(payload); };
+
+  auto const first = frame("first");
+  auto const second = frame("second");
+
+  // a header split in the middle, then the rest of the frame along with a complete one
+  pipe.write(first.substr(0, 2));
+  REQUIRE(reader.readFrames(collect));
+  CHECK(frames.empty());
+
+  pipe.write(first.substr(2) + second + frame(""));
+  REQUIRE(reader.readFrames(collect));
+  CHECK(frames == std::vector<std::string>{"first", "second", ""});
+
+  pipe.closeWrite();
+  CHECK_FALSE(reader.readFrames(collect));
+}
+
+TEST_CASE("frame reader grows for frames larger than a read") {
+  Pipe pipe;
+  std::string const large(300 * 1024, 'x');
+
+  std::jthread writer([&] {
+    pipe.write(frame("before") + frame(large) + frame("after"));
+    pipe.closeWrite();
+  });
+
+  FrameReader reader{pipe.readFd()};
+  auto const frames = readAll(reader);
+
+  REQUIRE(frames.size() == 3);
+  CHECK(frames[0] == "before");
+  CHECK(frames[1] == large);
+  CHECK(frames[2] == "after");
+}
+
+TEST_CASE("frame writer keeps every frame whole when sent from several threads") {
+  constexpr int THREAD_COUNT = 4;
+  constexpr int FRAMES_PER_THREAD = 2000;
+
+  Pipe pipe;
+  FrameWriter writer{pipe.writeFd()};
+  std::vector<std::string> frames;
+
+  std::jthread reader([&] {
+    FrameReader frameReader{pipe.readFd()};
+    frames = readAll(frameReader);
+  });
+
+  {
+    std::vector<std::jthread> senders;
+    for (int t = 0; t != THREAD_COUNT; ++t) {
+      senders.emplace_back([&writer, t] {
+        for (int i = 0; i != FRAMES_PER_THREAD; ++i) {
+          writer.send(std::format("{}:{}", t, i));
+        }
+      });
+    }
+  }
+
+  pipe.closeWrite();
+  reader.join();
+
+  REQUIRE(frames.size() == THREAD_COUNT * FRAMES_PER_THREAD);
+
+  // frames of one thread come out in the order they were sent
+  std::vector<int> next(THREAD_COUNT, 0);
+  for (const auto &payload : frames) {
+    auto const colon = payload.find(':');
+    int const t = std::stoi(payload.substr(0, colon));
+    CHECK(std::stoi(payload.substr(colon + 1)) == next[t]++);
+  }
+}
+
+TEST_CASE("routing framed query requests", "[!benchmark]") {
+  constexpr int FRAME_COUNT = 100'000;
+
+  int const input = memfd_create("frames", MFD_CLOEXEC);
+  int const output = open("/dev/null", O_WRONLY | O_CLOEXEC);
+  REQUIRE(input >= 0);
+  REQUIRE(output >= 0);
+
+  std::string frames;
+  for (int i = 0; i != FRAME_COUNT; ++i) {
+    frames += frame(std::format(R"({{"jsonrpc":"2.0","method":"FileIndexer/query","id":{},)"
+                                R"("params":{{"req":{{"text":"report {}","limit":20}}}}}})",
+                                i, i % 100));
+  }
+  REQUIRE(write(input, frames.data(), frames.size()) == ssize_t(frames.size()));
+
+  FrameTransport transport{output};
+  file_indexer_gen::RpcTransport rpc{transport};
+  StubIndexer indexer{rpc};
+  file_indexer_gen::Server server{rpc, indexer};
+
+  auto routeAll = [&] {
+    lseek(input, 0, SEEK_SET);
+    FrameReader reader{input};
+    size_t routed = 0;
+
+    while (reader.readFrames([&](std::string_view payload) {
+      server.route(payload);
+      ++routed;
+    })) {}
+
+    return routed;
+  };
+
+  REQUIRE(routeAll() == FRAME_COUNT);
+  CHECK(transport.sentCount() == FRAME_COUNT);
+
+  BENCHMARK("100k query frames through Server::route") { return routeAll(); };
+
+  close(output);
+  close(input);
+}
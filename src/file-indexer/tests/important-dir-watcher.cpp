@@ -0,0 +1,92 @@
+#include <catch2/catch_test_macros.hpp>
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unistd.h>
+#include <vector>
+#include "file-indexer/important-dir-watcher.hpp"
+
+namespace fs = std::filesystem;
+
+namespace {
+
+// /tmp is rejected by the entry filter, the home directory has to live elsewhere
+class ScopedHome {
+  std::optional<std::string> m_previous;
+
+public:
+  fs::path path = fs::current_path() / ("watcher-home-" + std::to_string(getpid()));
+
+  ScopedHome() {
+    if (const char *home = std::getenv("HOME")) m_previous = home;
+    fs::create_directories(path / "Documents");
+    setenv("HOME", path.c_str(), 1);
+  }
+
+  ~ScopedHome() {
+    std::error_code ec;
+
+    if (m_previous)
+      setenv("HOME", m_previous->c_str(), 1);
+    else
+      unsetenv("HOME");
+    fs::remove_all(path, ec);
+  }
+};
+
+class EventRecorder {
+  std::mutex m_mtx;
+  std::condition_variable m_cv;
+  std::vector<fs::path> m_dirs;
+
+public:
+  void record(const ImportantDirectoryWatcher::Event &ev) {
+    if (ev.kind != ImportantDirectoryWatcher::Event::Kind::DirectoryChanged) return;
+
+    std::scoped_lock const l(m_mtx);
+    m_dirs.emplace_back(ev.dir);
+    m_cv.notify_all();
+  }
+
+  bool waitFor(const fs::path &dir) {
+    std::unique_lock lock(m_mtx);
+    return m_cv.wait_for(lock, std::chrono::seconds(5), [&] { return std::ranges::contains(m_dirs, dir); });
+  }
+};
+
+} // namespace
+
+TEST_CASE("important directory watcher reports entries created in a root") {
+  ScopedHome home;
+  EventRecorder recorder;
+  auto watcher = ImportantDirectoryWatcher::create([&](const auto &ev) { recorder.record(ev); });
+
+  std::ofstream(home.path / "Documents" / "report.pdf") << "draft";
+
+  CHECK(recorder.waitFor(home.path / "Documents"));
+}
+
+TEST_CASE("important directory watcher follows writes when it watches recursively") {
+  ScopedHome home;
+  EventRecorder recorder;
+  auto const file = home.path / "Documents" / "report.pdf";
+
+  std::ofstream(file) << "draft";
+
+  auto watcher = ImportantDirectoryWatcher::create([&](const auto &ev) { recorder.record(ev); });
+
+  // inotify only follows the namespace, the periodic sweep picks up writes
+  if (!watcher->followsRecursively(home.path)) SKIP("fanotify is not permitted here");
+
+  std::ofstream(file, std::ios::app) << ", final";
+
+  CHECK(recorder.waitFor(home.path / "Documents"));
+  CHECK(watcher->followsRecursively(home.path / "Documents"));
+  CHECK_FALSE(watcher->followsRecursively(home.path.parent_path()));
+}
@@ -213,3 +213,14 @@ TEST_CASE("splitQueryWords trims and drops empty words") {
   CHECK(splitQueryWords("  hello   yo ") == std::vector<std::string_view>{"hello", "yo"});
   CHECK(splitQueryWords("") == std::vector<std::string_view>{});
 }
+
+TEST_CASE("narrowsQuery only holds for extensions matched through trigrams") {
+  CHECK(narrowsQuery("serc", "sercom"));
+  CHECK(narrowsQuery("serc", "serc dump"));
+  CHECK(narrowsQuery("serc", "serc"));
+  // short words are matched as whole tokens, not as substrings
+  CHECK_FALSE(narrowsQuery("se", "serc"));
+  CHECK_FALSE(narrowsQuery("serc", "serc du"));
+  CHECK_FALSE(narrowsQuery("sercom", "serc"));
+  CHECK_FALSE(narrowsQuery("serc", "dump serc"));
+}
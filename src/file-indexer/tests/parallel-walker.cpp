@@ -0,0 +1,151 @@
+#include <catch2/catch_test_macros.hpp>
+#include <algorithm>
+#include <chrono>
+#include <filesystem>
+#include <format>
+#include <fstream>
+#include <map>
+#include <mutex>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <unistd.h>
+#include "file-indexer/parallel-walker.hpp"
+
+namespace fs = std::filesystem;
+
+namespace {
+
+class ScratchTree {
+public:
+  ScratchTree() : m_root(fs::temp_directory_path() / std::format("vicinae-walker-{}", getpid())) {
+    fs::remove_all(m_root);
+    fs::create_directories(m_root);
+  }
+
+  ~ScratchTree() {
+    std::error_code ec;
+    fs::remove_all(m_root, ec);
+  }
+
+  ScratchTree(const ScratchTree &) = delete;
+  ScratchTree &operator=(const ScratchTree &) = delete;
+
+  const fs::path &root() const { return m_root; }
+
+  void write(std::string_view relative, std::string_view content = "") {
+    auto const path = m_root / relative;
+    fs::create_directories(path.parent_path());
+    std::ofstream(path) << content;
+  }
+
+private:
+  fs::path m_root;
+};
+
+std::map<fs::path, WalkEntry> walkAll(ParallelWalker &walker, const fs::path &root) {
+  std::mutex mutex;
+  std::map<fs::path, WalkEntry> entries;
+
+  walker.walk(root, [&](std::span<WalkEntry> batch) {
+    std::scoped_lock const lock(mutex);
+    for (auto &entry : batch) {
+      auto path = entry.path;
+      REQUIRE(entries.emplace(std::move(path), std::move(entry)).second);
+    }
+  });
+
+  return entries;
+}
+
+} // namespace
+
+TEST_CASE("parallel walker visits every entry once and filters like the sequential walker") {
+  ScratchTree tree;
+
+  for (int dir = 0; dir != 20; ++dir) {
+    for (int file = 0; file != 30; ++file) {
+      tree.write(std::format("d{}/sub{}/f{}.txt", dir, dir % 3, file));
+    }
+  }
+
+  tree.write("sized/report.pdf", "0123456789");
+  tree.write("project/node_modules/pkg/index.js");
+  tree.write("cached/CACHEDIR.TAG", "Signature: 8a477f597d28d172789f06886806bc55");
+  tree.write("cached/blob.bin");
+  fs::create_directory_symlink(tree.root() / "sized", tree.root() / "link");
+
+  ParallelWalker walker;
+  walker.setThreadCount(4);
+
+  auto const entries = walkAll(walker, tree.root());
+
+  // 20 + 20 directories and 600 files, plus sized/, its file, project/ and cached/
+  CHECK(entries.size() == 644);
+  CHECK(entries.contains(tree.root() / "d7/sub1/f29.txt"));
+  CHECK(entries.contains(tree.root() / "project"));
+  CHECK_FALSE(entries.contains(tree.root() / "project/node_modules"));
+  CHECK_FALSE(entries.contains(tree.root() / "link"));
+  // the CACHEDIR.TAG directory itself is listed, its content is not
+  CHECK(entries.contains(tree.root() / "cached"));
+  CHECK_FALSE(entries.contains(tree.root() / "cached/blob.bin"));
+
+  const auto &report = entries.at(tree.root() / "sized/report.pdf");
+  CHECK_FALSE(report.isDirectory);
+  CHECK(report.sizeBytes == 10);
+  CHECK(report.lastModified == fs::last_write_time(tree.root() / "sized/report.pdf"));
+
+  const auto &sized = entries.at(tree.root() / "sized");
+  CHECK(sized.isDirectory);
+  CHECK_FALSE(sized.sizeBytes.has_value());
+
+  auto const throughput = walker.throughput();
+  REQUIRE(throughput.size() == 4);
+  CHECK(std::accumulate(throughput.begin(), throughput.end(), size_t{0},
+                        [](size_t sum, const WalkerThroughput &t) { return sum + t.entryCount; }) ==
+        entries.size());
+}
+
+TEST_CASE("parallel walker stops early once stopped") {
+  ScratchTree tree;
+
+  for (int dir = 0; dir != 50; ++dir) {
+    tree.write(std::format("d{}/f.txt", dir));
+  }
+
+  ParallelWalker walker;
+  std::mutex mutex;
+  size_t seen = 0;
+
+  walker.setThreadCount(2);
+  walker.walk(tree.root(), [&](std::span<WalkEntry> batch) {
+    std::scoped_lock const lock(mutex);
+    seen += batch.size();
+    walker.stop();
+  });
+
+  CHECK(seen < 100);
+}
+
+TEST_CASE("parallel walker rethrows what the callback throws") {
+  ScratchTree tree;
+
+  // a single directory: while it is read, the other workers have nothing to do but sleep
+  for (int file = 0; file != 10; ++file) {
+    tree.write(std::format("f{}.txt", file));
+  }
+
+  ParallelWalker walker;
+
+  walker.setThreadCount(4);
+
+  auto const throwing = [](std::span<WalkEntry>) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    throw std::runtime_error("callback");
+  };
+
+  // they must be woken up rather than left waiting for directories that will never come
+  CHECK_THROWS_AS(walker.walk(tree.root(), throwing), std::runtime_error);
+}
@@ -0,0 +1,168 @@
+#include <catch2/catch_test_macros.hpp>
+#include <algorithm>
+#include <string>
+#include <string_view>
+#include <vector>
+#include "file-indexer/path-index.hpp"
+
+using file_indexer::PathIndex;
+
+namespace {
+
+std::vector<std::string> searchPaths(const PathIndex &index, std::initializer_list<std::string_view> words,
+                                     FileIndexerDatabase::SearchOptions options = {}) {
+  auto reader = index.read();
+  std::vector<std::string_view> const query{words};
+  auto ids = reader.search(query, 100, options);
+  std::vector<std::string> paths;
+
+  if (!ids) return paths;
+
+  for (auto id : *ids) {
+    paths.emplace_back(reader.path(id).native());
+  }
+
+  std::ranges::sort(paths);
+
+  return paths;
+}
+
+void loadCorpus(PathIndex &index) {
+  auto loader = index.load();
+
+  loader.add("/home/docs", true, IndexedFileCategory::Directory, "");
+  loader.add("/home/docs/budget_2024.xlsx", false, IndexedFileCategory::Document, "application/xlsx");
+  loader.add("/home/docs/Répondre.epub", false, IndexedFileCategory::Document, "application/epub+zip");
+  loader.add("/home/docs/notes", true, IndexedFileCategory::Directory, "");
+  loader.add("/home/docs/notes/meeting.md", false, IndexedFileCategory::Document, "text/markdown");
+  loader.add("/home/pictures/budget.png", false, IndexedFileCategory::Image, "image/png");
+}
+
+} // namespace
+
+TEST_CASE("PathIndex::fold keeps folded word characters only") {
+  CHECK(PathIndex::fold("/home/Docs/budget_2024.xlsx") == "homedocsbudget2024xlsx");
+  CHECK(PathIndex::fold("Répondre à la nuit") == "repondrealanuit");
+  CHECK(PathIndex::fold("...") == "");
+}
+
+TEST_CASE("PathIndex is not ready until loaded") {
+  PathIndex index;
+  std::vector<std::string_view> const words{"budget"};
+
+  CHECK_FALSE(index.isReady());
+  CHECK_FALSE(index.read().search(words, 10, {}).has_value());
+
+  loadCorpus(index);
+
+  CHECK(index.isReady());
+  CHECK(index.read().size() == 6);
+}
+
+TEST_CASE("PathIndex matches basenames and directories") {
+  PathIndex index;
+  loadCorpus(index);
+
+  CHECK(searchPaths(index, {"budget"}) ==
+        std::vector<std::string>{"/home/docs/budget_2024.xlsx", "/home/pictures/budget.png"});
+  // directory components match every child
+  CHECK(searchPaths(index, {"notes"}) ==
+        std::vector<std::string>{"/home/docs/notes", "/home/docs/notes/meeting.md"});
+  // every word has to match somewhere in the path
+  CHECK(searchPaths(index, {"docs", "budget"}) == std::vector<std::string>{"/home/docs/budget_2024.xlsx"});
+  // diacritics are folded on both sides
+  CHECK(searchPaths(index, {"repondre"}) == std::vector<std::string>{"/home/docs/Répondre.epub"});
+}
+
+TEST_CASE("PathIndex matches words across the last separator like path_idx") {
+  PathIndex index;
+  loadCorpus(index);
+
+  CHECK(searchPaths(index, {"notesmeeting"}) == std::vector<std::string>{"/home/docs/notes/meeting.md"});
+  // as few as one character on either side
+  CHECK(searchPaths(index, {"sme"}) == std::vector<std::string>{"/home/docs/notes/meeting.md"});
+  CHECK(searchPaths(index, {"picturesb"}) == std::vector<std::string>{"/home/pictures/budget.png"});
+  // shorter words are verified across the separator as well
+  CHECK(searchPaths(index, {"notesmeeting", "sm"}) ==
+        std::vector<std::string>{"/home/docs/notes/meeting.md"});
+  // not a substring of the folded path
+  CHECK(searchPaths(index, {"notesbudget"}).empty());
+}
+
+TEST_CASE("PathIndex defers short queries to SQLite") {
+  PathIndex index;
+  loadCorpus(index);
+
+  std::vector<std::string_view> const words{"bu", "x"};
+  CHECK_FALSE(index.read().search(words, 10, {}).has_value());
+}
+
+TEST_CASE("PathIndex filters by category") {
+  PathIndex index;
+  loadCorpus(index);
+
+  CHECK(searchPaths(index, {"budget"}, {.category = IndexedFileCategory::Image}) ==
+        std::vector<std::string>{"/home/pictures/budget.png"});
+}
+
+TEST_CASE("PathIndex applies upserts and subtree deletions") {
+  PathIndex index;
+  loadCorpus(index);
+
+  PathIndex::Batch batch;
+  batch.upsert("/home/docs/notes/budget-notes.txt", false, IndexedFileCategory::Document, "text/plain");
+  batch.erase("/home/docs/notes");
+  batch.upsert("/home/music/budget.flac", false, IndexedFileCategory::Audio, "audio/flac");
+  index.apply(batch);
+
+  CHECK(searchPaths(index, {"budget"}) ==
+        std::vector<std::string>{"/home/docs/budget_2024.xlsx", "/home/music/budget.flac",
+                                 "/home/pictures/budget.png"});
+  CHECK(searchPaths(index, {"meeting"}).empty());
+
+  auto reader = index.read();
+  std::vector<std::string_view> const words{"flac"};
+  auto ids = reader.search(words, 10, {});
+
+  REQUIRE(ids);
+  REQUIRE(ids->size() == 1);
+  CHECK(reader.category(ids->front()) == IndexedFileCategory::Audio);
+  CHECK(reader.mimeType(ids->front()) == "audio/flac");
+  CHECK_FALSE(reader.isDirectory(ids->front()));
+}
+
+TEST_CASE("PathIndex re-indexing a path updates it in place") {
+  PathIndex index;
+  loadCorpus(index);
+
+  PathIndex::Batch batch;
+  batch.upsert("/home/pictures/budget.png", false, IndexedFileCategory::Image, "image/webp");
+  index.apply(batch);
+
+  auto reader = index.read();
+  std::vector<std::string_view> const words{"budget", "png"};
+  auto ids = reader.search(words, 10, {});
+
+  REQUIRE(ids);
+  REQUIRE(ids->size() == 1);
+  CHECK(reader.mimeType(ids->front()) == "image/webp");
+  CHECK(reader.size() == 6);
+}
+
+TEST_CASE("PathIndex indexes names longer than 255 bytes") {
+  PathIndex index;
+  loadCorpus(index);
+
+  // what a 300 character name on a filesystem storing UTF-16 looks like in UTF-8
+  std::string name;
+  for (int i = 0; i != 150; ++i) {
+    name += "é";
+  }
+  name += "_invoice.pdf";
+
+  PathIndex::Batch batch;
+  batch.upsert("/home/docs/" + name, false, IndexedFileCategory::Document, "application/pdf");
+  index.apply(batch);
+
+  CHECK(searchPaths(index, {"invoice"}) == std::vector<std::string>{"/home/docs/" + name});
+}
@@ -0,0 +1,62 @@
+#include <catch2/catch_test_macros.hpp>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+#include "file-indexer/path-stat.hpp"
+
+namespace fs = std::filesystem;
+
+using file_indexer::PathState;
+
+TEST_CASE("only paths that are gone for good read as missing") {
+  auto const existing = fs::temp_directory_path();
+  std::vector<fs::path> const paths{
+      existing,
+      existing / "vicinae-path-stat-missing",
+      // ENOTDIR: a regular file used as a directory
+      "/proc/self/status/child",
+      // ENAMETOOLONG says nothing about whether the file is there
+      existing / std::string(300, 'x'),
+  };
+
+  CHECK(file_indexer::pathStates(paths) ==
+        std::vector{PathState::Exists, PathState::Missing, PathState::Missing, PathState::Unknown});
+}
+
+TEST_CASE("statPaths reads type, size and mtime in one batch") {
+  auto const dir = fs::temp_directory_path() / "vicinae-path-stat-batch";
+  fs::remove_all(dir);
+  fs::create_directories(dir);
+  std::ofstream(dir / "file.txt") << "0123456789";
+
+  std::vector<fs::path> const paths{dir, dir / "file.txt", dir / "missing"};
+  auto const stats = file_indexer::statPaths(paths);
+
+  REQUIRE(stats.size() == 3);
+  REQUIRE(stats[0]);
+  CHECK(stats[0]->isDirectory);
+  CHECK_FALSE(stats[0]->sizeBytes.has_value());
+  REQUIRE(stats[1]);
+  CHECK_FALSE(stats[1]->isDirectory);
+  CHECK(stats[1]->sizeBytes == 10);
+  CHECK(stats[1]->lastModified == fs::last_write_time(dir / "file.txt"));
+  CHECK_FALSE(stats[2]);
+
+  fs::remove_all(dir);
+}
+
+TEST_CASE("symlinks are followed like fs::exists does") {
+  auto const dir = fs::temp_directory_path() / "vicinae-path-stat-links";
+  fs::remove_all(dir);
+  fs::create_directories(dir);
+  std::ofstream(dir / "target.txt") << "x";
+  fs::create_symlink(dir / "target.txt", dir / "live");
+  fs::create_symlink(dir / "gone.txt", dir / "dangling");
+
+  std::vector<fs::path> const paths{dir / "live", dir / "dangling"};
+
+  CHECK(file_indexer::pathStates(paths) == std::vector{PathState::Exists, PathState::Missing});
+
+  fs::remove_all(dir);
+}
@@ -0,0 +1,142 @@
+#include <catch2/catch_test_macros.hpp>
+#include <algorithm>
+#include <chrono>
+#include <filesystem>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+#include "file-indexer/file-indexer-db.hpp"
+#include "file-indexer/scan.hpp"
+#include "file-indexer/util.hpp"
+#include "scratch-database.hpp"
+
+namespace fs = std::filesystem;
+
+namespace {
+
+std::vector<std::string> candidatePaths(FileIndexerDatabase &db, std::string_view query) {
+  std::vector<std::string> paths;
+
+  for (const auto &candidate : db.searchCandidates(query, 100)) {
+    paths.emplace_back(candidate.path.native());
+  }
+
+  std::ranges::sort(paths);
+  return paths;
+}
+
+int64_t rowCount(FileIndexerDatabase &db, const std::string &table) {
+  auto stmt = db.database().prepare("SELECT count(*) FROM " + table);
+  return stmt.step() ? stmt.columnInt64(0) : -1;
+}
+
+} // namespace
+
+TEST_CASE("paths stored as directory and basename round-trip through search") {
+  ScratchDatabase db;
+
+  db->indexFiles({"/paths/docs/budget_report.pdf", "/paths/docs/notes/budget_notes.md",
+                  "/paths/music/mayonnaise.flac"});
+
+  CHECK(candidatePaths(*db, "\"budget\"") ==
+        std::vector<std::string>{"/paths/docs/budget_report.pdf", "/paths/docs/notes/budget_notes.md"});
+  // directory words still match: the full path is indexed
+  CHECK(candidatePaths(*db, "\"notes\" \"budget\"") ==
+        std::vector<std::string>{"/paths/docs/notes/budget_notes.md"});
+  CHECK(candidatePaths(*db, "\"music\"") == std::vector<std::string>{"/paths/music/mayonnaise.flac"});
+
+  // "/", "paths", "docs", "notes" and "music": each component is stored once
+  CHECK(rowCount(*db, "directory") == 5);
+
+  CHECK(db->tracksFile("/paths/docs/budget_report.pdf"));
+  CHECK_FALSE(db->tracksFile("/paths/docs"));
+  CHECK_FALSE(db->tracksFile("/elsewhere/budget_report.pdf"));
+  CHECK(db->listIndexedDirectoryFiles("/paths/docs") ==
+        std::unordered_set<fs::path>{"/paths/docs/budget_report.pdf"});
+}
+
+TEST_CASE("deleting a directory removes its subtree and only its subtree") {
+  ScratchDatabase db;
+
+  db->indexFiles({"/paths/docs", "/paths/docs/a.txt", "/paths/docs/deep/er/b.txt", "/paths/docs2/c.txt"});
+  db->indexEvents({{.type = FileEventType::Delete, .path = "/paths/docs"}});
+
+  CHECK_FALSE(db->tracksFile("/paths/docs"));
+  CHECK_FALSE(db->tracksFile("/paths/docs/deep/er/b.txt"));
+  CHECK(db->tracksFile("/paths/docs2/c.txt"));
+  CHECK(candidatePaths(*db, "\"txt\"") == std::vector<std::string>{"/paths/docs2/c.txt"});
+  CHECK(rowCount(*db, "directory") == 3);
+
+  // a deleted directory comes back under a new id
+  db->indexFiles({"/paths/docs/deep/er/b.txt"});
+  CHECK(candidatePaths(*db, "\"txt\"") ==
+        std::vector<std::string>{"/paths/docs/deep/er/b.txt", "/paths/docs2/c.txt"});
+}
+
+TEST_CASE("compaction drops directories left empty by file deletes") {
+  ScratchDatabase db;
+
+  db->indexFiles({"/paths/docs/deep/a.txt", "/paths/music/b.flac"});
+  db->deleteIndexedFiles({"/paths/docs/deep/a.txt"});
+  REQUIRE(rowCount(*db, "directory") == 5);
+
+  db->compact();
+
+  CHECK(rowCount(*db, "directory") == 3);
+  db->indexFiles({"/paths/docs/deep/a.txt"});
+  CHECK(candidatePaths(*db, "\"deep\"") == std::vector<std::string>{"/paths/docs/deep/a.txt"});
+}
+
+TEST_CASE("other connections follow directories deleted and recreated by the writer") {
+  ScratchDatabase db;
+
+  db->indexFiles({"/paths/build/a.o"});
+
+  FileIndexerDatabase reader;
+
+  REQUIRE(reader.tracksFile("/paths/build/a.o"));
+  REQUIRE(reader.listIndexedDirectoryFiles("/paths/build") ==
+          std::unordered_set<fs::path>{"/paths/build/a.o"});
+
+  // rm -rf build && mkdir build: the directory comes back under a new id
+  db->indexEvents({{.type = FileEventType::Delete, .path = "/paths/build"}});
+  db->indexFiles({"/paths/build/b.o"});
+
+  CHECK_FALSE(reader.tracksFile("/paths/build/a.o"));
+  CHECK(reader.tracksFile("/paths/build/b.o"));
+  CHECK(reader.listIndexedDirectoryFiles("/paths/build") ==
+        std::unordered_set<fs::path>{"/paths/build/b.o"});
+  CHECK(candidatePaths(reader, "\"build\"") == std::vector<std::string>{"/paths/build/b.o"});
+}
+
+TEST_CASE("incremental scans bulk-load a directory and a subtree") {
+  ScratchDatabase db;
+  auto const modified = std::chrono::file_clock::now();
+  auto modify = [&](const char *path, bool isDirectory, std::optional<int64_t> sizeBytes = std::nullopt) {
+    return FileEvent{.type = FileEventType::Modify,
+                     .path = path,
+                     .eventTime = modified,
+                     .isDirectory = isDirectory,
+                     .sizeBytes = sizeBytes};
+  };
+
+  db->indexEvents({modify("/paths", true), modify("/paths/docs", true),
+                   modify("/paths/docs/a.txt", false, 12), modify("/paths/docs/deep", true),
+                   modify("/paths/docs/deep/b.txt", false, 3), modify("/elsewhere", true)});
+
+  auto const entries = db->listIndexedDirectoryEntries("/paths/docs");
+
+  REQUIRE(entries.size() == 2);
+  CHECK(entries.at("a.txt").sizeBytes == 12);
+  CHECK_FALSE(entries.at("a.txt").isDirectory);
+  CHECK(entries.at("deep").isDirectory);
+  // stored as unix seconds, the unit the stat side is converted to before comparing
+  CHECK(entries.at("a.txt").lastModified == file_indexer::epochSeconds(modified));
+
+  CHECK(db->listIndexedSubdirectories("/paths") ==
+        std::unordered_set<fs::path>{"/paths/docs", "/paths/docs/deep"});
+  CHECK(db->listIndexedSubdirectories("/") ==
+        std::unordered_set<fs::path>{"/paths", "/paths/docs", "/paths/docs/deep", "/elsewhere"});
+  CHECK(db->listIndexedSubdirectories("/nowhere").empty());
+}
@@ -339,3 +339,42 @@ TEST_CASE("skeleton: short skeleton tokens are kept in phrase matches") {
 TEST_CASE("exact path component substring outranks fuzzy filename subsequence") {
   CHECK(rankOf("oled", "4k-oled/jellyfish-amoled.png") < rankOf("oled", "icons/SymbolEditor.svg"));
 }
+
+TEST_CASE("session: narrowing queries reuse the previous candidates") {
+  qualityEnv();
+  FileIndexerQueryEngine engine;
+  FileIndexerQueryEngine::SessionCandidates session;
+
+  auto paths = [](const std::vector<IndexerFileResult> &results) {
+    return results | std::views::transform([](const auto &result) { return result.path; }) |
+           std::ranges::to<std::vector>();
+  };
+  auto sameAsFresh = [&](std::string_view query) {
+    auto const results = engine.query(query, 10, {}, {}, &session);
+    return paths(results) == paths(FileIndexerQueryEngine{}.query(query, 10));
+  };
+
+  CHECK(sameAsFresh("serc"));
+  REQUIRE(session);
+  CHECK(session->candidates.size() == 8);
+
+  auto const fetchedAt = session->createdAt;
+
+  // answered from the candidates of "serc"
+  CHECK(sameAsFresh("sercom"));
+  CHECK(sameAsFresh("sercom3"));
+  REQUIRE(session);
+  CHECK(session->text == "sercom3");
+  CHECK(session->candidates.size() == 1);
+  CHECK(session->createdAt == fetchedAt);
+
+  // backspacing widens the query again: back to SQL
+  CHECK(sameAsFresh("serc"));
+  REQUIRE(session);
+  CHECK(session->candidates.size() == 8);
+  CHECK(session->createdAt != fetchedAt);
+
+  // a short word is not matched as a substring, nothing is kept for it
+  CHECK(sameAsFresh("serc h"));
+  CHECK_FALSE(session);
+}
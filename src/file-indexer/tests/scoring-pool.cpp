@@ -0,0 +1,72 @@
+#include <catch2/catch_test_macros.hpp>
+#include <atomic>
+#include <thread>
+#include <vector>
+#include "file-indexer/scoring-pool.hpp"
+
+using file_indexer::CancellationToken;
+using file_indexer::ScoringPool;
+
+TEST_CASE("ScoringPool runs every chunk exactly once") {
+  ScoringPool pool{3};
+  std::vector<std::atomic<int>> hits(64);
+
+  CHECK(pool.run(hits.size(), [&](size_t chunk) { hits[chunk].fetch_add(1); }));
+
+  for (const auto &hit : hits) {
+    CHECK(hit.load() == 1);
+  }
+}
+
+TEST_CASE("ScoringPool runs on the calling thread without workers") {
+  ScoringPool pool{0};
+  int sum = 0;
+
+  CHECK(pool.run(10, [&](size_t chunk) { sum += static_cast<int>(chunk); }));
+  CHECK(sum == 45);
+}
+
+TEST_CASE("ScoringPool skips chunks once the token is cancelled") {
+  ScoringPool pool{2};
+  auto token = CancellationToken::create();
+  std::atomic<int> ran = 0;
+
+  bool const completed = pool.run(
+      1000,
+      [&](size_t) {
+        if (ran.fetch_add(1) == 10) token.cancel();
+      },
+      token);
+
+  CHECK_FALSE(completed);
+  CHECK(ran.load() < 1000);
+}
+
+TEST_CASE("ScoringPool serves concurrent jobs") {
+  ScoringPool pool{2};
+  std::atomic<int> total = 0;
+  std::vector<std::thread> submitters;
+
+  for (int i = 0; i != 4; ++i) {
+    submitters.emplace_back([&] { pool.run(100, [&](size_t) { total.fetch_add(1); }); });
+  }
+
+  for (auto &submitter : submitters) {
+    submitter.join();
+  }
+
+  CHECK(total.load() == 400);
+}
+
+TEST_CASE("CancellationToken copies share their flag") {
+  CancellationToken const never;
+  auto token = CancellationToken::create();
+  auto const copy = token;
+
+  never.cancel();
+  CHECK_FALSE(never.isCancelled());
+
+  token.cancel();
+  CHECK(copy.isCancelled());
+  CHECK(copy == token);
+}
@@ -0,0 +1,53 @@
+#pragma once
+#include <chrono>
+#include <cstdlib>
+#include <filesystem>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include "file-indexer/file-indexer-db.hpp"
+
+// points the file indexer database at a scratch cache directory for the lifetime of the object
+class ScratchDatabase {
+public:
+  ScratchDatabase() : m_previousCacheHome(currentCacheHome()) {
+    auto const timestamp = std::chrono::system_clock::now().time_since_epoch().count();
+    m_root = std::filesystem::temp_directory_path() / ("vicinae-fi-db-" + std::to_string(timestamp));
+
+    std::error_code ec;
+    if (!std::filesystem::create_directory(m_root, ec)) {
+      throw std::runtime_error{"failed to create database test root"};
+    }
+
+    setenv("XDG_CACHE_HOME", (m_root / "cache").c_str(), 1);
+    m_db.emplace();
+    m_db->init();
+  }
+
+  ~ScratchDatabase() {
+    m_db.reset();
+
+    if (m_previousCacheHome) {
+      setenv("XDG_CACHE_HOME", m_previousCacheHome->c_str(), 1);
+    } else {
+      unsetenv("XDG_CACHE_HOME");
+    }
+
+    std::error_code ec;
+    std::filesystem::remove_all(m_root, ec);
+  }
+
+  FileIndexerDatabase &operator*() { return *m_db; }
+  FileIndexerDatabase *operator->() { return &*m_db; }
+
+private:
+  static std::optional<std::string> currentCacheHome() {
+    if (const char *value = std::getenv("XDG_CACHE_HOME")) return value;
+    return std::nullopt;
+  }
+
+  std::optional<std::string> m_previousCacheHome;
+  std::filesystem::path m_root;
+  std::optional<FileIndexerDatabase> m_db;
+};
@@ -0,0 +1,158 @@
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <array>
+#include <filesystem>
+#include <format>
+#include <map>
+#include <string>
+#include <vector>
+#include "file-indexer/file-indexer-db.hpp"
+#include "file-indexer/scan.hpp"
+#include "scratch-database.hpp"
+
+namespace fs = std::filesystem;
+
+namespace {
+
+std::map<std::string, int64_t> wordCounts(FileIndexerDatabase &db) {
+  std::map<std::string, int64_t> counts;
+  auto stmt = db.database().prepare("SELECT word, count FROM vocab_token");
+
+  while (stmt.step()) {
+    counts.emplace(stmt.columnText(0), stmt.columnInt64(1));
+  }
+
+  return counts;
+}
+
+std::map<std::string, int64_t> spellfixRanks(FileIndexerDatabase &db) {
+  std::map<std::string, int64_t> ranks;
+  auto stmt = db.database().prepare("SELECT word, rank FROM spellfix_vocab_vocab");
+
+  while (stmt.step()) {
+    ranks.emplace(stmt.columnText(0), stmt.columnInt64(1));
+  }
+
+  return ranks;
+}
+
+FileEvent fileEvent(FileEventType type, fs::path path) {
+  return {.type = type, .path = std::move(path), .eventTime = fs::file_time_type::clock::now()};
+}
+
+constexpr std::array SYLLABLES = {"ka", "lo", "mi", "ne", "pu", "ra", "si", "to", "vu", "ze", "qua", "dro"};
+
+// deterministic tree of `count` paths: 100 files per directory, with basenames drawn from a
+// vocabulary of a few thousand words so that most words are shared by many files
+std::vector<fs::path> syntheticTree(size_t count, std::string_view root) {
+  auto word = [](size_t seed) {
+    std::string text;
+    for (int i = 0; i != 3; ++i) {
+      text += SYLLABLES[seed % SYLLABLES.size()];
+      seed /= SYLLABLES.size();
+    }
+    return text;
+  };
+
+  std::vector<fs::path> paths;
+  paths.reserve(count);
+
+  for (size_t i = 0; i != count; ++i) {
+    auto const dir = i / 100;
+    auto const name = word(i * 7919 % 1728) + "_" + word(i % 1728) + ".txt";
+    paths.emplace_back(std::format("{}/d{}/d{}/{}", root, dir % 1000, dir, name));
+  }
+
+  return paths;
+}
+
+} // namespace
+
+TEST_CASE("spellfix vocabulary follows indexed files incrementally") {
+  ScratchDatabase db;
+
+  db->indexFiles(
+      {"/vocab/docs/budget_report.pdf", "/vocab/docs/budget_notes.md", "/vocab/music/mayonnaise.flac"});
+
+  auto counts = wordCounts(*db);
+  CHECK(counts["budget"] == 2);
+  CHECK(counts["report"] == 1);
+  CHECK(counts["mayonnaise"] == 1);
+  CHECK(spellfixRanks(*db)["budget"] == 2);
+
+  // re-indexing a known path updates the row without counting its words again
+  db->indexFiles({"/vocab/docs/budget_report.pdf"});
+  CHECK(wordCounts(*db)["budget"] == 2);
+
+  db->indexEvents({fileEvent(FileEventType::Modify, "/vocab/music/mayonnaise_live.flac"),
+                   fileEvent(FileEventType::Delete, "/vocab/docs")});
+
+  counts = wordCounts(*db);
+  CHECK_FALSE(counts.contains("budget"));
+  CHECK_FALSE(counts.contains("report"));
+  CHECK(counts["mayonnaise"] == 2);
+  CHECK(counts["live"] == 1);
+  CHECK_FALSE(spellfixRanks(*db).contains("budget"));
+
+  db->deleteIndexedFiles({"/vocab/music/mayonnaise.flac"});
+  CHECK(wordCounts(*db)["mayonnaise"] == 1);
+}
+
+TEST_CASE("incremental spellfix vocabulary matches a full rebuild") {
+  ScratchDatabase db;
+  auto const tree = syntheticTree(2000, "/vocab");
+
+  db->indexFiles(tree);
+  db->indexEvents({fileEvent(FileEventType::Delete, tree[150].parent_path()),
+                   fileEvent(FileEventType::Modify, "/vocab/extra/quadrotoka.txt")});
+  db->deleteIndexedFiles({tree[1234], tree[1500]});
+
+  auto const incrementalCounts = wordCounts(*db);
+  auto const incrementalRanks = spellfixRanks(*db);
+
+  db->rebuildSpellfixVocabulary();
+
+  CHECK(incrementalCounts == wordCounts(*db));
+  CHECK(incrementalRanks == spellfixRanks(*db));
+  CHECK_FALSE(db->spellfixSuggestions("quadrotoka", 5, false).empty());
+}
+
+TEST_CASE("deleting every indexed file empties the vocabulary") {
+  ScratchDatabase db;
+
+  db->indexFiles({"/vocab/docs/budget_report.pdf"});
+  REQUIRE(db->hasSpellfixVocabulary());
+
+  db->deleteAllIndexedFiles();
+
+  CHECK_FALSE(db->hasSpellfixVocabulary());
+  CHECK(spellfixRanks(*db).empty());
+}
+
+TEST_CASE("spellfix vocabulary rebuild and incremental maintenance", "[!benchmark]") {
+  static constexpr size_t TREE_SIZE = 1'000'000;
+  static constexpr size_t SCAN_BATCH_SIZE = 10'000;
+
+  ScratchDatabase db;
+  auto const tree = syntheticTree(TREE_SIZE, "/bench");
+
+  for (size_t i = 0; i < tree.size(); i += SCAN_BATCH_SIZE) {
+    db->indexFiles({tree.begin() + i, tree.begin() + std::min(i + SCAN_BATCH_SIZE, tree.size())});
+  }
+
+  auto const batch = syntheticTree(SCAN_BATCH_SIZE, "/bench-batch");
+
+  BENCHMARK("full rebuild over 1M paths") { db->rebuildSpellfixVocabulary(); };
+
+  // the same batch written and removed again, so every sample starts from the same tree
+  BENCHMARK("incremental: index and delete a 10k-path batch") {
+    db->indexFiles(batch);
+    db->deleteIndexedFiles({"/bench-batch"});
+  };
+
+  BENCHMARK("rebuild: index and delete a 10k-path batch, then rebuild") {
+    db->indexFiles(batch);
+    db->deleteIndexedFiles({"/bench-batch"});
+    db->rebuildSpellfixVocabulary();
+  };
+}
@@ -10,13 +10,33 @@ enum class Command : uint8_t {
   SetClipboard = 0x02,
 };
 
+// argument giving the helper the unix socket to pass large offers on, as memfds
+inline constexpr const char *FD_SOCKET_ARG = "--fd-socket";
+
 struct Offer {
   std::string mime_type;
   std::vector<uint8_t> data;
+  /**
+   * Too large to be inlined: `data` is empty and the data comes instead as a sealed memfd, sent on the fd
+   * socket ahead of the selection along with a `SpooledOffer` naming this offer.
+   */
+  bool spooled = false;
 };
 
 struct Selection {
+  // numbers the selections sent by the helper, from 1
+  uint64_t sequence = 0;
   std::vector<Offer> offers;
 };
 
+/**
+ * Payload of the message passing the memfd of a spooled offer: the memfd only goes to the offer it names,
+ * so that one lost or left over on the socket can't end up as the data of another offer.
+ */
+struct SpooledOffer {
+  uint64_t selection = 0;
+  // index in the offers of the selection
+  uint32_t offer = 0;
+};
+
 } // namespace clipboard_proto
@@ -0,0 +1,102 @@
+#pragma once
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <expected>
+#include <span>
+#include <vector>
+
+/**
+ * AES-256-GCM over data cut in fixed-size chunks, so that it can be encrypted and decrypted a chunk at a
+ * time and any chunk read on its own.
+ *
+ * The container is a header followed by every chunk, each sealed with its own tag:
+ *
+ *   magic (4) | version (1) | chunk size (4, LE) | salt (16) | nonce prefix (7)
+ *   chunk 0 ciphertext | tag (16) | ... | last chunk ciphertext (possibly shorter, or empty) | tag (16)
+ *
+ * Chunks are sealed with a key derived from the master key, the salt and the rest of the header, so that
+ * altering the header fails every chunk. Their nonce is the prefix, the chunk index and whether the chunk is
+ * the last one: chunks can't be reordered, and cutting the container short fails the new last chunk.
+ */
+namespace Crypto::AES256GCMStream {
+
+inline constexpr std::size_t HEADER_SIZE = 32;
+inline constexpr std::size_t TAG_SIZE = 16;
+inline constexpr std::size_t DEFAULT_CHUNK_SIZE = 64 * 1024;
+
+enum class DecryptError { InvalidKeySize, InvalidHeader, DataTooShort, CipherError, AuthFailed };
+enum class EncryptError { InvalidKeySize, CipherError };
+
+// Whether `data` starts like a container, without checking that it is a valid one.
+bool isContainer(std::span<const std::byte> data);
+
+std::uint64_t encryptedSize(std::uint64_t size, std::size_t chunkSize = DEFAULT_CHUNK_SIZE);
+
+class Encryptor {
+public:
+  static std::expected<Encryptor, EncryptError> create(std::span<const std::byte> key,
+                                                       std::size_t chunkSize = DEFAULT_CHUNK_SIZE);
+
+  std::span<const std::byte> header() const { return m_header; }
+
+  /**
+   * Appends to `out` the chunks `data` completes. The last chunk is held back until `finish`, which
+   * appends what is left, always at least one chunk.
+   */
+  bool update(std::span<const std::byte> data, std::vector<std::byte> &out);
+  bool finish(std::vector<std::byte> &out);
+
+private:
+  Encryptor() = default;
+  bool seal(bool last, std::vector<std::byte> &out);
+
+  std::array<std::byte, 32> m_key{};
+  std::array<std::byte, HEADER_SIZE> m_header{};
+  std::size_t m_chunkSize = 0;
+  std::uint32_t m_index = 0;
+  std::vector<std::byte> m_pending;
+};
+
+/**
+ * Decrypts the chunks of a container of known size, in any order. Does no IO: the caller reads the
+ * chunks it wants at `chunkOffset`.
+ */
+class Decryptor {
+public:
+  static std::expected<Decryptor, DecryptError> open(std::span<const std::byte> header,
+                                                     std::uint64_t containerSize,
+                                                     std::span<const std::byte> key);
+
+  // plaintext size
+  std::uint64_t size() const { return m_size; }
+  std::size_t chunkSize() const { return m_chunkSize; }
+  std::size_t chunkCount() const { return m_chunkCount; }
+
+  // where the chunk starts in the container, and how many bytes it takes there, tag included
+  std::uint64_t chunkOffset(std::size_t index) const;
+  std::size_t encryptedChunkSize(std::size_t index) const;
+
+  /**
+   * `out` must hold `encryptedChunkSize(index) - TAG_SIZE` bytes.
+   */
+  std::expected<void, DecryptError> decryptChunk(std::size_t index, std::span<const std::byte> encrypted,
+                                                 std::span<std::byte> out) const;
+
+private:
+  Decryptor() = default;
+
+  std::array<std::byte, 32> m_key{};
+  std::array<std::byte, 7> m_noncePrefix{};
+  std::size_t m_chunkSize = 0;
+  std::size_t m_chunkCount = 0;
+  std::uint64_t m_size = 0;
+};
+
+std::expected<std::vector<std::byte>, EncryptError> encrypt(std::span<const std::byte> data,
+                                                            std::span<const std::byte> key,
+                                                            std::size_t chunkSize = DEFAULT_CHUNK_SIZE);
+std::expected<std::vector<std::byte>, DecryptError> decrypt(std::span<const std::byte> encrypted,
+                                                            std::span<const std::byte> key);
+
+} // namespace Crypto::AES256GCMStream
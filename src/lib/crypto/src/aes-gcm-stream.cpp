@@ -0,0 +1,234 @@
+#include "crypto/aes-gcm-stream.hpp"
+#include "crypto/aes-gcm.hpp"
+#include "gcm-backend.hpp"
+#include <algorithm>
+#include <limits>
+#include <string_view>
+
+namespace Crypto::AES256GCMStream {
+
+static constexpr std::array<std::byte, 4> MAGIC = {std::byte{'V'}, std::byte{'S'}, std::byte{'E'},
+                                                   std::byte{'G'}};
+static constexpr std::byte VERSION{1};
+static constexpr std::size_t VERSION_OFFSET = 4;
+static constexpr std::size_t CHUNK_SIZE_OFFSET = 5;
+static constexpr std::size_t SALT_OFFSET = 9;
+static constexpr std::size_t SALT_SIZE = 16;
+static constexpr std::size_t NONCE_PREFIX_OFFSET = 25;
+static constexpr std::size_t NONCE_PREFIX_SIZE = 7;
+static constexpr std::size_t IV_SIZE = 12;
+// a chunk is held in memory whole, don't trust headers asking for more
+static constexpr std::size_t MAX_CHUNK_SIZE = 16 * 1024 * 1024;
+static constexpr std::uint64_t MAX_CHUNK_COUNT = std::numeric_limits<std::uint32_t>::max();
+static constexpr std::string_view KEY_LABEL = "vicinae aes-256-gcm stream";
+
+static_assert(NONCE_PREFIX_OFFSET + NONCE_PREFIX_SIZE == HEADER_SIZE);
+
+namespace {
+
+void storeU32(std::span<std::byte> out, std::uint32_t value) {
+  for (std::size_t i = 0; i != 4; ++i) {
+    out[i] = static_cast<std::byte>(value >> (8 * i));
+  }
+}
+
+std::uint32_t loadU32(std::span<const std::byte> in) {
+  std::uint32_t value = 0;
+  for (std::size_t i = 0; i != 4; ++i) {
+    value |= std::to_integer<std::uint32_t>(in[i]) << (8 * i);
+  }
+  return value;
+}
+
+std::array<std::byte, IV_SIZE> chunkNonce(std::span<const std::byte> prefix, std::uint32_t index, bool last) {
+  std::array<std::byte, IV_SIZE> nonce{};
+
+  std::ranges::copy(prefix, nonce.begin());
+  for (std::size_t i = 0; i != 4; ++i) {
+    nonce[NONCE_PREFIX_SIZE + i] = static_cast<std::byte>(index >> (8 * (3 - i)));
+  }
+  nonce.back() = std::byte{last};
+
+  return nonce;
+}
+
+// bound to the whole header, so that changing any of it changes the key
+bool deriveChunkKey(std::span<const std::byte> key, std::span<const std::byte> header,
+                    std::span<std::byte> out) {
+  std::vector<std::byte> info(KEY_LABEL.size() + HEADER_SIZE);
+
+  std::ranges::copy(std::as_bytes(std::span(KEY_LABEL)), info.begin());
+  std::ranges::copy(header.first(HEADER_SIZE), info.begin() + KEY_LABEL.size());
+
+  return detail::deriveKey(key, header.subspan(SALT_OFFSET, SALT_SIZE), info, out);
+}
+
+} // namespace
+
+bool isContainer(std::span<const std::byte> data) {
+  return data.size() >= HEADER_SIZE && std::ranges::equal(data.first(MAGIC.size()), MAGIC) &&
+         data[VERSION_OFFSET] == VERSION;
+}
+
+std::uint64_t encryptedSize(std::uint64_t size, std::size_t chunkSize) {
+  std::uint64_t const chunks = size == 0 ? 1 : (size + chunkSize - 1) / chunkSize;
+  return HEADER_SIZE + size + chunks * TAG_SIZE;
+}
+
+std::expected<Encryptor, EncryptError> Encryptor::create(std::span<const std::byte> key,
+                                                         std::size_t chunkSize) {
+  if (key.size() != AES256GCM::KEY_SIZE) return std::unexpected(EncryptError::InvalidKeySize);
+  if (chunkSize == 0 || chunkSize > MAX_CHUNK_SIZE) return std::unexpected(EncryptError::CipherError);
+
+  Encryptor encryptor;
+  std::span<std::byte> header(encryptor.m_header);
+
+  std::ranges::copy(MAGIC, header.begin());
+  header[VERSION_OFFSET] = VERSION;
+  storeU32(header.subspan(CHUNK_SIZE_OFFSET), static_cast<std::uint32_t>(chunkSize));
+
+  if (!detail::randomBytes(header.subspan(SALT_OFFSET))) return std::unexpected(EncryptError::CipherError);
+  if (!deriveChunkKey(key, header, encryptor.m_key)) return std::unexpected(EncryptError::CipherError);
+
+  encryptor.m_chunkSize = chunkSize;
+  encryptor.m_pending.reserve(chunkSize);
+
+  return encryptor;
+}
+
+bool Encryptor::update(std::span<const std::byte> data, std::vector<std::byte> &out) {
+  while (!data.empty()) {
+    if (m_pending.size() == m_chunkSize && !seal(false, out)) return false;
+
+    std::size_t const n = std::min(m_chunkSize - m_pending.size(), data.size());
+
+    m_pending.insert(m_pending.end(), data.begin(), data.begin() + n);
+    data = data.subspan(n);
+  }
+
+  return true;
+}
+
+bool Encryptor::finish(std::vector<std::byte> &out) { return seal(true, out); }
+
+bool Encryptor::seal(bool last, std::vector<std::byte> &out) {
+  if (m_index == MAX_CHUNK_COUNT) return false;
+
+  auto const nonce = chunkNonce(std::span(m_header).subspan(NONCE_PREFIX_OFFSET), m_index, last);
+  std::size_t const offset = out.size();
+
+  out.resize(offset + m_pending.size() + TAG_SIZE);
+
+  std::span<std::byte> const sealed = std::span(out).subspan(offset);
+
+  if (!detail::gcmEncrypt(m_key, nonce, m_pending, sealed.first(m_pending.size()), sealed.last(TAG_SIZE))) {
+    return false;
+  }
+
+  m_pending.clear();
+  ++m_index;
+
+  return true;
+}
+
+std::expected<Decryptor, DecryptError> Decryptor::open(std::span<const std::byte> header,
+                                                       std::uint64_t containerSize,
+                                                       std::span<const std::byte> key) {
+  if (key.size() != AES256GCM::KEY_SIZE) return std::unexpected(DecryptError::InvalidKeySize);
+  if (!isContainer(header)) return std::unexpected(DecryptError::InvalidHeader);
+
+  std::size_t const chunkSize = loadU32(header.subspan(CHUNK_SIZE_OFFSET));
+
+  if (chunkSize == 0 || chunkSize > MAX_CHUNK_SIZE) return std::unexpected(DecryptError::InvalidHeader);
+  if (containerSize < HEADER_SIZE + TAG_SIZE) return std::unexpected(DecryptError::DataTooShort);
+
+  std::uint64_t const body = containerSize - HEADER_SIZE;
+  std::uint64_t const stride = chunkSize + TAG_SIZE;
+  std::uint64_t const chunkCount = (body + stride - 1) / stride;
+
+  if (chunkCount > MAX_CHUNK_COUNT) return std::unexpected(DecryptError::InvalidHeader);
+  // a last chunk too short to even hold its tag
+  if (body - (chunkCount - 1) * stride < TAG_SIZE) return std::unexpected(DecryptError::DataTooShort);
+
+  Decryptor decryptor;
+
+  if (!deriveChunkKey(key, header, decryptor.m_key)) return std::unexpected(DecryptError::CipherError);
+
+  std::ranges::copy(header.subspan(NONCE_PREFIX_OFFSET, NONCE_PREFIX_SIZE), decryptor.m_noncePrefix.begin());
+  decryptor.m_chunkSize = chunkSize;
+  decryptor.m_chunkCount = chunkCount;
+  decryptor.m_size = body - chunkCount * TAG_SIZE;
+
+  return decryptor;
+}
+
+std::uint64_t Decryptor::chunkOffset(std::size_t index) const {
+  return HEADER_SIZE + static_cast<std::uint64_t>(index) * (m_chunkSize + TAG_SIZE);
+}
+
+std::size_t Decryptor::encryptedChunkSize(std::size_t index) const {
+  if (index + 1 != m_chunkCount) return m_chunkSize + TAG_SIZE;
+  return m_size - static_cast<std::uint64_t>(index) * m_chunkSize + TAG_SIZE;
+}
+
+std::expected<void, DecryptError> Decryptor::decryptChunk(std::size_t index, std::span<const std::byte> encrypted,
+                                                          std::span<std::byte> out) const {
+  if (index >= m_chunkCount || encrypted.size() != encryptedChunkSize(index)) {
+    return std::unexpected(DecryptError::DataTooShort);
+  }
+
+  std::size_t const size = encrypted.size() - TAG_SIZE;
+
+  if (out.size() < size) return std::unexpected(DecryptError::DataTooShort);
+
+  auto const nonce = chunkNonce(m_noncePrefix, static_cast<std::uint32_t>(index), index + 1 == m_chunkCount);
+
+  if (!detail::gcmDecrypt(m_key, nonce, encrypted.first(size), encrypted.last(TAG_SIZE), out.first(size))) {
+    return std::unexpected(DecryptError::AuthFailed);
+  }
+
+  return {};
+}
+
+std::expected<std::vector<std::byte>, EncryptError> encrypt(std::span<const std::byte> data,
+                                                            std::span<const std::byte> key,
+                                                            std::size_t chunkSize) {
+  auto encryptor = Encryptor::create(key, chunkSize);
+
+  if (!encryptor) return std::unexpected(encryptor.error());
+
+  std::vector<std::byte> out;
+
+  out.reserve(encryptedSize(data.size(), chunkSize));
+  out.assign(encryptor->header().begin(), encryptor->header().end());
+
+  if (!encryptor->update(data, out) || !encryptor->finish(out)) {
+    return std::unexpected(EncryptError::CipherError);
+  }
+
+  return out;
+}
+
+std::expected<std::vector<std::byte>, DecryptError> decrypt(std::span<const std::byte> encrypted,
+                                                            std::span<const std::byte> key) {
+  if (encrypted.size() < HEADER_SIZE) return std::unexpected(DecryptError::DataTooShort);
+
+  auto decryptor = Decryptor::open(encrypted.first(HEADER_SIZE), encrypted.size(), key);
+
+  if (!decryptor) return std::unexpected(decryptor.error());
+
+  std::vector<std::byte> out(decryptor->size());
+
+  for (std::size_t i = 0; i != decryptor->chunkCount(); ++i) {
+    auto const chunk = encrypted.subspan(decryptor->chunkOffset(i), decryptor->encryptedChunkSize(i));
+    auto const plain = std::span(out).subspan(i * decryptor->chunkSize(), chunk.size() - TAG_SIZE);
+
+    if (auto result = decryptor->decryptChunk(i, chunk, plain); !result) {
+      return std::unexpected(result.error());
+    }
+  }
+
+  return out;
+}
+
+} // namespace Crypto::AES256GCMStream
@@ -0,0 +1,124 @@
+#include <catch2/catch_test_macros.hpp>
+#include "crypto/aes-gcm-stream.hpp"
+#include "crypto/aes-gcm.hpp"
+#include <algorithm>
+#include <span>
+#include <vector>
+
+using namespace Crypto::AES256GCMStream;
+using Crypto::AES256GCM::generateKey;
+
+static std::vector<std::byte> pattern(size_t size) {
+  std::vector<std::byte> v(size);
+  for (size_t i = 0; i < size; ++i)
+    v[i] = static_cast<std::byte>(i * 31 + 7);
+  return v;
+}
+
+TEST_CASE("stream round trip recovers plaintext across chunk boundaries") {
+  auto key = generateKey();
+
+  for (size_t size : {0, 1, 63, 64, 65, 128, 1000}) {
+    auto plain = pattern(size);
+    auto enc = encrypt(plain, key, 64);
+    REQUIRE(enc.has_value());
+    REQUIRE(enc->size() == encryptedSize(size, 64));
+    REQUIRE(isContainer(*enc));
+    auto dec = decrypt(*enc, key);
+    REQUIRE(dec.has_value());
+    REQUIRE(*dec == plain);
+  }
+}
+
+TEST_CASE("stream encryption does not depend on how the input is split") {
+  auto key = generateKey();
+  auto plain = pattern(500);
+  auto encryptor = Encryptor::create(key, 64);
+  REQUIRE(encryptor.has_value());
+
+  std::vector<std::byte> out(encryptor->header().begin(), encryptor->header().end());
+  for (size_t offset = 0; offset < plain.size(); offset += 37) {
+    auto piece = std::span(plain).subspan(offset, std::min<size_t>(37, plain.size() - offset));
+    REQUIRE(encryptor->update(piece, out));
+  }
+  REQUIRE(encryptor->finish(out));
+
+  auto dec = decrypt(out, key);
+  REQUIRE(dec.has_value());
+  REQUIRE(*dec == plain);
+}
+
+TEST_CASE("any chunk decrypts on its own") {
+  auto key = generateKey();
+  auto plain = pattern(300);
+  auto enc = encrypt(plain, key, 64);
+  REQUIRE(enc.has_value());
+
+  auto decryptor = Decryptor::open(std::span(*enc).first(HEADER_SIZE), enc->size(), key);
+  REQUIRE(decryptor.has_value());
+  REQUIRE(decryptor->size() == 300);
+  REQUIRE(decryptor->chunkCount() == 5);
+  REQUIRE(decryptor->encryptedChunkSize(4) == 44 + TAG_SIZE);
+
+  for (size_t i : {3, 0, 4}) {
+    auto chunk = std::span(*enc).subspan(decryptor->chunkOffset(i), decryptor->encryptedChunkSize(i));
+    std::vector<std::byte> out(chunk.size() - TAG_SIZE);
+    REQUIRE(decryptor->decryptChunk(i, chunk, out).has_value());
+    REQUIRE(std::ranges::equal(out, std::span(plain).subspan(i * 64, out.size())));
+  }
+}
+
+TEST_CASE("stream wrong key fails authentication") {
+  auto enc = encrypt(pattern(100), generateKey(), 64);
+  REQUIRE(enc.has_value());
+  auto dec = decrypt(*enc, generateKey());
+  REQUIRE_FALSE(dec.has_value());
+  REQUIRE(dec.error() == DecryptError::AuthFailed);
+}
+
+TEST_CASE("tampered stream header is rejected") {
+  auto key = generateKey();
+  auto enc = encrypt(pattern(100), key, 64);
+  REQUIRE(enc.has_value());
+
+  // salt and nonce prefix: still a container, but every chunk fails
+  (*enc)[HEADER_SIZE - 1] ^= std::byte{0x01};
+  auto dec = decrypt(*enc, key);
+  REQUIRE_FALSE(dec.has_value());
+  REQUIRE(dec.error() == DecryptError::AuthFailed);
+
+  (*enc)[0] ^= std::byte{0x01};
+  REQUIRE_FALSE(isContainer(*enc));
+  REQUIRE(decrypt(*enc, key).error() == DecryptError::InvalidHeader);
+}
+
+TEST_CASE("stream truncated at a chunk boundary is rejected") {
+  auto key = generateKey();
+  auto enc = encrypt(pattern(256), key, 64);
+  REQUIRE(enc.has_value());
+  enc->resize(HEADER_SIZE + 2 * (64 + TAG_SIZE));
+  auto dec = decrypt(*enc, key);
+  REQUIRE_FALSE(dec.has_value());
+  REQUIRE(dec.error() == DecryptError::AuthFailed);
+}
+
+TEST_CASE("reordered stream chunks are rejected") {
+  auto key = generateKey();
+  auto enc = encrypt(pattern(256), key, 64);
+  REQUIRE(enc.has_value());
+
+  auto first = enc->begin() + HEADER_SIZE;
+  std::swap_ranges(first, first + 64 + TAG_SIZE, first + 64 + TAG_SIZE);
+  REQUIRE_FALSE(decrypt(*enc, key).has_value());
+}
+
+TEST_CASE("too-short stream input reports DataTooShort") {
+  auto key = generateKey();
+  REQUIRE(decrypt(std::vector<std::byte>(10), key).error() == DecryptError::DataTooShort);
+
+  auto enc = encrypt({}, key, 64);
+  REQUIRE(enc.has_value());
+  REQUIRE(enc->size() == HEADER_SIZE + TAG_SIZE);
+  enc->pop_back();
+  REQUIRE(decrypt(*enc, key).error() == DecryptError::DataTooShort);
+}
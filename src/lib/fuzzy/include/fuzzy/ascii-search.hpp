@@ -0,0 +1,197 @@
+#pragma once
+#include <array>
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+#if defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#define FZF_HAS_SSE2 1
+#endif
+
+#if defined(__GNUC__) && defined(__x86_64__)
+#include <immintrin.h>
+#define FZF_HAS_AVX2_DISPATCH 1
+#endif
+
+// Case-insensitive byte search over ASCII text, the building block of the subsequence prefilter that
+// runs before every fuzzy match. Bytes are compared 32 (AVX2, picked at runtime) or 16 (SSE2) at a
+// time, ASCII letters being folded by setting their 0x20 bit, and one at a time on other targets.
+namespace fzf::ascii {
+
+constexpr std::array<char, 256> LOWER = [] {
+  std::array<char, 256> table{};
+  for (int c = 0; c != 256; ++c) {
+    table[c] = static_cast<char>(c >= 'A' && c <= 'Z' ? c + ('a' - 'A') : c);
+  }
+  return table;
+}();
+
+inline char lower(char c) { return LOWER[static_cast<unsigned char>(c)]; }
+
+struct Span {
+  size_t first;
+  size_t last;
+};
+
+namespace detail {
+
+constexpr bool isLowerLetter(char c) { return c >= 'a' && c <= 'z'; }
+
+// searches [after + 1, end)
+inline size_t rfindScalar(std::string_view text, size_t after, size_t end, char c) {
+  for (size_t i = end; i > after + 1;) {
+    if (lower(text[--i]) == c) return i;
+  }
+  return std::string_view::npos;
+}
+
+// Greedy subsequence match over blocks of WIDTH bytes, the first block holding the current pattern
+// character being searched again for the next ones past the position just matched. The last block is
+// loaded so that it ends with the text, overlapping the one before, and its mask shifted back in
+// place, which spares reading past the end. Texts shorter than a block are left to FALLBACK.
+#define FZF_SUBSEQUENCE_LOOP(WIDTH, LOAD, MATCH, FALLBACK)                                                \
+  if (text.size() < WIDTH) return FALLBACK(text, pattern);                                                \
+                                                                                                          \
+  size_t pidx = 0;                                                                                        \
+  size_t first = std::string_view::npos;                                                                  \
+  char c = lower(pattern[0]);                                                                             \
+                                                                                                          \
+  for (size_t base = 0; base < text.size(); base += WIDTH) {                                              \
+    size_t const offset = std::min(base, text.size() - WIDTH);                                            \
+    size_t const shift = base - offset;                                                                   \
+    uint32_t eligible = ~uint32_t{0};                                                                     \
+                                                                                                          \
+    LOAD(offset);                                                                                         \
+                                                                                                          \
+    while (uint32_t const mask = ((MATCH) >> shift) & eligible) {                                         \
+      size_t const bit = std::countr_zero(mask);                                                          \
+                                                                                                          \
+      if (pidx == 0) first = base + bit;                                                                  \
+      if (++pidx == pattern.size()) return {first, base + bit};                                           \
+                                                                                                          \
+      c = lower(pattern[pidx]);                                                                           \
+      eligible = ~((uint32_t{2} << bit) - 1);                                                             \
+    }                                                                                                     \
+  }                                                                                                       \
+                                                                                                          \
+  return {std::string_view::npos, std::string_view::npos};
+
+inline Span subsequenceScalar(std::string_view text, std::string_view pattern) {
+  size_t pidx = 0;
+  size_t first = std::string_view::npos;
+
+  for (size_t i = 0; i < text.size(); ++i) {
+    if (lower(text[i]) != lower(pattern[pidx])) continue;
+    if (pidx == 0) first = i;
+    if (++pidx == pattern.size()) return {first, i};
+  }
+
+  return {std::string_view::npos, std::string_view::npos};
+}
+
+#ifdef FZF_HAS_SSE2
+inline uint32_t matchMask16(__m128i raw, __m128i folded, char c) {
+  return static_cast<uint32_t>(
+      _mm_movemask_epi8(_mm_cmpeq_epi8(isLowerLetter(c) ? folded : raw, _mm_set1_epi8(c))));
+}
+
+inline Span subsequenceSse2(std::string_view text, std::string_view pattern) {
+  __m128i raw;
+  __m128i folded;
+#define FZF_LOAD_BLOCK16(offset)                                                                          \
+  raw = _mm_loadu_si128(reinterpret_cast<const __m128i *>(text.data() + (offset)));                       \
+  folded = _mm_or_si128(raw, _mm_set1_epi8(0x20))
+
+  FZF_SUBSEQUENCE_LOOP(16, FZF_LOAD_BLOCK16, matchMask16(raw, folded, c), subsequenceScalar)
+
+#undef FZF_LOAD_BLOCK16
+}
+
+inline size_t rfindSse2(std::string_view text, size_t after, char c) {
+  size_t end = text.size();
+  __m128i const fold = _mm_set1_epi8(isLowerLetter(c) ? 0x20 : 0);
+
+  for (; end >= after + 1 + 16; end -= 16) {
+    __m128i const raw = _mm_loadu_si128(reinterpret_cast<const __m128i *>(text.data() + end - 16));
+    auto const mask =
+        static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_or_si128(raw, fold), _mm_set1_epi8(c))));
+    if (mask) return end + 15 - std::countl_zero(mask);
+  }
+
+  return rfindScalar(text, after, end, c);
+}
+#endif
+
+#ifdef FZF_HAS_AVX2_DISPATCH
+__attribute__((target("avx2"))) inline uint32_t matchMask32(__m256i raw, __m256i folded, char c) {
+  return static_cast<uint32_t>(
+      _mm256_movemask_epi8(_mm256_cmpeq_epi8(isLowerLetter(c) ? folded : raw, _mm256_set1_epi8(c))));
+}
+
+__attribute__((target("avx2"))) inline Span subsequenceAvx2(std::string_view text, std::string_view pattern) {
+  __m256i raw;
+  __m256i folded;
+  // a macro rather than a lambda, which would not inherit the avx2 target
+#define FZF_LOAD_BLOCK32(offset)                                                                          \
+  raw = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(text.data() + (offset)));                    \
+  folded = _mm256_or_si256(raw, _mm256_set1_epi8(0x20))
+
+  FZF_SUBSEQUENCE_LOOP(32, FZF_LOAD_BLOCK32, matchMask32(raw, folded, c), subsequenceSse2)
+
+#undef FZF_LOAD_BLOCK32
+}
+
+__attribute__((target("avx2"))) inline size_t rfindAvx2(std::string_view text, size_t after, char c) {
+  size_t end = text.size();
+  __m256i const fold = _mm256_set1_epi8(isLowerLetter(c) ? 0x20 : 0);
+
+  for (; end >= after + 1 + 32; end -= 32) {
+    __m256i const raw = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(text.data() + end - 32));
+    auto const mask = static_cast<uint32_t>(
+        _mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_or_si256(raw, fold), _mm256_set1_epi8(c))));
+    if (mask) return end - 1 - std::countl_zero(mask);
+  }
+
+  return rfindScalar(text, after, end, c);
+}
+
+inline bool hasAvx2() {
+  static bool const supported = __builtin_cpu_supports("avx2");
+  return supported;
+}
+#endif
+
+#undef FZF_SUBSEQUENCE_LOOP
+
+} // namespace detail
+
+// Where the first and last characters of `pattern` land when it is greedily matched as a subsequence
+// of `text`, or npos for both when it is not a subsequence. `pattern` cannot be empty.
+inline Span subsequence(std::string_view text, std::string_view pattern) {
+#ifdef FZF_HAS_AVX2_DISPATCH
+  if (detail::hasAvx2()) return detail::subsequenceAvx2(text, pattern);
+#endif
+#ifdef FZF_HAS_SSE2
+  return detail::subsequenceSse2(text, pattern);
+#else
+  return detail::subsequenceScalar(text, pattern);
+#endif
+}
+
+// Position of the last byte after `after` equal to `c` once lowercased, or npos. `c` has to be
+// lowercase.
+inline size_t rfind(std::string_view text, size_t after, char c) {
+#ifdef FZF_HAS_AVX2_DISPATCH
+  if (detail::hasAvx2()) return detail::rfindAvx2(text, after, c);
+#endif
+#ifdef FZF_HAS_SSE2
+  return detail::rfindSse2(text, after, c);
+#else
+  return detail::rfindScalar(text, after, text.size(), c);
+#endif
+}
+
+} // namespace fzf::ascii
@@ -10,6 +10,7 @@
 #include <string_view>
 #include <vector>
 #include "fuzzy/fzf.hpp"
+#include "fuzzy/ranking.hpp"
 #include "scored.hpp"
 
 namespace fuzzy {
@@ -97,8 +98,9 @@ inline Match scoreWeighted(const std::vector<OwnedWeightedField> &fields, const
   return detail::scoreFields(view, query);
 }
 
+// Item indices ranked by score; only the pages that are read get sorted (see Ranking).
 template <FuzzySearchableType T>
-void fuzzyFilter(std::span<const T> items, std::string_view text, std::vector<Scored<int>> &out) {
+void fuzzyFilter(std::span<const T> items, std::string_view text, Ranking<Scored<int>> &out) {
   out.clear();
   out.reserve(items.size());
 
@@ -114,8 +116,6 @@ void fuzzyFilter(std::span<const T> items, std::string_view text, std::vector<Sc
     Match const m = FuzzySearchable<T>::score(items[i], query);
     if (m.accepted()) { out.push_back({.data = i, .score = m.score}); }
   }
-
-  std::ranges::stable_sort(out, std::greater{});
 }
 
 } // namespace fuzzy
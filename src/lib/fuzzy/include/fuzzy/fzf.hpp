@@ -10,9 +10,11 @@
 #include <cstdint>
 #include <iterator>
 #include <ranges>
+#include <span>
 #include <string>
 #include <string_view>
 #include <vector>
+#include "fuzzy/ascii-search.hpp"
 #include "fuzzy/normalize.hpp"
 
 namespace fzf {
@@ -66,6 +68,31 @@ enum class Scheme { Default, Path, History };
 class Matcher;
 inline const Matcher &threadLocalMatcher();
 
+// A text prepared for matching against many queries: folded to ASCII once, with the bonus of every
+// folded byte classified up front, so matching it does neither again. Bonuses depend on the matcher
+// scheme; the default matcher is used unless one is given.
+struct PreparedText {
+  std::string folded;
+  // source byte offset per folded byte (+1 sentinel), empty when the text was ASCII already
+  std::vector<int> offsets;
+  std::vector<int8_t> bonus;
+
+  PreparedText() = default;
+  explicit PreparedText(std::string_view text, const Matcher &matcher = threadLocalMatcher());
+
+  bool empty() const { return folded.empty(); }
+};
+
+struct WeightedText {
+  const PreparedText *text;
+  float weight;
+};
+
+template <typename R>
+concept WeightedFields =
+    std::ranges::forward_range<R> && (std::same_as<std::ranges::range_value_t<R>, WeightedString> ||
+                                      std::same_as<std::ranges::range_value_t<R>, WeightedText>);
+
 // A query prepared for scoring many items: split into words, each with the best score it can
 // reach (`self`, the word matched against itself), so per-item scoring never recomputes it.
 // Ceilings depend on the matcher scheme; the default matcher is used unless one is given.
@@ -137,9 +164,7 @@ public:
     }
   }
 
-  template <std::ranges::forward_range R1, std::ranges::forward_range R2>
-    requires std::same_as<std::ranges::range_value_t<R1>, WeightedString> &&
-             std::same_as<std::ranges::range_value_t<R2>, WeightedString>
+  template <WeightedFields R1, WeightedFields R2>
   QueryScore score_query(R1 &&range1, R2 &&range2, const Query &query) const {
     int weightedSum = 0;
     int selfSum = 0;
@@ -148,8 +173,8 @@ public:
     for (const auto &word : query.words) {
       int maxWeighted = 0;
       int maxRaw = 0;
-      auto score = [&](const WeightedString &str) {
-        auto const r = match(str.str, word.text);
+      auto score = [&](const auto &str) {
+        auto const r = match(field_text(str), word.text);
         if (r.coherent) { maxRaw = std::max(maxRaw, r.score); }
         maxWeighted = std::max(maxWeighted, static_cast<int>(r.score * str.weight));
       };
@@ -171,9 +196,7 @@ public:
             .quality = minQuality};
   }
 
-  template <std::ranges::forward_range R>
-    requires std::same_as<std::ranges::range_value_t<R>, WeightedString>
-  QueryScore score_query(R &&weightedStrs, const Query &query) const {
+  template <WeightedFields R> QueryScore score_query(R &&weightedStrs, const Query &query) const {
     return score_query(std::forward<R>(weightedStrs), std::views::empty<WeightedString>, query);
   }
 
@@ -183,40 +206,20 @@ public:
   }
 
   Result match(std::string_view text, std::string_view pattern, bool with_pos = false) const {
-    const auto match = [&](std::string_view candidate) {
-      if (!has_non_ascii(text) && !has_non_ascii(candidate)) {
-        return match_ascii(text, candidate, with_pos);
-      }
-
-      fold_text(text);
-      const std::string_view ftext{m_fold_text.data(), m_fold_text.size()};
-      const std::string_view fpat = fold_pattern(candidate);
-
-      Result result = match_ascii(ftext, fpat, with_pos);
-      if (result.matched()) {
-        result.start = m_fold_off[result.start];
-        result.end = m_fold_off[result.end];
-        for (int &position : result.positions) {
-          position = m_fold_off[position];
-        }
-      }
-      return result;
-    };
+    if (!has_non_ascii(text)) { return match_folded(text, {}, {}, pattern, with_pos); }
 
-    Result best = match(pattern);
-    if (!has_non_ascii(pattern) || !needsTransliteration(pattern)) { return best; }
-
-    for (const auto scheme : {TranslitScheme::Primary, TranslitScheme::Alternate}) {
-      if (!transliterate(pattern, m_translit_pattern, scheme) || m_translit_pattern == pattern) { continue; }
-
-      Result candidate = match(m_translit_pattern);
-      if (candidate.score > best.score) { best = std::move(candidate); }
-    }
+    fold_text(text);
+    return match_folded({m_fold_text.data(), m_fold_text.size()}, m_fold_off, {}, pattern, with_pos);
+  }
 
-    return best;
+  Result match(const PreparedText &text, std::string_view pattern, bool with_pos = false) const {
+    return match_folded(text.folded, text.offsets, text.bonus, pattern, with_pos);
   }
 
-  Result match_ascii(std::string_view text, std::string_view pattern, bool with_pos = false) const {
+  // `bonus`, when given, holds the bonus of every byte of `text` (see PreparedText); bytes are
+  // classified on the fly otherwise.
+  Result match_ascii(std::string_view text, std::string_view pattern, bool with_pos = false,
+                     std::span<const int8_t> bonus = {}) const {
     const int M = static_cast<int>(pattern.length());
     const int N = static_cast<int>(text.length());
 
@@ -240,7 +243,7 @@ public:
     int max_score_pos = 0;
     int pidx = 0;
     int last_idx = 0;
-    char pchar0 = std::tolower(static_cast<unsigned char>(pattern[0]));
+    char pchar0 = ascii::lower(pattern[0]);
     char pchar = pchar0;
     int prev_h0 = 0;
     CharClass prev_class = m_initial_char_class;
@@ -248,26 +251,31 @@ public:
 
     for (int off = 0; off < search_len; ++off) {
       char c = text[min_idx + off];
-      T[off] = std::tolower(static_cast<unsigned char>(c));
+      T[off] = ascii::lower(c);
 
-      CharClass cls = char_class_of(c);
-      int bonus = bonus_matrix_[static_cast<int>(prev_class)][static_cast<int>(cls)];
-      B[off] = bonus;
-      prev_class = cls;
+      int bonus_at = 0;
+      if (bonus.empty()) {
+        CharClass cls = char_class_of(c);
+        bonus_at = bonus_matrix_[static_cast<int>(prev_class)][static_cast<int>(cls)];
+        prev_class = cls;
+      } else {
+        bonus_at = bonus[min_idx + off];
+      }
+      B[off] = bonus_at;
 
       // Track first occurrence of each pattern character
       if (T[off] == pchar) {
         if (pidx < M) {
           F[pidx] = off;
           pidx++;
-          pchar = pidx < M ? std::tolower(static_cast<unsigned char>(pattern[pidx])) : pchar;
+          pchar = pidx < M ? ascii::lower(pattern[pidx]) : pchar;
         }
         last_idx = off;
       }
 
       // Calculate score for first pattern character
       if (T[off] == pchar0) {
-        int score = SCORE_MATCH + bonus * BONUS_FIRST_CHAR_MULTIPLIER;
+        int score = SCORE_MATCH + bonus_at * BONUS_FIRST_CHAR_MULTIPLIER;
         H0[off] = score;
         C0[off] = 1;
         if (M == 1 && score > max_score) {
@@ -310,7 +318,7 @@ public:
     // Fill remaining rows
     for (int i = 1; i < M; ++i) {
       const int f = F[i];
-      const char pc = std::tolower(static_cast<unsigned char>(pattern[i]));
+      const char pc = ascii::lower(pattern[i]);
       const int row = i * width;
       in_gap = false;
 
@@ -419,6 +427,40 @@ public:
   }
 
 private:
+  friend struct PreparedText;
+
+  static std::string_view field_text(const WeightedString &field) { return field.str; }
+  static const PreparedText &field_text(const WeightedText &field) { return *field.text; }
+
+  // Matches a pattern against folded text, mapping positions back through `offsets` when given.
+  // Patterns in scripts that transliterate are matched in their latin spellings as well.
+  Result match_folded(std::string_view text, std::span<const int> offsets, std::span<const int8_t> bonus,
+                      std::string_view pattern, bool with_pos) const {
+    const auto match = [&](std::string_view candidate) {
+      Result result = match_ascii(text, fold_pattern(candidate), with_pos, bonus);
+      if (result.matched() && !offsets.empty()) {
+        result.start = offsets[result.start];
+        result.end = offsets[result.end];
+        for (int &position : result.positions) {
+          position = offsets[position];
+        }
+      }
+      return result;
+    };
+
+    Result best = match(pattern);
+    if (!has_non_ascii(pattern) || !needsTransliteration(pattern)) { return best; }
+
+    for (const auto scheme : {TranslitScheme::Primary, TranslitScheme::Alternate}) {
+      if (!transliterate(pattern, m_translit_pattern, scheme) || m_translit_pattern == pattern) { continue; }
+
+      Result candidate = match(m_translit_pattern);
+      if (candidate.score > best.score) { best = std::move(candidate); }
+    }
+
+    return best;
+  }
+
   static bool has_non_ascii(std::string_view s) {
     unsigned char acc = 0;
     for (const char c : s) {
@@ -530,41 +572,18 @@ private:
     return 0;
   }
 
-  // ASCII fast path to find pattern boundaries
+  // Subsequence prefilter: the window of text the pattern can match in, or {-1, -1} when it cannot
   std::pair<int, int> ascii_fuzzy_index(std::string_view text, std::string_view pattern) const {
     if (pattern.empty()) return {0, static_cast<int>(text.length())};
 
-    int first_idx = 0;
-    int last_idx = 0;
-    size_t idx = 0;
-
-    for (size_t pidx = 0; pidx < pattern.length(); ++pidx) {
-      char p = pattern[pidx];
-      char p_lower = std::tolower(static_cast<unsigned char>(p));
-      char p_upper = std::toupper(static_cast<unsigned char>(p));
-
-      // Find next occurrence in either case
-      size_t lower_pos = text.find(p_lower, idx);
-      size_t upper_pos = text.find(p_upper, idx);
-      size_t found = std::min(lower_pos, upper_pos);
-
-      if (found == std::string_view::npos) { return {-1, -1}; }
-
-      if (pidx == 0 && found > 0) { first_idx = static_cast<int>(found) - 1; }
-      last_idx = static_cast<int>(found);
-      idx = found + 1;
-    }
-
-    // Find last occurrence of last character
-    char last_lower = std::tolower(static_cast<unsigned char>(pattern.back()));
-    char last_upper = std::toupper(static_cast<unsigned char>(pattern.back()));
+    const auto [first, found] = ascii::subsequence(text, pattern);
+    if (first == std::string_view::npos) { return {-1, -1}; }
 
-    for (int i = static_cast<int>(text.length()) - 1; i > last_idx; --i) {
-      char c = text[i];
-      if (c == last_lower || c == last_upper) { return {first_idx, i + 1}; }
-    }
+    // extend to the last occurrence of the last character
+    const size_t last = ascii::rfind(text, found, ascii::lower(pattern.back()));
+    const size_t last_idx = last == std::string_view::npos ? found : last;
 
-    return {first_idx, last_idx + 1};
+    return {first > 0 ? static_cast<int>(first) - 1 : 0, static_cast<int>(last_idx) + 1};
   }
 
   size_t cacheKey(std::string_view txt, std::string_view pattern) const {
@@ -612,6 +631,26 @@ inline const Matcher &threadLocalMatcher() {
   return matcher;
 }
 
+inline PreparedText::PreparedText(std::string_view text, const Matcher &matcher) {
+  if (Matcher::has_non_ascii(text)) {
+    matcher.fold_text(text);
+    folded.assign(matcher.m_fold_text.begin(), matcher.m_fold_text.end());
+    offsets = matcher.m_fold_off;
+  } else {
+    folded = text;
+  }
+
+  bonus.reserve(folded.size());
+
+  CharClass prev_class = matcher.m_initial_char_class;
+  for (const char c : folded) {
+    const CharClass cls = matcher.char_class_of(c);
+    const int value = matcher.bonus_matrix_[static_cast<int>(prev_class)][static_cast<int>(cls)];
+    bonus.push_back(static_cast<int8_t>(value));
+    prev_class = cls;
+  }
+}
+
 inline Query::Query(std::string_view text, const Matcher &matcher) : text(text) {
   for (auto &&part : std::views::split(std::string_view{this->text}, std::string_view{" "})) {
     std::string_view const word{part};
@@ -0,0 +1,134 @@
+#pragma once
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <numeric>
+#include <span>
+#include <utility>
+#include <vector>
+
+namespace fuzzy {
+
+// Entries ordered by `Compare` (best first, descending scores by default), ranked lazily: reading an
+// entry ranks the page it falls in, and only that page is sorted. The page is selected out of the
+// remaining entries in linear time. Showing the first rows of a large result set therefore no longer
+// costs a sort of all of it. Ties keep their insertion order, exactly as with a stable sort, so
+// results do not flicker from one keystroke to the next.
+template <typename T, typename Compare = std::greater<>> class Ranking {
+public:
+  static constexpr size_t PAGE_SIZE = 64;
+
+  Ranking() = default;
+  explicit Ranking(Compare comp) : m_comp(std::move(comp)) {}
+
+  void setCompare(Compare comp) {
+    m_comp = std::move(comp);
+    m_ranked = 0;
+  }
+
+  void clear() {
+    m_entries.clear();
+    m_ranked = 0;
+  }
+
+  void reserve(size_t count) { m_entries.reserve(count); }
+
+  // Entries added once some were read are ranked along with the others on the next read, exactly as if
+  // they had all been added up front: ranking a page keeps ties in insertion order.
+  template <typename... Args> T &emplace_back(Args &&...args) {
+    m_ranked = 0;
+    return m_entries.emplace_back(std::forward<Args>(args)...);
+  }
+  void push_back(T entry) {
+    m_ranked = 0;
+    m_entries.push_back(std::move(entry));
+  }
+
+  // Ranks every entry by `comp` rather than `Compare`, as a stable sort would. Only before reading.
+  template <typename C> void sortBy(C comp) {
+    std::ranges::stable_sort(m_entries, comp);
+    m_ranked = m_entries.size();
+  }
+
+  size_t size() const { return m_entries.size(); }
+  bool empty() const { return m_entries.empty(); }
+
+  const T &operator[](size_t i) const {
+    rank(i + 1);
+    return m_entries[i];
+  }
+
+  // The `count` best entries, in order.
+  std::span<const T> top(size_t count) const {
+    count = std::min(count, m_entries.size());
+    rank(count);
+    return {m_entries.data(), count};
+  }
+
+  std::span<const T> all() const { return top(m_entries.size()); }
+
+  auto begin() const { return all().begin(); }
+  auto end() const { return all().end(); }
+
+private:
+  // ranks pages until the first `count` entries are in order
+  void rank(size_t count) const {
+    if (count <= m_ranked) return;
+
+    size_t const rest = m_entries.size() - m_ranked;
+    size_t const pageEnd = std::min(m_entries.size(), (count + PAGE_SIZE - 1) / PAGE_SIZE * PAGE_SIZE);
+    size_t const selected = pageEnd - m_ranked;
+    auto const first = m_entries.begin() + static_cast<std::ptrdiff_t>(m_ranked);
+
+    // the unranked entries are still in insertion order
+    if (selected == rest) {
+      std::stable_sort(first, m_entries.end(), m_comp);
+      m_ranked = pageEnd;
+      return;
+    }
+
+    // a strict total order: ties broken by position, which is insertion order
+    auto const before = [&](uint32_t a, uint32_t b) {
+      const T &lhs = first[a];
+      const T &rhs = first[b];
+      if (m_comp(lhs, rhs)) return true;
+      if (m_comp(rhs, lhs)) return false;
+      return a < b;
+    };
+
+    m_order.resize(rest);
+    std::iota(m_order.begin(), m_order.end(), uint32_t{0});
+    std::nth_element(m_order.begin(), m_order.begin() + static_cast<std::ptrdiff_t>(selected), m_order.end(),
+                     before);
+    std::sort(m_order.begin(), m_order.begin() + static_cast<std::ptrdiff_t>(selected), before);
+
+    // the page in rank order, then everything else in the order it was in
+    m_picked.assign(rest, false);
+    m_scratch.clear();
+    m_scratch.reserve(rest);
+
+    for (size_t i = 0; i != selected; ++i) {
+      m_picked[m_order[i]] = true;
+      m_scratch.emplace_back(std::move(first[m_order[i]]));
+    }
+    for (size_t i = 0; i != rest; ++i) {
+      if (!m_picked[i]) m_scratch.emplace_back(std::move(first[i]));
+    }
+
+    std::ranges::move(m_scratch, first);
+    m_ranked = pageEnd;
+  }
+
+  // reading ranks in place, the order of the entries is not observable before
+  mutable std::vector<T> m_entries;
+  mutable size_t m_ranked = 0;
+  Compare m_comp;
+
+  // kept around so that ranking a page does not allocate once warm
+  mutable std::vector<uint32_t> m_order;
+  mutable std::vector<bool> m_picked;
+  mutable std::vector<T> m_scratch;
+};
+
+} // namespace fuzzy
@@ -1,6 +1,7 @@
 #include <catch2/catch_test_macros.hpp>
 #include "fuzzy/fzf.hpp"
 #include "fuzzy/fuzzy-searchable.hpp"
+#include "fuzzy/ranking.hpp"
 #include "order-helpers.hpp"
 
 TEST_CASE("match: exact substring scores positive and matches range") {
@@ -214,3 +215,123 @@ TEST_CASE("match: coherence separates substrings/abbreviations/acronyms from sca
   REQUIRE_FALSE(fuzzy::scoreWeighted({{"Play this game on Steam", 1.0}}, fuzzy::Query{"time"}).accepted());
   REQUIRE(fuzzy::scoreWeighted({{"Play this game on Steam", 1.0}}, fuzzy::Query{"steam"}).accepted());
 }
+
+TEST_CASE("ascii::subsequence: block searches agree with the scalar one across block boundaries") {
+  // the texts straddle the 16 and 32 byte blocks, and the overlapping last block of each
+  for (size_t size : {1, 15, 16, 17, 31, 32, 33, 47, 63, 64, 65, 100}) {
+    std::string text(size, '.');
+    for (size_t i = 0; i < size; i += 7) {
+      text[i] = "aZ/`@_9q"[(i / 7) % 8];
+    }
+
+    for (std::string_view pattern :
+         {"a", "z", "AZ", "/", "`", "@", "q9", "a/", "zq", "AZ/`@_9q", "x", "aa"}) {
+      const auto simd = fzf::ascii::subsequence(text, pattern);
+      const auto scalar = fzf::ascii::detail::subsequenceScalar(text, pattern);
+
+      INFO(size << " " << pattern);
+      REQUIRE(simd.first == scalar.first);
+      REQUIRE(simd.last == scalar.last);
+    }
+  }
+
+  REQUIRE(fzf::ascii::subsequence("src/Lib/FUZZY", "lfz").last == 10);
+  REQUIRE(fzf::ascii::subsequence("src/lib/fuzzy/include/fuzzy/fzf.hpp", "fzfh").first == 8);
+  REQUIRE(fzf::ascii::subsequence("src/lib/fuzzy/include/fuzzy/fzf.hpp", "hpx").first ==
+          std::string_view::npos);
+}
+
+TEST_CASE("match: prepared texts match like the texts they were prepared from") {
+  const auto &m = fzf::threadLocalMatcher();
+
+  for (std::string_view text : {"Open File Manager", "src/lib/fuzzy/fzf.hpp", "Café Society",
+                                "Łódź Express", "Привет мир", "Start Input Method"}) {
+    const fzf::PreparedText prepared{text};
+
+    for (std::string_view pattern : {"file", "fzf", "cafe", "lodz", "privet", "мир", "time", "sim"}) {
+      const auto raw = m.match(text, pattern, true);
+      const auto fast = m.match(prepared, pattern, true);
+
+      INFO(text << " " << pattern);
+      REQUIRE(fast.score == raw.score);
+      REQUIRE(fast.start == raw.start);
+      REQUIRE(fast.end == raw.end);
+      REQUIRE(fast.coherent == raw.coherent);
+      REQUIRE(fast.positions == raw.positions);
+    }
+  }
+
+  const fzf::PreparedText title{"Firefox"};
+  const fzf::PreparedText subtitle{"Web Browser"};
+  const fzf::Query query{"browser"};
+  const std::initializer_list<fzf::WeightedText> prepared = {{&title, 1.0f}, {&subtitle, 0.5f}};
+  const std::initializer_list<fzf::WeightedString> raw = {{"Firefox", 1.0f}, {"Web Browser", 0.5f}};
+
+  REQUIRE(m.score_query(prepared, query).score == m.score_query(raw, query).score);
+  REQUIRE(m.score_query(prepared, query).quality == m.score_query(raw, query).quality);
+}
+
+TEST_CASE("ranking: pages read in any order come out as a stable sort would order them") {
+  std::vector<Scored<int>> entries;
+  for (int i = 0; i != 1000; ++i) {
+    // plenty of ties, which have to keep their insertion order
+    entries.push_back({.data = i, .score = (i * 7919) % 37});
+  }
+
+  auto expected = entries;
+  std::ranges::stable_sort(expected, std::greater{});
+
+  auto const sameAt = [&](const fuzzy::Ranking<Scored<int>> &ranking, size_t i) {
+    return ranking[i].data == expected[i].data;
+  };
+
+  fuzzy::Ranking<Scored<int>> ranking;
+  for (const auto &entry : entries) {
+    ranking.push_back(entry);
+  }
+
+  REQUIRE(ranking.size() == entries.size());
+  REQUIRE(sameAt(ranking, 0));
+  REQUIRE(sameAt(ranking, 200));
+  REQUIRE(sameAt(ranking, 63));
+  REQUIRE(sameAt(ranking, 64));
+  REQUIRE(sameAt(ranking, 999));
+
+  for (size_t i = 0; i != entries.size(); ++i) {
+    REQUIRE(sameAt(ranking, i));
+  }
+
+  fuzzy::Ranking<Scored<int>> other;
+  for (const auto &entry : entries) {
+    other.push_back(entry);
+  }
+
+  REQUIRE(std::ranges::equal(other.top(10), std::span{expected}.first(10),
+                             [](const auto &a, const auto &b) { return a.data == b.data; }));
+  REQUIRE(std::ranges::equal(other, expected, [](const auto &a, const auto &b) { return a.data == b.data; }));
+}
+
+TEST_CASE("ranking: entries added after reading rank as if they had been there from the start") {
+  std::vector<Scored<int>> entries;
+  for (int i = 0; i != 1000; ++i) {
+    entries.push_back({.data = i, .score = (i * 7919) % 37});
+  }
+
+  auto expected = entries;
+  std::ranges::stable_sort(expected, std::greater{});
+
+  fuzzy::Ranking<Scored<int>> ranking;
+  for (size_t batch = 0; batch != 10; ++batch) {
+    for (size_t i = batch * 100; i != (batch + 1) * 100; ++i) {
+      ranking.push_back(entries[i]);
+    }
+    // reads a page, or all of it, before the next batch comes in
+    if (batch % 3 == 0) {
+      (void)ranking.top(10);
+    } else if (batch % 3 == 1) {
+      (void)ranking.all();
+    }
+  }
+
+  REQUIRE(std::ranges::equal(ranking, expected, [](const auto &a, const auto &b) { return a.data == b.data; }));
+}
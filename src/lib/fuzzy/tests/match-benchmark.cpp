@@ -0,0 +1,96 @@
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <array>
+#include <format>
+#include <random>
+#include <string>
+#include <string_view>
+#include <vector>
+#include "fuzzy/fzf.hpp"
+
+namespace {
+
+constexpr std::array<std::string_view, 16> WORDS = {
+    "home",    "user",   "documents", "projects", "src",      "lib",   "config",    "share",
+    "release", "report", "budget",    "photos",   "vicinae",  "cache", "extension", "notes",
+};
+constexpr std::array<std::string_view, 6> EXTENSIONS = {".pdf", ".cpp", ".hpp", ".png", ".md", ".json"};
+
+std::vector<std::string> syntheticPaths(size_t count) {
+  std::mt19937 rng{42};
+  std::vector<std::string> paths;
+
+  paths.reserve(count);
+  for (size_t i = 0; i != count; ++i) {
+    std::string path;
+    size_t const depth = 3 + rng() % 6;
+
+    for (size_t d = 0; d != depth; ++d) {
+      path += std::format("/{}", WORDS[rng() % WORDS.size()]);
+    }
+    path += std::format("_{}{}", rng() % 1000, EXTENSIONS[rng() % EXTENSIONS.size()]);
+    paths.emplace_back(std::move(path));
+  }
+
+  return paths;
+}
+
+std::vector<std::string> syntheticTitles(size_t count) {
+  std::mt19937 rng{7};
+  std::vector<std::string> titles;
+
+  titles.reserve(count);
+  for (size_t i = 0; i != count; ++i) {
+    std::string title;
+    size_t const words = 1 + rng() % 4;
+
+    for (size_t w = 0; w != words; ++w) {
+      auto word = std::string{WORDS[rng() % WORDS.size()]};
+      if (rng() % 2) word[0] -= 'a' - 'A';
+      title += (w ? " " : "") + word;
+    }
+    titles.emplace_back(std::move(title));
+  }
+
+  return titles;
+}
+
+template <typename Search>
+int countMatches(const std::vector<std::string> &corpus, std::string_view pattern, Search search) {
+  int matched = 0;
+  for (const auto &text : corpus) {
+    matched += search(text, pattern).first != std::string_view::npos;
+  }
+  return matched;
+}
+
+int sumScores(const std::vector<std::string> &corpus, std::string_view pattern) {
+  const auto &matcher = fzf::threadLocalMatcher();
+  int sum = 0;
+  for (const auto &text : corpus) {
+    sum += matcher.match(text, pattern).score;
+  }
+  return sum;
+}
+
+void benchmarkCorpus(std::string_view name, const std::vector<std::string> &corpus) {
+  for (std::string_view pattern : {"conf", "vicrep", "xqz"}) {
+    REQUIRE(countMatches(corpus, pattern, fzf::ascii::subsequence) ==
+            countMatches(corpus, pattern, fzf::ascii::detail::subsequenceScalar));
+
+    BENCHMARK(std::format("{}, {}: scalar prefilter", name, pattern)) {
+      return countMatches(corpus, pattern, fzf::ascii::detail::subsequenceScalar);
+    };
+    BENCHMARK(std::format("{}, {}: block prefilter", name, pattern)) {
+      return countMatches(corpus, pattern, fzf::ascii::subsequence);
+    };
+    BENCHMARK(std::format("{}, {}: match", name, pattern)) { return sumScores(corpus, pattern); };
+  }
+}
+
+} // namespace
+
+TEST_CASE("subsequence prefilter and fuzzy match throughput", "[!benchmark]") {
+  benchmarkCorpus("1M paths", syntheticPaths(1'000'000));
+  benchmarkCorpus("10k titles", syntheticTitles(10'000));
+}
@@ -0,0 +1,57 @@
+#pragma once
+#include "glyph/glyph.hpp"
+#include <cstdint>
+#include <span>
+#include <string_view>
+
+// Character masks of the searchable text of every glyph, generated along with the table, which let a
+// fuzzy search skip most glyphs without matching them: a pattern can only be a subsequence of a text
+// whose mask covers its own.
+namespace glyph {
+
+// One bit per ASCII letter (case folded) and digit, the other ASCII bytes sharing the remaining bits.
+using CharMask = std::uint64_t;
+
+constexpr CharMask ALL_CHARS = ~CharMask{0};
+
+namespace detail {
+
+constexpr int charBit(unsigned char c) {
+  if (c >= 'A' && c <= 'Z') c += 'a' - 'A';
+  if (c >= 'a' && c <= 'z') return c - 'a';
+  if (c >= '0' && c <= '9') return 26 + (c - '0');
+  return 36 + c % 28;
+}
+
+constexpr CharMask mask(std::string_view text, CharMask nonAscii) {
+  CharMask m = 0;
+  for (const char ch : text) {
+    auto const c = static_cast<unsigned char>(ch);
+    if (c >= 0x80) return nonAscii;
+    m |= CharMask{1} << charBit(c);
+  }
+  return m;
+}
+
+} // namespace detail
+
+// Fuzzy matching folds non-ASCII text (diacritics, other scripts) before matching, so a text holding
+// any non-ASCII byte could match anything and gets every bit.
+constexpr CharMask textMask(std::string_view text) { return detail::mask(text, ALL_CHARS); }
+
+// Non-ASCII patterns are matched through their transliterations as well, they are never ruled out.
+constexpr CharMask patternMask(std::string_view pattern) { return detail::mask(pattern, 0); }
+
+constexpr bool covers(CharMask text, CharMask pattern) { return (text & pattern) == pattern; }
+
+struct SearchMasks {
+  CharMask name;
+  CharMask category;
+  std::span<const CharMask> keywords;
+  // union of all of the above
+  CharMask all;
+};
+
+const SearchMasks &searchMasks(const Item &item);
+
+} // namespace glyph
@@ -11,7 +11,8 @@ import { parseEmoji } from './src/emoji.ts';
 import { parseEmojiProperties, emitEmojiProperties } from './src/emoji-properties.ts';
 import { buildSymbols } from './src/curate.ts';
 import { CATEGORIES, type Item } from './src/categories.ts';
-import { emitCpp, emitHpp, type Provenance } from './src/emit.ts';
+import { emitCpp, emitHpp, layoutItems, type Provenance } from './src/emit.ts';
+import { emitSearchIndex } from './src/search-index.ts';
 
 function validate(all: Item[]): void {
 	const seen = new Set<string>();
@@ -58,6 +59,7 @@ const outputs: Record<string, string> = {
 	'include/glyph/glyph.hpp': emitHpp(provenance),
 	'src/glyph.cpp': emitCpp(symbols, emojis, provenance),
 	'src/emoji-properties.cpp': emitEmojiProperties(emojiProps, provenance),
+	'src/search-index.cpp': emitSearchIndex(layoutItems(symbols, emojis), provenance),
 };
 for (const [rel, content] of Object.entries(outputs)) writeFileSync(join(LIB_DIR, rel), content);
 
@@ -69,6 +71,7 @@ console.log(`Unicode ${provenance.unicode}, Emoji ${provenance.emoji}, CLDR ${pr
 console.log(`generated ${all.length} items (${emojis.length} emoji, ${symbols.length} symbols) -> src/glyph.cpp`);
 console.log(`  dropped ${collisions} symbols colliding with emoji glyphs; ${skinnable} skinnable`);
 console.log(`generated ${emojiProps.size} emoji-property codepoints -> src/emoji-properties.cpp`);
+console.log(`generated search masks for ${all.length} items -> src/search-index.cpp`);
 for (const { category, kind, label } of CATEGORIES) {
 	console.log(`  ${label.padEnd(20)} ${String(byCategory.get(category) ?? 0).padStart(5)}  (${kind})`);
 }
@@ -92,15 +92,19 @@ export function emitHpp(provenance: Provenance): string {
 }
 
 // Items are laid out in category order (emoji first, in emoji-test order; symbols by glyph) so every
-// category is a contiguous span. A glyph-sorted pointer index backs lookup().
-export function emitCpp(symbols: Item[], emojis: Item[], provenance: Provenance): string {
+// category is a contiguous span. Tables indexed like glyph::items() follow the same layout.
+export function layoutItems(symbols: Item[], emojis: Item[]): Item[] {
 	const rank = new Map<Category, number>(CATEGORIES.map((c, i) => [c.category, i]));
-	const info = new Map<Category, (typeof CATEGORIES)[number]>(CATEGORIES.map((c) => [c.category, c]));
-
 	const sortedSymbols = [...symbols].sort(
 		(a, b) => (rank.get(a.category)! - rank.get(b.category)!) || compareUtf8(a.character, b.character),
 	);
-	const g_items = [...emojis, ...sortedSymbols];
+	return [...emojis, ...sortedSymbols];
+}
+
+// A glyph-sorted pointer index backs lookup().
+export function emitCpp(symbols: Item[], emojis: Item[], provenance: Provenance): string {
+	const info = new Map<Category, (typeof CATEGORIES)[number]>(CATEGORIES.map((c) => [c.category, c]));
+	const g_items = layoutItems(symbols, emojis);
 
 	const pool: string[] = [];
 	const rowLine = (item: Item): string => {
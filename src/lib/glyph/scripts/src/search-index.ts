@@ -0,0 +1,76 @@
+import { CATEGORIES, type Category, type Item } from './categories.ts';
+import { banner, type Provenance } from './emit.ts';
+
+const encoder = new TextEncoder();
+const ALL_CHARS = (1n << 64n) - 1n;
+
+// Mirrors glyph::detail::charBit in include/glyph/search.hpp.
+function charBit(c: number): number {
+	if (c >= 0x41 && c <= 0x5a) c += 0x20;
+	if (c >= 0x61 && c <= 0x7a) return c - 0x61;
+	if (c >= 0x30 && c <= 0x39) return 26 + (c - 0x30);
+	return 36 + (c % 28);
+}
+
+// Mirrors glyph::textMask: texts with non-ASCII bytes get every bit.
+export function textMask(text: string): bigint {
+	let mask = 0n;
+	for (const c of encoder.encode(text)) {
+		if (c >= 0x80) return ALL_CHARS;
+		mask |= 1n << BigInt(charBit(c));
+	}
+	return mask;
+}
+
+const hex = (mask: bigint) => `0x${mask.toString(16).toUpperCase()}`;
+
+// Character masks of the name, category label and keywords of every item, in glyph::items() order
+// (see layoutItems), backing glyph::searchMasks().
+export function emitSearchIndex(items: Item[], provenance: Provenance): string {
+	const labels = new Map<Category, bigint>(CATEGORIES.map((c) => [c.category, textMask(c.label)]));
+	const pool: bigint[] = [];
+	const rows: string[] = [];
+
+	for (const item of items) {
+		const name = textMask(item.name);
+		const category = labels.get(item.category)!;
+		const keywords = item.keywords.map(textMask);
+		const all = keywords.reduce((acc, mask) => acc | mask, name | category);
+
+		let slice = '{}';
+		if (keywords.length > 0) {
+			slice = `{kw_masks.data() + ${pool.length}, ${keywords.length}}`;
+			pool.push(...keywords);
+		}
+		rows.push(`  {${hex(name)}, ${hex(category)}, ${slice}, ${hex(all)}},`);
+	}
+
+	const out: string[] = [];
+	out.push(banner(provenance));
+	out.push('#include "search.hpp"');
+	out.push('');
+	out.push('#include <array>');
+	out.push('');
+	out.push('using namespace glyph;');
+	out.push('');
+	out.push('namespace {');
+	out.push('');
+
+	if (pool.length > 0) {
+		out.push(`constexpr std::array<CharMask, ${pool.length}> kw_masks = {{`);
+		for (const mask of pool) out.push(`  ${hex(mask)},`);
+		out.push('}};');
+		out.push('');
+	}
+
+	out.push(`constexpr std::array<SearchMasks, ${rows.length}> g_masks = {{`);
+	out.push(...rows);
+	out.push('}};');
+	out.push('');
+	out.push('} // namespace');
+	out.push('');
+	out.push('const SearchMasks &glyph::searchMasks(const Item &item) { return g_masks[&item - items().data()]; }');
+	out.push('');
+
+	return out.join('\n');
+}
@@ -0,0 +1,31698 @@
+// Generated by scripts/gen.ts from Unicode 17.0.0, Emoji 17.0, CLDR 48.2.0 — do not edit by hand.
+#include "search.hpp"
+
+#include <array>
+
+using namespace glyph;
+
+namespace {
+
+constexpr std::array<CharMask, 26621> kw_masks = {{
+    0x1208B4,
+    0x1020094,
+    0x35,
+    0x22140,
+    0x22140,
+    0x1008081,
+    0x1008C1,
+    0x2114,
+    0x41910,
+    0x43940,
+    0x80090,
+    0x445011,
+    0x142,
+    0x1040010,
+    0x35,
+    0x22140,
+    0x22140,
+    0x1008081,
+    0x185080,
+    0xE010,
+    0x41910,
+    0x43940,
+    0x80090,
+    0x1000001,
+    0x1000010,
+    0x1040010,
+    0x35,
+    0x22140,
+    0x22140,
+    0x1008081,
+    0x1008C1,
+    0x4800,
+    0x185080,
+    0xE010,
+    0x41910,
+    0x43940,
+    0x3153,
+    0x1000010,
+    0x1040010,
+    0x35,
+    0x22140,
+    0x22140,
+    0x1008081,
+    0x2114,
+    0x41910,
+    0x43940,
+    0x80090,
+    0x4481C,
+    0x1040010,
+    0x35,
+    0x22140,
+    0x81,
+    0x81,
+    0x1008081,
+    0x1008C1,
+    0x4800,
+    0x185080,
+    0xE010,
+    0x24820,
+    0x41910,
+    0x43940,
+    0x1D2140,
+    0x480C,
+    0x8021C,
+    0x88011C,
+    0x35,
+    0x22140,
+    0x185080,
+    0x366010,
+    0xE010,
+    0x41910,
+    0x43940,
+    0xE0010,
+    0xE0018,
+    0x4C0011,
+    0x1022144,
+    0x35,
+    0x24820,
+    0x1102020,
+    0x81,
+    0x1008081,
+    0x90,
+    0x164981,
+    0x1004200,
+    0x1008C1,
+    0x5801,
+    0x4800,
+    0x24820,
+    0x25821,
+    0x26940,
+    0xA0011,
+    0x1029C1,
+    0x43940,
+    0x1022144,
+    0x35,
+    0x40830,
+    0x1102020,
+    0x81,
+    0x1008081,
+    0x90,
+    0x164981,
+    0x1004200,
+    0x1008C1,
+    0x5801,
+    0x4800,
+    0x24820,
+    0x25821,
+    0xA0011,
+    0x43940,
+    0xE0011,
+    0x35,
+    0x1008081,
+    0x10C09C0,
+    0x41910,
+    0x43940,
+    0x35,
+    0x90,
+    0x41910,
+    0x2000000054E118,
+    0x406008,
+    0x43940,
+    0x148118,
+    0x68119,
+    0x244918,
+    0x6101B,
+    0x35,
+    0x81,
+    0x80091,
+    0x84080,
+    0x110908,
+    0x4800,
+    0x81810,
+    0x83950,
+    0x61005,
+    0xE0105,
+    0x43940,
+    0x35,
+    0xA0920,
+    0xA0493,
+    0x1840010,
+    0x40918,
+    0xC0011,
+    0x402500,
+    0x402540,
+    0x442500,
+    0x43940,
+    0x140882,
+    0x1000010,
+    0x1040010,
+    0x35,
+    0x849,
+    0xC0139,
+    0x41910,
+    0x43940,
+    0x2851,
+    0x2955,
+    0x42851,
+    0x4081A,
+    0x35,
+    0x1020121,
+    0x10A0931,
+    0x10C2021,
+    0x4881,
+    0x1008081,
+    0x86114,
+    0x108835,
+    0x41910,
+    0x43940,
+    0xE8100,
+    0x80811,
+    0x20000000,
+    0x24019,
+    0x160084,
+    0x35,
+    0xA0091,
+    0xE0091,
+    0x1000900,
+    0x204810,
+    0x27015,
+    0x41910,
+    0x43940,
+    0x1104000,
+    0x86135,
+    0x68000000,
+    0x13,
+    0x1000010,
+    0x35,
+    0x40830,
+    0x200000010E0091,
+    0xE0091,
+    0x1000900,
+    0x40510,
+    0x204810,
+    0x27015,
+    0xA7105,
+    0x41910,
+    0x804000,
+    0x86135,
+    0x1040010,
+    0xA0091,
+    0x43940,
+    0x88011C,
+    0x1040010,
+    0x35,
+    0x22140,
+    0x41910,
+    0xE0001,
+    0x200000001E0405,
+    0x200000010E0019,
+    0x404000,
+    0x86135,
+    0x1E0404,
+    0x6400B,
+    0x13,
+    0x406942,
+    0x35,
+    0xA0920,
+    0xA0091,
+    0x1000900,
+    0x40500,
+    0x204810,
+    0x224810,
+    0x41100,
+    0x101081,
+    0xA7105,
+    0x45084,
+    0x804000,
+    0x1104000,
+    0x86135,
+    0x68000000,
+    0x80019,
+    0x82149,
+    0x35,
+    0xA0920,
+    0x1000900,
+    0x40500,
+    0x204810,
+    0x45084,
+    0x45094,
+    0x804000,
+    0x1104000,
+    0x86135,
+    0x42540,
+    0x35,
+    0x1008081,
+    0x186918,
+    0x820819,
+    0x41910,
+    0x43940,
+    0x86135,
+    0x68000000,
+    0x13,
+    0x140882,
+    0x4481C,
+    0x80019,
+    0x82149,
+    0x1000010,
+    0x1040010,
+    0x35,
+    0xA0920,
+    0x1000900,
+    0x40510,
+    0x42540,
+    0x45094,
+    0x804000,
+    0x86135,
+    0x68000000,
+    0x4481C,
+    0x80019,
+    0x82149,
+    0x1000010,
+    0x1040010,
+    0x35,
+    0xA0920,
+    0x1000900,
+    0x40500,
+    0x40510,
+    0x42540,
+    0x204810,
+    0x821C0,
+    0x41910,
+    0x43940,
+    0x86135,
+    0x35,
+    0x849,
+    0x1A0871,
+    0x1008081,
+    0x1004200,
+    0xA101,
+    0x12C008,
+    0x220918,
+    0x41910,
+    0x1041910,
+    0x43940,
+    0xA0011,
+    0x18409C,
+    0x86135,
+    0x14491C,
+    0x80011,
+    0x35,
+    0x4028,
+    0x100820,
+    0x11220C0,
+    0x264001,
+    0x41910,
+    0x43940,
+    0x10C0001,
+    0x101000,
+    0x1101000,
+    0x1101000,
+    0x266141,
+    0x186050,
+    0x445011,
+    0x4804,
+    0x35,
+    0x2114,
+    0x10A8001,
+    0x200000001C4404,
+    0x4C0010,
+    0x186050,
+    0x3020005,
+    0x8114,
+    0x1000010,
+    0x35,
+    0x1102020,
+    0x4610,
+    0x100C800,
+    0x1182000,
+    0x10A8001,
+    0x200000001C4404,
+    0x186050,
+    0x1400405,
+    0x424118,
+    0x402500,
+    0x402540,
+    0x1004800,
+    0x3020005,
+    0x1000010,
+    0x1040010,
+    0x35,
+    0x1004060,
+    0x20851,
+    0x41801,
+    0x3002001,
+    0x186050,
+    0x4481C,
+    0x1000010,
+    0x1040010,
+    0x35,
+    0x64040,
+    0x24992,
+    0x5040,
+    0x1D2140,
+    0x200000001C4404,
+    0xC0011,
+    0x186050,
+    0x6A0091,
+    0x1004800,
+    0x35,
+    0x1007010,
+    0x20000001187090,
+    0x185080,
+    0x8109,
+    0x186050,
+    0x35,
+    0x42089,
+    0x1000C0,
+    0x1021C0,
+    0xE010,
+    0x43940,
+    0x2089,
+    0x35,
+    0x950,
+    0x2940,
+    0x2089,
+    0x185080,
+    0x4C000,
+    0x20A6911,
+    0xE0014,
+    0x44484,
+    0x142018,
+    0x168110,
+    0x44C080,
+    0x224010,
+    0x2083011,
+    0x400011,
+    0x4093A,
+    0x61013,
+    0x1040010,
+    0x35,
+    0x48041,
+    0x2089,
+    0x185080,
+    0x5040,
+    0xE010,
+    0x224010,
+    0x190110,
+    0x6001D,
+    0x44484,
+    0x168110,
+    0x28811D,
+    0x61013,
+    0x1000010,
+    0x35,
+    0x198,
+    0x21C8,
+    0x8410,
+    0xA550,
+    0x8010,
+    0x6001D,
+    0x1040080,
+    0xE0011,
+    0x2089,
+    0x35,
+    0x190110,
+    0x40080,
+    0x140080,
+    0x1421C0,
+    0x2089,
+    0x2184,
+    0x6611C,
+    0x35,
+    0x1080,
+    0x2E018,
+    0x2E158,
+    0x825C0,
+    0x426158,
+    0x2089,
+    0x35,
+    0x4048,
+    0x100C04,
+    0xFFFFFFFFFFFFFFFF,
+    0x4400,
+    0xE8014,
+    0x1C0811,
+    0x1C2941,
+    0x60100,
+    0xEC000,
+    0x1040010,
+    0x2089,
+    0x35,
+    0x8410,
+    0x185080,
+    0x190110,
+    0xE0014,
+    0x1C0080,
+    0x2008100,
+    0x2028110,
+    0x200000021AD190,
+    0x1A2811,
+    0xC8D15,
+    0x26C909,
+    0x4093A,
+    0x1E0108,
+    0x5310,
+    0x1424012,
+    0x35,
+    0x1080,
+    0x1908,
+    0x60119,
+    0xC8514,
+    0xC8D15,
+    0xC9514,
+    0x168110,
+    0x480081,
+    0x1A2811,
+    0x420409,
+    0x2C03,
+    0xA019,
+    0x86E910,
+    0x35,
+    0x2130,
+    0x144A11,
+    0x1090,
+    0x1A2811,
+    0x4080,
+    0x40099,
+    0xE01C1,
+    0x143019,
+    0x110A081,
+    0x16B118,
+    0x6A0091,
+    0xC8D15,
+    0x420409,
+    0x19,
+    0x86E910,
+    0x35,
+    0x2130,
+    0xA6A110,
+    0x144A11,
+    0x1090,
+    0x86000,
+    0x4080,
+    0x5040,
+    0xE01C1,
+    0x100080,
+    0x110A081,
+    0x16B118,
+    0x6A0091,
+    0x1A2811,
+    0xC8D15,
+    0x420409,
+    0x2C03,
+    0x86E910,
+    0x35,
+    0x185080,
+    0x1C5890,
+    0x181010,
+    0x190110,
+    0xE0014,
+    0x42914,
+    0xC2910,
+    0x48894,
+    0x1A2811,
+    0xC8D15,
+    0x584180,
+    0x68018,
+    0x68119,
+    0x84018,
+    0x35,
+    0x2198,
+    0x198,
+    0x2A6110,
+    0x242912,
+    0x2910,
+    0x1090,
+    0x6A0091,
+    0x680000,
+    0x1A2811,
+    0xC8D15,
+    0xC311B,
+    0x14480C,
+    0x35,
+    0x4060,
+    0x99,
+    0x1A2811,
+    0xC8D15,
+    0x44002,
+    0x28019,
+    0x35,
+    0xA0920,
+    0x5190,
+    0x2548,
+    0x20810,
+    0x40099,
+    0x40D04,
+    0x1040800,
+    0x61500,
+    0x141040,
+    0x62514,
+    0x340011,
+    0x14C104,
+    0x440041,
+    0x1A2811,
+    0xC8D15,
+    0x63540,
+    0x40000000000000,
+    0x2401A,
+    0x35,
+    0x2130,
+    0x144A11,
+    0xA10,
+    0x1000A10,
+    0x48118,
+    0x41080,
+    0x1000C0,
+    0x100080,
+    0x143019,
+    0x110A081,
+    0x420118,
+    0x6A0091,
+    0x1A2811,
+    0xC8D15,
+    0x1024810,
+    0x1040010,
+    0x35,
+    0x26940,
+    0x40099,
+    0x1000C0,
+    0x6A0091,
+    0x1A2811,
+    0xC8D15,
+    0x400401,
+    0x420409,
+    0xC2118,
+    0x35,
+    0x21155,
+    0x23145,
+    0x22140,
+    0x41910,
+    0x43940,
+    0x1A2811,
+    0xC8D15,
+    0x404802,
+    0x406942,
+    0x800891,
+    0x8029D1,
+    0x9C0099,
+    0x35,
+    0x48041,
+    0x26041,
+    0x20930,
+    0x401C0,
+    0x1041910,
+    0x45410,
+    0x468190,
+    0x4C0990,
+    0x1A2811,
+    0xC8D15,
+    0x35,
+    0x20901,
+    0x910,
+    0x1002940,
+    0xE184,
+    0x1A2811,
+    0xC8D15,
+    0x3020005,
+    0x2000019,
+    0x1B0491,
+    0x35,
+    0x5040,
+    0xA105,
+    0x425C1,
+    0x44484,
+    0x168110,
+    0x2A0113,
+    0x404081,
+    0x404000,
+    0x1A2811,
+    0xC8D15,
+    0x99,
+    0x30A6981,
+    0x6000,
+    0x40491,
+    0x425C1,
+    0x35,
+    0x1A2811,
+    0xC8D15,
+    0x99,
+    0x6008,
+    0x425C1,
+    0x12A0915,
+    0x1040010,
+    0x35,
+    0x1A2811,
+    0xC8D15,
+    0x1805,
+    0x35,
+    0x8015,
+    0x20930,
+    0x220918,
+    0x2002010,
+    0x1048810,
+    0x500821,
+    0x2401A,
+    0x8021C,
+    0x118,
+    0xCE119,
+    0x35,
+    0x46940,
+    0xC4800,
+    0x24A110,
+    0x40009,
+    0x140404,
+    0x1048810,
+    0x1022144,
+    0x35,
+    0x4048,
+    0x821C0,
+    0x40009,
+    0x48810,
+    0x4A950,
+    0x1048810,
+    0xA0118,
+    0x26948,
+    0x35,
+    0x1048810,
+    0x1A,
+    0x8111A,
+    0x35,
+    0x4048,
+    0x861C8,
+    0xA001,
+    0x821C0,
+    0x48810,
+    0x4A950,
+    0xA0118,
+    0x6A0091,
+    0x1402001,
+    0x2000000,
+    0x1048810,
+    0x40043,
+    0x2401A,
+    0x9C0099,
+    0x1040010,
+    0x35,
+    0x180179,
+    0x80811,
+    0x1048810,
+    0xA0118,
+    0x1420011,
+    0x122018,
+    0x480C,
+    0xC2118,
+    0xE5959,
+    0xA400C,
+    0x20008,
+    0x35,
+    0x61050,
+    0x41401,
+    0x191D,
+    0x311C,
+    0x40504,
+    0x502810,
+    0x35,
+    0x900,
+    0x40504,
+    0xA5090,
+    0x502810,
+    0x205B,
+    0x35,
+    0x200000000020DB,
+    0x1A0080,
+    0x1122300,
+    0x104084,
+    0x99,
+    0x502810,
+    0x35,
+    0x64040,
+    0x10C2001,
+    0x1C2019,
+    0x40504,
+    0x285100,
+    0x502810,
+    0x20023,
+    0x400010,
+    0x35,
+    0x64040,
+    0x108410,
+    0x40504,
+    0x448010,
+    0x4A4080,
+    0x108000,
+    0x285100,
+    0x287140,
+    0x502810,
+    0x35,
+    0x220030,
+    0x100820,
+    0x1C21D8,
+    0x40504,
+    0x2042010,
+    0x2042150,
+    0x502810,
+    0x1002148,
+    0x35,
+    0x2601B0,
+    0x80091,
+    0x84080,
+    0x8A141,
+    0x2000000002003D,
+    0xE4410,
+    0x4C2151,
+    0x186050,
+    0x502810,
+    0x100812,
+    0x2000000010083F,
+    0x480C,
+    0x35,
+    0x2022170,
+    0xE4132,
+    0x40914,
+    0x2164012,
+    0x80090,
+    0x502810,
+    0x3000108,
+    0x122408,
+    0x1040010,
+    0x35,
+    0x88611D,
+    0x185080,
+    0x10C8100,
+    0x302010,
+    0x1600001,
+    0x3404000,
+    0x502810,
+    0x200000001E401C,
+    0x19,
+    0x3000108,
+    0x1040010,
+    0x35,
+    0x40830,
+    0x641C,
+    0x184000,
+    0x40504,
+    0xA0118,
+    0x6401C,
+    0x502810,
+    0x14603C,
+    0x3000108,
+    0x1040010,
+    0x35,
+    0x308E198,
+    0x5040,
+    0x1041910,
+    0x68901,
+    0x1A4812,
+    0x404081,
+    0x404081,
+    0x3404000,
+    0x502810,
+    0x406802,
+    0x80C818,
+    0x80E958,
+    0x99,
+    0x3108,
+    0x40790A,
+    0x6000,
+    0x4449C,
+    0x1400001,
+    0x35,
+    0x502810,
+    0x1404006,
+    0x424944,
+    0x35,
+    0x80081,
+    0x100000B,
+    0x10A018B,
+    0xA0817,
+    0xA6917,
+    0x88011C,
+    0x35,
+    0x1008081,
+    0x80081,
+    0x1024081,
+    0x26080,
+    0x10A8001,
+    0x10AA141,
+    0x140158,
+    0x1424012,
+    0x35,
+    0x40851,
+    0x86144,
+    0x1C5095,
+    0x1C1095,
+    0x46010,
+    0x6E010,
+    0x1048000,
+    0x80095,
+    0xC0081,
+    0x140158,
+    0x80081,
+    0x445011,
+    0x97,
+    0xA01C2,
+    0x24002,
+    0x29C4,
+    0x4804,
+    0x35,
+    0x20009,
+    0x820819,
+    0x40099,
+    0x1040801,
+    0x41910,
+    0x10C0810,
+    0x142851,
+    0x440041,
+    0x402100,
+    0x40851,
+    0x43940,
+    0x1022103,
+    0x220814,
+    0x8A8010,
+    0x35,
+    0x450,
+    0x80178,
+    0x40851,
+    0x82950,
+    0x22018,
+    0xE1001,
+    0x1040805,
+    0x35,
+    0x1002025,
+    0x7814,
+    0x20184,
+    0x11C0020,
+    0x1480891,
+    0x40851,
+    0x10083A,
+    0x14603C,
+    0x146164,
+    0x106008,
+    0x35,
+    0x426020,
+    0x1080,
+    0x1090,
+    0x86000,
+    0x40009,
+    0x1064000,
+    0x160010,
+    0x2601C,
+    0x14603C,
+    0x146124,
+    0x6949,
+    0xCE119,
+    0x18400A,
+    0x18482A,
+    0x35,
+    0x1E0039,
+    0x1E6121,
+    0x1090,
+    0x185080,
+    0xC8D15,
+    0x162010,
+    0x6A0091,
+    0x680000,
+    0x2601C,
+    0x946101,
+    0x1E0932,
+    0x35,
+    0x262010,
+    0x366010,
+    0x40009,
+    0xE0010,
+    0xE0018,
+    0x168118,
+    0x424118,
+    0x1424000,
+    0x2601C,
+    0x35,
+    0x426020,
+    0x426160,
+    0x40009,
+    0x10C09C0,
+    0x2601C,
+    0x35,
+    0x426020,
+    0x426160,
+    0x40009,
+    0x2601C,
+    0x200912,
+    0x35,
+    0xA4060,
+    0x185080,
+    0x5040,
+    0xE010,
+    0x4449C,
+    0x168118,
+    0x10C9081,
+    0x302913,
+    0x122811,
+    0x404081,
+    0x404000,
+    0x1104000,
+    0x2601C,
+    0x8114,
+    0x35,
+    0x140098,
+    0x5040,
+    0x1C2018,
+    0x168118,
+    0x404081,
+    0x404081,
+    0x2601C,
+    0xC6199,
+    0xC4004,
+    0x35,
+    0x6000,
+    0x5040,
+    0x4449C,
+    0x1084801,
+    0x1400001,
+    0x2601C,
+    0x2001019,
+    0x420409,
+    0x3020005,
+    0x2000019,
+    0x19,
+    0x4093A,
+    0x6101B,
+    0x35,
+    0x1408B8,
+    0x2000050,
+    0x80091,
+    0x84080,
+    0x69118,
+    0x2000210,
+    0x480081,
+    0x404000,
+    0x2601C,
+    0x1882111,
+    0x8481B,
+    0xA105,
+    0x4449C,
+    0x168118,
+    0x322813,
+    0x2601C,
+    0xE4118,
+    0x35,
+    0x2152,
+    0x142,
+    0x1040010,
+    0x35,
+    0x1021014,
+    0x86000,
+    0xA959,
+    0x48811,
+    0x10A8010,
+    0x1108000,
+    0x40009,
+    0x1400080,
+    0x2601C,
+    0xA7109,
+    0x400001,
+    0x407,
+    0x1020004,
+    0x6101B,
+    0x35,
+    0x42970,
+    0x1A0871,
+    0x1A0159,
+    0x69C8,
+    0x1004200,
+    0x48811,
+    0x12C008,
+    0xE0110,
+    0x40009,
+    0xE0011,
+    0x2601C,
+    0x1800C5,
+    0x35,
+    0x426020,
+    0x426160,
+    0x120049,
+    0x185080,
+    0xE010,
+    0x6001D,
+    0x1060005,
+    0x168110,
+    0x480081,
+    0x404000,
+    0x2601C,
+    0x1421D9,
+    0x35,
+    0xA4060,
+    0x6001D,
+    0x1060005,
+    0xE0018,
+    0x168110,
+    0x110A081,
+    0x480081,
+    0x404000,
+    0x2601C,
+    0x20129,
+    0x946101,
+    0x1813,
+    0x35,
+    0x20031,
+    0x120831,
+    0x6001D,
+    0x424118,
+    0x2601C,
+    0x946101,
+    0x100812,
+    0x480C,
+    0x410,
+    0x35,
+    0x185080,
+    0x366010,
+    0xE010,
+    0x160098,
+    0x6001D,
+    0x4C0011,
+    0x1040510,
+    0x2601C,
+    0x946101,
+    0x805,
+    0x44814,
+    0x8D91D,
+    0xCE119,
+    0x35,
+    0x86000,
+    0x220918,
+    0x40009,
+    0x4C0011,
+    0x81110,
+    0x400090,
+    0x180002,
+    0x2601C,
+    0x500821,
+    0x1020004,
+    0x1022144,
+    0x35,
+    0x40830,
+    0x41100,
+    0x40009,
+    0xA0011,
+    0xE0110,
+    0x110A081,
+    0x2601C,
+    0x402943,
+    0x1020004,
+    0x1022144,
+    0x35,
+    0x1104808,
+    0x40009,
+    0x44002,
+    0xA0011,
+    0xE0011,
+    0x110A081,
+    0x2601C,
+    0x8114,
+    0x35,
+    0x20031,
+    0x120831,
+    0x103084,
+    0x6001D,
+    0x61015,
+    0x61015,
+    0x63155,
+    0x4449C,
+    0x168118,
+    0x404081,
+    0x2601C,
+    0x1006019,
+    0x10603C,
+    0x14603C,
+    0x22154,
+    0x1E01C9,
+    0x35,
+    0x40830,
+    0x1E0039,
+    0x1009,
+    0x40009,
+    0x2601C,
+    0xA6015,
+    0xA6115,
+    0x35,
+    0x144024,
+    0x9D,
+    0x268010,
+    0x26A150,
+    0x2601C,
+    0x500821,
+    0x1813,
+    0x8021C,
+    0xCE119,
+    0x35,
+    0x921,
+    0x46940,
+    0x40009,
+    0x110A081,
+    0x2601C,
+    0x44814,
+    0x480C,
+    0x4C600D,
+    0x35,
+    0x40830,
+    0x9D,
+    0x366010,
+    0x40009,
+    0x6001D,
+    0x4C0011,
+    0x1040510,
+    0x2601C,
+    0x1022144,
+    0x35,
+    0x921,
+    0x40830,
+    0x11220C0,
+    0x1009,
+    0x6000,
+    0x40009,
+    0x1048810,
+    0xA0118,
+    0x110A081,
+    0x1420011,
+    0x2601C,
+    0xC4004,
+    0x35,
+    0x40830,
+    0xA001,
+    0x40009,
+    0x2042010,
+    0xA0118,
+    0x2601C,
+    0x8111A,
+    0x2401A,
+    0x35,
+    0x861C8,
+    0xA001,
+    0x821C0,
+    0x48810,
+    0x1048810,
+    0xA0118,
+    0x6A0091,
+    0x1402001,
+    0x1402141,
+    0x2000000,
+    0x2601C,
+    0x22051,
+    0x1022041,
+    0x35,
+    0x40830,
+    0x101030,
+    0x103160,
+    0x164120,
+    0x1120020,
+    0x1009,
+    0x46010,
+    0xC1011,
+    0x1A9180,
+    0x110A081,
+    0x406000,
+    0x282151,
+    0x22051,
+    0x1022041,
+    0x22059,
+    0x35,
+    0x40830,
+    0x1009,
+    0x3159,
+    0x18E140,
+    0x20051,
+    0x20018,
+    0x40099,
+    0x110A081,
+    0x1C8010,
+    0x282151,
+    0x22051,
+    0x1022041,
+    0x1813,
+    0x35,
+    0x40830,
+    0x1E0039,
+    0x1009,
+    0x3159,
+    0x20051,
+    0x40099,
+    0x110A081,
+    0x1C8010,
+    0x282151,
+    0x66014,
+    0x162144,
+    0x142144,
+    0x35,
+    0x1009,
+    0x185080,
+    0x48118,
+    0x462151,
+    0x1045802,
+    0x282151,
+    0x7018,
+    0x200918,
+    0x200910,
+    0x35,
+    0x1020121,
+    0x10A0931,
+    0x10C2021,
+    0x66080,
+    0x128810,
+    0x40099,
+    0x41910,
+    0x43940,
+    0x80811,
+    0x282151,
+    0x1022041,
+    0x7018,
+    0x200918,
+    0x200910,
+    0x35,
+    0x1020121,
+    0x10A0931,
+    0x10C2021,
+    0x66080,
+    0x9100,
+    0x345194,
+    0x128810,
+    0x40099,
+    0x80811,
+    0x282151,
+    0x100400A,
+    0x19,
+    0x80099,
+    0x35,
+    0x1020121,
+    0x10A0931,
+    0xFFFFFFFFFFFFFFFF,
+    0x5801,
+    0xE7010,
+    0x140C00,
+    0x80811,
+    0x1004800,
+    0x282151,
+    0x6012,
+    0x66016,
+    0x19,
+    0x80099,
+    0x35,
+    0xE7010,
+    0x140C00,
+    0x282151,
+    0x40002,
+    0x5104,
+    0x4008,
+    0x102048,
+    0x35,
+    0x1820,
+    0xE7010,
+    0x8910,
+    0xC000,
+    0xC000,
+    0x1041810,
+    0x41080,
+    0xC2500,
+    0xC2500,
+    0x10C2500,
+    0x1A0008,
+    0x1C5014,
+    0x406804,
+    0x35,
+    0x1C5014,
+    0x1A0015,
+    0x200918,
+    0x35,
+    0x1020121,
+    0x10A0931,
+    0x10C2021,
+    0x41401,
+    0xE7010,
+    0x24050,
+    0x1060005,
+    0x80811,
+    0x1C5014,
+    0x1022041,
+    0x1A0015,
+    0x35,
+    0x1020121,
+    0x10A0931,
+    0x10C2021,
+    0x6942,
+    0x41401,
+    0x3011,
+    0xE7010,
+    0x80811,
+    0x1C5014,
+    0x4002,
+    0x1A0015,
+    0x88011C,
+    0x35,
+    0x1020121,
+    0x10A0931,
+    0x10C2021,
+    0xC40C0,
+    0x406891,
+    0x1821C1,
+    0xE7010,
+    0x1060005,
+    0x1040900,
+    0x80811,
+    0x1C5014,
+    0x2911,
+    0x1A0015,
+    0x8E0911,
+    0x35,
+    0x1020121,
+    0x10A0931,
+    0x10C2021,
+    0xE7010,
+    0x48015,
+    0x80811,
+    0x104020,
+    0x1C5014,
+    0x2911,
+    0x1A0015,
+    0x8E0911,
+    0x35,
+    0x1020121,
+    0x10A0931,
+    0x10C2021,
+    0x1051,
+    0x21051,
+    0x41051,
+    0xE7010,
+    0x888919,
+    0x48015,
+    0x80811,
+    0x104020,
+    0x1C5014,
+    0x35,
+    0xE7010,
+    0xA4002,
+    0x1C5014,
+    0x3901,
+    0x80005,
+    0x35,
+    0x22140,
+    0x185080,
+    0xE010,
+    0x41910,
+    0x43940,
+    0x3901,
+    0x80005,
+    0x1000010,
+    0x1040010,
+    0x35,
+    0x22140,
+    0x22140,
+    0x41910,
+    0x43940,
+    0x3901,
+    0x80005,
+    0x35,
+    0x1004200,
+    0x1008C1,
+    0x1029C1,
+    0x4800,
+    0xA0011,
+    0xE0011,
+    0x3901,
+    0x80005,
+    0x1000010,
+    0x35,
+    0xA0091,
+    0x200000010E0091,
+    0x204810,
+    0x41910,
+    0x43940,
+    0x1040010,
+    0x3901,
+    0x80005,
+    0x35,
+    0x26104,
+    0x41910,
+    0x1420000,
+    0x3901,
+    0x80005,
+    0x4481C,
+    0x1000010,
+    0x1040010,
+    0x35,
+    0x40500,
+    0x42540,
+    0x3901,
+    0x80005,
+    0x35,
+    0x4080,
+    0x168118,
+    0x1420011,
+    0x3901,
+    0x80005,
+    0x1020004,
+    0x1022144,
+    0x35,
+    0x40009,
+    0xA0011,
+    0x3901,
+    0x80005,
+    0x35,
+    0x18E140,
+    0x6101B,
+    0x200910,
+    0x35,
+    0x2613A,
+    0xA4060,
+    0x1E0050,
+    0x198,
+    0x1007410,
+    0x6000,
+    0x5040,
+    0xAC19A,
+    0x6001D,
+    0xE0014,
+    0x41080,
+    0x480085,
+    0x40010,
+    0x3901,
+    0x60011,
+    0x200910,
+    0x35,
+    0x2613A,
+    0x1E0050,
+    0x20091,
+    0xC2910,
+    0x1007410,
+    0x6000,
+    0x86000,
+    0xAC19A,
+    0xE0014,
+    0x40080,
+    0x81100,
+    0x3901,
+    0x200910,
+    0x35,
+    0x2613A,
+    0x1E0050,
+    0x1007410,
+    0x6000,
+    0x86000,
+    0x4C000,
+    0xAC19A,
+    0x190110,
+    0xE0014,
+    0x48411,
+    0xC0891,
+    0xA0091,
+    0xA0810,
+    0x204810,
+    0x1901,
+    0x27015,
+    0x282911,
+    0x68000000,
+    0x6400B,
+    0x424001,
+    0x10810C,
+    0x80019,
+    0x87110,
+    0xA0091,
+    0x1000900,
+    0x204810,
+    0x27015,
+    0x282911,
+    0x68000000,
+    0x1262111,
+    0x87110,
+    0xA0091,
+    0x1000900,
+    0x40510,
+    0x26102,
+    0x282911,
+    0x804000,
+    0x68000000,
+    0x87110,
+    0x88011C,
+    0x4048,
+    0xA0091,
+    0x1000900,
+    0x40510,
+    0x27140,
+    0x821C0,
+    0x68C11,
+    0x6AD41,
+    0x804000,
+    0x68000000,
+    0x87110,
+    0x88011C,
+    0x426140,
+    0xA0091,
+    0x1E8891,
+    0x1000900,
+    0x40510,
+    0x101081,
+    0x366010,
+    0x148810,
+    0x804000,
+    0x68000000,
+    0x82153,
+    0x2410D,
+    0x87110,
+    0xA0091,
+    0xA0093,
+    0x1000900,
+    0x204810,
+    0x1CA941,
+    0x148810,
+    0x68000000,
+    0x6400B,
+    0x1262111,
+    0x87110,
+    0xA0091,
+    0xE0091,
+    0x226950,
+    0x68000000,
+    0x1262111,
+    0x80019,
+    0x82149,
+    0x87110,
+    0xA0091,
+    0xE0091,
+    0x1000900,
+    0x40510,
+    0x204810,
+    0x206940,
+    0x484000,
+    0x804000,
+    0x68000000,
+    0xA611D,
+    0x87110,
+    0xA0091,
+    0xA0091,
+    0x128810,
+    0x480190,
+    0x887915,
+    0xA0091,
+    0x1200091,
+    0x21401,
+    0x18E105,
+    0x20413,
+    0x26412,
+    0x16009C,
+    0x87110,
+    0xA0091,
+    0xA6493,
+    0x1006810,
+    0x40009,
+    0x122002,
+    0x20130,
+    0xA0091,
+    0x204810,
+    0x1C0800,
+    0x6001D,
+    0xA0991,
+    0xA0091,
+    0x22F140,
+    0x3158,
+    0x226154,
+    0x1AA155,
+    0x400810,
+    0x87110,
+    0xA0091,
+    0x204810,
+    0x20018,
+    0x68000000,
+    0x2481B,
+    0x180014,
+    0x87110,
+    0xA0091,
+    0x1000900,
+    0xD10,
+    0x204810,
+    0xA500,
+    0x48915,
+    0x4C0010,
+    0x68000000,
+    0xA0091,
+    0x26051,
+    0x68000000,
+    0x2010D,
+    0x87110,
+    0xA0091,
+    0x1000900,
+    0x204810,
+    0x1404810,
+    0x68000000,
+    0x87110,
+    0x22050,
+    0xA0091,
+    0x1000900,
+    0x204810,
+    0xA7105,
+    0x68000000,
+    0x100812,
+    0x87110,
+    0xA0091,
+    0x1000900,
+    0x204810,
+    0x27015,
+    0x68000000,
+    0x100812,
+    0x180014,
+    0x1002005,
+    0x87110,
+    0xA0091,
+    0x1000900,
+    0x809C0,
+    0xD10,
+    0x204810,
+    0x1040400,
+    0x48915,
+    0x80811,
+    0x68000000,
+    0xC0012,
+    0x87110,
+    0xA0091,
+    0x1000900,
+    0x204810,
+    0x128810,
+    0x68000000,
+    0x426002,
+    0xA0091,
+    0xC07,
+    0x200910,
+    0xA0091,
+    0x40051C,
+    0x68000000,
+    0x87110,
+    0x1020041,
+    0x1020050,
+    0xA0091,
+    0x1000900,
+    0x204810,
+    0x260910,
+    0xC0811,
+    0x48915,
+    0x68000000,
+    0xA0091,
+    0x480190,
+    0x82149,
+    0x87110,
+    0xA0091,
+    0x40500,
+    0x42540,
+    0x48900,
+    0x21401,
+    0x27015,
+    0x1840010,
+    0xC000000,
+    0x8000000000001,
+    0x20051,
+    0x1020815,
+    0x1082938,
+    0x1809A1,
+    0xC30,
+    0x100820,
+    0x122098,
+    0x8410,
+    0xA8034,
+    0x8E100,
+    0x64014,
+    0x1A0010,
+    0x1A0080,
+    0x1108000,
+    0x87110,
+    0xCE100,
+    0x22051,
+    0x1022041,
+    0x5104,
+    0x1009,
+    0x1045802,
+    0x1C8010,
+    0x87110,
+    0x1A3051,
+    0x420803,
+    0x8001B,
+    0xE3159,
+    0x801E0,
+    0x160404,
+    0x4E0810,
+    0x10480C,
+    0x87110,
+    0x5002,
+    0x5002,
+    0x491C,
+    0x46904,
+    0x5104,
+    0x80C818,
+    0x87110,
+    0x5104,
+    0x3000108,
+    0x421C0,
+    0xC61C0,
+    0xE0001,
+    0xE0001,
+    0x87110,
+    0x5104,
+    0x28108,
+    0xAC818,
+    0xEC818,
+    0x6C008,
+    0x4A9C1,
+    0x1F0100,
+    0x4C0011,
+    0x4A0011,
+    0x480010,
+    0x424400,
+    0x5A4400,
+    0x87110,
+    0x1400001,
+    0x10480C,
+    0x5104,
+    0x40089,
+    0x421C9,
+    0xA0021,
+    0xC0021,
+    0x4040,
+    0x6050,
+    0x84041,
+    0x122140,
+    0x45410,
+    0x87110,
+    0x4890,
+    0x87110,
+    0x6803,
+    0x100812,
+    0x5104,
+    0x4949,
+    0x41051,
+    0x41000,
+    0x48094,
+    0x80C01,
+    0x880010,
+    0x108A140,
+    0x87110,
+    0x6803,
+    0x100812,
+    0x1000010,
+    0x48094,
+    0x4C2110,
+    0x87110,
+    0x6803,
+    0x100812,
+    0x4949,
+    0x80830,
+    0x48094,
+    0x87110,
+    0x22051,
+    0x1022041,
+    0x6803,
+    0x100812,
+    0x1009,
+    0xA01C0,
+    0x87110,
+    0x6803,
+    0x100812,
+    0xA6005,
+    0x10480C,
+    0x5104,
+    0x1021019,
+    0x4611C,
+    0x21019,
+    0x119,
+    0x282110,
+    0x286110,
+    0x2020911,
+    0x82580,
+    0x1C40C0,
+    0x426018,
+    0x87110,
+    0x1840C0,
+    0x5104,
+    0x4048,
+    0x861C8,
+    0x821C0,
+    0x48810,
+    0x4A950,
+    0x1048810,
+    0xA0118,
+    0x2000000,
+    0x87110,
+    0x1000012,
+    0x1000005,
+    0x10000040,
+    0xE2150,
+    0x80040,
+    0x2089,
+    0x4890,
+    0x1000090,
+    0x180,
+    0xA0811,
+    0x184110,
+    0x82020,
+    0x1080800,
+    0x600011,
+    0x1004000,
+    0x1104000,
+    0x62170,
+    0xE010,
+    0x602141,
+    0x407,
+    0x248F,
+    0x2089,
+    0x60119,
+    0x62170,
+    0xE010,
+    0x22170,
+    0x62170,
+    0x2089,
+    0x60119,
+    0x1048819,
+    0xCC000,
+    0xE010,
+    0x80000000,
+    0x200130,
+    0x2089,
+    0x1C0,
+    0x60119,
+    0xCC000,
+    0x62170,
+    0xE010,
+    0x22170,
+    0x2089,
+    0x42089,
+    0x1C0811,
+    0x302805,
+    0x62170,
+    0xE010,
+    0x2089,
+    0x42499,
+    0x4888,
+    0x20095,
+    0xA01C0,
+    0x4A01C9,
+    0x4E01C9,
+    0x40491,
+    0x62170,
+    0xE010,
+    0x2089,
+    0x42499,
+    0x4888,
+    0x80830,
+    0x4A0839,
+    0x4E0839,
+    0x20095,
+    0x40491,
+    0x62170,
+    0xE010,
+    0x41108,
+    0x406008,
+    0x2C008,
+    0x2C018,
+    0x2089,
+    0x9801,
+    0x8504,
+    0x44080,
+    0x108000,
+    0x62170,
+    0xE010,
+    0x6416,
+    0x80085,
+    0x5014,
+    0x2089,
+    0x4888,
+    0x406400,
+    0x80920,
+    0x1010,
+    0x24030,
+    0x9801,
+    0x80810,
+    0x62170,
+    0xE010,
+    0x108000,
+    0x4C06,
+    0x200130,
+    0x80881,
+    0x2089,
+    0x1C0,
+    0x4888,
+    0x4A0839,
+    0x4E0839,
+    0x148011,
+    0x148080,
+    0x14A1C0,
+    0x160030,
+    0x48801,
+    0xCC000,
+    0x480101,
+    0x62170,
+    0xE010,
+    0x4C06,
+    0x200130,
+    0x80881,
+    0x2089,
+    0x1C0,
+    0x4888,
+    0x148011,
+    0x148080,
+    0x14A1C0,
+    0x160030,
+    0x4A01C9,
+    0x4E01C9,
+    0x48801,
+    0xCC000,
+    0x480101,
+    0x62170,
+    0xE010,
+    0x445011,
+    0x80012,
+    0xC018,
+    0xC30,
+    0x440A0,
+    0x84040,
+    0x840C5,
+    0x2089,
+    0x80950,
+    0x4400,
+    0x1004401,
+    0xA184,
+    0x20009,
+    0x160010,
+    0x4C0010,
+    0xA0090,
+    0x62170,
+    0xA8901,
+    0x62170,
+    0x1E0050,
+    0x2089,
+    0x4888,
+    0x100080,
+    0xA6151,
+    0x8A115,
+    0xA19C,
+    0x820811,
+    0xE0105,
+    0x1000C0,
+    0x480081,
+    0x2008100,
+    0xA8901,
+    0x187001,
+    0x80102,
+    0x62170,
+    0x2089,
+    0x80910,
+    0xA1C4,
+    0x41801,
+    0xE4000,
+    0xA8901,
+    0x2089,
+    0x8015,
+    0x200000,
+    0x12A4104,
+    0x62170,
+    0xA8901,
+    0x64004,
+    0x6401C,
+    0x22170,
+    0x62170,
+    0x2089,
+    0x100C04,
+    0xA8901,
+    0x10020000000,
+    0x6401C,
+    0xA4A110,
+    0x22170,
+    0x2089,
+    0xA0091,
+    0x802118,
+    0x204810,
+    0x1007010,
+    0x4A001,
+    0x181082,
+    0x62170,
+    0xA8901,
+    0x62170,
+    0x1E0050,
+    0x2089,
+    0x1000900,
+    0x204810,
+    0x20000001304810,
+    0xA0090,
+    0x1104000,
+    0xA8901,
+    0x22170,
+    0x2089,
+    0x66080,
+    0x20000000026404,
+    0x42140,
+    0x62170,
+    0xA8901,
+    0x805,
+    0x2089,
+    0x20C1,
+    0x44810,
+    0x1010,
+    0x40481,
+    0x62170,
+    0xA8901,
+    0x248F,
+    0x22170,
+    0x2089,
+    0x802118,
+    0x80830,
+    0x8E100,
+    0x8E140,
+    0x42950,
+    0x248F,
+    0x22170,
+    0x2089,
+    0x802118,
+    0x8E100,
+    0x8E140,
+    0xA01C0,
+    0x42950,
+    0x248F,
+    0x22170,
+    0x2089,
+    0x802118,
+    0x8E100,
+    0x8E140,
+    0x108000,
+    0x42950,
+    0x22170,
+    0x2089,
+    0x1918,
+    0x42950,
+    0x248F,
+    0x406008,
+    0x22170,
+    0x2089,
+    0x802118,
+    0x8E100,
+    0x8E140,
+    0x42950,
+    0x22170,
+    0x2089,
+    0x802118,
+    0x8E100,
+    0x8E140,
+    0xC0180,
+    0x108000,
+    0x42950,
+    0x80001,
+    0x22170,
+    0x2089,
+    0x802118,
+    0x8E140,
+    0xC410,
+    0x620110,
+    0x1104000,
+    0x42950,
+    0x8000008000000,
+    0x4048,
+    0x2089,
+    0xD10,
+    0x181082,
+    0x108000,
+    0x1040010,
+    0x4481C,
+    0x62170,
+    0x1C1082,
+    0x20000008000000,
+    0xB,
+    0x40D18,
+    0x406008,
+    0x4048,
+    0x2089,
+    0x6000,
+    0xE010,
+    0x181082,
+    0x1C1082,
+    0x4481C,
+    0x62170,
+    0x289C,
+    0xC0120,
+    0x2089,
+    0x10A084,
+    0x60119,
+    0x10E4909,
+    0x4481C,
+    0x62170,
+    0x11C4813,
+    0x20051,
+    0x5002,
+    0x24002,
+    0x120082,
+    0x109002,
+    0x289C,
+    0xA4014,
+    0xC0120,
+    0x2089,
+    0x102C14,
+    0x7144,
+    0x10E008,
+    0x10A084,
+    0x24404,
+    0x1080800,
+    0x4481C,
+    0x62170,
+    0xC0120,
+    0x20000000082975,
+    0x4E0839,
+    0x4481C,
+    0x2165,
+    0x62170,
+    0x2089,
+    0x80830,
+    0xC0120,
+    0x200000000A21E5,
+    0x4E01C9,
+    0x4481C,
+    0x2165,
+    0x62170,
+    0x2089,
+    0xA01C0,
+    0x148811,
+    0x22C801,
+    0x445011,
+    0x8805,
+    0xE6045,
+    0x1E6945,
+    0x88011C,
+    0x4048,
+    0xA0051,
+    0x2089,
+    0x5190,
+    0x4202,
+    0x2114,
+    0x1028019,
+    0x400810,
+    0x1000001,
+    0xA945,
+    0x42089,
+    0xA6917,
+    0x1E0050,
+    0x2089,
+    0x42089,
+    0x1024081,
+    0x68111,
+    0x60119,
+    0x62141,
+    0x10020000000,
+    0x42089,
+    0xA0091,
+    0x204810,
+    0x1104000,
+    0x2089,
+    0x42089,
+    0x1000C0,
+    0x2000201,
+    0xE010,
+    0x660010,
+    0x10801C,
+    0x100009,
+    0x42089,
+    0x49801,
+    0x1028001,
+    0x1028011,
+    0xA40D0,
+    0x108000,
+    0x440180,
+    0xA3051,
+    0x819,
+    0x2089,
+    0x42499,
+    0x83150,
+    0x40491,
+    0x42089,
+    0xA8115,
+    0x40401,
+    0x52,
+    0x4081A,
+    0x404002,
+    0x7004,
+    0x200130,
+    0x4838,
+    0x1E0050,
+    0x2089,
+    0x1C0,
+    0x48811,
+    0x1028001,
+    0xC2481,
+    0x880080,
+    0x42089,
+    0x2089,
+    0x4A0110,
+    0x4A2140,
+    0x2C000,
+    0x2401A,
+    0x20015,
+    0xC5114,
+    0x6018,
+    0x109411,
+    0x123115,
+    0x2901,
+    0x4C980,
+    0x6A0091,
+    0x2089,
+    0x2C000,
+    0x21015,
+    0xE090,
+    0x40930,
+    0x2089,
+    0x2C000,
+    0x21001,
+    0xC0013,
+    0x2096,
+    0x48116,
+    0x112491A,
+    0x24002,
+    0x160804,
+    0x800830,
+    0x42141,
+    0x1001040,
+    0x61D,
+    0x141814,
+    0x68010,
+    0x28118,
+    0xE6040,
+    0x4809F0,
+    0x100400A,
+    0x800838,
+    0xE8001,
+    0x10C0917,
+    0x21001,
+    0x3995,
+    0xEC194,
+    0x100400A,
+    0xE8001,
+    0x10C0917,
+    0x850,
+    0x3995,
+    0xEC194,
+    0x100400A,
+    0xE8001,
+    0x82012,
+    0x84020,
+    0x504,
+    0x2410,
+    0x850,
+    0x1902,
+    0x100400A,
+    0xE8001,
+    0x2C11,
+    0x80030,
+    0x84020,
+    0x504,
+    0xCD000,
+    0x100400A,
+    0xE8001,
+    0x100400A,
+    0x20011,
+    0x60011,
+    0x20091,
+    0x221D1,
+    0xC2910,
+    0xC2950,
+    0x146008,
+    0xE8001,
+    0x10C0917,
+    0x109,
+    0x20011,
+    0x20089,
+    0x221D1,
+    0x100400A,
+    0xE8001,
+    0x100400A,
+    0x46010,
+    0x46010,
+    0x1046010,
+    0x24008,
+    0x41810,
+    0x41810,
+    0xE8001,
+    0x22103,
+    0x82950,
+    0xE1001,
+    0x100400A,
+    0xE8001,
+    0x87905,
+    0x80013,
+    0x102494D,
+    0xA0091,
+    0xA0093,
+    0x26041,
+    0x148810,
+    0x20811,
+    0x20018,
+    0x100400A,
+    0xE8001,
+    0xA0093,
+    0xA0093,
+    0x886991,
+    0x86981,
+    0x102840,
+    0x142840,
+    0x26041,
+    0xEE111,
+    0x100400A,
+    0xE8001,
+    0xC2118,
+    0x1028811,
+    0x80090,
+    0x84080,
+    0x480190,
+    0x100400A,
+    0xE8001,
+    0x6012,
+    0x46012,
+    0x4048,
+    0xC6C10,
+    0x446192,
+    0x100400A,
+    0xE8001,
+    0x100400A,
+    0x1000010,
+    0x1040010,
+    0x35,
+    0x1004840,
+    0x4C00,
+    0x6D40,
+    0x5040,
+    0x8010,
+    0x40010,
+    0x42150,
+    0xE8001,
+    0x8000000,
+    0x100400A,
+    0x1000010,
+    0x6010,
+    0xE8001,
+    0x100400A,
+    0xD04,
+    0x168800,
+    0x186050,
+    0xE8001,
+    0x1180013,
+    0x100400A,
+    0x40500,
+    0x42540,
+    0x48900,
+    0xC8D04,
+    0x185080,
+    0xE8001,
+    0x946101,
+    0x80112,
+    0x82142,
+    0x20031,
+    0xA0920,
+    0xA2960,
+    0x40500,
+    0x8900,
+    0xC8D04,
+    0x366010,
+    0x1840010,
+    0x1A7837,
+    0x424118,
+    0x1424000,
+    0x100400A,
+    0xE8001,
+    0x40113,
+    0x1000003,
+    0x2299C,
+    0x4040,
+    0x82121,
+    0x426012,
+    0xAA051,
+    0x1106040,
+    0x6E010,
+    0x200000010A01DA,
+    0x98C,
+    0x229CD,
+    0x508,
+    0x1106040,
+    0x1126050,
+    0x6E010,
+    0x1004002,
+    0x200000010A01DA,
+    0x98C,
+    0x66049,
+    0x508,
+    0x46000,
+    0x1106040,
+    0x1126050,
+    0x6E010,
+    0x200000010A01DA,
+    0x98C,
+    0x1A00D9,
+    0x20940,
+    0x1A20D9,
+    0x508,
+    0x224140,
+    0x1106040,
+    0x1126050,
+    0x200410D,
+    0x6E010,
+    0x180809,
+    0x6E010,
+    0x680A,
+    0x2000000002699B,
+    0x103081,
+    0x6E010,
+    0x20181,
+    0x180809,
+    0x24002,
+    0x3001,
+    0x6E010,
+    0x2001B,
+    0x2001B,
+    0x6E010,
+    0x460590,
+    0x2001B,
+    0x2001B,
+    0x3001,
+    0x460590,
+    0x6E010,
+    0x2001B,
+    0x2001B,
+    0x460590,
+    0x407001,
+    0x6E010,
+    0x180809,
+    0x24002,
+    0x3001,
+    0x10000020199,
+    0x20181,
+    0x6E010,
+    0x20018,
+    0x180809,
+    0x24002,
+    0x10001120985,
+    0x3001,
+    0x1120804,
+    0x20181,
+    0x6E010,
+    0x180809,
+    0x24002,
+    0x3001,
+    0x100004A0191,
+    0x20181,
+    0x6E010,
+    0x480190,
+    0x180809,
+    0x80B,
+    0x24002,
+    0x3001,
+    0x6E010,
+    0x180809,
+    0x1000809,
+    0x407001,
+    0x6E010,
+    0x180809,
+    0x1000809,
+    0x10000020199,
+    0x407001,
+    0x20181,
+    0x6E010,
+    0x20018,
+    0x180809,
+    0x6E010,
+    0x10000020199,
+    0x20181,
+    0x20018,
+    0x180809,
+    0x10001120985,
+    0x1000809,
+    0x407001,
+    0x1120804,
+    0x20181,
+    0x6E010,
+    0x180809,
+    0x10001120985,
+    0x6E010,
+    0x1120804,
+    0x20181,
+    0x180809,
+    0x1000809,
+    0x100004A0191,
+    0x407001,
+    0x20181,
+    0x6E010,
+    0x480190,
+    0x180809,
+    0x6E010,
+    0x100004A0191,
+    0x20181,
+    0x480190,
+    0x180809,
+    0x80B,
+    0x1000809,
+    0x407001,
+    0x6E010,
+    0x180809,
+    0x80B,
+    0x6E010,
+    0x680A,
+    0x2000000002699B,
+    0x681A,
+    0x20181,
+    0x407001,
+    0x6E010,
+    0x680A,
+    0x2000000002699B,
+    0x20181,
+    0x3001,
+    0x6E010,
+    0x180809,
+    0x1020818,
+    0xAA059,
+    0x4808,
+    0x6E010,
+    0x440110,
+    0x24818,
+    0x180809,
+    0x80B,
+    0x1020818,
+    0x69041,
+    0xA20F9,
+    0x2A049,
+    0x3001,
+    0x4808,
+    0x440110,
+    0x6E010,
+    0x180809,
+    0x1020818,
+    0x23049,
+    0xA70D9,
+    0x1022041,
+    0x1000809,
+    0x4808,
+    0x440110,
+    0x407001,
+    0x6E010,
+    0x1006019,
+    0xCE119,
+    0x1E2958,
+    0x1E011A,
+    0x426020,
+    0x426160,
+    0x1E0039,
+    0x1E0050,
+    0xA0119,
+    0x6E010,
+    0x1C8010,
+    0x1006019,
+    0xCE119,
+    0x1E2958,
+    0x1E011A,
+    0x426020,
+    0x426160,
+    0x1E0039,
+    0x1E0050,
+    0xA0119,
+    0x3001,
+    0x1C8010,
+    0x6E010,
+    0x1006019,
+    0xCE119,
+    0x1E2958,
+    0x1E011A,
+    0x426020,
+    0x426160,
+    0x1E0039,
+    0x1E0050,
+    0xA0119,
+    0x1C8010,
+    0x407001,
+    0x6E010,
+    0xCE119,
+    0x4A6018,
+    0x426020,
+    0x21155,
+    0x6E010,
+    0x18E140,
+    0x444804,
+    0x140C00,
+    0x1C8010,
+    0x402190,
+    0x1E0050,
+    0xCE119,
+    0x4A6018,
+    0x426020,
+    0x21155,
+    0x3001,
+    0x18E140,
+    0x444804,
+    0x140C00,
+    0x1C8010,
+    0x402190,
+    0x1E0050,
+    0x6E010,
+    0xCE119,
+    0x4A6018,
+    0x426020,
+    0x21155,
+    0x18E140,
+    0x444804,
+    0x140C00,
+    0x1C8010,
+    0x402190,
+    0x407001,
+    0x1E0050,
+    0x6E010,
+    0x2613A,
+    0x1E0050,
+    0x2089,
+    0x6000,
+    0x86000,
+    0x6E010,
+    0xAC182,
+    0x1E2150,
+    0x2613A,
+    0x1E0050,
+    0x2089,
+    0x3001,
+    0x6000,
+    0x86000,
+    0xAC182,
+    0x1E2150,
+    0x6E010,
+    0x2613A,
+    0x1E0050,
+    0x2089,
+    0x6000,
+    0x86000,
+    0xAC182,
+    0x407001,
+    0x1E2150,
+    0x6E010,
+    0x860114,
+    0x1E0050,
+    0x1E2150,
+    0x2089,
+    0x4400,
+    0x5040,
+    0x6E010,
+    0x860114,
+    0x1E0050,
+    0x1E2150,
+    0x2089,
+    0x3001,
+    0x4400,
+    0x5040,
+    0x6E010,
+    0x860114,
+    0x1E0050,
+    0x1E2150,
+    0x2089,
+    0x4400,
+    0x5040,
+    0x407001,
+    0x6E010,
+    0x800B4,
+    0xD24,
+    0x8920,
+    0x4C140,
+    0x2089,
+    0x6E010,
+    0x61005,
+    0xE0105,
+    0x1040001,
+    0x1164910,
+    0x8A140,
+    0x6A0091,
+    0x1E0050,
+    0x800B4,
+    0xD24,
+    0x8920,
+    0x4C140,
+    0x2089,
+    0x3001,
+    0x61005,
+    0xE0105,
+    0x1040001,
+    0x1164910,
+    0x8A140,
+    0x6A0091,
+    0x1E0050,
+    0x6E010,
+    0x800B4,
+    0xD24,
+    0x8920,
+    0x4C140,
+    0x2089,
+    0x61005,
+    0xE0105,
+    0x1040001,
+    0x1164910,
+    0x8A140,
+    0x6A0091,
+    0x407001,
+    0x1E0050,
+    0x6E010,
+    0x1E0050,
+    0x2089,
+    0x20090,
+    0x406400,
+    0x1010,
+    0x6E010,
+    0x8504,
+    0x1D6110,
+    0x60111,
+    0x62141,
+    0x1E0050,
+    0x2089,
+    0x20090,
+    0x406400,
+    0x3001,
+    0x1010,
+    0x8504,
+    0x1D6110,
+    0x60111,
+    0x62141,
+    0x6E010,
+    0x1E0050,
+    0x2089,
+    0x20090,
+    0x406400,
+    0x1010,
+    0x8504,
+    0x1D6110,
+    0x60111,
+    0x62141,
+    0x407001,
+    0x6E010,
+    0x10C0917,
+    0x39,
+    0x20011,
+    0x1E0050,
+    0x20091,
+    0x6E010,
+    0x10C0917,
+    0x39,
+    0x20011,
+    0x1E0050,
+    0x20091,
+    0x3001,
+    0x6E010,
+    0x10C0917,
+    0x39,
+    0x20011,
+    0x1E0050,
+    0x20091,
+    0x407001,
+    0x6E010,
+    0x100C841,
+    0x40401,
+    0x52,
+    0x404002,
+    0x406142,
+    0x224021,
+    0x224170,
+    0x1E0050,
+    0x81119,
+    0x87119,
+    0x6E010,
+    0x1088100,
+    0xA0050,
+    0x1064000,
+    0x100C841,
+    0x40401,
+    0x52,
+    0x404002,
+    0x406142,
+    0x224021,
+    0x224170,
+    0x1E0050,
+    0x3001,
+    0x81119,
+    0x87119,
+    0x1088100,
+    0xA0050,
+    0x1064000,
+    0x6E010,
+    0x100C841,
+    0x40401,
+    0x52,
+    0x404002,
+    0x406142,
+    0x224021,
+    0x224170,
+    0x1E0050,
+    0x81119,
+    0x87119,
+    0x1088100,
+    0xA0050,
+    0x1064000,
+    0x407001,
+    0x6E010,
+    0x2141,
+    0x42091A,
+    0x4093A,
+    0x8EE111,
+    0x9835,
+    0x6000,
+    0x86000,
+    0x4080,
+    0x5040,
+    0x6E010,
+    0x44484,
+    0x41080,
+    0xB975,
+    0x1E0050,
+    0x2141,
+    0x42091A,
+    0x4093A,
+    0x8EE111,
+    0x9835,
+    0x3001,
+    0x6000,
+    0x86000,
+    0x4080,
+    0x5040,
+    0x44484,
+    0x41080,
+    0xB975,
+    0x1E0050,
+    0x6E010,
+    0x2141,
+    0x42091A,
+    0x4093A,
+    0x8EE111,
+    0x9835,
+    0x6000,
+    0x86000,
+    0x4080,
+    0x5040,
+    0x44484,
+    0x41080,
+    0x407001,
+    0xB975,
+    0x1E0050,
+    0x6E010,
+    0x18400A,
+    0x106008,
+    0x140050,
+    0x508,
+    0x26155,
+    0x2213C,
+    0x446400,
+    0x1001013,
+    0x6E010,
+    0x1600C0,
+    0x1621C0,
+    0x6A0091,
+    0x404080,
+    0x1E0050,
+    0x18400A,
+    0x106008,
+    0x140050,
+    0x508,
+    0x26155,
+    0x2213C,
+    0x446400,
+    0x3001,
+    0x1001013,
+    0x1600C0,
+    0x1621C0,
+    0x6A0091,
+    0x404080,
+    0x1E0050,
+    0x6E010,
+    0x18400A,
+    0x106008,
+    0x140050,
+    0x508,
+    0x26155,
+    0x2213C,
+    0x446400,
+    0x1001013,
+    0x1600C0,
+    0x1621C0,
+    0x6A0091,
+    0x404080,
+    0x407001,
+    0x1E0050,
+    0x6E010,
+    0xA400C,
+    0x80891,
+    0xA0895,
+    0x162010,
+    0xE8191,
+    0x424410,
+    0x6E010,
+    0x24810,
+    0xA400C,
+    0x80891,
+    0xA0895,
+    0x3001,
+    0x162010,
+    0xE8191,
+    0x424410,
+    0x6E010,
+    0x24810,
+    0xA400C,
+    0x80891,
+    0xA0895,
+    0x162010,
+    0xE8191,
+    0x407001,
+    0x424410,
+    0x6E010,
+    0x24810,
+    0x1A0059,
+    0x1C2018,
+    0x6E010,
+    0x24810,
+    0x1A0059,
+    0x3001,
+    0x1C2018,
+    0x6E010,
+    0x24810,
+    0x1A0059,
+    0x1C2018,
+    0x407001,
+    0x6E010,
+    0x24810,
+    0x1E6104,
+    0x1A0814,
+    0x6C030,
+    0xA0095,
+    0x6E010,
+    0x24810,
+    0x1E6104,
+    0x1A0814,
+    0x3001,
+    0x6C030,
+    0xA0095,
+    0x6E010,
+    0x24810,
+    0x1E6104,
+    0x1A0814,
+    0x6C030,
+    0xA0095,
+    0x407001,
+    0x6E010,
+    0x24810,
+    0x100258,
+    0x1C0314,
+    0x400801,
+    0x40815,
+    0x6E010,
+    0x24810,
+    0x100258,
+    0x1C0314,
+    0x400801,
+    0x3001,
+    0x40815,
+    0x6E010,
+    0x24810,
+    0x100258,
+    0x1C0314,
+    0x400801,
+    0x40815,
+    0x407001,
+    0x6E010,
+    0x24810,
+    0x21031,
+    0x22059,
+    0x22095,
+    0x6E010,
+    0x24810,
+    0x21031,
+    0x22059,
+    0x3001,
+    0x22095,
+    0x6E010,
+    0x24810,
+    0x21031,
+    0x22059,
+    0x22095,
+    0x407001,
+    0x6E010,
+    0x24810,
+    0xB4,
+    0x4404,
+    0x6E010,
+    0x24810,
+    0xB4,
+    0x4404,
+    0x3001,
+    0x6E010,
+    0x24810,
+    0xB4,
+    0x4404,
+    0x407001,
+    0x6E010,
+    0x24810,
+    0xA2915,
+    0x3195,
+    0x129812,
+    0xEE019,
+    0x6E010,
+    0x24810,
+    0xA2915,
+    0x3001,
+    0x3195,
+    0x129812,
+    0xEE019,
+    0x6E010,
+    0x24810,
+    0xA2915,
+    0x3195,
+    0x129812,
+    0xEE019,
+    0x407001,
+    0x6E010,
+    0x24810,
+    0x1041813,
+    0x10A4025,
+    0x1E2909,
+    0x424410,
+    0x6E010,
+    0x24810,
+    0x1041813,
+    0x10A4025,
+    0x1E2909,
+    0x3001,
+    0x424410,
+    0x6E010,
+    0x24810,
+    0x1041813,
+    0x10A4025,
+    0x1E2909,
+    0x407001,
+    0x424410,
+    0x6E010,
+    0x24810,
+    0xA0195,
+    0x142112,
+    0x23051,
+    0x4134,
+    0x200000004A4995,
+    0x424410,
+    0x6E010,
+    0x24810,
+    0xA0195,
+    0x142112,
+    0x3001,
+    0x23051,
+    0x4134,
+    0x200000004A4995,
+    0x424410,
+    0x6E010,
+    0x24810,
+    0xA0195,
+    0x142112,
+    0x23051,
+    0x4134,
+    0x200000004A4995,
+    0x407001,
+    0x424410,
+    0x6E010,
+    0x24810,
+    0xC4942,
+    0xC1194,
+    0x22150,
+    0x83195,
+    0x10C8184,
+    0xC2114,
+    0x6E010,
+    0x24810,
+    0xC4942,
+    0xC1194,
+    0x22150,
+    0x3001,
+    0x83195,
+    0x10C8184,
+    0xC2114,
+    0x6E010,
+    0x24810,
+    0xC4942,
+    0xC1194,
+    0x22150,
+    0x83195,
+    0x10C8184,
+    0xC2114,
+    0x407001,
+    0x6E010,
+    0x24810,
+    0x2401C,
+    0x1AD014,
+    0x22C818,
+    0x2A6110,
+    0x4E4031,
+    0xC69D4,
+    0x6E010,
+    0x24810,
+    0x2401C,
+    0x1AD014,
+    0x22C818,
+    0x2A6110,
+    0x3001,
+    0x4E4031,
+    0xC69D4,
+    0x6E010,
+    0x24810,
+    0x2401C,
+    0x1AD014,
+    0x22C818,
+    0x2A6110,
+    0x4E4031,
+    0xC69D4,
+    0x407001,
+    0x6E010,
+    0x24810,
+    0xA4005,
+    0xA2111,
+    0x24404,
+    0xE4405,
+    0x62150,
+    0xE0001,
+    0x6E010,
+    0x24810,
+    0xA4005,
+    0xA2111,
+    0x3001,
+    0x24404,
+    0xE4405,
+    0x62150,
+    0xE0001,
+    0x6E010,
+    0x24810,
+    0xA4005,
+    0xA2111,
+    0x24404,
+    0xE4405,
+    0x62150,
+    0xE0001,
+    0x407001,
+    0x6E010,
+    0x24810,
+    0xE0101,
+    0x88811,
+    0x6E010,
+    0x24810,
+    0xE0101,
+    0x3001,
+    0x88811,
+    0x6E010,
+    0x24810,
+    0xE0101,
+    0x88811,
+    0x407001,
+    0x6E010,
+    0x24810,
+    0x8C900,
+    0xA811,
+    0x6E010,
+    0x24810,
+    0x3001,
+    0x8C900,
+    0xA811,
+    0x6E010,
+    0x24810,
+    0x8C900,
+    0xA811,
+    0x407001,
+    0x6E010,
+    0x24810,
+    0x1E6001,
+    0xA4414,
+    0x48015,
+    0x6E010,
+    0x24810,
+    0x1E6001,
+    0x3001,
+    0xA4414,
+    0x48015,
+    0x6E010,
+    0x24810,
+    0x1E6001,
+    0xA4414,
+    0x48015,
+    0x407001,
+    0x6E010,
+    0x24810,
+    0x20130,
+    0xA01F0,
+    0x1A0534,
+    0x6E010,
+    0x24810,
+    0x20130,
+    0xA01F0,
+    0x1A0534,
+    0x3001,
+    0x6E010,
+    0x24810,
+    0x20130,
+    0xA01F0,
+    0x1A0534,
+    0x407001,
+    0x6E010,
+    0x24810,
+    0x2A099,
+    0xE0011,
+    0x86105,
+    0xC004,
+    0x400801,
+    0x24134,
+    0x224010,
+    0xC914,
+    0x108818,
+    0x32601C,
+    0x6E010,
+    0x24810,
+    0x2A099,
+    0xE0011,
+    0x86105,
+    0xC004,
+    0x400801,
+    0x3001,
+    0x24134,
+    0x224010,
+    0xC914,
+    0x108818,
+    0x32601C,
+    0x6E010,
+    0x24810,
+    0x2A099,
+    0xE0011,
+    0x86105,
+    0xC004,
+    0x400801,
+    0x24134,
+    0x224010,
+    0xC914,
+    0x108818,
+    0x32601C,
+    0x407001,
+    0x6E010,
+    0x24810,
+    0x28011C,
+    0x1C0890,
+    0x1048000,
+    0x6E010,
+    0x24810,
+    0x28011C,
+    0x3001,
+    0x1C0890,
+    0x1048000,
+    0x6E010,
+    0x24810,
+    0x28011C,
+    0x1C0890,
+    0x1048000,
+    0x407001,
+    0x6E010,
+    0x24810,
+    0x1035C7,
+    0x120049,
+    0x81890,
+    0x6808,
+    0x8815,
+    0x6E010,
+    0x24810,
+    0x1035C7,
+    0x120049,
+    0x81890,
+    0x6808,
+    0x3001,
+    0x8815,
+    0x6E010,
+    0x24810,
+    0x1035C7,
+    0x120049,
+    0x81890,
+    0x6808,
+    0x8815,
+    0x407001,
+    0x6E010,
+    0x24810,
+    0x42101,
+    0x801E0,
+    0xA01F0,
+    0x2198,
+    0x2301,
+    0x6E010,
+    0xE0014,
+    0x40D00,
+    0x1040800,
+    0x64918,
+    0xC0891,
+    0x420001,
+    0x24810,
+    0x10090A,
+    0x1E6104,
+    0x800120,
+    0xA0089,
+    0x80081,
+    0x3001,
+    0x6E010,
+    0x12091A,
+    0x25818,
+    0x28111,
+    0x424400,
+    0x424410,
+    0x24810,
+    0x10090A,
+    0x1E6104,
+    0x800120,
+    0xA0089,
+    0x80081,
+    0x3001,
+    0x12091A,
+    0x25818,
+    0x28111,
+    0x424400,
+    0x424410,
+    0x6E010,
+    0x24810,
+    0x10090A,
+    0x1E6104,
+    0x800120,
+    0xA0089,
+    0x80081,
+    0x3001,
+    0x12091A,
+    0x25818,
+    0x28111,
+    0x407001,
+    0x424400,
+    0x424410,
+    0x6E010,
+    0x24810,
+    0x426004,
+    0x27085,
+    0x6812,
+    0x6E010,
+    0x20851,
+    0x1024801,
+    0x10A4801,
+    0x24810,
+    0x426004,
+    0x1020121,
+    0x10A0931,
+    0x10C2021,
+    0x2540,
+    0x2A114,
+    0x1024801,
+    0x10A4801,
+    0x80811,
+    0x6E010,
+    0x24810,
+    0x426004,
+    0x1020121,
+    0x10A0931,
+    0x10C2021,
+    0x6A114,
+    0x112010,
+    0x1024801,
+    0x10A4801,
+    0x80811,
+    0x6E010,
+    0x24810,
+    0x6E010,
+    0x1A2003,
+    0x422151,
+    0x24810,
+    0x3001,
+    0x1A2003,
+    0x422151,
+    0x6E010,
+    0x24810,
+    0x1A2003,
+    0x422151,
+    0x407001,
+    0x6E010,
+    0x24810,
+    0x8005,
+    0x42194,
+    0x100041,
+    0x108141,
+    0x80081,
+    0x5001,
+    0x6E010,
+    0x8100,
+    0x148C05,
+    0x24810,
+    0x200B,
+    0x99,
+    0x600BD,
+    0x383,
+    0x205B4,
+    0x83901,
+    0x80994,
+    0x407001,
+    0x6E010,
+    0x24810,
+    0x25821,
+    0x6E010,
+    0x984018,
+    0x402158,
+    0x24810,
+    0x25821,
+    0x25040,
+    0x3001,
+    0x984018,
+    0x402158,
+    0x6E010,
+    0x24810,
+    0x25821,
+    0x984018,
+    0x402158,
+    0x407001,
+    0x6E010,
+    0x24810,
+    0x6E010,
+    0x200910,
+    0x402158,
+    0x24810,
+    0x3001,
+    0x200910,
+    0x402158,
+    0x6E010,
+    0x24810,
+    0x2011A,
+    0x200910,
+    0x402158,
+    0x407001,
+    0x6E010,
+    0x24810,
+    0xAA051,
+    0x407001,
+    0x6E010,
+    0x24810,
+    0x1000812,
+    0x8481B,
+    0x100820,
+    0x3001,
+    0x2A4011,
+    0xAA051,
+    0x6E010,
+    0x24810,
+    0x1000812,
+    0x8481B,
+    0x100820,
+    0x2A4011,
+    0x6E010,
+    0xAA051,
+    0x1C0038,
+    0x24810,
+    0x1000003,
+    0xE0013,
+    0x200000000E217B,
+    0x2178,
+    0x5000,
+    0xA5090,
+    0x162140,
+    0x407001,
+    0x6E010,
+    0x24810,
+    0x1000003,
+    0x38,
+    0x2178,
+    0x5000,
+    0xA5090,
+    0x1002001,
+    0x426012,
+    0x162140,
+    0x407001,
+    0x6E010,
+    0x24810,
+    0x1000003,
+    0x9,
+    0xA00B1,
+    0x38,
+    0x2178,
+    0x3001,
+    0x1002001,
+    0x426012,
+    0x162140,
+    0x6E010,
+    0x24810,
+    0x1000003,
+    0x38,
+    0x2178,
+    0x1002001,
+    0x426012,
+    0x162140,
+    0xAA011,
+    0x6E010,
+    0x24810,
+    0x2851,
+    0x1000003,
+    0x120084,
+    0x35,
+    0x1020121,
+    0x10A0931,
+    0x10C2021,
+    0x80811,
+    0x6E010,
+    0xA6917,
+    0xE1185,
+    0x140805,
+    0x1020121,
+    0x10C2021,
+    0xA00B1,
+    0x1004989,
+    0x1021010,
+    0xC2001,
+    0x80811,
+    0x841001,
+    0x6E010,
+    0xA6917,
+    0xE1185,
+    0x140805,
+    0x1020121,
+    0x10C2021,
+    0x1004989,
+    0x1021010,
+    0xA5090,
+    0x61000,
+    0xC2001,
+    0x80811,
+    0x841001,
+    0x6E010,
+    0xA6917,
+    0xE1185,
+    0x140805,
+    0x1020121,
+    0x10C2021,
+    0x1004989,
+    0x1021010,
+    0x801000,
+    0xC2001,
+    0x80811,
+    0x841001,
+    0x6E010,
+    0x4048,
+    0x24090,
+    0x16C090,
+    0x56C010,
+    0x10C2021,
+    0x6E010,
+    0x4048,
+    0x24090,
+    0x3001,
+    0x16C090,
+    0x56C010,
+    0x10C2021,
+    0x6E010,
+    0x4048,
+    0x24090,
+    0x26190,
+    0x16C090,
+    0x56C010,
+    0x407001,
+    0x10C2021,
+    0x6E010,
+    0xB,
+    0x23905,
+    0x200910,
+    0x56C010,
+    0x36A911,
+    0x202901,
+    0x10C2021,
+    0x6E010,
+    0xB,
+    0x23905,
+    0x200910,
+    0x3001,
+    0x56C010,
+    0x36A911,
+    0x202901,
+    0x10C2021,
+    0x6E010,
+    0xB,
+    0x23905,
+    0x200910,
+    0x56C010,
+    0x36A911,
+    0x202901,
+    0x407001,
+    0x10C2021,
+    0x6E010,
+    0x10C2021,
+    0x1051,
+    0x1145,
+    0x1008801,
+    0x64014,
+    0x64014,
+    0x1064014,
+    0x48810,
+    0x147000,
+    0x480184,
+    0x2420109,
+    0x6E010,
+    0x10C2021,
+    0x1051,
+    0x1145,
+    0x3001,
+    0x1008801,
+    0x64014,
+    0x64014,
+    0x1064014,
+    0x48810,
+    0x147000,
+    0x480184,
+    0x2420109,
+    0x6E010,
+    0x10C2021,
+    0x1051,
+    0x1145,
+    0x1008801,
+    0x64014,
+    0x64014,
+    0x1064014,
+    0x48810,
+    0x147000,
+    0x480184,
+    0x2420109,
+    0x407001,
+    0x6E010,
+    0x1020121,
+    0x10A0931,
+    0x10C2021,
+    0x1081080,
+    0x6E010,
+    0x808110,
+    0x80811,
+    0x442140,
+    0x1020121,
+    0x10A0931,
+    0x10C2021,
+    0x3001,
+    0x1081080,
+    0x26012,
+    0x6E010,
+    0x808110,
+    0x108404,
+    0x80811,
+    0x442140,
+    0x1020121,
+    0x10A0931,
+    0x10C2021,
+    0x1081080,
+    0x6E010,
+    0x808110,
+    0x80811,
+    0x82101,
+    0x442140,
+    0x407001,
+    0x480A,
+    0x12080D,
+    0x42061,
+    0x406891,
+    0x1060005,
+    0x1EA811,
+    0x80090,
+    0x102019,
+    0x229111,
+    0x10C2021,
+    0x6E010,
+    0x480A,
+    0x42061,
+    0x406891,
+    0x3001,
+    0x1060005,
+    0x1EA811,
+    0x80090,
+    0x102019,
+    0x229111,
+    0x10C2021,
+    0x6E010,
+    0x480A,
+    0x42061,
+    0x406891,
+    0x1060005,
+    0x1EA811,
+    0x80090,
+    0x102019,
+    0x229111,
+    0x407001,
+    0x10C2021,
+    0x6E010,
+    0x1A0015,
+    0x10A0931,
+    0x24C30,
+    0x6F010,
+    0x6015,
+    0x40011,
+    0x62110,
+    0xA2118,
+    0x10C2021,
+    0x6E010,
+    0x1A0015,
+    0x10A0931,
+    0x24C30,
+    0x23011,
+    0x18A010,
+    0x6015,
+    0x4E118,
+    0x40011,
+    0x62110,
+    0xA2118,
+    0xA6100,
+    0x10C2021,
+    0x6E010,
+    0x1A0015,
+    0x10A0931,
+    0x24C30,
+    0x21119,
+    0x427011,
+    0x6015,
+    0x40011,
+    0x62110,
+    0xA2118,
+    0x10C2021,
+    0x6E010,
+    0x830,
+    0x240810,
+    0x83095,
+    0x10C2021,
+    0x24C30,
+    0x1145,
+    0x1945,
+    0x1081080,
+    0x6E010,
+    0x830,
+    0x240810,
+    0x83095,
+    0x10C2021,
+    0x24C30,
+    0x1145,
+    0x1945,
+    0x3001,
+    0x1081080,
+    0x6E010,
+    0x830,
+    0x240810,
+    0x83095,
+    0x10C2021,
+    0x24C30,
+    0x1145,
+    0x1945,
+    0x1081080,
+    0x407001,
+    0x6E010,
+    0x2308,
+    0x10C2021,
+    0x2150,
+    0x2300,
+    0x9801,
+    0x1081080,
+    0x120002,
+    0x440190,
+    0x6E010,
+    0x2308,
+    0x10C2021,
+    0x2150,
+    0x2300,
+    0x9801,
+    0x3001,
+    0x1081080,
+    0x120002,
+    0x440190,
+    0x6E010,
+    0x2308,
+    0x10C2021,
+    0x2150,
+    0x2300,
+    0x9801,
+    0x1081080,
+    0x120002,
+    0x440190,
+    0x407001,
+    0x6E010,
+    0x104C815,
+    0x19,
+    0x406891,
+    0x24080,
+    0x1060005,
+    0x102019,
+    0x402D41,
+    0x2005112,
+    0x10C2021,
+    0x6E010,
+    0x104C815,
+    0x19,
+    0x406891,
+    0x24080,
+    0x3001,
+    0x1060005,
+    0x102019,
+    0x402D41,
+    0x2005112,
+    0x10C2021,
+    0x6E010,
+    0x104C815,
+    0x19,
+    0x406891,
+    0x24080,
+    0x1060005,
+    0x102019,
+    0x402D41,
+    0x407001,
+    0x2005112,
+    0x10C2021,
+    0x6E010,
+    0x1020121,
+    0x10C2021,
+    0xE7010,
+    0x80811,
+    0xA4800,
+    0xA6940,
+    0x6E010,
+    0x84162,
+    0x10A810C,
+    0xE4030,
+    0x82141,
+    0x1020181,
+    0x1D0085,
+    0x444018,
+    0x1080110,
+    0x1A0015,
+    0x10C2021,
+    0x6E010,
+    0x35,
+    0x82150,
+    0x9D,
+    0x41051,
+    0x6E010,
+    0x820811,
+    0x822951,
+    0x46801,
+    0xC4090,
+    0x48001,
+    0xC6110,
+    0x10A8091,
+    0xA3011,
+    0x1280105,
+    0x35,
+    0x82150,
+    0x9D,
+    0x3001,
+    0x41051,
+    0x820811,
+    0x822951,
+    0x46801,
+    0xC4090,
+    0x48001,
+    0xC6110,
+    0x10A8091,
+    0xA3011,
+    0x1280105,
+    0x6E010,
+    0x35,
+    0x82150,
+    0x9D,
+    0x41051,
+    0x820811,
+    0x822951,
+    0x46801,
+    0xC4090,
+    0x48001,
+    0xC6110,
+    0x10A8091,
+    0xA3011,
+    0x407001,
+    0x1280105,
+    0x6E010,
+    0x20013,
+    0x1180013,
+    0xC084,
+    0x10C5854,
+    0x180004,
+    0x25040,
+    0x20181,
+    0x1A0185,
+    0x2C801,
+    0x6E010,
+    0x60091,
+    0x10C0810,
+    0x1280105,
+    0x82150,
+    0x20013,
+    0x1180013,
+    0xC084,
+    0x10C5854,
+    0x180004,
+    0x25040,
+    0x20181,
+    0x1A0185,
+    0x3001,
+    0x2C801,
+    0x6E010,
+    0x60091,
+    0x10C0810,
+    0x1280105,
+    0x82150,
+    0x20013,
+    0x1180013,
+    0xC084,
+    0x10C5854,
+    0x180004,
+    0x25040,
+    0x20181,
+    0x1A0185,
+    0x2C801,
+    0x6E010,
+    0x60091,
+    0x10C0810,
+    0x407001,
+    0x1280105,
+    0x82150,
+    0x1813,
+    0x80141,
+    0x590,
+    0x3001,
+    0x8015,
+    0xEA119,
+    0x6E010,
+    0xE0118,
+    0xE4800,
+    0x400C01,
+    0x402D41,
+    0x1280105,
+    0x1813,
+    0x80141,
+    0x590,
+    0x3001,
+    0x8015,
+    0xEA119,
+    0xE0118,
+    0xE4800,
+    0x400C01,
+    0x402D41,
+    0x1280105,
+    0x6E010,
+    0x1813,
+    0x80141,
+    0x590,
+    0x3001,
+    0x8015,
+    0xEA119,
+    0xE0118,
+    0xE4800,
+    0x400C01,
+    0x402D41,
+    0x407001,
+    0x1280105,
+    0x6E010,
+    0x1813,
+    0x2165,
+    0x80141,
+    0x590,
+    0x3001,
+    0x8015,
+    0xEA119,
+    0x6E010,
+    0xA01C0,
+    0xE0118,
+    0xE4800,
+    0x400C01,
+    0x402D41,
+    0x1280105,
+    0x1813,
+    0x2165,
+    0x80141,
+    0x590,
+    0x3001,
+    0x8015,
+    0xEA119,
+    0xA01C0,
+    0xE0118,
+    0xE4800,
+    0x400C01,
+    0x402D41,
+    0x407001,
+    0x1280105,
+    0x6E010,
+    0x1813,
+    0x2165,
+    0x80141,
+    0x590,
+    0x3001,
+    0x8015,
+    0xEA119,
+    0xA01C0,
+    0xE0118,
+    0xE4800,
+    0x400C01,
+    0x402D41,
+    0x1280105,
+    0x6E010,
+    0x6E010,
+    0xC2009,
+    0xC2149,
+    0x1280105,
+    0x3001,
+    0xC2009,
+    0xC2149,
+    0x1280105,
+    0x6E010,
+    0xC2009,
+    0xC2149,
+    0x407001,
+    0x1280105,
+    0x6E010,
+    0x2C10,
+    0x2D50,
+    0x42410,
+    0x6E010,
+    0x1280105,
+    0x2C10,
+    0x2D50,
+    0x42410,
+    0x3001,
+    0x1280105,
+    0x6E010,
+    0x2C10,
+    0x2D50,
+    0x42410,
+    0x407001,
+    0x1280105,
+    0x6E010,
+    0x2165,
+    0x2C10,
+    0x2D50,
+    0x42410,
+    0x6E010,
+    0xA01C0,
+    0x1280105,
+    0x2165,
+    0x2C10,
+    0x2D50,
+    0x42410,
+    0xA01C0,
+    0x407001,
+    0x1280105,
+    0x6E010,
+    0x2165,
+    0x2C10,
+    0x2D50,
+    0x42410,
+    0x3001,
+    0xA01C0,
+    0x1280105,
+    0x6E010,
+    0x10C0917,
+    0x290A,
+    0x2015,
+    0x6E010,
+    0x2E142,
+    0x480190,
+    0x1280105,
+    0x10C0917,
+    0x290A,
+    0x2015,
+    0x2165,
+    0x6E010,
+    0x2E142,
+    0xA01C0,
+    0x480190,
+    0x1280105,
+    0x10C0917,
+    0x290A,
+    0x2015,
+    0x3001,
+    0x2E142,
+    0x480190,
+    0x1280105,
+    0x6E010,
+    0x10C0917,
+    0x290A,
+    0x2015,
+    0x2165,
+    0x3001,
+    0x2E142,
+    0xA01C0,
+    0x480190,
+    0x1280105,
+    0x6E010,
+    0x10C0917,
+    0x290A,
+    0x2015,
+    0x2E142,
+    0x480190,
+    0x407001,
+    0x1280105,
+    0x6E010,
+    0x10C0917,
+    0x290A,
+    0x2015,
+    0x2165,
+    0x2E142,
+    0xA01C0,
+    0x480190,
+    0x407001,
+    0x1280105,
+    0x6E010,
+    0x10C0917,
+    0x20A5118,
+    0x6E010,
+    0x420995,
+    0x1280105,
+    0x10C0917,
+    0x2165,
+    0x20A5118,
+    0x6E010,
+    0xA01C0,
+    0x420995,
+    0x1280105,
+    0x10C0917,
+    0x3001,
+    0x20A5118,
+    0x420995,
+    0x1280105,
+    0x6E010,
+    0x10C0917,
+    0x2165,
+    0x3001,
+    0x20A5118,
+    0xA01C0,
+    0x420995,
+    0x1280105,
+    0x6E010,
+    0x10C0917,
+    0x20A5118,
+    0x420995,
+    0x407001,
+    0x1280105,
+    0x6E010,
+    0x10C0917,
+    0x2165,
+    0x20A5118,
+    0xA01C0,
+    0x420995,
+    0x407001,
+    0x1280105,
+    0x6E010,
+    0x10C0917,
+    0x103801,
+    0x6E010,
+    0x420995,
+    0x1280105,
+    0x10C0917,
+    0x2165,
+    0x103801,
+    0x6E010,
+    0xA01C0,
+    0x420995,
+    0x1280105,
+    0x10C0917,
+    0x3001,
+    0x103801,
+    0x420995,
+    0x1280105,
+    0x6E010,
+    0x10C0917,
+    0x2165,
+    0x3001,
+    0x103801,
+    0xA01C0,
+    0x420995,
+    0x1280105,
+    0x6E010,
+    0x10C0917,
+    0x103801,
+    0x420995,
+    0x407001,
+    0x1280105,
+    0x6E010,
+    0x10C0917,
+    0x2165,
+    0x103801,
+    0xA01C0,
+    0x420995,
+    0x407001,
+    0x1280105,
+    0x6E010,
+    0xC0021,
+    0x1120080,
+    0xA7081,
+    0x205010,
+    0x6E010,
+    0x110504,
+    0x20015,
+    0x22145,
+    0x122000,
+    0x160080,
+    0x48018,
+    0x1280105,
+    0x122140,
+    0xC0021,
+    0x1120080,
+    0x3001,
+    0xA7081,
+    0x205010,
+    0x110504,
+    0x20015,
+    0x22145,
+    0x122000,
+    0x160080,
+    0x48018,
+    0x1280105,
+    0x6E010,
+    0x122140,
+    0xC0021,
+    0x1120080,
+    0xA7081,
+    0x205010,
+    0x110504,
+    0x20015,
+    0x22145,
+    0x122000,
+    0x160080,
+    0x48018,
+    0x407001,
+    0x1280105,
+    0x6E010,
+    0x122140,
+    0x2165,
+    0xC0021,
+    0x1120080,
+    0xA7081,
+    0x205010,
+    0x6E010,
+    0x110504,
+    0x20015,
+    0x22145,
+    0xA01C0,
+    0x122000,
+    0x160080,
+    0x48018,
+    0x1280105,
+    0x122140,
+    0x2165,
+    0xC0021,
+    0x1120080,
+    0xA7081,
+    0x205010,
+    0x110504,
+    0x20015,
+    0x22145,
+    0xA01C0,
+    0x122000,
+    0x160080,
+    0x48018,
+    0x407001,
+    0x1280105,
+    0x6E010,
+    0x122140,
+    0x2165,
+    0xC0021,
+    0x1120080,
+    0x3001,
+    0xA7081,
+    0x205010,
+    0x110504,
+    0x20015,
+    0x22145,
+    0xA01C0,
+    0x122000,
+    0x160080,
+    0x48018,
+    0x1280105,
+    0x6E010,
+    0x122140,
+    0x80813,
+    0x2201D,
+    0x1280105,
+    0x6E010,
+    0x201D,
+    0x2201D,
+    0x214D,
+    0x82851,
+    0x2C0130,
+    0x20921,
+    0x7835,
+    0x224050,
+    0xFFFFFFFFFFFFFFFF,
+    0x40801,
+    0x86041,
+    0x407001,
+    0x1280105,
+    0x6E010,
+    0x201D,
+    0x2201D,
+    0x214D,
+    0x82851,
+    0x2C0130,
+    0x20921,
+    0x7835,
+    0x224050,
+    0xFFFFFFFFFFFFFFFF,
+    0x3001,
+    0x40801,
+    0x86041,
+    0x1280105,
+    0x6E010,
+    0x142112,
+    0x282951,
+    0x6E010,
+    0x1C0100,
+    0x1280105,
+    0xC0112,
+    0x22,
+    0x1102002,
+    0x1AE015,
+    0x2201D,
+    0x10481A,
+    0x20011,
+    0x8291D,
+    0x28101,
+    0x10A8001,
+    0x10AA141,
+    0xC810,
+    0x1C5811,
+    0x482100,
+    0x4C2110,
+    0x1280105,
+    0x60011,
+    0x6E010,
+    0xC0112,
+    0x22,
+    0x1102002,
+    0x1AE015,
+    0x2201D,
+    0x10481A,
+    0x20011,
+    0x8291D,
+    0x3010,
+    0x28101,
+    0x10A8001,
+    0x10AA141,
+    0xC810,
+    0x1C5811,
+    0x482100,
+    0x4C2110,
+    0x1280105,
+    0x60011,
+    0x6E010,
+    0xC0112,
+    0x22,
+    0x1102002,
+    0x1AE015,
+    0x2201D,
+    0x10481A,
+    0x20011,
+    0x8291D,
+    0x28101,
+    0x10A8001,
+    0x10AA141,
+    0xC810,
+    0x1C5811,
+    0x482100,
+    0x4C2110,
+    0x407010,
+    0x1280105,
+    0x60011,
+    0x6E010,
+    0x1000009,
+    0x964900,
+    0x29011,
+    0x6E010,
+    0x820811,
+    0x25000,
+    0x142001,
+    0x48001,
+    0xC1011,
+    0xC1093,
+    0x502108,
+    0x1280105,
+    0x10C1011,
+    0x1000009,
+    0x964900,
+    0x3001,
+    0x29011,
+    0x820811,
+    0x25000,
+    0x142001,
+    0x48001,
+    0xC1011,
+    0xC1093,
+    0x502108,
+    0x1280105,
+    0x6E010,
+    0x10C1011,
+    0x1000009,
+    0x964900,
+    0x29011,
+    0x820811,
+    0x25000,
+    0x142001,
+    0x48001,
+    0xC1011,
+    0xC1093,
+    0x502108,
+    0x407001,
+    0x1280105,
+    0x6E010,
+    0x10C1011,
+    0x1906,
+    0x21916,
+    0x3946,
+    0x187101,
+    0x6E010,
+    0x24404,
+    0x40815,
+    0x108000,
+    0x1280105,
+    0x1906,
+    0x21916,
+    0x3946,
+    0x3001,
+    0x187101,
+    0x24404,
+    0x40815,
+    0x108000,
+    0x1280105,
+    0x6E010,
+    0x1906,
+    0x21916,
+    0x3946,
+    0x187101,
+    0x24404,
+    0x40815,
+    0x108000,
+    0x407001,
+    0x1280105,
+    0x6E010,
+    0x22034,
+    0x2174,
+    0x6E010,
+    0x464008,
+    0xEC000,
+    0x64090,
+    0x1004614,
+    0x64095,
+    0x22145,
+    0x22148,
+    0xEC000,
+    0x6E010,
+    0x40500,
+    0x60510,
+    0x446000,
+    0x6E010,
+    0xEC000,
+    0x40500,
+    0x446000,
+    0x46600B,
+    0x46601B,
+    0xEC000,
+    0x6E010,
+    0x803,
+    0x2011A,
+    0x100000D,
+    0x222148,
+    0x4860,
+    0x6960,
+    0x22050,
+    0x6E010,
+    0x8041,
+    0x188000,
+    0x22051,
+    0x80010,
+    0xEC000,
+    0x803,
+    0x2011A,
+    0x100000D,
+    0x222148,
+    0x4860,
+    0x6960,
+    0x22050,
+    0x3001,
+    0x8041,
+    0x188000,
+    0x22051,
+    0x80010,
+    0x6E010,
+    0xEC000,
+    0x803,
+    0x2011A,
+    0x100000D,
+    0x222148,
+    0x4860,
+    0x6960,
+    0x22050,
+    0x8041,
+    0x188000,
+    0x22051,
+    0x80010,
+    0x407001,
+    0x6E010,
+    0xEC000,
+    0x97,
+    0x6015,
+    0x6E010,
+    0xEC000,
+    0x160020,
+    0x160030,
+    0x162160,
+    0x440810,
+    0x640011,
+    0x97,
+    0x3001,
+    0x6015,
+    0xEC000,
+    0x160020,
+    0x160030,
+    0x162160,
+    0x440810,
+    0x640011,
+    0x6E010,
+    0x97,
+    0x6015,
+    0x6E010,
+    0xEC000,
+    0x160020,
+    0x160030,
+    0x162160,
+    0x440810,
+    0x640011,
+    0x407001,
+    0x84003,
+    0x6015,
+    0x160114,
+    0x421E0,
+    0xC11,
+    0x24001,
+    0x8819,
+    0x6E010,
+    0xA0021,
+    0x220110,
+    0x424000,
+    0x4A4003,
+    0x426140,
+    0xEC000,
+    0x84003,
+    0x6015,
+    0x160114,
+    0x421E0,
+    0xC11,
+    0x3001,
+    0x24001,
+    0x8819,
+    0xA0021,
+    0x220110,
+    0x424000,
+    0x4A4003,
+    0x426140,
+    0x6E010,
+    0xEC000,
+    0x84003,
+    0x6015,
+    0x160114,
+    0x421E0,
+    0xC11,
+    0x24001,
+    0x8819,
+    0xA0021,
+    0x220110,
+    0x424000,
+    0x4A4003,
+    0x426140,
+    0x407001,
+    0x6E010,
+    0xEC000,
+    0x10E0830,
+    0x6E010,
+    0xEC000,
+    0x441100,
+    0x461110,
+    0x443140,
+    0xA6981,
+    0x10E0830,
+    0x3001,
+    0xEC000,
+    0x441100,
+    0x461110,
+    0x443140,
+    0xA6981,
+    0x6E010,
+    0x10E0830,
+    0x3001,
+    0xEC000,
+    0x441100,
+    0x461110,
+    0x443140,
+    0xA6981,
+    0x6E010,
+    0x407001,
+    0x80995,
+    0x803,
+    0xC0C13,
+    0x106146,
+    0x4F185,
+    0x2091A,
+    0x82010,
+    0x6E010,
+    0x1028811,
+    0x4A4080,
+    0xEC000,
+    0x80995,
+    0x803,
+    0xC0C13,
+    0x106146,
+    0x4F185,
+    0x2091A,
+    0x3001,
+    0x82010,
+    0x1028811,
+    0x4A4080,
+    0x6E010,
+    0xEC000,
+    0x80995,
+    0x803,
+    0xC0C13,
+    0x106146,
+    0x4F185,
+    0x2091A,
+    0x82010,
+    0x1028811,
+    0x4A4080,
+    0x407001,
+    0x6E010,
+    0xEC000,
+    0x20813,
+    0x112491A,
+    0x80939,
+    0xA0930,
+    0x82960,
+    0x6E010,
+    0x4AE970,
+    0x4801D0,
+    0x4A09F0,
+    0x4C01D0,
+    0x5A4400,
+    0xEC000,
+    0x20813,
+    0x112491A,
+    0x80939,
+    0xA0930,
+    0x82960,
+    0x3001,
+    0x4AE970,
+    0x4801D0,
+    0x4A09F0,
+    0x4C01D0,
+    0x5A4400,
+    0x6E010,
+    0xEC000,
+    0x20813,
+    0x112491A,
+    0x80939,
+    0xA0930,
+    0x82960,
+    0x4AE970,
+    0x4801D0,
+    0x4A09F0,
+    0x4C01D0,
+    0x407001,
+    0x5A4400,
+    0x6E010,
+    0xEC000,
+    0x1000916,
+    0x10C0906,
+    0x512,
+    0x2542,
+    0x1000814,
+    0x10C0904,
+    0x6E010,
+    0x22148,
+    0xEC000,
+    0x1000916,
+    0x10C0906,
+    0x512,
+    0x2542,
+    0x1000814,
+    0x10C0904,
+    0x3001,
+    0x22148,
+    0xEC000,
+    0x6E010,
+    0x1000916,
+    0x10C0906,
+    0x512,
+    0x2542,
+    0x1000814,
+    0x10C0904,
+    0x22148,
+    0xEC000,
+    0x407001,
+    0x6E010,
+    0x1000916,
+    0x10C0906,
+    0x512,
+    0x2542,
+    0x1000814,
+    0x10C0904,
+    0x187101,
+    0x6E010,
+    0x22148,
+    0xEC000,
+    0x1000916,
+    0x10C0906,
+    0x512,
+    0x2542,
+    0x1000814,
+    0x10C0904,
+    0x3001,
+    0x187101,
+    0x22148,
+    0xEC000,
+    0x6E010,
+    0x1000916,
+    0x10C0906,
+    0x512,
+    0x2542,
+    0x1000814,
+    0x10C0904,
+    0x187101,
+    0x22148,
+    0xEC000,
+    0x407001,
+    0x6E010,
+    0x280115,
+    0x4A0895,
+    0x4A29D5,
+    0x88011C,
+    0x8920,
+    0x10C3145,
+    0x1008081,
+    0x6E010,
+    0x1E5811,
+    0xEC000,
+    0x280115,
+    0x4A0895,
+    0x4A29D5,
+    0x88011C,
+    0x8920,
+    0x10C3145,
+    0x1008081,
+    0x3001,
+    0x1E5811,
+    0x6E010,
+    0xEC000,
+    0x280115,
+    0x4A0895,
+    0x4A29D5,
+    0x88011C,
+    0x8920,
+    0x10C3145,
+    0x1008081,
+    0x1E5811,
+    0x407001,
+    0x6E010,
+    0xEC000,
+    0x85007,
+    0x100818,
+    0x28851,
+    0xC810,
+    0x22140,
+    0x1A7011,
+    0x4E0810,
+    0x4E2950,
+    0x6E010,
+    0xEC000,
+    0x85007,
+    0x100818,
+    0x28851,
+    0x3010,
+    0x22140,
+    0x1A7011,
+    0x4E0810,
+    0x4E2950,
+    0x6E010,
+    0xEC000,
+    0x85007,
+    0x100818,
+    0x28851,
+    0x22140,
+    0x1A7011,
+    0x407010,
+    0x4E0810,
+    0x4E2950,
+    0x6E010,
+    0xEC000,
+    0x6E010,
+    0x100A941,
+    0xC800,
+    0xEC000,
+    0x443140,
+    0x4A0011,
+    0x4AC811,
+    0x3001,
+    0x100A941,
+    0xC800,
+    0xEC000,
+    0x443140,
+    0x4A0011,
+    0x4AC811,
+    0x6E010,
+    0x100A941,
+    0xC800,
+    0xEC000,
+    0x443140,
+    0x4A0011,
+    0x4AC811,
+    0x407001,
+    0x6E010,
+    0xC0995,
+    0x803,
+    0x80085,
+    0x100484,
+    0x288B,
+    0x120880,
+    0x4802,
+    0x6E010,
+    0x88184,
+    0x100A941,
+    0xEC000,
+    0x4A4080,
+    0xC4000,
+    0xC0995,
+    0x803,
+    0x80085,
+    0x100484,
+    0x288B,
+    0x120880,
+    0x4802,
+    0x3001,
+    0x88184,
+    0x100A941,
+    0xEC000,
+    0x4A4080,
+    0xC4000,
+    0x6E010,
+    0xC0995,
+    0x803,
+    0x80085,
+    0x100484,
+    0x288B,
+    0x120880,
+    0x4802,
+    0x88184,
+    0x100A941,
+    0xEC000,
+    0x4A4080,
+    0xC4000,
+    0x407001,
+    0x6E010,
+    0x80005,
+    0x2817,
+    0x2947,
+    0x2899,
+    0x100A50,
+    0x102B40,
+    0x3051,
+    0x1C1D01,
+    0x6E010,
+    0x40D00,
+    0xEC000,
+    0x80005,
+    0x2817,
+    0x2947,
+    0x2899,
+    0x100A50,
+    0x102B40,
+    0x3001,
+    0x3051,
+    0x1C1D01,
+    0x40D00,
+    0x6E010,
+    0xEC000,
+    0x80005,
+    0x2817,
+    0x2947,
+    0x2899,
+    0x100A50,
+    0x102B40,
+    0x3051,
+    0x1C1D01,
+    0x40D00,
+    0x407001,
+    0x6E010,
+    0xEC000,
+    0x64004,
+    0x858,
+    0x40850,
+    0x1C4800,
+    0x87119,
+    0x8015,
+    0x6E010,
+    0xCE100,
+    0x820811,
+    0x10E2110,
+    0x1004041,
+    0x1004140,
+    0x2002010,
+    0xE2150,
+    0x64004,
+    0x858,
+    0x40850,
+    0x1C4800,
+    0x3001,
+    0x87119,
+    0x8015,
+    0xCE100,
+    0x820811,
+    0x10E2110,
+    0x1004041,
+    0x1004140,
+    0x2002010,
+    0x6E010,
+    0xE2150,
+    0x64004,
+    0x858,
+    0x40850,
+    0x1C4800,
+    0x87119,
+    0x8015,
+    0xCE100,
+    0x820811,
+    0x10E2110,
+    0x407001,
+    0x1004041,
+    0x1004140,
+    0x2002010,
+    0x6E010,
+    0xE2150,
+    0x80083,
+    0x180083,
+    0x6E010,
+    0x82541,
+    0x180002,
+    0xE2150,
+    0x1A,
+    0x8111A,
+    0x4048,
+    0x861C8,
+    0x84890,
+    0xA001,
+    0x821C0,
+    0x6E010,
+    0x48810,
+    0xA0118,
+    0x2000000,
+    0xE2150,
+    0x13,
+    0xC0112,
+    0x22,
+    0x10C814,
+    0x82149,
+    0xA0920,
+    0x62138,
+    0x2089,
+    0x4888,
+    0xC810,
+    0x4C2100,
+    0x1001921,
+    0x42089,
+    0x69C8,
+    0x13,
+    0xC0112,
+    0x22,
+    0x10C814,
+    0x82149,
+    0xA0920,
+    0x62138,
+    0x60940,
+    0x2089,
+    0x4888,
+    0xE0110,
+    0x4C2100,
+    0x407010,
+    0x1001921,
+    0x42089,
+    0x69C8,
+    0x13,
+    0xC0112,
+    0x22,
+    0x10C814,
+    0x82149,
+    0xA0920,
+    0x62138,
+    0x2089,
+    0x4888,
+    0x3001,
+    0x4C2100,
+    0x407001,
+    0x1001921,
+    0x42089,
+    0x69C8,
+    0x13,
+    0xC0112,
+    0x22,
+    0x1044002,
+    0xE4092,
+    0x10C814,
+    0x82149,
+    0xA0920,
+    0x62138,
+    0x2089,
+    0x4888,
+    0x3010,
+    0x4C2100,
+    0x1001921,
+    0x42089,
+    0x69C8,
+    0x1262111,
+    0x13,
+    0x13,
+    0x10C814,
+    0x80019,
+    0x82149,
+    0xA0091,
+    0x40500,
+    0x204810,
+    0x401081,
+    0x6E010,
+    0x27015,
+    0xA40D0,
+    0x804000,
+    0x1001921,
+    0x1262111,
+    0x13,
+    0x13,
+    0x10C814,
+    0x80019,
+    0x82149,
+    0xA0091,
+    0x40500,
+    0x204810,
+    0x3001,
+    0x401081,
+    0x6E010,
+    0x27015,
+    0xA40D0,
+    0x407001,
+    0x804000,
+    0x1001921,
+    0x1262111,
+    0x13,
+    0x13,
+    0x10C814,
+    0x80019,
+    0x82149,
+    0xA0091,
+    0x40500,
+    0x204810,
+    0x3001,
+    0x401081,
+    0x6E010,
+    0x27015,
+    0xA40D0,
+    0x804000,
+    0x1001921,
+    0x1262111,
+    0x13,
+    0x13,
+    0x10C814,
+    0x80019,
+    0x82149,
+    0xA0091,
+    0x40500,
+    0x204810,
+    0x401081,
+    0x6E010,
+    0x27015,
+    0xA40D0,
+    0x407001,
+    0x804000,
+    0x1001921,
+    0x1262111,
+    0x13,
+    0x13,
+    0x10C814,
+    0x82149,
+    0xA0091,
+    0x40500,
+    0x204810,
+    0x6E010,
+    0xEE991,
+    0x27015,
+    0xA40D0,
+    0x1104000,
+    0x1001921,
+    0x1262111,
+    0x13,
+    0x13,
+    0x10C814,
+    0x82149,
+    0xA0091,
+    0x40500,
+    0x204810,
+    0x3001,
+    0x6E010,
+    0xEE991,
+    0x27015,
+    0xA40D0,
+    0x407001,
+    0x1104000,
+    0x1001921,
+    0x1262111,
+    0x13,
+    0x13,
+    0x10C814,
+    0x82149,
+    0xA0091,
+    0x40500,
+    0x204810,
+    0x3001,
+    0x6E010,
+    0xEE991,
+    0x27015,
+    0xA40D0,
+    0x1104000,
+    0x1001921,
+    0x1262111,
+    0x13,
+    0x13,
+    0x10C814,
+    0x82149,
+    0xA0091,
+    0x40500,
+    0x204810,
+    0x6E010,
+    0xEE991,
+    0x27015,
+    0xA40D0,
+    0x407001,
+    0x1104000,
+    0x1001921,
+    0x1004002,
+    0x98C,
+    0x1001921,
+    0x3001,
+    0x407001,
+    0x98C,
+    0x1001921,
+    0x20940,
+    0x3001,
+    0x407001,
+    0x1004002,
+    0x98C,
+    0x1001921,
+    0x20940,
+    0x3001,
+    0x407001,
+    0x1004002,
+    0x98C,
+    0x1001921,
+    0x3001,
+    0x407001,
+    0x98C,
+    0x1001921,
+    0x20940,
+    0x3001,
+    0x407001,
+    0x1004002,
+    0x98C,
+    0x1001921,
+    0x3001,
+    0x98C,
+    0x1001921,
+    0x20940,
+    0x3001,
+    0x1004002,
+    0x98C,
+    0x1001921,
+    0x20940,
+    0x3001,
+    0x1004002,
+    0x98C,
+    0x1001921,
+    0x3001,
+    0x98C,
+    0x1001921,
+    0x20940,
+    0x3001,
+    0x1004002,
+    0x98C,
+    0x1001921,
+    0x407001,
+    0x98C,
+    0x1001921,
+    0x20940,
+    0x407001,
+    0x1004002,
+    0x98C,
+    0x1001921,
+    0x20940,
+    0x407001,
+    0x1004002,
+    0x98C,
+    0x1001921,
+    0x407001,
+    0x98C,
+    0x1001921,
+    0x20940,
+    0x407001,
+    0x1004002,
+    0x98C,
+    0x1001921,
+    0x3001,
+    0x1004002,
+    0x98C,
+    0x1001921,
+    0x3001,
+    0x98C,
+    0x1001921,
+    0x20940,
+    0x3001,
+    0x1004002,
+    0x98C,
+    0x1001921,
+    0x20940,
+    0x3001,
+    0x98C,
+    0x1001921,
+    0x20940,
+    0x3001,
+    0x1004002,
+    0x98C,
+    0x1001921,
+    0x407001,
+    0x1004002,
+    0x98C,
+    0x1001921,
+    0x407001,
+    0x98C,
+    0x1001921,
+    0x20940,
+    0x407001,
+    0x1004002,
+    0x98C,
+    0x1001921,
+    0x20940,
+    0x407001,
+    0x98C,
+    0x1001921,
+    0x20940,
+    0x407001,
+    0x35,
+    0x99,
+    0x1C4990,
+    0x48411,
+    0x4A551,
+    0x6E010,
+    0x1045802,
+    0x1C0002,
+    0x11E5110,
+    0x444089,
+    0x1C4990,
+    0x6E010,
+    0x1045802,
+    0x22,
+    0x1C0002,
+    0x1C0002,
+    0x1226010,
+    0x22138,
+    0x62138,
+    0xC810,
+    0x1C4990,
+    0x6E010,
+    0x1045802,
+    0xA5024,
+    0x21017,
+    0x420831,
+    0x6A1B8,
+    0x100405A,
+    0x4890,
+    0x1000C0,
+    0x1021C0,
+    0x204810,
+    0xC810,
+    0xC2481,
+    0x6E010,
+    0x1045802,
+    0x98C,
+    0x1001921,
+    0x6E010,
+    0x1045802,
+    0x180809,
+    0x98C,
+    0x1001921,
+    0x6E010,
+    0x1045802,
+    0x180809,
+    0x98C,
+    0x1001921,
+    0x6E010,
+    0x1045802,
+    0x180809,
+    0x98C,
+    0x1001921,
+    0x6E010,
+    0x1045802,
+    0x180809,
+    0x98C,
+    0x1001921,
+    0x6E010,
+    0x1045802,
+    0xA4033,
+    0x869C4,
+    0xAE120,
+    0xEE120,
+    0x405000,
+    0xAA100,
+    0x400C01,
+    0x6E010,
+    0x1045802,
+    0x100814,
+    0x21114,
+    0x28011C,
+    0xAA170,
+    0x66134,
+    0x1082118,
+    0x10E1010,
+    0xAA100,
+    0x10C0031,
+    0xA0015,
+    0x6E010,
+    0x1045802,
+    0x3901,
+    0x2003,
+    0x35,
+    0x1007410,
+    0x1801,
+    0x3901,
+    0x2003,
+    0x1007410,
+    0x1801,
+    0x3901,
+    0x24941,
+    0x1801,
+    0x3901,
+    0x8011,
+    0x1007410,
+    0x1A6041,
+    0x1801,
+    0x6400B,
+    0x3901,
+    0x4048,
+    0x35,
+    0x88010,
+    0x148110,
+    0x1108000,
+    0x1801,
+    0x3901,
+    0x43901,
+    0x4048,
+    0x44048,
+    0x88010,
+    0x1801,
+    0x10C0917,
+    0x3901,
+    0x290A,
+    0x4048,
+    0x100158,
+    0x1801,
+    0x10C0917,
+    0x3901,
+    0xC2115,
+    0x4048,
+    0x260114,
+    0x1801,
+    0x3901,
+    0x4048,
+    0x1100820,
+    0xC818,
+    0x1801,
+    0x3901,
+    0x35,
+    0x404820,
+    0x1801,
+    0x3901,
+    0x35,
+    0x804020,
+    0x1801,
+    0x3901,
+    0x164104,
+    0x26005,
+    0x1040800,
+    0x1801,
+    0x3901,
+    0x80005,
+    0x35,
+    0x82510,
+    0x1080500,
+    0x88010,
+    0x1801,
+    0x3901,
+    0x43901,
+    0x80005,
+    0xC0005,
+    0x82510,
+    0x88010,
+    0x1801,
+    0x3901,
+    0xC07,
+    0x80005,
+    0x2930,
+    0x406891,
+    0x405010,
+    0x1102C04,
+    0x1801,
+    0x8881,
+    0x3901,
+    0x35,
+    0x4810,
+    0x6900,
+    0x3011,
+    0x24018,
+    0x420001,
+    0x24001,
+    0x60121,
+    0xE6040,
+    0x200410D,
+    0x1801,
+    0x3901,
+    0x142,
+    0x80005,
+    0x35,
+    0xAC019,
+    0xA0150,
+    0x1801,
+    0x3901,
+    0x142,
+    0x80005,
+    0xAC019,
+    0xA0150,
+    0x2004000,
+    0x1801,
+    0x3901,
+    0x142,
+    0x80005,
+    0x2C819,
+    0xAC019,
+    0x2004000,
+    0x1801,
+    0x3901,
+    0x60059,
+    0x112110,
+    0x35,
+    0x21021,
+    0x64090,
+    0x64090,
+    0x1801,
+    0x40815,
+    0x3901,
+    0xE2811,
+    0xC10,
+    0x1801,
+    0x45010,
+    0x3901,
+    0x40001,
+    0x124002,
+    0x1006418,
+    0x1002180,
+    0x1801,
+    0x101810,
+    0x1E6002,
+    0x3901,
+    0x1F2111,
+    0x21021,
+    0x64090,
+    0x64095,
+    0x22145,
+    0x1801,
+    0x35,
+    0x126104,
+    0x3901,
+    0x1801,
+    0x3901,
+    0xE8110,
+    0x2020013,
+    0x1801,
+    0x3901,
+    0x20018,
+    0x1801,
+    0x3901,
+    0x46102,
+    0x104823,
+    0x20098,
+    0x4C2110,
+    0x1801,
+    0x3901,
+    0x404004,
+    0x35,
+    0x21021,
+    0x1D00,
+    0x5000,
+    0x1801,
+    0x3901,
+    0x43901,
+    0x100802,
+    0x21021,
+    0x804000,
+    0x1E0001,
+    0x200410D,
+    0x1801,
+    0x3901,
+    0x104823,
+    0x4A0011,
+    0x2004000,
+    0x1801,
+    0x3901,
+    0x43901,
+    0x404004,
+    0x21021,
+    0x1D00,
+    0x5000,
+    0x1801,
+    0x3901,
+    0x6007,
+    0x35,
+    0x21021,
+    0x8140,
+    0x2C400,
+    0x1801,
+    0x3901,
+    0x6007,
+    0x21021,
+    0x8140,
+    0x2C400,
+    0x444000,
+    0x1801,
+    0x3901,
+    0x24003,
+    0x8140,
+    0x1801,
+    0x3901,
+    0x35,
+    0x21021,
+    0x46010,
+    0x8140,
+    0x41810,
+    0x1C6000,
+    0x1801,
+    0x3901,
+    0x60111,
+    0x66080,
+    0x1811,
+    0x21001,
+    0x48090,
+    0x200410D,
+    0x2004000,
+    0x1801,
+    0x3901,
+    0x3,
+    0x400010,
+    0x21021,
+    0x1831,
+    0x1100820,
+    0x1803,
+    0x48090,
+    0x404800,
+    0x1801,
+    0x3901,
+    0x2E105,
+    0x21021,
+    0x84041,
+    0x1D00,
+    0x200410D,
+    0x1801,
+    0x3901,
+    0x1815,
+    0xE0018,
+    0x1025019,
+    0x109080,
+    0x6010,
+    0x1801,
+    0x3901,
+    0xA2107,
+    0x1815,
+    0xE0018,
+    0x109080,
+    0x484000,
+    0x2000000058D080,
+    0x1801,
+    0x8805,
+    0x3901,
+    0x106045,
+    0x1801,
+    0xFFFFFFFFFFFFFFFF,
+    0x404800,
+    0x1801,
+    0x3901,
+    0x20171,
+    0xCC000,
+    0x1801,
+    0x3901,
+    0x8A891,
+    0x1801,
+    0x3901,
+    0x886114,
+    0x20851,
+    0x85081,
+    0x1C0400,
+    0x1404800,
+    0x1801,
+    0x3901,
+    0x66194,
+    0x1801,
+    0x3901,
+    0xC180,
+    0x1CD181,
+    0x1801,
+    0x3901,
+    0x35,
+    0x145010,
+    0x1801,
+    0x3901,
+    0x43901,
+    0x145010,
+    0x1801,
+    0x3901,
+    0xA0001,
+    0x1801,
+    0x3901,
+    0x35,
+    0xE1091,
+    0x88010,
+    0x1801,
+    0x3901,
+    0x1102002,
+    0x35,
+    0x88010,
+    0xA0103,
+    0x1801,
+    0x3901,
+    0x1102002,
+    0x88010,
+    0xA0103,
+    0x1801,
+    0x3901,
+    0x10B584,
+    0x170910,
+    0x1801,
+    0x3901,
+    0x220013,
+    0x1009,
+    0x80090,
+    0x1801,
+    0x3901,
+    0x40D8,
+    0x104A100,
+    0x1801,
+    0x3901,
+    0x80003,
+    0x229111,
+    0x1801,
+    0x3901,
+    0x20013,
+    0x35,
+    0x3020940,
+    0x424840,
+    0x1006090,
+    0x1801,
+    0x3901,
+    0xA0105,
+    0x20013,
+    0x2C801,
+    0x480190,
+    0x1801,
+    0x3901,
+    0x1E0901,
+    0x20013,
+    0x406008,
+    0x35,
+    0x4C01,
+    0x169901,
+    0x122018,
+    0x1801,
+    0x3901,
+    0x5003,
+    0x35,
+    0xA009,
+    0x1801,
+    0x3000801,
+    0xC4880,
+    0x444800,
+    0x3901,
+    0x1801,
+    0x3901,
+    0x421E0,
+    0xA4010,
+    0x1108821,
+    0x1801,
+    0x3901,
+    0x142400,
+    0xC2500,
+    0x1801,
+    0x3901,
+    0x1004210,
+    0x109200,
+    0x26441,
+    0x169901,
+    0x1801,
+    0x3901,
+    0x2005B,
+    0x1006090,
+    0xE8010,
+    0x1801,
+    0x80030,
+    0x408001,
+    0x448001,
+    0xAA100,
+    0xEA100,
+    0x3901,
+    0x1801,
+    0x2010A,
+    0x4852,
+    0x2C25C1,
+    0x11A0410,
+    0x3901,
+    0x3901,
+    0x2010A,
+    0x2594,
+    0x10A69C0,
+    0x3901,
+    0x2010A,
+    0x10A69C0,
+    0xE4010,
+    0x3901,
+    0x1000003,
+    0x2010A,
+    0x584,
+    0x50,
+    0x821C5,
+    0x3901,
+    0x1000003,
+    0x2010A,
+    0x584,
+    0x10A69C0,
+    0x3901,
+    0x1000003,
+    0x2010A,
+    0x584,
+    0x200000000A6165,
+    0x426012,
+    0x10A69C0,
+    0x2165,
+    0xA6020,
+    0x3901,
+    0x2010A,
+    0x10A69C0,
+    0x3901,
+    0xA2105,
+    0x2010A,
+    0x10A69C0,
+    0x10A150,
+    0x2010A,
+    0x204018,
+    0x1000820,
+    0x10A69C0,
+    0x8015,
+    0x3901,
+    0x3901,
+    0x2010A,
+    0x851,
+    0x10A69C0,
+    0x3901,
+    0x2010A,
+    0x10040C,
+    0x10A69C0,
+    0x3901,
+    0x2010A,
+    0x1082054,
+    0x102D4C,
+    0x10A69C0,
+    0x442001,
+    0x1100840,
+    0x3901,
+    0x2010A,
+    0x10A69C0,
+    0x404800,
+    0x440110,
+    0x3901,
+    0x2010A,
+    0x4008,
+    0x886114,
+    0x20851,
+    0x10A69C0,
+    0x2010A,
+    0xA00B1,
+    0x809E0,
+    0x809C0,
+    0x109851,
+    0x3901,
+    0x3901,
+    0x2010A,
+    0x1087823,
+    0x7961,
+    0x10A69C0,
+    0xAC905,
+    0x3901,
+    0x2010A,
+    0x124824,
+    0x10A69C0,
+    0x1C6111,
+    0xC415,
+    0xA091,
+    0x10A8010,
+    0x12C008,
+    0x3901,
+    0x2010A,
+    0x10A69C0,
+    0xAC001,
+    0xA8111,
+    0x80C01,
+    0x2955,
+    0x4201D,
+    0x286101,
+    0x2010A,
+    0x1000820,
+    0x1002960,
+    0x1202891,
+    0x10858C0,
+    0x64001,
+    0x402140,
+    0x3901,
+    0x3901,
+    0x413,
+    0x2010A,
+    0xC07,
+    0x400005,
+    0x22410C,
+    0x424004,
+    0x10A69C0,
+    0x222011,
+    0x24400,
+    0x3901,
+    0x2010A,
+    0x10040C,
+    0x4C24,
+    0x404820,
+    0x851,
+    0x22059,
+    0x40050,
+    0x44050,
+    0x6480,
+    0x10A69C0,
+    0x1040900,
+    0x4201D,
+    0x46115,
+    0x21050,
+    0x10C2021,
+    0x2013A,
+    0x1024840,
+    0xA5901,
+    0x80E190,
+    0xA0192,
+    0xA6115,
+    0x2A2110,
+    0x422811,
+    0x220911,
+    0x220110,
+    0x60110,
+    0xE7021,
+    0x3901,
+    0x2010A,
+    0x3901,
+    0x35,
+    0x24060,
+    0xB183,
+    0x3901,
+    0x2491C,
+    0x2004000,
+    0xA8910,
+    0x3901,
+    0xAA111,
+    0xE4110,
+    0x1A0810,
+    0xA8910,
+    0x3901,
+    0x2020909,
+    0xA8910,
+    0x3901,
+    0x20013,
+    0x14C184,
+    0xEA010,
+    0x42411,
+    0x200410D,
+    0xA8910,
+    0x3901,
+    0x26049,
+    0x35,
+    0x1020121,
+    0x10A0931,
+    0x80811,
+    0xA8910,
+    0x3901,
+    0x26049,
+    0x1020121,
+    0x10A0931,
+    0xC25C0,
+    0x80811,
+    0xA8910,
+    0x164187,
+    0x1E6003,
+    0x166109,
+    0x14C90C,
+    0x16C009,
+    0x3901,
+    0xA8910,
+    0x166109,
+    0x820010,
+    0x80000,
+    0x200000008A0010,
+    0x11E6001,
+    0x3901,
+    0xA8910,
+    0x3901,
+    0x97,
+    0x35,
+    0x6015,
+    0x1CE140,
+    0x400891,
+    0x23111,
+    0x3901,
+    0x97,
+    0x6015,
+    0x400891,
+    0x23111,
+    0x3901,
+    0x97,
+    0xE988,
+    0x28930,
+    0x6015,
+    0x23111,
+    0x23111,
+    0x6015,
+    0x400891,
+    0x3901,
+    0x24005,
+    0x3901,
+    0x6900,
+    0x6015,
+    0x40011,
+    0x40811,
+    0x23111,
+    0x3901,
+    0x22118,
+    0x401A0,
+    0x401B0,
+    0x421E0,
+    0x48114,
+    0x200410D,
+    0x23111,
+    0x3901,
+    0x401A0,
+    0x401B0,
+    0xAC905,
+    0x23111,
+    0x3901,
+    0x4449A2,
+    0x401A0,
+    0x23111,
+    0x3901,
+    0x401A0,
+    0x60481,
+    0x23111,
+    0x3901,
+    0x1A0015,
+    0x6015,
+    0x1CC004,
+    0x23111,
+    0x3901,
+    0x97,
+    0x6084,
+    0x40011,
+    0x40890,
+    0x68901,
+    0x23111,
+    0x20D5,
+    0x81915,
+    0x24805,
+    0x6015,
+    0x20030,
+    0x40011,
+    0x3901,
+    0x23111,
+    0x3901,
+    0x131101,
+    0x122002,
+    0x2A2113,
+    0x1000A10,
+    0x1040BB0,
+    0x930,
+    0x23111,
+    0x6015,
+    0x104084,
+    0x8EC01,
+    0x40011,
+    0xC2140,
+    0xE2150,
+    0xC2815,
+    0x22015,
+    0x20007,
+    0x200410D,
+    0x3901,
+    0x23111,
+    0x3901,
+    0x150112,
+    0x440805,
+    0xE4812,
+    0x44039,
+    0x23111,
+    0x4028,
+    0x409B0,
+    0x69180,
+    0x41801,
+    0x3901,
+    0x23111,
+    0x3901,
+    0x4028,
+    0x145C00,
+    0x150108,
+    0x23111,
+    0x202148,
+    0x10E4010,
+    0x28811,
+    0x3901,
+    0x23111,
+    0x3901,
+    0xE4055,
+    0x22059,
+    0x1A2011,
+    0x140840,
+    0x42901,
+    0x100042,
+    0x11A0832,
+    0xC2114,
+    0x10A8010,
+    0x3901,
+    0x100042,
+    0x3901,
+    0x100042,
+    0x22059,
+    0xC2114,
+    0x3901,
+    0x82001,
+    0x22059,
+    0xC2114,
+    0x100042,
+    0x3901,
+    0x12,
+    0x101812,
+    0x1006090,
+    0x1006092,
+    0xC2114,
+    0x1A2011,
+    0x6A140,
+    0x100042,
+    0x3901,
+    0x80812,
+    0x100042,
+    0xC2114,
+    0x3901,
+    0x80812,
+    0x22059,
+    0xC2114,
+    0x1000809,
+    0x102090B,
+    0x110084B,
+    0x1A2011,
+    0x100042,
+    0x3901,
+    0x100042,
+    0xA0514,
+    0x6C0D1,
+    0xC2114,
+    0xAC091,
+    0x3901,
+    0x24485,
+    0xC2114,
+    0xC8010,
+    0x24085,
+    0x100042,
+    0x3901,
+    0xC2114,
+    0x68118,
+    0x100042,
+    0x68118,
+    0x400012,
+    0x3901,
+    0x100042,
+    0x6C104,
+    0x6E104,
+    0x16C104,
+    0x200410D,
+    0x3901,
+    0x100042,
+    0x80112,
+    0x40119,
+    0x220030,
+    0xC2114,
+    0x21901,
+    0x1D5100,
+    0xC8010,
+    0x360100,
+    0x3901,
+    0x100042,
+    0x3901,
+    0x40119,
+    0x1000820,
+    0xC2114,
+    0x85041,
+    0xC8010,
+    0xA6140,
+    0x100042,
+    0x3901,
+    0x2919,
+    0x4A5091,
+    0xE8111,
+    0x425000,
+    0x100042,
+    0x5013,
+    0xA0117,
+    0x25116,
+    0x42114,
+    0x360100,
+    0x3901,
+    0x100042,
+    0x1262111,
+    0x10A018B,
+    0x194012,
+    0x80019,
+    0x424830,
+    0x204810,
+    0x8A801,
+    0x27015,
+    0x45802,
+    0x1020094,
+    0x424830,
+    0x8A801,
+    0x6A140,
+    0xEB150,
+    0x424830,
+    0x480190,
+    0x8A801,
+    0x1180013,
+    0x14118A,
+    0x1805,
+    0x424830,
+    0x143188,
+    0x1C4800,
+    0x8015,
+    0x11A8100,
+    0x10E2110,
+    0x8A801,
+    0x8A801,
+    0xE4010,
+    0x424830,
+    0x1180013,
+    0x82851,
+    0x424830,
+    0x204810,
+    0x8A801,
+    0x20018,
+    0x64010,
+    0x282911,
+    0x1002148,
+    0x424830,
+    0x480918,
+    0x8A801,
+    0x424830,
+    0x140186,
+    0x8A801,
+    0x424830,
+    0x1E4008,
+    0x8A801,
+    0x142000,
+    0x566830,
+    0x45802,
+    0x1A8016,
+    0x6919,
+    0x424830,
+    0x8A801,
+    0x45802,
+    0x424830,
+    0x4A40C0,
+    0x8A801,
+    0x188900,
+    0x5802,
+    0x186812,
+    0x424830,
+    0x1082185,
+    0x6148,
+    0x222819,
+    0x905,
+    0x10A910,
+    0x8A801,
+    0x128810,
+    0x160082,
+    0x6E049,
+    0x6A140,
+    0x284910,
+    0x8A801,
+    0x4A941,
+    0x42958,
+    0x1EC000,
+    0x1106040,
+    0xA4090,
+    0x2401C,
+    0x424040,
+    0x144090,
+    0x1A2140,
+    0x8A801,
+    0x8C000,
+    0x8C018,
+    0xA4090,
+    0xE1185,
+    0x222050,
+    0xE4030,
+    0xA110,
+    0xA0010,
+    0xA4090,
+    0x8A801,
+    0x14411C,
+    0xE4030,
+    0x22050,
+    0x80183,
+    0x421D8,
+    0xA0010,
+    0xA4090,
+    0x8A801,
+    0x97,
+    0x9801,
+    0x8A801,
+    0xA0010,
+    0xAC905,
+    0xA4090,
+    0x1C0005,
+    0xE0018,
+    0x1A40C8,
+    0x1A2011,
+    0x8A801,
+    0xA4090,
+    0x20011,
+    0x22141,
+    0x62141,
+    0x8A801,
+    0x20114,
+    0x400B1,
+    0xA4090,
+    0x20092,
+    0x831,
+    0x8A801,
+    0xA4090,
+    0x60180,
+    0x8A801,
+    0x65485,
+    0xA4090,
+    0x40000000,
+    0x224814,
+    0x124020,
+    0x20000000124831,
+    0x60180,
+    0x831,
+    0x1100C04,
+    0x8A801,
+    0xA4090,
+    0x2961,
+    0x831,
+    0x9811,
+    0xA4090,
+    0x8A801,
+    0x183001,
+    0x821,
+    0x2831,
+    0x2961,
+    0x831,
+    0xA4090,
+    0x8A801,
+    0x404802,
+    0x1A0830,
+    0x1A2970,
+    0x831,
+    0x402108,
+    0xA4090,
+    0x8A801,
+    0x22087,
+    0x1089010,
+    0x5090,
+    0xC2010,
+    0xC2150,
+    0xA4090,
+    0x8A801,
+    0x2010A,
+    0x22087,
+    0x50,
+    0x40050,
+    0xC2010,
+    0xC2150,
+    0xA4090,
+    0x8A801,
+    0x142060,
+    0x165080,
+    0xC4809,
+    0xA4090,
+    0x8A801,
+    0x20013,
+    0x22013,
+    0x62097,
+    0x19,
+    0x1A40C8,
+    0x40831,
+    0xA0010,
+    0x1A2400,
+    0x4A2110,
+    0x404008,
+    0xA4090,
+    0x8A801,
+    0x1146108,
+    0x1A0120,
+    0x28051,
+    0x68051,
+    0x4028,
+    0x18E815,
+    0x1A0120,
+    0x7810,
+    0x4028,
+    0x1A0120,
+    0x4A7811,
+    0x4028,
+    0x4,
+    0x1E0104,
+    0x1A0120,
+    0xA2115,
+    0x26051,
+    0xA2151,
+    0x283101,
+    0x4028,
+    0x1E0104,
+    0x1A0120,
+    0x7810,
+    0x164000,
+    0x4028,
+    0x108010D,
+    0x1E0104,
+    0x84D05,
+    0x1A0120,
+    0x621C1,
+    0x1000410,
+    0x1910,
+    0xA1141,
+    0x85300,
+    0x621F0,
+    0x40801,
+    0x164000,
+    0x1082041,
+    0x190911,
+    0xAC905,
+    0x20C0010,
+    0x4028,
+    0x2003,
+    0x1A0120,
+    0x1CD101,
+    0x4028,
+    0x480D,
+    0x1A0120,
+    0xA101,
+    0xA911,
+    0xAC905,
+    0x4028,
+    0x4028,
+    0x1A0120,
+    0x7041,
+    0xAC905,
+    0x8811,
+    0x80118,
+    0x4028,
+    0x1A0120,
+    0x80891,
+    0x20018,
+    0x28110,
+    0x8811,
+    0x1A0120,
+    0x22050,
+    0x4028,
+    0x1A0120,
+    0x28011,
+    0x4028,
+    0x1A0120,
+    0x8095,
+    0x4028,
+    0x60112,
+    0x60194,
+    0x1020094,
+    0x1A0120,
+    0x20018,
+    0x4028,
+    0x1020012,
+    0x1A0120,
+    0x14E0013,
+    0x4028,
+    0x60112,
+    0x1020012,
+    0x1020912,
+    0x100812,
+    0x160912,
+    0x1120812,
+    0x4028,
+    0x1A0120,
+    0x4028,
+    0x1A0120,
+    0x400500,
+    0x4028,
+    0x1A0120,
+    0x85001,
+    0x280853,
+    0x4028,
+    0x204910,
+    0x1A0120,
+    0x186004,
+    0x480D,
+    0x9801,
+    0xFFFFFFFFFFFFFFFF,
+    0x4028,
+    0x1A0120,
+    0x20400D,
+    0x4028,
+    0x1A0120,
+    0x280853,
+    0x122153,
+    0x8A851,
+    0x280853,
+    0x4028,
+    0x4028,
+    0x8C001,
+    0x280853,
+    0xA4005,
+    0x4028,
+    0x280853,
+    0x26004,
+    0x6C004,
+    0x20011,
+    0x21021,
+    0x2001111,
+    0x2001011,
+    0x4028,
+    0x280853,
+    0x84080,
+    0x28010,
+    0x4028,
+    0x280853,
+    0x812,
+    0x149105,
+    0x4028,
+    0x28010,
+    0x280853,
+    0x121016,
+    0x4028,
+    0x8D14,
+    0x280853,
+    0x4402,
+    0x160052,
+    0x57,
+    0x1004084,
+    0x22050,
+    0xC11,
+    0x1000831,
+    0x180814,
+    0x40809,
+    0x4028,
+    0x280853,
+    0x24906,
+    0x57,
+    0x400908,
+    0x4028,
+    0x280853,
+    0x226961,
+    0x20945,
+    0x4028,
+    0x280853,
+    0x226961,
+    0x6100,
+    0x4028,
+    0x280853,
+    0x4028,
+    0x182000,
+    0x18A011,
+    0x1CA011,
+    0x280853,
+    0x42013,
+    0x4028,
+    0x1002518,
+    0x101850,
+    0x41801,
+    0x280853,
+    0x7809,
+    0x1C2094,
+    0x8A801,
+    0x4028,
+    0x280853,
+    0x20012,
+    0x22150,
+    0x80891,
+    0x20092,
+    0x1A2801,
+    0xA4000,
+    0x48114,
+    0x4028,
+    0x280853,
+    0x42013,
+    0xC2C13,
+    0x1019,
+    0x101850,
+    0x8011,
+    0xC008,
+    0x1046013,
+    0x280853,
+    0x200150,
+    0x4028,
+    0x4028,
+    0x102160,
+    0x142060,
+    0x165080,
+    0x1A2011,
+    0x2008101,
+    0xAC812,
+    0xC0591,
+    0x65080,
+    0x6C010,
+    0x1EC000,
+    0xCE140,
+    0x1A0830,
+    0x280853,
+    0x2A2151,
+    0x200150,
+    0x426002,
+    0x80012,
+    0x4028,
+    0x22059,
+    0x60189,
+    0xA4000,
+    0x40809,
+    0x1AA100,
+    0x280853,
+    0x2A2151,
+    0x2001B,
+    0x60007,
+    0x4028,
+    0x22141,
+    0x4821,
+    0x1E2011,
+    0xC4001,
+    0x480091,
+    0x28019,
+    0x2001B,
+    0xE0433,
+    0xE2014,
+    0xE6105,
+    0x4028,
+    0x220B4,
+    0x24800,
+    0x28019,
+    0x180053,
+    0x2001B,
+    0x4028,
+    0x220B4,
+    0x28019,
+    0x28011,
+    0x2001B,
+    0xA083B,
+    0x4028,
+    0xA4149,
+    0x240881,
+    0x2001,
+    0x88101,
+    0x28019,
+    0x38681C,
+    0x20A8810,
+    0x4C0118,
+    0x4028,
+    0x28019,
+    0x853,
+    0x1020413,
+    0x2001B,
+    0xE0433,
+    0x61095,
+    0x4028,
+    0x28019,
+    0xE0433,
+    0xFFFFFFFFFFFFFFFF,
+    0x4028,
+    0x84495,
+    0xA415,
+    0x4A415,
+    0x28019,
+    0xE0433,
+    0x24211C,
+    0x26100,
+    0x400831,
+    0x4028,
+    0x28019,
+    0x40094,
+    0x400058,
+    0x4028,
+    0x28019,
+    0x6012,
+    0x81011,
+    0x4028,
+    0x28019,
+    0x6012,
+    0x2594,
+    0x1E150C,
+    0x11220C0,
+    0x850,
+    0x11AC800,
+    0x11A0410,
+    0x4028,
+    0x28019,
+    0xC084,
+    0x180004,
+    0xD887,
+    0x81011,
+    0x2C484,
+    0x20018,
+    0xC0411,
+    0x4028,
+    0x28019,
+    0x6007,
+    0xE0433,
+    0x4028,
+    0x81011,
+    0x28019,
+    0x120052,
+    0x80011,
+    0xC0021,
+    0x4028,
+    0x1210D3,
+    0x11220C0,
+    0x28019,
+    0xC0021,
+    0x4028,
+    0x220B4,
+    0x60130,
+    0x28019,
+    0x40094,
+    0x4028,
+    0x11220C0,
+    0x2E110,
+    0x2008101,
+    0x40914,
+    0x28019,
+    0x4048,
+    0x1A2431,
+    0x84080,
+    0x840C8,
+    0x140051,
+    0x4028,
+    0x28019,
+    0x2001B,
+    0x44218D,
+    0x4028,
+    0x28019,
+    0x803115,
+    0x84005,
+    0x4028,
+    0x28019,
+    0x1A4102,
+    0x803115,
+    0x428001,
+    0x4028,
+    0x28019,
+    0x4028,
+    0x803115,
+    0xF081,
+    0x81811,
+    0x428019,
+    0x28019,
+    0x831,
+    0xA083B,
+    0x4028,
+    0x1024040,
+    0x413,
+    0x1C0038,
+    0x28019,
+    0x8595,
+    0x831,
+    0x81813,
+    0x4028,
+    0x28019,
+    0xE0433,
+    0x50,
+    0x4028,
+    0x28019,
+    0xE0433,
+    0x6544,
+    0x1040011,
+    0x50,
+    0x1020020,
+    0x1022160,
+    0x224010,
+    0xA001,
+    0x1E2011,
+    0x40118,
+    0x1142000,
+    0x108000,
+    0x4028,
+    0x28019,
+    0x64815,
+    0x4028,
+    0x8811,
+    0xA001,
+    0x444881,
+    0x28019,
+    0x4028,
+    0x8C000,
+    0x14C000,
+    0x4C0010,
+    0x28019,
+    0x40094,
+    0x84895,
+    0x106038,
+    0x4028,
+    0x81818,
+    0x8C000,
+    0x40500,
+    0x28019,
+    0x404802,
+    0xE0433,
+    0x20815,
+    0x6054,
+    0x85811,
+    0x2C158,
+    0x4E000,
+    0x4028,
+    0x28019,
+    0x4028,
+    0x22050,
+    0x40809,
+    0x28019,
+    0x26004,
+    0x205110,
+    0xC000,
+    0x2E004,
+    0x4028,
+    0x28019,
+    0x1A0012,
+    0x1020109,
+    0x4028,
+    0x28019,
+    0x8711C,
+    0x224821,
+    0x1009,
+    0xC0801,
+    0x10C0801,
+    0x60491,
+    0xC0011,
+    0x1C8010,
+    0x4028,
+    0x28019,
+    0x2005,
+    0x201D,
+    0x4028,
+    0x28019,
+    0x86012,
+    0x804002,
+    0x4028,
+    0x42101,
+    0x20415,
+    0x4028,
+    0x20114,
+    0x42101,
+    0x803,
+    0x4028,
+    0x4A211,
+    0x20114,
+    0x42101,
+    0x441C,
+    0x4028,
+    0x20114,
+    0x42101,
+    0x1120004,
+    0x4028,
+    0x20114,
+    0x42101,
+    0x404802,
+    0xCC584,
+    0x4028,
+    0x6818,
+    0xC080,
+    0x23011,
+    0x14C000,
+    0xC3151,
+    0x42101,
+    0x4028,
+    0xC1813,
+    0xC8001,
+    0x1E2011,
+    0xC81D1,
+    0x42101,
+    0x4028,
+    0x8C001,
+    0xE4019,
+    0x4C0010,
+    0x42101,
+    0x4028,
+    0x413,
+    0x6018,
+    0x1E2011,
+    0x44039,
+    0x460410,
+    0xC0504,
+    0x42101,
+    0x4028,
+    0x140180,
+    0x42101,
+    0x20138,
+    0x42A001,
+    0x69180,
+    0x1A9011,
+    0x42101,
+    0x4028,
+    0x415,
+    0x401A0,
+    0x4028,
+    0x10E8001,
+    0x1E2011,
+    0x460900,
+    0x42101,
+    0x183001,
+    0x415,
+    0x2C0931,
+    0x7000,
+    0xFFFFFFFFFFFFFFFF,
+    0x42101,
+    0x4028,
+    0x6049,
+    0xE0018,
+    0x4A211,
+    0x460410,
+    0xC0504,
+    0x4C0010,
+    0x42101,
+    0x4028,
+    0x10B948,
+    0xB019,
+    0xFFFFFFFFFFFFFFFF,
+    0x2004301,
+    0x2C150,
+    0xEC514,
+    0x42101,
+    0x4028,
+    0x4514,
+    0x1A6030,
+    0x102C094,
+    0x42101,
+    0x4028,
+    0x804002,
+    0xCC584,
+    0x1220918,
+    0x4028,
+    0x10E4010,
+    0x8901,
+    0x184411,
+    0x42101,
+    0x21015,
+    0xE0018,
+    0x4028,
+    0x114,
+    0x21115,
+    0x1E2011,
+    0x260010,
+    0xC4020,
+    0x4C0010,
+    0xE0018,
+    0x114,
+    0x1E2011,
+    0x240099,
+    0x4C0010,
+    0x4028,
+    0x21015,
+    0xE0018,
+    0x4028,
+    0x114,
+    0x1E2011,
+    0x4C0010,
+    0xE0433,
+    0xE0018,
+    0x186008,
+    0x1860C8,
+    0x4028,
+    0x4C0010,
+    0x8184,
+    0x84895,
+    0x4514,
+    0xE0018,
+    0x4C0010,
+    0x4028,
+    0x100000B,
+    0x10A018B,
+    0x415,
+    0xA6917,
+    0xE0018,
+    0x1008081,
+    0x10E8001,
+    0x4C0010,
+    0x4028,
+    0x415,
+    0xE0018,
+    0x10E8001,
+    0xE4495,
+    0x40914,
+    0x4C0010,
+    0x4028,
+    0x1020413,
+    0x108415,
+    0xE0018,
+    0x6AD10,
+    0x160041,
+    0x4C0010,
+    0xA0011,
+    0x4028,
+    0x8811,
+    0x2960,
+    0x1A0120,
+    0x81011,
+    0x10E8001,
+    0x8110,
+    0x10B500,
+    0x40914,
+    0x4028,
+    0x4C0010,
+    0x20003,
+    0x100200D,
+    0x84895,
+    0xE0018,
+    0x406891,
+    0x4C0010,
+    0x84080,
+    0x4028,
+    0x100200D,
+    0x2C0115,
+    0xE0018,
+    0x406891,
+    0x1E2011,
+    0x4C0010,
+    0x84080,
+    0x428011,
+    0x4028,
+    0x100200D,
+    0xE0018,
+    0x4028,
+    0xC900,
+    0x1E2011,
+    0x4C0010,
+    0x1E000D,
+    0xE0018,
+    0x10A148,
+    0x4C0010,
+    0x4028,
+    0x20813,
+    0x20013,
+    0x4028,
+    0x1006090,
+    0x108E090,
+    0x20201,
+    0x8C000,
+    0x4C0010,
+    0x40113,
+    0x1000003,
+    0xA0182,
+    0x26002,
+    0x84812,
+    0x22508,
+    0x82121,
+    0x1D00,
+    0x426012,
+    0x22508,
+    0x40841,
+    0x1D00,
+    0x220053,
+    0x35,
+    0x2135,
+    0x185,
+    0x4034,
+    0x22508,
+    0x84080,
+    0x27140,
+    0xC3151,
+    0x80011,
+    0x420012,
+    0x22508,
+    0x4028,
+    0x8C000,
+    0x80011,
+    0x8C011,
+    0x220053,
+    0x108004,
+    0x22508,
+    0x2899,
+    0x6840,
+    0x80011,
+    0x188015,
+    0x584180,
+    0x20003,
+    0x220053,
+    0x84812,
+    0x108004,
+    0x22508,
+    0x1E2011,
+    0x40411,
+    0x20003,
+    0x84812,
+    0x24404,
+    0x22508,
+    0xE140,
+    0x4885,
+    0x20003,
+    0x220053,
+    0x2004012,
+    0x100806,
+    0x22508,
+    0x22548,
+    0x62508,
+    0x40841,
+    0x1E2011,
+    0x402110,
+    0x4885,
+    0x20003,
+    0x2004012,
+    0x100806,
+    0x84D05,
+    0x22508,
+    0x22548,
+    0x62508,
+    0x40841,
+    0x1009,
+    0xA3101,
+    0x3010,
+    0x4885,
+    0x20003,
+    0x2004012,
+    0x100806,
+    0x84D05,
+    0x22508,
+    0x22548,
+    0x62508,
+    0x122408,
+    0x1101,
+    0x10A8001,
+    0x80101,
+    0xAC905,
+    0xEC104,
+    0x4885,
+    0x811,
+    0x20003,
+    0x20012,
+    0x2004012,
+    0x22508,
+    0x22548,
+    0x62508,
+    0x101040,
+    0xE4036,
+    0xE4432,
+    0x8A100,
+    0xC2110,
+    0x161010,
+    0x4885,
+    0x20003,
+    0x20012,
+    0x2004012,
+    0xC5002,
+    0x60094,
+    0x2D04,
+    0x2D44,
+    0x22548,
+    0x62508,
+    0x141040,
+    0x22508,
+    0xA0817,
+    0x2D04,
+    0x2D44,
+    0x22508,
+    0x40841,
+    0x40851,
+    0x40841,
+    0x134900,
+    0xC4084,
+    0xC4080,
+    0x1A1812,
+    0x1440590,
+    0x1440580,
+    0x22508,
+    0x8211D,
+    0x22508,
+    0x1089010,
+    0x40841,
+    0x110908,
+    0x4C000,
+    0x12C000,
+    0x12E140,
+    0x48900,
+    0x4A0011,
+    0x108004,
+    0x22508,
+    0x100314,
+    0x81801,
+    0x44009,
+    0xC4020,
+    0x4E0001,
+    0x4A0011,
+    0x4003,
+    0x100812,
+    0x4028,
+    0x1D00,
+    0x28811,
+    0x80011,
+    0x22508,
+    0x220053,
+    0x804002,
+    0x100314,
+    0x4E0001,
+    0x4C0010,
+    0x22508,
+    0x22508,
+    0x81011,
+    0x480C,
+    0x100016,
+    0x114,
+    0x20156,
+    0x22508,
+    0xCC584,
+    0x40181,
+    0xA4651,
+    0x2100501,
+    0x460199,
+    0x6544,
+    0x22118,
+    0x80011,
+    0x24420,
+    0x2530,
+    0x88811,
+    0x460199,
+    0xE0433,
+    0x1020413,
+    0x6544,
+    0x11A0814,
+    0x14491C,
+    0x22118,
+    0x80011,
+    0x38,
+    0x4028,
+    0x24420,
+    0x11220C0,
+    0x2530,
+    0x102884,
+    0x1E2011,
+    0x1101000,
+    0x1101000,
+    0x460199,
+    0x80011,
+    0x4E000,
+    0x4A0813,
+    0x460199,
+    0xB4,
+    0x6544,
+    0x4084,
+    0x82594,
+    0x2530,
+    0x84800,
+    0x40E011,
+    0x460199,
+    0x8711C,
+    0xA6115,
+    0x1089010,
+    0x20201,
+    0x861C0,
+    0x140015,
+    0xE4010,
+    0x460199,
+    0x2D081,
+    0x170101,
+    0x6544,
+    0x22508,
+    0x100240,
+    0x84800,
+    0x40E011,
+    0x200410D,
+    0x460199,
+    0x20125,
+    0xA0091,
+    0x12C010,
+    0x2000000012C135,
+    0x4852,
+    0x4461C0,
+    0x424808,
+    0x9001,
+    0x8815,
+    0x61115,
+    0xA0091,
+    0x4852,
+    0x4461C0,
+    0x424808,
+    0x9001,
+    0x8815,
+    0x40101,
+    0x200000001E0901,
+    0x1E0901,
+    0xA0091,
+    0x4852,
+    0x4461C0,
+    0x424808,
+    0x9001,
+    0x8815,
+    0xA0091,
+    0x4852,
+    0xA2110,
+    0x63119,
+    0x400012,
+    0x424808,
+    0x424918,
+    0x9001,
+    0x8815,
+    0x9001,
+    0x424808,
+    0x8815,
+    0xA201,
+    0x9001,
+    0x8815,
+    0x4D005,
+    0xA611C,
+    0x83155,
+    0x286141,
+    0xA6150,
+    0x9001,
+    0x8815,
+    0x480C,
+    0x187101,
+    0x446000,
+    0x2000000044E01D,
+    0x801D,
+    0x2C1D5,
+    0x8815,
+    0x187101,
+    0x2C1D5,
+    0x8815,
+    0x202895,
+    0x22059,
+    0xE0119,
+    0x1B0491,
+    0x187101,
+    0x141918,
+    0x64404,
+    0x2C1D5,
+    0x42919,
+    0x8815,
+    0x1AE110,
+    0x187101,
+    0x1A2011,
+    0x206805,
+    0x2C1D5,
+    0x8815,
+    0x100320,
+    0x187000,
+    0x187101,
+    0x1A2011,
+    0x2C1D5,
+    0x8815,
+    0xB145,
+    0x2C1D5,
+    0x8815,
+    0x97,
+    0x121813,
+    0x2C1D5,
+    0x8815,
+    0xE0018,
+    0x2C1D5,
+    0x8815,
+    0xE0018,
+    0x42909,
+    0x2C1D5,
+    0x8815,
+    0x86901,
+    0x28401,
+    0x2C1D5,
+    0x8815,
+    0x1C1109,
+    0x10294A,
+    0x8815,
+    0x10294A,
+    0x40905,
+    0x8815,
+    0x10294A,
+    0x1E6104,
+    0x22015,
+    0x8815,
+    0x20506,
+    0x60506,
+    0x1000805,
+    0xA5001,
+    0x400801,
+    0x10294A,
+    0x8815,
+    0x12481A,
+    0x1200091,
+    0x24404,
+    0x44908,
+    0xC6010,
+    0x1840C0,
+    0x10294A,
+    0x8815,
+    0x4840,
+    0x121812,
+    0xA1112,
+    0x404008,
+    0x10294A,
+    0x8815,
+    0x5090,
+    0x144090,
+    0x180080,
+    0x166098,
+    0xE0890,
+    0x11A0000,
+    0x10294A,
+    0x8815,
+    0x144090,
+    0x144090,
+    0x10294A,
+    0x8815,
+    0xA091C,
+    0x5090,
+    0x144090,
+    0x10294A,
+    0x8815,
+    0x10294A,
+    0x11A6004,
+    0xA0091,
+    0x5090,
+    0x144090,
+    0x22085,
+    0xC0810,
+    0x49910,
+    0x162003,
+    0x160103,
+    0x420090,
+    0x8815,
+    0x10294A,
+    0x11A6004,
+    0x22059,
+    0xA0091,
+    0x5090,
+    0x144090,
+    0x22085,
+    0xC0810,
+    0x49910,
+    0x162003,
+    0x160103,
+    0x420090,
+    0x8815,
+    0x10294A,
+    0x1080104,
+    0x100907,
+    0x4202,
+    0x4134,
+    0x8815,
+    0x10294A,
+    0x4A211,
+    0x4134,
+    0xCC000,
+    0x8815,
+    0x10294A,
+    0x12E011,
+    0x4134,
+    0xCC000,
+    0x8815,
+    0x10294A,
+    0xA400C,
+    0xCC981,
+    0x311C,
+    0x8815,
+    0x2403,
+    0x10294A,
+    0x8815,
+    0x10294A,
+    0x84890,
+    0x8815,
+    0x10294A,
+    0x84890,
+    0x204810,
+    0x8815,
+    0x50000000,
+    0x10294A,
+    0x206114,
+    0x164080,
+    0xE4010,
+    0x8815,
+    0x10294A,
+    0x44884,
+    0x8815,
+    0x10294A,
+    0xAB019,
+    0xE4010,
+    0x8815,
+    0x10294A,
+    0x10A4025,
+    0x8815,
+    0x10294A,
+    0xC0815,
+    0x4A211,
+    0x8815,
+    0x10294A,
+    0xC0815,
+    0x12E011,
+    0x8815,
+    0x8895,
+    0x8019C,
+    0x1CA901,
+    0x27015,
+    0x402158,
+    0x10294A,
+    0x8815,
+    0x1084400,
+    0x4A4010,
+    0x10294A,
+    0x8815,
+    0x10A0912,
+    0x402010,
+    0x1002000,
+    0x1002004,
+    0x1C0011,
+    0x1024400,
+    0x10294A,
+    0x8815,
+    0x40812,
+    0x8895,
+    0xE2185,
+    0x120084,
+    0x64004,
+    0x26950,
+    0x8815,
+    0x164950,
+    0x41901,
+    0x41309,
+    0x155010,
+    0x141900,
+    0x26950,
+    0x8815,
+    0x164950,
+    0x102188,
+    0x89810,
+    0x8815,
+    0x164950,
+    0x400210,
+    0x440390,
+    0x141309,
+    0x26950,
+    0x1146051,
+    0x89810,
+    0x8815,
+    0x164950,
+    0x26950,
+    0xC6180,
+    0x62190,
+    0x8815,
+    0x164950,
+    0x281,
+    0x41901,
+    0x403,
+    0x141900,
+    0x26950,
+    0x121081,
+    0x8815,
+    0x164950,
+    0x186121,
+    0xA4090,
+    0x8815,
+    0xB145,
+    0x82010,
+    0xA4090,
+    0x8815,
+    0x4060,
+    0x1004060,
+    0xA4090,
+    0x8815,
+    0x821C0,
+    0xE0001,
+    0xE0001,
+    0xA4090,
+    0x8815,
+    0x1080104,
+    0x10C8115,
+    0xA4090,
+    0x8815,
+    0x27140,
+    0x1C7101,
+    0x224010,
+    0x142000,
+    0x162110,
+    0xA4090,
+    0x8815,
+    0x27140,
+    0x1A2011,
+    0x142000,
+    0x162110,
+    0xA4090,
+    0x8815,
+    0x80001,
+    0x10294A,
+    0x1080104,
+    0x10C8115,
+    0x140408,
+    0x202150,
+    0x4A81D,
+    0x142000,
+    0x1C2010,
+    0xA4090,
+    0x8815,
+    0x10294A,
+    0x140408,
+    0x142000,
+    0x1C2010,
+    0xA4090,
+    0x8815,
+    0x80001,
+    0x2015A,
+    0x821C0,
+    0xA4090,
+    0x8815,
+    0x84080,
+    0xEE1C0,
+    0x6A140,
+    0xC3151,
+    0xA4090,
+    0x8815,
+    0x164815,
+    0xA3111,
+    0x64090,
+    0xA4090,
+    0x8815,
+    0x1C3011,
+    0x28401,
+    0x1008801,
+    0x112E849,
+    0x100A941,
+    0x40918,
+    0x42948,
+    0x81090,
+    0xA4090,
+    0x8815,
+    0x1C3011,
+    0x60130,
+    0x28401,
+    0x81090,
+    0x400890,
+    0xA4090,
+    0x8815,
+    0x1C3011,
+    0xE4015,
+    0x28401,
+    0x24810,
+    0x81090,
+    0xA4090,
+    0x8815,
+    0x20013,
+    0x180004,
+    0x600B0,
+    0x1A0185,
+    0xC810,
+    0x240091,
+    0xA4090,
+    0x8815,
+    0x160104,
+    0x82010,
+    0xA4090,
+    0x8815,
+    0x44017,
+    0x2150,
+    0x285914,
+    0x1420901,
+    0xC1011,
+    0xA2101,
+    0xE2101,
+    0x2A0811,
+    0x126048,
+    0xEE001,
+    0x20005,
+    0xA0914,
+    0x1420901,
+    0xA2101,
+    0xA1001,
+    0x2A0811,
+    0x11E4812,
+    0x126048,
+    0xEE001,
+    0x200000000481D8,
+    0x1420901,
+    0x42591,
+    0x48018,
+    0xA2101,
+    0x126048,
+    0x1C0,
+    0xEE001,
+    0x180812,
+    0x200000000481D8,
+    0x46010,
+    0x1420901,
+    0x42591,
+    0x48018,
+    0xA2101,
+    0x2A0811,
+    0x126048,
+    0xEE001,
+    0x220119,
+    0x4084,
+    0x1420901,
+    0xA2101,
+    0x126048,
+    0xEE001,
+    0xA5010,
+    0x1540003,
+    0x2A0811,
+    0x126048,
+    0xEE001,
+    0x220119,
+    0x809C0,
+    0x27901,
+    0x20901,
+    0x1420901,
+    0x126048,
+    0xEE001,
+    0x1420901,
+    0xC6101,
+    0xA2101,
+    0x126048,
+    0xEE001,
+    0xA1001,
+    0x11E4812,
+    0x126048,
+    0xEE001,
+    0x27901,
+    0x200994,
+    0x126048,
+    0xEE001,
+    0x20005,
+    0x187101,
+    0x1420901,
+    0xA8100,
+    0x126048,
+    0xEE001,
+    0x140002,
+    0x20005,
+    0xA1001,
+    0x10A4810,
+    0x11E4812,
+    0x126048,
+    0xEE001,
+    0x140002,
+    0x44884,
+    0x200994,
+    0x126048,
+    0xEE001,
+    0x140002,
+    0x60005,
+    0x7144,
+    0x126048,
+    0xEE001,
+    0x140002,
+    0xA1001,
+    0x10A4810,
+    0x11E4812,
+    0x126048,
+    0xEE001,
+    0x140002,
+    0x220118,
+    0x143102,
+    0x202001,
+    0x200994,
+    0x126048,
+    0xEE001,
+    0x103817,
+    0x1023054,
+    0x200994,
+    0x126048,
+    0xEE001,
+    0x2150,
+    0x20130,
+    0x1A0404,
+    0x126048,
+    0xEE001,
+    0xFFFFFFFFFFFFFFFF,
+    0x20005,
+    0x4C004,
+    0xAC801,
+    0xC914,
+    0x126048,
+    0xEE001,
+    0x20005,
+    0x7144,
+    0xC914,
+    0x126048,
+    0xEE001,
+    0x7,
+    0x117,
+    0x20005,
+    0x220118,
+    0x880101,
+    0x200994,
+    0x1404810,
+    0x126048,
+    0xEE001,
+    0x7,
+    0x117,
+    0x60005,
+    0x224018,
+    0x981,
+    0x7144,
+    0x880101,
+    0x1404810,
+    0x126048,
+    0xEE001,
+    0x185913,
+    0x20005,
+    0x222148,
+    0x200994,
+    0x126048,
+    0xEE001,
+    0x185913,
+    0x20005,
+    0x60005,
+    0x224018,
+    0x7144,
+    0x200994,
+    0x126048,
+    0xEE001,
+    0x20005,
+    0x220118,
+    0xA6915,
+    0xEC000,
+    0x11EC900,
+    0x1180900,
+    0x200994,
+    0x126048,
+    0xEE001,
+    0x185913,
+    0x20005,
+    0x8083B,
+    0x20000000108504,
+    0x108504,
+    0xEE101,
+    0x1A0404,
+    0x126048,
+    0xEE001,
+    0x20005,
+    0x1220918,
+    0x220118,
+    0x1A0404,
+    0x200994,
+    0x126048,
+    0xEE001,
+    0x1A091D,
+    0x20005,
+    0x220118,
+    0x1024800,
+    0x205010,
+    0x41110,
+    0x1A0404,
+    0x200994,
+    0x126048,
+    0xEE001,
+    0xA4005,
+    0x200994,
+    0x126048,
+    0xEE001,
+    0x20005,
+    0x22145,
+    0x2005000,
+    0x126048,
+    0xEE001,
+    0x10A5814,
+    0x22145,
+    0x126048,
+    0xEE001,
+    0xA5000,
+    0xE4014,
+    0x126048,
+    0xEE001,
+    0x10C0917,
+    0x103801,
+    0x420995,
+    0x126048,
+    0xEE001,
+    0x10C0917,
+    0x20A5118,
+    0x420995,
+    0x126048,
+    0xEE001,
+    0x184001,
+    0x460585,
+    0x180400,
+    0x126048,
+    0xEE001,
+    0x1000916,
+    0x512,
+    0x40805,
+    0x1000814,
+    0x1002944,
+    0x10C0904,
+    0x2041,
+    0x20118,
+    0x4A100,
+    0x4A140,
+    0x126048,
+    0xEE001,
+    0x504,
+    0xE4014,
+    0x126048,
+    0xEE001,
+    0x2400B,
+    0xC0411,
+    0xE441B,
+    0xE0411,
+    0x440890,
+    0x126048,
+    0xEE001,
+    0x4081B,
+    0x24810,
+    0xC0411,
+    0xC0411,
+    0xEC000,
+    0x126048,
+    0xEE001,
+    0x140002,
+    0x1CC002,
+    0xCC000,
+    0x126048,
+    0xEE001,
+    0x14001C1,
+    0x14A5001,
+    0x24009,
+    0x126048,
+    0xEE001,
+    0x1420901,
+    0xA0405,
+    0xA2101,
+    0x126048,
+    0xEE001,
+    0x121008,
+    0x4900,
+    0x126048,
+    0xEE001,
+    0x40918,
+    0x100830,
+    0x109830,
+    0x40041,
+    0x46951,
+    0x109000,
+    0xC6101,
+    0x126048,
+    0xEE001,
+    0x20005,
+    0x20914,
+    0xA0110,
+    0x1A2000,
+    0x200994,
+    0x400890,
+    0x126048,
+    0xEE001,
+    0x21801,
+    0xA0811,
+    0x6017,
+    0x20005,
+    0x1023054,
+    0x809C0,
+    0xC914,
+    0x226950,
+    0x62110,
+    0x126048,
+    0xEE001,
+    0x20A6981,
+    0xE6114,
+    0x809C0,
+    0x42941,
+    0xCC000,
+    0xCC9C0,
+    0xA0125,
+    0x126048,
+    0xEE001,
+    0x224018,
+    0xE6114,
+    0x809C0,
+    0x42941,
+    0xCC000,
+    0xCC9C0,
+    0xA0125,
+    0x2A0915,
+    0x126048,
+    0xEE001,
+    0x86845,
+    0x42140,
+    0xCC000,
+    0x126048,
+    0xEE001,
+    0x20113,
+    0x1E6104,
+    0x126048,
+    0xEE001,
+    0x26085,
+    0x48180,
+    0x84800,
+    0xEE001,
+    0x4A0011,
+    0x1104002,
+    0x84821,
+    0x930,
+    0x260931,
+    0x268010,
+    0x160014,
+    0x22140,
+    0x10C0031,
+    0x240011,
+    0x260011,
+    0x441100,
+    0xEE001,
+    0x4A0011,
+    0x84003,
+    0xE4010,
+    0xC4903,
+    0x42941,
+    0x40011,
+    0x1080085,
+    0xEE001,
+    0x4A0011,
+    0x84003,
+    0x6015,
+    0xEE001,
+    0x4A0011,
+    0x26913,
+    0x84003,
+    0xC11,
+    0x1920800,
+    0x27911,
+    0xCC01B,
+    0x161010,
+    0x2A0811,
+    0xEE001,
+    0x4A0011,
+    0x6A051,
+    0x48180,
+    0xEE001,
+    0x4A0011,
+    0x84003,
+    0x1020030,
+    0x6A051,
+    0xEE001,
+    0x4A0011,
+    0x84003,
+    0xA5000,
+    0xA5003,
+    0xEE001,
+    0x4A0011,
+    0x84003,
+    0x6A051,
+    0x48180,
+    0x2A0811,
+    0xEE001,
+    0x4A0011,
+    0x2E811,
+    0x2A911,
+    0x1000820,
+    0x1002960,
+    0x80210,
+    0xA811,
+    0x2A0811,
+    0x20101,
+    0xEE001,
+    0x2E811,
+    0x2A911,
+    0xA811,
+    0x41801,
+    0x20101,
+    0xEE001,
+    0x2E811,
+    0x2A911,
+    0x20000000002594,
+    0x1A8019,
+    0x1E8019,
+    0xA811,
+    0x20101,
+    0xEE001,
+    0x2E811,
+    0x2A911,
+    0x220901,
+    0x260901,
+    0x222141,
+    0x2949,
+    0xA811,
+    0x20101,
+    0xEE001,
+    0x200000000029D9,
+    0x1A8095,
+    0x68901,
+    0x1240518,
+    0x20101,
+    0xEE001,
+    0x20185,
+    0xC0011,
+    0x20101,
+    0xEE001,
+    0xAC014,
+    0xAC994,
+    0xAC834,
+    0x2A0811,
+    0x200994,
+    0x20101,
+    0xEE001,
+    0x1420901,
+    0x14E110,
+    0x20101,
+    0xEE001,
+    0x817,
+    0x1400817,
+    0x6849,
+    0x80920,
+    0x187101,
+    0x40500,
+    0x20101,
+    0xEE001,
+    0x20911,
+    0x817,
+    0x20005,
+    0x6849,
+    0x142C011,
+    0x14A1001,
+    0x20101,
+    0xEE001,
+    0xC0911,
+    0x48015,
+    0x20101,
+    0xEE001,
+    0x102885,
+    0xA4414,
+    0xE4414,
+    0x48015,
+    0x2A0811,
+    0x20101,
+    0xEE001,
+    0x42911,
+    0x8A0011,
+    0x1002960,
+    0x160015,
+    0xE0911,
+    0x104020,
+    0x20101,
+    0xEE001,
+    0x812,
+    0xC892,
+    0x84890,
+    0x43,
+    0x100851,
+    0xA545,
+    0x24810,
+    0x1C0115,
+    0x2A0811,
+    0x84890,
+    0x6018,
+    0x1648C1,
+    0x42009,
+    0x81110,
+    0xA1110,
+    0x6018,
+    0x406960,
+    0x1648C1,
+    0x164080,
+    0x86000,
+    0x42009,
+    0xA1110,
+    0x482141,
+    0x1004800,
+    0x81110,
+    0x4C04,
+    0x81110,
+    0x480085,
+    0x21801,
+    0x4C04,
+    0x164080,
+    0x60080,
+    0x80811,
+    0x81110,
+    0x482141,
+    0x4C04,
+    0x4CC085,
+    0x81110,
+    0x4C04,
+    0xA1110,
+    0x81110,
+    0x4C04,
+    0x8B915,
+    0x81110,
+    0x18000000,
+    0x401C000000,
+    0x4C04,
+    0xFFFFFFFFFFFFFFFF,
+    0x81110,
+    0x680810,
+    0x18000000,
+    0x403C000000,
+    0x24000000,
+    0x4C04,
+    0x10A0180,
+    0x81110,
+    0x680810,
+    0x200000016A0990,
+    0x8000000,
+    0x400C000000,
+    0x4C04,
+    0xFFFFFFFFFFFFFFFF,
+    0x6010,
+    0x81110,
+    0x8000000,
+    0x402C000000,
+    0x24000000,
+    0x4C04,
+    0x6010,
+    0x200000010A6190,
+    0x10A0180,
+    0x81110,
+    0x10000000,
+    0x4014000000,
+    0x4C04,
+    0xFFFFFFFFFFFFFFFF,
+    0x81110,
+    0x484000,
+    0x10000000,
+    0x4034000000,
+    0x24000000,
+    0x4C04,
+    0x10A0180,
+    0x81110,
+    0x484000,
+    0x200000014A4180,
+    0x20000000,
+    0x4024000000,
+    0x4C04,
+    0xFFFFFFFFFFFFFFFF,
+    0xA0090,
+    0x81110,
+    0x20000000,
+    0x4024000000,
+    0x24000000,
+    0x4C04,
+    0x10A0180,
+    0xA0090,
+    0x200000010A0190,
+    0x81110,
+    0x40000000,
+    0x4044000000,
+    0x4C04,
+    0x124020,
+    0xFFFFFFFFFFFFFFFF,
+    0x81110,
+    0x24000000,
+    0x40000000,
+    0x4064000000,
+    0x4C04,
+    0x124020,
+    0x200000011A41A0,
+    0x10A0180,
+    0x81110,
+    0x80000000,
+    0x4084000000,
+    0x4C04,
+    0x200130,
+    0xFFFFFFFFFFFFFFFF,
+    0x81110,
+    0x24000000,
+    0x80000000,
+    0x40A4000000,
+    0x4C04,
+    0x200130,
+    0x200000012A01B0,
+    0x10A0180,
+    0x81110,
+    0x100000000,
+    0x4104000000,
+    0x4C04,
+    0xFFFFFFFFFFFFFFFF,
+    0x840100,
+    0x81110,
+    0x24000000,
+    0x100000000,
+    0x4124000000,
+    0x4C04,
+    0x840100,
+    0x200000018E0180,
+    0x10A0180,
+    0x81110,
+    0x4000000,
+    0x200000000,
+    0x4204000000,
+    0x4C04,
+    0xFFFFFFFFFFFFFFFF,
+    0x242010,
+    0x81110,
+    0x24000000,
+    0x200000000,
+    0x4224000000,
+    0x4C04,
+    0x242010,
+    0x200000012E2190,
+    0x10A0180,
+    0x81110,
+    0x400000000,
+    0x4404000000,
+    0x4C04,
+    0x801D0,
+    0xFFFFFFFFFFFFFFFF,
+    0x81110,
+    0x24000000,
+    0x400000000,
+    0x4424000000,
+    0x4C04,
+    0x801D0,
+    0x200000010A01D0,
+    0x10A0180,
+    0x81110,
+    0x800000000,
+    0x4804000000,
+    0x4C04,
+    0x2110,
+    0xFFFFFFFFFFFFFFFF,
+    0x81110,
+    0x24000000,
+    0x800000000,
+    0x4824000000,
+    0x4C04,
+    0x2110,
+    0x200000010A2190,
+    0x10A0180,
+    0x81110,
+    0x4000000,
+    0xC000000,
+    0x400C000000,
+    0x4C04,
+    0xFFFFFFFFFFFFFFFF,
+    0x82010,
+    0x81110,
+    0xC000000,
+    0x402C000000,
+    0x24000000,
+    0x4C04,
+    0x82010,
+    0x200000010A2190,
+    0x10A0180,
+    0x81110,
+    0x8000000,
+    0x400C000000,
+    0x4C04,
+    0x202810,
+    0xFFFFFFFFFFFFFFFF,
+    0x81110,
+    0x8000000,
+    0x402C000000,
+    0x24000000,
+    0x4C04,
+    0x202810,
+    0x200000012A2990,
+    0x10A0180,
+    0x81110,
+    0x20409,
+    0x7000,
+    0x402010,
+    0x48015,
+    0x1040400,
+    0x4A0091,
+    0xE2014,
+    0x61019,
+    0x7000,
+    0x48015,
+    0xC02141,
+    0x1040400,
+    0x4A0091,
+    0xE0120,
+    0x7000,
+    0x1B0011,
+    0x48015,
+    0x1040400,
+    0x4A0091,
+    0x144142,
+    0x7000,
+    0x48015,
+    0xC02141,
+    0x1040400,
+    0x4A0091,
+    0x100820,
+    0x7000,
+    0x48015,
+    0x1040400,
+    0x4A0091,
+    0x144142,
+    0x7000,
+    0x48015,
+    0x402141,
+    0x1040400,
+    0x4A0091,
+    0xC0801,
+    0x7000,
+    0x1B0011,
+    0x48015,
+    0x1040400,
+    0x4A0091,
+    0xE2014,
+    0x7000,
+    0x48015,
+    0x402141,
+    0x1040400,
+    0x4A0091,
+    0xE2014,
+    0x7000,
+    0x23009,
+    0x48015,
+    0x1040400,
+    0x4A0091,
+    0x35,
+    0x7000,
+    0x402010,
+    0x48015,
+    0x1040400,
+    0x4A0091,
+    0x35,
+    0xE0120,
+    0x7000,
+    0x1B0011,
+    0x48015,
+    0x1040400,
+    0x4A0091,
+    0x61019,
+    0x35,
+    0xC0801,
+    0x7000,
+    0x1B0011,
+    0x1040400,
+    0x4A0091,
+    0xA5090,
+    0x4A0091,
+    0x1040400,
+    0xA01C2,
+    0x1060001,
+    0x48015,
+    0x142000,
+    0x1142000,
+    0x4A0091,
+    0x1040400,
+    0xA01C2,
+    0x35,
+    0x100820,
+    0x7000,
+    0x1040400,
+    0x4A0091,
+    0x97,
+    0xA01C2,
+    0x1000009,
+    0x35,
+    0x80091,
+    0x42190,
+    0x142000,
+    0x1142000,
+    0x142190,
+    0x4A0091,
+    0x1040400,
+    0x8A811,
+    0x22158,
+    0x1E2001,
+    0x1E2111,
+    0x1040400,
+    0x4A0091,
+    0x10E7001,
+    0x101118,
+    0xE0001,
+    0xE0001,
+    0x480190,
+    0x1040400,
+    0x4A0091,
+    0x10A0950,
+    0x404840,
+    0x406940,
+    0x821C0,
+    0x421C0,
+    0x68C11,
+    0xE0001,
+    0x402100,
+    0x1040400,
+    0x4A0091,
+    0x2961,
+    0x821C0,
+    0xC61C0,
+    0x48015,
+    0xE0001,
+    0x1040400,
+    0x4A0091,
+    0x1001D00,
+    0x48015,
+    0x1400001,
+    0x1040400,
+    0x4A0091,
+    0x10480C,
+    0x4A0091,
+    0x1040400,
+    0x219A,
+    0x10480C,
+    0x110480C,
+    0x142000,
+    0x4A0091,
+    0x1040400,
+    0x10480C,
+    0x829C0,
+    0x22101,
+    0x1A2098,
+    0x1E7098,
+    0x1040400,
+    0x4A0091,
+    0x219A,
+    0x10480C,
+    0x142000,
+    0x4A0091,
+    0x1040400,
+    0x41801,
+    0x219A,
+    0x10480C,
+    0x142000,
+    0x4A0091,
+    0x20851,
+    0x1040400,
+    0x219A,
+    0x10480C,
+    0x22101,
+    0x142000,
+    0x4A0091,
+    0x1040400,
+    0x10480C,
+    0x22101,
+    0x4A0091,
+    0x1040400,
+    0x10480C,
+    0x480C,
+    0x446000,
+    0x4A0091,
+    0x1040400,
+    0x10480C,
+    0x829C0,
+    0x4A0091,
+    0x1040400,
+    0x10480C,
+    0xA6009,
+    0x4A0091,
+    0x422988,
+    0x1040400,
+    0x10480C,
+    0x4060,
+    0x4A0091,
+    0x1040400,
+    0x404802,
+    0x10480C,
+    0x35,
+    0x402108,
+    0x1040400,
+    0x4A0091,
+    0x1006814,
+    0x3000108,
+    0x122195,
+    0x4E0110,
+    0x108E080,
+    0x4A0091,
+    0x1040400,
+    0x1000041,
+    0x132058,
+    0x80842,
+    0x90842,
+    0x42913,
+    0x80842,
+    0x90842,
+    0x90943,
+    0x1A2011,
+    0x28118,
+    0x130010,
+    0x22101,
+    0x426103,
+    0xE2001,
+    0xE2059,
+    0x4A0091,
+    0x1040400,
+    0x4481C,
+    0x869C4,
+    0x22101,
+    0x121813,
+    0x1040400,
+    0x4A0091,
+    0x869C4,
+    0x22101,
+    0x121813,
+    0x1040400,
+    0x4A0091,
+    0x869C4,
+    0x2C008,
+    0x6C008,
+    0x22101,
+    0x121813,
+    0x4A0091,
+    0x1040400,
+    0x126048,
+    0x22101,
+    0x142000,
+    0x121813,
+    0x1040400,
+    0x4A0091,
+    0x22059,
+    0xA0914,
+    0x10A0914,
+    0x1C0,
+    0x829C0,
+    0x1A2011,
+    0x1A2098,
+    0x1A689A,
+    0x284851,
+    0x2008001,
+    0x1040400,
+    0x4A0091,
+    0x480C,
+    0x446000,
+    0x446C31,
+    0x4A0091,
+    0x1040400,
+    0x480C,
+    0x3001,
+    0x446000,
+    0x447001,
+    0x1040400,
+    0x4A0091,
+    0x480C,
+    0x3001,
+    0x446000,
+    0x447001,
+    0x1040400,
+    0x4A0091,
+    0x584180,
+    0x85014,
+    0x48015,
+    0x1040400,
+    0x4A0091,
+    0x21,
+    0x122002,
+    0x20130,
+    0x1831,
+    0x84080,
+    0x80900,
+    0x80921,
+    0x84800,
+    0x1040400,
+    0x4A0091,
+    0x480C,
+    0x5104,
+    0x2C008,
+    0xAC818,
+    0x1A2011,
+    0x40009,
+    0x4C0011,
+    0xA0011,
+    0x4A0011,
+    0x4A0091,
+    0x1040400,
+    0x1A2011,
+    0x6015,
+    0x160020,
+    0x160030,
+    0x162160,
+    0x4A0011,
+    0x600011,
+    0x1040400,
+    0x4A0091,
+    0xA6917,
+    0x406891,
+    0x605,
+    0x200000000A6E15,
+    0xA2811,
+    0x10B500,
+    0x282010,
+    0xA6917,
+    0xE1185,
+    0xA0010,
+    0x282010,
+    0x5002,
+    0xA6917,
+    0xA3111,
+    0x464530,
+    0x1004800,
+    0x282010,
+    0x5002,
+    0xA6917,
+    0x464530,
+    0x68C11,
+    0x68C11,
+    0x282010,
+    0x1083119,
+    0xA4C910,
+    0x20130,
+    0x20535,
+    0x464530,
+    0x809C0,
+    0xC000,
+    0xE140,
+    0x68401,
+    0x282010,
+    0x4000000000000,
+    0x1145,
+    0x68C11,
+    0x68C11,
+    0xE0001,
+    0x282010,
+    0x6803,
+    0x10A018B,
+    0xA0817,
+    0xA6917,
+    0x282010,
+    0x445011,
+    0x10A018B,
+    0xA0817,
+    0xA6917,
+    0x88011C,
+    0x1024081,
+    0x10A8001,
+    0x2C010,
+    0x80009,
+    0x404080,
+    0x282010,
+    0x803,
+    0xA0817,
+    0xA6917,
+    0x86134,
+    0x10A8001,
+    0x404080,
+    0x282010,
+    0x22013,
+    0xA6917,
+    0x4A211,
+    0x82003,
+    0xA0010,
+    0x282010,
+    0x5003,
+    0xA6917,
+    0xA611D,
+    0x4A211,
+    0xA110,
+    0x8A801,
+    0x282010,
+    0xA6917,
+    0x4808,
+    0x44808,
+    0x2C0931,
+    0x4A211,
+    0x282010,
+    0x28005,
+    0xA6917,
+    0xE1011,
+    0x282010,
+    0x812,
+    0xA6917,
+    0x1194,
+    0x402108,
+    0x282010,
+    0xA6917,
+    0x1027014,
+    0x7000,
+    0x602150,
+    0x282010,
+    0x20E810,
+    0x80160,
+    0x4048,
+    0xFFFFFFFFFFFFFFFF,
+    0x901,
+    0x100C04,
+    0x1007010,
+    0x20018,
+    0x40010,
+    0x282010,
+    0xA6917,
+    0x26102,
+    0x282010,
+    0x10A018B,
+    0x404002,
+    0x804002,
+    0xA6917,
+    0xE1185,
+    0x80160,
+    0xEA010,
+    0x168110,
+    0x428019,
+    0x282010,
+    0xA6917,
+    0x23118,
+    0x26102,
+    0x282010,
+    0x47109,
+    0x80514,
+    0xC0514,
+    0x282010,
+    0x47109,
+    0x1C0002,
+    0x80514,
+    0x282010,
+    0x420009,
+    0xA6917,
+    0x1819,
+    0x10A1901,
+    0xF185,
+    0x49085,
+    0x2028110,
+    0x1040801,
+    0xEC000,
+    0x10AC080,
+    0x12A4104,
+    0x402100,
+    0x402140,
+    0x420009,
+    0x1819,
+    0x420009,
+    0x4848,
+    0x1819,
+    0xEC000,
+    0x422110,
+    0x80C0000,
+    0xE0120,
+    0x4848,
+    0x1819,
+    0x8815,
+    0x420009,
+    0x10002008,
+    0x1819,
+    0x8815,
+    0x4601C,
+    0x260910,
+    0x420009,
+    0x20020008,
+    0x2026012,
+    0x1819,
+    0x8815,
+    0xA0188,
+    0x420009,
+    0x803,
+    0x84823,
+    0x184822,
+    0x64014,
+    0xEC000,
+    0x803,
+    0x40813,
+    0xEC000,
+    0x803,
+    0x204850,
+    0xC4823,
+    0xEC000,
+    0x123019,
+    0xEC000,
+    0x803,
+    0xC0C13,
+    0xC080,
+    0xEC000,
+    0x803,
+    0x1051,
+    0x1204813,
+    0xEC000,
+    0x23115,
+    0x803,
+    0x404802,
+    0x84823,
+    0xEC000,
+    0x168010,
+    0x803,
+    0x84823,
+    0x1120042,
+    0xEC000,
+    0x803,
+    0x1B0015,
+    0xEC000,
+    0xC2110,
+    0x4010C,
+    0x1002960,
+    0x181911,
+    0xEC000,
+    0x803,
+    0x406942,
+    0x1051,
+    0xEC000,
+    0xE0510,
+    0x803,
+    0x80003,
+    0xA0514,
+    0x1051,
+    0xEC000,
+    0x803,
+    0x938,
+    0x1051,
+    0x1004494,
+    0xC0504,
+    0xEC000,
+    0x1051,
+    0x1004494,
+    0x114,
+    0x108404,
+    0xC0504,
+    0xEC000,
+    0x803,
+    0x4841,
+    0x64815,
+    0xEC000,
+    0xC0504,
+    0xEC000,
+    0x803,
+    0x80003,
+    0x1051,
+    0x8819,
+    0xA140,
+    0xE140,
+    0xE040,
+    0x80813,
+    0xC2110,
+    0xEC000,
+    0x8710B,
+    0x2011A,
+    0x1051,
+    0x1B0015,
+    0x1C4C94,
+    0xEC000,
+    0x806142,
+    0x204850,
+    0xEC000,
+    0xE0001,
+    0x104208,
+    0xA0411,
+    0xA1901,
+    0x486419,
+    0x127120,
+    0xEC000,
+    0x4841,
+    0x82010,
+    0xEC000,
+    0x861,
+    0x4860,
+    0x4890,
+    0xEC000,
+    0x114,
+    0xC0411,
+    0xC2541,
+    0xEC000,
+    0xA3111,
+    0x401A0,
+    0x421E0,
+    0xC810,
+    0xEC000,
+    0x202148,
+    0x41401,
+    0x140007,
+    0x66D50,
+    0xEC000,
+    0xC0995,
+    0x122140,
+    0x40081,
+    0xE0180,
+    0xEC000,
+    0x40500,
+    0x40500,
+    0x446000,
+    0xEC000,
+    0x100850,
+    0x40818,
+    0x40858,
+    0x409D0,
+    0x446000,
+    0x86043,
+    0xEC000,
+    0x122944,
+    0x1051,
+    0x24404,
+    0xC6010,
+    0xEC000,
+    0x100802,
+    0x1140812,
+    0xA0009,
+    0xA011C,
+    0xA3111,
+    0x1051,
+    0x80180,
+    0xA0051,
+    0x180835,
+    0x1084000,
+    0x20000001004000,
+    0x1051,
+    0x1004000,
+    0x1000820,
+    0x80510,
+    0x64001,
+    0x1051,
+    0x102040,
+    0x1020C9,
+    0xCC900,
+    0x224810,
+    0x84800,
+    0x4A0011,
+    0x40E011,
+    0x1051,
+    0x400000000,
+    0x400000803,
+    0x803,
+    0x2090B,
+    0x801D0,
+    0x1051,
+    0xC800,
+    0x803,
+    0x10E0805,
+    0x1020121,
+    0x10A0931,
+    0x10C2021,
+    0x1A6030,
+    0x1A0030,
+    0x1145,
+    0x80811,
+    0x84800,
+    0x1051,
+    0x1145,
+    0x3145,
+    0x402009,
+    0x480184,
+    0x2420109,
+    0x1051,
+    0xA6814,
+    0xA3111,
+    0x1051,
+    0x204118,
+    0x1051,
+    0x10C4704,
+    0x204118,
+    0x205159,
+    0x46105,
+    0x1853,
+    0x3943,
+    0x1051,
+    0x3195,
+    0xC4800,
+    0xC4800,
+    0x11C,
+    0x118,
+    0xA3111,
+    0x1051,
+    0x100814,
+    0xA6D54,
+    0x440341,
+    0x8114,
+    0x2108810,
+    0x1051,
+    0x20013,
+    0x108A9C1,
+    0x148880,
+    0x1C0038,
+    0x1080018,
+    0x1084000,
+    0x1051,
+    0x100200D,
+    0xA0817,
+    0xA6917,
+    0x6104,
+    0x18,
+    0x2C0130,
+    0x1005001,
+    0x10A8001,
+    0xA109,
+    0x8A101,
+    0xFFFFFFFFFFFFFFFF,
+    0x1051,
+    0x803,
+    0x201D,
+    0x4410C,
+    0xA0950,
+    0x25100,
+    0x10A8001,
+    0x1051,
+    0x44483,
+    0x144483,
+    0x140483,
+    0x4808,
+    0x44808,
+    0x10E5481,
+    0xC2150,
+    0x160101,
+    0x1051,
+    0x2000D,
+    0x1051,
+    0x48019,
+    0x1C0100,
+    0x2000D,
+    0x87110,
+    0x1051,
+    0xA0091,
+    0xE0091,
+    0x1C0100,
+    0x2000D,
+    0x7109,
+    0x1051,
+    0x1C0100,
+    0x2000D,
+    0x100806,
+    0x140806,
+    0x1051,
+    0x1C0100,
+    0x40094,
+    0x108018,
+    0x80A81B,
+    0x40A001,
+    0x1051,
+    0x2000D,
+    0x1051,
+    0x24610,
+    0x42090D,
+    0x26049,
+    0x1051,
+    0x72C1,
+    0x20018,
+    0x2000D,
+    0x6000D,
+    0x424830,
+    0x1051,
+    0x4A211,
+    0x100A941,
+    0xA4005,
+    0xE0015,
+    0xA0001,
+    0xE0001,
+    0xA3111,
+    0x41401,
+    0x2F170,
+    0xA0091,
+    0xA0091,
+    0xCA191,
+    0xE0025,
+    0xA0001,
+    0x21031,
+    0x21039,
+    0x141010,
+    0x8A141,
+    0x1A8114,
+    0xE0001,
+    0xE0025,
+    0xA0001,
+    0xE0101,
+    0x10E0001,
+    0x10A0001,
+    0x124824,
+    0x2A0115,
+    0xA3111,
+    0x141010,
+    0xAA111,
+    0x8A141,
+    0x88811,
+    0xE0001,
+    0xE0025,
+    0x2818,
+    0x442150,
+    0x4C800,
+    0xE2140,
+    0xA0099,
+    0xE0001,
+    0xE0025,
+    0x102511A,
+    0x2818,
+    0x440010,
+    0x442150,
+    0xC0194,
+    0x1E0010,
+    0xA6941,
+    0xA0099,
+    0xE0001,
+    0xE0025,
+    0x803,
+    0xA4094,
+    0x82500,
+    0x1022001,
+    0xE0001,
+    0xE0025,
+    0x2400C,
+    0x86400,
+    0x2C010,
+    0x82859,
+    0x80110,
+    0x482110,
+    0x4C0100,
+    0xE0001,
+    0xE0025,
+    0x869C4,
+    0x1000010,
+    0x1040851,
+    0x1420011,
+    0x40851,
+    0x20409,
+    0x1000010,
+    0x1420011,
+    0x40851,
+    0x142851,
+    0x869C4,
+    0x200118,
+    0x1000010,
+    0x44850,
+    0xAE114,
+    0x140007,
+    0x443140,
+    0x402958,
+    0x869C4,
+    0xC4894,
+    0x84005,
+    0xA400C,
+    0x20008,
+    0x8AB110,
+    0x80615,
+    0x803,
+    0xC2114,
+    0x480190,
+    0x869C4,
+    0x1023054,
+    0x10C0031,
+    0x2C0010,
+    0x869C4,
+    0x869C4,
+    0x100D818,
+    0x82514,
+    0x164110,
+    0xE0180,
+    0x80110,
+    0x100812,
+    0x140805,
+    0xC4894,
+    0x869C4,
+    0x24805,
+    0x60018,
+    0xE0180,
+    0x4E1C0,
+    0x200000000E0180,
+    0xE0180,
+    0x402418,
+    0x100812,
+    0x140805,
+    0xC4894,
+    0x869C4,
+    0x3118,
+    0x60018,
+    0x42211,
+    0xCA001,
+    0x4E1C0,
+    0x1E4010,
+    0x402418,
+    0x10281A,
+    0x480C,
+    0x2414,
+    0x60025,
+    0x108000,
+    0x869C4,
+    0x244850,
+    0x2089,
+    0x869C4,
+    0x20002,
+    0x10281A,
+    0x84005,
+    0x480C,
+    0x80615,
+    0x108000,
+    0x869C4,
+    0x44404,
+    0xC6544,
+    0x869C4,
+    0xC4894,
+    0x869C4,
+    0x60018,
+    0x60018,
+    0x1002025,
+    0x4E1C0,
+    0x869C4,
+    0xA5837,
+    0x7500,
+    0x869C4,
+    0x60018,
+    0x60101,
+    0x821C3,
+    0x2000000000E114,
+    0x1C0100,
+    0x5C1100,
+    0x869C4,
+    0x6010,
+    0x8114,
+    0x821C3,
+    0x60132,
+    0x2000000000E114,
+    0x1C0100,
+    0x5C1100,
+    0x522019,
+    0x869C4,
+    0x821C3,
+    0xCA001,
+    0xE4080,
+    0x1C0100,
+    0x5C1100,
+    0x522019,
+    0x869C4,
+    0x821C3,
+    0x97,
+    0x2502,
+    0x869C4,
+    0xC800,
+    0x1C0100,
+    0x441100,
+    0x144812,
+    0xC4894,
+    0x869C4,
+    0x24805,
+    0x60018,
+    0x60018,
+    0x1000809,
+    0xE0180,
+    0x4E1C0,
+    0x407001,
+    0xFFFFFFFFFFFFFFFF,
+    0xC05,
+    0x8805,
+    0x4804,
+    0x6944,
+    0x201D,
+    0x2021,
+    0xA0920,
+    0x1A0830,
+    0x6968,
+    0x2089,
+    0x84080,
+    0x1040080,
+    0x869C4,
+    0xC4894,
+    0x869C4,
+    0x6104,
+    0x60018,
+    0x1002025,
+    0x20CB,
+    0x168010,
+    0x4E1C0,
+    0x43,
+    0xC4894,
+    0x869C4,
+    0x60018,
+    0x20CB,
+    0x1000809,
+    0x168010,
+    0x4E1C0,
+    0x43,
+    0xC4894,
+    0x869C4,
+    0x180884,
+    0x60018,
+    0x20CB,
+    0x10C084,
+    0x168010,
+    0x43,
+    0x40043,
+    0x84890,
+    0x4E1C0,
+    0x869C4,
+    0x8407,
+    0xA547,
+    0x43,
+    0x4443,
+    0x18611D,
+    0x160405,
+    0xC0895,
+    0x44884,
+    0x869C4,
+    0x97,
+    0x8920,
+    0xC820,
+    0x42809,
+    0x42809,
+    0x44090,
+    0x860C0,
+    0xC60C0,
+    0xFFFFFFFFFFFFFFFF,
+    0x869C4,
+    0x426002,
+    0xC4894,
+    0x869C4,
+    0x80030,
+    0x84020,
+    0x504,
+    0x3001,
+    0xFFFFFFFFFFFFFFFF,
+    0x44090,
+    0x44090,
+    0x4E1C0,
+    0x80995,
+    0xC4894,
+    0x869C4,
+    0xC0021,
+    0x504,
+    0x122140,
+    0x44090,
+    0x44090,
+    0x4E1C0,
+    0x62411,
+    0xC2110,
+    0xA547,
+    0x84002,
+    0x426002,
+    0xB145,
+    0x25C0,
+    0x1E4008,
+    0x44090,
+    0x869C4,
+    0x80813,
+    0x1005024,
+    0x80821,
+    0xC0821,
+    0x44090,
+    0x2000000004E900,
+    0x68910,
+    0x869C4,
+    0xC4894,
+    0x869C4,
+    0x60018,
+    0x461A1,
+    0x890,
+    0x40890,
+    0x200000000009D8,
+    0x44090,
+    0x44090,
+    0x4E1C0,
+    0xC4910,
+    0x407001,
+    0x898,
+    0x1C0,
+    0x869C4,
+    0x42809,
+    0x44090,
+    0x407001,
+    0xFFFFFFFFFFFFFFFF,
+    0x80813,
+    0x201D,
+    0x44090,
+    0x869C4,
+    0x84002,
+    0xC4894,
+    0x869C4,
+    0x60018,
+    0x44090,
+    0x44090,
+    0x4E1C0,
+    0x407001,
+    0xFFFFFFFFFFFFFFFF,
+    0x24021,
+    0x5006,
+    0x25040,
+    0x20181,
+    0x8504,
+    0x869C4,
+    0x869C4,
+    0x426004,
+    0x1001921,
+    0x2540,
+    0x201919,
+    0x112010,
+    0x1024801,
+    0x10A4801,
+    0x402100,
+    0xC4894,
+    0x869C4,
+    0x22059,
+    0x80081,
+    0xC0081,
+    0x10A8001,
+    0x407001,
+    0xFFFFFFFFFFFFFFFF,
+    0xC4894,
+    0x869C4,
+    0x1002025,
+    0x25821,
+    0x80081,
+    0x1145,
+    0x8C000,
+    0x8C081,
+    0x8005,
+    0xA6917,
+    0x869C4,
+    0x18611D,
+    0x1A6149,
+    0x80081,
+    0x64885,
+    0x40813,
+    0x82012,
+    0x91A,
+    0x8005,
+    0x9,
+    0x80081,
+    0x869C4,
+    0x1021001,
+    0x81890,
+    0x10A1901,
+    0x64918,
+    0x420001,
+    0x424101,
+    0x869C4,
+    0x109,
+    0x64004,
+    0x35,
+    0x80081,
+    0x81890,
+    0x160014,
+    0xFFFFFFFFFFFFFFFF,
+    0x869C4,
+    0x424410,
+    0x4001B,
+    0x869C4,
+    0x2C15,
+    0x1028011,
+    0x26950,
+    0xC5114,
+    0x80019,
+    0xC8D04,
+    0x109411,
+    0x869C4,
+    0x7109,
+    0x2059,
+    0x83051,
+    0x21119,
+    0x22140,
+    0x27015,
+    0x1042180,
+    0x6AD41,
+    0x402158,
+    0x869C4,
+    0x7109,
+    0x83051,
+    0x1050,
+    0x400A10,
+    0x1007010,
+    0x27015,
+    0xC6010,
+    0x402158,
+    0x869C4,
+    0x181010,
+    0x181018,
+    0x190110,
+    0xC2910,
+    0x146008,
+    0x68411,
+    0x404800,
+    0xC4020,
+    0x146008,
+    0x68411,
+    0x305810,
+    0x101118,
+    0x146008,
+    0x68411,
+    0x305810,
+    0x1C0,
+    0x104808,
+    0x141104,
+    0x146008,
+    0x68411,
+    0x305810,
+    0x60019,
+    0x187105,
+    0x104808,
+    0x16CC19,
+    0x108906,
+    0x146008,
+    0x221D4,
+    0xF0D1,
+    0x146008,
+    0x26080,
+    0xCC000,
+    0xCC801,
+    0x146008,
+    0x812,
+    0x20413,
+    0x120084,
+    0x146008,
+    0x812,
+    0x2613A,
+    0x181010,
+    0x6000,
+    0x86000,
+    0xAC19A,
+    0x190110,
+    0xC2910,
+    0x40881,
+    0x146008,
+    0x141104,
+    0x141905,
+    0x86010,
+    0x64014,
+    0x141104,
+    0x141905,
+    0x86010,
+    0x146008,
+    0x141104,
+    0x141905,
+    0x86010,
+    0xC6010,
+    0x146008,
+    0x1104,
+    0x2F194,
+    0x141104,
+    0x1C4108,
+    0x200810,
+    0x141104,
+    0x60918,
+    0xA6804,
+    0x46402,
+    0x141104,
+    0x24411,
+    0x1104,
+    0x2F194,
+    0x141104,
+    0x42140,
+    0x146008,
+    0x12001B,
+    0xE099,
+    0x146008,
+    0x141104,
+    0xA3111,
+    0x24109,
+    0x80002,
+    0x204118,
+    0x141104,
+    0x1E3110,
+    0x141104,
+    0x840001,
+    0x84E091,
+    0x141905,
+    0x1E3110,
+    0x141104,
+    0x1A9010,
+    0x141905,
+    0x60003,
+    0x1E3110,
+    0x2000201,
+    0x141104,
+    0x40009,
+    0x40918,
+    0x141905,
+    0xA7012,
+    0x2610D,
+    0x804002,
+    0xA6115,
+    0x1E3110,
+    0x141104,
+    0x2150010,
+    0x2954012,
+    0x141905,
+    0x1A0141,
+    0x1E3110,
+    0x141104,
+    0xE0001,
+    0x141905,
+    0x1E3110,
+    0x102441B,
+    0x141104,
+    0x141905,
+    0xE101,
+    0x1E3110,
+    0x141104,
+    0x206900,
+    0x141905,
+    0x6203,
+    0x141104,
+    0xE2158,
+    0x1E3110,
+    0x141905,
+    0x121008,
+    0x1E150C,
+    0x141104,
+    0x1E3110,
+    0x141905,
+    0x80013,
+    0x6045,
+    0x121008,
+    0x1E3110,
+    0x6840,
+    0x10A1080,
+    0x141905,
+    0x85,
+    0x201D,
+    0x1E3110,
+    0x61005,
+    0x141104,
+    0x10A8001,
+    0x16E114,
+    0xA0811,
+    0x40491,
+    0x60491,
+    0x141905,
+    0x200B,
+    0x130,
+    0x1C0921,
+    0x180830,
+    0x1E3110,
+    0x231C5,
+    0x141104,
+    0xE4095,
+    0xC904,
+    0x8110,
+    0x2401C,
+    0x406108,
+    0x141905,
+    0x10810C,
+    0x28081,
+    0x1E3110,
+    0x204810,
+    0x141104,
+    0xE4095,
+    0x141905,
+    0x814,
+    0x187105,
+    0x5912,
+    0xE090,
+    0x8E890,
+    0x424001,
+    0x10090A,
+    0x805,
+    0x814,
+    0x187105,
+    0x5912,
+    0xE090,
+    0x220114,
+    0x8E890,
+    0xE090,
+    0x8E890,
+    0x187105,
+    0xE090,
+    0x220114,
+    0x8E890,
+    0x20C100,
+    0x187105,
+    0x28051,
+    0xE090,
+    0x187105,
+    0x800021,
+    0x3195,
+    0xE090,
+    0x10A0013,
+    0x1AD014,
+    0x10A0013,
+    0x22119,
+    0xA6914,
+    0x1022050,
+    0x404800,
+    0x42C010,
+    0x1AD014,
+    0xA0914,
+    0x10A0914,
+    0x108840,
+    0x1AD014,
+    0x1AD014,
+    0x8C801,
+    0x4134,
+    0x8004,
+    0x6E811,
+    0x1AD014,
+    0xCC418,
+    0xA7100,
+    0x1AD014,
+    0xAA110,
+    0x1AD014,
+    0x102441B,
+    0x1AD014,
+    0x145010,
+    0x1AD014,
+    0xA0C07,
+    0x1AD014,
+    0x40508,
+    0x43508,
+    0x8C905,
+    0x1AD014,
+    0x40508,
+    0x100C820,
+    0x20000001120803,
+    0xC,
+    0x1AD014,
+    0x40508,
+    0x200008,
+    0x8C905,
+    0x20000001120803,
+    0xC,
+    0x1AD014,
+    0x40508,
+    0x200008,
+    0x8C905,
+    0x140007,
+    0x186905,
+    0x1A4805,
+    0x1AD014,
+    0x140480A,
+    0x21015,
+    0x3115,
+    0x1920,
+    0x1404888,
+    0x205110,
+    0x2401C,
+    0x809C0,
+    0x204118,
+    0x3115,
+    0x1920,
+    0x61031,
+    0x205110,
+    0x809C0,
+    0x204118,
+    0x3115,
+    0x1920,
+    0x205110,
+    0xAC214,
+    0x204118,
+    0x809C0,
+    0x86105,
+    0x2400B,
+    0x28815,
+    0x205110,
+    0x809C0,
+    0x204118,
+    0x2C6910,
+    0x280000,
+    0x204118,
+    0x809C0,
+    0x21015,
+    0x8C080,
+    0x40930,
+    0x4A001,
+    0x80002,
+    0xA8100,
+    0x204118,
+    0x809C0,
+    0x21015,
+    0x408A1,
+    0x204118,
+    0x809C0,
+    0x2501D,
+    0x21015,
+    0x80002,
+    0x204118,
+    0x809C0,
+    0x4808,
+    0x44884,
+    0x88011,
+    0x220004,
+    0x240080,
+    0x204118,
+    0x2C411D,
+    0x809C0,
+    0x40841,
+    0x803,
+    0x80830,
+    0x2000000008E970,
+    0x1003161,
+    0x42114,
+    0x60095,
+    0x80918,
+    0x84800,
+    0x809C0,
+    0x204118,
+    0x86005,
+    0x40841,
+    0x803,
+    0x1003161,
+    0xA01C0,
+    0x200000000AE1C0,
+    0x42114,
+    0x60095,
+    0x80918,
+    0x84800,
+    0x809C0,
+    0x204118,
+    0x281D,
+    0x809C0,
+    0x204118,
+    0x100802,
+    0x5104,
+    0xA0914,
+    0x119,
+    0x809C0,
+    0x204118,
+    0xA0914,
+    0xC09E1,
+    0x809C0,
+    0x84800,
+    0xA4084,
+    0x204118,
+    0x20003,
+    0xA2811,
+    0x809C0,
+    0x28011,
+    0x20018,
+    0x1E2011,
+    0x204118,
+    0x1000109,
+    0x9801,
+    0x809C0,
+    0x4900,
+    0x204118,
+    0x4402,
+    0x224014,
+    0xA401D,
+    0x2A411D,
+    0x18611D,
+    0x86412,
+    0x44884,
+    0x4A2140,
+    0x28011,
+    0x4402,
+    0x4481C,
+    0x18611D,
+    0x28011,
+    0x4402,
+    0x18611D,
+    0x10C2021,
+    0x406C58,
+    0x1020903,
+    0x246810,
+    0xE010,
+    0x22159,
+    0x28011,
+    0x4402,
+    0x18611D,
+    0x10C2021,
+    0x22050,
+    0x1020903,
+    0x22159,
+    0x28011,
+    0x100812,
+    0x4402,
+    0x18611D,
+    0x10C2021,
+    0x1020903,
+    0x22159,
+    0x28011,
+    0x4402,
+    0x18611D,
+    0x10C2021,
+    0x1020903,
+    0x26051,
+    0x22159,
+    0x28011,
+    0x4402,
+    0x44402,
+    0x18611D,
+    0x10C2021,
+    0x406C58,
+    0x1020903,
+    0x246810,
+    0x22159,
+    0x44884,
+    0x11C0008,
+    0x28011,
+    0x86412,
+    0x4402,
+    0x28011,
+    0x20858,
+    0x86412,
+    0x4402,
+    0x28011,
+    0x120804,
+    0x18701C,
+    0x8051,
+    0x28011,
+    0x4402,
+    0x28011,
+    0x64804,
+    0x4402,
+    0x18701C,
+    0x2165,
+    0x8051,
+    0x28011,
+    0x108000,
+    0x4402,
+    0x187105,
+    0x442010,
+    0x46A011,
+    0x28011,
+    0x4402,
+    0x442010,
+    0x46A011,
+    0x28011,
+    0x24818,
+    0x2000000012C818,
+    0x4402,
+    0x108000,
+    0x25403,
+    0x21401,
+    0x21411,
+    0xC0003,
+    0x4402,
+    0x28011,
+    0x25403,
+    0x21401,
+    0x4402,
+    0x28011,
+    0x813,
+    0x80041,
+    0x4402,
+    0x28011,
+    0x6104,
+    0x24809,
+    0x124010,
+    0x4848,
+    0x81811,
+    0x1007010,
+    0x20184,
+    0x260910,
+    0x1E0011,
+    0x43,
+    0x2403,
+    0x80012,
+    0x6902,
+    0x40085,
+    0xC4004,
+    0x24809,
+    0x4848,
+    0x7900,
+    0x1007010,
+    0x1007053,
+    0x8109,
+    0x100A141,
+    0x8C000,
+    0x20184,
+    0x402100,
+    0x1050,
+    0x4848,
+    0x440A10,
+    0x84800,
+    0x1007010,
+    0x2028110,
+    0x260910,
+    0x340813,
+    0x480891,
+    0xC0094,
+    0x1E0011,
+    0x2403,
+    0x86413,
+    0x902,
+    0x1122014,
+    0x1007010,
+    0x86010,
+    0x1002010,
+    0x2403,
+    0x86413,
+    0x902,
+    0x1122014,
+    0x24809,
+    0x1007010,
+    0x86010,
+    0xC000000,
+    0x2403,
+    0x86413,
+    0x902,
+    0x1122014,
+    0x124010,
+    0x1007010,
+    0x86010,
+    0x20184,
+    0x2403,
+    0x86413,
+    0x902,
+    0x6902,
+    0x40085,
+    0x1122014,
+    0x1007010,
+    0x86010,
+    0x10E008,
+    0x14E008,
+    0x2403,
+    0x86413,
+    0x902,
+    0x6902,
+    0x40085,
+    0x24809,
+    0x1000820,
+    0x7900,
+    0x1007010,
+    0x86010,
+    0x1008001,
+    0x442140,
+    0x2403,
+    0x2000D,
+    0x40085,
+    0x200D5,
+    0xA011C,
+    0x1007010,
+    0x1008001,
+    0x186145,
+    0xE552,
+    0x20211C,
+    0x206114,
+    0x2C020,
+    0xA8114,
+    0x1007010,
+    0x2403,
+    0xA0085,
+    0x1122014,
+    0x280C1,
+    0x4A40C0,
+    0x62155,
+    0xA1411,
+    0x1007010,
+    0x60110,
+    0xA2018,
+    0x528009,
+    0x1002010,
+    0x20000000001911,
+    0x1911,
+    0x20E810,
+    0xA0810,
+    0x1901,
+    0x20000000001911,
+    0x1911,
+    0xA0810,
+    0x1901,
+    0x222958,
+    0x20000000001911,
+    0x1911,
+    0x20E810,
+    0x7144,
+    0xA0810,
+    0x1901,
+    0x220114,
+    0xC2010,
+    0x424001,
+    0x187105,
+    0x406008,
+    0x20000000001911,
+    0x1911,
+    0x20E810,
+    0xA0810,
+    0x1901,
+    0x186140,
+    0x42018,
+    0xC2010,
+    0x804002,
+    0x1911,
+    0xA0810,
+    0x1901,
+    0x984002,
+    0xC2010,
+    0x10A0001,
+    0x804002,
+    0x1911,
+    0x806102,
+    0xA0810,
+    0x1901,
+    0x220114,
+    0x10A0001,
+    0x2024010,
+    0x804002,
+    0x187105,
+    0x1220918,
+    0x8455,
+    0x28815,
+    0x4A1C0,
+    0x1901,
+    0x4481C,
+    0x187105,
+    0x861,
+    0x1901,
+    0x805903,
+    0x8CC002,
+    0x60119,
+    0x4481C,
+    0x861,
+    0x424818,
+    0x1901,
+    0x805903,
+    0x8CC002,
+    0x861,
+    0x1901,
+    0x805903,
+    0xE010,
+    0x8CC002,
+    0x60119,
+    0x861,
+    0x424818,
+    0x1901,
+    0x805903,
+    0xE010,
+    0x8CC002,
+    0x1901,
+    0x805903,
+    0x8CC002,
+    0x84803,
+    0x804002,
+    0x1901,
+    0xA914,
+    0x4A2140,
+    0xC07,
+    0x2102,
+    0xA010,
+    0x4A2140,
+    0x186121,
+    0xA010,
+    0x4A2140,
+    0x8E903,
+    0xA010,
+    0x4A2140,
+    0x1EA183,
+    0x8A141,
+    0x4A2140,
+    0x1026005,
+    0x4A2140,
+    0x187105,
+    0x1119,
+    0x5010,
+    0xC6010,
+    0xA914,
+    0x4A2140,
+    0x60137,
+    0x4134,
+    0x930,
+    0x24838,
+    0x4134,
+    0x930,
+    0x24838,
+    0xE010,
+    0x4134,
+    0x2000D,
+    0x260118,
+    0x802118,
+    0x4134,
+    0x2281D,
+    0x80019,
+    0x4134,
+    0x2281D,
+    0x200000000A4031,
+    0x4020,
+    0x4134,
+    0xA0011,
+    0x86010,
+    0x8E019,
+    0x8009,
+    0x68901,
+    0x4134,
+    0x2281D,
+    0x8009,
+    0x68901,
+    0x4134,
+    0x2000D,
+    0x802118,
+    0x4808,
+    0x824818,
+    0x44884,
+    0x4134,
+    0xA0085,
+    0x80009,
+    0x280C1,
+    0x4A40C0,
+    0x62155,
+    0xA01C0,
+    0xA2018,
+    0x108000,
+    0x528009,
+    0x4134,
+    0xA0085,
+    0x80009,
+    0x6215D,
+    0x406008,
+    0x426009,
+    0x280C1,
+    0x282151,
+    0xA2018,
+    0x4134,
+    0x20003,
+    0xA0085,
+    0x80009,
+    0x280C1,
+    0x4134,
+    0x2C90F,
+    0x4008,
+    0xC0900,
+    0xC6010,
+    0x4134,
+    0x4855,
+    0xA100,
+    0x14A180,
+    0x4134,
+    0x86905,
+    0x9001,
+    0xA100,
+    0x14A180,
+    0x126008,
+    0x4134,
+    0x28915,
+    0x4134,
+    0x2D00,
+    0x2D18,
+    0x28915,
+    0x68915,
+    0x4134,
+    0x2851,
+    0x58,
+    0x81081,
+    0x120810,
+    0xE01C1,
+    0xE01D9,
+    0x4134,
+    0x2851,
+    0x81081,
+    0x120810,
+    0x120810,
+    0xC0010,
+    0x40918,
+    0xA2951,
+    0x1A2941,
+    0x4134,
+    0x180004,
+    0x182144,
+    0x28011,
+    0x64104,
+    0x84800,
+    0x4134,
+    0x804002,
+    0x2000D,
+    0x930,
+    0x4134,
+    0x82117,
+    0x930,
+    0x2960,
+    0x28011,
+    0x4134,
+    0x2005,
+    0x20053,
+    0xE0081,
+    0x4C0011,
+    0x4C0413,
+    0x4134,
+    0x4481C,
+    0x4C04,
+    0x4C1C,
+    0x2A8111,
+    0x2041D,
+    0x4C04,
+    0xE010,
+    0x106C04,
+    0x106C1C,
+    0x2500,
+    0x4C04,
+    0x4C1C,
+    0x2102,
+    0xA010,
+    0x1228105,
+    0x512,
+    0x4481C,
+    0x1000410,
+    0x4C04,
+    0x4C1C,
+    0x160014,
+    0x1000410,
+    0x1040410,
+    0x4C04,
+    0x25201,
+    0x46C009,
+    0x106C04,
+    0x100814,
+    0x1000410,
+    0x4C04,
+    0x4808,
+    0x21091,
+    0x5090,
+    0x2AF110,
+    0x68111,
+    0x84800,
+    0x800001,
+    0x800011,
+    0xC084,
+    0x80095,
+    0xC8900,
+    0x404008,
+    0x84800,
+    0x21091,
+    0x3140,
+    0x8504,
+    0x84800,
+    0x21091,
+    0x8504,
+    0x84800,
+    0x21091,
+    0x6A011,
+    0x84800,
+    0x422094,
+    0x20059,
+    0x2530,
+    0x40E011,
+    0x84800,
+    0x6401C,
+    0x464008,
+    0x40E011,
+    0x84800,
+    0x5002,
+    0x5002,
+    0x5104,
+    0x166059,
+    0x84E910,
+    0x84080,
+    0x84800,
+    0x27053,
+    0x12601A,
+    0x16E114,
+    0x40E011,
+    0x84800,
+    0x20095,
+    0x1020095,
+    0x424001,
+    0x404002,
+    0x1E0141,
+    0x84800,
+    0x40E011,
+    0x200410D,
+    0x40998,
+    0x40E011,
+    0x84800,
+    0xAA015,
+    0x10AA015,
+    0x180004,
+    0x121812,
+    0x440001,
+    0x84800,
+    0xA1100,
+    0x5090,
+    0x2AF110,
+    0x6A011,
+    0x84800,
+    0x422094,
+    0x808B9,
+    0x1002089,
+    0x460014,
+    0x66011C,
+    0x84800,
+    0x84802,
+    0x5090,
+    0x2AF110,
+    0x182000,
+    0x84800,
+    0x4044,
+    0x4048D4,
+    0x20051,
+    0x84800,
+    0x9805,
+    0x6D014,
+    0x84800,
+    0x200114,
+    0x2817,
+    0x1C0314,
+    0x20903,
+    0x40815,
+    0x40815,
+    0x84800,
+    0x4801D0,
+    0x200410D,
+    0x10C0917,
+    0x290A,
+    0x2015,
+    0x2E142,
+    0x480190,
+    0x84800,
+    0x2D00,
+    0x42D00,
+    0x84800,
+    0x20413,
+    0x22553,
+    0x26412,
+    0x2185,
+    0x140024,
+    0x25038,
+    0x84800,
+    0x2185,
+    0x42185,
+    0x84800,
+    0x80085,
+    0x24404,
+    0x320014,
+    0x62011,
+    0x4480,
+    0x8E100,
+    0x42950,
+    0x84800,
+    0x804002,
+    0xC0094,
+    0x3195,
+    0x20018,
+    0x84800,
+    0x884802,
+    0xA6105,
+    0x64090,
+    0x83051,
+    0x83155,
+    0x282151,
+    0x2CC110,
+    0x48091,
+    0x100000,
+    0x84800,
+    0x1906,
+    0x20819,
+    0x122040,
+    0xC8010,
+    0x84800,
+    0x1120002,
+    0x148,
+    0x22059,
+    0x4890,
+    0x8A801,
+    0x4C004,
+    0x244890,
+    0x446000,
+    0x48019,
+    0x84800,
+    0x1917,
+    0x10E1194,
+    0x84800,
+    0x42114,
+    0xC1194,
+    0x10E1194,
+    0x8AB110,
+    0x803,
+    0x42114,
+    0xC0010,
+    0x180012,
+    0xA0117,
+    0xC4942,
+    0x1004942,
+    0x1A0814,
+    0x40188,
+    0x803,
+    0xA8110,
+    0x42114,
+    0xC4942,
+    0x2009,
+    0x386910,
+    0x2050,
+    0xC2154,
+    0x930,
+    0x42114,
+    0x8AB110,
+    0x803,
+    0x6D114,
+    0x42114,
+    0x84800,
+    0x86005,
+    0x8E0911,
+    0x42114,
+    0xCC814,
+    0x84800,
+    0x42911,
+    0x82011,
+    0x86005,
+    0x40188,
+    0xC0911,
+    0x42114,
+    0xA400C,
+    0x100820,
+    0x311C,
+    0x2818,
+    0xC4080,
+    0x40504,
+    0x1062150,
+    0x84800,
+    0x286105,
+    0x191D,
+    0x81A,
+    0x480A,
+    0x86109,
+    0x2C008,
+    0x1122300,
+    0x311C,
+    0x1E7111,
+    0x191D,
+    0xA400C,
+    0x160048,
+    0x8111D,
+    0x311C,
+    0x8900,
+    0x48900,
+    0x40504,
+    0x283101,
+    0x191D,
+    0x240199,
+    0x205B,
+    0x191D,
+    0x109,
+    0x2015,
+    0x1A0084,
+    0x10C090B,
+    0x8890,
+    0x1A0080,
+    0x122318,
+    0x1085902,
+    0xC0504,
+    0x191D,
+    0xA400C,
+    0xA0091,
+    0x311C,
+    0xCC094,
+    0x191D,
+    0x46012,
+    0xA400C,
+    0x191D,
+    0xC6C10,
+    0x140C00,
+    0x20000001820001,
+    0x1820001,
+    0x1020001,
+    0x407,
+    0xC4814,
+    0x24008,
+    0xA6020,
+    0x144898,
+    0x10C0917,
+    0x2A4811,
+    0xC4180,
+    0x80920,
+    0x144898,
+    0x109411,
+    0x25100,
+    0xA6934,
+    0xA4834,
+    0x149814,
+    0x144898,
+    0x20101,
+    0x21031,
+    0x600B0,
+    0xE150,
+    0xEA011,
+    0x600110,
+    0x406108,
+    0x144898,
+    0x1A,
+    0x84890,
+    0x48810,
+    0x144898,
+    0x104084,
+    0x84890,
+    0x9801,
+    0x144898,
+    0x20185,
+    0xC0011,
+    0xC0100,
+    0x144898,
+    0xA5083,
+    0x84910,
+    0x144898,
+    0x108004,
+    0x24034,
+    0x129812,
+    0x12A850,
+    0xC000,
+    0x1C6104,
+    0x84910,
+    0x144898,
+    0x464090,
+    0x4A0011,
+    0x144898,
+    0x80083,
+    0x180083,
+    0x144898,
+    0x80103,
+    0x40094,
+    0x120810,
+    0x145010,
+    0x1ED011,
+    0x62011,
+    0xA8001,
+    0x144898,
+    0x2024001,
+    0x68081,
+    0x240091,
+    0x144898,
+    0x84812,
+    0x86900,
+    0x21E5110,
+    0x4D081,
+    0x162014,
+    0x144898,
+    0x28119,
+    0xA100,
+    0x10A400,
+    0x24404,
+    0x10C0031,
+    0x144898,
+    0x25002,
+    0x2955,
+    0x44A150,
+    0x480184,
+    0x144898,
+    0xC0413,
+    0x23161,
+    0x1122809,
+    0xA104,
+    0x144898,
+    0x28011,
+    0x24800,
+    0x84910,
+    0x4C4810,
+    0x144898,
+    0x180416,
+    0x40405,
+    0x8901,
+    0x280001,
+    0x144898,
+    0x20003,
+    0x821C3,
+    0x2815,
+    0x2955,
+    0xA0891,
+    0x4C001,
+    0x4C189,
+    0x144898,
+    0x100812,
+    0x140812,
+    0x128002,
+    0x2815,
+    0x86961,
+    0x28811,
+    0x4C001,
+    0x5A2019,
+    0x144898,
+    0xA5083,
+    0x160082,
+    0x2815,
+    0x82819,
+    0x10021D0,
+    0x80090,
+    0x10A4910,
+    0x1E4082,
+    0x144898,
+    0x66143,
+    0x2955,
+    0x16C000,
+    0x44401,
+    0x4E050,
+    0x144898,
+    0x9C21D0,
+    0x9E21D0,
+    0x20130,
+    0x112094,
+    0x144898,
+    0xA0005,
+    0x4E1C0,
+    0x10A4810,
+    0x144898,
+    0xA0155,
+    0x47540,
+    0x84216,
+    0xA4090,
+    0x6124,
+    0x19,
+    0x80099,
+    0x229111,
+    0x84216,
+    0xA4090,
+    0x10A1014,
+    0x19,
+    0x220051,
+    0x1220059,
+    0xC6099,
+    0x25911,
+    0x28100,
+    0x85002,
+    0xC7012,
+    0x84216,
+    0xA4090,
+    0x40091,
+    0x80099,
+    0x122831,
+    0x122000,
+    0x84216,
+    0xA4090,
+    0x181811,
+    0x1B,
+    0x100812,
+    0x21085,
+    0x20000001200910,
+    0x2022001,
+    0xC3901,
+    0x84216,
+    0xA4090,
+    0x181811,
+    0x81121,
+    0x1A6030,
+    0x100158,
+    0x41081,
+    0x2089,
+    0x1021001,
+    0x21101,
+    0x9801,
+    0xAC014,
+    0xAE114,
+    0x84216,
+    0xA4090,
+    0x35,
+    0x5101,
+    0x1005101,
+    0x1C0011,
+    0xC6035,
+    0x2A0811,
+    0x84216,
+    0xA4090,
+    0x2000D,
+    0xE7119,
+    0x86114,
+    0x88514,
+    0x2880D,
+    0x118811,
+    0xEC010,
+    0x42140,
+    0x84216,
+    0xA4090,
+    0x2000D,
+    0xE291D,
+    0x18701C,
+    0x108,
+    0x8613D,
+    0x42914,
+    0x11E0114,
+    0x84216,
+    0xA4090,
+    0x81001,
+    0x185019,
+    0x2403,
+    0x40085,
+    0x1007010,
+    0x42140,
+    0xA0810,
+    0xEE001,
+    0x2102,
+    0xA0910,
+    0xA2912,
+    0x42140,
+    0xEE001,
+    0x22548,
+    0x8C813,
+    0x4A0011,
+    0x42140,
+    0xEE001,
+    0x40015,
+    0xA18D,
+    0x1045802,
+    0x420995,
+    0x42140,
+    0xEE001,
+    0xA5083,
+    0x12A4801,
+    0x3001,
+    0xFFFFFFFFFFFFFFFF,
+    0xE5010,
+    0x25000,
+    0x84910,
+    0x400004,
+    0x3010,
+    0x42140,
+    0xEE001,
+    0xA5083,
+    0x12A4801,
+    0xE5010,
+    0x25000,
+    0x84910,
+    0x400004,
+    0x407001,
+    0xFFFFFFFFFFFFFFFF,
+    0x42140,
+    0xEE001,
+    0x407010,
+    0xA5083,
+    0x12A4801,
+    0xE5010,
+    0x84910,
+    0x400004,
+    0x42140,
+    0xEE001,
+    0x1000003,
+    0x21C5,
+    0x1045802,
+    0x42140,
+    0xEE001,
+    0xA5083,
+    0xC4814,
+    0x12A4801,
+    0xE5010,
+    0x84910,
+    0x4A0011,
+    0x400004,
+    0x42140,
+    0xEE001,
+    0xA6804,
+    0xEC001,
+    0x42140,
+    0xEE001,
+    0x1C5004,
+    0xA545,
+    0x42140,
+    0xEE001,
+    0x220119,
+    0x53,
+    0x40043,
+    0x40015,
+    0x49C,
+    0x1905,
+    0x1126210,
+    0xA545,
+    0xA811,
+    0x1020019,
+    0x2A0811,
+    0xA8100,
+    0x42140,
+    0xEE001,
+    0x53,
+    0x40015,
+    0x80830,
+    0x24C14,
+    0x100851,
+    0x42140,
+    0xEE001,
+    0x186105,
+    0x422141,
+    0x98C,
+    0x2299C,
+    0x66144,
+    0xEA119,
+    0xA0125,
+    0x422141,
+    0x4008,
+    0x10A2010,
+    0x921,
+    0x2613A,
+    0x6000,
+    0x86000,
+    0x48001,
+    0xAC19A,
+    0xA0125,
+    0x422141,
+    0x10A2010,
+    0x2613A,
+    0x6000,
+    0x86000,
+    0xAC19A,
+    0x45410,
+    0x422141,
+    0x1000916,
+    0x1040916,
+    0x512,
+    0x2613A,
+    0x6000,
+    0x86000,
+    0xAC19A,
+    0x422141,
+    0x2613A,
+    0x6000,
+    0x86000,
+    0xAC19A,
+    0x45410,
+    0x47540,
+    0x422141,
+    0x2613A,
+    0xA0910,
+    0xA2950,
+    0x6000,
+    0x86000,
+    0xAC19A,
+    0x422141,
+    0x1020008,
+    0x20000000026548,
+    0x2000000008E813,
+    0xAC19A,
+    0x4A0011,
+    0x6000,
+    0x8C813,
+    0x422141,
+    0x2613A,
+    0x6000,
+    0x86000,
+    0xEA119,
+    0xEA119,
+    0xAC19A,
+    0x422141,
+    0x814,
+    0x2613A,
+    0x5912,
+    0x6000,
+    0x86000,
+    0xE090,
+    0x4E090,
+    0xAC19A,
+    0x8E890,
+    0x422141,
+    0x408000000,
+    0x51,
+    0x821D0,
+    0x2613A,
+    0x6000,
+    0x86000,
+    0x6010,
+    0xAC19A,
+    0xE6114,
+    0x122059,
+    0x122018,
+    0x422141,
+    0x2A411D,
+    0x42140,
+    0x422141,
+    0x202418B,
+    0x42140,
+    0x422141,
+    0x424001,
+    0x2290D,
+    0xA611C,
+    0xA6080,
+    0x108000,
+    0x424001,
+    0xA611C,
+    0xA291D,
+    0xE6091,
+    0x200000001A81C0,
+    0xA01C0,
+    0x108000,
+    0x424001,
+    0x2290D,
+    0xA611C,
+    0xC0011,
+    0xA01C0,
+    0x424001,
+    0xA611C,
+    0x200000004A61C8,
+    0xA291D,
+    0x1C4091,
+    0x406008,
+    0xA01C0,
+    0x424001,
+    0x2290D,
+    0xA611C,
+    0x406008,
+    0x1C4080,
+    0x424001,
+    0xA611C,
+    0x20000000486838,
+    0xA291D,
+    0x5C4090,
+    0x406008,
+    0x80830,
+    0x424001,
+    0x2290D,
+    0xA611C,
+    0x80830,
+    0x4C0010,
+    0x424001,
+    0xA611C,
+    0xA291D,
+    0x4E6090,
+    0x20000000188830,
+    0x80830,
+    0x108000,
+    0x424001,
+    0x2000000050E008,
+    0x406008,
+    0x108000,
+    0x424001,
+    0x200000000A09F0,
+    0x80830,
+    0xA01C0,
+    0x424001,
+    0x322144,
+    0x80830,
+    0xA01C0,
+    0x424001,
+    0x322144,
+    0x80830,
+    0xA01C0,
+    0x424001,
+    0x322144,
+    0xA01C0,
+    0x108000,
+    0x424001,
+    0x322144,
+    0x406008,
+    0xA01C0,
+    0x424001,
+    0x464001,
+    0x444D14,
+    0x600B0,
+    0x24819,
+    0x2A0915,
+    0x2141,
+    0x4C6D15,
+    0x424001,
+    0x464001,
+    0x186002,
+    0x5E6D14,
+    0x219,
+    0x600B0,
+    0x462198,
+    0x300000,
+    0x424001,
+    0x407,
+    0x424001,
+    0x2018,
+    0x424001,
+    0x21401,
+    0x20000006000,
+    0x424001,
+    0x20002,
+    0x405000,
+    0x46000,
+    0x424001,
+    0x5190,
+    0x8C000,
+    0x108000,
+    0x8815,
+    0x1028001,
+    0x26950,
+    0x46C180,
+    0xC0191,
+    0x85001,
+    0x1045802,
+    0x26950,
+    0x102188,
+    0x5000,
+    0x26950,
+    0x200109,
+    0x400210,
+    0x440390,
+    0x141309,
+    0x26950,
+    0xE0001,
+    0x1C018A,
+    0x21089,
+    0x26950,
+    0x400890,
+    0x18092C,
+    0x240910,
+    0x26950,
+    0x84001,
+    0xC4101,
+    0x84801,
+    0x1002041,
+    0x1002100,
+    0x1002141,
+    0xE0184,
+    0xE2185,
+    0x64004,
+    0x82901,
+    0x26950,
+    0xE2185,
+    0x64004,
+    0x8A4088,
+    0x26950,
+    0xE2014,
+    0x41901,
+    0x141900,
+    0x23009,
+    0x26950,
+    0xE0001,
+    0x29D1,
+    0x8015,
+    0x108835,
+    0x1045802,
+    0x26950,
+    0x12381F,
+    0xC2D1D,
+    0x102481,
+    0x440390,
+    0x141309,
+    0x27091,
+    0x26950,
+    0x84018,
+    0x1A6030,
+    0x440390,
+    0x141309,
+    0x200000008CE118,
+    0xE0001,
+    0x8E118,
+    0x26950,
+    0x840100,
+    0x58,
+    0x800B1,
+    0x40C81,
+    0x2489,
+    0x26950,
+    0x40580,
+    0x41580,
+    0x800D0,
+    0x60111,
+    0x6C094,
+    0x21001,
+    0x200410D,
+    0x100802,
+    0x6C094,
+    0x804000,
+    0x1E0001,
+    0x200410D,
+    0x3150,
+    0x6C094,
+    0x4C2100,
+    0x200410D,
+    0x22015,
+    0x20007,
+    0x6C094,
+    0x200410D,
+    0x6C094,
+    0x4810,
+    0x6900,
+    0x200410D,
+    0x6C094,
+    0x224140,
+    0x200410D,
+    0x2817,
+    0x6C094,
+    0x1C0314,
+    0x20903,
+    0x40815,
+    0x200410D,
+    0x6C094,
+    0x6C104,
+    0x6E104,
+    0x16C104,
+    0x200410D,
+    0x20095,
+    0x6C094,
+    0x1E0141,
+    0x200410D,
+    0x2E105,
+    0x84041,
+    0x6C094,
+    0x200410D,
+    0x170101,
+    0x20013,
+    0x6C094,
+    0x4A0011,
+    0x200410D,
+    0x401A0,
+    0x6C094,
+    0x48114,
+    0x200410D,
+    0x20013,
+    0x14C184,
+    0xEA010,
+    0x42411,
+    0x200410D,
+    0x424001,
+    0x186002,
+    0x6401C,
+    0x1408B0,
+    0xE0405,
+    0x200001,
+    0x1045802,
+    0x424001,
+    0x186002,
+    0x444D14,
+    0xA8011,
+    0x200001,
+    0x1045802,
+    0x424001,
+    0x186002,
+    0x444D14,
+    0x6014,
+    0xA8011,
+    0x42950,
+    0x200001,
+    0x1045802,
+    0x424001,
+    0x186002,
+    0x1008801,
+    0xA01C0,
+    0xA2951,
+    0x200001,
+    0x1045802,
+    0x424001,
+    0x186002,
+    0x10481A,
+    0xC0021,
+    0x200000004E4029,
+    0x424029,
+    0x200001,
+    0x1045802,
+    0x424001,
+    0x186002,
+    0x882010,
+    0x42014,
+    0xA0405,
+    0xA2951,
+    0x200001,
+    0x1045802,
+    0x424001,
+    0x186002,
+    0x148011,
+    0x1008801,
+    0xA01C0,
+    0xA2951,
+    0x200001,
+    0x1045802,
+    0x424001,
+    0x186002,
+    0x80830,
+    0x260010,
+    0xA2951,
+    0x200001,
+    0x1045802,
+    0x424001,
+    0x186002,
+    0x10481A,
+    0xC0021,
+    0x260010,
+    0x422118,
+    0x200001,
+    0x1045802,
+    0x424001,
+    0x186002,
+    0xC0801,
+    0x36C110,
+    0x42014,
+    0xA0405,
+    0xA2951,
+    0x200001,
+    0x1045802,
+    0x424001,
+    0x186002,
+    0x20018,
+    0x108000,
+    0x568009,
+    0x200001,
+    0x1045802,
+    0x424001,
+    0x186002,
+    0x10481A,
+    0xC0021,
+    0x108000,
+    0x200001,
+    0x1045802,
+    0x424001,
+    0x186002,
+    0x406008,
+    0x466009,
+    0x20018,
+    0x200001,
+    0x1045802,
+    0x424001,
+    0x186002,
+    0x10481A,
+    0x406008,
+    0xC0021,
+    0x200001,
+    0x1045802,
+    0x20003,
+    0x186002,
+    0x10481A,
+    0x148011,
+    0x2A0915,
+    0x200001,
+    0x1045802,
+    0x186002,
+    0x170011,
+    0xCC000,
+    0x200001,
+    0x1045802,
+    0x186002,
+    0x20914,
+    0x2401C,
+    0x200001,
+    0x1045802,
+    0x186002,
+    0x80214,
+    0x200001,
+    0x1045802,
+    0x21015,
+    0x3115,
+    0x1920,
+    0x205110,
+    0x200001,
+    0x1045802,
+    0xE21D2,
+    0x186002,
+    0x1108,
+    0x404800,
+    0x200001,
+    0x1045802,
+    0xA01C2,
+    0xE21D2,
+    0x186002,
+    0x809C0,
+    0x200001,
+    0x1045802,
+    0x82011,
+    0x20003,
+    0x60003,
+    0x814,
+    0x187105,
+    0x5912,
+    0xE090,
+    0x42941,
+    0x8E890,
+    0x200001,
+    0x1045802,
+    0x2600B,
+    0x1AD014,
+    0x1286114,
+    0xCC080,
+    0xA2110,
+    0x4A6410,
+    0x1A4010,
+    0xEF091,
+    0x20000000400120,
+    0x400120,
+    0x460910,
+    0x402801,
+    0x200001,
+    0x1045802,
+    0x814,
+    0x187105,
+    0x5912,
+    0x5018,
+    0xE090,
+    0x8E890,
+    0x2A6103,
+    0x200001,
+    0x1045802,
+    0x814,
+    0x5912,
+    0x4020,
+    0xE090,
+    0x8E890,
+    0x200001,
+    0x1045802,
+    0x1831,
+    0x42140,
+    0x407001,
+    0x22058,
+    0x1811,
+    0x3001,
+    0x42140,
+    0x22058,
+    0x1045802,
+    0xE2059,
+    0x22058,
+    0xFFFFFFFFFFFFFFFF,
+    0x2815,
+    0x18F905,
+    0x1189900,
+    0x42140,
+    0x800000,
+    0x81081,
+    0x8000000000000,
+    0x148800,
+    0x81081,
+    0x20000000000000,
+    0xFFFFFFFFFFFFFFFF,
+    0x1200091,
+    0x81081,
+    0x143100,
+    0x42140,
+    0xFFFFFFFFFFFFFFFF,
+    0x200118,
+    0x246108,
+    0x1200091,
+    0x81081,
+    0x42140,
+    0x462011,
+    0x110811,
+    0x1190911,
+    0x150811,
+    0x1200091,
+    0x81081,
+    0x42140,
+    0x224030,
+    0x1082120,
+    0x10601A,
+    0x362911,
+    0x81081,
+    0x20000000000,
+    0x20000000000,
+    0x2043,
+    0x10481A,
+    0x887915,
+    0x21401,
+    0x18E105,
+    0x20000000000,
+    0xA0000000000,
+    0x80000000000,
+    0x887915,
+    0xA6153,
+    0x21401,
+    0x18E105,
+    0x1D6110,
+    0x80000000000,
+    0x21401,
+    0x18E105,
+    0x1D6110,
+    0x20018,
+    0x80000000000,
+    0x21401,
+    0x186918,
+    0x18E105,
+    0x1D6110,
+    0x480190,
+    0x20000000000,
+    0x887915,
+    0x21401,
+    0x186918,
+    0x18E105,
+    0x480190,
+    0x20000000000,
+    0x887915,
+    0x21401,
+    0x18E105,
+    0x20018,
+    0x40089,
+    0x18E105,
+    0x1600001,
+    0x2403,
+    0x1122014,
+    0x8020D5,
+    0x1007010,
+    0x6902,
+    0x40085,
+    0x200D5,
+    0x1122014,
+    0x24809,
+    0x1200091,
+    0x7900,
+    0x1007010,
+    0x1008001,
+    0x42140,
+    0x148915,
+    0x191D,
+    0x311C,
+    0xC0021,
+    0x1045802,
+    0xA4090,
+    0x1020814,
+    0x1022954,
+    0x1045802,
+    0xA4090,
+    0x20000000160938,
+    0xC25C0,
+    0x18,
+    0x120830,
+    0x40900,
+    0xA4090,
+    0x1045802,
+    0x26085,
+    0x1812,
+    0x4E118,
+    0x48180,
+    0x84800,
+    0xA2118,
+    0xA4090,
+    0x1045802,
+    0x5B,
+    0x3011,
+    0xA4090,
+    0x1045802,
+    0x22152,
+    0x226094,
+    0x22050,
+    0x4A211,
+    0x831,
+    0x1045802,
+    0x84800,
+    0x1404810,
+    0xA4090,
+    0x20914,
+    0x1200091,
+    0x404880,
+    0x20851,
+    0x4000,
+    0x20018,
+    0xA4090,
+    0x1045802,
+    0xFFFFFFFFFFFFFFFF,
+    0x186002,
+    0x494,
+    0x49C,
+    0x21495,
+    0x8D814,
+    0x8D81C,
+    0x6018,
+    0x800138,
+    0x21401,
+    0x80504,
+    0xA4090,
+    0x1045802,
+    0xFFFFFFFFFFFFFFFF,
+    0x84803,
+    0x804002,
+    0x494,
+    0x49C,
+    0x6018,
+    0x4020,
+    0x80504,
+    0xA4090,
+    0x1045802,
+    0xFFFFFFFFFFFFFFFF,
+    0x494,
+    0x49C,
+    0x21495,
+    0x6018,
+    0x1200091,
+    0x21401,
+    0x80504,
+    0xA4090,
+    0x1045802,
+    0xFFFFFFFFFFFFFFFF,
+    0x2815,
+    0x64004,
+    0x21401,
+    0x18F905,
+    0x1189900,
+    0x800000,
+    0xA4090,
+    0x1045802,
+    0xFFFFFFFFFFFFFFFF,
+    0x186002,
+    0x64004,
+    0x21401,
+    0x18F905,
+    0x1189900,
+    0x170011,
+    0x800000,
+    0xA4090,
+    0x1045802,
+    0x120804,
+    0x1120804,
+    0xC800,
+    0xA4090,
+    0x1045802,
+    0x120804,
+    0x1120804,
+    0x10481A,
+    0xC800,
+    0xA4090,
+    0x1045802,
+    0xA6911,
+    0x21401,
+    0xA8001,
+    0xA4090,
+    0x1045802,
+    0x4000000000000,
+    0xE0511,
+    0x200000000CC5D8,
+    0x801D0,
+    0xA4090,
+    0x4C418,
+    0x1045802,
+    0x4000000000000,
+    0x2000000008E1D8,
+    0xE0001,
+    0x801D0,
+    0xA4090,
+    0x8E118,
+    0x1045802,
+    0x4000000000000,
+    0x68C11,
+    0xA4090,
+    0x1045802,
+    0x4,
+    0x10AC1C4,
+    0xA4090,
+    0x1045802,
+    0x20000,
+    0xE0158,
+    0xA4090,
+    0x1045802,
+    0x21401,
+    0x81000,
+    0xA0019,
+    0xA1419,
+    0xA4090,
+    0x1045802,
+    0x28108,
+    0x4980,
+    0x2500,
+    0x110908,
+    0x41010,
+    0x8A101,
+    0x48900,
+    0xE8811,
+    0xC2101,
+    0xA4090,
+    0x1045802,
+    0x1008415,
+    0x1008415,
+    0x4000000,
+    0x1008415,
+    0x2024010,
+    0x8000000,
+    0x1008415,
+    0x6010,
+    0x10000000,
+    0x1008415,
+    0x484000,
+    0x20000000,
+    0x1008415,
+    0xA0090,
+    0x40000000,
+    0x124020,
+    0x1008415,
+    0x80000000,
+    0x200130,
+    0x1008415,
+    0x100000000,
+    0x1008415,
+    0x840100,
+    0x200000000,
+    0x1008415,
+    0x242010,
+    0x400000000,
+    0x801D0,
+    0x1008415,
+    0x800000000,
+    0x1008415,
+    0x2110,
+    0x1008415,
+    0xC000000,
+    0xF,
+    0x18A100,
+    0x82901,
+    0xE0810,
+    0x168015,
+    0x10B881,
+    0xF,
+    0x18A100,
+    0x82901,
+    0xE0810,
+    0x464815,
+    0x10B881,
+    0x78000000,
+    0x18A100,
+    0x163012,
+    0x10B881,
+    0x400000000000,
+    0x200000000000,
+    0xFFFFFFFFFFFFFFFF,
+    0xFFFFFFFFFFFFFFFF,
+    0x18A100,
+    0x1045802,
+    0x10B881,
+    0x7,
+    0x88893,
+    0x18A100,
+    0x82901,
+    0xE0810,
+    0x10B881,
+    0x480A,
+    0x186002,
+    0x1088010,
+    0x10B881,
+    0x3,
+    0x480A,
+    0x186002,
+    0x1088010,
+    0x10B881,
+    0x2,
+    0x480A,
+    0x186002,
+    0x1088010,
+    0x10B881,
+    0x186002,
+    0x804,
+    0x10B881,
+    0x186002,
+    0x4804,
+    0x10B881,
+    0x186002,
+    0x20030,
+    0x10B881,
+    0x100,
+    0xA7121,
+    0x10B881,
+    0x186002,
+    0x108,
+    0x1082118,
+    0x10B881,
+    0x20914,
+    0x2091C,
+    0x1000,
+    0x10B881,
+    0x186002,
+    0x402010,
+    0x10B881,
+    0x186002,
+    0x2040,
+    0x10B881,
+    0x480A,
+    0x186002,
+    0x4000,
+    0x1088010,
+    0x10B881,
+    0x186002,
+    0x4400,
+    0x1004401,
+    0x10B881,
+    0x186002,
+    0x8000,
+    0x2A541,
+    0x10B881,
+    0x186002,
+    0x8890,
+    0x44000,
+    0x10B881,
+    0x186002,
+    0x21401,
+    0x108000,
+    0x20000108000,
+    0x10B881,
+    0x186002,
+    0x360010,
+    0x240000,
+    0x10B881,
+    0x186002,
+    0x20090,
+    0x4A211,
+    0x82401,
+    0x10B881,
+    0x186002,
+    0x200D5,
+    0x4A211,
+    0x82401,
+    0x260114,
+    0x10B881,
+    0x187001,
+    0x186002,
+    0x2C1D9,
+    0x4A211,
+    0x1087880,
+    0x10B881,
+    0x186002,
+    0x200D5,
+    0x20030,
+    0x2C1D9,
+    0x4A211,
+    0x86000,
+    0x10B881,
+    0x186002,
+    0x2C1D9,
+    0x4A211,
+    0x260018,
+    0x10B881,
+    0x22143,
+    0x186002,
+    0x2C1D9,
+    0x4A211,
+    0x10B881,
+    0x186002,
+    0x1C610C,
+    0x2C1D9,
+    0x4A211,
+    0x10B881,
+    0x186002,
+    0x200D5,
+    0x20030,
+    0x2C1D9,
+    0x4A211,
+    0x10B881,
+    0x186002,
+    0x2C1D9,
+    0x4A211,
+    0xAC19A,
+    0x10B881,
+    0x88817,
+    0x186002,
+    0x2C1D9,
+    0x4A211,
+    0x10B881,
+    0x8E905,
+    0x186002,
+    0x2C1D9,
+    0x4A211,
+    0x10B881,
+    0x186002,
+    0x20059,
+    0x2C1D9,
+    0x4A211,
+    0x4A141,
+    0x10B881,
+    0x186002,
+    0x2C1D9,
+    0x4A211,
+    0x1202005,
+    0x10B881,
+    0x186002,
+    0x1E6945,
+    0x2C1D9,
+    0x4A211,
+    0x10B881,
+    0x186002,
+    0x2C1D9,
+    0x4A211,
+    0xE0014,
+    0x10B881,
+    0x142112,
+    0x186002,
+    0x2C1D9,
+    0x4A211,
+    0xE010,
+    0x10B881,
+    0x186002,
+    0x2C1D9,
+    0x4A211,
+    0x6000,
+    0x1202005,
+    0x10B881,
+    0x20914,
+    0xA5154,
+    0x20018,
+    0x20914,
+    0x26051,
+    0xA5154,
+    0x20914,
+    0x1404810,
+    0xA5154,
+    0x20914,
+    0x22050,
+    0xA5154,
+    0x100812,
+    0x20914,
+    0xA5154,
+    0x20914,
+    0x128810,
+    0xA5154,
+    0x426002,
+    0x20914,
+    0xA5154,
+    0xC07,
+    0x20914,
+    0xA5154,
+    0x20914,
+    0xA5154,
+    0x480190,
+    0x2000D,
+    0x108A811,
+    0x20018,
+    0x170011,
+    0xA5154,
+    0x26051,
+    0x170011,
+    0xA5154,
+    0x2000D,
+    0x108A811,
+    0x170011,
+    0x1404810,
+    0xA5154,
+    0x22050,
+    0x170011,
+    0xA5154,
+    0x100812,
+    0x170011,
+    0xA5154,
+    0x128810,
+    0x170011,
+    0xA5154,
+    0x426002,
+    0x170011,
+    0xA5154,
+    0xC07,
+    0xA5154,
+    0x20851,
+    0x170011,
+    0xA5154,
+    0x20851,
+    0x170011,
+    0x480190,
+    0xC07,
+    0xA5154,
+    0x101118,
+    0x170011,
+    0xA5154,
+    0x101118,
+    0x170011,
+    0x480190,
+    0xC07,
+    0xA5154,
+    0x20000000141919,
+    0x170011,
+    0x101118,
+    0x41801,
+    0xA5154,
+    0x20000000141919,
+    0x170011,
+    0x480190,
+    0x101118,
+    0x41801,
+    0xC07,
+    0xA5154,
+    0x41801,
+    0x170011,
+    0xA5154,
+    0x41801,
+    0x170011,
+    0x480190,
+    0x7109,
+    0xA5154,
+    0x20851,
+    0x26051,
+    0x100812,
+    0x7109,
+    0xA5154,
+    0x20851,
+    0x7109,
+    0xA5154,
+    0x26051,
+    0x41801,
+    0x100812,
+    0x7109,
+    0xA5154,
+    0x41801,
+    0xA5154,
+    0x8E118,
+    0x20018,
+    0xA2951,
+    0x108000,
+    0x406008,
+    0xA5154,
+    0x8E118,
+    0x20018,
+    0xA2951,
+    0x5104,
+    0x7109,
+    0x84008,
+    0xA5154,
+    0x186002,
+    0xA5154,
+    0x24109,
+    0x186002,
+    0xA5154,
+    0x186918,
+    0x170011,
+    0x480190,
+    0xC07,
+    0x186002,
+    0xA5154,
+    0x170011,
+    0x2049C,
+    0x13009C,
+    0x421A0,
+    0x861,
+    0x40861,
+    0x1051,
+    0x20015,
+    0x22145,
+    0xEC000,
+    0x402100,
+    0x1E6104,
+    0x861,
+    0x4860,
+    0xCC000,
+    0x1A2941,
+    0xA6917,
+    0x64004,
+    0x6401C,
+    0x40861,
+    0x4A211,
+    0x861,
+    0xC07,
+    0x861,
+    0x602141,
+    0x861,
+    0x602141,
+    0x480190,
+    0x940913,
+    0x861,
+    0x1000041,
+    0x132058,
+    0x80842,
+    0x90842,
+    0x42913,
+    0x80842,
+    0x90842,
+    0x90943,
+    0x28118,
+    0x130010,
+    0x426103,
+    0xE2001,
+    0xE2059,
+    0x100812,
+    0x861,
+    0x809C0,
+    0xA500,
+    0xE2059,
+    0x480190,
+    0x861,
+    0x1004A00,
+    0xA8111,
+    0x12A818,
+    0x24050,
+    0x1E0011,
+    0x861,
+    0x46115,
+    0x11A6004,
+    0x42909,
+    0x861,
+    0x26009,
+    0x11A6004,
+    0x861,
+    0x20003,
+    0x11A6004,
+    0xE1111,
+    0x182118,
+    0x861,
+    0xC21E1,
+    0x11A6004,
+    0x861,
+    0x182141,
+    0x12000B,
+    0x11A6004,
+    0x861,
+    0x102941,
+    0x11A6004,
+    0x861,
+    0x2903,
+    0x11A6004,
+    0x861,
+    0x23111,
+    0x11A6004,
+    0x861,
+    0x6841,
+    0x11A6004,
+    0x861,
+    0xA2105,
+    0x11A6004,
+    0x861,
+    0xA2151,
+    0x11A6004,
+    0x861,
+    0x23115,
+    0x11A6004,
+    0x45001,
+    0x861,
+    0x1E0101,
+    0x11A6004,
+    0x861,
+    0x1E0901,
+    0x11A6004,
+    0x861,
+    0x120003,
+    0x11A6004,
+    0x861,
+    0x11A6004,
+    0x42909,
+    0xFFFFFFFFFFFFFFFF,
+    0x861,
+    0x2022313,
+    0x11A6004,
+    0x861,
+    0x46103,
+    0x11A6004,
+    0x22261D1,
+    0x861,
+    0x6400B,
+    0x11A6004,
+    0x861,
+    0x428DB,
+    0x11A6004,
+    0x861,
+    0x101952,
+    0x11A6004,
+    0x861,
+    0x122503,
+    0x11A6004,
+    0x44021,
+    0x861,
+    0x120943,
+    0x11A6004,
+    0x861,
+    0x22183,
+    0x11A6004,
+    0x861,
+    0x12210A,
+    0x11A6004,
+    0x861,
+    0x2112,
+    0x11A6004,
+    0x861,
+    0xFFFFFFFFFFFFFFFF,
+    0x11A6004,
+    0xC0000,
+    0x861,
+    0x12101B,
+    0x11A6004,
+    0x861,
+    0x122112,
+    0x11A6004,
+    0x861,
+    0x204903,
+    0x11A6004,
+    0x861,
+    0x22117,
+    0x11A6004,
+    0xE2899,
+    0x861,
+    0x2020903,
+    0x11A6004,
+    0x861,
+    0x41083,
+    0x11A6004,
+    0x861,
+    0x182083,
+    0x11A6004,
+    0x861,
+    0x384012,
+    0x11A6004,
+    0x42909,
+    0x861,
+    0x4C6003,
+    0x11A6004,
+    0x861,
+    0x160813,
+    0x11A6004,
+    0x861,
+    0x2000912,
+    0x11A6004,
+    0x861,
+    0x200D,
+    0x11A6004,
+    0x861,
+    0x44004,
+    0x11A6004,
+    0x42909,
+    0x2D50,
+    0x861,
+    0x6044,
+    0x11A6004,
+    0x42581,
+    0x861,
+    0x22125,
+    0xA2815,
+    0x11A6004,
+    0x128916,
+    0x861,
+    0x2220913,
+    0x6044,
+    0x11A6004,
+    0x861,
+    0x11A6004,
+    0x24E2919,
+    0x861,
+    0x11A6004,
+    0xFFFFFFFFFFFFFFFF,
+    0x224110,
+    0x861,
+    0x4404,
+    0x11A6004,
+    0x42909,
+    0x861,
+    0x994,
+    0x11A6004,
+    0x861,
+    0x27015,
+    0x11A6004,
+    0x861,
+    0x2185,
+    0x11A6004,
+    0x861,
+    0x5907,
+    0x11A6004,
+    0x861,
+    0xAE914,
+    0x11A6004,
+    0x42909,
+    0x861,
+    0x11A6004,
+    0x60401,
+    0x861,
+    0xC4005,
+    0x11A6004,
+    0x20105,
+    0x861,
+    0x11A6004,
+    0x100007,
+    0x861,
+    0x8015,
+    0x11A6004,
+    0x220018,
+    0x861,
+    0x11A6004,
+    0xFFFFFFFFFFFFFFFF,
+    0x861,
+    0xE1185,
+    0x11A6004,
+    0x42909,
+    0x861,
+    0x11A6004,
+    0x1168004,
+    0x861,
+    0x11A6004,
+    0x2000195,
+    0x861,
+    0x11A6004,
+    0x1023051,
+    0x861,
+    0x11A6004,
+    0x4158,
+    0x20145,
+    0x861,
+    0x11A6004,
+    0x18430A,
+    0x861,
+    0x11A6004,
+    0x23419,
+    0x861,
+    0x11A6004,
+    0x710D,
+    0x861,
+    0x11A6004,
+    0x710D,
+    0x128916,
+    0x861,
+    0x20951,
+    0x11A6004,
+    0x861,
+    0x180015,
+    0x11A6004,
+    0x1911,
+    0x861,
+    0x11A6004,
+    0x12401D,
+    0x861,
+    0x11A6004,
+    0xC6111,
+    0x861,
+    0x11A6004,
+    0x1088050,
+    0x861,
+    0x11A6004,
+    0x60081,
+    0x4E2010,
+    0x861,
+    0x11A6004,
+    0xA0111,
+    0x861,
+    0x11A6004,
+    0x4A101,
+    0x861,
+    0x11A6004,
+    0x8C191,
+    0x861,
+    0x11A6004,
+    0x12E011,
+    0x106100,
+    0x861,
+    0x11A6004,
+    0x2929,
+    0x861,
+    0x11A6004,
+    0x320,
+    0x861,
+    0x11A6004,
+    0x2C29,
+    0x42909,
+    0x861,
+    0x11A6004,
+    0x67115,
+    0x861,
+    0x11A6004,
+    0x24031,
+    0x42909,
+    0x861,
+    0x11A6004,
+    0x22035,
+    0x861,
+    0x11A6004,
+    0x6043,
+    0x861,
+    0x11A6004,
+    0x7548,
+    0x182118,
+    0x861,
+    0x11A6004,
+    0x22059,
+    0x861,
+    0x11A6004,
+    0x24151,
+    0x861,
+    0x11A6004,
+    0x220B4,
+    0x102141,
+    0x861,
+    0x11A6004,
+    0x1162050,
+    0x861,
+    0x11A6004,
+    0x20C1,
+    0x861,
+    0x11A6004,
+    0xA0943,
+    0x861,
+    0x11A6004,
+    0x22859,
+    0x861,
+    0x11A6004,
+    0x1143,
+    0x861,
+    0x11A6004,
+    0x102151,
+    0x861,
+    0x11A6004,
+    0x10C859,
+    0x861,
+    0x11A6004,
+    0x1B4911,
+    0x102151,
+    0x861,
+    0x11A6004,
+    0x20054,
+    0x861,
+    0x11A6004,
+    0x24151,
+    0x42909,
+    0x44218D,
+    0x1C4080,
+    0x861,
+    0x11A6004,
+    0x181851,
+    0x861,
+    0x11A6004,
+    0x101041,
+    0x861,
+    0x140103,
+    0x11A6004,
+    0x102151,
+    0x861,
+    0x11A6004,
+    0x1102041,
+    0x861,
+    0x2185,
+    0x11A6004,
+    0x60C0,
+    0x6440,
+    0x60001,
+    0x861,
+    0x11A6004,
+    0x20099,
+    0x42909,
+    0x780D,
+    0x861,
+    0x11A6004,
+    0x166089,
+    0x861,
+    0x11A6004,
+    0xA4105,
+    0x861,
+    0x11A6004,
+    0x80181,
+    0x861,
+    0x11A6004,
+    0x11220C1,
+    0x861,
+    0x1022005,
+    0x11A6004,
+    0x42909,
+    0x861,
+    0x11A6004,
+    0x46119,
+    0x861,
+    0x11A6004,
+    0x22919,
+    0x861,
+    0x11A6004,
+    0x60911,
+    0x861,
+    0x11A6004,
+    0x40910,
+    0x3001,
+    0x861,
+    0x11A6004,
+    0x2109,
+    0x861,
+    0xE0182,
+    0x11A6004,
+    0x2109,
+    0x6015,
+    0x10A4110,
+    0x861,
+    0x11A6004,
+    0x30101,
+    0x861,
+    0x11A6004,
+    0x22101,
+    0x861,
+    0x11A6004,
+    0x291D,
+    0x861,
+    0x11A6004,
+    0x1080901,
+    0x861,
+    0x11A6004,
+    0x1060210,
+    0x861,
+    0x11A6004,
+    0x1305,
+    0x861,
+    0x11A6004,
+    0x26209,
+    0x861,
+    0x11A6004,
+    0xA201,
+    0x861,
+    0x11A6004,
+    0x1002411,
+    0x861,
+    0x11A6004,
+    0x30E2441,
+    0x861,
+    0x510F,
+    0x11A6004,
+    0x861,
+    0x11A6004,
+    0xA0503,
+    0x861,
+    0x65004,
+    0x11A6004,
+    0x861,
+    0x11A6004,
+    0xC0500,
+    0x242110,
+    0xC0000,
+    0x861,
+    0x11A6004,
+    0x24411,
+    0xA6080,
+    0x861,
+    0x11A6004,
+    0x24411,
+    0x1C4080,
+    0x861,
+    0x11A6004,
+    0x580501,
+    0x861,
+    0x1003005,
+    0x11A6004,
+    0x42909,
+    0x861,
+    0x11A6004,
+    0x20C2481,
+    0x861,
+    0x11A6004,
+    0x44801,
+    0x861,
+    0x11A6004,
+    0x6813,
+    0x861,
+    0x11A6004,
+    0x100905,
+    0xC0000,
+    0x861,
+    0x11A6004,
+    0xC2994,
+    0x861,
+    0x11A6004,
+    0x2C01,
+    0x60100,
+    0x861,
+    0x11A6004,
+    0x20913,
+    0x861,
+    0x11A6004,
+    0xC4890,
+    0x861,
+    0x11A6004,
+    0x182981,
+    0x861,
+    0x11A6004,
+    0x925852,
+    0x861,
+    0x11A6004,
+    0x280901,
+    0x861,
+    0x11A6004,
+    0x1000903,
+    0x861,
+    0x11A6004,
+    0x25004,
+    0x861,
+    0x11A6004,
+    0x7005,
+    0x861,
+    0x11A6004,
+    0x205809,
+    0x861,
+    0x11A6004,
+    0xA7050,
+    0x861,
+    0x11A6004,
+    0xA3101,
+    0xC0000,
+    0x861,
+    0x11A6004,
+    0x6104D,
+    0x861,
+    0x11A6004,
+    0x42909,
+    0x61881,
+    0x861,
+    0x11A6004,
+    0x711D,
+    0xA6080,
+    0x861,
+    0x11A6004,
+    0x1901,
+    0x861,
+    0x121003,
+    0x11A6004,
+    0x1023001,
+    0x861,
+    0x11A6004,
+    0x7941,
+    0x861,
+    0x2185,
+    0x11A6004,
+    0x5005,
+    0x60001,
+    0x861,
+    0x11A6004,
+    0x42909,
+    0x23101,
+    0xA6090,
+    0x861,
+    0x11A6004,
+    0x1B3111,
+    0x861,
+    0x11A6004,
+    0x1A3101,
+    0x861,
+    0x11A6004,
+    0xE7011,
+    0x861,
+    0x11A6004,
+    0x81801,
+    0x861,
+    0x11A6004,
+    0x1E1101,
+    0x861,
+    0x11A6004,
+    0x241919,
+    0x861,
+    0x11A6004,
+    0x401901,
+    0x861,
+    0x11A6004,
+    0x805114,
+    0x861,
+    0x11A6004,
+    0x1041901,
+    0x861,
+    0x11A6004,
+    0x2115113,
+    0x861,
+    0x11A6004,
+    0x3103,
+    0x861,
+    0x691D,
+    0x11A6004,
+    0x402010,
+    0x861,
+    0x11A6004,
+    0x22150,
+    0x861,
+    0x11A6004,
+    0x42909,
+    0x26C20,
+    0x861,
+    0x11A6004,
+    0x22151,
+    0x861,
+    0x11A6004,
+    0x122145,
+    0x861,
+    0x11A6004,
+    0xE2899,
+    0x861,
+    0x11A6004,
+    0x1426001,
+    0x861,
+    0x11A6004,
+    0xA811,
+    0x861,
+    0x11A6004,
+    0x122001,
+    0x861,
+    0x11A6004,
+    0x102110,
+    0x861,
+    0x11A6004,
+    0x402010,
+    0x2002819,
+    0x861,
+    0x11A6004,
+    0x7001,
+    0x861,
+    0x11A6004,
+    0xB001,
+    0x861,
+    0x11A6004,
+    0x128010,
+    0x861,
+    0x11A6004,
+    0x220B4,
+    0x104E911,
+    0x861,
+    0x11A6004,
+    0x102151,
+    0x402010,
+    0x108001,
+    0x861,
+    0x11A6004,
+    0x4A990,
+    0x861,
+    0x11A6004,
+    0xCA501,
+    0x861,
+    0x11A6004,
+    0xE809,
+    0x861,
+    0x11A6004,
+    0x117910,
+    0x28110,
+    0xC0000,
+    0x861,
+    0x11A6004,
+    0x42909,
+    0xAA105,
+    0x861,
+    0x11A6004,
+    0x1AC010,
+    0x24104,
+    0x861,
+    0x11A6004,
+    0xCA911,
+    0xE4110,
+    0x861,
+    0x11A6004,
+    0x1AC841,
+    0x861,
+    0x11A6004,
+    0x108801,
+    0x861,
+    0x11A6004,
+    0x1128041,
+    0x861,
+    0x11A6004,
+    0xB0001,
+    0x861,
+    0x11A6004,
+    0xFFFFFFFFFFFFFFFF,
+    0x861,
+    0x11A6004,
+    0x27101,
+    0x861,
+    0x11A6004,
+    0x60113,
+    0x861,
+    0x11A6004,
+    0x160101,
+    0x861,
+    0x11A6004,
+    0x422009,
+    0x861,
+    0x20103,
+    0x11A6004,
+    0x140109,
+    0x861,
+    0x11A6004,
+    0x42909,
+    0x47800,
+    0x861,
+    0x11A6004,
+    0x1040894,
+    0x861,
+    0x11A6004,
+    0x142009,
+    0x861,
+    0x11A6004,
+    0x442018,
+    0x861,
+    0x11A6004,
+    0x6E151,
+    0x861,
+    0x11A6004,
+    0x2891,
+    0xC0000,
+    0x861,
+    0x11A6004,
+    0x246911,
+    0x861,
+    0x11A6004,
+    0x2201,
+    0x1003011,
+    0x26080B,
+    0x861,
+    0x11A6004,
+    0x244D01,
+    0x861,
+    0x11A6004,
+    0x6810,
+    0x60111,
+    0x861,
+    0x11A6004,
+    0x27101,
+    0x42001,
+    0x861,
+    0x11A6004,
+    0x42851,
+    0x861,
+    0x11A6004,
+    0x45901,
+    0x861,
+    0x11A6004,
+    0x163111,
+    0x861,
+    0x11A6004,
+    0x1C4080,
+    0x142009,
+    0x861,
+    0x11A6004,
+    0xFFFFFFFFFFFFFFFF,
+    0xFFFFFFFFFFFFFFFF,
+    0xFFFFFFFFFFFFFFFF,
+    0x861,
+    0x11A6004,
+    0x810,
+    0x264809,
+    0x861,
+    0x11A6004,
+    0xA3011,
+    0xC2100,
+    0x861,
+    0x11A6004,
+    0x1060101,
+    0x861,
+    0x11A6004,
+    0x4C2111,
+    0x861,
+    0x11A6004,
+    0x102085,
+    0x9,
+    0xE2101,
+    0x861,
+    0x44105,
+    0x11A6004,
+    0x42909,
+    0x1E0400,
+    0x861,
+    0x8D,
+    0x11A6004,
+    0x861,
+    0x11A6004,
+    0x220B4,
+    0x1E6090,
+    0xE4110,
+    0x861,
+    0x11A6004,
+    0x84040,
+    0x861,
+    0x11A6004,
+    0x82989,
+    0x861,
+    0x11A6004,
+    0xC2701,
+    0x861,
+    0x11A6004,
+    0x184C11,
+    0x861,
+    0x11A6004,
+    0xC0810,
+    0xA5100,
+    0x861,
+    0x11A6004,
+    0x1E3511,
+    0x861,
+    0x11A6004,
+    0x1C2101,
+    0x861,
+    0x11A6004,
+    0x86041,
+    0x861,
+    0x11A6004,
+    0xFFFFFFFFFFFFFFFF,
+    0x861,
+    0x11A6004,
+    0x84043,
+    0xA2109,
+    0x861,
+    0x11A6004,
+    0x380801,
+    0x861,
+    0x11A6004,
+    0x482101,
+    0x861,
+    0x11A6004,
+    0x2082101,
+    0x861,
+    0x11A6004,
+    0x122511,
+    0x861,
+    0x11A6004,
+    0x102049,
+    0x861,
+    0x11A6004,
+    0x42909,
+    0x1186940,
+    0x861,
+    0x11A6004,
+    0xC6101,
+    0x182118,
+    0x861,
+    0x11A6004,
+    0xC0011,
+    0x182118,
+    0x861,
+    0x11A6004,
+    0x1120041,
+    0x861,
+    0x11A6004,
+    0x21C2513,
+    0x861,
+    0x1080104,
+    0x11A6004,
+    0x282105,
+    0x861,
+    0x11A6004,
+    0x62159,
+    0xC0000,
+    0x282114,
+    0x861,
+    0x11A6004,
+    0x2302811,
+    0x861,
+    0xE0182,
+    0x11A6004,
+    0x42909,
+    0x222140,
+    0x861,
+    0x11A6004,
+    0x42909,
+    0x222140,
+    0x861,
+    0x11A6004,
+    0x283111,
+    0x861,
+    0x11A6004,
+    0x382001,
+    0x861,
+    0x11A6004,
+    0x182021,
+    0x440901,
+    0x861,
+    0x11A6004,
+    0x45001,
+    0x861,
+    0x11A6004,
+    0x244400,
+    0x861,
+    0x11A6004,
+    0x1003010,
+    0x861,
+    0x11A6004,
+    0x1085011,
+    0x861,
+    0x20125,
+    0x11A6004,
+    0x1C4080,
+    0x861,
+    0x11A6004,
+    0x2001103,
+    0x861,
+    0x11A6004,
+    0x2401113,
+    0x861,
+    0x2859,
+    0x34610A,
+    0x861,
+    0xC680D,
+    0x34610A,
+    0x861,
+    0x34610A,
+    0x440811,
+    0x9,
+    0x148800,
+    0x42140,
+    0x40810,
+    0x200000000C2891,
+    0xE010,
+    0x80041,
+    0x82081,
+    0x42140,
+    0x110811,
+    0x150811,
+    0x42140,
+    0x44814,
+    0xA0051,
+    0x200000000A20D1,
+    0x80041,
+    0x82081,
+    0x42140,
+    0x20003,
+    0x2910,
+    0x8510,
+    0x8110,
+    0x600B0,
+    0xC0504,
+    0xE4410,
+    0x220003,
+    0x2A0915,
+    0x80918,
+    0x801,
+    0x1002001,
+    0x24020,
+    0x202150,
+    0x362911,
+    0x1B2131,
+    0x8F814,
+    0xA2939,
+    0xA8901,
+    0x8C0110,
+    0xA0090,
+    0x8C2911,
+    0x1B2131,
+    0x44018,
+    0x8C0110,
+    0x86000,
+    0xA0090,
+    0x1089010,
+    0xC1195,
+    0xAC011,
+    0xC0010,
+    0x102800,
+    0xA3114,
+    0xA2951,
+    0x2213C,
+    0x424029,
+    0x8815,
+    0xAC011,
+    0xC0010,
+    0x10E1114,
+    0x10A4090,
+    0x2803,
+    0xA2951,
+    0x42040F,
+    0x818,
+    0x2213C,
+    0xA2159,
+    0xC6105,
+    0x83810,
+    0x69192,
+    0x4020,
+    0xC0010,
+    0x2001,
+    0x83810,
+    0x86000,
+    0x83810,
+    0x41801,
+    0x40001,
+    0xC6105,
+    0x83810,
+    0x21012,
+    0x140084,
+    0x80081,
+    0x86105,
+    0x44018,
+    0x21012,
+    0x86000,
+    0xC6105,
+    0x21012,
+    0x41801,
+    0x2018,
+    0x45881,
+    0x2C020,
+    0x40000000010018,
+    0x10018,
+    0xC7012,
+    0x4944,
+    0x20000001022001,
+    0x1AC00C,
+    0x1020001,
+    0x42140,
+    0x1020001,
+    0x1AC00C,
+    0x42140,
+    0xC1195,
+    0x20000001022001,
+    0x1C7101,
+    0x1020001,
+    0x42140,
+    0x143100,
+    0x42140,
+    0x1E0007,
+    0x2000000016F900,
+    0x2000000014B900,
+    0x143100,
+    0x148800,
+    0x42140,
+    0x84008,
+    0x148800,
+    0x246108,
+    0x40881,
+    0xE4410,
+    0x320950,
+    0x143100,
+    0xC0010,
+    0xE0511,
+    0xAC011,
+    0xE0001,
+    0xCF104,
+    0xAC011,
+    0x22140,
+    0x8801,
+    0xCD114,
+    0x186124,
+    0x84200,
+    0x180812,
+    0xAC011,
+    0x2090D,
+    0x820109,
+    0xA4000,
+    0x170011,
+    0x160008,
+    0x42140,
+    0x100016,
+    0xA4000,
+    0x1A40A0,
+    0xA4000,
+    0xAE901,
+    0x10AE901,
+    0x1082120,
+    0x42140,
+    0x2851,
+    0xC1195,
+    0xA01C0,
+    0x40094,
+    0x86101,
+    0x180015,
+    0x2851,
+    0x2851,
+    0x161019,
+    0x2851,
+    0x20005,
+    0x68995,
+    0x240118,
+    0x264108,
+    0x8801,
+    0xC0910,
+    0x140084,
+    0x80081,
+    0x200118,
+    0x44018,
+    0x86000,
+    0x28811,
+    0x86000,
+    0x28811,
+    0x5,
+    0x2009,
+    0x190011,
+    0x4945,
+    0x400058,
+    0x186304,
+    0x1C630C,
+    0x4945,
+    0x200010,
+    0xE6114,
+    0xC0010,
+    0x8005,
+    0x80081,
+    0x86914,
+    0xC0010,
+    0x106100,
+    0x108004,
+    0x140805,
+    0xA2951,
+    0x140805,
+    0x10481A,
+    0xA2951,
+    0xA2951,
+    0xA8910,
+    0x1A6004,
+    0xA2951,
+    0xA2951,
+    0x160035,
+    0xA2951,
+    0x305810,
+    0x444D14,
+    0xA2951,
+    0x444D14,
+    0x1A6004,
+    0xA2951,
+    0x4C6D15,
+    0x1A6004,
+    0xA2951,
+    0x4944,
+    0xA40B0,
+    0x140017,
+    0x4944,
+    0xA4101,
+    0xAE100,
+    0x10AE901,
+    0x84008,
+    0x143100,
+    0x1E2141,
+    0x1E6107,
+    0x840014,
+    0xA5154,
+    0xAE100,
+    0x85194,
+    0xAC011,
+    0x80918,
+    0x8801,
+    0x482012,
+    0x1000814,
+    0x2213C,
+    0x86000,
+    0xAE901,
+    0x61901,
+    0x260111,
+    0x260018,
+    0x80918,
+    0x3000801,
+    0x2A2118,
+    0x3000801,
+    0x40000,
+    0xC5000,
+    0x2CC110,
+    0xA2951,
+    0x1A2014,
+    0x42110,
+    0x600011,
+    0x1AC00C,
+    0x4A0091,
+    0x86000,
+    0x80918,
+    0x143100,
+    0x80918,
+    0x10CD011,
+    0x10CD905,
+    0x110811,
+    0xC1195,
+    0x10CD905,
+    0x110811,
+    0x86000,
+    0x18AD911,
+    0x126054,
+    0x110811,
+    0x1190911,
+    0x6D180,
+    0xC1195,
+    0x1180805,
+    0x18AD911,
+    0x180002,
+    0x110811,
+    0x86000,
+    0x1180805,
+    0x18AD911,
+    0x110811,
+    0xA2190,
+    0x26000,
+    0xC5801,
+    0x8AD111,
+    0x8AF101,
+    0x110811,
+    0x10CD105,
+    0xC5801,
+    0x110811,
+    0x86000,
+    0xC5801,
+    0x110811,
+    0x80918,
+    0xA8910,
+    0x801,
+    0x110811,
+    0x1190911,
+    0xC1195,
+    0x392911,
+    0x392911,
+    0x10A5955,
+    0x482012,
+    0x2213C,
+    0x6C095,
+    0x81900,
+    0x110811,
+    0x10A5955,
+    0x18AD911,
+    0x110811,
+    0x1151,
+    0x80090,
+    0x150811,
+    0x1022811,
+    0x18AD911,
+    0x110811,
+    0x1151,
+    0x6804,
+    0x150811,
+    0x6804,
+    0x150811,
+    0x110811,
+    0x1190911,
+    0x2100,
+    0xC1195,
+    0x22140,
+    0x18AD911,
+    0x110811,
+    0x22140,
+    0x6E01C,
+    0x6E01C,
+    0xC1111,
+    0x132951,
+    0x150811,
+    0xE0001,
+    0x86138,
+    0x80819,
+    0x110811,
+    0x132951,
+    0x86138,
+    0x110811,
+    0x161019,
+    0x110811,
+    0x1D6118,
+    0x110811,
+    0x1192911,
+    0x196111,
+    0x86000,
+    0x880015,
+    0x8291D,
+    0x84000,
+    0xA8910,
+    0x8291D,
+    0x86000,
+    0x1190911,
+    0x392911,
+    0xC1195,
+    0x10E0904,
+    0x110811,
+    0x150811,
+    0x1192911,
+    0x200000000C2891,
+    0x24000,
+    0x40810,
+    0x82081,
+    0x110811,
+    0x150811,
+    0x200000000A20D1,
+    0x1192911,
+    0x24000,
+    0xA0051,
+    0x82081,
+    0x110811,
+    0x1192911,
+    0x200000000C2891,
+    0xC1195,
+    0x224010,
+    0x40810,
+    0x82081,
+    0x110811,
+    0x200000000A20D1,
+    0x1192911,
+    0xC1195,
+    0x224010,
+    0xA0051,
+    0x82081,
+    0x180002,
+    0x110811,
+    0x40810,
+    0x86000,
+    0x82081,
+    0x180002,
+    0x110811,
+    0xA0051,
+    0x86000,
+    0x82081,
+    0x1192911,
+    0x200000000C2891,
+    0xC1195,
+    0x101084,
+    0x40810,
+    0x82081,
+    0x200000000A20D1,
+    0x1192911,
+    0xC1195,
+    0x101084,
+    0xA0051,
+    0x82081,
+    0x482012,
+    0x8A921,
+    0x192105,
+    0x392911,
+    0x86000,
+    0x1192911,
+    0x200000000C2891,
+    0xC1195,
+    0x86000,
+    0x40810,
+    0x82081,
+    0x200000000A20D1,
+    0x1192911,
+    0xC1195,
+    0x86000,
+    0xA0051,
+    0x82081,
+    0x110811,
+    0x40810,
+    0xA2190,
+    0x26000,
+    0x82081,
+    0x110811,
+    0xA0051,
+    0xA2190,
+    0x26000,
+    0x82081,
+    0x392911,
+    0x40810,
+    0x82081,
+    0x392911,
+    0x200000000A20D1,
+    0x1192911,
+    0xC1195,
+    0xA0051,
+    0x82081,
+    0x392911,
+    0x40810,
+    0xA2190,
+    0x26000,
+    0x82081,
+    0x392911,
+    0xA0051,
+    0xA2190,
+    0x26000,
+    0x82081,
+    0xA0051,
+    0x40810,
+    0x82081,
+    0xA0051,
+    0x40810,
+    0x82081,
+    0xA0051,
+    0x40810,
+    0xA2190,
+    0x26000,
+    0x82081,
+    0xA0051,
+    0x40810,
+    0xA2190,
+    0x26000,
+    0x82081,
+    0xC1195,
+    0xAC011,
+    0x6801C,
+    0xC0010,
+    0x424810,
+    0x22401,
+    0x82081,
+    0xC1195,
+    0xAC011,
+    0xC0010,
+    0x14001C,
+    0x201D0,
+    0x22401,
+    0x82081,
+    0x110811,
+    0x6801C,
+    0x110811,
+    0x14001C,
+    0x392911,
+    0x6801C,
+    0x392911,
+    0x14001C,
+    0x44018,
+    0x86000,
+    0x2801C,
+    0x44018,
+    0xC1195,
+    0x86000,
+    0xAC011,
+    0xC0010,
+    0x14001C,
+    0x4020,
+    0xC0010,
+    0x1C0012,
+    0x10291C,
+    0xC1195,
+    0xAC011,
+    0xC0010,
+    0x1E8010,
+    0x14291C,
+    0x86000,
+    0x1C0012,
+    0x86000,
+    0x1E8010,
+    0x110811,
+    0x1C0012,
+    0x110811,
+    0x1190911,
+    0xC1195,
+    0x1E8010,
+    0x110811,
+    0xA2190,
+    0x26000,
+    0x1C0012,
+    0x110811,
+    0xA2190,
+    0x26000,
+    0x1E8010,
+    0x110811,
+    0x86000,
+    0x1C0012,
+    0x110811,
+    0x86000,
+    0x1E8010,
+    0x1C1910,
+    0x18F905,
+    0x1C1910,
+    0x86109,
+    0x43,
+    0x1C1910,
+    0x86101,
+    0x106100,
+    0x1151,
+    0x170011,
+    0x26941,
+    0x170011,
+    0x110811,
+    0x1151,
+    0x170011,
+    0x110811,
+    0x26941,
+    0x170011,
+    0x8005,
+    0x170011,
+    0x108004,
+    0x170011,
+    0x2091C,
+    0x148800,
+    0xA011C,
+    0x86100,
+    0x8051,
+    0x8E140,
+    0x141000,
+    0x2A4014,
+    0x2091C,
+    0x2213C,
+    0x66110,
+    0x143100,
+    0x10E1114,
+    0x2091C,
+    0x1AC00C,
+    0xE6010,
+    0xC1110,
+    0x86100,
+    0x8051,
+    0x8E140,
+    0x2A4014,
+    0x2091C,
+    0x246108,
+    0x20000000246D18,
+    0xC1195,
+    0x40881,
+    0x2091C,
+    0x84008,
+    0xAC011,
+    0x826000,
+    0xA011C,
+    0x184000,
+    0x8051,
+    0x8E140,
+    0x1AC00C,
+    0x2A4014,
+    0x2091C,
+    0xAC011,
+    0x22140,
+    0xE0511,
+    0x2091C,
+    0xAC011,
+    0x2091C,
+    0x47004,
+    0x2A0115,
+    0x150811,
+    0x42914,
+    0x2E6119,
+    0x1045802,
+    0x140018,
+    0x2091C,
+    0x40089,
+    0x20000000086D19,
+    0xC1195,
+    0x148800,
+    0x170019,
+    0xC1195,
+    0x143100,
+    0x170019,
+    0x200000001E6D17,
+    0x170019,
+    0xC1110,
+    0x84008,
+    0xAC011,
+    0x170019,
+    0x49910,
+    0x26C010,
+    0x12091E,
+    0xA01C0,
+    0x80405,
+    0x1E2910,
+    0x1040918,
+    0x44018,
+    0x80830,
+    0x6000,
+    0x86000,
+    0x260010,
+    0x80405,
+    0xA5090,
+    0x1E2910,
+    0x1000918,
+    0x406008,
+    0x80405,
+    0x8C000,
+    0x80010,
+    0x141821,
+    0x80405,
+    0x108000,
+    0x40013,
+    0x85002,
+    0xE6111,
+    0x16001C,
+    0x45818,
+    0x40100,
+    0x1E0810,
+    0xC0131,
+    0xC3011,
+    0x1184841,
+    0x1A0010,
+    0x200909,
+    0x64034,
+    0x20003,
+    0xA01C0,
+    0xA8910,
+    0x1E2910,
+    0x2A0915,
+    0x20003,
+    0x10481A,
+    0xA01C0,
+    0x1E2910,
+    0x2A0915,
+    0x44018,
+    0x86000,
+    0x22C010,
+    0x86000,
+    0x1A0010,
+    0x44018,
+    0x24034,
+    0x86000,
+    0x20003,
+    0x10481A,
+    0x82059,
+    0xA01C0,
+    0x1E2910,
+    0x2A0915,
+    0xC1195,
+    0xAC011,
+    0x6801C,
+    0xA6911,
+    0xC0010,
+    0x122018,
+    0xC1195,
+    0xAC011,
+    0xA6911,
+    0xC0010,
+    0x14001C,
+    0x122018,
+    0x27801,
+    0x16C042,
+    0xC6105,
+    0x27801,
+    0x16C042,
+    0x110811,
+    0x27801,
+    0x16C042,
+    0xC6105,
+    0x110811,
+    0x27801,
+    0x16C042,
+    0x26941,
+    0x1151,
+    0x189901,
+    0x186255,
+    0xA3191,
+    0xC1195,
+    0x8A1101,
+    0x200000000C6B39,
+    0x170011,
+    0xA2915,
+    0x824000,
+    0x2009,
+    0x26000,
+    0x2851,
+    0x20005,
+    0xA01C0,
+    0xC1195,
+    0xA01C0,
+    0x200000000A29D9,
+    0xA2951,
+    0x1020001,
+    0x4945,
+    0x1C630C,
+    0x4944,
+    0x4945,
+    0x20000001022001,
+    0x24000,
+    0x1020001,
+    0xE6114,
+    0xC1195,
+    0x20000001022001,
+    0xAC011,
+    0xC0010,
+    0x1020001,
+    0x62959,
+    0x86101,
+    0xC1195,
+    0x20000001022001,
+    0xAC011,
+    0xC0010,
+    0x106100,
+    0x1020001,
+    0x62959,
+    0x86101,
+    0x7109,
+    0xAC011,
+    0x84008,
+    0xAC011,
+    0xAC011,
+    0xE0001,
+    0x246108,
+    0xC1110,
+    0x1022103,
+    0x484112,
+    0x6300,
+    0x1A2801,
+    0xAC011,
+    0xA4025,
+    0x80830,
+    0x27801,
+    0x1AC00C,
+    0xE111C,
+    0xA4025,
+    0x27801,
+    0x1AC00C,
+    0xA01C0,
+    0xE111C,
+    0x80830,
+    0x1AC00C,
+    0xE111C,
+    0x1AC00C,
+    0xA01C0,
+    0xE111C,
+    0x150811,
+    0x260018,
+    0x80918,
+    0x1120804,
+    0x4945,
+    0x1120804,
+    0x4945,
+    0x10481A,
+    0x1C0012,
+    0x10481A,
+    0x1E8010,
+    0x10481A,
+    0xE6114,
+    0xC1195,
+    0xAC011,
+    0xC0010,
+    0x10481A,
+    0x106100,
+    0xE6114,
+    0xAC5A4,
+    0x2C010,
+    0x110811,
+    0x28811,
+    0x84008,
+    0x40810,
+    0x82081,
+    0x84008,
+    0xA0051,
+    0x82081,
+    0x1192911,
+    0x200000000C2891,
+    0xC1195,
+    0x101084,
+    0x1220010,
+    0x40810,
+    0x82081,
+    0x200000000A20D1,
+    0x1192911,
+    0xC1195,
+    0x101084,
+    0x1220010,
+    0xA0051,
+    0x82081,
+    0x110811,
+    0xA0051,
+    0x40810,
+    0x82081,
+    0x110811,
+    0xA0051,
+    0x40810,
+    0x82081,
+    0x110811,
+    0x40810,
+    0x82081,
+    0x110811,
+    0xA0051,
+    0x82081,
+    0x110811,
+    0x6801C,
+    0x110811,
+    0x14001C,
+    0x44018,
+    0x110811,
+    0x86000,
+    0x2801C,
+    0x44018,
+    0x110811,
+    0x86000,
+    0x14001C,
+    0x110811,
+    0x1151,
+    0x86000,
+    0x170011,
+    0x110811,
+    0x86000,
+    0x26941,
+    0x170011,
+    0x110811,
+    0x1151,
+    0x86000,
+    0x170011,
+    0x110811,
+    0x86000,
+    0x26941,
+    0x170011,
+    0x180002,
+    0x392911,
+    0x40810,
+    0x86000,
+    0x82081,
+    0x180002,
+    0x392911,
+    0xA0051,
+    0x86000,
+    0x82081,
+    0x180002,
+    0x392911,
+    0x86000,
+    0x6801C,
+    0x180002,
+    0x392911,
+    0x86000,
+    0x14001C,
+    0x27801,
+    0x86000,
+    0x16C042,
+    0x86105,
+    0x44018,
+    0x27801,
+    0x86000,
+    0x16C042,
+    0x110811,
+    0x27801,
+    0x86000,
+    0x16C042,
+    0x40001,
+    0x86105,
+    0x44018,
+    0x110811,
+    0x12C040,
+    0xC1195,
+    0x27801,
+    0x86000,
+    0x16C042,
+    0x10A4090,
+    0x48910,
+    0xC1195,
+    0x2A0915,
+    0x48910,
+    0x20A6981,
+    0x3918,
+    0x6949,
+    0x48910,
+    0xC1195,
+    0xA01C0,
+    0x108000,
+    0x6949,
+    0x406008,
+    0x48910,
+    0xC1195,
+    0xA01C0,
+    0x83810,
+    0x20A6981,
+    0x6840,
+    0xE4410,
+    0x20003,
+    0x83810,
+    0x2018,
+    0x20A6981,
+    0xE4410,
+    0x2A0915,
+    0x20003,
+    0x83810,
+    0x2018,
+    0x20A6981,
+    0x41801,
+    0xE4410,
+    0x2A0915,
+    0x204013,
+    0x84008,
+    0x83810,
+    0x83810,
+    0x224013,
+    0x83810,
+    0x224013,
+    0x41801,
+    0x83810,
+    0x12201B,
+    0x83810,
+    0x20A6981,
+    0xE4410,
+    0x484000,
+    0xC6105,
+    0x20A6981,
+    0x6840,
+    0xE4410,
+    0x20003,
+    0xC6105,
+    0x2018,
+    0x20A6981,
+    0xE4410,
+    0x2A0915,
+    0x20003,
+    0xC6105,
+    0x2018,
+    0x20A6981,
+    0x41801,
+    0xE4410,
+    0x2A0915,
+    0xC6105,
+    0x224013,
+    0xC6105,
+    0x224013,
+    0x41801,
+    0x43,
+    0x69192,
+    0x86101,
+    0x2851,
+    0x47919,
+    0xA0090,
+    0x86145,
+    0x41801,
+    0xA2951,
+    0x480190,
+    0xA68C1,
+    0x12A91D,
+    0xE010,
+    0x1C0012,
+    0xE010,
+    0x1E8010,
+    0x43,
+    0xA1918,
+    0x80830,
+    0x48099,
+    0x43,
+    0xA1918,
+    0xA01C0,
+    0x48099,
+    0x84008,
+    0x42118,
+    0x2A15C,
+    0x260010,
+    0x144908,
+    0x1C0012,
+    0x2A15C,
+    0x144908,
+    0x1E8010,
+    0x20003,
+    0x20A6981,
+    0xE4410,
+    0x2A0915,
+    0x6949,
+    0x108149,
+    0x81995,
+    0x62140,
+    0x246108,
+    0x6840,
+    0x406149,
+    0x6949,
+    0x2961,
+    0x81995,
+    0x804002,
+    0x4945,
+    0x3100,
+    0x170019,
+    0x804002,
+    0x4945,
+    0x801001,
+    0x170019,
+    0xA201C,
+    0x7109,
+    0x84008,
+    0x480190,
+    0x84008,
+    0x83810,
+    0xE150,
+    0x568009,
+    0x26014,
+    0x84008,
+    0x424810,
+    0x108C07,
+    0xA01C0,
+    0x26014,
+    0x84008,
+    0x80830,
+    0x1CC080,
+    0x128010,
+    0x6300,
+    0x80830,
+    0x1A4010,
+    0x6300,
+    0x1A4010,
+    0xA01C0,
+    0x100820,
+    0x6300,
+    0x1A4010,
+    0x20851,
+    0x80405,
+    0x108000,
+    0x406008,
+    0x20851,
+    0x80405,
+    0x10481A,
+    0x80830,
+    0xA01C0,
+    0x1E2910,
+    0x80830,
+    0xA01C0,
+    0x80405,
+    0x80830,
+    0x189901,
+    0x6840,
+    0xA01C0,
+    0x80405,
+    0x80830,
+    0x6840,
+    0x80405,
+    0x204013,
+    0x20914,
+    0x8F014,
+    0x20909,
+    0x80405,
+    0x108000,
+    0x200118,
+    0x20A6981,
+    0x2006850,
+    0x120810,
+    0x206015,
+    0x7109,
+    0x5809,
+    0x222010,
+    0xAC011,
+    0x40118,
+    0x480190,
+    0x206015,
+    0x7109,
+    0x4E0839,
+    0x5809,
+    0x222010,
+    0xAC011,
+    0x40118,
+    0x80504,
+    0x440001,
+    0x480190,
+    0x12,
+    0x206015,
+    0x7109,
+    0x5809,
+    0x222010,
+    0xAC011,
+    0x4E01C9,
+    0x40118,
+    0x80504,
+    0x480190,
+    0x400900,
+    0x1440801,
+    0x4E0839,
+    0x5809,
+    0xAC011,
+    0x170011,
+    0x80504,
+    0x440001,
+    0x480190,
+    0x1440801,
+    0x12,
+    0x5809,
+    0xAC011,
+    0x4E01C9,
+    0x170011,
+    0x80504,
+    0x480190,
+    0x400900,
+    0x43,
+    0xA0417,
+    0x80830,
+    0x81995,
+    0x86101,
+    0x170011,
+    0x480190,
+    0x43,
+    0xA0417,
+    0x81995,
+    0x86101,
+    0xA01C0,
+    0x170011,
+    0x480190,
+    0x2851,
+    0x20003,
+    0xA0417,
+    0x80830,
+    0x81995,
+    0x86101,
+    0x152014,
+    0x2851,
+    0xA0417,
+    0x80410,
+    0x81995,
+    0x86101,
+    0xA01C0,
+    0x152014,
+    0x2851,
+    0xA0417,
+    0x226094,
+    0x10481A,
+    0x80830,
+    0x81995,
+    0x86101,
+    0x2851,
+    0xA0417,
+    0x226094,
+    0x10481A,
+    0x81995,
+    0x86101,
+    0xA01C0,
+    0xA0417,
+    0x80830,
+    0x81995,
+    0x40890,
+    0xE4110,
+    0x480190,
+    0xA0417,
+    0x81995,
+    0xA01C0,
+    0x40890,
+    0xE4110,
+    0x480190,
+    0x82839,
+    0x80830,
+    0x12C840,
+    0x81995,
+    0xEA191,
+    0x82839,
+    0x81995,
+    0xEA191,
+    0x12C040,
+    0xA01C0,
+    0x20003,
+    0xA1918,
+    0xA8910,
+    0x2A0915,
+    0x86101,
+    0xCC000,
+    0x6804,
+    0x86101,
+    0x1088010,
+    0xA0417,
+    0x1120804,
+    0x80830,
+    0x480190,
+    0xA0417,
+    0x1120804,
+    0xA01C0,
+    0x480190,
+    0x80830,
+    0xEA191,
+    0x480190,
+    0xEA191,
+    0xA01C0,
+    0x480190,
+    0xA0417,
+    0x1151,
+    0x80830,
+    0x86101,
+    0xA0417,
+    0x1151,
+    0x86101,
+    0xA01C0,
+    0x214A,
+    0xA0417,
+    0x80830,
+    0x86101,
+    0x214A,
+    0xA0417,
+    0x86101,
+    0xA01C0,
+    0xA0417,
+    0x80830,
+    0x170011,
+    0x12201B,
+    0xA0417,
+    0xA01C0,
+    0x170011,
+    0x12201B,
+    0xA0417,
+    0x26014,
+    0x80830,
+    0x170011,
+    0x80504,
+    0x8C000,
+    0x85002,
+    0xA0417,
+    0x26014,
+    0xA01C0,
+    0x170011,
+    0x80504,
+    0x85002,
+    0xA0417,
+    0x26014,
+    0x80830,
+    0x170011,
+    0x80504,
+    0xA0417,
+    0x26014,
+    0xA01C0,
+    0x170011,
+    0x80504,
+    0x8C000,
+    0x2851,
+    0xA0417,
+    0x84008,
+    0x80830,
+    0x2851,
+    0xA0417,
+    0x84008,
+    0xA01C0,
+    0x20005,
+    0xA0417,
+    0x80830,
+    0x40810,
+    0x82081,
+    0x20005,
+    0xA0417,
+    0xA0051,
+    0xA01C0,
+    0x82081,
+    0x20005,
+    0xA0417,
+    0x10481A,
+    0xA0051,
+    0x80830,
+    0x82081,
+    0x20005,
+    0xA0417,
+    0x10481A,
+    0x40810,
+    0xA01C0,
+    0x82081,
+    0xC07,
+    0xA0417,
+    0x80830,
+    0x40890,
+    0xE4110,
+    0xC07,
+    0xA0417,
+    0xA01C0,
+    0x40890,
+    0xE4110,
+    0x84018,
+    0x2034,
+    0x2910,
+    0x2A0915,
+    0x2000141,
+    0x2851,
+    0x80830,
+    0x161019,
+    0xE150,
+    0x2851,
+    0xA01C0,
+    0x170011,
+    0x2A2101,
+    0x2851,
+    0x84008,
+    0x161019,
+    0xA01C0,
+    0x2851,
+    0x42118,
+    0x180015,
+    0x2851,
+    0x2851,
+    0x80830,
+    0xE150,
+    0x68995,
+    0x2851,
+    0xE150,
+    0x68995,
+    0x108000,
+    0x2851,
+    0x1A2018,
+    0x2851,
+    0x260018,
+    0x2851,
+    0x12201B,
+    0x2851,
+    0x260018,
+    0x12201B,
+    0x2851,
+    0x114912,
+    0xE150,
+    0x108000,
+    0x2851,
+    0x406008,
+    0x114912,
+    0xE150,
+    0x2851,
+    0x21001,
+    0x424001,
+    0x2158,
+    0x161019,
+    0xE010,
+    0x8E140,
+    0xA01C0,
+    0x108000,
+    0x2851,
+    0x21001,
+    0x424001,
+    0x2158,
+    0x80830,
+    0x161019,
+    0xE010,
+    0x8E140,
+    0x108000,
+    0x2851,
+    0x21001,
+    0x424001,
+    0x406008,
+    0x2158,
+    0x161019,
+    0xE010,
+    0x8E140,
+    0xA01C0,
+    0x2851,
+    0x21001,
+    0x424001,
+    0x406008,
+    0x2158,
+    0x80830,
+    0x161019,
+    0xE010,
+    0x8E140,
+    0x2851,
+    0x21001,
+    0x424001,
+    0x2158,
+    0x161019,
+    0xE010,
+    0x8E140,
+    0xA01C0,
+    0x108000,
+    0x2851,
+    0x21001,
+    0x424001,
+    0x2158,
+    0x80830,
+    0x161019,
+    0xE010,
+    0x8E140,
+    0x108000,
+    0x2851,
+    0x21001,
+    0x424001,
+    0x406008,
+    0x2158,
+    0x161019,
+    0xE010,
+    0x8E140,
+    0xA01C0,
+    0x2851,
+    0x21001,
+    0x424001,
+    0x406008,
+    0x2158,
+    0x80830,
+    0x161019,
+    0xE010,
+    0x8E140,
+    0x1089010,
+    0x260018,
+    0xC0010,
+    0x1089010,
+    0x224013,
+    0xC0010,
+    0x204013,
+    0x20914,
+    0x1089010,
+    0xC0010,
+    0x41801,
+    0x204013,
+    0x424001,
+    0x1089010,
+    0xA01C0,
+    0xC0010,
+    0x204013,
+    0x424001,
+    0x1089010,
+    0x80830,
+    0xC0010,
+    0x20003,
+    0x20914,
+    0x20A6981,
+    0x20003,
+    0x2091C,
+    0x2A0915,
+    0x2091C,
+    0x28811,
+    0x2091C,
+    0x260010,
+    0x144908,
+    0x2091C,
+    0x12A91D,
+    0x20003,
+    0x20914,
+    0x200118,
+    0x8A1,
+    0x20A6981,
+    0x8C000,
+    0x2A0915,
+    0x20914,
+    0x16D118,
+    0x4C6D15,
+    0x2091C,
+    0x246108,
+    0xA4019,
+    0x42140,
+    0x424001,
+    0x20914,
+    0x1A40C0,
+    0x108000,
+    0x180812,
+    0x2091C,
+    0x480190,
+    0x180812,
+    0x2091C,
+    0x2091C,
+    0x40810,
+    0x82081,
+    0x2091C,
+    0xA0051,
+    0x82081,
+    0x20914,
+    0xA01C0,
+    0x41801,
+    0x20914,
+    0x20A6981,
+    0xA01C0,
+    0xE4410,
+    0x484000,
+    0x6949,
+    0x62140,
+    0x40881,
+    0x170019,
+    0x6949,
+    0x2961,
+    0x40881,
+    0x170019,
+    0xE0511,
+    0x170019,
+    0x20914,
+    0x41801,
+    0x170019,
+    0x170011,
+    0x170019,
+    0x6318,
+    0x170011,
+    0x484000,
+    0x204013,
+    0x84008,
+    0xA2951,
+    0xA2951,
+    0x12201B,
+    0xA2951,
+    0x85002,
+    0x60130,
+    0xA2951,
+    0x204013,
+    0x80830,
+    0xA01C0,
+    0xA2951,
+    0x20003,
+    0x4011A,
+    0x80830,
+    0xA2951,
+    0x2A0915,
+    0x20003,
+    0x4011A,
+    0xA01C0,
+    0xA2951,
+    0x2A0915,
+    0xC07,
+    0x484112,
+    0x8A1,
+    0x80830,
+    0xC07,
+    0x484112,
+    0x8A1,
+    0xA01C0,
+    0xC07,
+    0x484112,
+    0xC07,
+    0x8A1,
+    0x80830,
+    0xC1110,
+    0xC07,
+    0x8A1,
+    0xA01C0,
+    0xC1110,
+    0x484112,
+    0x161021,
+    0x1648C1,
+    0x2A0915,
+    0x480190,
+    0xC07,
+    0x1648C1,
+    0x2034,
+    0x80830,
+    0x1400940,
+    0x2034,
+    0xA01C0,
+    0x1400940,
+    0x10481A,
+    0x2034,
+    0x80830,
+    0x1400940,
+    0x10481A,
+    0x2034,
+    0xA01C0,
+    0x1400940,
+    0x1082110,
+    0x2120,
+    0x8F914,
+    0x1082120,
+    0xC4194,
+    0x1082120,
+    0x224010,
+    0x80110,
+    0x20003,
+    0x1082120,
+    0x82059,
+    0x2A0915,
+    0x10481A,
+    0x2018,
+    0x189901,
+    0xA3913,
+    0x1A601C,
+    0x186910,
+    0x170011,
+    0x62115,
+    0x1AC00C,
+    0x1408B0,
+    0x150811,
+    0x28811,
+    0x42140,
+    0xC2819,
+    0x204013,
+    0x150811,
+    0x28811,
+    0x42140,
+    0xC2819,
+    0x80918,
+    0x8291D,
+    0x28811,
+    0xC2819,
+    0x392911,
+    0x9D4,
+    0xE0401,
+    0x184945,
+    0x21401,
+    0x2401C,
+    0x10A719D,
+    0xC07,
+    0x406008,
+    0x8A1,
+    0x80830,
+    0x8E140,
+    0xA2951,
+    0xC07,
+    0x406008,
+    0x8A1,
+    0x8E140,
+    0xA01C0,
+    0xA2951,
+    0x424001,
+    0xC07,
+    0x7109,
+    0x406008,
+    0xC07,
+    0x2006850,
+    0x424001,
+    0x20914,
+    0x406008,
+    0x480190,
+    0x424001,
+    0xC07,
+    0x20914,
+    0x406008,
+    0x2001B,
+    0x24010,
+    0x170011,
+    0x480190,
+    0x2001B,
+    0xC07,
+    0x24010,
+    0x170011,
+    0x2001B,
+    0x7109,
+    0x24010,
+    0x480190,
+    0x2001B,
+    0xC07,
+    0x7109,
+    0x24010,
+    0x2001B,
+    0x20914,
+    0x24010,
+    0x480190,
+    0x2001B,
+    0xC07,
+    0x20914,
+    0x24010,
+    0x424001,
+    0x6804,
+    0x1000819,
+    0xA01C0,
+    0x120810,
+    0xAC011,
+    0x260010,
+    0x144908,
+    0x224013,
+    0x144908,
+    0x20A6981,
+    0x260010,
+    0x144908,
+    0xE4410,
+    0x142,
+    0x144908,
+    0x142,
+    0x21C8,
+    0x86101,
+    0x260010,
+    0x41095,
+    0x144908,
+    0x10481A,
+    0x148800,
+    0x148800,
+    0xA8910,
+    0x2851,
+    0xA0417,
+    0x32001C,
+    0x80830,
+    0x8E140,
+    0x2851,
+    0xA0417,
+    0x32001C,
+    0x8E140,
+    0xA01C0,
+    0x1082100,
+    0x1003100,
+    0x1020001,
+    0x2091C,
+    0x84008,
+    0xAC011,
+    0x1020001,
+    0x2091C,
+    0xAC011,
+    0x148800,
+    0x1020001,
+    0x2091C,
+    0xAC011,
+    0xC1110,
+    0x1020001,
+    0x84008,
+    0xAC011,
+    0x106100,
+    0x1020001,
+    0xAC011,
+    0x148800,
+    0x106100,
+    0x1020001,
+    0xE6114,
+    0xAC011,
+    0x170011,
+    0x1020001,
+    0xAC011,
+    0x170011,
+    0x106100,
+    0x4945,
+    0x21050,
+    0xAC011,
+    0x484000,
+    0x4945,
+    0xAC011,
+    0x484000,
+    0x1020001,
+    0xAC011,
+    0xC1110,
+    0x105808,
+    0x141000,
+    0x484000,
+    0xA2951,
+    0x1C7101,
+    0xA2951,
+    0xAC011,
+    0x138819,
+    0x82130,
+    0xA2951,
+    0xA8001,
+    0x10481A,
+    0xA2951,
+    0xE4410,
+    0x220051,
+    0xA2951,
+    0x40881,
+    0x1A6905,
+    0x186124,
+    0x4C6D15,
+    0xA6151,
+    0x126009,
+    0xA6151,
+    0x2910,
+    0x88081,
+    0xC810,
+    0x1A2855,
+    0x126009,
+    0xA6151,
+    0x2910,
+    0x88081,
+    0xC810,
+    0x161915,
+    0x10294C,
+    0xA6151,
+    0x2910,
+    0x86000,
+    0xC810,
+    0x126009,
+    0xA2951,
+    0xAC011,
+    0x8E100,
+    0xA2951,
+    0xAC011,
+    0x1B6111,
+    0x424001,
+    0x4480,
+    0xA2951,
+    0x4E0839,
+    0xA2951,
+    0x42140,
+    0xC1110,
+    0xA2951,
+    0xE6114,
+    0xA2951,
+    0x106100,
+    0xA2951,
+    0x224013,
+    0x128010,
+    0xA2951,
+    0x424810,
+    0x12201B,
+    0x484112,
+    0x6300,
+    0x20851,
+    0x20851,
+    0x80830,
+    0xAC011,
+    0xA2951,
+    0xCF104,
+    0x86101,
+    0x41095,
+    0x86101,
+    0xA140,
+    0x41095,
+    0x86101,
+    0xAE314,
+    0x41095,
+    0x204013,
+    0x20914,
+    0x148800,
+    0x42140,
+    0x41801,
+    0x204013,
+    0x82015,
+    0x921934,
+    0x148800,
+    0x42140,
+    0x204013,
+    0x2213C,
+    0x148800,
+    0x2CC110,
+    0x42140,
+    0x141000,
+    0x80918,
+    0x404812,
+    0x84008,
+    0x148800,
+    0x42140,
+    0x404812,
+    0x2213C,
+    0x148800,
+    0x2CC110,
+    0x42140,
+    0x141000,
+    0x80918,
+    0x148800,
+    0x1E8106,
+    0x484000,
+    0x86109,
+    0x3100,
+    0x42140,
+    0xC07,
+    0x148800,
+    0x42140,
+    0xA2951,
+    0x204013,
+    0x5005,
+    0x143100,
+    0x42140,
+    0x404812,
+    0x84008,
+    0x143100,
+    0x42140,
+    0xC4008,
+    0x2961,
+    0x143100,
+    0x42140,
+    0xC4008,
+    0x143100,
+    0x62140,
+    0x42140,
+    0x20914,
+    0x8A1,
+    0x80830,
+    0x148800,
+    0x42140,
+    0x20914,
+    0x8A1,
+    0x148800,
+    0xA01C0,
+    0x42140,
+    0x64004,
+    0x1AC00C,
+    0x2A4014,
+    0x204013,
+    0x84008,
+    0x18F905,
+    0x42140,
+    0x18F905,
+    0x42140,
+    0x12201B,
+    0x85002,
+    0x4481C,
+    0x1AC00C,
+    0xE111C,
+    0x1AC00C,
+    0x41081,
+    0x20914,
+    0x8A1,
+    0x80830,
+    0x18F905,
+    0x42140,
+    0x20914,
+    0x8A1,
+    0x18F905,
+    0xA01C0,
+    0x42140,
+    0x82015,
+    0x2091C,
+    0x921934,
+    0x18F905,
+    0x42140,
+    0x20914,
+    0x10481A,
+    0x18F905,
+    0x42140,
+    0x2091C,
+    0x246108,
+    0x42140,
+    0x148800,
+    0x42140,
+    0xA2951,
+    0x143100,
+    0x42140,
+    0xA2951,
+    0x18F905,
+    0x42140,
+    0xA2951,
+    0xA6110,
+    0x1AC00C,
+    0xA6110,
+    0x1AC00C,
+    0xA21C9,
+    0xCF104,
+    0x86101,
+    0xA6911,
+    0x87941,
+    0x1AC00C,
+    0x84008,
+    0xE6114,
+    0x43,
+    0x143100,
+    0x86101,
+    0x42140,
+    0x1E6107,
+    0x106100,
+    0x224013,
+    0x106100,
+    0xE6114,
+    0x224013,
+    0xE6114,
+    0x4945,
+    0x4945,
+    0x106100,
+    0x204013,
+    0xE6114,
+    0x106100,
+    0x204013,
+    0xE6114,
+    0x106100,
+    0x204013,
+    0x20003,
+    0xE6114,
+    0x106100,
+    0x204013,
+    0x20003,
+    0xE6114,
+    0x106100,
+    0x4011A,
+    0x6318,
+    0x106100,
+    0x4011A,
+    0xE6114,
+    0x6318,
+    0x4481C,
+    0x60130,
+    0x106100,
+    0x4481C,
+    0xE6114,
+    0x60130,
+    0x10481A,
+    0xE6114,
+    0x170011,
+    0x10481A,
+    0x170011,
+    0x106100,
+    0x4481C,
+    0x1AC00C,
+    0x60130,
+    0x41081,
+    0x106100,
+    0x204013,
+    0x84008,
+    0x4945,
+    0x204013,
+    0x84008,
+    0x4945,
+    0x10481A,
+    0x4945,
+    0x10481A,
+    0x4945,
+    0xE2154,
+    0x4945,
+    0x484000,
+    0xE2154,
+    0x4945,
+    0x484000,
+    0x20851,
+    0x4E940,
+    0x20851,
+    0x4E940,
+    0x4945,
+    0x22E951,
+    0x4945,
+    0x1918,
+    0xC1010,
+    0x4945,
+    0x1918,
+    0xC1010,
+    0x40089,
+    0x20A6981,
+    0x4945,
+    0x40089,
+    0x20A6981,
+    0x4945,
+    0x10481A,
+    0x4945,
+    0x224013,
+    0x4945,
+    0x12201B,
+    0x10481A,
+    0x4945,
+    0x12201B,
+    0x41801,
+    0x12201B,
+    0x200010,
+    0x10481A,
+    0x4945,
+    0x224013,
+    0x10481A,
+    0x4945,
+    0x24000,
+    0x12201B,
+    0xE6115,
+    0x7109,
+    0x86101,
+    0xE6115,
+    0x86101,
+    0x22051,
+    0x404812,
+    0x84008,
+    0x150811,
+    0x42140,
+    0x204013,
+    0x84008,
+    0x8291D,
+    0x20003,
+    0x10481A,
+    0x20A6981,
+    0x8291D,
+    0x28811,
+    0xE4410,
+    0xA8910,
+    0x2A0915,
+    0x20003,
+    0x20A6981,
+    0xE4410,
+    0xA8910,
+    0x2A0915,
+    0x204013,
+    0x84008,
+    0xAC011,
+    0x80918,
+    0xC4008,
+    0xAC011,
+    0x62140,
+    0x80918,
+    0x143100,
+    0x61901,
+    0x204013,
+    0x1A6054,
+    0x84008,
+    0xE0511,
+    0x150811,
+    0x82015,
+    0xC5801,
+    0x921934,
+    0x110811,
+    0x18AD911,
+    0x110811,
+    0x204013,
+    0x150811,
+    0x148800,
+    0x42140,
+    0x204013,
+    0x150811,
+    0x148800,
+    0x42140,
+    0x204013,
+    0x150811,
+    0xAC011,
+    0x42140,
+    0x80918,
+    0x6804,
+    0x10481A,
+    0x110811,
+    0x3C6114,
+    0x150811,
+    0x42140,
+    0x484000,
+    0x3C6114,
+    0x150811,
+    0x42140,
+    0xA0090,
+    0x204013,
+    0x404812,
+    0xC4008,
+    0x150811,
+    0x42140,
+    0x484000,
+    0x204013,
+    0xC4008,
+    0x392911,
+    0x124020,
+    0x20914,
+    0x42118,
+    0x40810,
+    0x82081,
+    0x20914,
+    0xA0051,
+    0x42118,
+    0x82081,
+    0x204013,
+    0x40810,
+    0x21401,
+    0x1D6110,
+    0x82081,
+    0x204013,
+    0xA0051,
+    0x21401,
+    0x1D6110,
+    0x82081,
+    0x110811,
+    0x200000000C2891,
+    0xC2819,
+    0x40810,
+    0x82081,
+    0x110811,
+    0xA0051,
+    0xC2819,
+    0x82081,
+    0x84008,
+    0x110811,
+    0x42118,
+    0x40810,
+    0xC2819,
+    0x82081,
+    0x84008,
+    0x110811,
+    0xA0051,
+    0x42118,
+    0xC2819,
+    0x82081,
+    0x204013,
+    0x84008,
+    0x110811,
+    0x40810,
+    0xC2819,
+    0x82081,
+    0x204013,
+    0x84008,
+    0x110811,
+    0xA0051,
+    0xC2819,
+    0x82081,
+    0x204013,
+    0x84008,
+    0x110811,
+    0x40810,
+    0xA01C0,
+    0xC2819,
+    0x82081,
+    0x204013,
+    0x84008,
+    0x110811,
+    0xA0051,
+    0x80830,
+    0xC2819,
+    0x82081,
+    0x8AD111,
+    0x40810,
+    0x82081,
+    0x8AD111,
+    0xA0051,
+    0x82081,
+    0x110811,
+    0x40810,
+    0x2910,
+    0x86000,
+    0x42950,
+    0x82081,
+    0x110811,
+    0xA0051,
+    0x2910,
+    0x86000,
+    0x42950,
+    0x82081,
+    0x8AD111,
+    0x40810,
+    0x86000,
+    0x82081,
+    0x8AD111,
+    0xA0051,
+    0x86000,
+    0x82081,
+    0x204013,
+    0x10481A,
+    0x110811,
+    0xA0051,
+    0x40810,
+    0x2910,
+    0x82081,
+    0x204013,
+    0x10481A,
+    0x110811,
+    0xA0051,
+    0x40810,
+    0x2910,
+    0x82081,
+    0x204013,
+    0x110811,
+    0x200000000C2891,
+    0x61901,
+    0x40810,
+    0x82081,
+    0x204013,
+    0x110811,
+    0xA0051,
+    0x61901,
+    0x82081,
+    0x204013,
+    0xA0051,
+    0x40810,
+    0x61901,
+    0x82081,
+    0x204013,
+    0xA0051,
+    0x40810,
+    0x61901,
+    0x82081,
+    0x204013,
+    0x10481A,
+    0x110811,
+    0xA0051,
+    0x40810,
+    0x2910,
+    0x82081,
+    0x204013,
+    0x10481A,
+    0x110811,
+    0xA0051,
+    0x40810,
+    0x2910,
+    0x82081,
+    0x204013,
+    0x110811,
+    0xA0051,
+    0x40810,
+    0xC2819,
+    0x82081,
+    0x204013,
+    0x110811,
+    0xA0051,
+    0x40810,
+    0xC2819,
+    0x82081,
+    0x110811,
+    0x40810,
+    0xC2819,
+    0x82081,
+    0x110811,
+    0xA0051,
+    0xC2819,
+    0x82081,
+    0x84008,
+    0x110811,
+    0x42118,
+    0x40810,
+    0xC2819,
+    0x82081,
+    0x84008,
+    0x110811,
+    0xA0051,
+    0x42118,
+    0xC2819,
+    0x82081,
+    0x10481A,
+    0x110811,
+    0x40810,
+    0x2910,
+    0x82081,
+    0x2000000010691A,
+    0x110811,
+    0x200000000A20D1,
+    0x1192911,
+    0xC1195,
+    0x10481A,
+    0xA0051,
+    0x2910,
+    0x82081,
+    0x10481A,
+    0x110811,
+    0x40810,
+    0x2910,
+    0xC2819,
+    0x82081,
+    0x10481A,
+    0x110811,
+    0xA0051,
+    0x2910,
+    0xC2819,
+    0x82081,
+    0x40810,
+    0x61901,
+    0x82081,
+    0xA0051,
+    0x61901,
+    0x82081,
+    0x204013,
+    0x150811,
+    0x40810,
+    0x42140,
+    0x61901,
+    0x82081,
+    0x204013,
+    0x150811,
+    0xA0051,
+    0x42140,
+    0x61901,
+    0x82081,
+    0x1C4813,
+    0x1186104,
+    0x10481A,
+    0x40810,
+    0xC2018,
+    0x82081,
+    0x10481A,
+    0xA0051,
+    0xC2018,
+    0x82081,
+    0x10481A,
+    0x40810,
+    0xC2018,
+    0x82081,
+    0x12201B,
+    0xA0051,
+    0x40810,
+    0x22E951,
+    0x82081,
+    0x4011A,
+    0xA0051,
+    0x40810,
+    0x82081,
+    0x4481C,
+    0x320014,
+    0x40810,
+    0x82081,
+    0x4481C,
+    0x320014,
+    0xA0051,
+    0x82081,
+    0x204013,
+    0x4481C,
+    0x320014,
+    0x110811,
+    0x40810,
+    0xC2819,
+    0x82081,
+    0x204013,
+    0x4481C,
+    0x320014,
+    0x110811,
+    0xA0051,
+    0xC2819,
+    0x82081,
+    0x61811,
+    0x82081,
+    0x20851,
+    0x82081,
+    0x110811,
+    0x61811,
+    0x82081,
+    0x110811,
+    0x20851,
+    0x82081,
+    0x204013,
+    0x1109002,
+    0x150811,
+    0x42140,
+    0x204013,
+    0x150811,
+    0x2910,
+    0x6801C,
+    0x42140,
+    0x42950,
+    0x204013,
+    0x150811,
+    0x2910,
+    0x42140,
+    0x42950,
+    0x14001C,
+    0x204013,
+    0x110811,
+    0x2910,
+    0x86000,
+    0x6801C,
+    0x42950,
+    0x204013,
+    0x110811,
+    0x2910,
+    0x86000,
+    0x42950,
+    0x14001C,
+    0x204013,
+    0x150811,
+    0x6801C,
+    0x42140,
+    0x204013,
+    0x150811,
+    0x42140,
+    0x14001C,
+    0x204013,
+    0x110811,
+    0x86000,
+    0x6801C,
+    0x204013,
+    0x110811,
+    0x86000,
+    0x14001C,
+    0x204013,
+    0xC5801,
+    0x110811,
+    0x6801C,
+    0x204013,
+    0xC5801,
+    0x110811,
+    0x14001C,
+    0x204013,
+    0xC5801,
+    0x110811,
+    0x86000,
+    0x6801C,
+    0x204013,
+    0xC5801,
+    0x110811,
+    0x86000,
+    0x14001C,
+    0x10481A,
+    0x6801C,
+    0x10481A,
+    0x14001C,
+    0x84008,
+    0x1C0012,
+    0x84008,
+    0x1E8010,
+    0x404812,
+    0x148800,
+    0x42140,
+    0x1C0012,
+    0x404812,
+    0x148800,
+    0x42140,
+    0x1E8010,
+    0x404812,
+    0x18F905,
+    0x42140,
+    0x1C0012,
+    0x404812,
+    0x18F905,
+    0x42140,
+    0x1E8010,
+    0x204013,
+    0x84008,
+    0x110811,
+    0x1C0012,
+    0x204013,
+    0x84008,
+    0x110811,
+    0x1E8010,
+    0x204013,
+    0x150811,
+    0x42140,
+    0x1C0012,
+    0x204013,
+    0x150811,
+    0x42140,
+    0x1E8010,
+    0x204013,
+    0xAC011,
+    0x1C0012,
+    0x80918,
+    0x204013,
+    0xAC011,
+    0x1E8010,
+    0x80918,
+    0x204013,
+    0xC5801,
+    0x110811,
+    0x1C0012,
+    0x204013,
+    0xC5801,
+    0x110811,
+    0x1E8010,
+    0x204013,
+    0x110811,
+    0x86000,
+    0x1C0012,
+    0x204013,
+    0x110811,
+    0x86000,
+    0x1E8010,
+    0x804002,
+    0x80830,
+    0xE010,
+    0xAC011,
+    0x170011,
+    0x804002,
+    0xE010,
+    0xAC011,
+    0xA01C0,
+    0x170011,
+    0x4481C,
+    0x1C0012,
+    0x4481C,
+    0x1E8010,
+    0x4481C,
+    0x110811,
+    0x1C0012,
+    0x4481C,
+    0x110811,
+    0x1E8010,
+    0x204013,
+    0x1C0012,
+    0x1E8010,
+    0x204013,
+    0x1C0012,
+    0x1E8010,
+    0x204013,
+    0x1C0012,
+    0x204013,
+    0x1E8010,
+    0x4011A,
+    0x1C0012,
+    0x1E8010,
+    0x4011A,
+    0x40089,
+    0x6318,
+    0x1C0012,
+    0x1E8010,
+    0x466009,
+    0x83810,
+    0xE150,
+    0xAC5A4,
+    0x80010,
+    0x8C000,
+    0xE6114,
+    0x2E2811,
+    0x26560,
+    0x8A118,
+    0x86000,
+    0x8A118,
+    0x26560,
+    0x80830,
+    0xE4080,
+    0x80405,
+    0x406008,
+    0xE4080,
+    0x80405,
+    0xE4080,
+    0x80405,
+    0x108000,
+    0x12A91D,
+    0x20003,
+    0x1026909,
+    0xA01C0,
+    0xC0131,
+    0xA8910,
+    0x1E2910,
+    0x2A0915,
+    0x20003,
+    0x10481A,
+    0x80830,
+    0x1E2910,
+    0x2A0915,
+    0x20003,
+    0x10481A,
+    0x80830,
+    0x1E2910,
+    0x2A0915,
+    0x20003,
+    0x10481A,
+    0x80830,
+    0x1E2910,
+    0x2A0915,
+    0x40089,
+    0x10481A,
+    0x80830,
+    0x6840,
+    0x21012,
+    0x2A0915,
+    0x406008,
+    0x224013,
+    0xE4080,
+    0x80405,
+    0xE4080,
+    0x80405,
+    0x12201B,
+    0x108000,
+    0x204013,
+    0x406008,
+    0xE4080,
+    0x80405,
+    0x108000,
+    0x10481A,
+    0x406008,
+    0x80405,
+    0x10481A,
+    0xA11C,
+    0x80405,
+    0x108000,
+    0x10481A,
+    0x86000,
+    0x42140,
+    0xE4410,
+    0x10481A,
+    0x86000,
+    0x260018,
+    0x42140,
+    0xE4410,
+    0x200118,
+    0x44018,
+    0x86151,
+    0x86000,
+    0x260018,
+    0x40881,
+    0x204013,
+    0x20914,
+    0x2910,
+    0x2A0915,
+    0x404812,
+    0x20914,
+    0x2910,
+    0x2A0915,
+    0x404812,
+    0x20914,
+    0x406008,
+    0x1062915,
+    0xC0131,
+    0x80405,
+    0x20A6981,
+    0x28811,
+    0xE4410,
+    0xAC011,
+    0x28811,
+    0x80918,
+    0x20003,
+    0x1022103,
+    0x2A2911,
+    0xA6911,
+    0xA8910,
+    0x2A0915,
+    0x20003,
+    0x20A6981,
+    0xE4410,
+    0xA8910,
+    0x2A0915,
+    0x6804,
+    0xAC011,
+    0xA8910,
+    0x40810,
+    0xC2018,
+    0x82081,
+    0xA8910,
+    0xA0051,
+    0xC2018,
+    0x82081,
+    0xA8910,
+    0x10481A,
+    0x110811,
+    0x40810,
+    0x2910,
+    0xC2819,
+    0x82081,
+    0x10481A,
+    0x110811,
+    0xA0051,
+    0x2910,
+    0xC2819,
+    0x82081,
+    0x1022103,
+    0xA6911,
+    0x144908,
+    0xA8910,
+    0x20003,
+    0x20851,
+    0xAC011,
+    0xA8910,
+    0x2A0915,
+    0x10481A,
+    0xAC011,
+    0x144908,
+    0x20003,
+    0x4194,
+    0xE0709,
+    0x2A0915,
+    0x480190,
+    0x1020001,
+    0x20003,
+    0x4194,
+    0xE0709,
+    0x2A0915,
+    0x480190,
+    0x424001,
+    0x80830,
+    0x2000000008E970,
+    0x4E0839,
+    0x8E140,
+    0x424001,
+    0x108000,
+    0x2000000018E140,
+    0x8E140,
+    0x568009,
+    0x424001,
+    0xA01C0,
+    0x200000000AE1C0,
+    0x186124,
+    0x86101,
+    0x8E140,
+    0x4E01C9,
+    0x84801,
+    0x424001,
+    0x406008,
+    0x2000000048E148,
+    0x466009,
+    0x8E140,
+    0x424001,
+    0x200000000A09F0,
+    0x80830,
+    0x86101,
+    0xA6911,
+    0xA01C0,
+    0x424001,
+    0x2000000050E008,
+    0x406008,
+    0x108000,
+    0x424001,
+    0xA611C,
+    0xA291D,
+    0x4E6090,
+    0x20000000188830,
+    0x80830,
+    0xA6080,
+    0x108000,
+    0x4C0010,
+    0x424001,
+    0xA611C,
+    0xA291D,
+    0xE6091,
+    0x200000001A81C0,
+    0xC0011,
+    0xA6080,
+    0xA01C0,
+    0x108000,
+    0x424001,
+    0xA611C,
+    0x200000004A61C8,
+    0xA291D,
+    0x1C4091,
+    0x406008,
+    0xC0011,
+    0xA01C0,
+    0x1C4080,
+    0x424001,
+    0xA611C,
+    0x20000000486838,
+    0xA291D,
+    0x5C4090,
+    0x406008,
+    0x80830,
+    0x1C4080,
+    0x4C0010,
+    0x424001,
+    0x4E0839,
+    0xE4410,
+    0x424001,
+    0x4E01C9,
+    0xE4410,
+    0x424001,
+    0x4E0839,
+    0x600011,
+    0x424001,
+    0x4E01C9,
+    0x600011,
+    0x424001,
+    0x99,
+    0x4E0839,
+    0x484000,
+    0x164004,
+    0xC0021,
+    0x80830,
+    0x424001,
+    0x99,
+    0x484000,
+    0x568009,
+    0x164004,
+    0xC0021,
+    0x108000,
+    0x424001,
+    0x99,
+    0x4E01C9,
+    0x484000,
+    0x164004,
+    0xC0021,
+    0x86101,
+    0xA01C0,
+    0x1E6314,
+    0x84801,
+    0x424001,
+    0x466009,
+    0x99,
+    0x484000,
+    0x164004,
+    0x406008,
+    0xC0021,
+    0x38,
+    0x25020,
+    0x424001,
+    0x4E0839,
+    0x80901,
+    0x424001,
+    0x4E01C9,
+    0x80901,
+    0x86314,
+    0x86101,
+    0x84801,
+    0x424001,
+    0x20003,
+    0x25020,
+    0x4E0839,
+    0x424001,
+    0x20003,
+    0x25020,
+    0x568009,
+    0x424001,
+    0x20003,
+    0x25020,
+    0x4E01C9,
+    0x89811,
+    0x86101,
+    0x424001,
+    0x20003,
+    0x466009,
+    0x25020,
+    0x88098,
+    0x1045802,
+    0x424001,
+    0x40013,
+    0x406008,
+    0x108000,
+    0x480180,
+    0x424001,
+    0x322144,
+    0x80830,
+    0xA01C0,
+    0x4480,
+    0x4E0839,
+    0x424001,
+    0x322144,
+    0x80830,
+    0xA01C0,
+    0x4480,
+    0x4E01C9,
+    0x424001,
+    0x4E0839,
+    0xC800,
+    0x424001,
+    0xC800,
+    0x4E01C9,
+    0x424001,
+    0x80830,
+    0xA01C0,
+    0x600011,
+    0x424001,
+    0x80830,
+    0xA01C0,
+    0xE4410,
+    0x424001,
+    0x466009,
+    0x2000141,
+    0x10E4914,
+    0x424001,
+    0x4E0839,
+    0x88100,
+    0x568009,
+    0x424001,
+    0x4E01C9,
+    0x88100,
+    0x568009,
+    0x424001,
+    0x466009,
+    0x4E0839,
+    0x88100,
+    0x424001,
+    0x466009,
+    0x4E01C9,
+    0x88100,
+    0x424001,
+    0x26014,
+    0x466009,
+    0x4E01C9,
+    0x38,
+    0x2910,
+    0x424001,
+    0x26014,
+    0x466009,
+    0x4E0839,
+    0x4C6D15,
+    0x424001,
+    0x61914,
+    0x8C000,
+    0x424001,
+    0x444D14,
+    0x61914,
+    0x8C000,
+    0x424001,
+    0x20003,
+    0x6840,
+    0xA6080,
+    0x4C0010,
+    0x5090,
+    0x424001,
+    0x20003,
+    0x60003,
+    0x4E0839,
+    0x224010,
+    0x4E01C9,
+    0xC01A0,
+    0x80003,
+    0x4C6D15,
+    0x424001,
+    0x20914,
+    0xE010,
+    0x424001,
+    0x20914,
+    0x444D14,
+    0xE010,
+    0x20003,
+    0x2E081,
+    0x4E0839,
+    0x568009,
+    0x20003,
+    0x466009,
+    0x2E081,
+    0x4E0839,
+    0x20003,
+    0x2E081,
+    0x4E01C9,
+    0x568009,
+    0x20003,
+    0x2E081,
+    0x4E0839,
+    0x568009,
+    0x20003,
+    0x2E081,
+    0x4E01C9,
+    0x568009,
+    0x20003,
+    0x466009,
+    0x2E081,
+    0x4E01C9,
+    0x20003,
+    0x466009,
+    0x2E081,
+    0x4E01C9,
+    0x20003,
+    0x466009,
+    0x2E081,
+    0x4E0839,
+    0x424001,
+    0x4E0839,
+    0x224010,
+    0x4E01C9,
+    0x2009,
+    0x424001,
+    0x464001,
+    0x406008,
+    0x2000000048E148,
+    0x108000,
+    0x2000000018E140,
+    0x466009,
+    0x4E0839,
+    0x8E140,
+    0x568009,
+    0x424001,
+    0x464001,
+    0x80830,
+    0x2000000008E970,
+    0x224010,
+    0xA01C0,
+    0x200000000AE1C0,
+    0x4E0839,
+    0x8E140,
+    0x4E01C9,
+    0x464001,
+    0x4E0839,
+    0x28119,
+    0x464001,
+    0x28119,
+    0x568009,
+    0x464001,
+    0x28119,
+    0x4E01C9,
+    0x464001,
+    0x466009,
+    0x28119,
+    0x2E081,
+    0x4E0839,
+    0x224010,
+    0x4E01C9,
+    0x2E081,
+    0x4E0839,
+    0x224010,
+    0x4E01C9,
+    0x424001,
+    0x10481A,
+    0x4E0839,
+    0xE4410,
+    0x424001,
+    0x10481A,
+    0x80830,
+    0xA01C0,
+    0xE4410,
+    0x424001,
+    0x10481A,
+    0x4E01C9,
+    0xE4410,
+    0x424001,
+    0x10481A,
+    0x4E0839,
+    0x424001,
+    0x10481A,
+    0x568009,
+    0x424001,
+    0x10481A,
+    0x4E01C9,
+    0x424001,
+    0x10481A,
+    0x466009,
+    0x424001,
+    0x10481A,
+    0x80830,
+    0xA01C0,
+    0x424001,
+    0x10481A,
+    0x406008,
+    0x108000,
+    0x424001,
+    0x10481A,
+    0xA6080,
+    0x4C0010,
+    0x424001,
+    0x10481A,
+    0xC0011,
+    0xA6080,
+    0x424001,
+    0x10481A,
+    0xC0011,
+    0x1C4080,
+    0x424001,
+    0x10481A,
+    0x1C4080,
+    0x4C0010,
+    0x424001,
+    0x4E0839,
+    0xA8910,
+    0x424001,
+    0x4E01C9,
+    0xA8910,
+    0x424001,
+    0x4E0839,
+    0x150950,
+    0x424001,
+    0x4E01C9,
+    0x150950,
+    0x424001,
+    0x10481A,
+    0xE4410,
+    0x568009,
+    0x8051,
+    0x108000,
+    0x424001,
+    0x10481A,
+    0x466009,
+    0xE4410,
+    0x406008,
+    0x8051,
+    0x424001,
+    0x40099,
+    0x4E0839,
+    0x424001,
+    0x40099,
+    0x568009,
+    0x424001,
+    0x40099,
+    0x4E01C9,
+    0x424001,
+    0x40099,
+    0x466009,
+    0x424001,
+    0x20003,
+    0x4E0839,
+    0x4A0839,
+    0x80003,
+    0x424001,
+    0x20003,
+    0x4E01C9,
+    0x4A01C9,
+    0x80003,
+    0x424001,
+    0x404880,
+    0x4E0839,
+    0x480190,
+    0x424001,
+    0x404880,
+    0x568009,
+    0x880000000,
+    0x44100,
+    0x200810,
+    0xC0814,
+    0xC01A0,
+    0x480190,
+    0x424001,
+    0x404880,
+    0x4E01C9,
+    0x880000000,
+    0x12C040,
+    0x44100,
+    0xC0814,
+    0x480190,
+    0x424001,
+    0x466009,
+    0x404880,
+    0x480190,
+    0x424001,
+    0x20003,
+    0x25020,
+    0x404880,
+    0x568009,
+    0x48005,
+    0x4C04,
+    0x480190,
+    0x424001,
+    0x200810,
+    0x4C04,
+    0xC8819,
+    0x568009,
+    0x480190,
+    0x424001,
+    0x20003,
+    0xC8905,
+    0x48005,
+    0x20A6981,
+    0x4C04,
+    0xC8819,
+    0x568009,
+    0x480190,
+    0x424001,
+    0x20003,
+    0x4C04,
+    0x123114,
+    0xC8819,
+    0x568009,
+    0x2A0915,
+    0x480190,
+    0x424001,
+    0x10481A,
+    0x200810,
+    0xC0814,
+    0x568009,
+    0x480190,
+    0x424001,
+    0x10481A,
+    0x200810,
+    0x4C04,
+    0xC8819,
+    0x568009,
+    0x480190,
+    0x424001,
+    0x12C040,
+    0x4C04,
+    0x4E01C9,
+    0x400801,
+    0x480190,
+    0x424001,
+    0x26014,
+    0x5090,
+    0xA6080,
+    0x4C0010,
+    0x424001,
+    0x26014,
+    0xC0011,
+    0x2018,
+    0x1C4080,
+    0x424001,
+    0x406008,
+    0x66944,
+    0x108000,
+    0x480190,
+    0x424001,
+    0x20914,
+    0xA01C0,
+    0x41801,
+    0x424001,
+    0x466009,
+    0x4E0839,
+    0x568009,
+    0x464001,
+    0x4E01C9,
+    0xA0090,
+    0x424001,
+    0x4E0839,
+    0xE4410,
+    0x2A0915,
+    0x424001,
+    0x186124,
+    0x86101,
+    0xA8901,
+    0x4E01C9,
+    0xE4410,
+    0x2A0915,
+    0x424001,
+    0x80830,
+    0x86101,
+    0xA8901,
+    0xA6911,
+    0xA01C0,
+    0xE4410,
+    0x2A0915,
+    0x424001,
+    0x10481A,
+    0x4E0839,
+    0xE4410,
+    0x2A0915,
+    0x424001,
+    0x10481A,
+    0x82130,
+    0x186124,
+    0x86101,
+    0x4E01C9,
+    0xE4410,
+    0x2A0915,
+    0x424001,
+    0x10481A,
+    0x82130,
+    0x80830,
+    0x86101,
+    0xA6911,
+    0xA01C0,
+    0xE4410,
+    0x2A0915,
+    0x424001,
+    0x99,
+    0x4E0839,
+    0xE010,
+    0x424001,
+    0x99,
+    0xE010,
+    0x4E01C9,
+    0x424001,
+    0x99,
+    0x80830,
+    0xE010,
+    0xA01C0,
+    0x424001,
+    0x138819,
+    0x568009,
+    0x424001,
+    0x466009,
+    0x138819,
+    0x4C6D15,
+    0x424001,
+    0x20914,
+    0x8059,
+    0x424001,
+    0x20914,
+    0x444D14,
+    0x8059,
+    0x424001,
+    0x2091C,
+    0x148800,
+    0xA01C0,
+    0x424001,
+    0x4E0839,
+    0x6840,
+    0x424001,
+    0x6840,
+    0x4E01C9,
+    0x424001,
+    0x80830,
+    0x6840,
+    0xA01C0,
+    0x424001,
+    0x10481A,
+    0x4E0839,
+    0x6840,
+    0x424001,
+    0x10481A,
+    0x6840,
+    0x4E01C9,
+    0x424001,
+    0x10481A,
+    0x80830,
+    0x6840,
+    0xA01C0,
+    0x424001,
+    0x20003,
+    0x4E0839,
+    0x6840,
+    0x49001,
+    0x424001,
+    0x20003,
+    0x6840,
+    0x49001,
+    0x4E01C9,
+    0x424001,
+    0x20003,
+    0x10481A,
+    0x4E0839,
+    0x6840,
+    0x424001,
+    0x20003,
+    0x10481A,
+    0x6840,
+    0x4E01C9,
+    0x424001,
+    0x6840,
+    0x4E01C9,
+    0x150950,
+    0x424001,
+    0x99,
+    0x86101,
+    0xA8901,
+    0x4E01C9,
+    0xE4410,
+    0x1E6314,
+    0x484000,
+    0x2A0915,
+    0x424001,
+    0x10481A,
+    0x82130,
+    0x99,
+    0x86101,
+    0x4E01C9,
+    0xE4410,
+    0x1E6314,
+    0x484000,
+    0x2A0915,
+    0x424001,
+    0x10481A,
+    0x4E0839,
+    0xE4410,
+    0x2A0915,
+    0x424001,
+    0x10481A,
+    0x4E01C9,
+    0xE4410,
+    0x2A0915,
+    0x424001,
+    0x10481A,
+    0x80830,
+    0xA01C0,
+    0xE4410,
+    0x2A0915,
+    0x424001,
+    0x20003,
+    0x99,
+    0x49001,
+    0x4E01C9,
+    0x484000,
+    0x424001,
+    0x20003,
+    0x10481A,
+    0x4E0839,
+    0x49001,
+    0x424001,
+    0x20003,
+    0x10481A,
+    0x49001,
+    0x4E01C9,
+    0x424001,
+    0x466009,
+    0x20A6981,
+    0xE4410,
+    0x424001,
+    0x20A6981,
+    0xE4410,
+    0x568009,
+    0x424001,
+    0xA8910,
+    0x568009,
+    0x424001,
+    0x466009,
+    0xA8910,
+    0x424001,
+    0x40089,
+    0x10481A,
+    0x4E0839,
+    0x424001,
+    0x40089,
+    0x10481A,
+    0x4E01C9,
+    0x424001,
+    0x40089,
+    0x4E0839,
+    0xA8910,
+    0x424001,
+    0x40089,
+    0x4E01C9,
+    0xA8910,
+    0x424001,
+    0x40089,
+    0x99,
+    0x4E01C9,
+    0xA8910,
+    0x484000,
+    0x424001,
+    0x84018,
+    0x4E01C9,
+    0xC1010,
+    0x424001,
+    0x20003,
+    0x568009,
+    0x424001,
+    0x20003,
+    0x466009,
+    0x424001,
+    0x86314,
+    0x86101,
+    0xA8901,
+    0x4E01C9,
+    0xE4410,
+    0x80901,
+    0x2A0915,
+    0x424001,
+    0x10481A,
+    0x82130,
+    0x86314,
+    0x86101,
+    0x4E01C9,
+    0xE4410,
+    0x80901,
+    0x2A0915,
+    0x424001,
+    0x86316,
+    0x280316,
+    0x99,
+    0xB141,
+    0x86101,
+    0x4E01C9,
+    0x80901,
+    0x484000,
+    0x424001,
+    0x99,
+    0x86314,
+    0x86101,
+    0x4E01C9,
+    0xE4410,
+    0x3E0314,
+    0x80901,
+    0x484000,
+    0x2A0915,
+    0x424001,
+    0x10481A,
+    0x82130,
+    0x99,
+    0x86314,
+    0x86101,
+    0x4E01C9,
+    0xE4410,
+    0x3E0314,
+    0x80901,
+    0x484000,
+    0x2A0915,
+    0x424001,
+    0x4E0839,
+    0x80901,
+    0x424001,
+    0x4E01C9,
+    0x80901,
+    0x424001,
+    0x10481A,
+    0x4E0839,
+    0x80901,
+    0x424001,
+    0x10481A,
+    0x4E01C9,
+    0x80901,
+    0x424001,
+    0xC07,
+    0x7109,
+    0x4E0839,
+    0x424001,
+    0xC07,
+    0x7109,
+    0x4E01C9,
+    0x424001,
+    0x20003,
+    0xC07,
+    0x7109,
+    0x4E0839,
+    0x424001,
+    0x20003,
+    0xC07,
+    0x7109,
+    0x4E01C9,
+    0x424001,
+    0xC0011,
+    0xA6080,
+    0x1C4080,
+    0x4C0010,
+    0x424001,
+    0xC0011,
+    0xA6080,
+    0x1C4080,
+    0x4C0010,
+    0x424001,
+    0x4480,
+    0xA6080,
+    0x4C0010,
+    0x424001,
+    0xC0011,
+    0x4480,
+    0xA6080,
+    0x424001,
+    0xC0011,
+    0x4480,
+    0x1C4080,
+    0x424001,
+    0x4480,
+    0x1C4080,
+    0x4C0010,
+    0x424001,
+    0xC0011,
+    0xA6080,
+    0x4C0010,
+    0x424001,
+    0xC0011,
+    0xA6080,
+    0x1C4080,
+    0x424001,
+    0xC0011,
+    0x1C4080,
+    0x4C0010,
+    0x424001,
+    0xA6080,
+    0x1C4080,
+    0x4C0010,
+    0x66144,
+    0x6949,
+    0x2961,
+    0x62140,
+    0x66144,
+    0x6949,
+    0x2961,
+    0x62140,
+    0x424001,
+    0x66144,
+    0xC0011,
+    0xA6080,
+    0x1C4080,
+    0x424001,
+    0x66144,
+    0xC0011,
+    0xA6080,
+    0x1C4080,
+    0x424001,
+    0x66144,
+    0x6949,
+    0xC0011,
+    0x2961,
+    0xA6080,
+    0x424001,
+    0x66144,
+    0x6949,
+    0xC0011,
+    0x62140,
+    0x1C4080,
+    0x424001,
+    0x66144,
+    0xC0011,
+    0xA6080,
+    0x4C0010,
+    0x424001,
+    0x66144,
+    0xC0011,
+    0xA6080,
+    0x4C0010,
+    0x424001,
+    0x10A091C,
+    0x8E140,
+    0xA01C0,
+    0x600011,
+    0x424001,
+    0x322144,
+    0xA01C0,
+    0x108000,
+    0x8E140,
+    0x4E01C9,
+    0x82090,
+    0x568009,
+    0x424001,
+    0x322144,
+    0x406008,
+    0xA01C0,
+    0x466009,
+    0x8E140,
+    0x4E01C9,
+    0x82090,
+    0x424001,
+    0x322144,
+    0x466009,
+    0x4E0839,
+    0x8E140,
+    0x82090,
+    0x424001,
+    0x322144,
+    0x466009,
+    0x8E140,
+    0x4E01C9,
+    0x82090,
+    0x20005,
+    0x424001,
+    0x444D14,
+    0xA01C0,
+    0x40118,
+    0x4C6D15,
+    0x20005,
+    0x424001,
+    0x80830,
+    0x40118,
+    0x4C6D15,
+    0x20005,
+    0x424001,
+    0x8C000,
+    0x4C6D15,
+    0x20005,
+    0x424001,
+    0x85002,
+    0x20005,
+    0x424001,
+    0x444D14,
+    0x143100,
+    0x8C000,
+    0x4C6D15,
+    0x20005,
+    0x424001,
+    0x148800,
+    0x8C000,
+    0x424001,
+    0x444D14,
+    0x424810,
+    0xA01C0,
+    0x161915,
+    0x4C6D15,
+    0x424001,
+    0x80830,
+    0x424810,
+    0x161915,
+    0x4C6D15,
+    0x424001,
+    0x20914,
+    0x4481C,
+    0x424001,
+    0x20914,
+    0x444D14,
+    0x4481C,
+    0x204013,
+    0x424001,
+    0x4E0839,
+    0x4E01C9,
+    0xE4080,
+    0x204013,
+    0x424001,
+    0x4E0839,
+    0x4E01C9,
+    0xE4080,
+    0x204013,
+    0x424001,
+    0x4E0839,
+    0x4E01C9,
+    0xE4080,
+    0x424001,
+    0x404812,
+    0x148800,
+    0x4E01C9,
+    0x424001,
+    0x404812,
+    0x4E0839,
+    0x148800,
+    0x424001,
+    0x4E01C9,
+    0x1A40C0,
+    0x424001,
+    0x20914,
+    0x80830,
+    0xA01C0,
+    0x41801,
+    0x1A40C0,
+    0x424001,
+    0x20914,
+    0x99,
+    0x41801,
+    0x484000,
+    0x568009,
+    0x20003,
+    0x406008,
+    0x2E081,
+    0x80830,
+    0xA01C0,
+    0x108000,
+    0x20003,
+    0x406008,
+    0x2E081,
+    0x80830,
+    0xA01C0,
+    0x108000,
+    0x20003,
+    0x406008,
+    0x2E081,
+    0x80830,
+    0xA01C0,
+    0x108000,
+    0x20003,
+    0x406008,
+    0x2E081,
+    0x80830,
+    0xA01C0,
+    0x108000,
+    0x20003,
+    0x2E081,
+    0x80830,
+    0xA01C0,
+    0x108000,
+    0x20003,
+    0x406008,
+    0x2E081,
+    0xA01C0,
+    0x108000,
+    0x20003,
+    0x406008,
+    0x2E081,
+    0x80830,
+    0xA01C0,
+    0x20003,
+    0x406008,
+    0x2E081,
+    0x80830,
+    0x108000,
+    0x20003,
+    0x20003,
+    0x2E081,
+    0x4E0839,
+    0x108000,
+    0x20003,
+    0x20003,
+    0x2E081,
+    0x4E01C9,
+    0x108000,
+    0x20003,
+    0x20003,
+    0x2E081,
+    0xA01C0,
+    0x568009,
+    0x20003,
+    0x20003,
+    0x466009,
+    0x2E081,
+    0xA01C0,
+    0x20003,
+    0x20003,
+    0x406008,
+    0x2E081,
+    0x4E0839,
+    0x20003,
+    0x20003,
+    0x406008,
+    0x2E081,
+    0x4E01C9,
+    0x20003,
+    0x20003,
+    0x2E081,
+    0x80830,
+    0x568009,
+    0x20003,
+    0x20003,
+    0x466009,
+    0x2E081,
+    0x80830,
+    0x20003,
+    0x20003,
+    0x2E081,
+    0x4E0839,
+    0x108000,
+    0x20003,
+    0x20003,
+    0x2E081,
+    0x4E01C9,
+    0x108000,
+    0x20003,
+    0x20003,
+    0x2E081,
+    0xA01C0,
+    0x568009,
+    0x20003,
+    0x20003,
+    0x466009,
+    0x2E081,
+    0xA01C0,
+    0x20003,
+    0x20003,
+    0x406008,
+    0x2E081,
+    0x4E0839,
+    0x20003,
+    0x20003,
+    0x406008,
+    0x2E081,
+    0x4E01C9,
+    0x20003,
+    0x20003,
+    0x2E081,
+    0x80830,
+    0x568009,
+    0x20003,
+    0x20003,
+    0x466009,
+    0x2E081,
+    0x80830,
+    0x204013,
+    0x20003,
+    0x406008,
+    0x2E081,
+    0x4E0839,
+    0x108000,
+    0x20003,
+    0x4011A,
+    0x2E081,
+    0x80830,
+    0xA01C0,
+    0x568009,
+    0x204013,
+    0x20003,
+    0x406008,
+    0x2E081,
+    0x4E01C9,
+    0x108000,
+    0x20003,
+    0x4011A,
+    0x466009,
+    0x2E081,
+    0x80830,
+    0xA01C0,
+    0x204013,
+    0x20003,
+    0x2E081,
+    0x4E0839,
+    0x4E01C9,
+    0x108000,
+    0x204013,
+    0x20003,
+    0x406008,
+    0x2E081,
+    0x4E0839,
+    0x4E01C9,
+    0x204013,
+    0x20003,
+    0x2E081,
+    0x4E0839,
+    0x4E01C9,
+    0x108000,
+    0x204013,
+    0x20003,
+    0x406008,
+    0x2E081,
+    0x4E0839,
+    0x4E01C9,
+    0x204013,
+    0x20003,
+    0x40089,
+    0x2E081,
+    0x4E0839,
+    0x6840,
+    0x108000,
+    0x20003,
+    0x404812,
+    0x40089,
+    0x406008,
+    0x2E081,
+    0x4E0839,
+    0x6840,
+    0x204013,
+    0x20003,
+    0x40089,
+    0x2E081,
+    0x6840,
+    0x4E01C9,
+    0x108000,
+    0x20003,
+    0x404812,
+    0x40089,
+    0x406008,
+    0x2E081,
+    0x6840,
+    0x4E01C9,
+    0x20003,
+    0x4011A,
+    0x466009,
+    0x2E081,
+    0x80830,
+    0xA01C0,
+    0x568009,
+    0x20003,
+    0x4011A,
+    0x466009,
+    0x2E081,
+    0x80830,
+    0xA01C0,
+    0x568009,
+    0x424001,
+    0x10481A,
+    0x99,
+    0xA01C0,
+    0x126018,
+    0x204013,
+    0x424001,
+    0x150811,
+    0x4E01C9,
+    0x42140,
+    0x204013,
+    0x424001,
+    0xAC011,
+    0x4E01C9,
+    0x80918,
+    0x204013,
+    0x424001,
+    0x4E0839,
+    0xAC011,
+    0x80918,
+    0x204013,
+    0x424001,
+    0xAC011,
+    0x4E01C9,
+    0x80918,
+    0x204013,
+    0xC5801,
+    0x424001,
+    0x110811,
+    0x4E01C9,
+    0x204013,
+    0x424001,
+    0x4E0839,
+    0x40810,
+    0x82081,
+    0x424001,
+    0x4E0839,
+    0x40810,
+    0x82081,
+    0x1A40C0,
+    0x204013,
+    0x424001,
+    0xA0051,
+    0x4E01C9,
+    0x82081,
+    0x204013,
+    0x424001,
+    0x4E01C9,
+    0x1C0012,
+    0x424001,
+    0x4E0839,
+    0x1C0012,
+    0x1A40C0,
+    0x204013,
+    0x424001,
+    0x4E0839,
+    0x1E8010,
+    0x401A0,
+    0x80830,
+    0x80901,
+    0x401A0,
+    0xA01C0,
+    0x80901,
+    0x401A0,
+    0x80901,
+    0x108000,
+    0x406008,
+    0x401A0,
+    0x80901,
+    0x424001,
+    0x424099,
+    0x4E0839,
+    0x41801,
+    0xA2951,
+    0x424001,
+    0x424099,
+    0x41801,
+    0xA2951,
+    0x568009,
+    0x424001,
+    0x424099,
+    0x4E01C9,
+    0x41801,
+    0xA2951,
+    0x424001,
+    0x424099,
+    0x466009,
+    0x41801,
+    0xA2951,
+    0x424001,
+    0x424099,
+    0x4E0839,
+    0x101118,
+    0xA2951,
+    0x424001,
+    0x424099,
+    0x101118,
+    0xA2951,
+    0x568009,
+    0x424001,
+    0x424099,
+    0x101118,
+    0x4E01C9,
+    0xA2951,
+    0x424001,
+    0x424099,
+    0x466009,
+    0x101118,
+    0xA2951,
+    0x424001,
+    0x424099,
+    0x20851,
+    0x4E0839,
+    0xA2951,
+    0x424001,
+    0x424099,
+    0x20851,
+    0xA2951,
+    0x568009,
+    0x424001,
+    0x424099,
+    0x20851,
+    0x4E01C9,
+    0xA2951,
+    0x424001,
+    0x424099,
+    0x466009,
+    0x20851,
+    0xA2951,
+    0x424001,
+    0x424099,
+    0x1B0911,
+    0x4E0839,
+    0x41801,
+    0x424001,
+    0x424099,
+    0x1B0911,
+    0x41801,
+    0x568009,
+    0x424001,
+    0x424099,
+    0x1B0911,
+    0x4E01C9,
+    0x41801,
+    0x424001,
+    0x424099,
+    0x466009,
+    0x1B0911,
+    0x41801,
+    0x424001,
+    0x424099,
+    0x1B0911,
+    0x4E0839,
+    0x424001,
+    0x424099,
+    0x1B0911,
+    0x568009,
+    0x424001,
+    0x424099,
+    0x1B0911,
+    0x4E01C9,
+    0x424001,
+    0x424099,
+    0x466009,
+    0x1B0911,
+    0x424001,
+    0x424099,
+    0x1B0911,
+    0x1200091,
+    0x4E0839,
+    0x424001,
+    0x424099,
+    0x1B0911,
+    0x1200091,
+    0x568009,
+    0x424001,
+    0x424099,
+    0x1B0911,
+    0x1200091,
+    0x4E01C9,
+    0x424001,
+    0x424099,
+    0x466009,
+    0x1B0911,
+    0x1200091,
+    0x424001,
+    0x424099,
+    0x1B0911,
+    0x1200091,
+    0x20851,
+    0x4E0839,
+    0x424001,
+    0x424099,
+    0x1B0911,
+    0x1200091,
+    0x20851,
+    0x568009,
+    0x424001,
+    0x424099,
+    0x1B0911,
+    0x1200091,
+    0x20851,
+    0x4E01C9,
+    0x424001,
+    0x424099,
+    0x466009,
+    0x1B0911,
+    0x1200091,
+    0x20851,
+    0x424001,
+    0x99,
+    0x4E0839,
+    0x426001,
+    0xC00A1,
+    0xA2951,
+    0x424001,
+    0x99,
+    0x426001,
+    0xC00A1,
+    0xA2951,
+    0x568009,
+    0x424001,
+    0x99,
+    0x426001,
+    0x4E01C9,
+    0xC00A1,
+    0xA2951,
+    0x424001,
+    0x466009,
+    0x99,
+    0x426001,
+    0xC00A1,
+    0xA2951,
+    0x424001,
+    0x99,
+    0x4E0839,
+    0x101118,
+    0xC00A1,
+    0xA2951,
+    0x424001,
+    0x99,
+    0x101118,
+    0xC00A1,
+    0xA2951,
+    0x568009,
+    0x424001,
+    0x99,
+    0x101118,
+    0x4E01C9,
+    0xC00A1,
+    0xA2951,
+    0x424001,
+    0x466009,
+    0x99,
+    0x101118,
+    0xC00A1,
+    0xA2951,
+    0x424001,
+    0x480A,
+    0x99,
+    0x4E0839,
+    0xC00A1,
+    0xA2951,
+    0x424001,
+    0x480A,
+    0x99,
+    0xC00A1,
+    0xA2951,
+    0x568009,
+    0x424001,
+    0x480A,
+    0x99,
+    0x4E01C9,
+    0xC00A1,
+    0xA2951,
+    0x424001,
+    0x480A,
+    0x466009,
+    0x99,
+    0xC00A1,
+    0xA2951,
+    0x424001,
+    0x99,
+    0x1200091,
+    0x4E0839,
+    0xC00A1,
+    0xA2951,
+    0x424001,
+    0x99,
+    0x1200091,
+    0xC00A1,
+    0xA2951,
+    0x568009,
+    0x424001,
+    0x99,
+    0x1200091,
+    0x4E01C9,
+    0xC00A1,
+    0xA2951,
+    0x424001,
+    0x466009,
+    0x99,
+    0x1200091,
+    0xC00A1,
+    0xA2951,
+    0x424001,
+    0x99,
+    0x1200091,
+    0x4E0839,
+    0xC00A1,
+    0xA2951,
+    0x1220010,
+    0x424001,
+    0x99,
+    0x1200091,
+    0xC00A1,
+    0xA2951,
+    0x568009,
+    0x1220010,
+    0x424001,
+    0x99,
+    0x1200091,
+    0x4E01C9,
+    0xC00A1,
+    0xA2951,
+    0x1220010,
+    0x424001,
+    0x466009,
+    0x99,
+    0x1200091,
+    0xC00A1,
+    0xA2951,
+    0x1220010,
+    0x424001,
+    0x22170,
+    0x4E0839,
+    0xCC000,
+    0x424001,
+    0x22170,
+    0xCC000,
+    0x568009,
+    0x424001,
+    0x22170,
+    0xCC000,
+    0x4E01C9,
+    0x424001,
+    0x466009,
+    0x22170,
+    0xCC000,
+    0x424001,
+    0x4E0839,
+    0x170019,
+    0x424001,
+    0x170019,
+    0x568009,
+    0x424001,
+    0x4E01C9,
+    0x170019,
+    0x424001,
+    0x466009,
+    0x170019,
+    0x424001,
+    0x6D01C,
+    0x4E0839,
+    0x424001,
+    0x6D01C,
+    0x568009,
+    0x424001,
+    0x6D01C,
+    0x4E01C9,
+    0x424001,
+    0x6D01C,
+    0x466009,
+    0x424001,
+    0x6D01C,
+    0x1200091,
+    0x4E0839,
+    0x424001,
+    0x6D01C,
+    0x1200091,
+    0x568009,
+    0x424001,
+    0x6D01C,
+    0x1200091,
+    0x4E01C9,
+    0x424001,
+    0x6D01C,
+    0x466009,
+    0x1200091,
+    0x424001,
+    0x1200091,
+    0x4E0839,
+    0x424001,
+    0x1200091,
+    0x568009,
+    0x424001,
+    0x1200091,
+    0x4E01C9,
+    0x424001,
+    0x466009,
+    0x1200091,
+    0x424001,
+    0x4E0839,
+    0x42001,
+    0x60130,
+    0x424001,
+    0x42001,
+    0x60130,
+    0x568009,
+    0x424001,
+    0x4E01C9,
+    0x42001,
+    0x60130,
+    0x424001,
+    0x466009,
+    0x42001,
+    0x60130,
+    0x424001,
+    0xA6080,
+    0x42001,
+    0x60130,
+    0x4C0010,
+    0x424001,
+    0xC0011,
+    0xA6080,
+    0x42001,
+    0x60130,
+    0x424001,
+    0xC0011,
+    0x42001,
+    0x60130,
+    0x1C4080,
+    0x424001,
+    0x42001,
+    0x60130,
+    0x1C4080,
+    0x4C0010,
+    0x424001,
+    0x80830,
+    0xA01C0,
+    0x42001,
+    0x60130,
+    0x424001,
+    0x406008,
+    0x42001,
+    0x60130,
+    0x108000,
+    0x424001,
+    0x20003,
+    0x99,
+    0x4E0839,
+    0x809C0,
+    0x400118,
+    0x424001,
+    0x20003,
+    0x99,
+    0x809C0,
+    0x568009,
+    0x400118,
+    0x424001,
+    0x20003,
+    0x99,
+    0x809C0,
+    0x4E01C9,
+    0x400118,
+    0x424001,
+    0x20003,
+    0x466009,
+    0x99,
+    0x809C0,
+    0x400118,
+    0x424001,
+    0x20003,
+    0x99,
+    0x809C0,
+    0xA6080,
+    0x4C0010,
+    0x400118,
+    0x424001,
+    0x20003,
+    0xC0011,
+    0x99,
+    0x809C0,
+    0xA6080,
+    0x400118,
+    0x424001,
+    0x20003,
+    0xC0011,
+    0x99,
+    0x809C0,
+    0x1C4080,
+    0x400118,
+    0x424001,
+    0x20003,
+    0x99,
+    0x809C0,
+    0x1C4080,
+    0x4C0010,
+    0x400118,
+    0x424001,
+    0x20003,
+    0x99,
+    0x4E0839,
+    0x400118,
+    0x424001,
+    0x20003,
+    0x99,
+    0x568009,
+    0x400118,
+    0x424001,
+    0x20003,
+    0x99,
+    0x4E01C9,
+    0x400118,
+    0x424001,
+    0x20003,
+    0x466009,
+    0x99,
+    0x400118,
+    0x424001,
+    0x20003,
+    0x99,
+    0xA6080,
+    0x4C0010,
+    0x400118,
+    0x424001,
+    0x20003,
+    0xC0011,
+    0x99,
+    0xA6080,
+    0x400118,
+    0x424001,
+    0x20003,
+    0xC0011,
+    0x99,
+    0x1C4080,
+    0x400118,
+    0x424001,
+    0x20003,
+    0x99,
+    0x1C4080,
+    0x4C0010,
+    0x400118,
+    0x424001,
+    0x20003,
+    0x99,
+    0x4E0839,
+    0x101118,
+    0x400118,
+    0x424001,
+    0x20003,
+    0x99,
+    0x101118,
+    0x568009,
+    0x400118,
+    0x424001,
+    0x20003,
+    0x99,
+    0x101118,
+    0x4E01C9,
+    0x400118,
+    0x424001,
+    0x20003,
+    0x466009,
+    0x99,
+    0x101118,
+    0x400118,
+    0x424001,
+    0x20003,
+    0x99,
+    0x101118,
+    0xA6080,
+    0x4C0010,
+    0x400118,
+    0x424001,
+    0x20003,
+    0xC0011,
+    0x99,
+    0x101118,
+    0xA6080,
+    0x400118,
+    0x424001,
+    0x20003,
+    0xC0011,
+    0x99,
+    0x101118,
+    0x1C4080,
+    0x400118,
+    0x424001,
+    0x20003,
+    0x99,
+    0x101118,
+    0x1C4080,
+    0x4C0010,
+    0x400118,
+    0x424001,
+    0x20003,
+    0x99,
+    0x1200091,
+    0x4E0839,
+    0x400118,
+    0x424001,
+    0x20003,
+    0x99,
+    0x1200091,
+    0x568009,
+    0x400118,
+    0x424001,
+    0x20003,
+    0x99,
+    0x1200091,
+    0x4E01C9,
+    0x400118,
+    0x424001,
+    0x20003,
+    0x466009,
+    0x99,
+    0x1200091,
+    0x400118,
+    0x424001,
+    0x20003,
+    0x99,
+    0x1200091,
+    0xA6080,
+    0x4C0010,
+    0x400118,
+    0x424001,
+    0x20003,
+    0xC0011,
+    0x99,
+    0x1200091,
+    0xA6080,
+    0x400118,
+    0x424001,
+    0x20003,
+    0xC0011,
+    0x99,
+    0x1200091,
+    0x1C4080,
+    0x400118,
+    0x424001,
+    0x20003,
+    0x99,
+    0x1200091,
+    0x1C4080,
+    0x4C0010,
+    0x400118,
+    0x424001,
+    0x20003,
+    0x99,
+    0x1200091,
+    0x4E0839,
+    0x1220010,
+    0x400118,
+    0x424001,
+    0x20003,
+    0x99,
+    0x1200091,
+    0x568009,
+    0x1220010,
+    0x400118,
+    0x424001,
+    0x20003,
+    0x99,
+    0x1200091,
+    0x4E01C9,
+    0x1220010,
+    0x400118,
+    0x424001,
+    0x20003,
+    0x466009,
+    0x99,
+    0x1200091,
+    0x1220010,
+    0x400118,
+    0x424001,
+    0x20003,
+    0x99,
+    0x1200091,
+    0xA6080,
+    0x1220010,
+    0x4C0010,
+    0x400118,
+    0x424001,
+    0x20003,
+    0xC0011,
+    0x99,
+    0x1200091,
+    0xA6080,
+    0x1220010,
+    0x400118,
+    0x424001,
+    0x20003,
+    0xC0011,
+    0x99,
+    0x1200091,
+    0x1C4080,
+    0x1220010,
+    0x400118,
+    0x424001,
+    0x20003,
+    0x99,
+    0x1200091,
+    0x1C4080,
+    0x1220010,
+    0x4C0010,
+    0x400118,
+    0x424099,
+    0x4E0839,
+    0xA2951,
+    0x424099,
+    0xA2951,
+    0x568009,
+    0x424099,
+    0x4E01C9,
+    0xA2951,
+    0x424099,
+    0x466009,
+    0xA2951,
+    0x424001,
+    0x424099,
+    0x4E0839,
+    0xA2951,
+    0x480190,
+    0x482180,
+    0x424001,
+    0x424099,
+    0xA2951,
+    0x568009,
+    0x480190,
+    0x482180,
+    0x424001,
+    0x424099,
+    0x4E01C9,
+    0xA2951,
+    0x480190,
+    0x482180,
+    0x424001,
+    0x424099,
+    0x466009,
+    0xA2951,
+    0x480190,
+    0x482180,
+    0x424001,
+    0x4E0839,
+    0x8609C,
+    0x80901,
+    0x424001,
+    0x8609C,
+    0x80901,
+    0x568009,
+    0x424001,
+    0x8609C,
+    0x4E01C9,
+    0x80901,
+    0x424001,
+    0x466009,
+    0x8609C,
+    0x80901,
+    0x424001,
+    0x1200091,
+    0x6010,
+    0xC00A1,
+    0x480188,
+    0x424001,
+    0x1200091,
+    0xC00A1,
+    0xE0188,
+    0x484000,
+    0x480188,
+    0x424001,
+    0x8A1,
+    0x1200091,
+    0x6010,
+    0xC00A1,
+    0x480188,
+    0x424001,
+    0x1200091,
+    0x6010,
+    0xC00A1,
+    0xA0188,
+    0x480188,
+    0x424001,
+    0x85002,
+    0x4E0839,
+    0x40099,
+    0x480190,
+    0x424001,
+    0x85002,
+    0x4E01C9,
+    0x40099,
+    0x480190,
+    0x424001,
+    0x4E0839,
+    0x40099,
+    0x8C000,
+    0x480190,
+    0x424001,
+    0x4E01C9,
+    0x40099,
+    0x8C000,
+    0x480190,
+    0x424001,
+    0x80830,
+    0x4E0839,
+    0x40099,
+    0x480190,
+    0x424001,
+    0xA01C0,
+    0x4E01C9,
+    0x40099,
+    0x480190,
+    0x424001,
+    0x4E0839,
+    0xA01C0,
+    0x40099,
+    0x480190,
+    0x424001,
+    0x80830,
+    0x4E01C9,
+    0x40099,
+    0x480190,
+    0x424001,
+    0x407,
+    0x4E0839,
+    0x444099,
+    0x80918,
+    0x480190,
+    0x424001,
+    0x407,
+    0x4E01C9,
+    0x444099,
+    0x80918,
+    0x480190,
+    0x424001,
+    0xA6020,
+    0x4E0839,
+    0x444099,
+    0x80918,
+    0x480190,
+    0x424001,
+    0xA6020,
+    0x4E01C9,
+    0x444099,
+    0x80918,
+    0x480190,
+    0x424001,
+    0x6010,
+    0xC00A1,
+    0x480190,
+    0x480188,
+    0x424001,
+    0xC00A1,
+    0xE0188,
+    0x484000,
+    0x480190,
+    0x480188,
+    0x424001,
+    0xA6080,
+    0x8E140,
+    0x82090,
+    0x568009,
+    0x4C0010,
+    0x424001,
+    0x322144,
+    0x8E140,
+    0x4E01C9,
+    0x1C4080,
+    0x82090,
+    0x4C0010,
+    0x424001,
+    0x4480,
+    0x424810,
+    0x4E01C9,
+    0x424001,
+    0x20003,
+    0xC07,
+    0x466009,
+    0x424001,
+    0x4E0839,
+    0x282151,
+    0x170019,
+    0x424001,
+    0x282151,
+    0x170019,
+    0x568009,
+    0x424001,
+    0x282151,
+    0x4E01C9,
+    0x170019,
+    0x424001,
+    0x466009,
+    0x282151,
+    0x170019,
+    0x424001,
+    0x20003,
+    0xA6080,
+    0x4C0010,
+    0x424001,
+    0x20003,
+    0xC0011,
+    0xA6080,
+    0x424001,
+    0x20003,
+    0xC0011,
+    0x1C4080,
+    0x424001,
+    0x20003,
+    0x1C4080,
+    0x4C0010,
+    0x424001,
+    0x466009,
+    0x4E0839,
+    0x424001,
+    0x466009,
+    0x4E01C9,
+    0x424001,
+    0x4E0839,
+    0x6840,
+    0x224010,
+    0x4E01C9,
+    0x2E081,
+    0x4E0839,
+    0x6840,
+    0x224010,
+    0x4E01C9,
+    0x204013,
+    0x2E081,
+    0x4E0839,
+    0x6840,
+    0x4E01C9,
+    0xE4080,
+    0x204013,
+    0x2E081,
+    0x4E0839,
+    0x6840,
+    0x4E01C9,
+    0xE4080,
+    0x204013,
+    0x2E081,
+    0x4E0839,
+    0x6840,
+    0x4E01C9,
+    0xE4080,
+    0x204013,
+    0x2E081,
+    0x4E0839,
+    0x6840,
+    0x4E01C9,
+    0xE4080,
+    0x424001,
+    0x6840,
+    0x4E01C9,
+    0x1A40C0,
+    0x424001,
+    0x10481A,
+    0x6840,
+    0x4E01C9,
+    0x40881,
+    0x424001,
+    0x8A018,
+    0x80830,
+    0x4812,
+    0x6840,
+    0xA01C0,
+    0x24809,
+    0x1007010,
+    0x4C010,
+    0x140008,
+    0x14401C,
+    0xFFFFFFFFFFFFFFFF,
+    0x42140,
+    0x82014,
+    0x42140,
+    0x1122014,
+    0x8050,
+    0x8042,
+    0x10E008,
+    0x80014,
+    0x60180,
+    0x20901,
+    0x18A000,
+    0x42140,
+    0xE2950,
+    0x1122014,
+    0x42140,
+    0x506400,
+    0x1002004,
+    0x1122014,
+    0x1008200,
+    0x1002010,
+    0x1102001,
+    0x23112,
+    0x42140,
+    0x1122014,
+    0x124010,
+    0x42140,
+    0x6804,
+    0xFFFFFFFFFFFFFFFF,
+    0xC4005,
+    0x22105,
+    0x42140,
+    0x20002,
+    0x2124114,
+    0x1122014,
+    0x42140,
+    0x1122014,
+    0x22025,
+    0x220B4,
+    0x42140,
+    0x1122014,
+    0x20901,
+    0x42140,
+    0x1900,
+    0x1900,
+    0x42140,
+    0x22101,
+    0x22151,
+    0x42140,
+    0xC8011,
+    0x42140,
+    0x4A181,
+    0x1122014,
+    0x128010,
+    0x42140,
+    0x408400,
+    0x420400,
+    0x406000,
+    0x42140,
+    0x60911,
+    0x402010,
+    0x40C90,
+    0x50890,
+    0x42140,
+    0x6048,
+    0x42140,
+    0x2C3111,
+    0x1122014,
+    0x120010,
+    0x124010,
+    0x42140,
+    0x8500,
+    0x86901,
+    0x42140,
+    0x7941,
+    0x42140,
+    0x1A0540,
+    0x2108D,
+    0x42140,
+    0x1122014,
+    0x23051,
+    0x100A010,
+    0xA170,
+    0x42140,
+    0x4C010,
+    0xE920,
+    0x42140,
+    0x122141,
+    0x112A041,
+    0x42140,
+    0x20001,
+    0x1E0801,
+    0x1122014,
+    0x42140,
+    0x1222181,
+    0x42140,
+    0x122501,
+    0x11C,
+    0x21C1,
+    0x42140,
+    0x1122014,
+    0x220910,
+    0x1E6100,
+    0x42140,
+    0x1122014,
+    0x4D910,
+    0x42140,
+    0x20C2581,
+    0x42140,
+    0x82050,
+    0x1122014,
+    0x2109,
+    0x128010,
+    0x42140,
+    0x20901,
+    0x42140,
+    0x1E0580,
+    0x21401,
+    0x2610C,
+    0x42140,
+    0x2022313,
+    0x83001,
+    0x42140,
+    0x1122014,
+    0x120812,
+    0x42140,
+    0x26151,
+    0x20901,
+    0x42140,
+    0x86106,
+    0x80006,
+    0x42140,
+    0x42140,
+    0x45000,
+    0x1020901,
+    0x140109,
+    0x42140,
+    0x2043,
+    0x887915,
+    0x21401,
+    0x8E100,
+    0xA4925,
+    0x10481A,
+    0x21401,
+    0x196101,
+    0x194010,
+    0x40081,
+    0xC00C1,
+    0x802,
+    0x123012,
+    0x10E008,
+    0x42140,
+    0xE4085,
+    0xAC094,
+    0x4801D0,
+    0x82014,
+    0x28010,
+    0x200000000AA014,
+    0xAA014,
+    0x42140,
+    0x6B019,
+    0x2009,
+    0x80010,
+    0xEC091,
+    0x194010,
+    0x42950,
+    0x14A8110,
+    0x8801,
+    0x80830,
+    0xE150,
+    0xEA191,
+    0xA0417,
+    0x44814,
+    0x2A011,
+    0x6A011,
+    0xEA191,
+    0x126008,
+    0x46944,
+    0xA01C0,
+    0xE0511,
+    0xE0001,
+    0x42090D,
+    0x5005,
+    0x191D,
+    0x8A018,
+    0x40100,
+    0x4815,
+    0xEC011,
+    0x1C6089,
+    0x140010,
+    0x40089,
+    0x100A090,
+    0x2000000114B190,
+    0x143100,
+    0x42140,
+    0x84008,
+    0x100820,
+    0x2C118,
+    0xCC000,
+    0x191D,
+    0x8E100,
+    0x114912,
+    0x40881,
+    0x144908,
+    0xE4410,
+    0x320950,
+    0x400485,
+    0x424029,
+    0x6804,
+    0x20000000047914,
+    0x47914,
+    0x21401,
+    0x1D6110,
+    0xE9011,
+    0x64013,
+    0x24003,
+    0x80001,
+    0x200000000C2141,
+    0x25915,
+    0x21401,
+    0x42140,
+    0x1E0818,
+    0x4808,
+    0x4A181,
+    0x182100,
+    0x4801D0,
+    0xA0417,
+    0xA4094,
+    0xE010,
+    0x170011,
+    0x80830,
+    0xE150,
+    0x40C87,
+    0x260010,
+    0x144908,
+    0x400485,
+    0xA0417,
+    0x44814,
+    0xA4094,
+    0x170011,
+    0x46944,
+    0xA01C0,
+    0x82015,
+    0xA0015,
+    0x226094,
+    0x921934,
+    0xA6804,
+    0x80081,
+    0xAE110,
+    0x42C010,
+    0x42140,
+    0x400058,
+    0x824000,
+    0x40089,
+    0x2910,
+    0x404800,
+    0x162099,
+    0x122918,
+    0x4A145,
+    0x16601C,
+    0x82015,
+    0x220051,
+    0x86010,
+    0x194417,
+    0x80507,
+    0x20017,
+    0xA0417,
+    0x1120804,
+    0x502940,
+    0xE010,
+    0x80830,
+    0xE150,
+    0x20017,
+    0xA0417,
+    0x44814,
+    0x1120804,
+    0x502940,
+    0x46944,
+    0xA01C0,
+    0x40089,
+    0x100A090,
+    0x22553,
+    0x100A090,
+    0x6000,
+    0x40089,
+    0x120170,
+    0x40089,
+    0x2010,
+    0x40089,
+    0x1010,
+    0x20003,
+    0x40089,
+    0x20A6981,
+    0x2910,
+    0x196101,
+    0x10481A,
+    0x2910,
+    0x2A0915,
+    0x10481A,
+    0x2910,
+    0x404800,
+    0xEC091,
+    0x80830,
+    0x194010,
+    0x42950,
+    0xE1001,
+    0x5005,
+    0x21401,
+    0x196101,
+    0x1A2018,
+    0xEC091,
+    0x194010,
+    0xA01C0,
+    0x42950,
+    0xE1001,
+    0x5005,
+    0x21401,
+    0x196101,
+    0xEC091,
+    0x404800,
+    0x194010,
+    0xA01C0,
+    0x5005,
+    0x21401,
+    0x196101,
+    0x42950,
+    0x5005,
+    0x1C0,
+    0x21401,
+    0x196101,
+    0x260018,
+    0x42950,
+    0x10481A,
+    0x80830,
+    0x21401,
+    0x196101,
+    0x194010,
+    0xE1001,
+    0x5005,
+    0x1A2018,
+    0x10481A,
+    0x21401,
+    0x196101,
+    0x194010,
+    0xA01C0,
+    0xE1001,
+    0x5005,
+    0x10481A,
+    0x404800,
+    0x21401,
+    0x196101,
+    0x194010,
+    0xA01C0,
+    0xE1001,
+    0x5005,
+    0x5005,
+    0x10481A,
+    0x1C0,
+    0x21401,
+    0x196101,
+    0x260018,
+    0x20059,
+    0x44D12,
+    0x144812,
+    0x42140,
+    0x64004,
+    0x6840,
+    0x6842,
+    0x20059,
+    0x10481A,
+    0x44D12,
+    0x144812,
+    0x42140,
+    0x40118,
+    0x180812,
+    0x84008,
+    0xC07,
+    0x20914,
+    0x41801,
+    0x180812,
+    0x1A2941,
+    0x84008,
+    0x20819,
+    0x6010,
+    0x84008,
+    0x20819,
+    0x484000,
+    0xC4008,
+    0x48910,
+    0x47100,
+    0x84008,
+    0x20A6981,
+    0x20819,
+    0xA0090,
+    0x40089,
+    0x100A090,
+    0x108E191,
+    0x8E100,
+    0x1900,
+    0x1910,
+    0x28010,
+    0x29910,
+    0x29910,
+    0x42140,
+    0x1C6089,
+    0x28010,
+    0x1029119,
+    0x42140,
+    0x82010,
+    0x1C6089,
+    0x29110,
+    0x80030,
+    0x1C3110,
+    0x10481A,
+    0x29110,
+    0x42194,
+    0x4601C,
+    0x29110,
+    0xA8910,
+    0x18000000,
+    0x2184,
+    0x42910,
+    0x161011,
+    0x4808,
+    0x29110,
+    0x260018,
+    0x10481A,
+    0x29110,
+    0x260018,
+    0x29110,
+    0x260018,
+    0xA8910,
+    0xA0015,
+    0x2851,
+    0x181950,
+    0x80830,
+    0x21401,
+    0x8E140,
+    0x196101,
+    0x42950,
+    0x2851,
+    0x181950,
+    0x21401,
+    0x8E140,
+    0x196101,
+    0xA01C0,
+    0x42950,
+    0x21401,
+    0x22034,
+    0x4A211,
+    0x5410,
+    0x280C1,
+    0xEC011,
+    0x120008,
+    0x20000000000,
+    0x20000000000,
+    0x2043,
+    0x10481A,
+    0x887915,
+    0x21401,
+    0x18E105,
+    0xA2153,
+    0xA6153,
+    0x226910,
+    0x2E4510,
+    0x303904,
+    0x264014,
+    0x4A145,
+    0x86510,
+    0x20450,
+    0x1A2118,
+    0xA0095,
+    0x86115,
+    0x86101,
+    0x152014,
+    0x80110,
+    0xA0015,
+    0xE6110,
+    0x8E100,
+    0xE1111,
+    0x142508,
+    0xE0001,
+    0x180812,
+    0x100A090,
+    0xA6125,
+    0x40881,
+    0xE4410,
+    0x320950,
+    0x144908,
+    0x10AC0C1,
+    0xA0417,
+    0x80830,
+    0x110900,
+    0x170011,
+    0xA0417,
+    0x110900,
+    0xA01C0,
+    0x170011,
+    0x10481A,
+    0x21401,
+    0x1D6110,
+    0x887915,
+    0x21401,
+    0x1D6110,
+    0x20000000000,
+    0xA0000000000,
+    0x80000000000,
+    0x887915,
+    0xA6153,
+    0x21401,
+    0x18E105,
+    0x1D6110,
+    0x80010,
+    0x42140,
+    0xA6101,
+    0x42C904,
+    0x260018,
+    0x42140,
+    0xC07,
+    0x180812,
+    0x4E0839,
+    0xC07,
+    0x180812,
+    0x4E01C9,
+    0xE0511,
+    0x404800,
+    0x260018,
+    0x47914,
+    0x44814,
+    0x108000,
+    0x2959,
+    0xE0511,
+    0x484000,
+    0x12A0915,
+    0xFFFFFFFFFFFFFFFF,
+    0x200001,
+    0x220049,
+    0x25915,
+    0x23051,
+    0x1018,
+    0x143100,
+    0x48501,
+    0x42140,
+    0x440198,
+    0x408180,
+    0x40089,
+    0x542040,
+    0x2A2118,
+    0x1A2118,
+    0x424830,
+    0x21401,
+    0x108880,
+    0x18E105,
+    0x148501,
+    0x84008,
+    0x18E105,
+    0xA0090,
+    0x29110,
+    0x138819,
+    0x84008,
+    0x124020,
+    0x18E105,
+    0x84008,
+    0x200130,
+    0x20450,
+    0x8E510,
+    0x18E105,
+    0x912104,
+    0x84008,
+    0x18E105,
+    0x484000,
+    0x84008,
+    0x124020,
+    0x21401,
+    0x64004,
+    0x84018,
+    0x2E185,
+    0x12A119,
+    0x1045802,
+    0xA0090,
+    0xA6904,
+    0xC4008,
+    0x124020,
+    0x2A0915,
+    0x2851,
+    0x21411,
+    0xA01C0,
+    0x1C6102,
+    0x2851,
+    0x84018,
+    0x21411,
+    0xA01C0,
+    0x1C6102,
+    0xA0417,
+    0x80830,
+    0x1C6102,
+    0xA0417,
+    0xA01C0,
+    0x1C6102,
+    0xA0417,
+    0x84018,
+    0x80830,
+    0x1C6102,
+    0xA0417,
+    0x84018,
+    0xA01C0,
+    0x1C6102,
+    0xAE911,
+    0x21411,
+    0x60119,
+    0x84018,
+    0xAE911,
+    0x21411,
+    0x60119,
+    0x84018,
+    0x21411,
+    0xEE101,
+    0xA0417,
+    0x80830,
+    0xEE101,
+    0xA0417,
+    0xA01C0,
+    0xEE101,
+    0x60119,
+    0x170011,
+    0xA0417,
+    0x80830,
+    0x47100,
+    0x60119,
+    0xA0417,
+    0x47100,
+    0x60119,
+    0xA01C0,
+    0x66104,
+    0xA4919,
+    0x6C0C1,
+    0x24438,
+    0x6C0C1,
+    0x24438,
+    0x6C0C1,
+    0x260018,
+    0x10CC999,
+    0x10CC909,
+    0x84018,
+    0x44812,
+    0x26005,
+    0x466009,
+    0x26005,
+    0x568009,
+    0x2851,
+    0x8918,
+    0x84018,
+    0xEB150,
+    0x8E140,
+    0xA01C0,
+    0x10481A,
+    0x100A090,
+    0x114912,
+    0xA6153,
+    0xA6153,
+    0x2A2118,
+    0x22087,
+    0x9801,
+    0x60119,
+    0x100A090,
+    0x204013,
+    0x22140,
+    0x80918,
+    0xA0417,
+    0x80830,
+    0x404800,
+    0x68091,
+    0xA0417,
+    0x404800,
+    0x68091,
+    0xA01C0,
+    0x204013,
+    0x84008,
+    0x80918,
+    0x404812,
+    0x84008,
+    0x80918,
+    0x20003,
+    0x80830,
+    0x110900,
+    0x2A0915,
+    0x20003,
+    0x110900,
+    0xA01C0,
+    0x2A0915,
+    0xA0417,
+    0x8A1,
+    0x80830,
+    0x8C000,
+    0xA0417,
+    0x8A1,
+    0xA01C0,
+    0x8C000,
+    0x85002,
+    0xA0417,
+    0x8A1,
+    0x80830,
+    0x85002,
+    0xA0417,
+    0x8A1,
+    0xA01C0,
+    0xA0417,
+    0x80830,
+    0x1440119,
+    0xA0417,
+    0xA01C0,
+    0x1440119,
+    0x10481A,
+    0x80830,
+    0xEA191,
+    0x10481A,
+    0xEA191,
+    0xA01C0,
+    0x84008,
+    0xC4008,
+    0x6010,
+    0x224010,
+    0x18E105,
+    0x484000,
+    0x84008,
+    0xC4008,
+    0x6010,
+    0x224010,
+    0x18E105,
+    0x484000,
+    0x84008,
+    0x124020,
+    0x18E105,
+    0x170019,
+    0x84008,
+    0x200130,
+    0x21401,
+    0x21401,
+    0x3EE115,
+    0x1CA004,
+    0x1D6110,
+    0x260018,
+    0x80918,
+    0x2A0915,
+    0x8E100,
+    0x22140,
+    0x84008,
+    0x1918,
+    0xEC011,
+    0x424008,
+    0x5005,
+    0x1A2018,
+    0x84008,
+    0x60119,
+    0x5005,
+    0x60119,
+    0x47914,
+    0x1A2018,
+    0x20059,
+    0x120049,
+    0x80830,
+    0x20059,
+    0x120049,
+    0xA01C0,
+    0x20059,
+    0x1A2018,
+    0x8A1,
+    0xC6114,
+    0x42140,
+    0x8C000,
+    0x40089,
+    0x1010,
+    0x47100,
+    0x484000,
+    0x40089,
+    0x1010,
+    0xA0090,
+    0x100820,
+    0xEE1D5,
+    0xCC000,
+    0xC4008,
+    0x840100,
+    0x2A0915,
+    0x2910,
+    0x2A0915,
+    0x1400940,
+    0x189905,
+    0x10481A,
+    0x100A090,
+    0x5005,
+    0x260018,
+    0x10481A,
+    0x404800,
+    0x21401,
+    0x196101,
+    0x260018,
+    0x40089,
+    0x80830,
+    0x1AA000,
+    0x10481A,
+    0x21401,
+    0x14E110,
+    0x2A2118,
+    0x1200401,
+    0x404800,
+    0x204013,
+    0x2A2118,
+    0x1200401,
+    0x404800,
+    0x1200401,
+    0x404800,
+    0x84008,
+    0x1200401,
+    0x404800,
+    0x5005,
+    0x10481A,
+    0xC041D,
+    0x84018,
+    0x144908,
+    0x34A111,
+    0x320941,
+    0x20059,
+    0xA8910,
+    0x5005,
+    0x201919,
+    0x21401,
+    0x1680C1,
+    0x3C0811,
+    0x21401,
+    0x1CA004,
+    0x66184,
+    0x220118,
+    0x260010,
+    0x64004,
+    0x64007,
+    0x1088001,
+    0xA01C0,
+    0x64004,
+    0x64007,
+    0x80830,
+    0x1088001,
+    0x88905,
+    0x80010,
+    0x42140,
+    0xA6101,
+    0x887915,
+    0x21401,
+    0x201919,
+    0x21401,
+    0x201919,
+    0x1D6110,
+    0xA0417,
+    0x80830,
+    0x170011,
+    0xE4410,
+    0xA0417,
+    0xA01C0,
+    0x170011,
+    0xE4410,
+    0xA0417,
+    0x10481A,
+    0x80830,
+    0x170011,
+    0xE4410,
+    0xA0417,
+    0x10481A,
+    0xA01C0,
+    0x170011,
+    0xE4410,
+    0x8A1,
+    0x80830,
+    0xEA191,
+    0x8C000,
+    0x8A1,
+    0xEA191,
+    0xA01C0,
+    0x8C000,
+    0x85002,
+    0x8A1,
+    0x80830,
+    0xEA191,
+    0x85002,
+    0x8A1,
+    0xEA191,
+    0xA01C0,
+    0x100A090,
+    0x114912,
+    0x88000000,
+    0x804002,
+    0x48,
+    0x462149,
+    0x20A6981,
+    0x809C0,
+    0x45105,
+    0xA84118,
+    0x804002,
+    0x462149,
+    0x1200091,
+    0x20A6981,
+    0x48000000,
+    0x804002,
+    0x48,
+    0x462149,
+    0x809C0,
+    0x45105,
+    0x2A0915,
+    0xA84118,
+    0x804002,
+    0x462149,
+    0x1200091,
+    0x2A0915,
+    0x804002,
+    0x40089,
+    0x462149,
+    0x20A6981,
+    0x809C0,
+    0xA8910,
+    0x804002,
+    0x40089,
+    0x462149,
+    0x1200091,
+    0x20A6981,
+    0xA8910,
+    0x804002,
+    0x40089,
+    0x462149,
+    0x809C0,
+    0xA8910,
+    0x2A0915,
+    0x804002,
+    0x40089,
+    0x462149,
+    0x1200091,
+    0xA8910,
+    0x2A0915,
+    0x804002,
+    0x40089,
+    0x462149,
+    0x20A6981,
+    0x809C0,
+    0x138819,
+    0x804002,
+    0x40089,
+    0x462149,
+    0x1200091,
+    0x20A6981,
+    0x138819,
+    0x804002,
+    0x40089,
+    0x462149,
+    0x809C0,
+    0x138819,
+    0x2A0915,
+    0x804002,
+    0x40089,
+    0x462149,
+    0x1200091,
+    0x138819,
+    0x2A0915,
+    0x108000000,
+    0x804002,
+    0x48,
+    0x406008,
+    0x462149,
+    0x809C0,
+    0x45105,
+    0xA01C0,
+    0xA84118,
+    0x804002,
+    0x406008,
+    0x462149,
+    0x1200091,
+    0x809C0,
+    0xA01C0,
+    0x804002,
+    0x406008,
+    0x462149,
+    0x1200091,
+    0x809C0,
+    0xA01C0,
+    0x804002,
+    0x406008,
+    0x462149,
+    0x1200091,
+    0xA01C0,
+    0x208000000,
+    0x804002,
+    0x48,
+    0x406008,
+    0x462149,
+    0x80830,
+    0x809C0,
+    0x45105,
+    0xA84118,
+    0x804002,
+    0x406008,
+    0x462149,
+    0x1200091,
+    0x80830,
+    0x809C0,
+    0x804002,
+    0x406008,
+    0x462149,
+    0x1200091,
+    0x80830,
+    0x809C0,
+    0x804002,
+    0x406008,
+    0x462149,
+    0x1200091,
+    0x80830,
+    0x408000000,
+    0x804002,
+    0x48,
+    0x462149,
+    0x809C0,
+    0x45105,
+    0xA01C0,
+    0x108000,
+    0xA84118,
+    0x804002,
+    0x462149,
+    0x1200091,
+    0x809C0,
+    0xA01C0,
+    0x108000,
+    0x804002,
+    0x462149,
+    0x1200091,
+    0x809C0,
+    0xA01C0,
+    0x108000,
+    0x804002,
+    0x462149,
+    0x1200091,
+    0xA01C0,
+    0x108000,
+    0x808000000,
+    0x804002,
+    0x48,
+    0x462149,
+    0x80830,
+    0x809C0,
+    0x45105,
+    0x108000,
+    0xA84118,
+    0x804002,
+    0x462149,
+    0x1200091,
+    0x80830,
+    0x809C0,
+    0x108000,
+    0x804002,
+    0x462149,
+    0x1200091,
+    0x80830,
+    0x809C0,
+    0x108000,
+    0x804002,
+    0x462149,
+    0x1200091,
+    0x80830,
+    0x108000,
+    0x14000000,
+    0x804002,
+    0x48,
+    0x462149,
+    0x809C0,
+    0x45105,
+    0xA01C0,
+    0x2A0915,
+    0xA84118,
+    0x24000000,
+    0x804002,
+    0x48,
+    0x462149,
+    0x1200091,
+    0x809C0,
+    0x45105,
+    0xA01C0,
+    0x2A0915,
+    0xA84118,
+    0x804002,
+    0x406008,
+    0x462149,
+    0x1200091,
+    0x809C0,
+    0xA01C0,
+    0x108000,
+    0x804002,
+    0x406008,
+    0x462149,
+    0x1200091,
+    0x809C0,
+    0xA01C0,
+    0x108000,
+    0x804002,
+    0x462149,
+    0x1200091,
+    0x809C0,
+    0xA01C0,
+    0x2A0915,
+    0x804002,
+    0x406008,
+    0x462149,
+    0x1200091,
+    0x809C0,
+    0xA01C0,
+    0x108000,
+    0x804002,
+    0x406008,
+    0x462149,
+    0x1200091,
+    0x809C0,
+    0xA01C0,
+    0x108000,
+    0x804002,
+    0x462149,
+    0x1200091,
+    0xA01C0,
+    0x2A0915,
+    0x18000000,
+    0x804002,
+    0x48,
+    0x462149,
+    0x80830,
+    0x809C0,
+    0x45105,
+    0x2A0915,
+    0xA84118,
+    0x44000000,
+    0x804002,
+    0x48,
+    0x462149,
+    0x1200091,
+    0x80830,
+    0x809C0,
+    0x45105,
+    0x2A0915,
+    0xA84118,
+    0x804002,
+    0x406008,
+    0x462149,
+    0x1200091,
+    0x80830,
+    0x809C0,
+    0x108000,
+    0x804002,
+    0x406008,
+    0x462149,
+    0x1200091,
+    0x80830,
+    0x809C0,
+    0x108000,
+    0x804002,
+    0x462149,
+    0x1200091,
+    0x80830,
+    0x809C0,
+    0x2A0915,
+    0x804002,
+    0x406008,
+    0x462149,
+    0x1200091,
+    0x80830,
+    0x809C0,
+    0x108000,
+    0x804002,
+    0x406008,
+    0x462149,
+    0x1200091,
+    0x80830,
+    0x809C0,
+    0x108000,
+    0x804002,
+    0x462149,
+    0x1200091,
+    0x80830,
+    0x2A0915,
+    0x10000000,
+    0x804002,
+    0x48,
+    0x406008,
+    0x462149,
+    0x20A6981,
+    0x809C0,
+    0x45105,
+    0xA84118,
+    0x804002,
+    0x406008,
+    0x462149,
+    0x1200091,
+    0x80830,
+    0x809C0,
+    0xA01C0,
+    0x804002,
+    0x406008,
+    0x462149,
+    0x1200091,
+    0x80830,
+    0x809C0,
+    0xA01C0,
+    0x14000000,
+    0x804002,
+    0x48,
+    0x406008,
+    0x462149,
+    0x1200091,
+    0x20A6981,
+    0x809C0,
+    0x45105,
+    0xA84118,
+    0x804002,
+    0x406008,
+    0x462149,
+    0x1200091,
+    0x20A6981,
+    0x809C0,
+    0x804002,
+    0x406008,
+    0x462149,
+    0x1200091,
+    0x80830,
+    0x809C0,
+    0xA01C0,
+    0x804002,
+    0x406008,
+    0x462149,
+    0x1200091,
+    0x80830,
+    0x809C0,
+    0xA01C0,
+    0x804002,
+    0x406008,
+    0x462149,
+    0x1200091,
+    0x20A6981,
+    0x30000000,
+    0x804002,
+    0x48,
+    0x462149,
+    0x20A6981,
+    0x809C0,
+    0x45105,
+    0x108000,
+    0xA84118,
+    0x804002,
+    0x462149,
+    0x1200091,
+    0x80830,
+    0x809C0,
+    0xA01C0,
+    0x108000,
+    0x804002,
+    0x462149,
+    0x1200091,
+    0x80830,
+    0x809C0,
+    0xA01C0,
+    0x108000,
+    0xC000000,
+    0x804002,
+    0x48,
+    0x462149,
+    0x1200091,
+    0x20A6981,
+    0x809C0,
+    0x45105,
+    0x108000,
+    0xA84118,
+    0x804002,
+    0x462149,
+    0x1200091,
+    0x20A6981,
+    0x809C0,
+    0x108000,
+    0x804002,
+    0x462149,
+    0x1200091,
+    0x80830,
+    0x809C0,
+    0xA01C0,
+    0x108000,
+    0x804002,
+    0x462149,
+    0x1200091,
+    0x80830,
+    0x809C0,
+    0xA01C0,
+    0x108000,
+    0x804002,
+    0x462149,
+    0x1200091,
+    0x20A6981,
+    0x108000,
+    0x50000000,
+    0x804002,
+    0x48,
+    0x462149,
+    0x20A6981,
+    0x809C0,
+    0x45105,
+    0x2A0915,
+    0xA84118,
+    0x804002,
+    0x462149,
+    0x1200091,
+    0x80830,
+    0x809C0,
+    0xA01C0,
+    0x2A0915,
+    0x804002,
+    0x462149,
+    0x1200091,
+    0x80830,
+    0x809C0,
+    0xA01C0,
+    0x2A0915,
+    0x28000000,
+    0x804002,
+    0x48,
+    0x462149,
+    0x1200091,
+    0x20A6981,
+    0x809C0,
+    0x45105,
+    0x2A0915,
+    0xA84118,
+    0x804002,
+    0x406008,
+    0x462149,
+    0x1200091,
+    0x20A6981,
+    0x809C0,
+    0x108000,
+    0x804002,
+    0x406008,
+    0x462149,
+    0x1200091,
+    0x20A6981,
+    0x809C0,
+    0x108000,
+    0x804002,
+    0x462149,
+    0x1200091,
+    0x20A6981,
+    0x809C0,
+    0x2A0915,
+    0x804002,
+    0x406008,
+    0x462149,
+    0x1200091,
+    0x80830,
+    0x809C0,
+    0xA01C0,
+    0x108000,
+    0x804002,
+    0x406008,
+    0x462149,
+    0x1200091,
+    0x80830,
+    0x809C0,
+    0xA01C0,
+    0x108000,
+    0x804002,
+    0x406008,
+    0x462149,
+    0x1200091,
+    0x80830,
+    0x809C0,
+    0xA01C0,
+    0x108000,
+    0x804002,
+    0x406008,
+    0x462149,
+    0x1200091,
+    0x80830,
+    0x809C0,
+    0xA01C0,
+    0x108000,
+    0x804002,
+    0x406008,
+    0x462149,
+    0x1200091,
+    0x20A6981,
+    0x809C0,
+    0x108000,
+    0x804002,
+    0x406008,
+    0x462149,
+    0x1200091,
+    0x20A6981,
+    0x809C0,
+    0x108000,
+    0x804002,
+    0x462149,
+    0x1200091,
+    0x80830,
+    0x809C0,
+    0xA01C0,
+    0x2A0915,
+    0x804002,
+    0x462149,
+    0x1200091,
+    0x80830,
+    0x809C0,
+    0xA01C0,
+    0x2A0915,
+    0x804002,
+    0x462149,
+    0x1200091,
+    0x20A6981,
+    0x2A0915,
+    0x804002,
+    0x40089,
+    0x10481A,
+    0x462149,
+    0x20A6981,
+    0x809C0,
+    0x804002,
+    0x40089,
+    0x10481A,
+    0x462149,
+    0x1200091,
+    0x20A6981,
+    0x804002,
+    0x40089,
+    0x10481A,
+    0x462149,
+    0x809C0,
+    0x2A0915,
+    0x804002,
+    0x40089,
+    0x10481A,
+    0x462149,
+    0x1200091,
+    0x2A0915,
+    0x804002,
+    0x10481A,
+    0x462149,
+    0x20A6981,
+    0x804002,
+    0x10481A,
+    0x462149,
+    0x2A0915,
+    0x804002,
+    0x10481A,
+    0x406008,
+    0x462149,
+    0xA01C0,
+    0x42950,
+    0x804002,
+    0x10481A,
+    0x406008,
+    0x462149,
+    0xA01C0,
+    0x42950,
+    0x804002,
+    0x10481A,
+    0x406008,
+    0x462149,
+    0xA01C0,
+    0x804002,
+    0x10481A,
+    0x406008,
+    0x462149,
+    0x80830,
+    0x42950,
+    0x804002,
+    0x10481A,
+    0x406008,
+    0x462149,
+    0x80830,
+    0x42950,
+    0x804002,
+    0x10481A,
+    0x406008,
+    0x462149,
+    0x80830,
+    0x804002,
+    0x10481A,
+    0x462149,
+    0xA01C0,
+    0x42950,
+    0x108000,
+    0x804002,
+    0x10481A,
+    0x462149,
+    0xA01C0,
+    0x42950,
+    0x108000,
+    0x804002,
+    0x10481A,
+    0x462149,
+    0xA01C0,
+    0x108000,
+    0x804002,
+    0x10481A,
+    0x462149,
+    0x80830,
+    0x42950,
+    0x108000,
+    0x804002,
+    0x10481A,
+    0x462149,
+    0x80830,
+    0x42950,
+    0x108000,
+    0x804002,
+    0x10481A,
+    0x462149,
+    0x80830,
+    0x108000,
+    0x804002,
+    0x10481A,
+    0x462149,
+    0xA01C0,
+    0x42950,
+    0x2A0915,
+    0x804002,
+    0x10481A,
+    0x462149,
+    0xA01C0,
+    0x42950,
+    0x2A0915,
+    0x804002,
+    0x10481A,
+    0x462149,
+    0xA01C0,
+    0x2A0915,
+    0x804002,
+    0x10481A,
+    0x462149,
+    0x80830,
+    0x42950,
+    0x2A0915,
+    0x804002,
+    0x10481A,
+    0x462149,
+    0x80830,
+    0x42950,
+    0x2A0915,
+    0x804002,
+    0x10481A,
+    0x462149,
+    0x80830,
+    0x2A0915,
+    0x804002,
+    0x10481A,
+    0x406008,
+    0x462149,
+    0x20A6981,
+    0x42950,
+    0x804002,
+    0x10481A,
+    0x406008,
+    0x462149,
+    0x20A6981,
+    0x42950,
+    0x804002,
+    0x10481A,
+    0x406008,
+    0x462149,
+    0x20A6981,
+    0x804002,
+    0x10481A,
+    0x462149,
+    0x20A6981,
+    0x42950,
+    0x108000,
+    0x804002,
+    0x10481A,
+    0x462149,
+    0x20A6981,
+    0x42950,
+    0x108000,
+    0x804002,
+    0x10481A,
+    0x462149,
+    0x20A6981,
+    0x108000,
+    0x804002,
+    0x10481A,
+    0x462149,
+    0x20A6981,
+    0x42950,
+    0x2A0915,
+    0x804002,
+    0x10481A,
+    0x462149,
+    0x20A6981,
+    0x42950,
+    0x2A0915,
+    0x804002,
+    0x10481A,
+    0x462149,
+    0x20A6981,
+    0x2A0915,
+    0x20005,
+    0x804002,
+    0x406008,
+    0x462149,
+    0x809C0,
+    0xA01C0,
+    0x20005,
+    0x804002,
+    0x406008,
+    0x462149,
+    0x80830,
+    0x809C0,
+    0x20005,
+    0x804002,
+    0x462149,
+    0x80830,
+    0x809C0,
+    0x108000,
+    0x20005,
+    0x804002,
+    0x462149,
+    0x809C0,
+    0xA01C0,
+    0x108000,
+    0x804002,
+    0x6949,
+    0x462149,
+    0x80830,
+    0x809C0,
+    0x424810,
+    0xA01C0,
+    0x128010,
+    0x804002,
+    0x6949,
+    0x462149,
+    0x80830,
+    0x809C0,
+    0x424810,
+    0xA01C0,
+    0x128010,
+    0x804002,
+    0x64004,
+    0x6949,
+    0x462149,
+    0x809C0,
+    0x804002,
+    0x462149,
+    0x80830,
+    0x809C0,
+    0x804002,
+    0x462149,
+    0x809C0,
+    0x108000,
+    0x804002,
+    0x462149,
+    0x809C0,
+    0xA01C0,
+    0x804002,
+    0x406008,
+    0x462149,
+    0x809C0,
+    0x804002,
+    0x462149,
+    0x1200091,
+    0x80830,
+    0x804002,
+    0x462149,
+    0x1200091,
+    0x108000,
+    0x804002,
+    0x462149,
+    0x1200091,
+    0xA01C0,
+    0x804002,
+    0x406008,
+    0x462149,
+    0x1200091,
+    0x804002,
+    0x462149,
+    0x1200091,
+    0x80830,
+    0x809C0,
+    0xA01C0,
+    0x804002,
+    0x406008,
+    0x462149,
+    0x1200091,
+    0x809C0,
+    0x108000,
+    0x804002,
+    0x462149,
+    0x1200091,
+    0x80830,
+    0x809C0,
+    0xA01C0,
+    0x804002,
+    0x406008,
+    0x462149,
+    0x1200091,
+    0x809C0,
+    0x108000,
+    0x4C06,
+    0x8A1,
+    0x128010,
+    0x4C06,
+    0x801D0,
+    0x424810,
+    0x6010,
+    0x4C06,
+    0x424810,
+    0x6010,
+    0x1B0011,
+    0x4C06,
+    0xC01D0,
+    0x424810,
+    0xA0090,
+    0x4C06,
+    0x8A1,
+    0x424810,
+    0x4C06,
+    0xC01D0,
+    0x200130,
+    0x424810,
+    0x4C06,
+    0x424810,
+    0x1F0011,
+    0xA0090,
+    0x4C06,
+    0xC01D0,
+    0x424810,
+    0x242010,
+    0x4C06,
+    0x100820,
+    0x44908,
+    0x4C06,
+    0xC01D0,
+    0x80830,
+    0x242010,
+    0x4C06,
+    0x80830,
+    0x1F0011,
+    0xA0090,
+    0x4C06,
+    0xC01D0,
+    0x200130,
+    0x80830,
+    0x4C06,
+    0x8A1,
+    0x80830,
+    0x4C06,
+    0xC01D0,
+    0x80830,
+    0xA0090,
+    0x4C06,
+    0x80830,
+    0x6010,
+    0x1B0011,
+    0x4C06,
+    0x801D0,
+    0x80830,
+    0x6010,
+    0x4C06,
+    0x8A1,
+    0xA01C0,
+    0x809C0,
+    0x40099,
+    0x84018,
+    0x920,
+    0x101118,
+    0x40099,
+    0x48C14,
+    0x20409,
+    0x40099,
+    0x4C06,
+    0x801D0,
+    0x6010,
+    0x128010,
+    0x4C06,
+    0x801D0,
+    0x6010,
+    0xA01C0,
+    0x80830,
+    0x424810,
+    0x1B2009,
+    0x424810,
+    0x1B2009,
+    0xA01C0,
+    0x80830,
+    0x1B2009,
+    0x128010,
+    0x80830,
+    0x424810,
+    0x1B2009,
+    0xA01C0,
+    0x128010,
+    0x80830,
+    0x424810,
+    0x1B2009,
+    0xA01C0,
+    0x128010,
+    0x80830,
+    0x424810,
+    0x1B2009,
+    0xA01C0,
+    0x128010,
+    0x80830,
+    0x424810,
+    0x1B2009,
+    0xA01C0,
+    0x128010,
+    0x1B2009,
+    0xA01C0,
+    0x128010,
+    0x80830,
+    0x424810,
+    0x1B2009,
+    0xA01C0,
+    0x128010,
+    0x80830,
+    0x424810,
+    0x1B2009,
+    0xA01C0,
+    0x128010,
+    0x938,
+    0x170011,
+    0xC07,
+    0x2C1DD,
+    0x21401,
+    0x7148,
+    0x880010,
+    0x404880,
+    0x170011,
+    0x1995,
+    0x1B0019,
+    0xC0801,
+    0x1045802,
+    0x480190,
+    0x66014,
+    0x404880,
+    0x126018,
+    0x170011,
+    0x480180,
+    0x480190,
+    0x86145,
+    0x938,
+    0x404880,
+    0x170011,
+    0xC07,
+    0x41801,
+    0x480190,
+    0x920,
+    0x20A6981,
+    0x170011,
+    0x480180,
+    0x920,
+    0x170011,
+    0x2A0915,
+    0x480180,
+    0xE4085,
+    0x920,
+    0xA68C1,
+    0x170011,
+    0x920,
+    0x80830,
+    0x424810,
+    0xA01C0,
+    0x170011,
+    0x128010,
+    0x920,
+    0x80830,
+    0x424810,
+    0xA01C0,
+    0x170011,
+    0x128010,
+    0xE4085,
+    0x6949,
+    0x920,
+    0x170011,
+    0xC07,
+    0xA5154,
+    0x41801,
+    0x170011,
+    0x180812,
+    0xA5154,
+    0x41801,
+    0x170011,
+    0x480190,
+    0x938,
+    0xA2855,
+    0xC07,
+    0x404880,
+    0xA2855,
+    0x480190,
+    0x938,
+    0xA2855,
+    0x2A0915,
+    0xC07,
+    0xE51C1,
+    0x21411,
+    0xA2855,
+    0x2A0915,
+    0x480190,
+    0x938,
+    0x2D851,
+    0xC07,
+    0x2D851,
+    0x480190,
+    0x424001,
+    0x938,
+    0xA2951,
+    0x108000,
+    0x2000000018E140,
+    0xC07,
+    0x8E140,
+    0x404880,
+    0xA2951,
+    0x2000000018E140,
+    0x8E140,
+    0xA2110,
+    0x108000,
+    0x480190,
+    0x938,
+    0x41801,
+    0xA2951,
+    0x2000000018E140,
+    0xC07,
+    0x8E140,
+    0x108000,
+    0x404880,
+    0x41801,
+    0xA2951,
+    0x2000000018E140,
+    0x8E140,
+    0x108000,
+    0x480190,
+    0x424001,
+    0x186002,
+    0x1008801,
+    0xA01C0,
+    0xA2951,
+    0xC07,
+    0x8E140,
+    0x404880,
+    0x200000000AE1C0,
+    0xA2951,
+    0x86101,
+    0x8E140,
+    0x22051,
+    0xE6114,
+    0xA01C0,
+    0x480190,
+    0x938,
+    0x200000000AE1C0,
+    0x41801,
+    0xA2951,
+    0xC07,
+    0x8E140,
+    0xA01C0,
+    0x404880,
+    0x200000000AE1C0,
+    0x41801,
+    0xA2951,
+    0x8E140,
+    0xA01C0,
+    0x480190,
+    0x938,
+    0xAE110,
+    0x200000000AE1C0,
+    0xC07,
+    0x8E140,
+    0xA01C0,
+    0x404880,
+    0xAE110,
+    0x200000000AE1C0,
+    0x424001,
+    0x424029,
+    0xA610D,
+    0x8E140,
+    0xA01C0,
+    0x480190,
+    0x424001,
+    0x406008,
+    0x2000000048E148,
+    0x938,
+    0xA2951,
+    0xC07,
+    0x8E140,
+    0x2000000048E148,
+    0x404880,
+    0xA2951,
+    0x406008,
+    0x87981,
+    0xAC011,
+    0x8E140,
+    0x480190,
+    0x2000000048E148,
+    0x938,
+    0x41801,
+    0xA2951,
+    0xC07,
+    0x406008,
+    0x8E140,
+    0x2000000048E148,
+    0x404880,
+    0x41801,
+    0xA2951,
+    0x406008,
+    0x8E140,
+    0x480190,
+    0x424001,
+    0x186002,
+    0x80830,
+    0x260010,
+    0xA2951,
+    0xC07,
+    0x8E140,
+    0x404880,
+    0x2000000008E970,
+    0xA2951,
+    0x7109,
+    0x80830,
+    0x86101,
+    0x8E140,
+    0xE6114,
+    0x480190,
+    0x938,
+    0x2000000008E970,
+    0x41801,
+    0xA2951,
+    0xC07,
+    0x80830,
+    0x8E140,
+    0x404880,
+    0x2000000008E970,
+    0x41801,
+    0xA2951,
+    0x80830,
+    0x8E140,
+    0x480190,
+    0x938,
+    0x2000000008E970,
+    0xAE110,
+    0xC07,
+    0x80830,
+    0x8E140,
+    0x404880,
+    0x2000000008E970,
+    0xAE110,
+    0x424001,
+    0x42040F,
+    0xA610D,
+    0x80830,
+    0x8E140,
+    0x480190,
+    0x7109,
+    0x938,
+    0xC07,
+    0x7109,
+    0x404880,
+    0x480190,
+    0x86145,
+    0x7109,
+    0x938,
+    0x404880,
+    0xC07,
+    0x41801,
+    0x480190,
+    0x40914,
+    0x20914,
+    0x2091C,
+    0xA6114,
+    0x86145,
+    0x84008,
+    0x938,
+    0x10401B0,
+    0x404880,
+    0x420009,
+    0x180812,
+    0x4A211,
+    0x2508,
+    0x87111,
+    0x7109,
+    0x2006850,
+    0x165082,
+    0x20914,
+    0x404880,
+    0x22140,
+    0x480190,
+    0x20914,
+    0x84018,
+    0x20914,
+    0x920,
+    0x2A0915,
+    0x480180,
+    0x20914,
+    0x60914,
+    0xA6114,
+    0x10481A,
+    0xA0051,
+    0x1140812,
+    0x20914,
+    0x938,
+    0xC07,
+    0x20914,
+    0x938,
+    0x8A1,
+    0x80830,
+    0xC07,
+    0x20914,
+    0x938,
+    0x8A1,
+    0xA01C0,
+    0xC07,
+    0x20914,
+    0x938,
+    0x8A1,
+    0x424810,
+    0xC07,
+    0x20914,
+    0x938,
+    0x8A1,
+    0x128010,
+    0xC07,
+    0x20914,
+    0x938,
+    0x1B2009,
+    0xA01C0,
+    0x128010,
+    0xC07,
+    0x801,
+    0x180002,
+    0x20914,
+    0x938,
+    0x80830,
+    0x1B2009,
+    0x128010,
+    0xC07,
+    0x20914,
+    0x938,
+    0x8A1,
+    0x80830,
+    0xC07,
+    0x20914,
+    0x938,
+    0x8A1,
+    0xA01C0,
+    0xC07,
+    0x180812,
+    0x262110,
+    0x20914,
+    0x86145,
+    0x938,
+    0x404880,
+    0x262110,
+    0x170011,
+    0x480190,
+    0x20914,
+    0x8A1,
+    0x262110,
+    0x128010,
+    0x480190,
+    0x20914,
+    0x8A1,
+    0x262110,
+    0x424810,
+    0x480190,
+    0x20005,
+    0x120905,
+    0x80830,
+    0x1B2009,
+    0x128010,
+    0x20005,
+    0x120905,
+    0x1B2009,
+    0xA01C0,
+    0x128010,
+    0x20005,
+    0x120905,
+    0x424810,
+    0x1B2009,
+    0xA01C0,
+    0x20005,
+    0x120905,
+    0x80830,
+    0x424810,
+    0x1B2009,
+    0x20914,
+    0x8A1,
+    0x128010,
+    0x20914,
+    0x8A1,
+    0x424810,
+    0x938,
+    0x424810,
+    0xA01C0,
+    0xA2951,
+    0xC07,
+    0x938,
+    0x80830,
+    0x424810,
+    0xA2951,
+    0xC07,
+    0x938,
+    0x80830,
+    0xA2951,
+    0x128010,
+    0xC07,
+    0x938,
+    0xA01C0,
+    0xA2951,
+    0x128010,
+    0xC07,
+    0x180812,
+    0x404880,
+    0x480190,
+    0xC07,
+    0x8A1,
+    0x80830,
+    0x170011,
+    0xC07,
+    0x8A1,
+    0xA01C0,
+    0x170011,
+    0xC07,
+    0x6949,
+    0x8A1,
+    0x80830,
+    0x170011,
+    0x128010,
+    0xC07,
+    0x6949,
+    0x8A1,
+    0x424810,
+    0xA01C0,
+    0x170011,
+    0xC2156,
+    0x2910,
+    0x170011,
+    0x2A0915,
+    0x480190,
+    0x84008,
+    0x8E140,
+    0xA2951,
+    0x108000,
+    0x480190,
+    0xC07,
+    0x8A1,
+    0x80830,
+    0x8E140,
+    0xA2951,
+    0x108000,
+    0xC07,
+    0x8A1,
+    0x8E140,
+    0xA01C0,
+    0xA2951,
+    0x108000,
+    0x20914,
+    0x404880,
+    0x20851,
+    0x22140,
+    0x80830,
+    0x1B2009,
+    0x170011,
+    0x128010,
+    0x480190,
+    0x80830,
+    0x424810,
+    0x1B2009,
+    0x170011,
+    0x480190,
+    0x424810,
+    0x1B2009,
+    0xA01C0,
+    0x170011,
+    0x480190,
+    0x404880,
+    0x1B2009,
+    0xA01C0,
+    0x170011,
+    0x128010,
+    0x480190,
+    0x20914,
+    0x80830,
+    0x1B2009,
+    0x128010,
+    0x480190,
+    0x20914,
+    0x80830,
+    0x424810,
+    0x1B2009,
+    0x480190,
+    0x20914,
+    0x424810,
+    0x1B2009,
+    0xA01C0,
+    0x480190,
+    0x20914,
+    0x404880,
+    0x1B2009,
+    0xA01C0,
+    0x128010,
+    0x480180,
+    0x480190,
+    0x80830,
+    0xA2951,
+    0x128010,
+    0xA01C0,
+    0xA2951,
+    0x128010,
+    0x80830,
+    0x424810,
+    0xA2951,
+    0xA5154,
+    0x101118,
+    0x170011,
+    0x480190,
+    0x1440801,
+    0x5809,
+    0xAC011,
+    0xC07,
+    0xA5154,
+    0x101118,
+    0x170011,
+    0x424810,
+    0xA01C0,
+    0xA2951,
+    0xC07,
+    0x44914,
+    0x80830,
+    0x8E140,
+    0xA01C0,
+    0xA2951,
+    0xC07,
+    0x44914,
+    0x8E140,
+    0xA01C0,
+    0xA2951,
+    0x108000,
+    0xC07,
+    0x44914,
+    0x8E140,
+    0xA01C0,
+    0xA2951,
+    0xC07,
+    0x406008,
+    0x44914,
+    0x8E140,
+    0xA01C0,
+    0xA2951,
+    0xC07,
+    0x20914,
+    0x10C09C0,
+    0x41801,
+    0x480A,
+    0x20914,
+    0x101118,
+    0x480190,
+    0x480A,
+    0x20914,
+    0x480190,
+    0x20914,
+    0x1200091,
+    0x480190,
+    0x20914,
+    0x1200091,
+    0x1220010,
+    0x480190,
+    0x20914,
+    0x18A1810,
+    0x1200091,
+    0x480190,
+    0xC07,
+    0x20914,
+    0x86145,
+    0x41801,
+    0x480190,
+    0x126008,
+    0xA0051,
+    0xC07,
+    0x170011,
+    0x1082100,
+    0xC07,
+    0x10C09C0,
+    0x41801,
+    0x170011,
+    0x809C0,
+    0x170011,
+    0x480190,
+    0x101118,
+    0x170011,
+    0x480190,
+    0x480A,
+    0x1200091,
+    0x170011,
+    0x480190,
+    0x1200091,
+    0x170011,
+    0x480190,
+    0x1200091,
+    0x170011,
+    0x1220010,
+    0x480190,
+    0x18A1810,
+    0x1200091,
+    0x170011,
+    0x480190,
+    0xC07,
+    0x86145,
+    0x41801,
+    0x170011,
+    0x1220010,
+    0x480190,
+    0xC07,
+    0x86145,
+    0x101118,
+    0x170011,
+    0x480190,
+    0x170011,
+    0xA0051,
+    0xC07,
+    0x7109,
+    0x1082100,
+    0xC07,
+    0x7109,
+    0x41801,
+    0x1220010,
+    0xC07,
+    0x7109,
+    0x101118,
+    0x41801,
+    0xC07,
+    0x86145,
+    0x7109,
+    0x41801,
+    0x1220010,
+    0x480190,
+    0xC07,
+    0x86145,
+    0x7109,
+    0x101118,
+    0x480190,
+    0x7109,
+    0xA0051,
+    0xC07,
+    0x2006850,
+    0x1082100,
+    0xC07,
+    0x2006850,
+    0x41801,
+    0x1220010,
+    0xC07,
+    0x2006850,
+    0x101118,
+    0x41801,
+    0xC07,
+    0x86145,
+    0x2006850,
+    0x41801,
+    0x480190,
+    0x64004,
+    0x20450,
+    0x82180,
+    0x64004,
+    0x20450,
+    0x809C0,
+    0x64004,
+    0x20450,
+    0x101118,
+    0x480A,
+    0x64004,
+    0x20450,
+    0x480A,
+    0x64004,
+    0x20450,
+    0x1220010,
+    0x64004,
+    0x20450,
+    0x1200091,
+    0x1220010,
+    0x64004,
+    0x18A1810,
+    0x20450,
+    0x1200091,
+    0xE0911,
+    0x82180,
+    0x809C0,
+    0xE0911,
+    0x101118,
+    0xE0911,
+    0x480A,
+    0xE0911,
+    0x1200091,
+    0xE0911,
+    0x1200091,
+    0xE0911,
+    0x1220010,
+    0x18A1810,
+    0x1200091,
+    0xE0911,
+    0xE0511,
+    0x200130,
+    0x809C0,
+    0x4C418,
+    0xE0511,
+    0x200130,
+    0x101118,
+    0x4C418,
+    0xE0511,
+    0x480A,
+    0x200130,
+    0x4C418,
+    0xE0511,
+    0x200130,
+    0x1200091,
+    0x4C418,
+    0xE0511,
+    0x200130,
+    0x1200091,
+    0x4C418,
+    0x1220010,
+    0xE0511,
+    0x18A1810,
+    0x200130,
+    0x1200091,
+    0x4C418,
+    0xE0511,
+    0x809C0,
+    0x840100,
+    0x4C418,
+    0xE0511,
+    0x101118,
+    0x840100,
+    0x4C418,
+    0xE0511,
+    0x480A,
+    0x840100,
+    0x4C418,
+    0xE0511,
+    0x1200091,
+    0x840100,
+    0x4C418,
+    0xE0511,
+    0x1200091,
+    0x840100,
+    0x4C418,
+    0x1220010,
+    0xE0511,
+    0x18A1810,
+    0x1200091,
+    0x840100,
+    0x4C418,
+    0xE0511,
+    0x801D0,
+    0x809C0,
+    0x4C418,
+    0xE0511,
+    0x801D0,
+    0x101118,
+    0x4C418,
+    0xE0511,
+    0x480A,
+    0x801D0,
+    0x4C418,
+    0xE0511,
+    0x801D0,
+    0x1200091,
+    0x4C418,
+    0xE0511,
+    0x801D0,
+    0x1200091,
+    0x4C418,
+    0x1220010,
+    0xC07,
+    0x809C0,
+    0x8E118,
+    0xE0001,
+    0xA0090,
+    0xC07,
+    0x101118,
+    0x8E118,
+    0xE0001,
+    0xA0090,
+    0xC07,
+    0x8E118,
+    0xE0001,
+    0xA0090,
+    0x101118,
+    0x40A990,
+    0x8E118,
+    0xE0001,
+    0xA0090,
+    0xC07,
+    0x124020,
+    0x809C0,
+    0x8E118,
+    0xE0001,
+    0xC07,
+    0x124020,
+    0x101118,
+    0x8E118,
+    0xE0001,
+    0xC07,
+    0x124020,
+    0x8E118,
+    0xE0001,
+    0x124020,
+    0x101118,
+    0x40A990,
+    0x8E118,
+    0xE0001,
+    0x124020,
+    0x809C0,
+    0x282151,
+    0x40A990,
+    0x8E118,
+    0x260010,
+    0xE0001,
+    0xC07,
+    0x200130,
+    0x809C0,
+    0x8E118,
+    0xE0001,
+    0xC07,
+    0x200130,
+    0x1200091,
+    0x8E118,
+    0xE0001,
+    0xC07,
+    0x101118,
+    0x8E118,
+    0x840100,
+    0xE0001,
+    0xC07,
+    0x1200091,
+    0x8E118,
+    0x840100,
+    0xE0001,
+    0x40A990,
+    0x8E118,
+    0x840100,
+    0xE0001,
+    0xC07,
+    0x801D0,
+    0x101118,
+    0x8E118,
+    0xE0001,
+    0xC07,
+    0x801D0,
+    0x1200091,
+    0x8E118,
+    0xE0001,
+    0xC07,
+    0x801D0,
+    0x1200091,
+    0x8E118,
+    0xE0001,
+    0x1220010,
+    0x801D0,
+    0x1200091,
+    0x40A990,
+    0x8E118,
+    0xE0001,
+    0xC07,
+    0x809C0,
+    0x8E118,
+    0xE0001,
+    0x680810,
+    0xC07,
+    0x1200091,
+    0x8E118,
+    0xE0001,
+    0x680810,
+    0x1200091,
+    0x40A990,
+    0x8E118,
+    0xE0001,
+    0x680810,
+    0x2091C,
+    0xA2951,
+    0x2091C,
+    0x282151,
+    0xA2951,
+    0x2091C,
+    0x170011,
+    0x2091C,
+    0x282151,
+    0x170011,
+    0x2110,
+    0x8E118,
+    0xE0001,
+    0x480190,
+    0x2043,
+    0x887915,
+    0x2A2118,
+    0x21401,
+    0x8E100,
+    0x20003,
+    0x26412,
+    0xA8019,
+    0x120810,
+    0x10AC0C1,
+    0x2A0915,
+    0x280C1,
+    0xA8001,
+    0xC6114,
+    0x464904,
+    0x42140,
+    0x60119,
+    0xFFFFFFFFFFFFFFFF,
+    0x181801,
+    0x4,
+    0x10AC1C4,
+    0x42140,
+    0x2851,
+    0xE0417,
+    0xE0015,
+    0x226094,
+    0x181950,
+    0x80830,
+    0x194010,
+    0x266094,
+    0x10481A,
+    0x21401,
+    0x8E140,
+    0x196101,
+    0x10AC0C1,
+    0x86151,
+    0x86000,
+    0x2859,
+    0x40089,
+    0x42140,
+    0x10AC0C1,
+    0x20000,
+    0xE0158,
+    0x21401,
+    0x42140,
+    0xA0019,
+    0x8801,
+    0x27005,
+    0x224013,
+    0x226910,
+    0x20058,
+    0x124080,
+    0x2C020,
+    0x42140,
+    0x2000000014B900,
+    0x48000000,
+    0xC8015,
+    0xE4945,
+    0x192912,
+    0x143100,
+    0x148800,
+    0x42140,
+    0x82015,
+    0x180015,
+    0x86010,
+    0x2911,
+    0x21401,
+    0x280C1,
+    0x28081,
+    0x42C904,
+    0x42140,
+    0x84008,
+    0x1AA114,
+    0x1918,
+    0x85108,
+    0x6001,
+    0x5005,
+    0x26151,
+    0x20450,
+    0x8F108,
+    0x80911,
+    0x10AC0C1,
+    0x91D,
+    0x2851,
+    0xE0417,
+    0xE0015,
+    0x226094,
+    0x181950,
+    0x194010,
+    0xA01C0,
+    0x10481A,
+    0x21401,
+    0x8E140,
+    0x196101,
+    0x2A2118,
+    0x21401,
+    0x1D6110,
+    0x1A2018,
+    0x18F905,
+    0x1189900,
+    0x42140,
+    0xC1110,
+    0xE2115,
+    0x86101,
+    0x1AC00C,
+    0x200118,
+    0x246108,
+    0x144812,
+    0x42140,
+    0xA1119,
+    0x42140,
+    0x424001,
+    0xA0914,
+    0x144090,
+    0x424099,
+    0x108000,
+    0x424099,
+    0x406008,
+    0x2AC314,
+    0x2E8114,
+    0x2910,
+    0x1600001,
+    0x8801,
+    0x2954,
+    0x80830,
+    0x1C8910,
+    0x2954,
+    0xA01C0,
+    0x8801,
+    0x4C6918,
+    0x24820,
+    0x80830,
+    0x24820,
+    0xA01C0,
+    0x85002,
+    0x2C004,
+    0xA01C0,
+    0x85002,
+    0x2C004,
+    0x80830,
+    0x2C004,
+    0xA01C0,
+    0x8C000,
+    0x2C004,
+    0x80830,
+    0x8C000,
+    0x2152,
+    0x2910,
+    0x86000,
+    0x260018,
+    0x42140,
+    0x42510,
+    0x2006850,
+    0x40C900,
+    0x170011,
+    0x1002001,
+    0x20005,
+    0x2910,
+    0xCE100,
+    0xCE100,
+    0xC3050,
+    0x160035,
+    0xE4014,
+    0x2401C,
+    0x8E890,
+    0xA610D,
+    0xCE100,
+    0x1A0010,
+    0x170011,
+    0x680119,
+    0x880000000,
+    0x700D,
+    0xE2110,
+    0x44100,
+    0x1000410,
+    0xAE151,
+    0x8815,
+    0x42140,
+    0x10C1010,
+    0x2910,
+    0x21411,
+    0x86000,
+    0x42140,
+    0x1A2018,
+    0x26014,
+    0x80830,
+    0x8C000,
+    0x26014,
+    0xA01C0,
+    0x8C000,
+    0x85002,
+    0x26014,
+    0x80830,
+    0x85002,
+    0x26014,
+    0xA01C0,
+    0x8A1,
+    0xA2951,
+    0x8C000,
+    0x85002,
+    0x8A1,
+    0xA2951,
+    0x426020,
+    0x41910,
+    0x424099,
+    0x60003,
+    0x482012,
+    0xA2010,
+    0x20A6981,
+    0x1000410,
+    0x484000,
+    0x108000,
+    0x1000410,
+    0x8E100,
+    0x80818,
+    0x60011,
+    0x1000410,
+    0xA01C0,
+    0x804002,
+    0x20815,
+    0x1000410,
+    0xA2855,
+    0x1AD014,
+    0x102441B,
+    0x2851,
+    0xA0417,
+    0x80830,
+    0x8E140,
+    0x2851,
+    0xA0417,
+    0x8E140,
+    0xA01C0,
+    0x80818,
+    0x60011,
+    0x1000410,
+    0x80830,
+    0x2002012,
+    0x22140,
+    0x10A290C,
+    0x801,
+    0x126009,
+    0x2C930,
+    0x10E1010,
+    0x1A6000,
+    0x84801,
+    0x47118,
+    0x26140,
+    0x6905,
+    0xA8011,
+    0x4C810,
+    0x1A6016,
+    0x1E6514,
+    0x8801,
+    0x1013,
+    0x186925,
+    0x1045802,
+    0x8801,
+    0x186925,
+    0x110009,
+    0x150180,
+    0x1045802,
+    0x8801,
+    0x110811,
+    0x186925,
+    0x110009,
+    0x1045802,
+    0x8801,
+    0x200118,
+    0x186925,
+    0x110009,
+    0x1045802,
+    0x8801,
+    0x7109,
+    0x186925,
+    0x110009,
+    0x1045802,
+    0x8801,
+    0x186925,
+    0x84200,
+    0x110009,
+    0x1045802,
+    0x8801,
+    0x20914,
+    0x186925,
+    0x110009,
+    0x1045802,
+    0x8801,
+    0x20914,
+    0x186925,
+    0xC0910,
+    0x1045802,
+    0x8801,
+    0x20914,
+    0x186925,
+    0x84200,
+    0x1045802,
+    0x8801,
+    0x20003,
+    0x186925,
+    0x40881,
+    0x1045802,
+    0x8801,
+    0x40C87,
+    0x20003,
+    0x186925,
+    0x1045802,
+    0x8801,
+    0x186925,
+    0x110009,
+    0x40881,
+    0x1045802,
+    0x8801,
+    0x40C87,
+    0x186925,
+    0x110009,
+    0x1045802,
+    0x8801,
+    0x186925,
+    0x40810,
+    0x110009,
+    0x1045802,
+    0x82081,
+    0x8801,
+    0x186925,
+    0xA0051,
+    0x110009,
+    0x1045802,
+    0x82081,
+    0x8801,
+    0x186925,
+    0x4E0839,
+    0x1045802,
+    0x202011,
+    0x8801,
+    0x186925,
+    0x4E01C9,
+    0x1045802,
+    0x202011,
+    0x8801,
+    0x424001,
+    0x186925,
+    0x4E0839,
+    0x110009,
+    0x1045802,
+    0x8801,
+    0x424001,
+    0x186925,
+    0x110009,
+    0x4E01C9,
+    0x1045802,
+    0x8801,
+    0x40C87,
+    0x20914,
+    0x186925,
+    0x1045802,
+    0x8801,
+    0x406008,
+    0x186925,
+    0x1045802,
+    0x80405,
+    0x12201B,
+    0x108000,
+    0x8801,
+    0x80819,
+    0x186925,
+    0xC0910,
+    0x1045802,
+    0x8801,
+    0xA0015,
+    0x406008,
+    0x186925,
+    0x110009,
+    0x1045802,
+    0x8801,
+    0x80819,
+    0x186925,
+    0x110009,
+    0x1045802,
+    0x8801,
+    0x406008,
+    0x186925,
+    0x84200,
+    0x1045802,
+    0x80405,
+    0x108000,
+    0x8801,
+    0x186925,
+    0x1045802,
+    0x568009,
+    0x202011,
+    0x8801,
+    0x424001,
+    0x186925,
+    0x110009,
+    0x1045802,
+    0x568009,
+    0x8801,
+    0x406008,
+    0x186925,
+    0x224013,
+    0x1045802,
+    0x80405,
+    0x108000,
+    0x8801,
+    0x818,
+    0x186925,
+    0xC0910,
+    0x1045802,
+    0x8801,
+    0xA0015,
+    0x186925,
+    0x110009,
+    0x1045802,
+    0x108000,
+    0x8801,
+    0x818,
+    0x186925,
+    0x110009,
+    0x1045802,
+    0x8801,
+    0x406008,
+    0x186925,
+    0x84200,
+    0x1045802,
+    0x80405,
+    0x108000,
+    0x8801,
+    0x466009,
+    0x186925,
+    0x1045802,
+    0x202011,
+    0x8801,
+    0x424001,
+    0x466009,
+    0x186925,
+    0x110009,
+    0x1045802,
+    0x8801,
+    0x186925,
+    0x194010,
+    0x1045802,
+    0x12201B,
+    0x8801,
+    0x80819,
+    0x186925,
+    0x1045802,
+    0x12201B,
+    0x8801,
+    0x7109,
+    0x186925,
+    0x1045802,
+    0x12201B,
+    0x8801,
+    0x186925,
+    0x84200,
+    0x1045802,
+    0x12201B,
+    0x8801,
+    0x20914,
+    0x186925,
+    0x1045802,
+    0x12201B,
+    0x8801,
+    0x186925,
+    0x84200,
+    0x44090,
+    0x1045802,
+    0x108000,
+    0x8801,
+    0x186925,
+    0x110009,
+    0x194010,
+    0x1045802,
+    0x8801,
+    0x20914,
+    0x186925,
+    0xE0001,
+    0x1045802,
+    0x8801,
+    0x6804,
+    0x186925,
+    0x110009,
+    0x1045802,
+    0x8801,
+    0x60119,
+    0x406008,
+    0x186925,
+    0x1045802,
+    0x80405,
+    0x108000,
+    0x8801,
+    0x818,
+    0x60119,
+    0x186925,
+    0x1045802,
+    0x8801,
+    0x60119,
+    0x186925,
+    0xE0001,
+    0x1045802,
+    0x8801,
+    0x60119,
+    0x186925,
+    0x84080,
+    0x84200,
+    0x1045802,
+    0x8801,
+    0x20914,
+    0x60119,
+    0x186925,
+    0x24890,
+    0x1045802,
+    0x8801,
+    0x406008,
+    0x186925,
+    0x44090,
+    0xC0910,
+    0x1045802,
+    0x8801,
+    0x186925,
+    0x80830,
+    0x44090,
+    0xC0910,
+    0x1045802,
+    0x8801,
+    0x60119,
+    0x186925,
+    0x61500,
+    0x1045802,
+    0x80918,
+    0x8801,
+    0x60119,
+    0x186925,
+    0xA0051,
+    0x1045802,
+    0x82081,
+    0x8801,
+    0x20003,
+    0x5005,
+    0x186925,
+    0x1045802,
+    0x8801,
+    0x818,
+    0x186925,
+    0x1045802,
+    0x80918,
+    0x8801,
+    0x186925,
+    0x1045802,
+    0x2000918,
+    0x8801,
+    0x186925,
+    0xC0910,
+    0x1045802,
+    0x80918,
+    0x8801,
+    0x186925,
+    0x47914,
+    0x1045802,
+    0x12201B,
+    0x8801,
+    0x110811,
+    0x186925,
+    0x86000,
+    0x110009,
+    0x1045802,
+    0x8801,
+    0x186925,
+    0x110009,
+    0x1D6110,
+    0x1045802,
+    0x8801,
+    0xA0015,
+    0x406008,
+    0x186925,
+    0x1045802,
+    0x80918,
+    0x8801,
+    0xA0015,
+    0x186925,
+    0x1045802,
+    0x80918,
+    0x108000,
+    0x8801,
+    0x186925,
+    0x84101,
+    0x1045802,
+    0x8801,
+    0x186925,
+    0x24080,
+    0x1045802,
+    0x8801,
+    0x186925,
+    0x5051,
+    0x1045802,
+    0x8881,
+    0x8801,
+    0x186925,
+    0x1045802,
+    0x12201B,
+    0x8801,
+    0x4E910,
+    0x186925,
+    0x1045802,
+    0x12201B,
+    0x8801,
+    0x186925,
+    0x84101,
+    0x1045802,
+    0x12201B,
+    0x8801,
+    0x186925,
+    0x5051,
+    0x1045802,
+    0x12201B,
+    0x8881,
+    0x8801,
+    0x186925,
+    0x1045802,
+    0x494,
+    0x21401,
+    0x86000,
+    0x2851,
+    0x424001,
+    0x466009,
+    0xA01C0,
+    0x2000141,
+    0x804002,
+    0xE010,
+    0x164898,
+    0x812,
+    0x1045802,
+    0x84008,
+    0x2910,
+    0x1918,
+    0x2A0915,
+    0xE6110,
+    0x1045802,
+    0x1C6104,
+    0x1045802,
+    0x122918,
+    0x1C610C,
+    0x1045802,
+    0x122918,
+    0x49191,
+    0x1045802,
+    0xCF104,
+    0x1045802,
+    0xA2014,
+    0xA2014,
+    0x2910,
+    0x170011,
+    0x2A0915,
+    0x480190,
+    0xA2010,
+    0x1045802,
+    0x2A2911,
+    0x1000410,
+    0x1045802,
+    0xA6804,
+    0x1890,
+    0x1045802,
+    0x20003,
+    0x2091C,
+    0x20A6981,
+    0x86084,
+    0x148011,
+    0x20413,
+    0x2091C,
+    0x406008,
+    0x1AA110,
+    0xA2951,
+    0x424001,
+    0x26412,
+    0x20914,
+    0x48015,
+    0x4E6090,
+    0x1045802,
+    0x106008,
+    0xC7813,
+    0x1045802,
+    0x10E0190,
+    0x1045802,
+    0x1A0104,
+    0xE010,
+    0x18C000,
+    0x1045802,
+    0x1088010,
+    0x1A0104,
+    0xE010,
+    0x18C000,
+    0x1045802,
+    0x1088010,
+    0x406008,
+    0x18C000,
+    0x248111,
+    0x108800,
+    0x1045802,
+    0x18C000,
+    0x248111,
+    0x108800,
+    0x1045802,
+    0x108000,
+    0x1A2014,
+    0xA011C,
+    0x25020,
+    0x1045802,
+    0x484000,
+    0x186124,
+    0x4E4031,
+    0x1045802,
+    0x8801,
+    0x186925,
+    0x110009,
+    0x1045802,
+    0x191D,
+    0x1000410,
+    0xEC011,
+    0x1045802,
+    0x8051,
+    0x36C110,
+    0x882010,
+    0x8051,
+    0xAA100,
+    0x62014,
+    0x1045802,
+    0x20815,
+    0x62014,
+    0x1045802,
+    0x4480,
+    0x80830,
+    0xEA191,
+    0x128010,
+    0x8C6110,
+    0x80830,
+    0xEA191,
+    0x4480,
+    0x80830,
+    0x424810,
+    0xEA191,
+    0x4480,
+    0xEA191,
+    0xA01C0,
+    0x128010,
+    0x8C6110,
+    0xEA191,
+    0xA01C0,
+    0x4480,
+    0x424810,
+    0xEA191,
+    0xA01C0,
+    0xA0417,
+    0x26014,
+    0x80830,
+    0x170011,
+    0x128010,
+    0xA0417,
+    0x8C6110,
+    0x80830,
+    0x170011,
+    0xA0417,
+    0x26014,
+    0x80830,
+    0x424810,
+    0x170011,
+    0xA0417,
+    0x26014,
+    0xA01C0,
+    0x170011,
+    0x128010,
+    0xA0417,
+    0x8C6110,
+    0xA01C0,
+    0x170011,
+    0xA0417,
+    0x26014,
+    0x424810,
+    0xA01C0,
+    0x170011,
+    0xA0417,
+    0x1120804,
+    0x4480,
+    0x80830,
+    0x128010,
+    0xA0417,
+    0x1120804,
+    0x80830,
+    0x1918,
+    0x8114,
+    0xA0417,
+    0x1120804,
+    0x4480,
+    0x80830,
+    0x424810,
+    0xA0417,
+    0x1120804,
+    0x8C6110,
+    0xA0417,
+    0x1120804,
+    0x4480,
+    0xA01C0,
+    0x128010,
+    0xA0417,
+    0x1120804,
+    0x1918,
+    0x8114,
+    0xA01C0,
+    0xA0417,
+    0x1120804,
+    0x4480,
+    0x424810,
+    0xA01C0,
+    0x8C6110,
+    0xA2951,
+    0x8C6110,
+    0x20A6981,
+    0x2910,
+    0xA0417,
+    0x1120804,
+    0x80830,
+    0x424810,
+    0x1C5095,
+    0xA01C0,
+    0xC6114,
+    0x128010,
+    0xA0417,
+    0x1120804,
+    0x80830,
+    0x424810,
+    0x1C5095,
+    0xA01C0,
+    0xC6114,
+    0x128010,
+    0x1C7101,
+    0x8C000,
+    0x85002,
+    0x1C7101,
+    0xA0417,
+    0x170011,
+    0x8C000,
+    0x85002,
+    0xA0417,
+    0x170011,
+    0x85002,
+    0xA0417,
+    0x224010,
+    0x170011,
+    0x8C000,
+    0x85002,
+    0x2090D,
+    0x1045802,
+    0x804002,
+    0x80830,
+    0x2910,
+    0x2A0915,
+    0x804002,
+    0x2910,
+    0xA01C0,
+    0x2A0915,
+    0x20A6981,
+    0x2910,
+    0x42005,
+    0x20A6981,
+    0x2910,
+    0x42005,
+    0x20A6981,
+    0x2910,
+    0x42005,
+    0x20A6981,
+    0x2910,
+    0x42005,
+    0x10E2118,
+    0x809C0,
+    0xA01C0,
+    0x1045802,
+    0x8C000,
+    0x2A0915,
+    0x85002,
+    0x10E2118,
+    0x809C0,
+    0xA01C0,
+    0x1045802,
+    0x2A0915,
+    0x20914,
+    0x10E2118,
+    0x809C0,
+    0x1045802,
+    0x2A0915,
+    0x20914,
+    0x10E2118,
+    0x406008,
+    0x20A6981,
+    0x809C0,
+    0x1045802,
+    0x20914,
+    0x10E2118,
+    0x20A6981,
+    0x809C0,
+    0x1045802,
+    0x108000,
+    0x10E2118,
+    0x809C0,
+    0x1045802,
+    0xA2951,
+    0x2A0915,
+    0x10E2118,
+    0x406008,
+    0x20A6981,
+    0x809C0,
+    0x1045802,
+    0xA2951,
+    0x10E2118,
+    0x20A6981,
+    0x809C0,
+    0x1045802,
+    0xA2951,
+    0x108000,
+    0x10E2118,
+    0x809C0,
+    0x1045802,
+    0x2A0915,
+    0x600011,
+    0x10E2118,
+    0x406008,
+    0x20A6981,
+    0x809C0,
+    0x1045802,
+    0x600011,
+    0x10E2118,
+    0x20A6981,
+    0x809C0,
+    0x1045802,
+    0x108000,
+    0x600011,
+    0x10E2118,
+    0x406008,
+    0x20A6981,
+    0x809C0,
+    0x1045802,
+    0x10E2118,
+    0x20A6981,
+    0x809C0,
+    0x1045802,
+    0x108000,
+    0x10E2118,
+    0x80830,
+    0x809C0,
+    0x1045802,
+    0x8C000,
+    0x2A0915,
+    0x85002,
+    0x10E2118,
+    0x80830,
+    0x809C0,
+    0x1045802,
+    0x2A0915,
+    0x84020,
+    0x170011,
+    0x1A2010,
+    0x1045802,
+    0x186002,
+    0x80214,
+    0x1045802,
+    0x8C6110,
+    0x2910,
+    0x2A0915,
+    0x220012,
+    0xA1915,
+    0x6840,
+    0xA1915,
+    0x224010,
+    0xE4080,
+    0x6840,
+    0xA1915,
+    0x224010,
+    0xE4080,
+    0x6840,
+    0xA1915,
+    0x224010,
+    0xE4080,
+    0x484000,
+    0x6840,
+    0xA1915,
+    0x224010,
+    0xE4080,
+    0x484000,
+    0x6318,
+    0xA1915,
+    0xE4080,
+    0x484000,
+    0xA1915,
+    0xE1110,
+    0xA1915,
+    0xE1011,
+    0xA1915,
+    0xCB011,
+    0xA0091,
+    0x126048,
+    0x140030,
+    0xEA191,
+    0x8C000,
+    0x85002,
+    0xEA191,
+    0xA0417,
+    0x1120804,
+    0x8C000,
+    0x85002,
+    0xA0417,
+    0x1120804,
+    0xA0417,
+    0x40890,
+    0x8C000,
+    0xE4110,
+    0x85002,
+    0xA0417,
+    0x40890,
+    0xE4110,
+    0x21A9111,
+    0x480190,
+    0x2002012,
+    0x20914,
+    0x22140,
+    0xE21D1,
+    0xC2831,
+    0x5,
+    0x1A2014,
+    0xA0915,
+    0xE6114,
+    0x191D,
+    0x88E010,
+    0x1045802,
+    0x424001,
+    0x186002,
+    0x882010,
+    0x42014,
+    0xA0405,
+    0xA2951,
+    0x20003,
+    0xC07,
+    0xA8095,
+    0x10481A,
+    0x2018,
+    0x930,
+    0x8E140,
+    0xA01C0,
+    0x48500,
+    0x2A0915,
+    0x424001,
+    0x186002,
+    0xC0801,
+    0x36C110,
+    0x42014,
+    0xA0405,
+    0xA2951,
+    0x20003,
+    0xC07,
+    0xA8095,
+    0x10481A,
+    0x930,
+    0x80830,
+    0x8E140,
+    0x48500,
+    0xE0001,
+    0x2A0915,
+    0x424001,
+    0x186002,
+    0x148011,
+    0x1008801,
+    0xA01C0,
+    0xA2951,
+    0x20003,
+    0xC07,
+    0x10481A,
+    0x8E140,
+    0x84850,
+    0x2A0915,
+    0x4C04,
+    0x4CC085,
+    0x81110,
+    0x4C04,
+    0xA1110,
+    0x407,
+    0xC07,
+    0x80830,
+    0x101118,
+    0x8E140,
+    0x260010,
+    0xA2951,
+    0xC07,
+    0x424029,
+    0x101118,
+    0x8E140,
+    0xA01C0,
+    0xA2951,
+    0xC07,
+    0x62115,
+    0x101118,
+    0x8E140,
+    0xA2951,
+    0x108000,
+    0xC07,
+    0x6001D,
+    0x406008,
+    0x101118,
+    0x8E140,
+    0xA2951,
+    0x20003,
+    0x186002,
+    0x10481A,
+    0x148011,
+    0x2A0915,
+    0x186002,
+    0x170011,
+    0xCC000,
+    0xC07,
+    0x186002,
+    0x20914,
+    0x2401C,
+    0xC07,
+    0x42C010,
+    0x1045802,
+    0x4020,
+    0x42C010,
+    0x1045802,
+    0x42C010,
+    0x1045802,
+    0x42C010,
+    0x48810,
+    0x1045802,
+    0x1000010,
+    0x264012,
+    0x1045802,
+    0xA01C2,
+    0x1060001,
+    0x48015,
+    0x142000,
+    0x1142000,
+    0x4A0091,
+    0xC07,
+    0x20815,
+    0x10480C,
+    0x4A0091,
+    0x110480C,
+    0x869C4,
+    0x22101,
+    0x121813,
+    0x1022101,
+    0x4A0091,
+    0x480C,
+    0x3001,
+    0x446000,
+    0x447001,
+    0x1446000,
+    0x4A0091,
+    0x85014,
+    0x48015,
+    0xC07,
+    0xE0001,
+    0xE0001,
+    0x480190,
+    0x829C0,
+    0x1E7098,
+    0x1995,
+    0x4848,
+    0x142000,
+    0x1045802,
+    0x1995,
+    0x4215D,
+    0x6018,
+    0x1C7903,
+    0x1045802,
+    0x1995,
+    0x4215C,
+    0x6018,
+    0x1128120,
+    0x1045802,
+    0x1995,
+    0x186304,
+    0x1000009,
+    0x1045802,
+    0xCE100,
+    0xE090,
+    0x8E890,
+    0xC07,
+    0x8E890,
+    0x480190,
+    0x84803,
+    0x804002,
+    0xFFFFFFFFFFFFFFFF,
+    0x84803,
+    0x804002,
+    0x494,
+    0x49C,
+    0x6018,
+    0x4020,
+    0x80504,
+    0x84803,
+    0x804002,
+    0x422019,
+    0x64004,
+    0xE0911,
+    0xC0000,
+    0x8114,
+    0x441C0,
+    0x480190,
+    0xC07,
+    0x8114,
+    0x441C0,
+    0x60180,
+    0x8A801,
+    0x65485,
+    0x180812,
+    0x24821,
+    0xA0091,
+    0x260018,
+    0xA4019,
+    0xC07,
+    0x802118,
+    0x80830,
+    0x8E140,
+    0xC07,
+    0x802118,
+    0x8E140,
+    0xA01C0,
+    0x802118,
+    0x80830,
+    0x8E140,
+    0x480190,
+    0x22170,
+    0x2089,
+    0x802118,
+    0x8E100,
+    0x8E140,
+    0xC0180,
+    0x108000,
+    0x480190,
+    0xC0120,
+    0x802118,
+    0x8E140,
+    0xA01C0,
+    0xA1010,
+    0x10AC1C5,
+    0x480190,
+    0x406008,
+    0x802118,
+    0x8E140,
+    0x480190,
+    0x6012,
+    0x66016,
+    0x19,
+    0x80099,
+    0x35,
+    0xE7010,
+    0x140C00,
+    0x4E100,
+    0x186105,
+    0x42140,
+    0x2A411D,
+    0x42140,
+    0x202418B,
+    0x42140,
+    0x14001D,
+    0x2481,
+    0xE2185,
+    0x64004,
+    0x8A4088,
+    0x26950,
+    0x184,
+    0xE51C5,
+    0xC6115,
+    0x64004,
+    0x24080,
+    0x64004,
+    0x26911,
+    0x64004,
+    0x161A11,
+    0x8E010,
+    0x49910,
+    0xE2014,
+    0x41901,
+    0x141900,
+    0x23009,
+    0x26950,
+    0xE0001,
+    0x60121,
+    0x22101,
+    0x1045802,
+    0x109,
+    0x2489,
+    0xC0581,
+    0x21091,
+    0x40D14,
+    0x29D1,
+    0x8015,
+    0x108835,
+    0x1045802,
+    0x18092C,
+    0x240910,
+    0x26950,
+    0x84001,
+    0xC4101,
+    0x84801,
+    0x1002041,
+    0x1002100,
+    0x1002141,
+    0x202091,
+    0x10012101,
+    0xA1141,
+    0x40100108,
+    0xC11,
+    0xA1141,
+    0x20130,
+    0x10000900,
+    0xA1141,
+    0x1A2098,
+    0xA1141,
+    0x42002090,
+    0xA1141,
+    0x402108,
+    0x40902000,
+    0x20002401,
+    0xA1141,
+    0x4A0011,
+    0x40002050,
+    0x187101,
+    0xA1141,
+    0xA0091,
+    0x8102400,
+    0xA1141,
+    0x1C018A,
+    0x21089,
+    0x26950,
+    0x400890,
+    0x35,
+    0x426020,
+    0x426160,
+    0x40009,
+    0x480190,
+    0x35,
+    0x1008081,
+    0x186918,
+    0x820819,
+    0x41910,
+    0x43940,
+    0x1000009,
+    0x200091,
+    0x2114,
+    0x480190,
+    0xC07,
+    0x35,
+    0x43940,
+    0x4D005,
+    0x1060001,
+    0x142000,
+    0x480190,
+    0x1995,
+    0xE0120,
+    0x7000,
+    0x1B0011,
+    0x260910,
+    0x1045802,
+    0x1995,
+    0xC0801,
+    0x7000,
+    0x1B0011,
+    0x260910,
+    0x1045802,
+    0x1995,
+    0x19E2911,
+    0x1121014,
+    0x370D14,
+    0x1045802,
+    0x1831,
+    0x42140,
+    0x407001,
+    0x1995,
+    0x2C014,
+    0x1045802,
+    0x342010,
+    0x1995,
+    0x1087101,
+    0xA0091,
+    0x1045802,
+    0x1811,
+    0x3001,
+    0x42140,
+    0x1995,
+    0x26100,
+    0x61001,
+    0x1045802,
+    0x1995,
+    0x1A8310,
+    0x1045802,
+    0x82100,
+    0x1995,
+    0x819,
+    0x1E2001,
+    0x1045802,
+    0x1995,
+    0x18B901,
+    0x1045802,
+    0x162001,
+    0x1995,
+    0x1C1182,
+    0x18A010,
+    0x1045802,
+    0xC2941,
+    0x18C800,
+    0x40094,
+    0x2540,
+    0x480190,
+    0x40094,
+    0x112010,
+    0x480190,
+    0x40094,
+    0x24400,
+    0x480190,
+    0x4C182,
+    0x40094,
+    0x480190,
+    0x40094,
+    0x825C0,
+    0x480190,
+    0x40094,
+    0x40A001,
+    0x480190,
+    0xC07,
+    0x40094,
+    0x2540,
+    0xC07,
+    0x40094,
+    0x112010,
+    0xC07,
+    0x40094,
+    0x24400,
+    0x4C182,
+    0xC07,
+    0x40094,
+    0xC07,
+    0x40094,
+    0x825C0,
+    0x40094,
+    0x108018,
+    0x80A81B,
+    0x40A001,
+    0xC07,
+    0x2000D,
+    0x1051,
+    0x48019,
+    0x1C0100,
+    0xC07,
+    0xA0091,
+    0x1C0100,
+    0x480190,
+    0x7109,
+    0x1C0100,
+    0x480190,
+    0x2000D,
+    0x100806,
+    0x140806,
+    0x1051,
+    0x1C0100,
+    0xC07,
+    0x48019,
+    0x1C0100,
+    0x480190,
+    0x2000D,
+    0x87110,
+    0x1051,
+    0xA0091,
+    0xE0091,
+    0x1C0100,
+    0xC07,
+    0x282911,
+    0x2000D,
+    0x7109,
+    0x1051,
+    0x1C0100,
+    0xC07,
+    0x100806,
+    0x1C0100,
+    0x480190,
+    0x84080,
+    0xEE1C0,
+    0x6A140,
+    0xC3151,
+    0xA4094,
+    0x86010,
+    0x1B0011,
+    0x801D0,
+    0x141104,
+    0x86010,
+    0x330011,
+    0x101B,
+    0x801D0,
+    0xC6010,
+    0x370011,
+    0x101B,
+    0xC6010,
+    0x371111,
+    0x8C2190,
+    0x5812,
+    0x80821,
+    0x141104,
+    0x86010,
+    0x42140,
+    0x141104,
+    0x1A2801,
+    0x42140,
+    0xFFFFFFFFFFFFFFFF,
+    0x40118,
+    0x141104,
+    0x86010,
+    0x68081,
+    0x43,
+    0x186004,
+    0x802120,
+    0x86101,
+    0x42140,
+    0x64004,
+    0x1060105,
+    0x4C0010,
+    0x64004,
+    0xC0011,
+    0x1060105,
+    0x1022954,
+    0x1045802,
+    0x362911,
+    0xC8905,
+    0x1022954,
+    0x1045802,
+    0x1088010,
+    0xC8905,
+    0x1022954,
+    0x1045802,
+    0x1088010,
+    0xC8905,
+    0x1022954,
+    0x1045802,
+    0x1088010,
+    0xC8905,
+    0x1022954,
+    0x1045802,
+    0x1088010,
+    0xC8905,
+    0x1022954,
+    0x1045802,
+    0x1088010,
+    0xC8905,
+    0x1022954,
+    0x1045802,
+    0x1088010,
+    0xC8905,
+    0x1022954,
+    0x1045802,
+    0x1088010,
+    0x22154,
+    0xE1911,
+    0x1022954,
+    0x1045802,
+    0x1020814,
+    0x1022954,
+    0x1045802,
+    0xC07,
+    0x362911,
+    0x28011,
+    0x102081C,
+    0x1045802,
+    0x28011,
+    0x10A8901,
+    0x102081C,
+    0x1045802,
+    0x224030,
+    0x1082120,
+    0x10601A,
+    0x362911,
+    0x10D,
+    0x6000,
+    0x28011,
+    0xAB011,
+    0x42140,
+    0x118,
+    0x35,
+    0x118,
+    0x35,
+    0x118,
+    0x35,
+    0x118,
+    0x35,
+    0x118,
+    0x35,
+    0x118,
+    0x35,
+    0x20914,
+    0x84008,
+    0xA01C0,
+    0x480190,
+    0x20914,
+    0xC4008,
+    0x484000,
+    0x480190,
+    0xC07,
+    0x20914,
+    0x84008,
+    0xA01C0,
+    0x480190,
+    0xC07,
+    0x20914,
+    0xC4008,
+    0x484000,
+    0x480190,
+    0x27041,
+    0x1002041,
+    0x27041,
+    0x1002100,
+    0x21149,
+    0xA0051,
+    0x1002041,
+    0x21149,
+    0x60810,
+    0x1002100,
+    0x21149,
+    0x60810,
+    0x1002041,
+    0x21149,
+    0xA0051,
+    0x1002100,
+    0x861,
+    0x480190,
+    0xC07,
+    0x861,
+    0x21091,
+    0x8504,
+    0x84800,
+    0x1000009,
+    0x3140,
+    0xC1913,
+    0x426540,
+    0x6401C,
+    0x464008,
+    0x40E011,
+    0x86105,
+    0x1A685B,
+    0xD18,
+    0x49001,
+    0x10A1901,
+    0xA1010,
+    0x148915,
+    0x191D,
+    0x311C,
+    0xC0021,
+    0x1045802,
+    0xA1010,
+    0x2817,
+    0x1C0314,
+    0x20903,
+    0x40815,
+    0x40815,
+    0x84800,
+    0x4801D0,
+    0x200410D,
+    0x16A31C,
+    0x851,
+    0xA1010,
+    0x1917,
+    0x10E1194,
+    0x84800,
+    0x1995,
+    0xA1010,
+    0x86907,
+    0x424830,
+    0xA1010,
+    0x4044,
+    0x4048D4,
+    0x20051,
+    0x84800,
+    0x10868D4,
+    0xC4800,
+    0x61090,
+    0xC0021,
+    0xC0191,
+    0x85001,
+    0x1045802,
+    0xC6901,
+    0x49001,
+    0x122815,
+    0x20000000160938,
+    0xC25C0,
+    0x18,
+    0x120830,
+    0x40900,
+    0x186918,
+    0xE0001,
+    0x480190,
+    0x226154,
+    0x42910,
+    0xA01C0,
+    0x47010,
+    0x4A551,
+    0xA0090,
+    0x12644F,
+    0x226154,
+    0x80830,
+    0x42910,
+    0x4A551,
+    0xA0090,
+    0x186105,
+    0x422141,
+    0x42140,
+    0x10481A,
+    0x1831,
+    0x19C5991,
+    0x42140,
+    0x10481A,
+    0x19C5991,
+    0x1811,
+    0x42140,
+    0x1831,
+    0x19E4991,
+    0xA6D1C,
+    0x1811,
+    0x42140,
+    0x1166049,
+    0x1086003,
+    0x1831,
+    0xAD19D,
+    0x8E2110,
+    0x1811,
+    0x42140,
+    0x1995,
+    0x164004,
+    0x26100,
+    0x1811,
+    0x42140,
+    0xE4410,
+    0x1045802,
+    0xE2059,
+    0x1045802,
+    0xE2059,
+    0x1831,
+    0x1811,
+    0x42140,
+    0xE4410,
+    0x1995,
+    0x26100,
+    0x1811,
+    0x42140,
+    0xE4410,
+    0x1045802,
+    0x2A0915,
+    0x1995,
+    0x20A6981,
+    0x26100,
+    0x1811,
+    0x42140,
+    0xE4410,
+    0x1045802,
+    0xA409A,
+    0x20914,
+    0x2059,
+    0x1006851,
+    0x101118,
+    0x41801,
+    0x480190,
+    0x21151,
+    0x1045802,
+    0x22411C,
+    0x1045802,
+    0xEA191,
+    0x1045802,
+    0x123119,
+    0x6124,
+    0x19,
+    0x80099,
+    0x229111,
+    0x12011A,
+    0x1006851,
+    0x40091,
+    0x80099,
+    0x122831,
+    0x122000,
+    0xA101D,
+    0x1006851,
+    0x1A2010,
+    0x60014,
+    0x48801,
+    0x106200,
+    0x2C0011,
+    0x26184,
+    0xC07,
+    0x80980,
+    0x7000,
+    0x8C0910,
+    0x8C1910,
+    0x912104,
+    0x1F0119,
+    0x1000410,
+    0x4C04,
+    0xAA811,
+    0x170019,
+    0x1E00C9,
+    0x3001,
+    0x480190,
+    0x1E00C9,
+    0x2540,
+    0x480190,
+    0xC07,
+    0x1E00C9,
+    0x3001,
+    0xC07,
+    0x1E00C9,
+    0x2540,
+    0x22101,
+    0x1022101,
+    0x4A0091,
+    0xC07,
+    0x1200091,
+    0x446000,
+    0x447001,
+    0x10480C,
+    0x829C0,
+    0x22101,
+    0x1A2098,
+    0x1E7098,
+    0x8114,
+    0x441C0,
+    0x1A2018,
+    0x480190,
+    0xC07,
+    0x8114,
+    0x441C0,
+    0x1A2018,
+    0x7109,
+    0x170011,
+    0x480190,
+    0x8211D,
+    0x66144,
+    0x42811,
+    0x20005,
+    0x4091B,
+    0x21091,
+    0x3140,
+    0x8504,
+    0x84800,
+    0x1E6104,
+    0x122018,
+    0x20005,
+    0x1000104,
+    0x24009,
+    0x42948,
+    0x109,
+    0x64004,
+    0x35,
+    0x80081,
+    0x81890,
+    0x160014,
+    0xFFFFFFFFFFFFFFFF,
+    0x83115,
+    0x480190,
+    0x424410,
+    0x2091C,
+    0x4481C,
+    0x66144,
+    0x42811,
+    0x24009,
+    0x2185,
+    0x42185,
+    0x130118,
+    0x10A0010,
+    0xA2811,
+    0x80830,
+    0x6010,
+    0xA0125,
+    0x1400001,
+    0xC07,
+    0x80830,
+    0xA0125,
+    0x484000,
+    0x1400001,
+    0x80830,
+    0xA0125,
+    0x484000,
+    0x1400001,
+    0x480190,
+    0xC07,
+    0x2811,
+    0x80830,
+    0x21050,
+    0x2811,
+    0x80830,
+    0x21050,
+    0x480190,
+    0x220118,
+    0x42140,
+    0x444800,
+    0x406008,
+    0x220118,
+    0x1200091,
+    0x8E140,
+    0x444800,
+    0xA2951,
+    0x480190,
+    0x4481C,
+    0x10A2010,
+    0x80830,
+    0x4481C,
+    0x10A2010,
+    0xE0911,
+    0x170019,
+    0xC07,
+    0x20914,
+    0x4481C,
+    0x6949,
+    0x2961,
+    0x20851,
+    0x170011,
+    0x240994,
+    0x480190,
+    0xA2811,
+    0xC07,
+    0x4481C,
+    0x20851,
+    0x1024800,
+    0x1A0404,
+    0x240994,
+    0x10A2010,
+    0x80830,
+    0xE011C,
+    0x10A2010,
+    0x80830,
+    0xE011C,
+    0xE7905,
+    0x1045802,
+    0x162001,
+    0x204013,
+    0x20914,
+    0xC4008,
+    0x1200091,
+    0x4134,
+    0x108906,
+    0xE4410,
+    0x484000,
+    0xAB051,
+    0x8A891,
+    0x8A851,
+    0x2099,
+    0xA291D,
+    0xAB051,
+    0xA01C0,
+    0x2099,
+    0xA291D,
+    0x80830,
+    0xAB051,
+    0x2A2118,
+    0xAB051,
+    0xC07,
+    0x64004,
+    0xCC981,
+    0x40998,
+    0x26950,
+    0xC6180,
+    0x62190,
+    0xA4100,
+    0xC0815,
+    0xE4184,
+    0xC0110,
+    0x10A4025,
+    0x20051,
+    0x100082,
+    0x584180,
+    0x20051,
+    0x42899,
+    0x8A801,
+    0x42C010,
+    0x1C6103,
+    0x1C49D0,
+    0x9001,
+    0x1045802,
+    0x187101,
+    0x126048,
+    0x22101,
+    0x142000,
+    0x121813,
+    0x821C3,
+    0x97,
+    0x84003,
+    0x1020030,
+    0x6A051,
+    0xA3911,
+    0x66014,
+    0x124020,
+    0xE6114,
+    0x170011,
+    0x40500,
+    0x60510,
+    0x446000,
+    0xE4010,
+    0x114,
+    0xC0411,
+    0xC2541,
+    0x22500,
+    0x80995,
+    0x803,
+    0xC0C13,
+    0x106146,
+    0x4F185,
+    0x2091A,
+    0x82010,
+    0x6E010,
+    0x1028811,
+    0x4A4080,
+    0x938,
+    0x1143141,
+    0xA0405,
+    0x2403,
+    0x4A211,
+    0x1045802,
+    0x10A1014,
+    0x1220059,
+    0xC6099,
+    0x25911,
+    0x28401,
+    0x1045802,
+    0xC07,
+    0x108004,
+    0x220118,
+    0x1E2011,
+    0x170011,
+    0xC07,
+    0x203C,
+    0x861,
+    0x24034,
+    0x20A6981,
+    0x4A211,
+    0x1918,
+    0x40830,
+    0xC0110,
+    0xE8110,
+    0x480190,
+    0xC07,
+    0x10C0031,
+    0x64104,
+    0x81B,
+    0x64104,
+    0x128010,
+    0x180004,
+    0x182144,
+    0x28011,
+    0x64104,
+    0x84800,
+    0xC07,
+    0x81B,
+    0x424810,
+    0x64104,
+    0x64104,
+    0x480190,
+    0x86905,
+    0x42140,
+    0x8E890,
+    0x220118,
+    0x88011,
+    0x2E811,
+    0x2A911,
+    0x1000820,
+    0x1002960,
+    0x80210,
+    0xA811,
+    0x2A0811,
+    0x20000000001911,
+    0x1911,
+    0x20E810,
+    0xA0810,
+    0x40819,
+    0x2089,
+    0x8015,
+    0x200000,
+    0x12A4104,
+    0x1051,
+    0x28011,
+    0x24404,
+    0x64104,
+    0x2089,
+    0x4A0110,
+    0x4A2140,
+    0x424810,
+    0xA914,
+    0xA01C0,
+    0xA914,
+    0xA914,
+    0xA01C0,
+    0x128010,
+    0x2102,
+    0x480190,
+    0xC07,
+    0x2102,
+    0xA010,
+    0x494,
+    0x21401,
+    0xFFFFFFFFFFFFFFFF,
+    0x494,
+    0x49C,
+    0x21495,
+    0x6018,
+    0x1200091,
+    0x21401,
+    0x80504,
+    0x18F905,
+    0xFFFFFFFFFFFFFFFF,
+    0x2815,
+    0x18F905,
+    0x1189900,
+    0x42140,
+    0x800000,
+    0x1200091,
+    0x84803,
+    0x84803,
+    0x1200091,
+    0x64004,
+    0x20450,
+    0x186918,
+    0x64004,
+    0x20450,
+    0x1200091,
+    0xA2014,
+    0x64004,
+    0xE010,
+    0xA2014,
+    0x64004,
+    0x1200091,
+    0xE010,
+    0xE0184,
+    0xE2185,
+    0x64004,
+    0x82901,
+    0x26950,
+    0x64004,
+    0x82901,
+    0x444099,
+    0x480190,
+    0x64004,
+    0x82901,
+    0x186918,
+    0x64004,
+    0xC1811,
+    0x200109,
+    0x400210,
+    0x440390,
+    0x141309,
+    0x26950,
+    0xE0001,
+    0xE0511,
+    0x124020,
+    0x4C418,
+    0xAC019,
+    0xE0511,
+    0x6803,
+    0x124020,
+    0x4C418,
+    0xE0511,
+    0x6803,
+    0x124020,
+    0x1200091,
+    0x4C418,
+    0xE0511,
+    0x100806,
+    0x124020,
+    0x4C418,
+    0xC07,
+    0x124020,
+    0x8E118,
+    0xE0001,
+    0x124020,
+    0x8E118,
+    0xE0001,
+    0x480190,
+    0x186918,
+    0xE0001,
+    0xE0010,
+    0x480190,
+    0x2091C,
+    0xE0001,
+    0x480190,
+    0xC07,
+    0xA2014,
+    0xE010,
+    0xE0001,
+    0xC07,
+    0xA2014,
+    0xE0001,
+    0x480190,
+    0xC07,
+    0x186918,
+    0xE0001,
+    0xC07,
+    0x1200091,
+    0x186918,
+    0xE0001,
+    0x40A990,
+    0xE0001,
+    0x444099,
+    0xE0001,
+    0x480190,
+    0xE0511,
+    0x1200091,
+    0xE0511,
+    0xA2014,
+    0xE010,
+    0x4000000000000,
+    0xE0511,
+    0x200000000CC5D8,
+    0x801D0,
+    0x4C418,
+    0x4000000000000,
+    0x2000000008E1D8,
+    0xE0001,
+    0xC07,
+    0x801D0,
+    0x8E118,
+    0x801D0,
+    0x40A990,
+    0x8E118,
+    0xE0001,
+    0xC07,
+    0x8E118,
+    0x840100,
+    0xE0001,
+    0xC07,
+    0x801D0,
+    0x8E118,
+    0xA2915,
+    0xE0001,
+    0xC07,
+    0x801D0,
+    0x1200091,
+    0x8E118,
+    0xA2915,
+    0xE0001,
+    0xC07,
+    0x8E118,
+    0xE0001,
+    0x680810,
+    0xE0511,
+    0x8E118,
+    0x8C2110,
+    0x1E0003,
+    0xE0511,
+    0x4C418,
+    0xAC019,
+    0xE0511,
+    0xA2014,
+    0xE010,
+    0x4C418,
+    0xAC019,
+    0xE0511,
+    0x1200091,
+    0x4C418,
+    0xAC019,
+    0xC07,
+    0xA4830,
+    0x88819,
+    0x840100,
+    0x480190,
+    0xC07,
+    0xA4830,
+    0xA4830,
+    0x480190,
+    0xC07,
+    0x801D0,
+    0xA4830,
+    0x186918,
+    0x88819,
+    0xA2014,
+    0x2091C,
+    0x801D0,
+    0xE010,
+    0x8E118,
+    0xE0001,
+    0xE0511,
+    0x1200091,
+    0x40A990,
+    0x4C418,
+    0xAC019,
+    0x480C,
+    0x446000,
+    0x446C31,
+    0x4A0091,
+    0x446C31,
+    0x801C0,
+    0xA4931,
+    0x226094,
+    0x1200091,
+    0x446C31,
+    0x4000000000000,
+    0x68C11,
+    0x1200091,
+    0x68C11,
+    0xE0511,
+    0x6803,
+    0x605,
+    0x4C418,
+    0xE0511,
+    0x801D0,
+    0x2C810,
+    0x4C418,
+    0xAC019,
+    0xE0511,
+    0x801D0,
+    0x1200091,
+    0x2C810,
+    0x4C418,
+    0xAC019,
+    0x1A6023,
+    0x20914,
+    0x444099,
+    0x480190,
+    0x2C008,
+    0x424810,
+    0xA01C0,
+    0x444099,
+    0x170011,
+    0x480190,
+    0x2C008,
+    0xA01C0,
+    0x444099,
+    0x170011,
+    0x128010,
+    0x480190,
+    0x424810,
+    0xA01C0,
+    0x444099,
+    0x170011,
+    0x480190,
+    0xA01C0,
+    0x444099,
+    0x170011,
+    0x128010,
+    0x480190,
+    0xC07,
+    0x7109,
+    0x143100,
+    0x480190,
+    0x20003,
+    0x809C0,
+    0x2A0915,
+    0x20003,
+    0x101118,
+    0x2A0915,
+    0x20003,
+    0x1200091,
+    0x2A0915,
+    0x5005,
+    0x1200091,
+    0x21401,
+    0xA7011,
+    0x196101,
+    0x42950,
+    0x1A2018,
+    0x5005,
+    0x1200091,
+    0x21401,
+    0xA7011,
+    0x196101,
+    0x42950,
+    0x5005,
+    0x10481A,
+    0x1200091,
+    0x21401,
+    0xA7011,
+    0x196101,
+    0x1A2018,
+    0x5005,
+    0x10481A,
+    0x1200091,
+    0x21401,
+    0xA7011,
+    0x196101,
+    0x5005,
+    0x1200091,
+    0x404800,
+    0x21401,
+    0xA7011,
+    0x196101,
+    0x42950,
+    0x5005,
+    0x10481A,
+    0x1200091,
+    0x404800,
+    0x21401,
+    0xA7011,
+    0x196101,
+    0x32001C,
+    0xA7011,
+    0x280C1,
+    0x42140,
+    0xC1010,
+    0x887915,
+    0x1200091,
+    0x21401,
+    0xA7011,
+    0x887915,
+    0xA0091,
+    0x1200091,
+    0x21401,
+    0x18E105,
+    0xA7011,
+    0x87110,
+    0xA0091,
+    0x204810,
+    0x20018,
+    0xC07,
+    0x1200091,
+    0xC07,
+    0x180812,
+    0xA0091,
+    0x1200091,
+    0xA4019,
+    0x140809,
+    0x24821,
+    0xA0091,
+    0x831,
+    0x180812,
+    0x24821,
+    0xA0091,
+    0x20099,
+    0x1200100,
+    0x831,
+    0xA4019,
+    0x80830,
+    0x101118,
+    0xA7011,
+    0xEA191,
+    0x101118,
+    0xA7011,
+    0xEA191,
+    0xA01C0,
+    0x82839,
+    0x80830,
+    0x101118,
+    0xA7011,
+    0xEA191,
+    0x82839,
+    0x101118,
+    0xA7011,
+    0xEA191,
+    0xA01C0,
+    0x2851,
+    0xA0417,
+    0x80830,
+    0x101118,
+    0xA7011,
+    0x8E140,
+    0x2851,
+    0xA0417,
+    0x101118,
+    0xA7011,
+    0x8E140,
+    0xA01C0,
+    0x2851,
+    0x1200091,
+    0x80830,
+    0x21401,
+    0xA7011,
+    0x8E140,
+    0x196101,
+    0x2851,
+    0x1200091,
+    0x21401,
+    0xA7011,
+    0x8E140,
+    0x196101,
+    0xA01C0,
+    0x2851,
+    0xA0417,
+    0x1200091,
+    0x80830,
+    0xA7011,
+    0x8E140,
+    0x2851,
+    0xA0417,
+    0x1200091,
+    0xA7011,
+    0x8E140,
+    0xA01C0,
+    0xA0417,
+    0x80830,
+    0x809C0,
+    0xA7011,
+    0x40890,
+    0xE4110,
+    0xA0417,
+    0x809C0,
+    0xA7011,
+    0xA01C0,
+    0x40890,
+    0xE4110,
+    0xA0417,
+    0x1120804,
+    0x80830,
+    0x101118,
+    0xA7011,
+    0xA0417,
+    0x1120804,
+    0x101118,
+    0xA7011,
+    0xA01C0,
+    0x2091C,
+    0x80148,
+    0x8214B,
+    0x282151,
+    0x6010,
+    0x2091C,
+    0x80148,
+    0x8214B,
+    0x282151,
+    0x484000,
+    0x2091C,
+    0x80148,
+    0x8214B,
+    0x282151,
+    0xA0090,
+    0x2091C,
+    0x80148,
+    0x8214B,
+    0x124020,
+    0x282151,
+    0x2091C,
+    0x80148,
+    0x8214B,
+    0x200130,
+    0x282151,
+    0x2091C,
+    0x80148,
+    0x8214B,
+    0x282151,
+    0x840100,
+    0x2091C,
+    0x80148,
+    0x8214B,
+    0x282151,
+    0x242010,
+    0x2091C,
+    0x80148,
+    0x8214B,
+    0x801D0,
+    0x282151,
+    0x2091C,
+    0x80148,
+    0x8214B,
+    0x282151,
+    0x2110,
+    0x2091C,
+    0x8214B,
+    0x282151,
+    0x123012,
+    0x82010,
+    0x2091C,
+    0x80148,
+    0x8214B,
+    0x6010,
+    0x42001,
+    0x60130,
+    0x2091C,
+    0x80148,
+    0x8214B,
+    0x42001,
+    0x60130,
+    0x484000,
+    0x2091C,
+    0x80148,
+    0x8214B,
+    0x42001,
+    0x60130,
+    0xA0090,
+    0x2091C,
+    0x80148,
+    0x8214B,
+    0x124020,
+    0x42001,
+    0x60130,
+    0x2091C,
+    0x80148,
+    0x8214B,
+    0x200130,
+    0x42001,
+    0x60130,
+    0x2091C,
+    0x80148,
+    0x8214B,
+    0x42001,
+    0x60130,
+    0x840100,
+    0x2091C,
+    0x80148,
+    0x8214B,
+    0x42001,
+    0x60130,
+    0x242010,
+    0x2091C,
+    0x80148,
+    0x8214B,
+    0x801D0,
+    0x42001,
+    0x60130,
+    0x2091C,
+    0x80148,
+    0x8214B,
+    0x2110,
+    0x42001,
+    0x60130,
+    0x2091C,
+    0x8214B,
+    0x123012,
+    0x42001,
+    0x60130,
+    0x82010,
+    0x2091C,
+    0x80148,
+    0x8214B,
+    0x282151,
+    0x6010,
+    0x42001,
+    0x60130,
+    0x2091C,
+    0x80148,
+    0x8214B,
+    0x282151,
+    0x42001,
+    0x60130,
+    0x484000,
+    0x2091C,
+    0x80148,
+    0x8214B,
+    0x282151,
+    0x42001,
+    0x60130,
+    0xA0090,
+    0x2091C,
+    0x80148,
+    0x8214B,
+    0x124020,
+    0x282151,
+    0x42001,
+    0x60130,
+    0x2091C,
+    0x80148,
+    0x8214B,
+    0x200130,
+    0x282151,
+    0x42001,
+    0x60130,
+    0x2091C,
+    0x80148,
+    0x8214B,
+    0x282151,
+    0x42001,
+    0x60130,
+    0x840100,
+    0x2091C,
+    0x80148,
+    0x8214B,
+    0x282151,
+    0x42001,
+    0x60130,
+    0x242010,
+    0x2091C,
+    0x80148,
+    0x8214B,
+    0x801D0,
+    0x282151,
+    0x42001,
+    0x60130,
+    0x2091C,
+    0x80148,
+    0x8214B,
+    0x282151,
+    0x2110,
+    0x42001,
+    0x60130,
+    0x2091C,
+    0x8214B,
+    0x282151,
+    0x123012,
+    0x42001,
+    0x60130,
+    0x82010,
+    0x424001,
+    0x99,
+    0x1200091,
+    0x4E01C9,
+    0x400118,
+    0x424001,
+    0xC0011,
+    0x1200091,
+    0x1C4080,
+    0x424001,
+    0x1200091,
+    0x4E01C9,
+    0x424001,
+    0xC0011,
+    0x1200091,
+    0xA6080,
+    0x424001,
+    0xA2169,
+    0x8E100,
+    0x4E01C9,
+    0x424001,
+    0x1200091,
+    0x4E01C9,
+    0x126008,
+    0x88118,
+    0x424001,
+    0x99,
+    0x4E01C9,
+    0xA2951,
+    0x424001,
+    0x99,
+    0x1200091,
+    0x4E01C9,
+    0xA2951,
+    0x424001,
+    0x40099,
+    0x99,
+    0x4E01C9,
+    0xA2951,
+    0x424001,
+    0x40099,
+    0x99,
+    0x1200091,
+    0x4E01C9,
+    0xA2951,
+    0x424001,
+    0x2290D,
+    0xA611C,
+    0xC0011,
+    0xA01C0,
+    0xC07,
+    0x4E01C9,
+    0x424099,
+    0x809D8,
+    0x4E01C9,
+    0xA0090,
+    0x8C000,
+    0x424099,
+    0x85002,
+    0x809D8,
+    0x4E01C9,
+    0xA0090,
+    0x424099,
+    0xC07,
+    0x4E01C9,
+    0x424001,
+    0xC07,
+    0x32001C,
+    0x466009,
+    0x1200091,
+    0x4E01C9,
+    0x424001,
+    0xC07,
+    0x32001C,
+    0x1200091,
+    0x4E01C9,
+    0x568009,
+    0x424001,
+    0xC07,
+    0x4E01C9,
+    0x1D0001,
+    0x424001,
+    0xC07,
+    0x206015,
+    0x1200091,
+    0x8E118,
+    0x4E01C9,
+    0x424001,
+    0xA01C0,
+    0x4E01C9,
+    0x40099,
+    0x480190,
+    0x424001,
+    0x80830,
+    0x4E01C9,
+    0x40099,
+    0x480190,
+    0x424001,
+    0x407,
+    0x4E01C9,
+    0x444099,
+    0x80918,
+    0x480190,
+    0x424001,
+    0xA6020,
+    0x4E01C9,
+    0x444099,
+    0x80918,
+    0x480190,
+    0x424001,
+    0x1200091,
+    0x424810,
+    0xA01C0,
+    0x4E01C9,
+    0x444099,
+    0x480190,
+    0x424001,
+    0x1200091,
+    0xA01C0,
+    0x4E01C9,
+    0x444099,
+    0x128010,
+    0x480190,
+    0x424001,
+    0x424810,
+    0x8609C,
+    0xA01C0,
+    0x4E01C9,
+    0x444099,
+    0x480190,
+    0x424001,
+    0x8609C,
+    0xA01C0,
+    0x4E01C9,
+    0x444099,
+    0x128010,
+    0x480190,
+    0x424001,
+    0x2091C,
+    0x1200091,
+    0x4E01C9,
+    0x480190,
+    0x424001,
+    0xA00B9,
+    0x4E01C9,
+    0x480190,
+    0x424001,
+    0xC07,
+    0xC0011,
+    0xA00B9,
+    0x1C4080,
+    0x424001,
+    0xC07,
+    0xA00B9,
+    0x4E01C9,
+    0x424001,
+    0xC07,
+    0xC0011,
+    0xA00B9,
+    0xA6080,
+    0x424001,
+    0xC07,
+    0xC0011,
+    0xA00B9,
+    0x1200091,
+    0x1C4080,
+    0x424001,
+    0xC07,
+    0xA00B9,
+    0x1200091,
+    0x4E01C9,
+    0x424001,
+    0xC07,
+    0xC0011,
+    0xA00B9,
+    0x1200091,
+    0xA6080,
+    0x424001,
+    0x2001B,
+    0x4E01C9,
+    0xAC019,
+    0x424001,
+    0x1200091,
+    0x4E01C9,
+    0x42499,
+    0xAC019,
+    0x424001,
+    0x4E01C9,
+    0x80919,
+    0x400058,
+    0x424001,
+    0x1200091,
+    0x4E01C9,
+    0x80919,
+    0x400058,
+    0x424001,
+    0xE010,
+    0x186918,
+    0x4E01C9,
+    0x424001,
+    0xC0011,
+    0xA6080,
+    0x480190,
+    0x424001,
+    0xA6080,
+    0x4C0010,
+    0x480190,
+    0x424001,
+    0xC0011,
+    0x1C4080,
+    0x480190,
+    0x424001,
+    0x1C4080,
+    0x4C0010,
+    0x480190,
+    0x424001,
+    0x80830,
+    0xA01C0,
+    0x480190,
+    0x424001,
+    0x2290D,
+    0xA611C,
+    0x80830,
+    0x4C0010,
+    0xC07,
+    0x4E0839,
+    0x424001,
+    0x2290D,
+    0xA611C,
+    0xA6080,
+    0x108000,
+    0xC07,
+    0x568009,
+    0x424001,
+    0x2290D,
+    0xA611C,
+    0x406008,
+    0x1C4080,
+    0xC07,
+    0x466009,
+    0x424001,
+    0xC07,
+    0xC0011,
+    0xA6080,
+    0x424001,
+    0xC07,
+    0xA6080,
+    0x4C0010,
+    0x424001,
+    0xC07,
+    0xC0011,
+    0x1C4080,
+    0x424001,
+    0xC07,
+    0x1C4080,
+    0x4C0010,
+    0x424001,
+    0xC07,
+    0x80830,
+    0xA01C0,
+    0x424001,
+    0xC07,
+    0x406008,
+    0x108000,
+    0x424001,
+    0x466009,
+    0x4E01C9,
+    0x88100,
+    0x424001,
+    0x4E01C9,
+    0x88100,
+    0x568009,
+    0x424001,
+    0x466009,
+    0x4E0839,
+    0x88100,
+    0x424001,
+    0x4E0839,
+    0x88100,
+    0x568009,
+    0xC07,
+    0x8A1,
+    0x170011,
+    0x8C000,
+    0xC07,
+    0x85002,
+    0x8A1,
+    0x170011,
+    0xC07,
+    0x6949,
+    0x8A1,
+    0xA01C0,
+    0x170011,
+    0x128010,
+    0xC07,
+    0x6949,
+    0x8A1,
+    0x80830,
+    0x424810,
+    0x170011,
+    0xC07,
+    0x7109,
+    0x8A1,
+    0x80830,
+    0xC07,
+    0x7109,
+    0x8A1,
+    0xA01C0,
+    0xC07,
+    0x7109,
+    0x8A1,
+    0x8C000,
+    0xC07,
+    0x85002,
+    0x7109,
+    0x8A1,
+    0x84018,
+    0x170011,
+    0xC07,
+    0x41801,
+    0x170011,
+    0x1220010,
+    0x41801,
+    0x170011,
+    0x1220010,
+    0x480190,
+    0xC07,
+    0x8E051,
+    0x8E051,
+    0x480190,
+    0x8060D1,
+    0x480190,
+    0xC07,
+    0x8060D1,
+    0xC07,
+    0x8060D1,
+    0x20A6981,
+    0xC07,
+    0x20914,
+    0x20851,
+    0xC07,
+    0x7109,
+    0x101118,
+    0x7109,
+    0x101118,
+    0x480190,
+    0xC07,
+    0x2006850,
+    0x101118,
+    0x2006850,
+    0x101118,
+    0x480190,
+    0xC07,
+    0x7109,
+    0x41801,
+    0xC07,
+    0x2006850,
+    0x41801,
+    0x2006850,
+    0x41801,
+    0x480190,
+    0xC07,
+    0x48910,
+    0x20A6981,
+    0x48910,
+    0x20A6981,
+    0x480190,
+    0xC07,
+    0x48910,
+    0x2A0915,
+    0x48910,
+    0x2A0915,
+    0x480190,
+    0x424001,
+    0x20914,
+    0x80830,
+    0x41801,
+    0x464001,
+    0x4E0839,
+    0xA0090,
+    0x424001,
+    0x2091C,
+    0x80830,
+    0x148800,
+    0x424001,
+    0x4E0839,
+    0x6840,
+    0x150950,
+    0x424001,
+    0x99,
+    0x4E0839,
+    0xE4410,
+    0x484000,
+    0x2A0915,
+    0x424001,
+    0x10481A,
+    0x99,
+    0x4E0839,
+    0xE4410,
+    0x484000,
+    0x2A0915,
+    0x424001,
+    0x20003,
+    0x99,
+    0x4E0839,
+    0x484000,
+    0x424001,
+    0x40089,
+    0x99,
+    0x4E0839,
+    0xA8910,
+    0x484000,
+    0x424001,
+    0x84018,
+    0x4E0839,
+    0xC1010,
+    0x424001,
+    0x4E0839,
+    0xE4410,
+    0x80901,
+    0x2A0915,
+    0x424001,
+    0x10481A,
+    0x4E0839,
+    0xE4410,
+    0x80901,
+    0x2A0915,
+    0x424001,
+    0x99,
+    0x4E0839,
+    0x80901,
+    0x484000,
+    0x424001,
+    0x99,
+    0x4E0839,
+    0xE4410,
+    0x80901,
+    0x484000,
+    0x2A0915,
+    0x424001,
+    0x10481A,
+    0x99,
+    0x4E0839,
+    0xE4410,
+    0x80901,
+    0x484000,
+    0x2A0915,
+    0x424001,
+    0x4E0839,
+    0x1A40C0,
+    0x424001,
+    0x10A091C,
+    0x80830,
+    0x8E140,
+    0x600011,
+    0x204013,
+    0x424001,
+    0x150811,
+    0x4E0839,
+    0x42140,
+    0x204013,
+    0x424001,
+    0x4E0839,
+    0xAC011,
+    0x260010,
+    0x80918,
+    0x204013,
+    0xC5801,
+    0x424001,
+    0x110811,
+    0x4E0839,
+    0x260010,
+    0x424001,
+    0xA0051,
+    0x4E01C9,
+    0x82081,
+    0x1A40C0,
+    0x424001,
+    0x4E01C9,
+    0x1E8010,
+    0x1A40C0,
+    0x424001,
+    0x4E0839,
+    0x138819,
+    0x424001,
+    0x138819,
+    0x4E01C9,
+    0x204013,
+    0x424001,
+    0xAC011,
+    0x260010,
+    0x4E01C9,
+    0x80918,
+    0x204013,
+    0xC5801,
+    0x424001,
+    0x110811,
+    0x260010,
+    0x4E01C9,
+    0x204013,
+    0x424001,
+    0x4E0839,
+    0xAC011,
+    0x80918,
+    0x204013,
+    0xC5801,
+    0x424001,
+    0x110811,
+    0x4E0839,
+    0x204013,
+    0x424001,
+    0x4E0839,
+    0xAC011,
+    0x260010,
+    0x80918,
+    0x204013,
+    0x424001,
+    0xAC011,
+    0x260010,
+    0x4E01C9,
+    0x80918,
+    0x424001,
+    0x466009,
+    0x99,
+    0xA2951,
+    0x2000141,
+    0x424001,
+    0xA6080,
+    0xE4080,
+    0xC2819,
+    0x424001,
+    0xC2C1F,
+    0xE4080,
+    0x1C4080,
+    0xC07,
+    0x41801,
+    0xE0001,
+    0x41801,
+    0xE0001,
+    0x480190,
+    0xC07,
+    0x8E051,
+    0x8E140,
+    0xA01C0,
+    0x8E051,
+    0x8E140,
+    0xA01C0,
+    0x480190,
+    0x1200091,
+    0x42118,
+    0x4134,
+    0x204801,
+    0x1A8835,
+    0x20914,
+    0x1200091,
+    0x42118,
+    0x10B905,
+    0x4134,
+    0x20914,
+    0x1200091,
+    0x4020,
+    0x4134,
+    0x42C010,
+    0x1045802,
+    0x486000,
+    0x200951,
+    0x2091C,
+    0x1200091,
+    0xC914,
+    0xE0911,
+    0xC6101,
+    0x424001,
+    0x99,
+    0x4498,
+    0xA6080,
+    0xC2819,
+    0x424001,
+    0xC2C1F,
+    0x4498,
+    0x1C4080,
+    0x80901,
+    0x424001,
+    0x20A6981,
+    0xA6080,
+    0xC2819,
+    0x80901,
+    0x424001,
+    0xC2C1F,
+    0x20A6981,
+    0x1C4080,
+    0x80901,
+    0x424001,
+    0x82012,
+    0x466009,
+    0xC0011,
+    0xA6080,
+    0x8E140,
+    0x82090,
+    0x424001,
+    0x82012,
+    0x466009,
+    0xC0011,
+    0xA6080,
+    0x8E140,
+    0xE4080,
+    0x82090,
+    0x424001,
+    0x99,
+    0x4E0839,
+    0xA2951,
+    0x424001,
+    0x99,
+    0xA2951,
+    0x568009,
+    0x424001,
+    0x99,
+    0x4E01C9,
+    0xA2951,
+    0x424001,
+    0x466009,
+    0x99,
+    0xA2951,
+    0x424001,
+    0x99,
+    0x80830,
+    0xA01C0,
+    0xA2951,
+    0x424001,
+    0x406008,
+    0x99,
+    0xA2951,
+    0x108000,
+    0x424001,
+    0x99,
+    0xA6080,
+    0xA2951,
+    0x4C0010,
+    0x424001,
+    0xC0011,
+    0x99,
+    0xA6080,
+    0xA2951,
+    0x424001,
+    0xC0011,
+    0x99,
+    0x1C4080,
+    0xA2951,
+    0x424001,
+    0x99,
+    0x1C4080,
+    0xA2951,
+    0x4C0010,
+    0x424001,
+    0x40099,
+    0x99,
+    0x4E0839,
+    0xA2951,
+    0x424001,
+    0x40099,
+    0x99,
+    0xA2951,
+    0x568009,
+    0x424001,
+    0x40099,
+    0x99,
+    0x4E01C9,
+    0xA2951,
+    0x424001,
+    0x40099,
+    0x466009,
+    0x99,
+    0xA2951,
+    0x424001,
+    0x20914,
+    0x444D14,
+    0x99,
+    0xE010,
+    0xA2951,
+    0x4C6D15,
+    0x424001,
+    0x20914,
+    0x99,
+    0xE010,
+    0xA2951,
+    0x424001,
+    0x20003,
+    0x99,
+    0x80830,
+    0x4E0839,
+    0x80003,
+    0xA2951,
+    0x424001,
+    0x20003,
+    0x99,
+    0x80003,
+    0xA2951,
+    0x108000,
+    0x568009,
+    0x424001,
+    0x20003,
+    0x99,
+    0xA01C0,
+    0x4E01C9,
+    0x80003,
+    0xA2951,
+    0x424001,
+    0x20003,
+    0x406008,
+    0x466009,
+    0x99,
+    0x80003,
+    0xA2951,
+    0x424001,
+    0x20003,
+    0x99,
+    0x5090,
+    0xA6080,
+    0xA2951,
+    0x4C0010,
+    0x424001,
+    0x20003,
+    0xC0011,
+    0x99,
+    0xA6080,
+    0xA2951,
+    0x424001,
+    0x20003,
+    0xC0011,
+    0x2018,
+    0x99,
+    0x1C4080,
+    0xA2951,
+    0x424001,
+    0x20003,
+    0x99,
+    0x1C4080,
+    0xA2951,
+    0x4C0010,
+    0x424001,
+    0x10481A,
+    0x99,
+    0x20A6981,
+    0x4E0839,
+    0xE4410,
+    0xA2951,
+    0x2A0915,
+    0x424001,
+    0x10481A,
+    0x99,
+    0x20A6981,
+    0x8051,
+    0xE4410,
+    0xA2951,
+    0x108000,
+    0x568009,
+    0x424001,
+    0x10481A,
+    0x99,
+    0x20A6981,
+    0x4E01C9,
+    0xE4410,
+    0xA2951,
+    0x2A0915,
+    0x424001,
+    0x10481A,
+    0x406008,
+    0x466009,
+    0x99,
+    0x20A6981,
+    0x8051,
+    0xE4410,
+    0xA2951,
+    0x20A6981,
+    0x1000410,
+    0x80003,
+    0x1000410,
+    0x80003,
+    0x2A0915,
+    0x424001,
+    0x99,
+    0x4E0839,
+    0x224010,
+    0x4E01C9,
+    0xA2951,
+    0x424001,
+    0x466009,
+    0x99,
+    0x4E0839,
+    0xA2951,
+    0x568009,
+    0x424001,
+    0x99,
+    0x4E0839,
+    0x224010,
+    0x4E01C9,
+    0xA2951,
+    0x424001,
+    0x466009,
+    0x99,
+    0x4E0839,
+    0xA2951,
+    0x568009,
+    0x464001,
+    0x99,
+    0x4E0839,
+    0x28119,
+    0xA2951,
+    0x464001,
+    0x99,
+    0x28119,
+    0xA2951,
+    0x568009,
+    0x464001,
+    0x99,
+    0x28119,
+    0x4E01C9,
+    0xA2951,
+    0x464001,
+    0x466009,
+    0x99,
+    0x28119,
+    0xA2951,
+    0x424001,
+    0xC07,
+    0x2091C,
+    0x4E0839,
+    0x480190,
+    0x424001,
+    0xC07,
+    0x2091C,
+    0x568009,
+    0x480190,
+    0x424001,
+    0xC07,
+    0x2091C,
+    0x4E01C9,
+    0x480190,
+    0x424001,
+    0xC07,
+    0x2091C,
+    0x466009,
+    0x480190,
+    0x4C6D15,
+    0x424001,
+    0x99,
+    0xA01C0,
+    0x48099,
+    0xA2951,
+    0x4C6D15,
+    0x424001,
+    0x85002,
+    0x99,
+    0x48099,
+    0xA2951,
+    0x4C6D15,
+    0x424001,
+    0x99,
+    0x80830,
+    0x48099,
+    0xA2951,
+    0x4C6D15,
+    0x424001,
+    0x99,
+    0x48099,
+    0x8C000,
+    0xA2951,
+    0x80830,
+    0x1A2010,
+    0x1A2010,
+    0xA01C0,
+    0x80830,
+    0x402910,
+    0x402910,
+    0xA01C0,
+    0x4C6D15,
+    0x464001,
+    0x22944,
+    0x26014,
+    0x124020,
+    0xC800,
+    0x424001,
+    0xC07,
+    0x4E01C9,
+    0x204013,
+    0xCF115,
+    0x150811,
+    0x1082120,
+    0xA1911,
+    0x42140,
+    0xE6914,
+    0x1045802,
+    0x1088010,
+    0x424099,
+    0x1B0911,
+    0x4E0839,
+    0x809D8,
+    0xA0090,
+    0x8C000,
+    0x424099,
+    0x1B0911,
+    0x809D8,
+    0xA01C0,
+    0xA0090,
+    0x568009,
+    0x424099,
+    0x1B0911,
+    0x809D8,
+    0x4E01C9,
+    0xA0090,
+    0x8C000,
+    0x424099,
+    0x466009,
+    0x1B0911,
+    0x80830,
+    0x809D8,
+    0xA0090,
+    0x424099,
+    0xC07,
+    0x1B0911,
+    0x4E0839,
+    0x424099,
+    0xC07,
+    0x1B0911,
+    0x568009,
+    0x424099,
+    0xC07,
+    0x1B0911,
+    0x4E01C9,
+    0x424099,
+    0xC07,
+    0x466009,
+    0x1B0911,
+    0x424001,
+    0x466009,
+    0x99,
+    0x4E0839,
+    0x6840,
+    0x88100,
+    0xA2951,
+    0x424001,
+    0x466009,
+    0x99,
+    0x6840,
+    0x4E01C9,
+    0x88100,
+    0xA2951,
+    0x424001,
+    0x99,
+    0x4E0839,
+    0x6840,
+    0x88100,
+    0xA2951,
+    0x568009,
+    0x424001,
+    0x99,
+    0x6840,
+    0x4E01C9,
+    0x88100,
+    0xA2951,
+    0x568009,
+    0x424001,
+    0x99,
+    0x4E0839,
+    0x6840,
+    0x88100,
+    0xA2951,
+    0x568009,
+    0x424001,
+    0x99,
+    0x6840,
+    0x4E01C9,
+    0x88100,
+    0xA2951,
+    0x568009,
+    0x424001,
+    0x466009,
+    0x99,
+    0x4E0839,
+    0x6840,
+    0x88100,
+    0xA2951,
+    0x424001,
+    0x466009,
+    0x99,
+    0x6840,
+    0x4E01C9,
+    0x88100,
+    0xA2951,
+    0x424001,
+    0xC07,
+    0x32001C,
+    0x466009,
+    0x4E0839,
+    0x424001,
+    0xC07,
+    0x32001C,
+    0x466009,
+    0x4E01C9,
+    0x424001,
+    0xC07,
+    0x32001C,
+    0x4E0839,
+    0x568009,
+    0x424001,
+    0xC07,
+    0x32001C,
+    0x4E01C9,
+    0x568009,
+    0x424001,
+    0xC07,
+    0x32001C,
+    0x4E0839,
+    0x568009,
+    0x424001,
+    0xC07,
+    0x32001C,
+    0x4E01C9,
+    0x568009,
+    0x424001,
+    0xC07,
+    0x32001C,
+    0x466009,
+    0x4E0839,
+    0x424001,
+    0xC07,
+    0x32001C,
+    0x466009,
+    0x4E01C9,
+    0x424001,
+    0x406008,
+    0x80830,
+    0x26102,
+    0x424001,
+    0x406008,
+    0x26102,
+    0xA01C0,
+    0x424001,
+    0x80830,
+    0x26102,
+    0x108000,
+    0x424001,
+    0x26102,
+    0xA01C0,
+    0x108000,
+    0x424001,
+    0x80830,
+    0x26102,
+    0x108000,
+    0x424001,
+    0x26102,
+    0xA01C0,
+    0x108000,
+    0x424001,
+    0x406008,
+    0x80830,
+    0x26102,
+    0x424001,
+    0x406008,
+    0x26102,
+    0xA01C0,
+    0x424001,
+    0x20003,
+    0x48005,
+    0x20A6981,
+    0x4C04,
+    0x568009,
+    0x480190,
+    0x424099,
+    0x804002,
+    0x48015,
+    0xA2855,
+    0x108000,
+    0x4C182,
+    0x22E951,
+    0x28101,
+    0x170011,
+    0x480190,
+    0x4C182,
+    0xC07,
+    0x124804,
+    0xCC110,
+    0x22E951,
+    0x170011,
+    0x480190,
+    0x4C182,
+    0xC07,
+    0x124804,
+    0x22E951,
+    0x41011,
+    0x170011,
+    0x84803,
+    0x804002,
+    0x809C0,
+    0x2091C,
+    0x480A,
+    0x2091C,
+    0xC07,
+    0xA201C,
+    0x170011,
+    0xC07,
+    0xA201C,
+    0x7109,
+    0xC07,
+    0x8E051,
+    0x1A2018,
+    0xC07,
+    0x20A6981,
+    0x86045,
+    0xC07,
+    0x86045,
+    0xC07,
+    0xA201C,
+    0x101118,
+    0x8E140,
+    0xA2951,
+    0x108000,
+    0xC07,
+    0xA201C,
+    0x406008,
+    0x101118,
+    0x8E140,
+    0xA2951,
+    0xC07,
+    0xA201C,
+    0x80830,
+    0x101118,
+    0x8E140,
+    0xA2951,
+    0xC07,
+    0xA201C,
+    0x101118,
+    0x8E140,
+    0xA01C0,
+    0xA2951,
+    0x25020,
+    0x18A010,
+    0x484000,
+    0xC07,
+    0x20914,
+    0x8A1,
+    0x8C000,
+    0xC07,
+    0x85002,
+    0x20914,
+    0x8A1,
+    0xC07,
+    0x148004,
+    0x124020,
+    0x809C0,
+    0x8E118,
+    0xC07,
+    0x148004,
+    0x124020,
+    0x809C0,
+    0x8E118,
+    0xA4019,
+    0x148004,
+    0x124020,
+    0x8E118,
+    0x480190,
+    0x148004,
+    0x124020,
+    0x8E118,
+    0xA4019,
+    0x480190,
+    0xA610D,
+    0xCE100,
+    0x170011,
+    0x1130010,
+    0x42140,
+    0x11A2115,
+    0x12C040,
+    0x21401,
+    0x25020,
+    0x18C800,
+    0x484000,
+    0x25020,
+    0x18C800,
+    0xA0090,
+    0x25020,
+    0x124020,
+    0x18C800,
+    0x200130,
+    0x25020,
+    0x18C800,
+    0x1EE801,
+    0x6E111,
+    0xE0011,
+    0x10001D1,
+    0x14C880,
+    0x142010,
+    0x7000,
+    0x42811,
+    0x480190,
+    0xC07,
+    0x64004,
+    0x7109,
+    0x80980,
+    0x7000,
+    0x1A0010,
+    0xA0001,
+    0x809C0,
+    0x7000,
+    0x1A0010,
+    0x10C10C,
+    0x40099,
+    0x2140010,
+    0x66400,
+    0xE801,
+    0xC5019,
+    0x342805,
+    0x4E118,
+    0xC07,
+    0x8A1,
+    0x80830,
+    0xE0001,
+    0xC07,
+    0x8A1,
+    0xA01C0,
+    0xE0001,
+    0xC07,
+    0x8A1,
+    0x80830,
+    0xE0001,
+    0xC07,
+    0x8A1,
+    0xA01C0,
+    0xE0001,
+    0x424001,
+    0x464099,
+    0x164004,
+    0xC0021,
+    0x99,
+    0x80830,
+    0x4E0839,
+    0xA2951,
+    0x484000,
+    0x424001,
+    0x464099,
+    0x164004,
+    0xC0021,
+    0x99,
+    0xA2951,
+    0x484000,
+    0x108000,
+    0x568009,
+    0x424001,
+    0x464099,
+    0x164004,
+    0xC0021,
+    0x99,
+    0xA01C0,
+    0x4E01C9,
+    0xA2951,
+    0x484000,
+    0x424001,
+    0x464099,
+    0x164004,
+    0x406008,
+    0x466009,
+    0xC0021,
+    0x99,
+    0xA2951,
+    0x484000,
+    0x60110,
+    0x25020,
+    0x6010,
+    0x60110,
+    0x25020,
+    0x484000,
+    0x42019,
+    0xE4945,
+    0x162101,
+    0x1045802,
+    0x282950,
+    0xE4945,
+    0x206910,
+    0x162101,
+    0x1045802,
+    0xE4945,
+    0x192910,
+    0x162101,
+    0x1045802,
+    0xE4945,
+    0x206912,
+    0x162101,
+    0x1045802,
+    0xE4945,
+    0x162101,
+    0xC6051,
+    0x1045802,
+    0xE4945,
+    0x162101,
+    0x1045802,
+    0xA091C,
+    0x404812,
+    0xCF115,
+    0x150811,
+    0x1082120,
+    0xA1911,
+    0x42140,
+    0x44A001,
+    0x1045802,
+    0x182118,
+    0x44A001,
+    0xE8019,
+    0x1045802,
+    0x10481A,
+    0x44A001,
+    0x1045802,
+    0x48019,
+    0x40A001,
+    0x1045802,
+    0x2851,
+    0x260018,
+    0xA01C0,
+    0x584180,
+    0x60996,
+    0x148011,
+    0x1045802,
+    0x831,
+    0xA6080,
+    0x8E140,
+    0x4C0010,
+    0x831,
+    0x8E140,
+    0x1C4080,
+    0x4C0010,
+    0xC0011,
+    0x831,
+    0xA6080,
+    0x8E140,
+    0xC0011,
+    0x831,
+    0x8E140,
+    0x1C4080,
+    0x831,
+    0xA6080,
+    0x8E140,
+    0x1A2018,
+    0x4C0010,
+    0x831,
+    0x8E140,
+    0x1C4080,
+    0x1A2018,
+    0x4C0010,
+    0xC0011,
+    0x831,
+    0xA6080,
+    0x8E140,
+    0x1A2018,
+    0xC0011,
+    0x831,
+    0x8E140,
+    0x1C4080,
+    0x1A2018,
+    0x831,
+    0xA6080,
+    0x8E140,
+    0x202110,
+    0x4C0010,
+    0x831,
+    0x8E140,
+    0x1C4080,
+    0x202110,
+    0x4C0010,
+    0xC0011,
+    0x831,
+    0xA6080,
+    0x8E140,
+    0x202110,
+    0xC0011,
+    0x831,
+    0x8E140,
+    0x1C4080,
+    0x202110,
+    0x1200091,
+    0x831,
+    0xA6080,
+    0x8E140,
+    0x202110,
+    0x4C0010,
+    0x1200091,
+    0x831,
+    0x8E140,
+    0x1C4080,
+    0x202110,
+    0x4C0010,
+    0xC0011,
+    0x1200091,
+    0x831,
+    0xA6080,
+    0x8E140,
+    0x202110,
+    0xC0011,
+    0x1200091,
+    0x831,
+    0x8E140,
+    0x1C4080,
+    0x202110,
+    0x10000A,
+    0xA6080,
+    0x8E140,
+    0x4C0010,
+    0x10000A,
+    0x8E140,
+    0x1C4080,
+    0x4C0010,
+    0x10000A,
+    0xC0011,
+    0xA6080,
+    0x8E140,
+    0x10000A,
+    0xC0011,
+    0x8E140,
+    0x1C4080,
+    0x10000A,
+    0x1200091,
+    0xA6080,
+    0x8E140,
+    0x4C0010,
+    0x10000A,
+    0x1200091,
+    0x8E140,
+    0x1C4080,
+    0x4C0010,
+    0x10000A,
+    0xC0011,
+    0x1200091,
+    0xA6080,
+    0x8E140,
+    0x10000A,
+    0xC0011,
+    0x1200091,
+    0x8E140,
+    0x1C4080,
+    0x404880,
+    0xA7011,
+    0x190900,
+    0x170011,
+    0xC07,
+    0x404880,
+    0xA7011,
+    0x190900,
+    0x170011,
+    0x124828,
+    0x86400,
+    0xA7011,
+    0x190900,
+    0x44908,
+    0x170011,
+    0xC07,
+    0x124828,
+    0x262110,
+    0x86400,
+    0xA7011,
+    0x190900,
+    0x44908,
+    0x170011,
+    0x4E0839,
+    0xA4414,
+    0xA4414,
+    0x568009,
+    0x4E01C9,
+    0xA4414,
+    0x466009,
+    0xA4414,
+    0x6B019,
+    0x80010,
+    0x80905,
+    0x1A0951,
+    0x464815,
+    0xA7011,
+    0xE8104,
+    0x80010,
+    0x1200091,
+    0x1A0951,
+    0xA7011,
+    0xE8104,
+    0x80010,
+    0x1A0951,
+    0xE010,
+    0xA7011,
+    0x80010,
+    0x1200091,
+    0x1A0951,
+    0xE010,
+    0xA7011,
+    0x6B019,
+    0x1200091,
+    0xA7011,
+    0x6B019,
+    0x80905,
+    0xA7011,
+    0x440081,
+    0x5005,
+    0x10481A,
+    0x1200091,
+    0x21401,
+    0xA7011,
+    0x196101,
+    0x42001,
+    0x60130,
+    0x1A2018,
+    0x5005,
+    0x10481A,
+    0x1200091,
+    0x21401,
+    0xA7011,
+    0x196101,
+    0x42001,
+    0x60130,
+    0x5005,
+    0x10481A,
+    0x1200091,
+    0x404800,
+    0x21401,
+    0xA7011,
+    0x196101,
+    0x42001,
+    0x60130,
+    0x1200091,
+    0xA6153,
+    0xA7011,
+    0xA6153,
+    0xA7011,
+    0x42001,
+    0x60130,
+    0x1200091,
+    0xA6153,
+    0xA7011,
+    0x42001,
+    0x60130,
+    0x1200091,
+    0x144908,
+    0x1220010,
+    0x1200091,
+    0x260010,
+    0x144908,
+    0x1220010,
+    0x2400B,
+    0x20494,
+    0x2400B,
+    0x20494,
+    0x260010,
+    0x88905,
+    0x20450,
+    0x80091,
+    0xA0810,
+    0x20450,
+    0x80091,
+    0xA0810,
+    0x41801,
+    0x20185,
+    0x88905,
+    0x20450,
+    0xA0810,
+    0x49101,
+    0x20185,
+    0x20450,
+    0xA0810,
+    0x49101,
+    0x41801,
+    0x800119,
+    0x20450,
+    0x20511,
+    0x123811,
+    0x42140,
+    0x88905,
+    0x1149,
+    0x20450,
+    0xA0810,
+    0x100B981,
+    0x1149,
+    0x20450,
+    0xA0810,
+    0x100B981,
+    0x41801,
+    0x20450,
+    0x84101,
+    0x1E8106,
+    0x102F151,
+    0x20450,
+    0x182811,
+    0x260018,
+    0x41141,
+    0x41801,
+    0x1045802,
+    0x84018,
+    0x20450,
+    0x182811,
+    0x41141,
+    0x41801,
+    0x1045802,
+    0x84018,
+    0x20450,
+    0x182811,
+    0x260018,
+    0x41141,
+    0x41801,
+    0x1045802,
+    0x88905,
+    0x20450,
+    0xA0810,
+    0x1084000,
+    0x8881,
+    0x88905,
+    0x20450,
+    0xA0810,
+    0xC6000,
+    0x88905,
+    0x4E910,
+    0x20450,
+    0xA0810,
+    0xC6000,
+    0x88905,
+    0x80011,
+    0x20450,
+    0xA0810,
+    0xC6000,
+    0x88905,
+    0x20450,
+    0x84101,
+    0xA0810,
+    0xC6000,
+    0x88905,
+    0x20450,
+    0xA0810,
+    0x27104,
+    0xC6000,
+    0x88905,
+    0x20450,
+    0xA0810,
+    0xC6000,
+    0x14E900,
+    0x88905,
+    0x20450,
+    0xA0810,
+    0x5051,
+    0xC6000,
+    0x1080D09,
+    0x20450,
+    0x84101,
+    0xA0810,
+    0x41801,
+    0xC6000,
+    0x8881,
+    0x88905,
+    0x20450,
+    0xA0810,
+    0x80013,
+    0x88905,
+    0x20450,
+    0xA0810,
+    0x88905,
+    0x186124,
+    0x1041,
+    0x20450,
+    0xA0810,
+    0x88905,
+    0x80819,
+    0x20450,
+    0xA0810,
+    0x88905,
+    0x4E910,
+    0x20450,
+    0xA0810,
+    0x88905,
+    0x20450,
+    0xA0810,
+    0x2080011,
+    0x88905,
+    0x80011,
+    0x20450,
+    0xA0810,
+    0x88905,
+    0x20450,
+    0xA0810,
+    0x80091,
+    0xE810D,
+    0x88905,
+    0x20450,
+    0x84101,
+    0xA0810,
+    0x88905,
+    0x20450,
+    0x8401,
+    0xA0810,
+    0x88905,
+    0x20450,
+    0x1809,
+    0xA0810,
+    0x88905,
+    0x20450,
+    0xA0810,
+    0x101000,
+    0x88905,
+    0x20450,
+    0xA0810,
+    0x102000,
+    0x88905,
+    0x20450,
+    0xA0810,
+    0x800100,
+    0x88905,
+    0x20450,
+    0xA0810,
+    0x27104,
+    0x88905,
+    0x20450,
+    0xA0810,
+    0x8100,
+    0x88905,
+    0x20450,
+    0xA0810,
+    0x24080,
+    0x88905,
+    0x20450,
+    0xA0810,
+    0x41141,
+    0x88905,
+    0x20450,
+    0xA0810,
+    0x180001,
+    0x88905,
+    0x20450,
+    0xA0810,
+    0x14E900,
+    0x88905,
+    0x20450,
+    0xA0810,
+    0x8180,
+    0x88905,
+    0x184,
+    0x20450,
+    0xA0810,
+    0x88905,
+    0x20450,
+    0xA0810,
+    0x48100,
+    0x88905,
+    0x20450,
+    0xA0810,
+    0x5051,
+    0x88905,
+    0x1080D09,
+    0x20450,
+    0x84101,
+    0xA0810,
+    0x88905,
+    0x1080D09,
+    0x20450,
+    0xA0810,
+    0x14E900,
+    0x8881,
+    0x20450,
+    0xA0810,
+    0x41801,
+    0xC6000,
+    0x4E910,
+    0x20450,
+    0xA0810,
+    0x41801,
+    0xC6000,
+    0x80011,
+    0x20450,
+    0xA0810,
+    0x41801,
+    0xC6000,
+    0x20450,
+    0x84101,
+    0xA0810,
+    0x41801,
+    0xC6000,
+    0x1080D09,
+    0x20450,
+    0xA0810,
+    0x41801,
+    0xC6000,
+    0x14E900,
+    0x8881,
+    0x20450,
+    0xA0810,
+    0x41801,
+    0x80013,
+    0x20450,
+    0xA0810,
+    0x41801,
+    0x1041,
+    0x20450,
+    0xA0810,
+    0x41801,
+    0x80819,
+    0x20450,
+    0xA0810,
+    0x41801,
+    0x4E910,
+    0x20450,
+    0xA0810,
+    0x41801,
+    0x20450,
+    0xA0810,
+    0x41801,
+    0x2080011,
+    0x80011,
+    0x20450,
+    0xA0810,
+    0x41801,
+    0x20450,
+    0xA0810,
+    0x41801,
+    0x80091,
+    0x20450,
+    0x84101,
+    0xA0810,
+    0x41801,
+    0x20450,
+    0x8401,
+    0xA0810,
+    0x41801,
+    0x20450,
+    0x180B,
+    0x1809,
+    0xA0810,
+    0x41801,
+    0x20450,
+    0xA0810,
+    0x101000,
+    0x41801,
+    0x20450,
+    0xA0810,
+    0x102000,
+    0x41801,
+    0x20450,
+    0xA0810,
+    0x41801,
+    0x800100,
+    0x20450,
+    0xA0810,
+    0x27104,
+    0x41801,
+    0x20450,
+    0xA0810,
+    0x8100,
+    0x41801,
+    0x20450,
+    0xA0810,
+    0x24080,
+    0x41801,
+    0x2921,
+    0x20450,
+    0xA0810,
+    0xA5830,
+    0x27018,
+    0x3011,
+    0x41141,
+    0x41801,
+    0xC1141,
+    0xC0180,
+    0x20450,
+    0xA0810,
+    0x41141,
+    0x41801,
+    0x20450,
+    0xA0810,
+    0x41801,
+    0x180001,
+    0x20450,
+    0xA0810,
+    0x41801,
+    0x14E900,
+    0x20450,
+    0xA0810,
+    0x8180,
+    0x41801,
+    0x184,
+    0x20450,
+    0xA0810,
+    0x41801,
+    0x20450,
+    0xA0810,
+    0x48100,
+    0x41801,
+    0x20450,
+    0xA0810,
+    0x5051,
+    0x41801,
+    0x1080D09,
+    0x20450,
+    0x84101,
+    0xA0810,
+    0x41801,
+    0x1080D09,
+    0x20450,
+    0xA0810,
+    0x41801,
+    0x14E900,
+    0x20450,
+    0xA0810,
+    0x27104,
+    0x41801,
+    0xC6000,
+    0x20450,
+    0xA0810,
+    0x41801,
+    0xC6000,
+    0x14E900,
+    0x20450,
+    0xA0810,
+    0x5051,
+    0x41801,
+    0xC6000,
+    0x88905,
+    0x20450,
+    0x501,
+    0x1045802,
+    0x80013,
+    0x12081C,
+    0x20450,
+    0x1045802,
+    0x20450,
+    0xE8104,
+    0x1045802,
+    0x80091,
+    0x20450,
+    0x4480,
+    0x1045802,
+    0x14E900,
+    0x180015,
+    0x20450,
+    0x4480,
+    0x1045802,
+    0x14E900,
+    0x60119,
+    0x20450,
+    0x4480,
+    0x1045802,
+    0x14E900,
+    0x20450,
+    0x8180,
+    0x1045802,
+    0x20450,
+    0x5051,
+    0x8100,
+    0x1045802,
+    0x20450,
+    0x501,
+    0x1045802,
+    0x20185,
+    0x20450,
+    0xC401,
+    0xA0810,
+    0x20185,
+    0x20450,
+    0xC401,
+    0xA0810,
+    0x41801,
+    0x20450,
+    0xA0810,
+    0xC1141,
+    0x20450,
+    0xA0810,
+    0x41801,
+    0xC1141,
+    0x1149,
+    0x20450,
+    0xA0810,
+    0x1149,
+    0x20450,
+    0xA0810,
+    0x41801,
+    0x20450,
+    0xC401,
+    0xA0810,
+    0x20450,
+    0xC401,
+    0xA0810,
+    0x41801,
+    0x20450,
+    0xA0810,
+    0x49101,
+    0x20450,
+    0xA0810,
+    0x49101,
+    0x41801,
+    0x88905,
+    0x8C104,
+    0xA0810,
+    0x40190,
+    0x8C104,
+    0xA0810,
+    0x40190,
+    0x41801,
+    0x88905,
+    0x8C104,
+    0x130,
+    0xA0810,
+    0x8C104,
+    0x130,
+    0xA0810,
+    0x41801,
+    0x88905,
+    0x8C104,
+    0x590,
+    0xA0810,
+    0x8C104,
+    0x590,
+    0xA0810,
+    0x41801,
+    0x88905,
+    0x8C104,
+    0x24180,
+    0xA0810,
+    0x8C104,
+    0x24180,
+    0xA0810,
+    0x41801,
+    0x88905,
+    0x8C104,
+    0x2141,
+    0xA0810,
+    0x8C104,
+    0x2141,
+    0xA0810,
+    0x41801,
+    0x88905,
+    0x8C104,
+    0xA0810,
+    0x41181,
+    0x8C104,
+    0xA0810,
+    0x41181,
+    0x41801,
+    0x88905,
+    0x8C104,
+    0x118,
+    0xA0810,
+    0x8C104,
+    0x118,
+    0xA0810,
+    0x41801,
+    0x20450,
+    0x8401,
+    0xE8104,
+    0x1045802,
+    0x20450,
+    0x24080,
+    0x1045802,
+    0x80919,
+    0x20450,
+    0xA0810,
+    0x182811,
+    0x41141,
+    0x41801,
+    0x1045802,
+    0x20450,
+    0xA0810,
+    0x1084000,
+    0x88905,
+    0x20450,
+    0x1045802,
+    0x80091,
+    0x4E910,
+    0x20450,
+    0x182811,
+    0xE01C1,
+    0x1045802,
+    0x88905,
+    0x20450,
+    0xA0810,
+    0x44080,
+    0x20450,
+    0xA0810,
+    0x44080,
+    0x41801,
+    0x88905,
+    0x20450,
+    0x182811,
+    0x41141,
+    0x1045802,
+    0x88905,
+    0x20450,
+    0xA0810,
+    0x42001,
+    0x20450,
+    0xA0810,
+    0x42001,
+    0x41801,
+    0x20450,
+    0x24080,
+    0xE4410,
+    0x1045802,
+    0xC3141,
+    0x88905,
+    0x20450,
+    0x182811,
+    0x260018,
+    0x41141,
+    0x1045802,
+    0x88905,
+    0x84018,
+    0x20450,
+    0x182811,
+    0xEF150,
+    0x41141,
+    0x1045802,
+    0xC3141,
+    0x88905,
+    0x84018,
+    0x20450,
+    0x182811,
+    0xEF150,
+    0x260018,
+    0x41141,
+    0x1045802,
+    0x170019,
+    0x1E8114,
+    0x484000,
+    0x10001E,
+    0x1E8114,
+    0xA0090,
+    0x6010,
+    0x1E8114,
+    0xA6125,
+    0x6010,
+    0x1B0011,
+    0x320841,
+    0xA6125,
+    0x8A1,
+    0x6010,
+    0x320841,
+    0xA6125,
+    0x1F0011,
+    0xA0090,
+    0x320841,
+    0x1E8114,
+    0x2024010,
+    0x82901,
+    0xA0810,
+    0x41801,
+    0x1E8114,
+    0x124020,
+    0x1E8114,
+    0x200130,
+    0x1E8114,
+    0x840100,
+    0x1E8114,
+    0x242010,
+    0x1E8114,
+    0x801D0,
+    0x1E8114,
+    0x2110,
+    0x1E8114,
+    0x148800,
+    0x42140,
+    0x1E8114,
+    0x143100,
+    0x1E8114,
+    0x150811,
+    0x42140,
+    0x1E8114,
+    0x80830,
+    0xEA191,
+    0x1E8114,
+    0xEA191,
+    0xA01C0,
+    0x1E8114,
+    0x82901,
+    0xA0810,
+    0x41801,
+    0x1E8114,
+    0x1E8106,
+    0x2024010,
+    0x6010,
+    0x1E8106,
+    0x1E8106,
+    0x484000,
+    0x1E8106,
+    0xA0090,
+    0x124020,
+    0x1E8106,
+    0x200130,
+    0x1E8106,
+    0x840100,
+    0x1E8106,
+    0x242010,
+    0x1E8106,
+    0x801D0,
+    0x1E8106,
+    0x2110,
+    0x1E8106,
+    0x148800,
+    0x42140,
+    0x1E8106,
+    0x143100,
+    0x1E8106,
+    0x150811,
+    0x42140,
+    0x1E8106,
+    0x80830,
+    0xEA191,
+    0x1E8106,
+    0xEA191,
+    0xA01C0,
+    0x1E8106,
+    0x82901,
+    0xA0810,
+    0x41801,
+    0x1E8106,
+    0x82901,
+    0xA0810,
+    0x41801,
+    0x1E8106,
+    0x82901,
+    0xA0810,
+    0x41801,
+    0x1E8106,
+    0x82901,
+    0xA0810,
+    0x41801,
+    0x1E8106,
+    0x82901,
+    0xA0810,
+    0x440085,
+    0x41801,
+    0x1E8106,
+    0x82901,
+    0xA0810,
+    0x41801,
+    0x1E8106,
+    0x82901,
+    0xA0810,
+    0x41801,
+    0x1E8106,
+    0x82901,
+    0xA0810,
+    0x41801,
+    0x1E8106,
+    0x82901,
+    0xA0810,
+    0x41801,
+    0x1E8106,
+    0x82901,
+    0xA0810,
+    0x41801,
+    0x1E8106,
+    0x82901,
+    0xA0810,
+    0x41801,
+    0x1E8106,
+    0x82901,
+    0xA0810,
+    0x41801,
+    0x1E8106,
+    0x82901,
+    0xA0810,
+    0x41801,
+    0x1E8106,
+    0xA6125,
+    0x6010,
+    0x2C2090,
+    0x320841,
+    0xA6125,
+    0x82180,
+    0x6010,
+    0x320841,
+    0xA6125,
+    0x6010,
+    0x82090,
+    0x320841,
+    0xA6125,
+    0x6010,
+    0xA0188,
+    0x320841,
+    0xA6125,
+    0xE0188,
+    0x484000,
+    0x320841,
+    0x801A0,
+    0xA6125,
+    0x6010,
+    0x320841,
+    0xC01A0,
+    0xA6125,
+    0x484000,
+    0x320841,
+    0xC01A0,
+    0xA6125,
+    0xA0090,
+    0x320841,
+    0xC01A0,
+    0x124020,
+    0xA6125,
+    0x320841,
+    0xA6125,
+    0x6010,
+    0x8C0180,
+    0x320841,
+    0x200130,
+    0xA6125,
+    0x8C0180,
+    0x320841,
+    0x801D0,
+    0xA6125,
+    0x6010,
+    0x320841,
+    0xC01D0,
+    0xA6125,
+    0xA0090,
+    0x320841,
+    0xC01D0,
+    0x200130,
+    0xA6125,
+    0x320841,
+    0xC01D0,
+    0xA6125,
+    0x242010,
+    0x320841,
+    0xA6125,
+    0x1A7011,
+    0x6010,
+    0x123811,
+    0x6010,
+    0x27001,
+    0x123811,
+    0x27001,
+    0x484000,
+    0x123811,
+    0x27001,
+    0xA0090,
+    0x124020,
+    0x123811,
+    0x27001,
+    0x200130,
+    0x123811,
+    0x27001,
+    0x123811,
+    0x27001,
+    0x840100,
+    0x123811,
+    0x27001,
+    0x242010,
+    0x801D0,
+    0x123811,
+    0x27001,
+    0x2110,
+    0x123811,
+    0x27001,
+    0x123811,
+    0x27001,
+    0x82010,
+    0x202810,
+    0x123811,
+    0x27001,
+    0x123811,
+    0x27001,
+    0x680810,
+    0x1080120,
+    0x123811,
+    0x27001,
+    0x122098,
+    0x123811,
+    0x6010,
+    0x27001,
+    0x200130,
+    0x122098,
+    0x123811,
+    0x27001,
+    0x123811,
+    0x6010,
+    0x27001,
+    0x1C6089,
+    0x123811,
+    0x6010,
+    0x27001,
+    0x41801,
+    0x123811,
+    0x27001,
+    0x41801,
+    0x484000,
+    0x123811,
+    0x27001,
+    0x41801,
+    0xA0090,
+    0x124020,
+    0x123811,
+    0x27001,
+    0x41801,
+    0x200130,
+    0x123811,
+    0x27001,
+    0x41801,
+    0x123811,
+    0x27001,
+    0x840100,
+    0x41801,
+    0x123811,
+    0x27001,
+    0x242010,
+    0x41801,
+    0x801D0,
+    0x123811,
+    0x27001,
+    0x41801,
+    0x2110,
+    0x123811,
+    0x27001,
+    0x41801,
+    0x123811,
+    0x27001,
+    0x41801,
+    0x82010,
+    0x202810,
+    0x123811,
+    0x27001,
+    0x41801,
+    0x123811,
+    0x27001,
+    0x41801,
+    0x680810,
+    0x1080120,
+    0x123811,
+    0x27001,
+    0x41801,
+    0x122098,
+    0x123811,
+    0x6010,
+    0x27001,
+    0x41801,
+    0x200130,
+    0x122098,
+    0x123811,
+    0x27001,
+    0x41801,
+    0x123811,
+    0x6010,
+    0x27001,
+    0x41801,
+    0x1C6089,
+    0x123811,
+    0x6010,
+    0x27001,
+    0x1C6089,
+    0x200130,
+    0x123811,
+    0x27001,
+    0x1C6089,
+    0x123811,
+    0x27001,
+    0x82010,
+    0x1C6089,
+    0xC3141,
+    0xEC185,
+    0x10290D,
+    0x122098,
+    0x123811,
+    0x6010,
+    0x260018,
+    0x27001,
+    0x82901,
+    0xA0810,
+    0x260018,
+    0x41801,
+    0x25020,
+    0x80811,
+    0x123811,
+    0x27001,
+    0x840100,
+    0x1020811,
+    0x1080120,
+    0x25020,
+    0x123811,
+    0x27001,
+    0x1080120,
+    0x123811,
+    0x27001,
+    0x1C6089,
+    0x122098,
+    0x123811,
+    0x6010,
+    0x27001,
+    0x1C6089,
+    0xA6125,
+    0xE0188,
+    0x320841,
+    0x2024010,
+    0x80148,
+    0x1A2018,
+    0x484000,
+    0x80148,
+    0xA0090,
+    0x1A2018,
+    0x88905,
+    0x81995,
+    0xE8104,
+    0x88905,
+    0x81995,
+    0xE8104,
+    0x88905,
+    0x81995,
+    0xE8104,
+    0x88905,
+    0x81995,
+    0xE8104,
+    0x88905,
+    0x81995,
+    0xE8104,
+    0x88905,
+    0x81995,
+    0xE8104,
+    0x88905,
+    0x81995,
+    0xE8104,
+    0x88905,
+    0x81995,
+    0xE8104,
+    0x88905,
+    0x81995,
+    0x42C010,
+    0xE8104,
+    0xC0010,
+    0x88905,
+    0x81995,
+    0xE8104,
+    0x88905,
+    0x81995,
+    0xE8104,
+    0x88905,
+    0x81995,
+    0xE8104,
+    0x88905,
+    0x81995,
+    0xE8104,
+    0x88905,
+    0x81995,
+    0xE8104,
+    0x88905,
+    0x81995,
+    0xE8104,
+    0x88905,
+    0x81995,
+    0xE8104,
+    0x88905,
+    0x81995,
+    0xE8104,
+    0x88905,
+    0x81995,
+    0xE8104,
+    0x81995,
+    0xE8104,
+    0x41801,
+    0x81995,
+    0xE8104,
+    0x41801,
+    0x81995,
+    0xE8104,
+    0x41801,
+    0x81995,
+    0xE8104,
+    0x41801,
+    0x81995,
+    0xE8104,
+    0x41801,
+    0x81995,
+    0xE8104,
+    0x41801,
+    0x81995,
+    0xE8104,
+    0x41801,
+    0x81995,
+    0xE8104,
+    0x41801,
+    0x81995,
+    0xE8104,
+    0x41801,
+    0x81995,
+    0xE8104,
+    0x41801,
+    0x81995,
+    0xE8104,
+    0x41801,
+    0x81995,
+    0xE8104,
+    0x41801,
+    0x81995,
+    0xE8104,
+    0x41801,
+    0x81995,
+    0xE8104,
+    0x41801,
+    0x81995,
+    0xE8104,
+    0x41801,
+    0x81995,
+    0xE8104,
+    0x41801,
+    0x81995,
+    0xE8104,
+    0x41801,
+    0x81995,
+    0xE8104,
+    0x41801,
+    0x81995,
+    0xE8104,
+    0x41801,
+    0x81995,
+    0xE8104,
+    0x41801,
+    0x81995,
+    0xE8104,
+    0x41801,
+    0x81995,
+    0xE8104,
+    0x41801,
+    0x81995,
+    0xE8104,
+    0x41801,
+    0x480A,
+    0x88905,
+    0x81995,
+    0xE8104,
+    0x480A,
+    0x88905,
+    0x81995,
+    0xE8104,
+    0x480A,
+    0x88905,
+    0x81995,
+    0xE8104,
+    0x480A,
+    0x88905,
+    0x81995,
+    0xE8104,
+    0x480A,
+    0x88905,
+    0x81995,
+    0xE8104,
+    0x480A,
+    0x88905,
+    0x81995,
+    0xE8104,
+    0x480A,
+    0x88905,
+    0x81995,
+    0xE8104,
+    0x480A,
+    0x88905,
+    0x81995,
+    0xE8104,
+    0x480A,
+    0x88905,
+    0x81995,
+    0xE8104,
+    0x480A,
+    0x88905,
+    0x81995,
+    0xE8104,
+    0x480A,
+    0x88905,
+    0x81995,
+    0xE8104,
+    0x480A,
+    0x88905,
+    0x81995,
+    0xE8104,
+    0x480A,
+    0x88905,
+    0x81995,
+    0xE8104,
+    0x480A,
+    0x88905,
+    0x81995,
+    0xE8104,
+    0x480A,
+    0x88905,
+    0x81995,
+    0xE8104,
+    0x480A,
+    0x88905,
+    0x81995,
+    0xE8104,
+    0x480A,
+    0x88905,
+    0x81995,
+    0xE8104,
+    0x480A,
+    0x88905,
+    0x81995,
+    0xE8104,
+    0x480A,
+    0x88905,
+    0x81995,
+    0xE8104,
+    0x480A,
+    0x88905,
+    0x81995,
+    0xE8104,
+    0x480A,
+    0x88905,
+    0x81995,
+    0xE8104,
+    0x480A,
+    0x88905,
+    0x81995,
+    0xE8104,
+    0x480A,
+    0x88905,
+    0x81995,
+    0xE8104,
+    0x480A,
+    0x88905,
+    0x81995,
+    0xE8104,
+    0x480A,
+    0x88905,
+    0x81995,
+    0xE8104,
+    0x480A,
+    0x88905,
+    0x81995,
+    0xE8104,
+    0x480A,
+    0x81995,
+    0xE8104,
+    0x41801,
+    0x480A,
+    0x81995,
+    0xE8104,
+    0x41801,
+    0x480A,
+    0x81995,
+    0xE8104,
+    0x41801,
+    0x480A,
+    0x81995,
+    0xE8104,
+    0x41801,
+    0x480A,
+    0x81995,
+    0xE8104,
+    0x41801,
+    0x480A,
+    0x81995,
+    0xE8104,
+    0x41801,
+    0x480A,
+    0x81995,
+    0xE8104,
+    0x41801,
+    0x480A,
+    0x81995,
+    0xE8104,
+    0x41801,
+    0x480A,
+    0x81995,
+    0xE8104,
+    0x41801,
+    0x480A,
+    0x81995,
+    0xE8104,
+    0x41801,
+    0x480A,
+    0x81995,
+    0xE8104,
+    0x41801,
+    0x480A,
+    0x81995,
+    0xE8104,
+    0x41801,
+    0x480A,
+    0x81995,
+    0xE8104,
+    0x41801,
+    0x480A,
+    0x81995,
+    0xE8104,
+    0x41801,
+    0x480A,
+    0x81995,
+    0xE8104,
+    0x41801,
+    0x480A,
+    0x81995,
+    0xE8104,
+    0x41801,
+    0x480A,
+    0x81995,
+    0xE8104,
+    0x41801,
+    0x480A,
+    0x81995,
+    0xE8104,
+    0x41801,
+    0x480A,
+    0x81995,
+    0xE8104,
+    0x41801,
+    0x480A,
+    0x81995,
+    0xE8104,
+    0x41801,
+    0x480A,
+    0x81995,
+    0xE8104,
+    0x41801,
+    0x480A,
+    0x81995,
+    0xE8104,
+    0x41801,
+    0x480A,
+    0x81995,
+    0xE8104,
+    0x41801,
+    0x480A,
+    0x81995,
+    0xE8104,
+    0x41801,
+    0x480A,
+    0x81995,
+    0xE8104,
+    0x41801,
+    0x480A,
+    0x81995,
+    0xE8104,
+    0x41801,
+    0x88905,
+    0x1A0421,
+    0x81995,
+    0x88905,
+    0x1A0421,
+    0x81995,
+    0x88905,
+    0x1A0421,
+    0x81995,
+    0x88905,
+    0x1A0421,
+    0x81995,
+    0x88905,
+    0x1A0421,
+    0x81995,
+    0x88905,
+    0x1A0421,
+    0x81995,
+    0x88905,
+    0x1A0421,
+    0x81995,
+    0x88905,
+    0x1A0421,
+    0x81995,
+    0x88905,
+    0x1A0421,
+    0x81995,
+    0x88905,
+    0x1A0421,
+    0x10A5301,
+    0x81995,
+    0x402010,
+    0xC3011,
+    0x880010,
+    0x88905,
+    0x1A0421,
+    0x81995,
+    0x88905,
+    0x1A0421,
+    0x81995,
+    0x88905,
+    0x1A0421,
+    0x81995,
+    0x88905,
+    0x1A0421,
+    0x81995,
+    0x88905,
+    0x1A0421,
+    0x20450,
+    0x81995,
+    0x4808,
+    0x1CA151,
+    0xC3011,
+    0x88905,
+    0x1A0421,
+    0x81995,
+    0x88905,
+    0x1A0421,
+    0x81995,
+    0x88905,
+    0x1A0421,
+    0x81995,
+    0x88905,
+    0x1A0421,
+    0x81995,
+    0x88905,
+    0x1A0421,
+    0x81995,
+    0x88905,
+    0x1A0421,
+    0x81995,
+    0x1A0421,
+    0x81995,
+    0x41801,
+    0x1A0421,
+    0x81995,
+    0x41801,
+    0x1A0421,
+    0x81995,
+    0x41801,
+    0x1A0421,
+    0x81995,
+    0x41801,
+    0x1A0421,
+    0x81995,
+    0x41801,
+    0x1A0421,
+    0x81995,
+    0x41801,
+    0x1A0421,
+    0x81995,
+    0x41801,
+    0x1A0421,
+    0x81995,
+    0x41801,
+    0x1A0421,
+    0x81995,
+    0x41801,
+    0x1A0421,
+    0x81995,
+    0x41801,
+    0x1A0421,
+    0x81995,
+    0x41801,
+    0x1A0421,
+    0x81995,
+    0x41801,
+    0x1A0421,
+    0x81995,
+    0x41801,
+    0x1A0421,
+    0x81995,
+    0x41801,
+    0x1A0421,
+    0x81995,
+    0x41801,
+    0x1A0421,
+    0x81995,
+    0x41801,
+    0x1A0421,
+    0x81995,
+    0x41801,
+    0x1A0421,
+    0x81995,
+    0x41801,
+    0x1A0421,
+    0x81995,
+    0x41801,
+    0x1A0421,
+    0x81995,
+    0x41801,
+    0x1A0421,
+    0x81995,
+    0x41801,
+    0x1A0421,
+    0x81995,
+    0x41801,
+    0x1A0421,
+    0x81995,
+    0x41801,
+    0x1A0421,
+    0x81995,
+    0x41801,
+    0x1A0421,
+    0x81995,
+    0x41801,
+    0x1A0421,
+    0x81995,
+    0x41801,
+    0x88905,
+    0x10481A,
+    0x81995,
+    0x1E0404,
+    0x88905,
+    0x10481A,
+    0x81995,
+    0x1E0404,
+    0x88905,
+    0x10481A,
+    0x81995,
+    0x1E0404,
+    0x88905,
+    0x10481A,
+    0x81995,
+    0x1E0404,
+    0x88905,
+    0x10481A,
+    0x81995,
+    0x1E0404,
+    0x88905,
+    0x10481A,
+    0x81995,
+    0x1E0404,
+    0x88905,
+    0x10481A,
+    0x81995,
+    0x1E0404,
+    0x88905,
+    0x10481A,
+    0x81995,
+    0x1E0404,
+    0x88905,
+    0x10481A,
+    0x81995,
+    0x1E0404,
+    0x88905,
+    0x10481A,
+    0x81995,
+    0x1E0404,
+    0x88905,
+    0x10481A,
+    0x81995,
+    0x1E0404,
+    0x88905,
+    0x10481A,
+    0x81995,
+    0x1E0404,
+    0x88905,
+    0x10481A,
+    0x81995,
+    0x1E0404,
+    0x88905,
+    0x10481A,
+    0x81995,
+    0x1E0404,
+    0x88905,
+    0x10481A,
+    0x81995,
+    0x1E0404,
+    0x88905,
+    0x10481A,
+    0x81995,
+    0x1E0404,
+    0x88905,
+    0x10481A,
+    0x81995,
+    0x1E0404,
+    0x88905,
+    0x10481A,
+    0x81995,
+    0x1E0404,
+    0x88905,
+    0x10481A,
+    0x81995,
+    0x1E0404,
+    0x10481A,
+    0x81995,
+    0x41801,
+    0x1E0404,
+    0x10481A,
+    0x81995,
+    0x41801,
+    0x1E0404,
+    0x10481A,
+    0x81995,
+    0x41801,
+    0x1E0404,
+    0x10481A,
+    0x81995,
+    0x41801,
+    0x1E0404,
+    0x10481A,
+    0x81995,
+    0x41801,
+    0x1E0404,
+    0x10481A,
+    0x81995,
+    0x41801,
+    0x1E0404,
+    0x10481A,
+    0x81995,
+    0x41801,
+    0x1E0404,
+    0x10481A,
+    0x81995,
+    0x41801,
+    0x1E0404,
+    0x10481A,
+    0x81995,
+    0x41801,
+    0x1E0404,
+    0x10481A,
+    0x81995,
+    0x41801,
+    0x1E0404,
+    0x10481A,
+    0x81995,
+    0x41801,
+    0x1E0404,
+    0x10481A,
+    0x81995,
+    0x41801,
+    0x1E0404,
+    0x10481A,
+    0x81995,
+    0x41801,
+    0x1E0404,
+    0x10481A,
+    0x81995,
+    0x41801,
+    0x1E0404,
+    0x10481A,
+    0x81995,
+    0x41801,
+    0x1E0404,
+    0x10481A,
+    0x81995,
+    0x41801,
+    0x1E0404,
+    0x10481A,
+    0x81995,
+    0x41801,
+    0x1E0404,
+    0x10481A,
+    0x81995,
+    0x41801,
+    0x1E0404,
+    0x10481A,
+    0x81995,
+    0x41801,
+    0x1E0404,
+    0x10481A,
+    0x81995,
+    0x41801,
+    0x1E0404,
+    0x10481A,
+    0x81995,
+    0x41801,
+    0x1E0404,
+    0x10481A,
+    0x81995,
+    0x41801,
+    0x1E0404,
+    0x10481A,
+    0x81995,
+    0x41801,
+    0x1E0404,
+    0x10481A,
+    0x81995,
+    0x41801,
+    0x1E0404,
+    0x10481A,
+    0x81995,
+    0x41801,
+    0x1E0404,
+    0x10481A,
+    0x81995,
+    0x41801,
+    0x1E0404,
+    0x480A,
+    0x88905,
+    0x1A0421,
+    0x81995,
+    0x480A,
+    0x88905,
+    0x1A0421,
+    0x81995,
+    0x480A,
+    0x88905,
+    0x1A0421,
+    0x81995,
+    0x480A,
+    0x88905,
+    0x1A0421,
+    0x81995,
+    0x480A,
+    0x88905,
+    0x1A0421,
+    0x81995,
+    0x480A,
+    0x88905,
+    0x1A0421,
+    0x81995,
+    0x480A,
+    0x88905,
+    0x1A0421,
+    0x81995,
+    0x480A,
+    0x88905,
+    0x1A0421,
+    0x81995,
+    0x480A,
+    0x88905,
+    0x1A0421,
+    0x81995,
+    0x480A,
+    0x88905,
+    0x1A0421,
+    0x81995,
+    0x480A,
+    0x88905,
+    0x1A0421,
+    0x81995,
+    0x480A,
+    0x88905,
+    0x1A0421,
+    0x81995,
+    0x480A,
+    0x88905,
+    0x1A0421,
+    0x81995,
+    0x480A,
+    0x88905,
+    0x1A0421,
+    0x81995,
+    0x480A,
+    0x88905,
+    0x1A0421,
+    0x81995,
+    0x480A,
+    0x88905,
+    0x1A0421,
+    0x81995,
+    0x480A,
+    0x88905,
+    0x1A0421,
+    0x81995,
+    0x480A,
+    0x88905,
+    0x1A0421,
+    0x81995,
+    0x480A,
+    0x88905,
+    0x1A0421,
+    0x81995,
+    0x480A,
+    0x88905,
+    0x1A0421,
+    0x81995,
+    0x480A,
+    0x88905,
+    0x1A0421,
+    0x81995,
+    0x480A,
+    0x88905,
+    0x1A0421,
+    0x81995,
+    0x480A,
+    0x88905,
+    0x1A0421,
+    0x81995,
+    0x480A,
+    0x88905,
+    0x1A0421,
+    0x81995,
+    0x480A,
+    0x88905,
+    0x1A0421,
+    0x81995,
+    0x480A,
+    0x88905,
+    0x1A0421,
+    0x81995,
+    0x480A,
+    0x1A0421,
+    0x81995,
+    0x41801,
+    0x480A,
+    0x1A0421,
+    0x81995,
+    0x41801,
+    0x480A,
+    0x1A0421,
+    0x81995,
+    0x41801,
+    0x480A,
+    0x1A0421,
+    0x81995,
+    0x41801,
+    0x480A,
+    0x1A0421,
+    0x81995,
+    0x41801,
+    0x480A,
+    0x1A0421,
+    0x81995,
+    0x41801,
+    0x480A,
+    0x1A0421,
+    0x81995,
+    0x41801,
+    0x480A,
+    0x1A0421,
+    0x81995,
+    0x41801,
+    0x480A,
+    0x1A0421,
+    0x81995,
+    0x41801,
+    0x480A,
+    0x1A0421,
+    0x81995,
+    0x41801,
+    0x480A,
+    0x1A0421,
+    0x81995,
+    0x41801,
+    0x480A,
+    0x1A0421,
+    0x81995,
+    0x41801,
+    0x480A,
+    0x1A0421,
+    0x81995,
+    0x41801,
+    0x480A,
+    0x1A0421,
+    0x81995,
+    0x41801,
+    0x480A,
+    0x1A0421,
+    0x81995,
+    0x41801,
+    0x480A,
+    0x1A0421,
+    0x81995,
+    0x41801,
+    0x480A,
+    0x1A0421,
+    0x81995,
+    0x41801,
+    0x480A,
+    0x1A0421,
+    0x81995,
+    0x41801,
+    0x480A,
+    0x1A0421,
+    0x81995,
+    0x41801,
+    0x480A,
+    0x1A0421,
+    0x81995,
+    0x41801,
+    0x480A,
+    0x1A0421,
+    0x81995,
+    0x41801,
+    0x480A,
+    0x1A0421,
+    0x81995,
+    0x41801,
+    0x480A,
+    0x1A0421,
+    0x81995,
+    0x41801,
+    0x480A,
+    0x1A0421,
+    0x81995,
+    0x41801,
+    0x480A,
+    0x1A0421,
+    0x81995,
+    0x41801,
+    0x480A,
+    0x1A0421,
+    0x81995,
+    0x41801,
+    0x80148,
+    0x10481A,
+    0x81995,
+    0x1E0404,
+    0x2024010,
+    0x80148,
+    0x10481A,
+    0x81995,
+    0x6010,
+    0x1E0404,
+    0x80148,
+    0x10481A,
+    0x81995,
+    0x1E0404,
+    0x484000,
+    0x80148,
+    0x10481A,
+    0x81995,
+    0x1E0404,
+    0xA0090,
+    0x80148,
+    0x10481A,
+    0x124020,
+    0x81995,
+    0x1E0404,
+    0x80148,
+    0x10481A,
+    0x200130,
+    0x81995,
+    0x1E0404,
+    0x80148,
+    0x10481A,
+    0x81995,
+    0x840100,
+    0x1E0404,
+    0x80148,
+    0x10481A,
+    0x81995,
+    0x242010,
+    0x1E0404,
+    0x80148,
+    0x10481A,
+    0x801D0,
+    0x81995,
+    0x1E0404,
+    0x80148,
+    0x10481A,
+    0x81995,
+    0x2110,
+    0x1E0404,
+}};
+
+constexpr std::array<SearchMasks, 5059> g_masks = {{
+    {0x10000022175, 0x4100010C7910, {kw_masks.data() + 0, 11}, 0x4100011EF9F5},
+    {0x100014E21F7, 0x4100010C7910, {kw_masks.data() + 11, 13}, 0x4100015EF9F7},
+    {0x100014E39F5, 0x4100010C7910, {kw_masks.data() + 24, 12}, 0x4100015EF9F5},
+    {0x100014C39F7, 0x4100010C7910, {kw_masks.data() + 36, 11}, 0x4100014EF9F7},
+    {0x100001F2175, 0x4100010C7910, {kw_masks.data() + 47, 15}, 0x4100011FF9FD},
+    {0x100004E21F5, 0x4100010C7910, {kw_masks.data() + 62, 13}, 0x410001FEFBFD},
+    {0x100001A69F1, 0x4100010C7910, {kw_masks.data() + 75, 18}, 0x4100011EFBF5},
+    {0x100014E43B5, 0x4100010C7910, {kw_masks.data() + 93, 17}, 0x4100015EFBF5},
+    {0x100010C39F5, 0x4100010C7910, {kw_masks.data() + 110, 5}, 0x4100010CF9F5},
+    {0x2001000054E13D, 0x4100010C7910, {kw_masks.data() + 115, 7}, 0x204100015CF9FD},
+    {0x10000083975, 0x4100010C7910, {kw_masks.data() + 122, 14}, 0x4100013FF9FF},
+    {0x10000402575, 0x4100010C7910, {kw_masks.data() + 136, 10}, 0x410001CE7DFF},
+    {0x100014C39F5, 0x4100010C7910, {kw_masks.data() + 146, 8}, 0x4100015C79FF},
+    {0x100004C79F5, 0x4100010C7910, {kw_masks.data() + 154, 16}, 0x4100015EF9FF},
+    {0x100004E39F5, 0x4100010C7910, {kw_masks.data() + 170, 13}, 0x4100217E79FD},
+    {0x200100014E39F5, 0x4100010C7910, {kw_masks.data() + 183, 18}, 0x20410069EE7DF7},
+    {0x200000001E0405, 0x4100010C7910, {kw_masks.data() + 201, 11}, 0x20410001DE7D7D},
+    {0x10000446D77, 0x4100010C7910, {kw_masks.data() + 212, 17}, 0x410001FE7DFF},
+    {0x10000042575, 0x4100010C7910, {kw_masks.data() + 229, 14}, 0x410069BE7DFD},
+    {0x10000043975, 0x4100010C7910, {kw_masks.data() + 243, 7}, 0x4100019EF9FD},
+    {0x100014C6DFD, 0x4100010C7910, {kw_masks.data() + 250, 16}, 0x410069DE7DFF},
+    {0x100014C3DF5, 0x4100010C7910, {kw_masks.data() + 266, 17}, 0x4100696E7DFD},
+    {0x100004E39F5, 0x4100010C7910, {kw_masks.data() + 283, 14}, 0x4100017EFBFD},
+    {0x1000026617D, 0x4100010C7910, {kw_masks.data() + 297, 15}, 0x4100013E79FD},
+    {0x100005861F5, 0x4100010C7910, {kw_masks.data() + 312, 8}, 0x204100015EFDF5},
+    {0x100005865F5, 0x4100010C7910, {kw_masks.data() + 320, 16}, 0x204100035EFFFD},
+    {0x10003002035, 0x4100010C7910, {kw_masks.data() + 336, 9}, 0x4100031E7975},
+    {0x100005D61F5, 0x4100010C7910, {kw_masks.data() + 345, 13}, 0x204100017F7DFF},
+    {0x200100011870B5, 0x4100010C7910, {kw_masks.data() + 358, 6}, 0x204100011CF9FD},
+    {0x100004CF9FD, 0x4100010C7910, {kw_masks.data() + 364, 7}, 0x4100015CF9FD},
+    {0x100007A71BD, 0x4100010C7910, {kw_masks.data() + 371, 13}, 0x4100037EFDFD},
+    {0x100017EF1BD, 0x4100010C7910, {kw_masks.data() + 384, 16}, 0x4100037FFDFF},
+    {0x1000148A5F5, 0x4100010C7910, {kw_masks.data() + 400, 13}, 0x4100016EFDFF},
+    {0x100001421F5, 0x4100010C7910, {kw_masks.data() + 413, 6}, 0x4100011D79FD},
+    {0x100000825F5, 0x4100010C7910, {kw_masks.data() + 419, 9}, 0x4100014EFDFD},
+    {0x100001C2975, 0x4100010C7910, {kw_masks.data() + 428, 12}, 0xFFFFFFFFFFFFFFFF},
+    {0x200100021AD1B5, 0x4100010C7910, {kw_masks.data() + 440, 11}, 0x204100031FFDB5},
+    {0x100014E41BF, 0x4100010C7910, {kw_masks.data() + 451, 15}, 0x4100017EFFBF},
+    {0x100001A2835, 0x4100010C7910, {kw_masks.data() + 466, 17}, 0x410001FEFFFF},
+    {0x1000086E935, 0x4100010C7910, {kw_masks.data() + 483, 18}, 0x410001FEFFFD},
+    {0x100005851B5, 0x4100010C7910, {kw_masks.data() + 501, 15}, 0x410001DFFDBF},
+    {0x1000008693D, 0x4100010C7910, {kw_masks.data() + 516, 14}, 0x4100017EFDBF},
+    {0x1000014693D, 0x4100010C7910, {kw_masks.data() + 530, 7}, 0x4100011EFDFF},
+    {0x10000063575, 0x4100010C7910, {kw_masks.data() + 537, 19}, 0x4100017EFDFF},
+    {0x1000014303D, 0x4100010C7910, {kw_masks.data() + 556, 17}, 0x404100017EFFFF},
+    {0x100014E69F5, 0x4100010C7910, {kw_masks.data() + 573, 9}, 0x4100017EFDFD},
+    {0x10000023175, 0x4100010C7910, {kw_masks.data() + 582, 11}, 0x4100015EFD7D},
+    {0x100008029F5, 0x4100010C7910, {kw_masks.data() + 593, 16}, 0x410001DEFDFF},
+    {0x10001002975, 0x4100010C7910, {kw_masks.data() + 609, 7}, 0x4100011EFDF5},
+    {0x100000425F5, 0x4100010C7910, {kw_masks.data() + 616, 14}, 0x4100037FFDFF},
+    {0x100030E6DD9, 0x4100010C7910, {kw_masks.data() + 630, 8}, 0x4100031EFDFD},
+    {0x100012E2DDD, 0x4100010C7910, {kw_masks.data() + 638, 8}, 0x4100013EFDFD},
+    {0x1000022093D, 0x4100010C7910, {kw_masks.data() + 646, 7}, 0x4100032EF93D},
+    {0x1000024A135, 0x4100010C7910, {kw_masks.data() + 653, 12}, 0x4100017EFF7F},
+    {0x10001048835, 0x4100010C7910, {kw_masks.data() + 665, 9}, 0x4100010EF9FD},
+    {0x1000002697D, 0x4100010C7910, {kw_masks.data() + 674, 3}, 0x4100010EF97D},
+    {0x1000004A975, 0x4100010C7910, {kw_masks.data() + 677, 14}, 0x4100036EF9FF},
+    {0x100015E21FF, 0x4100010C7910, {kw_masks.data() + 691, 11}, 0x410001DEF9FF},
+    {0x100004C1DBD, 0x4100010C7910, {kw_masks.data() + 702, 12}, 0x4100015E7DFD},
+    {0x100004A51B5, 0x4100010C7910, {kw_masks.data() + 714, 5}, 0x4100015E7DB5},
+    {0x200100004821FF, 0x4100010C7910, {kw_masks.data() + 719, 8}, 0x204100015E7BFF},
+    {0x100001C203D, 0x4100010C7910, {kw_masks.data() + 727, 7}, 0x4100017E7D7D},
+    {0x10000287175, 0x4100010C7910, {kw_masks.data() + 734, 12}, 0x4100017EFDF7},
+    {0x10002042175, 0x4100010C7910, {kw_masks.data() + 746, 8}, 0x4100037E7DFD},
+    {0x100000840B5, 0x4100010C7910, {kw_masks.data() + 754, 11}, 0x204100017EFDFD},
+    {0x1000000483D, 0x4100010C7910, {kw_masks.data() + 765, 10}, 0x204100035E79FF},
+    {0x10003404035, 0x4100010C7910, {kw_masks.data() + 775, 11}, 0x410003FEFDBD},
+    {0x200100015E41BD, 0x4100010C7910, {kw_masks.data() + 786, 12}, 0x204100035E7DBD},
+    {0x100014E89B5, 0x4100010C7910, {kw_masks.data() + 798, 13}, 0x4100035EF9FF},
+    {0x1000080E9D9, 0x4100010C7910, {kw_masks.data() + 811, 11}, 0x410001DCFDFF},
+    {0x100014840B7, 0x4100010C7910, {kw_masks.data() + 822, 4}, 0x4100014E79F7},
+    {0x100010AA175, 0x4100010C7910, {kw_masks.data() + 826, 12}, 0x4100018EF9FF},
+    {0x1000014017D, 0x4100010C7910, {kw_masks.data() + 838, 14}, 0x4100015EF9FF},
+    {0x100005C39F5, 0x4100010C7910, {kw_masks.data() + 852, 18}, 0x410001DE79FF},
+    {0x1000002203D, 0x4100010C7910, {kw_masks.data() + 870, 10}, 0x410001AEFD7F},
+    {0x100004879B5, 0x4100010C7910, {kw_masks.data() + 880, 8}, 0x4100015E79F5},
+    {0x1000014603D, 0x4100010C7910, {kw_masks.data() + 888, 13}, 0x4100015E79FF},
+    {0x100005879FD, 0x4100010C7910, {kw_masks.data() + 901, 16}, 0x4100017EFDFF},
+    {0x1000042413D, 0x4100010C7910, {kw_masks.data() + 917, 12}, 0x410001FEF93F},
+    {0x100014E69F5, 0x4100010C7910, {kw_masks.data() + 929, 6}, 0x4100014E79FD},
+    {0x10000426175, 0x4100010C7910, {kw_masks.data() + 935, 5}, 0x4100014E797D},
+    {0x1000058F1B5, 0x4100010C7910, {kw_masks.data() + 940, 15}, 0x4100017EFDFF},
+    {0x100001400BD, 0x4100010C7910, {kw_masks.data() + 955, 9}, 0x4100015EF9FD},
+    {0x100000C61BD, 0x4100010C7910, {kw_masks.data() + 964, 9}, 0x4100014E7DFD},
+    {0x100001408BD, 0x4100010C7910, {kw_masks.data() + 973, 17}, 0x4100035EFFFF},
+    {0x100000E413D, 0x4100010C7910, {kw_masks.data() + 990, 9}, 0x410001BEFDBF},
+    {0x1000000A97D, 0x4100010C7910, {kw_masks.data() + 999, 13}, 0x4100015EF9FF},
+    {0x100000E6DFF, 0x4100010C7910, {kw_masks.data() + 1012, 17}, 0x4100015EFFFF},
+    {0x100005AF1F5, 0x4100010C7910, {kw_masks.data() + 1029, 13}, 0x4100015EF9FD},
+    {0x100001421FD, 0x4100010C7910, {kw_masks.data() + 1042, 11}, 0x4100015EF9FD},
+    {0x10000120835, 0x4100010C7910, {kw_masks.data() + 1053, 9}, 0x410001DE793F},
+    {0x10000DC61B5, 0x4100010C7910, {kw_masks.data() + 1062, 13}, 0x410001FEFDBF},
+    {0x100003E093F, 0x4100010C7910, {kw_masks.data() + 1075, 14}, 0x410001FEF9BF},
+    {0x10001022175, 0x4100010C7910, {kw_masks.data() + 1089, 11}, 0x4100015EF9FD},
+    {0x1000112697D, 0x4100010C7910, {kw_masks.data() + 1100, 11}, 0x4100015EF9FF},
+    {0x10000063175, 0x4100010C7910, {kw_masks.data() + 1111, 13}, 0x4100015EFDFD},
+    {0x1000010603D, 0x4100010C7910, {kw_masks.data() + 1124, 11}, 0x4100011E79FD},
+    {0x1000026A175, 0x4100010C7910, {kw_masks.data() + 1135, 8}, 0x4100013EF9FD},
+    {0x100000CE13D, 0x4100010C7910, {kw_masks.data() + 1143, 10}, 0x4100015EFBFF},
+    {0x100004C61BD, 0x4100010C7910, {kw_masks.data() + 1153, 12}, 0x4100017E7DBD},
+    {0x10001420035, 0x4100010C7910, {kw_masks.data() + 1165, 13}, 0x4100015EF9FD},
+    {0x100000A013D, 0x4100010C7910, {kw_masks.data() + 1178, 8}, 0x4100030EF93D},
+    {0x10001402175, 0x4100010C7910, {kw_masks.data() + 1186, 14}, 0x4100036EF9FF},
+    {0x100004E71B5, 0x4100010C7910, {kw_masks.data() + 1200, 15}, 0x4100017EF9FD},
+    {0x1000002207D, 0x4100010C7910, {kw_masks.data() + 1215, 14}, 0x4100013EF9FD},
+    {0x10001022075, 0x4100010C7910, {kw_masks.data() + 1229, 13}, 0x4100013EF9FF},
+    {0x100015C79B7, 0x4100010C7910, {kw_masks.data() + 1242, 10}, 0x4100017EF9FF},
+    {0x100004E79F5, 0x4100010C7910, {kw_masks.data() + 1252, 14}, 0x4100017EF9FD},
+    {0x100014E61F5, 0x4100010C7910, {kw_masks.data() + 1266, 15}, 0x4100017EF9FD},
+    {0x140C00, 0x4100010C7910, {kw_masks.data() + 1281, 13}, 0xFFFFFFFFFFFFFFFF},
+    {0x10000166C1F, 0x4100010C7910, {kw_masks.data() + 1294, 8}, 0x4100013E7DFF},
+    {0x1000000C930, 0x4100010C7910, {kw_masks.data() + 1302, 17}, 0x4100011EFDFF},
+    {0x10000406835, 0x4100010C7910, {kw_masks.data() + 1319, 3}, 0x4100015C7935},
+    {0x24050, 0x4100010C7910, {kw_masks.data() + 1322, 12}, 0x4100013E7D7D},
+    {0x6942, 0x4100010C7910, {kw_masks.data() + 1334, 12}, 0x4100011E7D77},
+    {0xC40C0, 0x4100010C7910, {kw_masks.data() + 1346, 15}, 0x410001DE79FF},
+    {0x2911, 0x4100010C7910, {kw_masks.data() + 1361, 12}, 0x4100019EF935},
+    {0x100000E7911, 0x4100010C7910, {kw_masks.data() + 1373, 16}, 0x4100019EF97D},
+    {0xA4002, 0x4100010C7910, {kw_masks.data() + 1389, 4}, 0x4100011E7937},
+    {0x100000A2145, 0x4100010C7910, {kw_masks.data() + 1393, 8}, 0x4100011EF9F5},
+    {0x100014E39D5, 0x4100010C7910, {kw_masks.data() + 1401, 9}, 0x4100014E79F5},
+    {0x100014E43B5, 0x4100010C7910, {kw_masks.data() + 1410, 9}, 0x4100015E7BF5},
+    {0x200100014E39D5, 0x4100010C7910, {kw_masks.data() + 1419, 10}, 0x204100016E79F5},
+    {0x100014E1995, 0x4100010C7910, {kw_masks.data() + 1429, 6}, 0x4100014E79B5},
+    {0x100000C2545, 0x4100010C7910, {kw_masks.data() + 1435, 8}, 0x4100010C7D7D},
+    {0x100014A0015, 0x4100010C7910, {kw_masks.data() + 1443, 6}, 0x4100015EF9BD},
+    {0x100010A2145, 0x4100010C7910, {kw_masks.data() + 1449, 7}, 0x4100010E797D},
+    {0x1000018E145, 0x4100010C7910, {kw_masks.data() + 1456, 4}, 0x4100011CF975},
+    {0x20010001247D10, 0x4100010C7910, {kw_masks.data() + 1460, 16}, 0x204100017EFDFF},
+    {0x20010001227D91, 0x4100010C7910, {kw_masks.data() + 1476, 15}, 0x204100013EFDFF},
+    {0x2001000124FD11, 0x4100010C7910, {kw_masks.data() + 1491, 14}, 0x204100013FFDFF},
+    {0x100002A4810, 0x4100010C7910, {kw_masks.data() + 1505, 6}, 0x4100012E7995},
+    {0x100004A4191, 0x4100010C7910, {kw_masks.data() + 1511, 11}, 0x4100697EF99F},
+    {0x100004A6193, 0x4100010C7910, {kw_masks.data() + 1522, 9}, 0x410069EE7D93},
+    {0x100000EADD1, 0x4100010C7910, {kw_masks.data() + 1531, 12}, 0x4100698EFDDD},
+    {0x100004A61D1, 0x4100010C7910, {kw_masks.data() + 1543, 12}, 0x410069FEFDDD},
+    {0x100000A21D3, 0x4100010C7910, {kw_masks.data() + 1555, 10}, 0x4100693EF9DF},
+    {0x100002E69D1, 0x4100010C7910, {kw_masks.data() + 1565, 7}, 0x4100692E79DB},
+    {0x100004E4091, 0x4100010C7910, {kw_masks.data() + 1572, 13}, 0x410069EE7DD9},
+    {0x100000A619D, 0x4100010C7910, {kw_masks.data() + 1585, 7}, 0x4100695EF99D},
+    {0x100008A7995, 0x4100010C7910, {kw_masks.data() + 1592, 5}, 0x410001BEFD95},
+    {0x100000A6493, 0x4100010C7910, {kw_masks.data() + 1597, 8}, 0x4100011E7D9F},
+    {0x100000A61B1, 0x4100010C7910, {kw_masks.data() + 1605, 6}, 0x4100013E79BF},
+    {0x100000A31D9, 0x4100010C7910, {kw_masks.data() + 1611, 7}, 0x4100017EF9DD},
+    {0x100000A0099, 0x4100010C7910, {kw_masks.data() + 1618, 4}, 0x4100012E7999},
+    {0x100000AA591, 0x4100010C7910, {kw_masks.data() + 1622, 11}, 0x4100697EFD9F},
+    {0x100000A60D1, 0x4100010C7910, {kw_masks.data() + 1633, 3}, 0x4100690E79D1},
+    {0x100014A4891, 0x4100010C7910, {kw_masks.data() + 1636, 7}, 0x4100696E799D},
+    {0x100000A20D1, 0x4100010C7910, {kw_masks.data() + 1643, 7}, 0x4100692E79D5},
+    {0x100001A0893, 0x4100010C7910, {kw_masks.data() + 1650, 7}, 0x4100693E7997},
+    {0x100001A09D3, 0x4100010C7910, {kw_masks.data() + 1657, 13}, 0x4100693EFDD7},
+    {0x100001A8891, 0x4100010C7910, {kw_masks.data() + 1670, 7}, 0x4100693EF993},
+    {0x100004A6093, 0x4100010C7910, {kw_masks.data() + 1677, 3}, 0x4100694E7993},
+    {0x100000A0C97, 0x4100010C7910, {kw_masks.data() + 1680, 4}, 0x4100016E7D9F},
+    {0x100010A00D1, 0x4100010C7910, {kw_masks.data() + 1684, 10}, 0x4100692EF9D5},
+    {0x100004A0191, 0x4100010C7910, {kw_masks.data() + 1694, 3}, 0x4100694E7991},
+    {0x10000061501, 0x4100010C7910, {kw_masks.data() + 1697, 9}, 0x4100018EFDDD},
+    {0x100001EE198, 0x4100010C7910, {kw_masks.data() + 1706, 18}, 0x841000D1EFDFD},
+    {0x10001067853, 0x4100010C7910, {kw_masks.data() + 1724, 7}, 0x4100011EF95F},
+    {0x100001849EC, 0x4100010C7910, {kw_masks.data() + 1731, 9}, 0x4100015E7DFF},
+    {0x46904, 0x4100010C7910, {kw_masks.data() + 1740, 7}, 0x4100018CF91E},
+    {0x3000108, 0x4100010C7910, {kw_masks.data() + 1747, 7}, 0x4100030E79DD},
+    {0x100004EC819, 0x4100010C7910, {kw_masks.data() + 1754, 13}, 0x4100015FFDDD},
+    {0x100014421C9, 0x4100010C7910, {kw_masks.data() + 1767, 13}, 0x4100015E7DFD},
+    {0x4890, 0x4100010C7910, {kw_masks.data() + 1780, 2}, 0x4100010C7990},
+    {0x1000004E897, 0x4100010C7910, {kw_masks.data() + 1782, 11}, 0x4100019CFDDF},
+    {0x1000114A996, 0x4100010C7910, {kw_masks.data() + 1793, 6}, 0x4100015CF997},
+    {0x100001C88B6, 0x4100010C7910, {kw_masks.data() + 1799, 6}, 0x4100011CF9FF},
+    {0x100001A29D3, 0x4100010C7910, {kw_masks.data() + 1805, 7}, 0x4100011E79DB},
+    {0x100001868C3, 0x4100010C7910, {kw_masks.data() + 1812, 17}, 0x4100037E7DDF},
+    {0x2000000, 0x4100010C7910, {kw_masks.data() + 1829, 10}, 0x4100030EF9DC},
+    {0x100006021C9, 0x41000100C81A, {kw_masks.data() + 1839, 19}, 0x4100117EE9FF},
+    {0x100000665BF, 0x41000100C81A, {kw_masks.data() + 1858, 6}, 0x41000106EDFF},
+    {0x100014EA9F9, 0x41000100C81A, {kw_masks.data() + 1864, 7}, 0x4100014EE9FB},
+    {0x10000062199, 0x41000100C81A, {kw_masks.data() + 1871, 8}, 0x4100812EE9FB},
+    {0x100003C2815, 0x41000100C81A, {kw_masks.data() + 1879, 7}, 0x4100013EE9FF},
+    {0x100004E21C9, 0x41000100C81A, {kw_masks.data() + 1886, 10}, 0x4100014EEDFF},
+    {0x100004E28B9, 0x41000100C81A, {kw_masks.data() + 1896, 10}, 0x4100014EEDFF},
+    {0x1000040F889, 0x41000100C81A, {kw_masks.data() + 1906, 11}, 0x41000156FDFF},
+    {0x1000010B889, 0x41000100C81A, {kw_masks.data() + 1917, 14}, 0x4100015EFDFF},
+    {0x100005EA9F9, 0x41000100C81A, {kw_masks.data() + 1931, 17}, 0x4100017EEDFF},
+    {0x100005EA1C9, 0x41000100C81A, {kw_masks.data() + 1948, 17}, 0x4100017EEDFF},
+    {0x10000006489, 0x41000100C81A, {kw_masks.data() + 1965, 18}, 0x4100015EFDFF},
+    {0x1000006A1FC, 0x41000100C81A, {kw_masks.data() + 1983, 14}, 0x410003DEE9FF},
+    {0x1000000A1CD, 0x41000100C81A, {kw_masks.data() + 1997, 9}, 0x4100011EF9FF},
+    {0x100012A618D, 0x41000100C81A, {kw_masks.data() + 2006, 6}, 0x4100012EE9FF},
+    {0x1000006617C, 0x41000100C81A, {kw_masks.data() + 2012, 7}, 0x4100011EEDFF},
+    {0x10000DE71FF, 0x41000100C81A, {kw_masks.data() + 2019, 13}, 0x410021FEF9FF},
+    {0x200100013E4850, 0x41000100C81A, {kw_masks.data() + 2032, 9}, 0x204100013EE9FB},
+    {0x100000E61F0, 0x41000100C81A, {kw_masks.data() + 2041, 7}, 0x204100010EEDFF},
+    {0x1000000389D, 0x41000100C81A, {kw_masks.data() + 2048, 8}, 0x4100010EFDFF},
+    {0x1000088EDFF, 0x41000100C81A, {kw_masks.data() + 2056, 8}, 0x4100018EEDFF},
+    {0x100008AE5DF, 0x41000100C81A, {kw_masks.data() + 2064, 8}, 0x4100018EEDFF},
+    {0x1000098E5DF, 0x41000100C81A, {kw_masks.data() + 2072, 8}, 0x4100019EEDFF},
+    {0x10000023978, 0x41000100C81A, {kw_masks.data() + 2080, 4}, 0x41000106F9FB},
+    {0x10000C8E5DF, 0x41000100C81A, {kw_masks.data() + 2084, 8}, 0x410001CEEDFF},
+    {0x1000098E158, 0x41000100C81A, {kw_masks.data() + 2092, 8}, 0x4100019EE9FB},
+    {0x10000EAE1D9, 0x41000100C81A, {kw_masks.data() + 2100, 9}, 0x410001FEEDFB},
+    {0x100001C9082, 0x41000100C81A, {kw_masks.data() + 2109, 10}, 0x84100091EFDFF},
+    {0x100005C708A, 0x41000100C81A, {kw_masks.data() + 2119, 12}, 0x204100095EFDFF},
+    {0x100000E0139, 0x41000100C81A, {kw_masks.data() + 2131, 8}, 0x4100011EE9FF},
+    {0x100000C7164, 0x41000100C81A, {kw_masks.data() + 2139, 18}, 0x4100011EFDFF},
+    {0x200100000C2975, 0x41000100C81A, {kw_masks.data() + 2157, 8}, 0x204100014EE9FF},
+    {0x200100000E21E5, 0x41000100C81A, {kw_masks.data() + 2165, 8}, 0x204100014EE9FF},
+    {0x1000004A9CD, 0x41000100C81A, {kw_masks.data() + 2173, 18}, 0x410001FEFBDF},
+    {0x100000621C9, 0x41000100C81A, {kw_masks.data() + 2191, 8}, 0x4100011EE9DF},
+    {0x100000E2099, 0x41000100C81A, {kw_masks.data() + 2199, 5}, 0x4100213EE89B},
+    {0x1000004E099, 0x41000100C81A, {kw_masks.data() + 2204, 6}, 0x41000376EADB},
+    {0x100001ED8D1, 0x41000100C81A, {kw_masks.data() + 2210, 9}, 0x4100015EF9DF},
+    {0x42499, 0x41000100C81A, {kw_masks.data() + 2219, 7}, 0x4100010EFDDB},
+    {0x100000468B9, 0x41000100C81A, {kw_masks.data() + 2226, 16}, 0x410001FEFDFF},
+    {0x100004A21C9, 0x41000100C81A, {kw_masks.data() + 2242, 4}, 0x4100014AE9DB},
+    {0x1000004E981, 0x41000100C81A, {kw_masks.data() + 2246, 11}, 0x4100017EFD9F},
+    {0x40930, 0x41000100C81A, {kw_masks.data() + 2257, 5}, 0x41000106F9BF},
+    {0x1000084893E, 0x41000100C81A, {kw_masks.data() + 2262, 19}, 0x410001DEFFFF},
+    {0x10000023995, 0x41000100C81A, {kw_masks.data() + 2281, 6}, 0x4100010EF99F},
+    {0x100000039D5, 0x41000100C81A, {kw_masks.data() + 2287, 6}, 0x4100010EF9DF},
+    {0x850, 0x41000100C81A, {kw_masks.data() + 2293, 8}, 0x4100010EFD7F},
+    {0x84020, 0x41000100C81A, {kw_masks.data() + 2301, 7}, 0x4100010EFD3F},
+    {0x20011, 0x41000100C81A, {kw_masks.data() + 2308, 9}, 0x4100011EE9DB},
+    {0x100004A21D9, 0x41000100C81A, {kw_masks.data() + 2317, 7}, 0x4100014EE9DF},
+    {0x46010, 0x41000100C81A, {kw_masks.data() + 2324, 8}, 0x4100010EF81B},
+    {0x22103, 0x41000100C81A, {kw_masks.data() + 2332, 5}, 0x4100010EF95B},
+    {0x100000A7995, 0x41000100C81A, {kw_masks.data() + 2337, 11}, 0x4100011EF9DF},
+    {0x142840, 0x41000100C81A, {kw_masks.data() + 2348, 10}, 0x4100019EE9DB},
+    {0x84080, 0x41000100C81A, {kw_masks.data() + 2358, 7}, 0x4100014EE99B},
+    {0x6012, 0x41000100C81A, {kw_masks.data() + 2365, 7}, 0x4100014EEDDB},
+    {0x1040010, 0x41000100C81A, {kw_masks.data() + 2372, 12}, 0x4100010EFD7F},
+    {0x1000010, 0x41000100C81A, {kw_masks.data() + 2384, 5}, 0x4100090EE81B},
+    {0x186050, 0x41000100C81A, {kw_masks.data() + 2389, 5}, 0x4100011EED5F},
+    {0x185080, 0x41000100C81A, {kw_masks.data() + 2394, 8}, 0x4100011EFDDF},
+    {0x1000008A942, 0x41000100C81A, {kw_masks.data() + 2402, 16}, 0x410001FEFD7F},
+    {0x1000003, 0x41000100C81A, {kw_masks.data() + 2418, 9}, 0x4100015EE9FF},
+    {0x98C, 0x41000100C81A, {kw_masks.data() + 2427, 7}, 0x204100011EEDDF},
+    {0x1004002, 0x41000100C81A, {kw_masks.data() + 2434, 9}, 0x204100011EEDDF},
+    {0x20940, 0x41000100C81A, {kw_masks.data() + 2443, 11}, 0x204100033EEDDF},
+    {0x6E010, 0x41000100C81A, {kw_masks.data() + 2454, 2}, 0x4100011EE81B},
+    {0x1400006E99B, 0x41000100C81A, {kw_masks.data() + 2456, 5}, 0x2041400116F99B},
+    {0x3001, 0x41000100C81A, {kw_masks.data() + 2461, 4}, 0x4100011EF81B},
+    {0x1400006E01B, 0x41000100C81A, {kw_masks.data() + 2465, 4}, 0x41400146ED9B},
+    {0x1400002301B, 0x41000100C81A, {kw_masks.data() + 2469, 5}, 0x41400146FD9B},
+    {0x1400042701B, 0x41000100C81A, {kw_masks.data() + 2474, 5}, 0x41400146FD9B},
+    {0x14000023199, 0x41000100C81A, {kw_masks.data() + 2479, 7}, 0x4140011EF99B},
+    {0x14001123985, 0x41000100C81A, {kw_masks.data() + 2486, 7}, 0x4140011EF99F},
+    {0x140004A3191, 0x41000100C81A, {kw_masks.data() + 2493, 7}, 0x4140015EF99B},
+    {0x1400000380B, 0x41000100C81A, {kw_masks.data() + 2500, 5}, 0x4140011EF81B},
+    {0x407001, 0x41000100C81A, {kw_masks.data() + 2505, 4}, 0x4100015EF81B},
+    {0x14000427199, 0x41000100C81A, {kw_masks.data() + 2509, 7}, 0x4140015EF99B},
+    {0x1400006E199, 0x41000100C81A, {kw_masks.data() + 2516, 5}, 0x4140011EE99B},
+    {0x14001527985, 0x41000100C81A, {kw_masks.data() + 2521, 7}, 0x4140015EF99F},
+    {0x1400116E995, 0x41000100C81A, {kw_masks.data() + 2528, 5}, 0x4140011EE99F},
+    {0x140004A7191, 0x41000100C81A, {kw_masks.data() + 2533, 7}, 0x4140015EF99B},
+    {0x140004EE191, 0x41000100C81A, {kw_masks.data() + 2540, 5}, 0x4140015EE99B},
+    {0x1400040780B, 0x41000100C81A, {kw_masks.data() + 2545, 5}, 0x4140015EF81B},
+    {0x1400006E81B, 0x41000100C81A, {kw_masks.data() + 2550, 3}, 0x4140011EE81B},
+    {0x1400042798B, 0x41000100C81A, {kw_masks.data() + 2553, 6}, 0x2041400146F99B},
+    {0x1400002798B, 0x41000100C81A, {kw_masks.data() + 2559, 5}, 0x2041400106F99B},
+    {0x1000006E818, 0x41000100C81A, {kw_masks.data() + 2564, 7}, 0x4100015EE95B},
+    {0x10000007809, 0x41000100C81A, {kw_masks.data() + 2571, 10}, 0x4100015EF9FB},
+    {0x10000407809, 0x41000100C81A, {kw_masks.data() + 2581, 10}, 0x4100015EF9DB},
+    {0x1000046E170, 0x41000100C81A, {kw_masks.data() + 2591, 11}, 0x4100015EE97B},
+    {0x10000427161, 0x41000100C81A, {kw_masks.data() + 2602, 12}, 0x4100015EF97B},
+    {0x10000427161, 0x41000100C81A, {kw_masks.data() + 2614, 12}, 0x4100015EF97B},
+    {0x100001EE150, 0x41000100C81A, {kw_masks.data() + 2626, 11}, 0x4100015EFDFF},
+    {0x1000018F141, 0x41000100C81A, {kw_masks.data() + 2637, 12}, 0x4100015EFDFF},
+    {0x1000058F141, 0x41000100C81A, {kw_masks.data() + 2649, 12}, 0x4100015EFDFF},
+    {0x100001EE150, 0x41000100C81A, {kw_masks.data() + 2661, 8}, 0x4100011EE9FB},
+    {0x100001E7151, 0x41000100C81A, {kw_masks.data() + 2669, 9}, 0x4100011EF9FB},
+    {0x100005E7151, 0x41000100C81A, {kw_masks.data() + 2678, 9}, 0x4100015EF9FB},
+    {0x100001EE550, 0x41000100C81A, {kw_masks.data() + 2687, 7}, 0x4100019EFDDF},
+    {0x100001E7551, 0x41000100C81A, {kw_masks.data() + 2694, 8}, 0x4100019EFDDF},
+    {0x100005E7551, 0x41000100C81A, {kw_masks.data() + 2702, 8}, 0x410001DEFDDF},
+    {0x100000EE1D9, 0x41000100C81A, {kw_masks.data() + 2710, 13}, 0x4100017EFDFF},
+    {0x1000008B1C9, 0x41000100C81A, {kw_masks.data() + 2723, 14}, 0x4100017EFDFF},
+    {0x1000048F1C9, 0x41000100C81A, {kw_masks.data() + 2737, 14}, 0x4100017EFDFF},
+    {0x1000006E1D9, 0x41000100C81A, {kw_masks.data() + 2751, 10}, 0x4100015FFDDF},
+    {0x100000631C9, 0x41000100C81A, {kw_masks.data() + 2761, 11}, 0x4100015FFDDF},
+    {0x100004671C9, 0x41000100C81A, {kw_masks.data() + 2772, 11}, 0x4100015FFDDF},
+    {0x1000006E039, 0x41000100C81A, {kw_masks.data() + 2783, 6}, 0x4100011EE9FF},
+    {0x10000003039, 0x41000100C81A, {kw_masks.data() + 2789, 7}, 0x4100011EF9FF},
+    {0x10000407039, 0x41000100C81A, {kw_masks.data() + 2796, 7}, 0x4100015EF9FF},
+    {0x1000046E152, 0x41000100C81A, {kw_masks.data() + 2803, 14}, 0x4100017EFD7B},
+    {0x10000407143, 0x41000100C81A, {kw_masks.data() + 2817, 15}, 0x4100017EFD7B},
+    {0x10000407143, 0x41000100C81A, {kw_masks.data() + 2832, 15}, 0x4100017EFD7B},
+    {0x1000006F975, 0x41000100C81A, {kw_masks.data() + 2847, 14}, 0x410001DEFDFF},
+    {0x1000000B975, 0x41000100C81A, {kw_masks.data() + 2861, 15}, 0x410001DEFDFF},
+    {0x1000040F975, 0x41000100C81A, {kw_masks.data() + 2876, 15}, 0x410001DEFDFF},
+    {0x1000016E1D0, 0x41000100C81A, {kw_masks.data() + 2891, 14}, 0x4100017EFDFF},
+    {0x100001631C1, 0x41000100C81A, {kw_masks.data() + 2905, 15}, 0x4100017EFDFF},
+    {0x100005671C1, 0x41000100C81A, {kw_masks.data() + 2920, 15}, 0x4100017EFDFF},
+    {0x100004A4C91, 0x41000100C81A, {kw_masks.data() + 2935, 8}, 0x4100015EED9F},
+    {0x100004A7C91, 0x41000100C81A, {kw_masks.data() + 2943, 9}, 0x4100015EFD9F},
+    {0x100004A7C91, 0x41000100C81A, {kw_masks.data() + 2952, 9}, 0x4100015EFD9F},
+    {0x1C2018, 0x41000100C81A, {kw_masks.data() + 2961, 4}, 0x4100011EE85B},
+    {0x100001C3019, 0x41000100C81A, {kw_masks.data() + 2965, 5}, 0x4100011EF85B},
+    {0x100005C7019, 0x41000100C81A, {kw_masks.data() + 2970, 5}, 0x4100015EF85B},
+    {0xA0095, 0x41000100C81A, {kw_masks.data() + 2975, 6}, 0x4100011EE9BF},
+    {0x100000A3095, 0x41000100C81A, {kw_masks.data() + 2981, 7}, 0x4100011EF9BF},
+    {0x100004A7095, 0x41000100C81A, {kw_masks.data() + 2988, 7}, 0x4100015EF9BF},
+    {0x100258, 0x41000100C81A, {kw_masks.data() + 2995, 6}, 0x4100015EEB5F},
+    {0x10000103259, 0x41000100C81A, {kw_masks.data() + 3001, 7}, 0x4100015EFB5F},
+    {0x10000507259, 0x41000100C81A, {kw_masks.data() + 3008, 7}, 0x4100015EFB5F},
+    {0x21031, 0x41000100C81A, {kw_masks.data() + 3015, 5}, 0x41000106F8FF},
+    {0x10000023031, 0x41000100C81A, {kw_masks.data() + 3020, 6}, 0x41000106F8FF},
+    {0x10000427031, 0x41000100C81A, {kw_masks.data() + 3026, 6}, 0x41000146F8FF},
+    {0x4404, 0x41000100C81A, {kw_masks.data() + 3032, 4}, 0x41000106ECBE},
+    {0x10000007405, 0x41000100C81A, {kw_masks.data() + 3036, 5}, 0x41000106FCBF},
+    {0x10000407405, 0x41000100C81A, {kw_masks.data() + 3041, 5}, 0x41000146FCBF},
+    {0x3195, 0x41000100C81A, {kw_masks.data() + 3046, 6}, 0x4100011EF99F},
+    {0x10000003195, 0x41000100C81A, {kw_masks.data() + 3052, 7}, 0x4100011EF99F},
+    {0x10000407195, 0x41000100C81A, {kw_masks.data() + 3059, 7}, 0x4100015EF99F},
+    {0x100014A4435, 0x41000100C81A, {kw_masks.data() + 3066, 6}, 0x4100015EFD3F},
+    {0x100014A7435, 0x41000100C81A, {kw_masks.data() + 3072, 7}, 0x4100015EFD3F},
+    {0x100014A7435, 0x41000100C81A, {kw_masks.data() + 3079, 7}, 0x4100015EFD3F},
+    {0x10000424534, 0x41000100C81A, {kw_masks.data() + 3086, 8}, 0x204100015EFDFF},
+    {0x10000427535, 0x41000100C81A, {kw_masks.data() + 3094, 9}, 0x204100015EFDFF},
+    {0x10000427535, 0x41000100C81A, {kw_masks.data() + 3103, 9}, 0x204100015EFDFF},
+    {0xC2114, 0x41000100C81A, {kw_masks.data() + 3112, 8}, 0x4100010EF9DF},
+    {0x100000C3115, 0x41000100C81A, {kw_masks.data() + 3120, 9}, 0x4100010EF9DF},
+    {0x100004C7115, 0x41000100C81A, {kw_masks.data() + 3129, 9}, 0x4100014EF9DF},
+    {0xC69D4, 0x41000100C81A, {kw_masks.data() + 3138, 8}, 0x4100017EF9FF},
+    {0x100000C79D5, 0x41000100C81A, {kw_masks.data() + 3146, 9}, 0x4100017EF9FF},
+    {0x100004C79D5, 0x41000100C81A, {kw_masks.data() + 3155, 9}, 0x4100017EF9FF},
+    {0x62150, 0x41000100C81A, {kw_masks.data() + 3164, 8}, 0x4100010EED5F},
+    {0x10000063151, 0x41000100C81A, {kw_masks.data() + 3172, 9}, 0x4100010EFD5F},
+    {0x10000467151, 0x41000100C81A, {kw_masks.data() + 3181, 9}, 0x4100014EFD5F},
+    {0xE0101, 0x41000100C81A, {kw_masks.data() + 3190, 4}, 0x4100010EE91B},
+    {0x100000E3101, 0x41000100C81A, {kw_masks.data() + 3194, 5}, 0x4100010EF91B},
+    {0x100004E7101, 0x41000100C81A, {kw_masks.data() + 3199, 5}, 0x4100014EF91B},
+    {0x8C900, 0x41000100C81A, {kw_masks.data() + 3204, 4}, 0x4100010EE91B},
+    {0x1000008F901, 0x41000100C81A, {kw_masks.data() + 3208, 5}, 0x4100010EF91B},
+    {0x1000048F901, 0x41000100C81A, {kw_masks.data() + 3213, 5}, 0x4100014EF91B},
+    {0x1E6001, 0x41000100C81A, {kw_masks.data() + 3218, 5}, 0x4100011EEC1F},
+    {0x100001E7001, 0x41000100C81A, {kw_masks.data() + 3223, 6}, 0x4100011EFC1F},
+    {0x100005E7001, 0x41000100C81A, {kw_masks.data() + 3229, 6}, 0x4100015EFC1F},
+    {0xA01F0, 0x41000100C81A, {kw_masks.data() + 3235, 5}, 0x4100011EEDFE},
+    {0x100000A31F1, 0x41000100C81A, {kw_masks.data() + 3240, 6}, 0x4100011EFDFF},
+    {0x100004A71F1, 0x41000100C81A, {kw_masks.data() + 3246, 6}, 0x4100015EFDFF},
+    {0x1000002C934, 0x41000100C81A, {kw_masks.data() + 3252, 12}, 0x4100017EE9BF},
+    {0x1000002F935, 0x41000100C81A, {kw_masks.data() + 3264, 13}, 0x4100017EF9BF},
+    {0x1000042F935, 0x41000100C81A, {kw_masks.data() + 3277, 13}, 0x4100017EF9BF},
+    {0x28011C, 0x41000100C81A, {kw_masks.data() + 3290, 5}, 0x4100013EE99E},
+    {0x1000028311D, 0x41000100C81A, {kw_masks.data() + 3295, 6}, 0x4100013EF99F},
+    {0x1000068711D, 0x41000100C81A, {kw_masks.data() + 3301, 6}, 0x4100017EF99F},
+    {0x120049, 0x41000100C81A, {kw_masks.data() + 3307, 7}, 0x4100011EFDDF},
+    {0x10000123049, 0x41000100C81A, {kw_masks.data() + 3314, 8}, 0x4100011EFDDF},
+    {0x10000527049, 0x41000100C81A, {kw_masks.data() + 3322, 8}, 0x4100015EFDDF},
+    {0x2301, 0x41000100C81A, {kw_masks.data() + 3330, 13}, 0x4100014EEFFF},
+    {0x100005E6514, 0x41000100C81A, {kw_masks.data() + 3343, 13}, 0x410001DEFDBF},
+    {0x100005E7515, 0x41000100C81A, {kw_masks.data() + 3356, 13}, 0x410001DEFDBF},
+    {0x100005E7515, 0x41000100C81A, {kw_masks.data() + 3369, 14}, 0x410001DEFDBF},
+    {0x100004EE194, 0x41000100C81A, {kw_masks.data() + 3383, 8}, 0x4100014EF9DF},
+    {0x2A114, 0x41000100C81A, {kw_masks.data() + 3391, 11}, 0x4100014EED7F},
+    {0x6A114, 0x41000100C81A, {kw_masks.data() + 3402, 11}, 0x4100015FE93F},
+    {0x100005EE153, 0x41000100C81A, {kw_masks.data() + 3413, 4}, 0x4100015EE95B},
+    {0x100005A3153, 0x41000100C81A, {kw_masks.data() + 3417, 5}, 0x4100015EF95B},
+    {0x100005A7153, 0x41000100C81A, {kw_masks.data() + 3422, 5}, 0x4100015EF95B},
+    {0x100005EED95, 0x41000100C81A, {kw_masks.data() + 3427, 10}, 0x4100015EFDDF},
+    {0x100004E71BD, 0x41000100C81A, {kw_masks.data() + 3437, 10}, 0x4100014EFFBF},
+    {0x100009EE118, 0x41000100C81A, {kw_masks.data() + 3447, 5}, 0x410001DEF97B},
+    {0x10000987119, 0x41000100C81A, {kw_masks.data() + 3452, 7}, 0x410001DEF97B},
+    {0x10000D87119, 0x41000100C81A, {kw_masks.data() + 3459, 6}, 0x410001DEF97B},
+    {0x100006EE990, 0x41000100C81A, {kw_masks.data() + 3465, 4}, 0x4100016EE9DA},
+    {0x10000683991, 0x41000100C81A, {kw_masks.data() + 3469, 5}, 0x4100016EF9DB},
+    {0x10000687991, 0x41000100C81A, {kw_masks.data() + 3474, 6}, 0x4100016EF9DB},
+    {0x100004AF051, 0x41000100C81A, {kw_masks.data() + 3480, 4}, 0x4100014EF85B},
+    {0x100000AB051, 0x41000100C81A, {kw_masks.data() + 3484, 8}, 0x4100013EF87B},
+    {0x100000EE051, 0x41000100C81A, {kw_masks.data() + 3492, 8}, 0x4100013EE87B},
+    {0x200000000E217B, 0x41000100C81A, {kw_masks.data() + 3500, 10}, 0x204100015EF9FB},
+    {0x1000140717B, 0x41000100C81A, {kw_masks.data() + 3510, 11}, 0x4100015EF9FB},
+    {0x1000100317B, 0x41000100C81A, {kw_masks.data() + 3521, 11}, 0x4100015EF9FB},
+    {0x1000106E17B, 0x41000100C81A, {kw_masks.data() + 3532, 9}, 0x4100015EE97B},
+    {0x10001002853, 0x41000100C81A, {kw_masks.data() + 3541, 9}, 0x4100011EE9FF},
+    {0x100001C2805, 0x41000100C81A, {kw_masks.data() + 3550, 12}, 0x4100019EF9BF},
+    {0x40010000161805, 0x41000100C81A, {kw_masks.data() + 3562, 13}, 0x404100019EF9BF},
+    {0x10000941805, 0x41000100C81A, {kw_masks.data() + 3575, 12}, 0x4100019EF9BF},
+    {0x16C090, 0x41000100C81A, {kw_masks.data() + 3587, 6}, 0x4100015EE8FB},
+    {0x1000016F091, 0x41000100C81A, {kw_masks.data() + 3593, 7}, 0x4100015EF8FB},
+    {0x1000056F091, 0x41000100C81A, {kw_masks.data() + 3600, 8}, 0x4100015EF9FB},
+    {0x36A911, 0x41000100C81A, {kw_masks.data() + 3608, 8}, 0x4100017EF93F},
+    {0x1000036B911, 0x41000100C81A, {kw_masks.data() + 3616, 9}, 0x4100017EF93F},
+    {0x1000076F911, 0x41000100C81A, {kw_masks.data() + 3625, 9}, 0x4100017EF93F},
+    {0x1051, 0x41000100C81A, {kw_masks.data() + 3634, 12}, 0x4100035EF9FF},
+    {0x10000003051, 0x41000100C81A, {kw_masks.data() + 3646, 13}, 0x4100035EF9FF},
+    {0x10000407051, 0x41000100C81A, {kw_masks.data() + 3659, 13}, 0x4100035EF9FF},
+    {0x1020121, 0x41000100C81A, {kw_masks.data() + 3672, 8}, 0x410001CEF9FB},
+    {0x10001023121, 0x41000100C81A, {kw_masks.data() + 3680, 11}, 0x410001DEFDFF},
+    {0x10001427121, 0x41000100C81A, {kw_masks.data() + 3691, 10}, 0x410001CEF9FB},
+    {0x229111, 0x41000100C81A, {kw_masks.data() + 3701, 11}, 0x4100017EF9FF},
+    {0x1000022B111, 0x41000100C81A, {kw_masks.data() + 3712, 11}, 0x4100017EF9FF},
+    {0x1000062F111, 0x41000100C81A, {kw_masks.data() + 3723, 11}, 0x4100017EF9FF},
+    {0x6F010, 0x41000100C81A, {kw_masks.data() + 3734, 10}, 0x4100011EFD3F},
+    {0x23011, 0x41000100C81A, {kw_masks.data() + 3744, 13}, 0x4100011EFD3F},
+    {0x21119, 0x41000100C81A, {kw_masks.data() + 3757, 11}, 0x4100015EFD3F},
+    {0x830, 0x41000100C81A, {kw_masks.data() + 3768, 9}, 0x4100012EFDFF},
+    {0x10000003831, 0x41000100C81A, {kw_masks.data() + 3777, 10}, 0x4100012EFDFF},
+    {0x10000407831, 0x41000100C81A, {kw_masks.data() + 3787, 10}, 0x4100016EFDFF},
+    {0x2150, 0x41000100C81A, {kw_masks.data() + 3797, 9}, 0x4100015EFBFB},
+    {0x10000003151, 0x41000100C81A, {kw_masks.data() + 3806, 10}, 0x4100015EFBFB},
+    {0x10000407151, 0x41000100C81A, {kw_masks.data() + 3816, 10}, 0x4100015EFBFB},
+    {0x2005112, 0x41000100C81A, {kw_masks.data() + 3826, 10}, 0x4100035EFDFF},
+    {0x10002007113, 0x41000100C81A, {kw_masks.data() + 3836, 11}, 0x4100035EFDFF},
+    {0x10002407113, 0x41000100C81A, {kw_masks.data() + 3847, 11}, 0x4100035EFDFF},
+    {0xA4800, 0x41000100C81A, {kw_masks.data() + 3858, 7}, 0x4100010EF97B},
+    {0x100011A0195, 0x41000100C81A, {kw_masks.data() + 3865, 11}, 0x4100015FE9FF},
+    {0x100000EF151, 0x41000100C81A, {kw_masks.data() + 3876, 14}, 0x410001AEF9FF},
+    {0x100000C3151, 0x41000100C81A, {kw_masks.data() + 3890, 15}, 0x410001AEF9FF},
+    {0x100004C7151, 0x41000100C81A, {kw_masks.data() + 3905, 15}, 0x410001EEF9FF},
+    {0x100001EE1D5, 0x41000100C81A, {kw_masks.data() + 3920, 14}, 0x4100013EF9DF},
+    {0x100001A31D5, 0x41000100C81A, {kw_masks.data() + 3934, 15}, 0x4100013EF9DF},
+    {0x100005A71D5, 0x41000100C81A, {kw_masks.data() + 3949, 15}, 0x4100017EF9DF},
+    {0x1000046ED51, 0x41000100C81A, {kw_masks.data() + 3964, 12}, 0x4100016EFDDF},
+    {0x10000403D41, 0x41000100C81A, {kw_masks.data() + 3976, 12}, 0x4100016EFDDF},
+    {0x10000407D41, 0x41000100C81A, {kw_masks.data() + 3988, 13}, 0x4100016EFDDF},
+    {0x140004EEDF5, 0x41000100C81A, {kw_masks.data() + 4001, 14}, 0x4140016EFDFF},
+    {0x140004A7DE5, 0x41000100C81A, {kw_masks.data() + 4015, 15}, 0x4140016EFDFF},
+    {0x140004A3DE5, 0x41000100C81A, {kw_masks.data() + 4030, 14}, 0x4140016EFDFF},
+    {0x100000EE159, 0x41000100C81A, {kw_masks.data() + 4044, 4}, 0x4100012EE95F},
+    {0x100000C3149, 0x41000100C81A, {kw_masks.data() + 4048, 5}, 0x4100012EF95F},
+    {0x100004C7149, 0x41000100C81A, {kw_masks.data() + 4053, 5}, 0x4100016EF95F},
+    {0x1000006ED50, 0x41000100C81A, {kw_masks.data() + 4058, 5}, 0x4100012EED5F},
+    {0x10000003D51, 0x41000100C81A, {kw_masks.data() + 4063, 6}, 0x4100012EFD5F},
+    {0x10000407D51, 0x41000100C81A, {kw_masks.data() + 4069, 6}, 0x4100016EFD5F},
+    {0x140000EEDF5, 0x41000100C81A, {kw_masks.data() + 4075, 7}, 0x4140012EEDFF},
+    {0x140004A7DF5, 0x41000100C81A, {kw_masks.data() + 4082, 8}, 0x4140016EFDFF},
+    {0x140000A3DF5, 0x41000100C81A, {kw_masks.data() + 4090, 8}, 0x4140012EFDFF},
+    {0x100004EE195, 0x41000100C81A, {kw_masks.data() + 4098, 7}, 0x4100016EE9DF},
+    {0x140004EE1F5, 0x41000100C81A, {kw_masks.data() + 4105, 9}, 0x4140016EE9FF},
+    {0x10000483195, 0x41000100C81A, {kw_masks.data() + 4114, 8}, 0x4100016EF9DF},
+    {0x140004A31F5, 0x41000100C81A, {kw_masks.data() + 4122, 10}, 0x4140016EF9FF},
+    {0x10000487195, 0x41000100C81A, {kw_masks.data() + 4132, 8}, 0x4100016EF9DF},
+    {0x140004A71F5, 0x41000100C81A, {kw_masks.data() + 4140, 10}, 0x4140016EF9FF},
+    {0x100024EF99D, 0x41000100C81A, {kw_masks.data() + 4150, 5}, 0x4100036EF99F},
+    {0x140024EF9FD, 0x41000100C81A, {kw_masks.data() + 4155, 7}, 0x4140036EF9FF},
+    {0x100024A799D, 0x41000100C81A, {kw_masks.data() + 4162, 6}, 0x4100036EF99F},
+    {0x140024A79FD, 0x41000100C81A, {kw_masks.data() + 4168, 8}, 0x4140036EF9FF},
+    {0x100024A799D, 0x41000100C81A, {kw_masks.data() + 4176, 6}, 0x4100036EF99F},
+    {0x140024A79FD, 0x41000100C81A, {kw_masks.data() + 4182, 8}, 0x4140036EF9FF},
+    {0x1000056F995, 0x41000100C81A, {kw_masks.data() + 4190, 5}, 0x4100017EF99F},
+    {0x140005EF9F5, 0x41000100C81A, {kw_masks.data() + 4195, 7}, 0x4140017EF9FF},
+    {0x10000523995, 0x41000100C81A, {kw_masks.data() + 4202, 6}, 0x4100017EF99F},
+    {0x140005A39F5, 0x41000100C81A, {kw_masks.data() + 4208, 8}, 0x4140017EF9FF},
+    {0x10000527995, 0x41000100C81A, {kw_masks.data() + 4216, 6}, 0x4100017EF99F},
+    {0x140005A79F5, 0x41000100C81A, {kw_masks.data() + 4222, 8}, 0x4140017EF9FF},
+    {0x1000016E150, 0x41000100C81A, {kw_masks.data() + 4230, 13}, 0x4100013FFDFF},
+    {0x10000123141, 0x41000100C81A, {kw_masks.data() + 4243, 14}, 0x4100013FFDFF},
+    {0x10000527141, 0x41000100C81A, {kw_masks.data() + 4257, 14}, 0x4100017FFDFF},
+    {0x140001EE1F5, 0x41000100C81A, {kw_masks.data() + 4271, 15}, 0x4140013FFDFF},
+    {0x140005A71E5, 0x41000100C81A, {kw_masks.data() + 4286, 16}, 0x4140017FFDFF},
+    {0x140001A31E5, 0x41000100C81A, {kw_masks.data() + 4302, 16}, 0x4140013FFDFF},
+    {0x100000A281F, 0x41000100C81A, {kw_masks.data() + 4318, 4}, 0x4100012EE91F},
+    {0x1000040714D, 0x41000100C81A, {kw_masks.data() + 4322, 14}, 0xFFFFFFFFFFFFFFFF},
+    {0x1000000314D, 0x41000100C81A, {kw_masks.data() + 4336, 14}, 0xFFFFFFFFFFFFFFFF},
+    {0x100003EE951, 0x41000100C81A, {kw_masks.data() + 4350, 5}, 0x4100013EE95F},
+    {0x100015EE993, 0x41000100C81A, {kw_masks.data() + 4355, 18}, 0x4100017EF9FF},
+    {0x100015E3193, 0x41000100C81A, {kw_masks.data() + 4373, 19}, 0x4100017EF9FF},
+    {0x100015E7193, 0x41000100C81A, {kw_masks.data() + 4392, 19}, 0x4100017EF9FF},
+    {0x100010EF111, 0x41000100C81A, {kw_masks.data() + 4411, 13}, 0x410001FEF99F},
+    {0x100010E7111, 0x41000100C81A, {kw_masks.data() + 4424, 14}, 0x410001FEF99F},
+    {0x100014E7111, 0x41000100C81A, {kw_masks.data() + 4438, 14}, 0x410001FEF99F},
+    {0x1000006F956, 0x41000100C81A, {kw_masks.data() + 4452, 9}, 0x4100013EFD5F},
+    {0x10000003947, 0x41000100C81A, {kw_masks.data() + 4461, 10}, 0x4100013EFD5F},
+    {0x10000407947, 0x41000100C81A, {kw_masks.data() + 4471, 10}, 0x4100017EFD5F},
+    {0x1000006E174, 0x41000100C81A, {kw_masks.data() + 4481, 5}, 0x4100014EE97E},
+    {0x100000661D5, 0x41000100C81A, {kw_masks.data() + 4486, 7}, 0x4100010EEFDF},
+    {0x60510, 0x41000100C81A, {kw_masks.data() + 4493, 5}, 0x4100014EED1A},
+    {0x46601B, 0x41000100C81A, {kw_masks.data() + 4498, 6}, 0x4100014EED1B},
+    {0x1000006E970, 0x41000100C81A, {kw_masks.data() + 4504, 13}, 0x4100013EE97F},
+    {0x10000007961, 0x41000100C81A, {kw_masks.data() + 4517, 14}, 0x4100013EF97F},
+    {0x10000407961, 0x41000100C81A, {kw_masks.data() + 4531, 14}, 0x4100017EF97F},
+    {0x1000016E170, 0x41000100C81A, {kw_masks.data() + 4545, 9}, 0x4100017EE9FF},
+    {0x10000163161, 0x41000100C81A, {kw_masks.data() + 4554, 10}, 0x4100017EF9FF},
+    {0x10000567161, 0x41000100C81A, {kw_masks.data() + 4564, 10}, 0x4100017EF9FF},
+    {0x100004EE153, 0x41000100C81A, {kw_masks.data() + 4574, 14}, 0x4100017EEDFF},
+    {0x100004A7143, 0x41000100C81A, {kw_masks.data() + 4588, 15}, 0x4100017EFDFF},
+    {0x100004A7143, 0x41000100C81A, {kw_masks.data() + 4603, 15}, 0x4100017EFDFF},
+    {0x1000046F150, 0x41000100C81A, {kw_masks.data() + 4618, 7}, 0x4100014EF9FB},
+    {0x10000443141, 0x41000100C81A, {kw_masks.data() + 4625, 8}, 0x4100014EF9FB},
+    {0x10000447141, 0x41000100C81A, {kw_masks.data() + 4633, 9}, 0x4100014EF9FB},
+    {0x1000016E957, 0x41000100C81A, {kw_masks.data() + 4642, 11}, 0x4100015EFDDF},
+    {0x10000107947, 0x41000100C81A, {kw_masks.data() + 4653, 12}, 0x4100015EFDDF},
+    {0x10000507947, 0x41000100C81A, {kw_masks.data() + 4665, 12}, 0x4100015EFDDF},
+    {0x100004EE9F0, 0x41000100C81A, {kw_masks.data() + 4677, 12}, 0x4100015EEDFB},
+    {0x100004C39F1, 0x41000100C81A, {kw_masks.data() + 4689, 13}, 0x4100015EFDFB},
+    {0x100004C79F1, 0x41000100C81A, {kw_masks.data() + 4702, 13}, 0x4100015EFDFB},
+    {0x1000006E552, 0x41000100C81A, {kw_masks.data() + 4715, 9}, 0x4100010EED5E},
+    {0x10000003543, 0x41000100C81A, {kw_masks.data() + 4724, 10}, 0x4100010EFD5F},
+    {0x10000407543, 0x41000100C81A, {kw_masks.data() + 4734, 10}, 0x4100014EFD5F},
+    {0x100001EF553, 0x41000100C81A, {kw_masks.data() + 4744, 10}, 0x4100011EFD5F},
+    {0x10000187543, 0x41000100C81A, {kw_masks.data() + 4754, 11}, 0x4100011EFD5F},
+    {0x10000587543, 0x41000100C81A, {kw_masks.data() + 4765, 11}, 0x4100015EFD5F},
+    {0x100004EE9D5, 0x41000100C81A, {kw_masks.data() + 4776, 10}, 0x410001FEF9FF},
+    {0x100004A39D5, 0x41000100C81A, {kw_masks.data() + 4786, 11}, 0x410001FEF9FF},
+    {0x100004A79D5, 0x41000100C81A, {kw_masks.data() + 4797, 11}, 0x410001FEF9FF},
+    {0x100004EE950, 0x41000100C81A, {kw_masks.data() + 4808, 10}, 0x4100015EF95F},
+    {0x100004E3950, 0x41000100C81A, {kw_masks.data() + 4818, 10}, 0x4100015EF95F},
+    {0x100004E7950, 0x41000100C81A, {kw_masks.data() + 4828, 10}, 0x4100015EF95F},
+    {0x100014EE951, 0x41000100C81A, {kw_masks.data() + 4838, 7}, 0x4100014EF95B},
+    {0x100014AF951, 0x41000100C81A, {kw_masks.data() + 4845, 8}, 0x4100014EF95B},
+    {0x100014AF951, 0x41000100C81A, {kw_masks.data() + 4853, 8}, 0x4100014EF95B},
+    {0x1000106E9DB, 0x41000100C81A, {kw_masks.data() + 4861, 13}, 0x4100015EEDDF},
+    {0x1000100B9CB, 0x41000100C81A, {kw_masks.data() + 4874, 14}, 0x4100015EFDDF},
+    {0x1000140F9CB, 0x41000100C81A, {kw_masks.data() + 4888, 14}, 0x4100015EFDDF},
+    {0x1000016EB50, 0x41000100C81A, {kw_masks.data() + 4902, 11}, 0x4100011EFFDF},
+    {0x10000103B41, 0x41000100C81A, {kw_masks.data() + 4913, 12}, 0x4100011EFFDF},
+    {0x10000507B41, 0x41000100C81A, {kw_masks.data() + 4925, 12}, 0x4100015EFFDF},
+    {0x100001EE910, 0x41000100C81A, {kw_masks.data() + 4937, 14}, 0x4100039EF95F},
+    {0x100001CF901, 0x41000100C81A, {kw_masks.data() + 4951, 15}, 0x4100039EF95F},
+    {0x100005CF901, 0x41000100C81A, {kw_masks.data() + 4966, 15}, 0x410003DEF95F},
+    {0x100000EE5D3, 0x41000100C81A, {kw_masks.data() + 4981, 6}, 0x4100011EEDDB},
+    {0x1000006E11A, 0x41000100C81A, {kw_masks.data() + 4987, 12}, 0x4100030EF9DB},
+    {0x1000004E9D9, 0x41000100C81A, {kw_masks.data() + 4999, 14}, 0x4100015EF9FF},
+    {0x100004479D9, 0x41000100C81A, {kw_masks.data() + 5013, 16}, 0x4100015EF9FF},
+    {0x100004479C9, 0x41000100C81A, {kw_masks.data() + 5029, 15}, 0x4100015EF9FF},
+    {0x100000479D9, 0x41000100C81A, {kw_masks.data() + 5044, 16}, 0x4100015EF9FF},
+    {0x40500, 0x41000100C81A, {kw_masks.data() + 5060, 15}, 0x410001FEFDFF},
+    {0x10014000447501, 0x41000100C81A, {kw_masks.data() + 5075, 17}, 0x10414001FEFDFF},
+    {0x10014000043501, 0x41000100C81A, {kw_masks.data() + 5092, 16}, 0x10414001FEFDFF},
+    {0x10014000447501, 0x41000100C81A, {kw_masks.data() + 5108, 16}, 0x10414001FEFDFF},
+    {0x100005AC995, 0x41000100C81A, {kw_masks.data() + 5124, 14}, 0x4100017EFDFF},
+    {0x100140005AF995, 0x41000100C81A, {kw_masks.data() + 5138, 16}, 0x104140017EFDFF},
+    {0x100140005AF995, 0x41000100C81A, {kw_masks.data() + 5154, 15}, 0x104140017EFDFF},
+    {0x100140005AF995, 0x41000100C81A, {kw_masks.data() + 5169, 15}, 0x104140017EFDFF},
+    {0x10014001407923, 0x41000100C81A, {kw_masks.data() + 5184, 5}, 0x1041400140F9BF},
+    {0x10014001427961, 0x41000100C81A, {kw_masks.data() + 5189, 5}, 0x1041400142F9FF},
+    {0x10014001427963, 0x41000100C81A, {kw_masks.data() + 5194, 6}, 0x1041400142F9FF},
+    {0x10014001407923, 0x41000100C81A, {kw_masks.data() + 5200, 5}, 0x1041400140F9BF},
+    {0x10014001427961, 0x41000100C81A, {kw_masks.data() + 5205, 5}, 0x1041400142F9FF},
+    {0x10014001007923, 0x41000100C81A, {kw_masks.data() + 5210, 4}, 0x1041400100F9BF},
+    {0x10014001023961, 0x41000100C81A, {kw_masks.data() + 5214, 4}, 0x1041400102F9FF},
+    {0x10014001027963, 0x41000100C81A, {kw_masks.data() + 5218, 5}, 0x1041400102F9FF},
+    {0x10014001007923, 0x41000100C81A, {kw_masks.data() + 5223, 4}, 0x1041400100F9BF},
+    {0x10014001023961, 0x41000100C81A, {kw_masks.data() + 5227, 4}, 0x1041400102F9FF},
+    {0x10014001407923, 0x41000100C81A, {kw_masks.data() + 5231, 4}, 0x1041400140F9BF},
+    {0x10014001427961, 0x41000100C81A, {kw_masks.data() + 5235, 4}, 0x1041400142F9FF},
+    {0x10014001427963, 0x41000100C81A, {kw_masks.data() + 5239, 5}, 0x1041400142F9FF},
+    {0x10014001407923, 0x41000100C81A, {kw_masks.data() + 5244, 4}, 0x1041400140F9BF},
+    {0x10014001427961, 0x41000100C81A, {kw_masks.data() + 5248, 4}, 0x1041400142F9FF},
+    {0x10014001007923, 0x41000100C81A, {kw_masks.data() + 5252, 4}, 0x1041400100F9BF},
+    {0x10014001007923, 0x41000100C81A, {kw_masks.data() + 5256, 4}, 0x1041400100F9BF},
+    {0x10014001023961, 0x41000100C81A, {kw_masks.data() + 5260, 4}, 0x1041400102F9FF},
+    {0x10014001027963, 0x41000100C81A, {kw_masks.data() + 5264, 5}, 0x1041400102F9FF},
+    {0x10014001023961, 0x41000100C81A, {kw_masks.data() + 5269, 4}, 0x1041400102F9FF},
+    {0x10014001407923, 0x41000100C81A, {kw_masks.data() + 5273, 4}, 0x1041400140F9BF},
+    {0x10014001407923, 0x41000100C81A, {kw_masks.data() + 5277, 4}, 0x1041400140F9BF},
+    {0x10014001427961, 0x41000100C81A, {kw_masks.data() + 5281, 4}, 0x1041400142F9FF},
+    {0x10014001427963, 0x41000100C81A, {kw_masks.data() + 5285, 5}, 0x1041400142F9FF},
+    {0x10014001427961, 0x41000100C81A, {kw_masks.data() + 5290, 4}, 0x1041400142F9FF},
+    {0x1000004A5D9, 0x41000100C81A, {kw_masks.data() + 5294, 7}, 0x4100011EFDFF},
+    {0x100001C6992, 0x41000100C81A, {kw_masks.data() + 5301, 6}, 0x4100015EF99B},
+    {0x100001C6992, 0x41000100C81A, {kw_masks.data() + 5307, 10}, 0x4100013EF9BA},
+    {0x1000010E9D0, 0x41000100C81A, {kw_masks.data() + 5317, 13}, 0x4100017EFDFF},
+    {0x1001921, 0x41000100C81A, {kw_masks.data() + 5330, 4}, 0x41000106F9BF},
+    {0x100140011819AD, 0x41000100C81A, {kw_masks.data() + 5334, 5}, 0x104140011EF9BF},
+    {0x100140011819AD, 0x41000100C81A, {kw_masks.data() + 5339, 5}, 0x104140011EF9BF},
+    {0x100140011819AD, 0x41000100C81A, {kw_masks.data() + 5344, 5}, 0x104140011EF9BF},
+    {0x100140011819AD, 0x41000100C81A, {kw_masks.data() + 5349, 5}, 0x104140011EF9BF},
+    {0xEE120, 0x41000100C81A, {kw_masks.data() + 5354, 9}, 0x4100014EFDFF},
+    {0xAA170, 0x41000100C81A, {kw_masks.data() + 5363, 12}, 0x4100013EF97F},
+    {0x10001007435, 0x4100001E3911, {kw_masks.data() + 5375, 5}, 0x4100011E7D37},
+    {0x1007410, 0x4100001E3911, {kw_masks.data() + 5380, 4}, 0x4100011E7D13},
+    {0x24941, 0x4100001E3911, {kw_masks.data() + 5384, 3}, 0x4100001E7951},
+    {0x1A6041, 0x4100001E3911, {kw_masks.data() + 5387, 5}, 0x4100011EFD51},
+    {0x1000000407D, 0x4100001E3911, {kw_masks.data() + 5392, 8}, 0x4100011EF97F},
+    {0x4048, 0x4100001E3911, {kw_masks.data() + 5400, 6}, 0x4100001EF959},
+    {0x10000104158, 0x4100001E3911, {kw_masks.data() + 5406, 6}, 0x4100011E795F},
+    {0x1000026415C, 0x4100001E3911, {kw_masks.data() + 5412, 6}, 0x4100013E795F},
+    {0xC818, 0x4100001E3911, {kw_masks.data() + 5418, 5}, 0x4100011EF979},
+    {0x404820, 0x4100001E3911, {kw_masks.data() + 5423, 4}, 0x4100005E7935},
+    {0x804020, 0x4100001E3911, {kw_masks.data() + 5427, 4}, 0x4100009E7935},
+    {0x26005, 0x4100001E3911, {kw_masks.data() + 5431, 5}, 0x4100011E7915},
+    {0x10000080035, 0x4100001E3911, {kw_masks.data() + 5436, 7}, 0x4100011EBD35},
+    {0x80005, 0x4100001E3911, {kw_masks.data() + 5443, 7}, 0x4100001EBD15},
+    {0x10000080C07, 0x4100001E3911, {kw_masks.data() + 5450, 8}, 0x4100015E7DB7},
+    {0x6900, 0x4100001E3911, {kw_masks.data() + 5458, 13}, 0x4100025EF9FD},
+    {0x100000A0175, 0x4100001E3911, {kw_masks.data() + 5471, 7}, 0x4100001EF97F},
+    {0xA0150, 0x4100001E3911, {kw_masks.data() + 5478, 7}, 0x4100021EF95F},
+    {0x2C819, 0x4100001E3911, {kw_masks.data() + 5485, 7}, 0x4100021EF95F},
+    {0x100000640B5, 0x4100001E3911, {kw_masks.data() + 5492, 8}, 0x4100001F79FD},
+    {0x45010, 0x4100001E3911, {kw_masks.data() + 5500, 6}, 0x4100001E7D15},
+    {0x1006418, 0x4100001E3911, {kw_masks.data() + 5506, 8}, 0x4100011E7D9B},
+    {0x64090, 0x4100001E3911, {kw_masks.data() + 5514, 7}, 0x4100001F79F5},
+    {0x126104, 0x4100001E3911, {kw_masks.data() + 5521, 4}, 0x4100001E7935},
+    {0x2020013, 0x4100001E3911, {kw_masks.data() + 5525, 4}, 0x4100021EB913},
+    {0x20018, 0x4100001E3911, {kw_masks.data() + 5529, 3}, 0x4100001E3919},
+    {0x46102, 0x4100001E3911, {kw_masks.data() + 5532, 6}, 0x4100005E79BB},
+    {0x10000404035, 0x4100001E3911, {kw_masks.data() + 5538, 7}, 0x4100005E7D35},
+    {0x804000, 0x4100001E3911, {kw_masks.data() + 5545, 8}, 0x4100029E793F},
+    {0x100005A4833, 0x4100001E3911, {kw_masks.data() + 5553, 5}, 0x4100025E7933},
+    {0x404004, 0x4100001E3911, {kw_masks.data() + 5558, 7}, 0x4100005E7D35},
+    {0x10000008175, 0x4100001E3911, {kw_masks.data() + 5565, 7}, 0x4100001EFD77},
+    {0x8140, 0x4100001E3911, {kw_masks.data() + 5572, 7}, 0x4100005EFD77},
+    {0x24003, 0x4100001E3911, {kw_masks.data() + 5579, 4}, 0x4100001EF953},
+    {0x1000004E150, 0x4100001E3911, {kw_masks.data() + 5583, 8}, 0x4100001EF975},
+    {0x21001, 0x4100001E3911, {kw_masks.data() + 5591, 9}, 0x4100021EF99D},
+    {0x400010, 0x4100001E3911, {kw_masks.data() + 5600, 10}, 0x4100015EF9B3},
+    {0x84041, 0x4100001E3911, {kw_masks.data() + 5610, 7}, 0x4100021EFD7D},
+    {0x1815, 0x4100001E3911, {kw_masks.data() + 5617, 7}, 0x4100011EF99D},
+    {0x2001000058D895, 0x4100001E3911, {kw_masks.data() + 5624, 8}, 0x204100005EF99F},
+    {0x1801, 0x4100001E3911, {kw_masks.data() + 5632, 7}, 0xFFFFFFFFFFFFFFFF},
+    {0x20171, 0x4100001E3911, {kw_masks.data() + 5639, 4}, 0x4100001EF971},
+    {0x8A891, 0x4100001E3911, {kw_masks.data() + 5643, 3}, 0x4100001EB991},
+    {0x85081, 0x4100001E3911, {kw_masks.data() + 5646, 7}, 0x410001DE7DD5},
+    {0x66194, 0x4100001E3911, {kw_masks.data() + 5653, 3}, 0x4100001E7995},
+    {0x1CD181, 0x4100001E3911, {kw_masks.data() + 5656, 4}, 0x4100001EF991},
+    {0x10000145035, 0x4100001E3911, {kw_masks.data() + 5660, 4}, 0x4100001E7935},
+    {0x145010, 0x4100001E3911, {kw_masks.data() + 5664, 4}, 0x4100001E7911},
+    {0xA0001, 0x4100001E3911, {kw_masks.data() + 5668, 3}, 0x4100001E3911},
+    {0xE1091, 0x4100001E3911, {kw_masks.data() + 5671, 5}, 0x4100001EB9B5},
+    {0x100000A0137, 0x4100001E3911, {kw_masks.data() + 5676, 6}, 0x4100011EB937},
+    {0xA0103, 0x4100001E3911, {kw_masks.data() + 5682, 5}, 0x4100011EB913},
+    {0x10B584, 0x4100001E3911, {kw_masks.data() + 5687, 4}, 0x4100001FBD95},
+    {0x220013, 0x4100001E3911, {kw_masks.data() + 5691, 5}, 0x4100003E399B},
+    {0x40D8, 0x4100001E3911, {kw_masks.data() + 5696, 4}, 0x4100011EF9D9},
+    {0x80003, 0x4100001E3911, {kw_masks.data() + 5700, 4}, 0x4100003EB913},
+    {0x20013, 0x4100001E3911, {kw_masks.data() + 5704, 7}, 0x4100035E79F7},
+    {0x1000002C813, 0x4100001E3911, {kw_masks.data() + 5711, 6}, 0x4100005EF997},
+    {0x4C01, 0x4100001E3911, {kw_masks.data() + 5717, 9}, 0x4100005EFD3F},
+    {0xA009, 0x4100001E3911, {kw_masks.data() + 5726, 5}, 0x4100001EF93F},
+    {0xC4880, 0x4100001E3911, {kw_masks.data() + 5731, 5}, 0x4100035E7991},
+    {0xA4010, 0x4100001E3911, {kw_masks.data() + 5736, 5}, 0x4100011EF9F1},
+    {0x142400, 0x4100001E3911, {kw_masks.data() + 5741, 4}, 0x4100001E3D11},
+    {0x26441, 0x4100001E3911, {kw_masks.data() + 5745, 6}, 0x4100011EFF51},
+    {0x2005B, 0x4100001E3911, {kw_masks.data() + 5751, 5}, 0x4100011EF9DB},
+    {0x100004EA101, 0x4100001E3911, {kw_masks.data() + 5756, 7}, 0x4100005EB931},
+    {0x11A0410, 0x4100001E3911, {kw_masks.data() + 5763, 5}, 0x4100013E7DDB},
+    {0x2594, 0x4100001E3911, {kw_masks.data() + 5768, 4}, 0x4100011E7DDF},
+    {0xE4010, 0x4100001E3911, {kw_masks.data() + 5772, 4}, 0x4100011E79DB},
+    {0x100000825C5, 0x4100001E3911, {kw_masks.data() + 5776, 6}, 0x4100011E3DDF},
+    {0x10001000587, 0x4100001E3911, {kw_masks.data() + 5782, 5}, 0x4100011E7DDF},
+    {0x200100010A65E7, 0x4100001E3911, {kw_masks.data() + 5787, 9}, 0x204100015E7DFF},
+    {0x2010A, 0x4100001E3911, {kw_masks.data() + 5796, 3}, 0x4100011E79DB},
+    {0x10A150, 0x4100001E3911, {kw_masks.data() + 5799, 5}, 0x4100011EF9DF},
+    {0x204018, 0x4100001E3911, {kw_masks.data() + 5804, 6}, 0x4100013EF9FF},
+    {0x851, 0x4100001E3911, {kw_masks.data() + 5810, 4}, 0x4100011E79DB},
+    {0x10040C, 0x4100001E3911, {kw_masks.data() + 5814, 4}, 0x4100011E7DDF},
+    {0x442001, 0x4100001E3911, {kw_masks.data() + 5818, 7}, 0x4100015E7DDF},
+    {0x404800, 0x4100001E3911, {kw_masks.data() + 5825, 5}, 0x4100015E79DB},
+    {0x4008, 0x4100001E3911, {kw_masks.data() + 5830, 6}, 0x4100019E79DF},
+    {0xA00B1, 0x4100001E3911, {kw_masks.data() + 5836, 6}, 0x4100001EB9FB},
+    {0x7961, 0x4100001E3911, {kw_masks.data() + 5842, 6}, 0x4100011EF9FF},
+    {0xC415, 0x4100001E3911, {kw_masks.data() + 5848, 9}, 0x4100011EFDFF},
+    {0xAC001, 0x4100001E3911, {kw_masks.data() + 5857, 6}, 0x4100011EFDDB},
+    {0x402140, 0x4100001E3911, {kw_masks.data() + 5863, 11}, 0x4100017E79FF},
+    {0x10000020D0F, 0x4100001E3911, {kw_masks.data() + 5874, 10}, 0x4100017E7DDF},
+    {0x44050, 0x4100001E3911, {kw_masks.data() + 5884, 12}, 0x4100015E7DFF},
+    {0x80E190, 0x4100001E3911, {kw_masks.data() + 5896, 18}, 0x410001FEF9FF},
+    {0x24060, 0x4100001E3911, {kw_masks.data() + 5914, 4}, 0x4100001EF9F7},
+    {0x2491C, 0x4100001E3911, {kw_masks.data() + 5918, 4}, 0x4100021EF91D},
+    {0x1A0810, 0x4100001E3911, {kw_masks.data() + 5922, 5}, 0x4100001EF911},
+    {0x2020909, 0x4100001E3911, {kw_masks.data() + 5927, 3}, 0x4100021EB919},
+    {0x42411, 0x4100001E3911, {kw_masks.data() + 5930, 7}, 0x4100021EFD9F},
+    {0x1000002607D, 0x4100001E3911, {kw_masks.data() + 5937, 7}, 0x4100011EF97D},
+    {0x26049, 0x4100001E3911, {kw_masks.data() + 5944, 7}, 0x4100011EFDF9},
+    {0x16C009, 0x4100001E3911, {kw_masks.data() + 5951, 7}, 0x4100001EF99F},
+    {0x200000008A0010, 0x4100001E3911, {kw_masks.data() + 5958, 7}, 0x204100019EF919},
+    {0x100005CE9D1, 0x4100001E3911, {kw_masks.data() + 5965, 7}, 0x4100005EF9F7},
+    {0x400891, 0x4100001E3911, {kw_masks.data() + 5972, 5}, 0x4100005E7997},
+    {0xE988, 0x4100001E3911, {kw_masks.data() + 5977, 6}, 0x4100001EF9BF},
+    {0x24005, 0x4100001E3911, {kw_masks.data() + 5983, 5}, 0x4100005E7995},
+    {0x40811, 0x4100001E3911, {kw_masks.data() + 5988, 6}, 0x4100001E7915},
+    {0x401A0, 0x4100001E3911, {kw_masks.data() + 5994, 8}, 0x4100021EF9FD},
+    {0x100000EC9A5, 0x4100001E3911, {kw_masks.data() + 6002, 5}, 0x4100001EF9B5},
+    {0x4449A2, 0x4100001E3911, {kw_masks.data() + 6007, 4}, 0x4100005E79B3},
+    {0x60481, 0x4100001E3911, {kw_masks.data() + 6011, 4}, 0x4100001E3DB1},
+    {0x1CC004, 0x4100001E3911, {kw_masks.data() + 6015, 5}, 0x4100001EF915},
+    {0x10000068991, 0x4100001E3911, {kw_masks.data() + 6020, 7}, 0x4100001EF997},
+    {0x24805, 0x4100001E3911, {kw_masks.data() + 6027, 8}, 0x4100001E79F5},
+    {0x1040BB0, 0x4100001E3911, {kw_masks.data() + 6035, 15}, 0x4100013FFFF7},
+    {0x20007, 0x4100001E3911, {kw_masks.data() + 6050, 5}, 0x4100021E791F},
+    {0xE4812, 0x4100001E3911, {kw_masks.data() + 6055, 6}, 0x4100005F793F},
+    {0x69180, 0x4100001E3911, {kw_masks.data() + 6061, 6}, 0x4100001EF9B9},
+    {0x150108, 0x4100001E3911, {kw_masks.data() + 6067, 5}, 0x4100001F7D39},
+    {0x10E4010, 0x4100001E3911, {kw_masks.data() + 6072, 5}, 0x4100013EF959},
+    {0x42901, 0x4100001E3911, {kw_masks.data() + 6077, 7}, 0x4100001E795F},
+    {0x11A0832, 0x4100001E3911, {kw_masks.data() + 6084, 5}, 0x4100011EB977},
+    {0x100042, 0x4100001E3911, {kw_masks.data() + 6089, 4}, 0x4100001E395F},
+    {0x82001, 0x4100001E3911, {kw_masks.data() + 6093, 5}, 0x4100001E395F},
+    {0x1006092, 0x4100001E3911, {kw_masks.data() + 6098, 9}, 0x4100011EF9D7},
+    {0x80812, 0x4100001E3911, {kw_masks.data() + 6107, 4}, 0x4100001E3957},
+    {0x1000108081B, 0x4100001E3911, {kw_masks.data() + 6111, 9}, 0x4100011E395F},
+    {0xA0514, 0x4100001E3911, {kw_masks.data() + 6120, 6}, 0x4100001EFDD7},
+    {0x24485, 0x4100001E3911, {kw_masks.data() + 6126, 6}, 0x4100001EFDD7},
+    {0x68118, 0x4100001E3911, {kw_masks.data() + 6132, 4}, 0x4100001EB95F},
+    {0x1000046811A, 0x4100001E3911, {kw_masks.data() + 6136, 4}, 0x4100005EB95B},
+    {0x6E104, 0x4100001E3911, {kw_masks.data() + 6140, 6}, 0x4100021EF95F},
+    {0x1D5100, 0x4100001E3911, {kw_masks.data() + 6146, 10}, 0x4100003FF97F},
+    {0x1000820, 0x4100001E3911, {kw_masks.data() + 6156, 8}, 0x4100011EF97F},
+    {0x425000, 0x4100001E3911, {kw_masks.data() + 6164, 6}, 0x4100005EF9DB},
+    {0x25116, 0x4100001E3911, {kw_masks.data() + 6170, 7}, 0x4100003E7957},
+    {0x194012, 0x4100001E3911, {kw_masks.data() + 6177, 8}, 0x4100017FF9BF},
+    {0x10001065896, 0x4100001E3911, {kw_masks.data() + 6185, 6}, 0x4100015EF9F7},
+    {0x100004A49B0, 0x4100001E3911, {kw_masks.data() + 6191, 3}, 0x4100005EF9B1},
+    {0x1C4800, 0x4100001E3911, {kw_masks.data() + 6194, 10}, 0x4100015EF9BF},
+    {0xE4010, 0x4100001E3911, {kw_masks.data() + 6204, 3}, 0x4100005EF931},
+    {0x64010, 0x4100001E3911, {kw_masks.data() + 6207, 8}, 0x4100017EF97B},
+    {0x100004A4938, 0x4100001E3911, {kw_masks.data() + 6215, 4}, 0x4100015EF979},
+    {0x140186, 0x4100001E3911, {kw_masks.data() + 6219, 3}, 0x4100005EF9B7},
+    {0x566830, 0x4100001E3911, {kw_masks.data() + 6222, 5}, 0x4100005EF939},
+    {0x45802, 0x4100001E3911, {kw_masks.data() + 6227, 5}, 0x4100005EF93F},
+    {0x188900, 0x4100001E3911, {kw_masks.data() + 6232, 5}, 0x4100005EF9F3},
+    {0x1082185, 0x4100001E3911, {kw_masks.data() + 6237, 14}, 0x4100017EF9FF},
+    {0x42958, 0x4100001E3911, {kw_masks.data() + 6251, 6}, 0x4100011EF9D9},
+    {0x1000008E819, 0x4100001E3911, {kw_masks.data() + 6257, 8}, 0x4100005EF9DD},
+    {0x100002A2050, 0x4100001E3911, {kw_masks.data() + 6265, 7}, 0x4100003EF9F5},
+    {0x100001E411C, 0x4100001E3911, {kw_masks.data() + 6272, 8}, 0x4100001EF9FF},
+    {0x100000A9811, 0x4100001E3911, {kw_masks.data() + 6280, 6}, 0x4100001EF997},
+    {0x1C0005, 0x4100001E3911, {kw_masks.data() + 6286, 6}, 0x4100001EF9DD},
+    {0x100000641B5, 0x4100001E3911, {kw_masks.data() + 6292, 7}, 0x4100001EF9F5},
+    {0x20092, 0x4100001E3911, {kw_masks.data() + 6299, 4}, 0x4100001EF9B3},
+    {0x65485, 0x4100001E3911, {kw_masks.data() + 6303, 4}, 0x4100001EFD95},
+    {0x10000324835, 0x4100001E3911, {kw_masks.data() + 6307, 9}, 0x204100413EFDB5},
+    {0x10000009831, 0x4100001E3911, {kw_masks.data() + 6316, 5}, 0x4100001EF9F1},
+    {0x10000002831, 0x4100001E3911, {kw_masks.data() + 6321, 7}, 0x4100001EF9F1},
+    {0x100005A2979, 0x4100001E3911, {kw_masks.data() + 6328, 7}, 0x4100005EF9FB},
+    {0x100010CB010, 0x4100001E3911, {kw_masks.data() + 6335, 7}, 0x4100011EF9D7},
+    {0x100004C21D0, 0x4100001E3911, {kw_masks.data() + 6342, 8}, 0x4100005EF9DF},
+    {0x165080, 0x4100001E3911, {kw_masks.data() + 6350, 5}, 0x4100001EF9F9},
+    {0x100000E0831, 0x4100001E3911, {kw_masks.data() + 6355, 12}, 0x4100005EFDFF},
+    {0x68051, 0x410000026528, {kw_masks.data() + 6367, 5}, 0x4100011EE579},
+    {0x7810, 0x410000026528, {kw_masks.data() + 6372, 4}, 0x4100001AFD3D},
+    {0x4A7811, 0x410000026528, {kw_masks.data() + 6376, 3}, 0x4100005A7D39},
+    {0xA2151, 0x410000026528, {kw_masks.data() + 6379, 8}, 0x4100003E757D},
+    {0x7810, 0x410000026528, {kw_masks.data() + 6387, 5}, 0x4100001E7D3C},
+    {0x1910, 0x410000026528, {kw_masks.data() + 6392, 17}, 0x4100031FFFFD},
+    {0x2003, 0x410000026528, {kw_masks.data() + 6409, 4}, 0x4100001EF52B},
+    {0xA911, 0x410000026528, {kw_masks.data() + 6413, 6}, 0x4100001AED3D},
+    {0x7041, 0x410000026528, {kw_masks.data() + 6419, 4}, 0x4100001AFD6D},
+    {0x10000028819, 0x410000026528, {kw_masks.data() + 6423, 7}, 0x4100001AEDB9},
+    {0x1000002A851, 0x410000026528, {kw_masks.data() + 6430, 4}, 0x4100001AED79},
+    {0x28011, 0x410000026528, {kw_masks.data() + 6434, 3}, 0x4100001AE539},
+    {0x8095, 0x410000026528, {kw_masks.data() + 6437, 3}, 0x4100001AE5BD},
+    {0x60194, 0x410000026528, {kw_masks.data() + 6440, 6}, 0x4100011E65BE},
+    {0x14E0013, 0x410000026528, {kw_masks.data() + 6446, 4}, 0x4100015E653B},
+    {0x160912, 0x410000026528, {kw_masks.data() + 6450, 8}, 0x4100011E6D3A},
+    {0x100005A0520, 0x410000026528, {kw_masks.data() + 6458, 3}, 0x4100005A6528},
+    {0x85001, 0x410000026528, {kw_masks.data() + 6461, 4}, 0x4100003A7D7B},
+    {0x204910, 0x410000026528, {kw_masks.data() + 6465, 3}, 0x4100003A6D38},
+    {0x186004, 0x410000026528, {kw_masks.data() + 6468, 6}, 0xFFFFFFFFFFFFFFFF},
+    {0x20400D, 0x410000026528, {kw_masks.data() + 6474, 4}, 0x4100003A6D7F},
+    {0x8A851, 0x410000026528, {kw_masks.data() + 6478, 4}, 0x4100003AED7B},
+    {0x8C001, 0x410000026528, {kw_masks.data() + 6482, 3}, 0x4100002AED7B},
+    {0xA4005, 0x410000026528, {kw_masks.data() + 6485, 3}, 0x4100002A6D7F},
+    {0x10000026035, 0x410000026528, {kw_masks.data() + 6488, 8}, 0x4100022EFD7F},
+    {0x100000AC090, 0x410000026528, {kw_masks.data() + 6496, 4}, 0x4100002AEDFB},
+    {0x10000028812, 0x410000026528, {kw_masks.data() + 6500, 5}, 0x4100003EFD7F},
+    {0x121016, 0x410000026528, {kw_masks.data() + 6505, 4}, 0x4100003AFD7F},
+    {0x10001022871, 0x410000026528, {kw_masks.data() + 6509, 11}, 0x4100013E6DFF},
+    {0x24906, 0x410000026528, {kw_masks.data() + 6520, 5}, 0x4100006A6D7F},
+    {0x20945, 0x410000026528, {kw_masks.data() + 6525, 4}, 0x4100002A6D7F},
+    {0x6100, 0x410000026528, {kw_masks.data() + 6529, 4}, 0x4100002A6D7B},
+    {0x1CA011, 0x410000026528, {kw_masks.data() + 6533, 5}, 0x4100003EED7B},
+    {0x42013, 0x410000026528, {kw_masks.data() + 6538, 6}, 0x4100013E7D7B},
+    {0x1C2094, 0x410000026528, {kw_masks.data() + 6544, 5}, 0x4100003EFDFF},
+    {0x100000A6150, 0x410000026528, {kw_masks.data() + 6549, 9}, 0x4100003EEDFF},
+    {0x1000000C019, 0x410000026528, {kw_masks.data() + 6558, 10}, 0x4100013EFD7B},
+    {0x10000567082, 0x410000026528, {kw_masks.data() + 6568, 17}, 0x4100027EFDFB},
+    {0x100002A4853, 0x410000026528, {kw_masks.data() + 6585, 9}, 0x4100003EEDFB},
+    {0x2001B, 0x410000026528, {kw_masks.data() + 6594, 9}, 0x4100005EEDFF},
+    {0xE6105, 0x410000026528, {kw_masks.data() + 6603, 8}, 0x4100000EEDBF},
+    {0x100001A005B, 0x410000026528, {kw_masks.data() + 6611, 5}, 0x4100001AE5FF},
+    {0xA083B, 0x410000026528, {kw_masks.data() + 6616, 9}, 0x4100002EEDFB},
+    {0x20A8810, 0x410000026528, {kw_masks.data() + 6625, 5}, 0x4100027EED3D},
+    {0x853, 0x410000026528, {kw_masks.data() + 6630, 7}, 0x4100010EFDFF},
+    {0x4A415, 0x410000026528, {kw_masks.data() + 6637, 7}, 0xFFFFFFFFFFFFFFFF},
+    {0x400831, 0x410000026528, {kw_masks.data() + 6644, 6}, 0x4100006EED3F},
+    {0x100004400DC, 0x410000026528, {kw_masks.data() + 6650, 4}, 0x41000046E5FD},
+    {0x10000087013, 0x410000026528, {kw_masks.data() + 6654, 4}, 0x4100000AF53B},
+    {0x100011AC850, 0x410000026528, {kw_masks.data() + 6658, 9}, 0x4100011EFDFF},
+    {0x10000185035, 0x410000026528, {kw_masks.data() + 6667, 9}, 0x4100001EFDBF},
+    {0x6007, 0x410000026528, {kw_masks.data() + 6676, 5}, 0x4100000EF53F},
+    {0x1210D3, 0x410000026528, {kw_masks.data() + 6681, 7}, 0x4100011EF5FB},
+    {0x100000621B4, 0x410000026528, {kw_masks.data() + 6688, 5}, 0x4100000EE5BD},
+    {0x2008101, 0x410000026528, {kw_masks.data() + 6693, 7}, 0x41000316EDFD},
+    {0x100000840C8, 0x410000026528, {kw_masks.data() + 6700, 7}, 0x4100001EE5F9},
+    {0x44218D, 0x410000026528, {kw_masks.data() + 6707, 4}, 0x41000046E5BF},
+    {0x84005, 0x410000026528, {kw_masks.data() + 6711, 4}, 0x4100008AF53D},
+    {0x1A4102, 0x410000026528, {kw_masks.data() + 6715, 5}, 0x410000DAF53F},
+    {0x81811, 0x410000026528, {kw_masks.data() + 6720, 6}, 0x410000CAFDBD},
+    {0x100001E083B, 0x410000026528, {kw_masks.data() + 6726, 7}, 0x4100011EED7B},
+    {0x831, 0x410000026528, {kw_masks.data() + 6733, 5}, 0x4100000AFDBF},
+    {0x50, 0x410000026528, {kw_masks.data() + 6738, 4}, 0x4100000EE57B},
+    {0x6544, 0x410000026528, {kw_masks.data() + 6742, 14}, 0x4100013EE57F},
+    {0x1000044E8A9, 0x410000026528, {kw_masks.data() + 6756, 6}, 0x41000046EDBD},
+    {0x1000008C028, 0x410000026528, {kw_masks.data() + 6762, 5}, 0x4100005EE539},
+    {0x106038, 0x410000026528, {kw_masks.data() + 6767, 8}, 0x4100001EFDBD},
+    {0x100004CE982, 0x410000026528, {kw_masks.data() + 6775, 9}, 0x4100004EFDFF},
+    {0x10000062859, 0x410000026528, {kw_masks.data() + 6784, 4}, 0x41000006ED79},
+    {0x2E004, 0x410000026528, {kw_masks.data() + 6788, 6}, 0x41000022F53D},
+    {0x1A0012, 0x410000026528, {kw_masks.data() + 6794, 4}, 0x4100011AE53B},
+    {0xC0801, 0x410000026528, {kw_masks.data() + 6798, 10}, 0x4100013EFDBD},
+    {0x1000000603D, 0x410000026528, {kw_masks.data() + 6808, 4}, 0x41000002E53D},
+    {0x10000886012, 0x410000026528, {kw_masks.data() + 6812, 4}, 0x4100008E653B},
+    {0x10000020515, 0x410000026528, {kw_masks.data() + 6816, 4}, 0x41000006653D},
+    {0x10000020917, 0x410000026528, {kw_masks.data() + 6820, 5}, 0x41000006EF3F},
+    {0x1000002451C, 0x410000026528, {kw_masks.data() + 6825, 4}, 0x41000006653D},
+    {0x10001120114, 0x410000026528, {kw_masks.data() + 6829, 4}, 0x41000116653D},
+    {0x100004C7953, 0x410000026528, {kw_masks.data() + 6833, 9}, 0x4100005EFDFF},
+    {0xC81D1, 0x410000026528, {kw_masks.data() + 6842, 6}, 0x4100001EFDFB},
+    {0x100004EC019, 0x410000026528, {kw_masks.data() + 6848, 5}, 0x4100004EE539},
+    {0x6018, 0x410000026528, {kw_masks.data() + 6853, 8}, 0x4100005E653F},
+    {0x140180, 0x410000026528, {kw_masks.data() + 6861, 3}, 0x4100001665A9},
+    {0x100000691B8, 0x410000026528, {kw_masks.data() + 6864, 6}, 0x4100005EF5B9},
+    {0x100004E0DB5, 0x410000026528, {kw_masks.data() + 6870, 7}, 0x4100015EEDBD},
+    {0x10000007415, 0x410000026528, {kw_masks.data() + 6877, 7}, 0xFFFFFFFFFFFFFFFF},
+    {0x6049, 0x410000026528, {kw_masks.data() + 6884, 8}, 0x4100004EE77D},
+    {0x10B948, 0x410000026528, {kw_masks.data() + 6892, 8}, 0xFFFFFFFFFFFFFFFF},
+    {0x100001A6534, 0x410000026528, {kw_masks.data() + 6900, 5}, 0x4100011EE5BD},
+    {0x10000984413, 0x410000026528, {kw_masks.data() + 6905, 8}, 0x410001BEEDBF},
+    {0x100000E5135, 0x410000026528, {kw_masks.data() + 6913, 9}, 0x4100007E753D},
+    {0x1000024019D, 0x410000026528, {kw_masks.data() + 6922, 6}, 0x4100007E65BD},
+    {0x10000021115, 0x410000026528, {kw_masks.data() + 6928, 6}, 0x4100005E753D},
+    {0x1860C8, 0x410000026528, {kw_masks.data() + 6934, 6}, 0x4100005E65FB},
+    {0x4514, 0x410000026528, {kw_masks.data() + 6940, 6}, 0x4100004EEDBD},
+    {0x100010A059F, 0x410000026528, {kw_masks.data() + 6946, 9}, 0x4100014EEDBF},
+    {0xE4495, 0x410000026528, {kw_masks.data() + 6955, 7}, 0x4100014EEDBD},
+    {0x108415, 0x410000026528, {kw_masks.data() + 6962, 8}, 0x4100015EED7F},
+    {0x8110, 0x410000026528, {kw_masks.data() + 6970, 10}, 0x4100015EFD7D},
+    {0x100000A4897, 0x410000026528, {kw_masks.data() + 6980, 8}, 0x4100014E6DBF},
+    {0x100200D, 0x410000026528, {kw_masks.data() + 6988, 9}, 0x4100017EEDBD},
+    {0xC900, 0x410000026528, {kw_masks.data() + 6997, 6}, 0x4100015EED3D},
+    {0x1E000D, 0x410000026528, {kw_masks.data() + 7003, 5}, 0x4100005EE57D},
+    {0x1000108E090, 0x410000026528, {kw_masks.data() + 7008, 8}, 0x4100014EEFBB},
+    {0x10001084813, 0x410000026528, {kw_masks.data() + 7016, 9}, 0x4100014E7DBB},
+    {0x10000045D61, 0x410000026528, {kw_masks.data() + 7025, 3}, 0x410000067D69},
+    {0x100002A40D3, 0x410000026528, {kw_masks.data() + 7028, 10}, 0x4100002E75FF},
+    {0x8C011, 0x410000026528, {kw_masks.data() + 7038, 6}, 0x4100004AE53B},
+    {0x1000058E99D, 0x410000026528, {kw_masks.data() + 7044, 8}, 0x4100007AEDFF},
+    {0x40411, 0x410000026528, {kw_masks.data() + 7052, 7}, 0x4100003EED7F},
+    {0x100004AEDD6, 0x410000026528, {kw_masks.data() + 7059, 5}, 0x4100004AEDFF},
+    {0x10000442951, 0x410000026528, {kw_masks.data() + 7064, 11}, 0x4100027E6DFF},
+    {0x100000C4D45, 0x410000026528, {kw_masks.data() + 7075, 12}, 0x4100021E7DFF},
+    {0x100000AED0D, 0x410000026528, {kw_masks.data() + 7087, 14}, 0x4100031EFDFF},
+    {0x10000121052, 0x410000026528, {kw_masks.data() + 7101, 14}, 0x4100021EFDFF},
+    {0x10000163D56, 0x410000026528, {kw_masks.data() + 7115, 12}, 0x4100021E7DFF},
+    {0x10000042D55, 0x410000026528, {kw_masks.data() + 7127, 6}, 0x4100000E6D7F},
+    {0x100001E1853, 0x410000026528, {kw_masks.data() + 7133, 8}, 0x4100015F7DFF},
+    {0x1000013E948, 0x410000026528, {kw_masks.data() + 7141, 10}, 0x4100015FFD7D},
+    {0x100005E8185, 0x410000026528, {kw_masks.data() + 7151, 8}, 0x4100005EFFBD},
+    {0x10000180813, 0x410000026528, {kw_masks.data() + 7159, 7}, 0x4100001AFD3B},
+    {0x10000A24053, 0x410000026528, {kw_masks.data() + 7166, 6}, 0x410000FE677F},
+    {0x81011, 0x410000026528, {kw_masks.data() + 7172, 2}, 0x4100000A7539},
+    {0x114, 0x410000026528, {kw_masks.data() + 7174, 5}, 0x410000126D7E},
+    {0xCC584, 0x410000026528, {kw_masks.data() + 7179, 5}, 0x4100025EE7FD},
+    {0x100004AEDB9, 0x410000026528, {kw_masks.data() + 7184, 7}, 0x4100004EEDFD},
+    {0x10000026539, 0x410000026528, {kw_masks.data() + 7191, 17}, 0x4100015E7DFF},
+    {0x4E000, 0x410000026528, {kw_masks.data() + 7208, 4}, 0x4100004EEDBB},
+    {0x100000825B4, 0x410000026528, {kw_masks.data() + 7212, 8}, 0x4100004EEDFD},
+    {0x20201, 0x410000026528, {kw_masks.data() + 7220, 8}, 0x4100015EF7FD},
+    {0x2D081, 0x410000026528, {kw_masks.data() + 7228, 9}, 0x4100025FFFFD},
+    {0x2001000056E9F7, 0x4100002E8815, {kw_masks.data() + 7237, 9}, 0x204100007EF9FF},
+    {0x100004679D7, 0x4100002E8815, {kw_masks.data() + 7246, 7}, 0x4100006EF9DF},
+    {0x200100005E69D3, 0x4100002E8815, {kw_masks.data() + 7253, 9}, 0x204100007EF9DF},
+    {0x100004E79DB, 0x4100002E8815, {kw_masks.data() + 7262, 9}, 0x4100006EF9DF},
+    {0x1000042D809, 0x4100002E8815, {kw_masks.data() + 7271, 3}, 0x4100006ED81D},
+    {0x1000000F221, 0x4100002E8815, {kw_masks.data() + 7274, 3}, 0x4100002EFA35},
+    {0x4D005, 0x4100002E8815, {kw_masks.data() + 7277, 7}, 0x4100002EF95D},
+    {0x200100005CF11D, 0x4100002E8815, {kw_masks.data() + 7284, 7}, 0x204100007EF9DD},
+    {0x187101, 0x4100002E8815, {kw_masks.data() + 7291, 3}, 0x4100003EF9D5},
+    {0x42919, 0x4100002E8815, {kw_masks.data() + 7294, 10}, 0x4100003FFDDD},
+    {0x206805, 0x4100002E8815, {kw_masks.data() + 7304, 6}, 0x4100003EF9D5},
+    {0x10000187320, 0x4100002E8815, {kw_masks.data() + 7310, 6}, 0x4100003EFBF5},
+    {0xB145, 0x4100002E8815, {kw_masks.data() + 7316, 3}, 0x4100002EF9D5},
+    {0x100005A1997, 0x4100002E8815, {kw_masks.data() + 7319, 4}, 0x4100007ED9D7},
+    {0xE0018, 0x4100002E8815, {kw_masks.data() + 7323, 3}, 0x4100002EC9DD},
+    {0x100000E2919, 0x4100002E8815, {kw_masks.data() + 7326, 4}, 0x4100002EE9DD},
+    {0x100000AED01, 0x4100002E8815, {kw_masks.data() + 7330, 4}, 0x4100002EEDD5},
+    {0x1C1109, 0x4100002E8815, {kw_masks.data() + 7334, 3}, 0x4100003EB95F},
+    {0x1000014294F, 0x4100002E8815, {kw_masks.data() + 7337, 3}, 0x4100003EA95F},
+    {0x100001E694E, 0x4100002E8815, {kw_masks.data() + 7340, 4}, 0x4100003EE95F},
+    {0x20506, 0x4100002E8815, {kw_masks.data() + 7344, 7}, 0x4100017EFD5F},
+    {0x24404, 0x4100002E8815, {kw_masks.data() + 7351, 8}, 0x4100013EEDDF},
+    {0x404008, 0x4100002E8815, {kw_masks.data() + 7359, 6}, 0x4100007EF95F},
+    {0x180080, 0x4100002E8815, {kw_masks.data() + 7365, 8}, 0x4100013EF9DF},
+    {0x144090, 0x4100002E8815, {kw_masks.data() + 7373, 4}, 0x4100003EE9DF},
+    {0x100001E499C, 0x4100002E8815, {kw_masks.data() + 7377, 5}, 0x4100003EF9DF},
+    {0x144090, 0x4100002E8815, {kw_masks.data() + 7382, 12}, 0x4100017EF9DF},
+    {0x100005E61D9, 0x4100002E8815, {kw_masks.data() + 7394, 13}, 0x4100017EF9DF},
+    {0x1000010697E, 0x4100002E8815, {kw_masks.data() + 7407, 6}, 0x4100013EEB7F},
+    {0x100000CE335, 0x4100002E8815, {kw_masks.data() + 7413, 5}, 0x4100003EEB7F},
+    {0x100000CC134, 0x4100002E8815, {kw_masks.data() + 7418, 5}, 0x4100003EE97F},
+    {0xCC981, 0x4100002E8815, {kw_masks.data() + 7423, 5}, 0x4100003EF9DF},
+    {0x2403, 0x4100002E8815, {kw_masks.data() + 7428, 3}, 0x4100003EAD5F},
+    {0x84890, 0x4100002E8815, {kw_masks.data() + 7431, 3}, 0x4100003EE9DF},
+    {0x10000284890, 0x4100002E8815, {kw_masks.data() + 7434, 4}, 0x4100003EE9DF},
+    {0x100002E6114, 0x4100002E8815, {kw_masks.data() + 7438, 6}, 0x4100503EE9DF},
+    {0x44884, 0x4100002E8815, {kw_masks.data() + 7444, 3}, 0x4100003EE9DF},
+    {0x100000EF019, 0x4100002E8815, {kw_masks.data() + 7447, 4}, 0x4100003EF95F},
+    {0x10A4025, 0x4100002E8815, {kw_masks.data() + 7451, 3}, 0x4100013EE97F},
+    {0x100000CAA15, 0x4100002E8815, {kw_masks.data() + 7454, 4}, 0x4100003EAB5F},
+    {0xC0815, 0x4100002E8815, {kw_masks.data() + 7458, 4}, 0x4100003EE95F},
+    {0x402158, 0x4100002E8815, {kw_masks.data() + 7462, 7}, 0x4100007EF9DF},
+    {0x100014A4410, 0x4100002E8815, {kw_masks.data() + 7469, 4}, 0x4100017EED5F},
+    {0x100011E4933, 0x4100002E8815, {kw_masks.data() + 7473, 8}, 0x4100017EED7F},
+    {0x120084, 0x4100002E8815, {kw_masks.data() + 7481, 8}, 0x4100003EE9D7},
+    {0x155010, 0x4100002E8815, {kw_masks.data() + 7489, 7}, 0x4100003FFB5D},
+    {0x1000018B998, 0x4100002E8815, {kw_masks.data() + 7496, 4}, 0x4100003EF9DD},
+    {0x1146051, 0x4100002E8815, {kw_masks.data() + 7500, 8}, 0x4100017EFBDD},
+    {0x100000E6190, 0x4100002E8815, {kw_masks.data() + 7508, 5}, 0x4100003EE9D5},
+    {0x403, 0x4100002E8815, {kw_masks.data() + 7513, 8}, 0x4100003EFFD7},
+    {0x186121, 0x4100002E8815, {kw_masks.data() + 7521, 3}, 0x4100003EE9B5},
+    {0x82010, 0x4100002E8815, {kw_masks.data() + 7524, 4}, 0x4100002EF9D5},
+    {0x1004060, 0x4100002E8815, {kw_masks.data() + 7528, 4}, 0x4100012EC8F5},
+    {0x100004E21C1, 0x4100002E8815, {kw_masks.data() + 7532, 5}, 0x4100006EE9D5},
+    {0x10C8115, 0x4100002E8815, {kw_masks.data() + 7537, 4}, 0x4100012EC995},
+    {0x100003E7111, 0x4100002E8815, {kw_masks.data() + 7541, 7}, 0x4100003EF9D5},
+    {0x162110, 0x4100002E8815, {kw_masks.data() + 7548, 6}, 0x4100003EF9D5},
+    {0x100011C851D, 0x4100002E8815, {kw_masks.data() + 7554, 11}, 0x4100013EEDDF},
+    {0x1C2010, 0x4100002E8815, {kw_masks.data() + 7565, 6}, 0x4100003EEDDF},
+    {0x100000A21DB, 0x4100002E8815, {kw_masks.data() + 7571, 5}, 0x4100002EE9DF},
+    {0x100000EE1C0, 0x4100002E8815, {kw_masks.data() + 7576, 6}, 0x4100002EF9D5},
+    {0x10000164895, 0x4100002E8815, {kw_masks.data() + 7582, 5}, 0x4100003EF995},
+    {0x1000116E959, 0x4100002E8815, {kw_masks.data() + 7587, 10}, 0x4100013EFDDD},
+    {0x100004609B0, 0x4100002E8815, {kw_masks.data() + 7597, 7}, 0x4100007EFDB5},
+    {0x100000E4815, 0x4100002E8815, {kw_masks.data() + 7604, 7}, 0x4100003EFC95},
+    {0x1000002C813, 0x4100002E8815, {kw_masks.data() + 7611, 8}, 0x4100003EC9B7},
+    {0x100001E2114, 0x4100002E8815, {kw_masks.data() + 7619, 4}, 0x4100003EE995},
+    {0x285914, 0x4100002E8815, {kw_masks.data() + 7623, 10}, 0x4100017EF95F},
+    {0x10001420905, 0x4100002E8815, {kw_masks.data() + 7633, 9}, 0x4100017EF95F},
+    {0x200100000EA1D9, 0x4100002E8815, {kw_masks.data() + 7642, 8}, 0x204100017EEDDD},
+    {0x100001A2913, 0x4100002E8815, {kw_masks.data() + 7650, 10}, 0x204100017EEDDF},
+    {0xA2101, 0x4100002E8815, {kw_masks.data() + 7660, 6}, 0x4100017EE9DD},
+    {0xA5010, 0x4100002E8815, {kw_masks.data() + 7666, 5}, 0x4100017EF85F},
+    {0x100000A09C1, 0x4100002E8815, {kw_masks.data() + 7671, 7}, 0x4100017EF9DD},
+    {0xC6101, 0x4100002E8815, {kw_masks.data() + 7678, 5}, 0x4100017EE95D},
+    {0xA1001, 0x4100002E8815, {kw_masks.data() + 7683, 4}, 0x4100013EF85F},
+    {0x27901, 0x4100002E8815, {kw_masks.data() + 7687, 4}, 0x4100003EF9DD},
+    {0x100015A7901, 0x4100002E8815, {kw_masks.data() + 7691, 6}, 0x4100017EF95D},
+    {0x100000A1005, 0x4100002E8815, {kw_masks.data() + 7697, 7}, 0x4100013EF85F},
+    {0x140002, 0x4100002E8815, {kw_masks.data() + 7704, 5}, 0x4100003EE9DF},
+    {0x10000147146, 0x4100002E8815, {kw_masks.data() + 7709, 5}, 0x4100003EF95F},
+    {0x11E4812, 0x4100002E8815, {kw_masks.data() + 7714, 6}, 0x4100013EF85F},
+    {0x143102, 0x4100002E8815, {kw_masks.data() + 7720, 7}, 0x4100003EF9DF},
+    {0x103817, 0x4100002E8815, {kw_masks.data() + 7727, 5}, 0x4100013EF9DF},
+    {0x10000022170, 0x4100002E8815, {kw_masks.data() + 7732, 5}, 0x4100003EED7D},
+    {0x1000002C915, 0x4100002E8815, {kw_masks.data() + 7737, 7}, 0xFFFFFFFFFFFFFFFF},
+    {0x1000002F955, 0x4100002E8815, {kw_masks.data() + 7744, 5}, 0x4100003EF95D},
+    {0x880101, 0x4100002E8815, {kw_masks.data() + 7749, 9}, 0x410001FEE9DF},
+    {0x10000887145, 0x4100002E8815, {kw_masks.data() + 7758, 10}, 0x410001FEF9DF},
+    {0x185913, 0x4100002E8815, {kw_masks.data() + 7768, 6}, 0x4100003EF9DF},
+    {0x10000187957, 0x4100002E8815, {kw_masks.data() + 7774, 8}, 0x4100003EF9DF},
+    {0x100013EC994, 0x4100002E8815, {kw_masks.data() + 7782, 9}, 0x4100013EE9DD},
+    {0x100001A8504, 0x4100002E8815, {kw_masks.data() + 7791, 9}, 0x204100003EFD7F},
+    {0x100013A0D1C, 0x4100002E8815, {kw_masks.data() + 7800, 7}, 0x4100013EEDDD},
+    {0x100011A491D, 0x4100002E8815, {kw_masks.data() + 7807, 10}, 0x4100013EFDDD},
+    {0xA4005, 0x4100002E8815, {kw_masks.data() + 7817, 4}, 0x4100003EE9DD},
+    {0x10000022145, 0x4100002E8815, {kw_masks.data() + 7821, 5}, 0x4100023EF95D},
+    {0x10A5814, 0x4100002E8815, {kw_masks.data() + 7826, 4}, 0x4100013EF95D},
+    {0x100000E5014, 0x4100002E8815, {kw_masks.data() + 7830, 4}, 0x4100003EF85D},
+    {0x10000523995, 0x4100002E8815, {kw_masks.data() + 7834, 5}, 0x4100017EF9DF},
+    {0x100024A599D, 0x4100002E8815, {kw_masks.data() + 7839, 5}, 0x4100037EF9DF},
+    {0x100005E4585, 0x4100002E8815, {kw_masks.data() + 7844, 5}, 0x4100007EEDDD},
+    {0x1000916, 0x4100002E8815, {kw_masks.data() + 7849, 12}, 0x4100013EED5F},
+    {0x100000E4514, 0x4100002E8815, {kw_masks.data() + 7861, 4}, 0x4100003EED5D},
+    {0xE441B, 0x4100002E8815, {kw_masks.data() + 7865, 7}, 0x4100007EECDF},
+    {0x100000E4C11, 0x4100002E8815, {kw_masks.data() + 7872, 7}, 0x4100003EEC5F},
+    {0x100001CC002, 0x4100002E8815, {kw_masks.data() + 7879, 5}, 0x4100003EE85F},
+    {0x14A5001, 0x4100002E8815, {kw_masks.data() + 7884, 5}, 0x4100017EF9DD},
+    {0x100014A0D05, 0x4100002E8815, {kw_masks.data() + 7889, 5}, 0x4100017EED5D},
+    {0x10000125908, 0x4100002E8815, {kw_masks.data() + 7894, 4}, 0x4100003EF95D},
+    {0x10000109830, 0x4100002E8815, {kw_masks.data() + 7898, 9}, 0x4100003EF97D},
+    {0x400890, 0x4100002E8815, {kw_masks.data() + 7907, 8}, 0x4100007EE9DD},
+    {0x100000AC9D5, 0x4100002E8815, {kw_masks.data() + 7915, 11}, 0x4100013EF9DF},
+    {0x100020A69E5, 0x4100002E8815, {kw_masks.data() + 7926, 9}, 0x4100023EE9FD},
+    {0x100002A09F5, 0x4100002E8815, {kw_masks.data() + 7935, 10}, 0x4100003EE9FD},
+    {0x100000CE140, 0x4100002E8815, {kw_masks.data() + 7945, 5}, 0x4100003EE95D},
+    {0x1E6104, 0x4100002E8815, {kw_masks.data() + 7950, 4}, 0x4100003EE95F},
+    {0x26085, 0x4100002E8815, {kw_masks.data() + 7954, 5}, 0x4100006EE995},
+    {0x10001126142, 0x4100002E8815, {kw_masks.data() + 7959, 13}, 0x4100017EF977},
+    {0xC4903, 0x4100002E8815, {kw_masks.data() + 7972, 8}, 0x4100016EE9D7},
+    {0x6015, 0x4100002E8815, {kw_masks.data() + 7980, 4}, 0x4100006EE817},
+    {0xCC01B, 0x4100002E8815, {kw_masks.data() + 7984, 10}, 0x410001FEFD1F},
+    {0x1000006A1D1, 0x4100002E8815, {kw_masks.data() + 7994, 4}, 0x4100006EE9D5},
+    {0x1020030, 0x4100002E8815, {kw_masks.data() + 7998, 5}, 0x4100016EE877},
+    {0x100000A5003, 0x4100002E8815, {kw_masks.data() + 8003, 5}, 0x4100006EF817},
+    {0x48180, 0x4100002E8815, {kw_masks.data() + 8008, 6}, 0x4100006EE9D7},
+    {0x2A911, 0x4100002E8815, {kw_masks.data() + 8014, 9}, 0x4100012EEB75},
+    {0x1000006B911, 0x4100002E8815, {kw_masks.data() + 8023, 6}, 0x4100002EF915},
+    {0x100001AA919, 0x4100002E8815, {kw_masks.data() + 8029, 8}, 0x204100003EED9D},
+    {0x1000022A911, 0x4100002E8815, {kw_masks.data() + 8037, 9}, 0x4100002EE95D},
+    {0x1A8095, 0x4100002E8815, {kw_masks.data() + 8046, 6}, 0x204100013EEDDD},
+    {0xC0011, 0x4100002E8815, {kw_masks.data() + 8052, 4}, 0x4100002EE995},
+    {0xAC994, 0x4100002E8815, {kw_masks.data() + 8056, 7}, 0x4100002EE9B5},
+    {0x1000156E911, 0x4100002E8815, {kw_masks.data() + 8063, 4}, 0x4100017EE915},
+    {0x10001587917, 0x4100002E8815, {kw_masks.data() + 8067, 8}, 0x4100017EFD7F},
+    {0x100014A1911, 0x4100002E8815, {kw_masks.data() + 8075, 8}, 0x4100016EF95F},
+    {0xC0911, 0x4100002E8815, {kw_masks.data() + 8083, 4}, 0x4100002EE915},
+    {0xA4414, 0x4100002E8815, {kw_masks.data() + 8087, 7}, 0x4100003EED95},
+    {0x10001162975, 0x4100002E8815, {kw_masks.data() + 8094, 8}, 0x410001BEE975},
+    {0x1000000C892, 0x4100002E8815, {kw_masks.data() + 8102, 3}, 0x4100002EC897},
+    {0x100851, 0x4100002E8815, {kw_masks.data() + 8105, 7}, 0x4100003EEDD7},
+    {0x100001668D9, 0x4100002E8815, {kw_masks.data() + 8112, 5}, 0x4100003EF9DD},
+    {0x100001E68D9, 0x4100002E8815, {kw_masks.data() + 8117, 10}, 0x4100017EF9FD},
+    {0x480085, 0x4100002E8815, {kw_masks.data() + 8127, 3}, 0x4100006EDD95},
+    {0x10000025C05, 0x4100002E8815, {kw_masks.data() + 8130, 7}, 0x4100007EFDD5},
+    {0x4CC085, 0x4100002E8815, {kw_masks.data() + 8137, 3}, 0x4100006EDD95},
+    {0x100000A5D14, 0x4100002E8815, {kw_masks.data() + 8140, 3}, 0x4100002EDD15},
+    {0x1000008FD15, 0x4100002E8815, {kw_masks.data() + 8143, 3}, 0x4100002EFD15},
+    {0xFFFFFFFFFFFFFFFF, 0x4100002E8815, {kw_masks.data() + 8146, 6}, 0xFFFFFFFFFFFFFFFF},
+    {0x200000016A0990, 0x4100002E8815, {kw_masks.data() + 8152, 8}, 0x2041403D6EDD95},
+    {0xFFFFFFFFFFFFFFFF, 0x4100002E8815, {kw_masks.data() + 8160, 6}, 0xFFFFFFFFFFFFFFFF},
+    {0x200000010A6190, 0x4100002E8815, {kw_masks.data() + 8166, 8}, 0x2041402D2EFD95},
+    {0xFFFFFFFFFFFFFFFF, 0x4100002E8815, {kw_masks.data() + 8174, 6}, 0xFFFFFFFFFFFFFFFF},
+    {0x200000014A4180, 0x4100002E8815, {kw_masks.data() + 8180, 8}, 0x204140356EDD95},
+    {0xFFFFFFFFFFFFFFFF, 0x4100002E8815, {kw_masks.data() + 8188, 6}, 0xFFFFFFFFFFFFFFFF},
+    {0x200000010A0190, 0x4100002E8815, {kw_masks.data() + 8194, 8}, 0x204140252EDD95},
+    {0xFFFFFFFFFFFFFFFF, 0x4100002E8815, {kw_masks.data() + 8202, 6}, 0xFFFFFFFFFFFFFFFF},
+    {0x200000011A41A0, 0x4100002E8815, {kw_masks.data() + 8208, 8}, 0x204140653EDDB5},
+    {0xFFFFFFFFFFFFFFFF, 0x4100002E8815, {kw_masks.data() + 8216, 6}, 0xFFFFFFFFFFFFFFFF},
+    {0x200000012A01B0, 0x4100002E8815, {kw_masks.data() + 8222, 8}, 0x204140A52EDDB5},
+    {0xFFFFFFFFFFFFFFFF, 0x4100002E8815, {kw_masks.data() + 8230, 6}, 0xFFFFFFFFFFFFFFFF},
+    {0x200000018E0180, 0x4100002E8815, {kw_masks.data() + 8236, 8}, 0x20414125AEDD95},
+    {0xFFFFFFFFFFFFFFFF, 0x4100002E8815, {kw_masks.data() + 8244, 7}, 0xFFFFFFFFFFFFFFFF},
+    {0x200000012E2190, 0x4100002E8815, {kw_masks.data() + 8251, 8}, 0x204142252EFD95},
+    {0xFFFFFFFFFFFFFFFF, 0x4100002E8815, {kw_masks.data() + 8259, 6}, 0xFFFFFFFFFFFFFFFF},
+    {0x200000010A01D0, 0x4100002E8815, {kw_masks.data() + 8265, 8}, 0x204144252EDDD5},
+    {0xFFFFFFFFFFFFFFFF, 0x4100002E8815, {kw_masks.data() + 8273, 6}, 0xFFFFFFFFFFFFFFFF},
+    {0x200000010A2190, 0x4100002E8815, {kw_masks.data() + 8279, 8}, 0x204148252EFD95},
+    {0xFFFFFFFFFFFFFFFF, 0x4100002E8815, {kw_masks.data() + 8287, 7}, 0xFFFFFFFFFFFFFFFF},
+    {0x200000010A2190, 0x4100002E8815, {kw_masks.data() + 8294, 8}, 0x2041402D2EFD95},
+    {0xFFFFFFFFFFFFFFFF, 0x4100002E8815, {kw_masks.data() + 8302, 6}, 0xFFFFFFFFFFFFFFFF},
+    {0x200000012A2990, 0x4100002E8815, {kw_masks.data() + 8308, 8}, 0x2041402D2EFD95},
+    {0x10000407010, 0x4100002E8815, {kw_masks.data() + 8316, 6}, 0x4100016EFC9D},
+    {0x10000CE7155, 0x4100002E8815, {kw_masks.data() + 8322, 7}, 0x410001EEFDDD},
+    {0x100001F7131, 0x4100002E8815, {kw_masks.data() + 8329, 6}, 0x4100017FFDB5},
+    {0x10000D47143, 0x4100002E8815, {kw_masks.data() + 8335, 6}, 0x410001FEFDD7},
+    {0x10000107820, 0x4100002E8815, {kw_masks.data() + 8341, 5}, 0x4100017EFCB5},
+    {0x10000547143, 0x4100002E8815, {kw_masks.data() + 8346, 6}, 0x4100017EFDD7},
+    {0x100001F7811, 0x4100002E8815, {kw_masks.data() + 8352, 6}, 0x4100017FFC95},
+    {0x100004E7155, 0x4100002E8815, {kw_masks.data() + 8358, 6}, 0x4100016EFDD5},
+    {0x100000E7014, 0x4100002E8815, {kw_masks.data() + 8364, 6}, 0x4100016EFC9D},
+    {0x10000407035, 0x4100002E8815, {kw_masks.data() + 8370, 6}, 0x4100016EFCB5},
+    {0x100001F7135, 0x4100002E8815, {kw_masks.data() + 8376, 7}, 0x4100017FFDB5},
+    {0x100001F7835, 0x4100002E8815, {kw_masks.data() + 8383, 7}, 0x4100017FFCBD},
+    {0xA5090, 0x4100002E8815, {kw_masks.data() + 8390, 3}, 0x4100016EDC95},
+    {0x142000, 0x4100002E8815, {kw_masks.data() + 8393, 7}, 0x4100017EADD7},
+    {0x10000107835, 0x4100002E8815, {kw_masks.data() + 8400, 6}, 0x4100017EFDF7},
+    {0x100005C21B5, 0x4100002E8815, {kw_masks.data() + 8406, 11}, 0x4100017EADFF},
+    {0x100000AA959, 0x4100002E8815, {kw_masks.data() + 8417, 6}, 0x4100017EADDD},
+    {0xE0001, 0x4100002E8815, {kw_masks.data() + 8423, 7}, 0x4100017EFD9D},
+    {0x100004E6941, 0x4100002E8815, {kw_masks.data() + 8430, 10}, 0x4100016EEDD5},
+    {0x100000E61C1, 0x4100002E8815, {kw_masks.data() + 8440, 7}, 0x4100016EEDF5},
+    {0x10001401D01, 0x4100002E8815, {kw_masks.data() + 8447, 5}, 0x4100016E9D95},
+    {0x10480C, 0x4100002E8815, {kw_masks.data() + 8452, 3}, 0x4100017ECC9D},
+    {0x1000014699E, 0x4100002E8815, {kw_masks.data() + 8455, 6}, 0x4100017EED9F},
+    {0x100005A69CD, 0x4100002E8815, {kw_masks.data() + 8461, 7}, 0x4100017EFDDD},
+    {0x1000014799F, 0x4100002E8815, {kw_masks.data() + 8468, 6}, 0x4100017EFD9F},
+    {0x100001669DF, 0x4100002E8815, {kw_masks.data() + 8474, 6}, 0x4100017EEDDF},
+    {0x1000016699F, 0x4100002E8815, {kw_masks.data() + 8480, 6}, 0x4100017EED9F},
+    {0x100005A698D, 0x4100002E8815, {kw_masks.data() + 8486, 4}, 0x4100017EED9D},
+    {0x100005C698C, 0x4100002E8815, {kw_masks.data() + 8490, 5}, 0x4100017EED9D},
+    {0x100005869CC, 0x4100002E8815, {kw_masks.data() + 8495, 4}, 0x4100017EEDDD},
+    {0xA6009, 0x4100002E8815, {kw_masks.data() + 8499, 5}, 0x4100017EED9D},
+    {0x4060, 0x4100002E8815, {kw_masks.data() + 8504, 4}, 0x4100017ECCFD},
+    {0x1000040213D, 0x4100002E8815, {kw_masks.data() + 8508, 6}, 0x4100017EEDBF},
+    {0x1006814, 0x4100002E8815, {kw_masks.data() + 8514, 7}, 0x4100037EED9D},
+    {0x426103, 0x4100002E8815, {kw_masks.data() + 8521, 17}, 0x4100017FEDDF},
+    {0x1000016581F, 0x4100002E8815, {kw_masks.data() + 8538, 6}, 0x4100017EFDDF},
+    {0x121813, 0x4100002E8815, {kw_masks.data() + 8544, 5}, 0x4100017EFDD7},
+    {0x100005EF99B, 0x4100002E8815, {kw_masks.data() + 8549, 7}, 0x4100017EFDDF},
+    {0x1000012785B, 0x4100002E8815, {kw_masks.data() + 8556, 6}, 0x4100017EFDDF},
+    {0x100002849D1, 0x4100002E8815, {kw_masks.data() + 8562, 12}, 0x4100037EEDDF},
+    {0x446C31, 0x4100002E8815, {kw_masks.data() + 8574, 5}, 0x4100016EECBD},
+    {0x447001, 0x4100002E8815, {kw_masks.data() + 8579, 6}, 0x4100016EFC9D},
+    {0x100005C7181, 0x4100002E8815, {kw_masks.data() + 8585, 7}, 0x4100017EFD9D},
+    {0x85014, 0x4100002E8815, {kw_masks.data() + 8592, 4}, 0x4100016EDC95},
+    {0x20130, 0x4100002E8815, {kw_masks.data() + 8596, 10}, 0x4100017EFDB7},
+    {0xAC818, 0x4100002E8815, {kw_masks.data() + 8606, 11}, 0x4100017EFD9D},
+    {0x100006A0011, 0x4100002E8815, {kw_masks.data() + 8617, 9}, 0x4100017EEDF5},
+    {0x200000000A6E15, 0x2C0115, {kw_masks.data() + 8626, 7}, 0x200000007EFF97},
+    {0x100000E1195, 0x2C0115, {kw_masks.data() + 8633, 4}, 0x100002E7997},
+    {0x464530, 0x2C0115, {kw_masks.data() + 8637, 6}, 0x16E7D37},
+    {0x68C11, 0x2C0115, {kw_masks.data() + 8643, 6}, 0x6EFD37},
+    {0x20535, 0x2C0115, {kw_masks.data() + 8649, 10}, 0x1EEFDFD},
+    {0x68C11, 0x2C0115, {kw_masks.data() + 8659, 6}, 0x40000002EBD55},
+    {0x6803, 0x2C0115, {kw_masks.data() + 8665, 5}, 0x12E699F},
+    {0x100010AC011, 0x2C0115, {kw_masks.data() + 8670, 11}, 0x10001EEF99F},
+    {0x10000086937, 0x2C0115, {kw_masks.data() + 8681, 7}, 0x100016EE9B7},
+    {0x100000A2013, 0x2C0115, {kw_masks.data() + 8688, 6}, 0x100002EEB17},
+    {0x100000AE11D, 0x2C0115, {kw_masks.data() + 8694, 7}, 0x100002EFB1F},
+    {0x1000004EA19, 0x2C0115, {kw_masks.data() + 8701, 6}, 0x100002EEB3F},
+    {0x100000E9015, 0x2C0115, {kw_masks.data() + 8707, 4}, 0x100002EF917},
+    {0x1000040319C, 0x2C0115, {kw_masks.data() + 8711, 5}, 0x100006E799F},
+    {0x10001627154, 0x2C0115, {kw_masks.data() + 8716, 5}, 0x100016E7957},
+    {0x1000022E818, 0x2C0115, {kw_masks.data() + 8721, 10}, 0xFFFFFFFFFFFFFFFF},
+    {0x26102, 0x2C0115, {kw_masks.data() + 8731, 3}, 0x2E6917},
+    {0x100004A8179, 0x2C0115, {kw_masks.data() + 8734, 10}, 0x10001FEF9FF},
+    {0x1000002711A, 0x2C0115, {kw_masks.data() + 8744, 4}, 0x100002E791F},
+    {0x100000C751D, 0x2C0115, {kw_masks.data() + 8748, 4}, 0x100002C751D},
+    {0x80514, 0x2C0115, {kw_masks.data() + 8752, 4}, 0x3C751F},
+    {0x100010A1919, 0x2C0115, {kw_masks.data() + 8756, 4}, 0x100016E791F},
+    {0x10AC080, 0x2C0115, {kw_masks.data() + 8760, 11}, 0x36EF9DD},
+    {0x100000ED819, 0x2C0115, {kw_masks.data() + 8771, 5}, 0x100006EF95D},
+    {0x100080C981D, 0x2C0115, {kw_masks.data() + 8776, 6}, 0x100086ED97D},
+    {0x1001000B81D, 0x2C0115, {kw_masks.data() + 8782, 6}, 0x100106EF91D},
+    {0x1002002981D, 0x2C0115, {kw_masks.data() + 8788, 6}, 0x100226EF99F},
+    {0x10000064817, 0x2C0115, {kw_masks.data() + 8794, 5}, 0x100003EC937},
+    {0x40813, 0x2C0115, {kw_masks.data() + 8799, 3}, 0x2EC917},
+    {0xC4823, 0x2C0115, {kw_masks.data() + 8802, 6}, 0x3EF97F},
+    {0xC0C13, 0x2C0115, {kw_masks.data() + 8808, 4}, 0x2ECD97},
+    {0x1204813, 0x2C0115, {kw_masks.data() + 8812, 4}, 0x12ED957},
+    {0x100000A7937, 0x2C0115, {kw_masks.data() + 8816, 6}, 0x100007EF937},
+    {0x100011A4863, 0x2C0115, {kw_masks.data() + 8822, 4}, 0x100013EC977},
+    {0xC2110, 0x2C0115, {kw_masks.data() + 8826, 4}, 0x3FE917},
+    {0x1000104296C, 0x2C0115, {kw_masks.data() + 8830, 4}, 0x100013EF97D},
+    {0x406942, 0x2C0115, {kw_masks.data() + 8834, 5}, 0x6EFD57},
+    {0x100000A1555, 0x2C0115, {kw_masks.data() + 8839, 5}, 0x100002EDD57},
+    {0x10001004DBC, 0x2C0115, {kw_masks.data() + 8844, 6}, 0x100012EDDFF},
+    {0x10001004594, 0x2C0115, {kw_masks.data() + 8850, 6}, 0x100013ED5D5},
+    {0x64815, 0x2C0115, {kw_masks.data() + 8856, 6}, 0x2ECD57},
+    {0x1000000E140, 0x2C0115, {kw_masks.data() + 8862, 10}, 0x100002EF95F},
+    {0x8710B, 0x2C0115, {kw_masks.data() + 8872, 6}, 0x3FFDDF},
+    {0x10000A06952, 0x2C0115, {kw_masks.data() + 8878, 3}, 0x10000AEE957},
+    {0x100001E7921, 0x2C0115, {kw_masks.data() + 8881, 7}, 0x100007EFF3D},
+    {0x10000086851, 0x2C0115, {kw_masks.data() + 8888, 3}, 0x100002EE955},
+    {0x100000069F1, 0x2C0115, {kw_masks.data() + 8891, 4}, 0x100002EE9F5},
+    {0x100000C0515, 0x2C0115, {kw_masks.data() + 8895, 4}, 0x100002EE555},
+    {0x1000004E9F0, 0x2C0115, {kw_masks.data() + 8899, 5}, 0x100002EF9F5},
+    {0x10000243549, 0x2C0115, {kw_masks.data() + 8904, 5}, 0x100003EFD5F},
+    {0x100001E21C0, 0x2C0115, {kw_masks.data() + 8909, 5}, 0x100003EE9D5},
+    {0x40500, 0x2C0115, {kw_masks.data() + 8914, 4}, 0x6EE515},
+    {0x40818, 0x2C0115, {kw_masks.data() + 8918, 7}, 0x7EE9DF},
+    {0x100001E6954, 0x2C0115, {kw_masks.data() + 8925, 5}, 0x100003EFD55},
+    {0x1140812, 0x2C0115, {kw_masks.data() + 8930, 8}, 0x13E39DF},
+    {0x20000001004000, 0x2C0115, {kw_masks.data() + 8938, 5}, 0x200000013C5975},
+    {0x80510, 0x2C0115, {kw_masks.data() + 8943, 4}, 0x12E5D75},
+    {0x100004EC911, 0x2C0115, {kw_masks.data() + 8947, 8}, 0x100007EF9DD},
+    {0x1040000C803, 0x2C0115, {kw_masks.data() + 8955, 7}, 0x104002ED9DF},
+    {0x100010E0807, 0x2C0115, {kw_masks.data() + 8962, 11}, 0x100013E7977},
+    {0x1000040314D, 0x2C0115, {kw_masks.data() + 8973, 6}, 0x100026E31DD},
+    {0x10000205159, 0x2C0115, {kw_masks.data() + 8979, 4}, 0x100002E795D},
+    {0x10C4704, 0x2C0115, {kw_masks.data() + 8983, 4}, 0x12C575D},
+    {0x100000C7995, 0x2C0115, {kw_masks.data() + 8987, 7}, 0x100002C79D7},
+    {0x10000001159, 0x2C0115, {kw_masks.data() + 8994, 4}, 0x100002E315D},
+    {0x10002108914, 0x2C0115, {kw_masks.data() + 8998, 6}, 0x100027EFF55},
+    {0x100010A001B, 0x2C0115, {kw_masks.data() + 9004, 7}, 0x100013EF9FF},
+    {0xFFFFFFFFFFFFFFFF, 0x2C0115, {kw_masks.data() + 9011, 12}, 0xFFFFFFFFFFFFFFFF},
+    {0x10000025903, 0x2C0115, {kw_masks.data() + 9023, 7}, 0x100012EF95F},
+    {0x100000C6958, 0x2C0115, {kw_masks.data() + 9030, 9}, 0x100013E7DDF},
+    {0x100001C8119, 0x2C0115, {kw_masks.data() + 9039, 4}, 0x100003E915D},
+    {0x100001E0191, 0x2C0115, {kw_masks.data() + 9043, 6}, 0x100003E71DD},
+    {0x100001C7109, 0x2C0115, {kw_masks.data() + 9049, 4}, 0x100003E715D},
+    {0x100001C0906, 0x2C0115, {kw_masks.data() + 9053, 5}, 0x100003E195F},
+    {0x1000044A095, 0x2C0115, {kw_masks.data() + 9058, 5}, 0x10000FCB9DF},
+    {0x24610, 0x2C0115, {kw_masks.data() + 9063, 4}, 0x6E5F5D},
+    {0x100000272D9, 0x2C0115, {kw_masks.data() + 9067, 4}, 0x100002E73DD},
+    {0x1000146E97D, 0x2C0115, {kw_masks.data() + 9071, 6}, 0x100016EFB7D},
+    {0x100000EF171, 0x2C0115, {kw_masks.data() + 9077, 11}, 0x100002EF5F5},
+    {0x100001A913D, 0x2C0115, {kw_masks.data() + 9088, 8}, 0x100003EB17D},
+    {0x100000E8911, 0x2C0115, {kw_masks.data() + 9096, 13}, 0x100013EF975},
+    {0xA0099, 0x2C0115, {kw_masks.data() + 9109, 7}, 0x6EE9FD},
+    {0x10000442958, 0x2C0115, {kw_masks.data() + 9116, 10}, 0x100017E79FF},
+    {0x1022001, 0x2C0115, {kw_masks.data() + 9126, 6}, 0x12E6DB7},
+    {0x86400, 0x2C0115, {kw_masks.data() + 9132, 9}, 0x6EED7D},
+    {0x40851, 0xC4216, {kw_masks.data() + 9141, 5}, 0x14E6BD7},
+    {0x142851, 0xC4216, {kw_masks.data() + 9146, 6}, 0x15E6FDF},
+    {0x44850, 0xC4216, {kw_masks.data() + 9152, 8}, 0x17EFBDF},
+    {0x10000084807, 0xC4216, {kw_masks.data() + 9160, 10}, 0x10000CEFFDF},
+    {0x100012C0031, 0xC4216, {kw_masks.data() + 9170, 4}, 0x100012E7BF7},
+    {0x82514, 0xC4216, {kw_masks.data() + 9174, 6}, 0x11EFFDE},
+    {0x200000000E0180, 0xC4216, {kw_masks.data() + 9180, 11}, 0x200000005EEFDF},
+    {0x42211, 0xC4216, {kw_masks.data() + 9191, 11}, 0x5EFFDF},
+    {0x60025, 0xC4216, {kw_masks.data() + 9202, 6}, 0x1EEFFF},
+    {0x244850, 0xC4216, {kw_masks.data() + 9208, 3}, 0x2C6BDF},
+    {0x84005, 0xC4216, {kw_masks.data() + 9211, 7}, 0x1EEFDF},
+    {0x44404, 0xC4216, {kw_masks.data() + 9218, 3}, 0xC6FD6},
+    {0x60018, 0xC4216, {kw_masks.data() + 9221, 6}, 0x10EEBFF},
+    {0x7500, 0xC4216, {kw_masks.data() + 9227, 3}, 0xE7FF7},
+    {0x60101, 0xC4216, {kw_masks.data() + 9230, 3}, 0xE6BDF},
+    {0x200100005CF114, 0xC4216, {kw_masks.data() + 9233, 7}, 0x200100005CFBD7},
+    {0x60132, 0xC4216, {kw_masks.data() + 9240, 7}, 0x200000005EFBFF},
+    {0xE4080, 0xC4216, {kw_masks.data() + 9247, 7}, 0x5EFBDF},
+    {0x2502, 0xC4216, {kw_masks.data() + 9254, 7}, 0x5CFFD7},
+    {0xFFFFFFFFFFFFFFFF, 0xC4216, {kw_masks.data() + 9261, 11}, 0xFFFFFFFFFFFFFFFF},
+    {0x100000069E9, 0xC4216, {kw_masks.data() + 9272, 13}, 0x100011EEFFF},
+    {0x168010, 0xC4216, {kw_masks.data() + 9285, 8}, 0x11EEBFF},
+    {0x20CB, 0xC4216, {kw_masks.data() + 9293, 8}, 0x11EEBDF},
+    {0x100001808C7, 0xC4216, {kw_masks.data() + 9301, 8}, 0x100001EEBDF},
+    {0x1000004E1C3, 0xC4216, {kw_masks.data() + 9309, 5}, 0x100000CEBD7},
+    {0x8407, 0xC4216, {kw_masks.data() + 9314, 9}, 0x1EEFDF},
+    {0x100000C68C9, 0xC4216, {kw_masks.data() + 9323, 10}, 0xFFFFFFFFFFFFFFFF},
+    {0xFFFFFFFFFFFFFFFF, 0xC4216, {kw_masks.data() + 9333, 11}, 0xFFFFFFFFFFFFFFFF},
+    {0x100001661D0, 0xC4216, {kw_masks.data() + 9344, 11}, 0x100001EEFF7},
+    {0x100000865C2, 0xC4216, {kw_masks.data() + 9355, 8}, 0x100005EFFDF},
+    {0x100000C48B1, 0xC4216, {kw_masks.data() + 9363, 8}, 0x200100010EFBF7},
+    {0x200100000449D8, 0xC4216, {kw_masks.data() + 9371, 14}, 0x200100004EFBFF},
+    {0xFFFFFFFFFFFFFFFF, 0xC4216, {kw_masks.data() + 9385, 5}, 0xFFFFFFFFFFFFFFFF},
+    {0x100000C4893, 0xC4216, {kw_masks.data() + 9390, 4}, 0x100000C6BDF},
+    {0xFFFFFFFFFFFFFFFF, 0xC4216, {kw_masks.data() + 9394, 9}, 0xFFFFFFFFFFFFFFFF},
+    {0x10000028585, 0xC4216, {kw_masks.data() + 9403, 6}, 0x100000EFFF7},
+    {0x426004, 0xC4216, {kw_masks.data() + 9409, 9}, 0x17F7FFF},
+    {0xFFFFFFFFFFFFFFFF, 0xC4216, {kw_masks.data() + 9418, 8}, 0xFFFFFFFFFFFFFFFF},
+    {0x1000008C081, 0xC4216, {kw_masks.data() + 9426, 8}, 0x100010EFBF7},
+    {0x100001AE14D, 0xC4216, {kw_masks.data() + 9434, 7}, 0x100001EEBDF},
+    {0x1000000891F, 0xC4216, {kw_masks.data() + 9441, 7}, 0x100000CEBDF},
+    {0x100010A1991, 0xC4216, {kw_masks.data() + 9448, 7}, 0x100014E7BDF},
+    {0xFFFFFFFFFFFFFFFF, 0xC4216, {kw_masks.data() + 9455, 9}, 0xFFFFFFFFFFFFFFFF},
+    {0x1000106801B, 0xC4216, {kw_masks.data() + 9464, 5}, 0x100010EEFDF},
+    {0xC8D04, 0xC4216, {kw_masks.data() + 9469, 5}, 0x1CFFDF},
+    {0x22140, 0xC4216, {kw_masks.data() + 9474, 10}, 0x14EFFDF},
+    {0x100000C7050, 0xC4216, {kw_masks.data() + 9484, 9}, 0x100014E7BDF},
+    {0x100001E9419, 0xC4216, {kw_masks.data() + 9493, 6}, 0x100001FFF1F},
+    {0x1000076DC11, 0xC4216, {kw_masks.data() + 9499, 5}, 0x100007EFE3F},
+    {0x1000036DD19, 0xC4216, {kw_masks.data() + 9504, 4}, 0x100003EFF1F},
+    {0x1000036DDD1, 0xC4216, {kw_masks.data() + 9508, 6}, 0x100003EFFDF},
+    {0x16CC19, 0xC4216, {kw_masks.data() + 9514, 6}, 0x1EFF1F},
+    {0xF0D1, 0xC4216, {kw_masks.data() + 9520, 3}, 0x1EF3DF},
+    {0x100000EE881, 0xC4216, {kw_masks.data() + 9523, 4}, 0x100001EEA9F},
+    {0x812, 0xC4216, {kw_masks.data() + 9527, 4}, 0x1E6E9F},
+    {0x100004C0993, 0xC4216, {kw_masks.data() + 9531, 10}, 0x100005FFBBF},
+    {0x10000165915, 0xC4216, {kw_masks.data() + 9541, 4}, 0x100001E7B17},
+    {0x100001C7915, 0xC4216, {kw_masks.data() + 9545, 4}, 0x100001C7B1F},
+    {0x100001C7915, 0xC4216, {kw_masks.data() + 9549, 5}, 0x100001C7B1F},
+    {0x100001EF19C, 0xC4216, {kw_masks.data() + 9554, 4}, 0x100001EF39E},
+    {0x10000260918, 0xC4216, {kw_masks.data() + 9558, 3}, 0x100003E5B1E},
+    {0x100000E6C06, 0xC4216, {kw_masks.data() + 9561, 3}, 0x100001E7F16},
+    {0x2F194, 0xC4216, {kw_masks.data() + 9564, 6}, 0x1EF7DF},
+    {0xE099, 0xC4216, {kw_masks.data() + 9570, 4}, 0x1EF39F},
+    {0x24109, 0xC4216, {kw_masks.data() + 9574, 5}, 0x3E731F},
+    {0x84E091, 0xC4216, {kw_masks.data() + 9579, 5}, 0x9EFB97},
+    {0x1A9010, 0xC4216, {kw_masks.data() + 9584, 4}, 0x1EFB17},
+    {0xA7012, 0xC4216, {kw_masks.data() + 9588, 8}, 0x21E7B1F},
+    {0x2610D, 0xC4216, {kw_masks.data() + 9596, 8}, 0x29F7B1F},
+    {0x1A0141, 0xC4216, {kw_masks.data() + 9604, 5}, 0x1E7B57},
+    {0x10001165D1F, 0xC4216, {kw_masks.data() + 9609, 5}, 0x100011EFF1F},
+    {0x206900, 0xC4216, {kw_masks.data() + 9614, 4}, 0x3E7B17},
+    {0x6203, 0xC4216, {kw_masks.data() + 9618, 5}, 0x1E7B5F},
+    {0x121008, 0xC4216, {kw_masks.data() + 9623, 5}, 0x1E7F1F},
+    {0x10000127848, 0xC4216, {kw_masks.data() + 9628, 7}, 0x100011E7BDF},
+    {0x61005, 0xC4216, {kw_masks.data() + 9635, 11}, 0x11EFF9F},
+    {0x180830, 0xC4216, {kw_masks.data() + 9646, 13}, 0x5EFBFF},
+    {0x28081, 0xC4216, {kw_masks.data() + 9659, 7}, 0x3EFB9F},
+    {0x1000000F992, 0xC4216, {kw_masks.data() + 9666, 5}, 0x100001CFB97},
+    {0x100004AF993, 0xC4216, {kw_masks.data() + 9671, 9}, 0x100007EFB9F},
+    {0x8E890, 0xC4216, {kw_masks.data() + 9680, 2}, 0xCEA96},
+    {0x100002AE994, 0xC4216, {kw_masks.data() + 9682, 5}, 0x100003EFB97},
+    {0x28051, 0xC4216, {kw_masks.data() + 9687, 3}, 0x1EF3D7},
+    {0x100008031B5, 0xC4216, {kw_masks.data() + 9690, 4}, 0x100009CF3B7},
+    {0x10A0013, 0xC4216, {kw_masks.data() + 9694, 2}, 0x11ED217},
+    {0x100014A4813, 0xC4216, {kw_masks.data() + 9696, 7}, 0x100015EFB5F},
+    {0x100001A8954, 0xC4216, {kw_masks.data() + 9703, 4}, 0x100011EDB56},
+    {0x8C801, 0xC4216, {kw_masks.data() + 9707, 5}, 0x1EFB37},
+    {0x100001ED41C, 0xC4216, {kw_masks.data() + 9712, 3}, 0x100001EF71E},
+    {0xAA110, 0xC4216, {kw_masks.data() + 9715, 2}, 0x1EF316},
+    {0x102441B, 0xC4216, {kw_masks.data() + 9717, 2}, 0x11ED61F},
+    {0x100001ED014, 0xC4216, {kw_masks.data() + 9719, 2}, 0x100001ED216},
+    {0xA0C07, 0xC4216, {kw_masks.data() + 9721, 2}, 0x1EDE17},
+    {0x100001ED51C, 0xC4216, {kw_masks.data() + 9723, 4}, 0x100001EFF1F},
+    {0x1000104CD28, 0xC4216, {kw_masks.data() + 9727, 3}, 0x100011EDF3E},
+    {0x100000CCD0D, 0xC4216, {kw_masks.data() + 9730, 6}, 0x200100013EDF1F},
+    {0x200008, 0xC4216, {kw_masks.data() + 9736, 6}, 0x200000013EDF1F},
+    {0x140007, 0xC4216, {kw_masks.data() + 9742, 4}, 0x1EFB17},
+    {0x10000225115, 0xC4216, {kw_masks.data() + 9746, 9}, 0x100016E7BFF},
+    {0x10000061931, 0xC4216, {kw_masks.data() + 9755, 6}, 0x100002E7BFF},
+    {0x100000ADB34, 0xC4216, {kw_masks.data() + 9761, 6}, 0x100002EFBFF},
+    {0x1000002C81F, 0xC4216, {kw_masks.data() + 9767, 6}, 0x100002EFBDF},
+    {0x2C6910, 0xC4216, {kw_masks.data() + 9773, 4}, 0x2C6BDE},
+    {0x21015, 0xC4216, {kw_masks.data() + 9777, 8}, 0x2EFBFF},
+    {0x100004E19B5, 0xC4216, {kw_masks.data() + 9785, 4}, 0x100006E5BFF},
+    {0x1000022511D, 0xC4216, {kw_masks.data() + 9789, 5}, 0x100002E5BDF},
+    {0x2C411D, 0xC4216, {kw_masks.data() + 9794, 8}, 0x2ECBDF},
+    {0x100010C3979, 0xC4216, {kw_masks.data() + 9802, 11}, 0x200100012EFBFF},
+    {0x100010E39F9, 0xC4216, {kw_masks.data() + 9813, 12}, 0x200100012EFBFF},
+    {0x281D, 0xC4216, {kw_masks.data() + 9825, 3}, 0x2C6BDF},
+    {0x100001809C2, 0xC4216, {kw_masks.data() + 9828, 6}, 0x100003E5BDF},
+    {0xC09E1, 0xC4216, {kw_masks.data() + 9834, 6}, 0x2E4BFF},
+    {0x100000AA819, 0xC4216, {kw_masks.data() + 9840, 7}, 0x100003EEBDF},
+    {0x10001009909, 0xC4216, {kw_masks.data() + 9847, 5}, 0x100012CDBDF},
+    {0x100006A659F, 0xC4216, {kw_masks.data() + 9852, 9}, 0x100007EEFDF},
+    {0x10000044C1E, 0xC4216, {kw_masks.data() + 9861, 4}, 0x100001EEF1F},
+    {0x1000000E412, 0xC4216, {kw_masks.data() + 9865, 9}, 0x100017EEF7F},
+    {0x10000026452, 0xC4216, {kw_masks.data() + 9874, 7}, 0x100011EEF7F},
+    {0x10000104C12, 0xC4216, {kw_masks.data() + 9881, 7}, 0x100011EEF7F},
+    {0x10000026453, 0xC4216, {kw_masks.data() + 9888, 7}, 0x100011EEF7F},
+    {0x44402, 0xC4216, {kw_masks.data() + 9895, 11}, 0x17EEFFF},
+    {0x86412, 0xC4216, {kw_masks.data() + 9906, 3}, 0xEE617},
+    {0x20858, 0xC4216, {kw_masks.data() + 9909, 4}, 0xEEE5F},
+    {0x100005A89D5, 0xC4216, {kw_masks.data() + 9913, 5}, 0x100005EFFDF},
+    {0x64804, 0xC4216, {kw_masks.data() + 9918, 3}, 0xECE17},
+    {0x1000010A175, 0xC4216, {kw_masks.data() + 9921, 6}, 0x100001EF77F},
+    {0x46A011, 0xC4216, {kw_masks.data() + 9927, 5}, 0x5EF717},
+    {0x2001000056E819, 0xC4216, {kw_masks.data() + 9932, 7}, 0x200100005EEE1F},
+    {0x100000E5403, 0xC4216, {kw_masks.data() + 9939, 6}, 0x100000ED617},
+    {0x25403, 0xC4216, {kw_masks.data() + 9945, 4}, 0xED617},
+    {0x813, 0xC4216, {kw_masks.data() + 9949, 4}, 0xECE57},
+    {0x6104, 0xC4216, {kw_masks.data() + 9953, 9}, 0x13E7BDF},
+    {0x10001007053, 0xC4216, {kw_masks.data() + 9962, 16}, 0x100014EFFDF},
+    {0x100001E0095, 0xC4216, {kw_masks.data() + 9978, 11}, 0x100037EFBDF},
+    {0x10001086413, 0xC4216, {kw_masks.data() + 9989, 7}, 0x100011E7F17},
+    {0x100000A6C1B, 0xC4216, {kw_masks.data() + 9996, 7}, 0x100011E7F1F},
+    {0x100001A6413, 0xC4216, {kw_masks.data() + 10003, 9}, 0x1000D1E7F97},
+    {0x1000018E41B, 0xC4216, {kw_masks.data() + 10012, 10}, 0x100011EFF9F},
+    {0x100014C71D0, 0xC4216, {kw_masks.data() + 10022, 12}, 0x100014EFFFF},
+    {0x100000A011D, 0xC4216, {kw_masks.data() + 10034, 7}, 0x100010EF7DF},
+    {0xA8114, 0xC4216, {kw_masks.data() + 10041, 7}, 0x13EF77F},
+    {0x100014E21D5, 0xC4216, {kw_masks.data() + 10048, 12}, 0x100015EF7DF},
+    {0x20E810, 0xC4216, {kw_masks.data() + 10060, 5}, 0x200000002EFB17},
+    {0x20000000001911, 0xC4216, {kw_masks.data() + 10065, 4}, 0x200000000E5B17},
+    {0x1000020F954, 0xC4216, {kw_masks.data() + 10069, 9}, 0x200100002EFB5F},
+    {0x100006AE991, 0xC4216, {kw_masks.data() + 10078, 11}, 0x200100007EFBDF},
+    {0x100019A4003, 0xC4216, {kw_masks.data() + 10089, 7}, 0x100019E7B17},
+    {0x100018A6103, 0xC4216, {kw_masks.data() + 10096, 8}, 0x10003AE7B17},
+    {0x8455, 0xC4216, {kw_masks.data() + 10104, 7}, 0x1BEFFDF},
+    {0x10000CE59FF, 0xC4216, {kw_masks.data() + 10111, 7}, 0x10000DEFBFF},
+    {0x10000CE59FF, 0xC4216, {kw_masks.data() + 10118, 6}, 0x10000CEDBFF},
+    {0x10000CEF9FB, 0xC4216, {kw_masks.data() + 10124, 6}, 0x10000CEFBFF},
+    {0x10000CAF9FB, 0xC4216, {kw_masks.data() + 10130, 6}, 0x10000CEFBFF},
+    {0x8CC002, 0xC4216, {kw_masks.data() + 10136, 3}, 0x8CDB17},
+    {0x10000C84983, 0xC4216, {kw_masks.data() + 10139, 3}, 0x10000CC5B97},
+    {0xA914, 0xC4216, {kw_masks.data() + 10142, 2}, 0x4EEB56},
+    {0x10000002D07, 0xC4216, {kw_masks.data() + 10144, 4}, 0x100004EEF57},
+    {0x1000018E131, 0xC4216, {kw_masks.data() + 10148, 3}, 0x100005EE377},
+    {0xA010, 0xC4216, {kw_masks.data() + 10151, 3}, 0x4EEB57},
+    {0x1EA183, 0xC4216, {kw_masks.data() + 10154, 3}, 0x5EE3D7},
+    {0x1026005, 0xC4216, {kw_masks.data() + 10157, 2}, 0x14E6357},
+    {0x5010, 0xC4216, {kw_masks.data() + 10159, 6}, 0x5EFB5F},
+    {0x60137, 0xC4216, {kw_masks.data() + 10165, 2}, 0xE4337},
+    {0x10000024938, 0xC4216, {kw_masks.data() + 10167, 3}, 0x100000E4B3E},
+    {0x1000002E938, 0xC4216, {kw_masks.data() + 10170, 4}, 0x100000EEB3E},
+    {0x10000A6211D, 0xC4216, {kw_masks.data() + 10174, 4}, 0x10000AE633F},
+    {0x2281D, 0xC4216, {kw_masks.data() + 10178, 3}, 0xE6B3F},
+    {0x200100000A683D, 0xC4216, {kw_masks.data() + 10181, 5}, 0x200100000E6B3F},
+    {0x100000EE919, 0xC4216, {kw_masks.data() + 10186, 5}, 0x100000EEB3F},
+    {0x1000006A91D, 0xC4216, {kw_masks.data() + 10191, 4}, 0x100000EEB3F},
+    {0x1000082211D, 0xC4216, {kw_masks.data() + 10195, 6}, 0x100008E6BBF},
+    {0x100000E21D5, 0xC4216, {kw_masks.data() + 10201, 10}, 0x100005EE3FF},
+    {0x100000E21DD, 0xC4216, {kw_masks.data() + 10211, 9}, 0x100006EE3FF},
+    {0x100000A0087, 0xC4216, {kw_masks.data() + 10220, 5}, 0x100000EC3FF},
+    {0x2C90F, 0xC4216, {kw_masks.data() + 10225, 5}, 0xEEB3F},
+    {0x14A180, 0xC4216, {kw_masks.data() + 10230, 4}, 0x1CEBF7},
+    {0x1000016E188, 0xC4216, {kw_masks.data() + 10234, 6}, 0x100001EFBBF},
+    {0x28915, 0xC4216, {kw_masks.data() + 10240, 2}, 0xECB37},
+    {0x1000006AD1D, 0xC4216, {kw_masks.data() + 10242, 5}, 0x100000EEF3F},
+    {0x100001E09D1, 0xC4216, {kw_masks.data() + 10247, 7}, 0x100001E7BFF},
+    {0x100001A2951, 0xC4216, {kw_masks.data() + 10254, 9}, 0x100001E7BFF},
+    {0x64104, 0xC4216, {kw_masks.data() + 10263, 6}, 0x1EEB77},
+    {0x1000082493F, 0xC4216, {kw_masks.data() + 10269, 4}, 0x100008E4B3F},
+    {0x10000082937, 0xC4216, {kw_masks.data() + 10273, 5}, 0x100000EEB77},
+    {0x4C0413, 0xC4216, {kw_masks.data() + 10278, 6}, 0x4E67F7},
+    {0x4C1C, 0xC4216, {kw_masks.data() + 10284, 4}, 0x2ECF1F},
+    {0x106C1C, 0xC4216, {kw_masks.data() + 10288, 5}, 0x1EEE1F},
+    {0x1000048ED9C, 0xC4216, {kw_masks.data() + 10293, 6}, 0x100016EEF9F},
+    {0x10001484D9C, 0xC4216, {kw_masks.data() + 10299, 6}, 0x100015E4F9E},
+    {0x1000410, 0xC4216, {kw_masks.data() + 10305, 6}, 0x15EFE1F},
+    {0x10001004C18, 0xC4216, {kw_masks.data() + 10311, 4}, 0x100011C4E1E},
+    {0x21091, 0xC4216, {kw_masks.data() + 10315, 5}, 0x2EFB97},
+    {0x800011, 0xC4216, {kw_masks.data() + 10320, 7}, 0xCCCB9F},
+    {0x8504, 0xC4216, {kw_masks.data() + 10327, 4}, 0xEFFD7},
+    {0x1000002B59D, 0xC4216, {kw_masks.data() + 10331, 3}, 0x100000EFF9F},
+    {0x1000042309D, 0xC4216, {kw_masks.data() + 10334, 4}, 0x100004EFA9F},
+    {0x20059, 0xC4216, {kw_masks.data() + 10338, 4}, 0x4EEF7F},
+    {0x1000046401C, 0xC4216, {kw_masks.data() + 10342, 4}, 0x100004EEA1F},
+    {0x5002, 0xC4216, {kw_masks.data() + 10346, 7}, 0x9EFBDF},
+    {0x27053, 0xC4216, {kw_masks.data() + 10353, 5}, 0x5EFB5F},
+    {0x1000042600B, 0xC4216, {kw_masks.data() + 10358, 8}, 0x100035EEBDF},
+    {0x40998, 0xC4216, {kw_masks.data() + 10366, 3}, 0x4CEB9F},
+    {0x100014EA015, 0xC4216, {kw_masks.data() + 10369, 7}, 0x100015EFB17},
+    {0x422094, 0xC4216, {kw_masks.data() + 10376, 5}, 0x6EFB97},
+    {0x66011C, 0xC4216, {kw_masks.data() + 10381, 5}, 0x16E6BBF},
+    {0x1000018680B, 0xC4216, {kw_masks.data() + 10386, 5}, 0x100003EFB9F},
+    {0x20051, 0xC4216, {kw_masks.data() + 10391, 4}, 0x4E4AD7},
+    {0x9805, 0xC4216, {kw_masks.data() + 10395, 4}, 0x2EDB17},
+    {0x10000042817, 0xC4216, {kw_masks.data() + 10399, 8}, 0x100025E6BDF},
+    {0x10000482195, 0xC4216, {kw_masks.data() + 10407, 6}, 0x100014EEBDF},
+    {0x2D00, 0xC4216, {kw_masks.data() + 10413, 3}, 0xC6F16},
+    {0x10000026597, 0xC4216, {kw_masks.data() + 10416, 7}, 0x100001E7FFF},
+    {0x42185, 0xC4216, {kw_masks.data() + 10423, 3}, 0xC6B97},
+    {0x4480, 0xC4216, {kw_masks.data() + 10426, 8}, 0x3EEFD7},
+    {0x884802, 0xC4216, {kw_masks.data() + 10434, 6}, 0x8E7B9F},
+    {0x83051, 0xC4216, {kw_masks.data() + 10440, 9}, 0x3EFBD7},
+    {0x20819, 0xC4216, {kw_masks.data() + 10449, 5}, 0x1EFB5F},
+    {0x244890, 0xC4216, {kw_masks.data() + 10454, 10}, 0x17EEBDF},
+    {0x1917, 0xC4216, {kw_masks.data() + 10464, 4}, 0x10E7B97},
+    {0x100001C0012, 0xC4216, {kw_masks.data() + 10468, 7}, 0x100019EFB97},
+    {0x100000E8198, 0xC4216, {kw_masks.data() + 10475, 8}, 0x100011EEBDF},
+    {0x2009, 0xC4216, {kw_masks.data() + 10483, 7}, 0x3C6B7F},
+    {0x6D114, 0xC4216, {kw_masks.data() + 10490, 5}, 0x8EFB17},
+    {0xCC814, 0xC4216, {kw_masks.data() + 10495, 5}, 0x8EEB17},
+    {0x100000C2911, 0xC4216, {kw_masks.data() + 10500, 6}, 0x100000C6B9F},
+    {0x1062150, 0xC4216, {kw_masks.data() + 10506, 10}, 0x13E7FFF},
+    {0x1000002C82A, 0xC4216, {kw_masks.data() + 10516, 8}, 0x100011EFB3F},
+    {0x8900, 0xC4216, {kw_masks.data() + 10524, 9}, 0x3EFF5F},
+    {0x100002421DB, 0xC4216, {kw_masks.data() + 10533, 3}, 0x100002C7BDF},
+    {0x1A0084, 0xC4216, {kw_masks.data() + 10536, 10}, 0x11EFF9F},
+    {0xCC094, 0xC4216, {kw_masks.data() + 10546, 5}, 0xEFB9F},
+    {0x20000001820001, 0xC4216, {kw_masks.data() + 10551, 8}, 0x200000019E7F1F},
+    {0x24008, 0xC4216, {kw_masks.data() + 10559, 5}, 0x1E6EBF},
+    {0x2A4811, 0xC4216, {kw_masks.data() + 10564, 5}, 0x13E4BBF},
+    {0x25100, 0xC4216, {kw_masks.data() + 10569, 6}, 0x1EFFBF},
+    {0x406108, 0xC4216, {kw_masks.data() + 10575, 8}, 0x7EFBFF},
+    {0x1A, 0xC4216, {kw_masks.data() + 10583, 4}, 0x1CCA9E},
+    {0x1000010F88D, 0xC4216, {kw_masks.data() + 10587, 4}, 0x100001CFA9F},
+    {0x20185, 0xC4216, {kw_masks.data() + 10591, 4}, 0x1E4B9F},
+    {0x84910, 0xC4216, {kw_masks.data() + 10595, 3}, 0x1E5B9F},
+    {0x12A850, 0xC4216, {kw_masks.data() + 10598, 8}, 0x1EFBFE},
+    {0x464090, 0xC4216, {kw_masks.data() + 10606, 3}, 0x5E4A9F},
+    {0x180083, 0xC4216, {kw_masks.data() + 10609, 3}, 0x1C4A9F},
+    {0x100001ED011, 0xC4216, {kw_masks.data() + 10612, 8}, 0x100001EFB9F},
+    {0x2024001, 0xC4216, {kw_masks.data() + 10620, 4}, 0x23ECA9F},
+    {0x10000086912, 0xC4216, {kw_masks.data() + 10624, 6}, 0x100021EFB9F},
+    {0x100010CA131, 0xC4216, {kw_masks.data() + 10630, 6}, 0x100011EEFBF},
+    {0x25002, 0xC4216, {kw_masks.data() + 10636, 5}, 0x5EFBDF},
+    {0xC0413, 0xC4216, {kw_masks.data() + 10641, 5}, 0x11EFFFF},
+    {0x1000002C831, 0xC4216, {kw_masks.data() + 10646, 5}, 0x100005ECBBF},
+    {0x180416, 0xC4216, {kw_masks.data() + 10651, 5}, 0x3CCF9F},
+    {0x4C001, 0xC4216, {kw_masks.data() + 10656, 8}, 0x1EEBDF},
+    {0x140812, 0xC4216, {kw_masks.data() + 10664, 9}, 0x5EEBFF},
+    {0x1E4082, 0xC4216, {kw_masks.data() + 10673, 9}, 0x11E7BDF},
+    {0x4E050, 0xC4216, {kw_masks.data() + 10682, 6}, 0x1EEFDF},
+    {0x100009E21F0, 0xC4216, {kw_masks.data() + 10688, 5}, 0x100009F6BFE},
+    {0x100000EE1C5, 0xC4216, {kw_masks.data() + 10693, 4}, 0x100011EEBDF},
+    {0xA0155, 0xC4216, {kw_masks.data() + 10697, 4}, 0xE77D7},
+    {0x6124, 0xC4216, {kw_masks.data() + 10701, 6}, 0x2EF3BF},
+    {0xC6099, 0xC4216, {kw_masks.data() + 10707, 11}, 0x12EFBDF},
+    {0x10000122831, 0xC4216, {kw_masks.data() + 10718, 6}, 0x100001E6ABF},
+    {0x100021A3811, 0xC4216, {kw_masks.data() + 10724, 9}, 0x200100033E7B9F},
+    {0x41081, 0xC4216, {kw_masks.data() + 10733, 13}, 0x11EFBFF},
+    {0x5101, 0xC4216, {kw_masks.data() + 10746, 8}, 0x13E7BB7},
+    {0x2880D, 0xC4216, {kw_masks.data() + 10754, 10}, 0x1FFFDF},
+    {0x100000A613D, 0xC4216, {kw_masks.data() + 10764, 9}, 0x100011E7BBF},
+    {0x100000C3141, 0x1045802, {kw_masks.data() + 10773, 8}, 0x100011EFDDF},
+    {0x100000E2952, 0x1045802, {kw_masks.data() + 10781, 5}, 0x100010EF953},
+    {0x100004AC813, 0x1045802, {kw_masks.data() + 10786, 5}, 0x100014EFD5B},
+    {0x10001465997, 0x1045802, {kw_masks.data() + 10791, 6}, 0x100014EF9DF},
+    {0xFFFFFFFFFFFFFFFF, 0x1045802, {kw_masks.data() + 10797, 11}, 0xFFFFFFFFFFFFFFFF},
+    {0xFFFFFFFFFFFFFFFF, 0x1045802, {kw_masks.data() + 10808, 11}, 0xFFFFFFFFFFFFFFFF},
+    {0xE5010, 0x1045802, {kw_masks.data() + 10819, 7}, 0x16EF9D7},
+    {0x10001045803, 0x1045802, {kw_masks.data() + 10826, 5}, 0x100010EF9C7},
+    {0x100004E4815, 0x1045802, {kw_masks.data() + 10831, 9}, 0x100016EF9D7},
+    {0x100000EE805, 0x1045802, {kw_masks.data() + 10840, 4}, 0x100010EF947},
+    {0x1C5004, 0x1045802, {kw_masks.data() + 10844, 4}, 0x11EFD47},
+    {0x10000001957, 0x1045802, {kw_masks.data() + 10848, 14}, 0x100013EFFDF},
+    {0x10000180871, 0x1045802, {kw_masks.data() + 10862, 7}, 0x100011EFD77},
+    {0x422141, 0x1045802, {kw_masks.data() + 10869, 2}, 0x15E7947},
+    {0x100000669DC, 0x1045802, {kw_masks.data() + 10871, 6}, 0x100014EF9FF},
+    {0x100010A6010, 0x1045802, {kw_masks.data() + 10877, 10}, 0x100014EF9FF},
+    {0xAC19A, 0x1045802, {kw_masks.data() + 10887, 7}, 0x14EFDFB},
+    {0x10001046916, 0x1045802, {kw_masks.data() + 10894, 8}, 0x100014EFDFF},
+    {0x10000047540, 0x1045802, {kw_masks.data() + 10902, 7}, 0x100014EFDFB},
+    {0x100000A6950, 0x1045802, {kw_masks.data() + 10909, 7}, 0x100014EF9FB},
+    {0x200100004AE813, 0x1045802, {kw_masks.data() + 10916, 8}, 0x200100014EFDDB},
+    {0x100000EE119, 0x1045802, {kw_masks.data() + 10924, 7}, 0x100014EF9FB},
+    {0x1000004F992, 0x1045802, {kw_masks.data() + 10931, 10}, 0x100014EF9FF},
+    {0x100001A61D8, 0x1045802, {kw_masks.data() + 10941, 12}, 0x104095EF9FF},
+    {0x2A411D, 0x1045802, {kw_masks.data() + 10953, 3}, 0x16E795F},
+    {0x202418B, 0x1045802, {kw_masks.data() + 10956, 3}, 0x34679CB},
+    {0x1000052C001, 0x1045802, {kw_masks.data() + 10959, 5}, 0x100015EF99F},
+    {0x200100005AC1C1, 0x1045802, {kw_masks.data() + 10964, 7}, 0x200100015EF9DF},
+    {0x100004A41C1, 0x1045802, {kw_masks.data() + 10971, 5}, 0x100014E79DF},
+    {0x200100004A61C9, 0x1045802, {kw_masks.data() + 10976, 7}, 0x200100015E79DF},
+    {0x10000426009, 0x1045802, {kw_masks.data() + 10983, 5}, 0x100015E799F},
+    {0x200100004A6839, 0x1045802, {kw_masks.data() + 10988, 7}, 0x200100015E79BF},
+    {0x100004A4831, 0x1045802, {kw_masks.data() + 10995, 5}, 0x100014E793F},
+    {0x200100005AC831, 0x1045802, {kw_masks.data() + 11000, 7}, 0x200100015EF9BF},
+    {0x2001000052E009, 0x1045802, {kw_masks.data() + 11007, 4}, 0x2001000156F80B},
+    {0x200100004A49F1, 0x1045802, {kw_masks.data() + 11011, 4}, 0x200100014E59F3},
+    {0x100007A69F5, 0x1045802, {kw_masks.data() + 11015, 4}, 0x100017E79F7},
+    {0x100007A69F5, 0x1045802, {kw_masks.data() + 11019, 4}, 0x100017E79F7},
+    {0x100007AE1C5, 0x1045802, {kw_masks.data() + 11023, 4}, 0x100017EF9C7},
+    {0x100007A61CD, 0x1045802, {kw_masks.data() + 11027, 4}, 0x100017E79CF},
+    {0x100006E4D15, 0x1045802, {kw_masks.data() + 11031, 6}, 0x100016E5DBF},
+    {0x100005E6D17, 0x1045802, {kw_masks.data() + 11037, 10}, 0x100017E7FFF},
+    {0x10000424407, 0x1045802, {kw_masks.data() + 11047, 2}, 0x10001465C07},
+    {0x10000426019, 0x1045802, {kw_masks.data() + 11049, 2}, 0x1000146781B},
+    {0x30000426001, 0x1045802, {kw_masks.data() + 11051, 3}, 0x30001467C03},
+    {0x10000466001, 0x1045802, {kw_masks.data() + 11054, 4}, 0x10001467803},
+    {0x100004AC001, 0x1045802, {kw_masks.data() + 11058, 4}, 0x100015ED993},
+    {0x1000046C9B5, 0x1045802, {kw_masks.data() + 11062, 4}, 0x1000146F9F7},
+    {0x100010C5803, 0x1045802, {kw_masks.data() + 11066, 4}, 0x100010E79D3},
+    {0x5000, 0x1045802, {kw_masks.data() + 11070, 3}, 0x11679DA},
+    {0x100002E4129, 0x1045802, {kw_masks.data() + 11073, 6}, 0x100017E7BFB},
+    {0x100004258B9, 0x1045802, {kw_masks.data() + 11079, 4}, 0x100015E79FB},
+    {0x10001002141, 0x1045802, {kw_masks.data() + 11083, 9}, 0x100013E797F},
+    {0x100000E6905, 0x1045802, {kw_masks.data() + 11092, 5}, 0x100010E79D7},
+    {0x100008E408C, 0x1045802, {kw_masks.data() + 11097, 4}, 0x100018E79DF},
+    {0x100000E201D, 0x1045802, {kw_masks.data() + 11101, 6}, 0x100011E795F},
+    {0x1000104D817, 0x1045802, {kw_masks.data() + 11107, 5}, 0x1000116F9F7},
+    {0x27091, 0x1045802, {kw_masks.data() + 11112, 7}, 0x15E7FDF},
+    {0x200100008EE119, 0x1045802, {kw_masks.data() + 11119, 9}, 0x20010001DEFBFB},
+    {0x2489, 0x1045802, {kw_masks.data() + 11128, 8}, 0x10E7DFB},
+    {0x60111, 0x1045802, {kw_masks.data() + 11136, 4}, 0x306D99F},
+    {0x1E0001, 0x1045802, {kw_masks.data() + 11140, 5}, 0x39ED99F},
+    {0x3150, 0x1045802, {kw_masks.data() + 11145, 4}, 0x34EF9DF},
+    {0x22015, 0x1045802, {kw_masks.data() + 11149, 4}, 0x306F99F},
+    {0x4810, 0x1045802, {kw_masks.data() + 11153, 4}, 0x306F99F},
+    {0x224140, 0x1045802, {kw_masks.data() + 11157, 3}, 0x326D9DF},
+    {0x20903, 0x1045802, {kw_masks.data() + 11160, 6}, 0x31EFB9F},
+    {0x6C104, 0x1045802, {kw_masks.data() + 11166, 5}, 0x316F99F},
+    {0x1E0141, 0x1045802, {kw_masks.data() + 11171, 4}, 0x31ED9DF},
+    {0x2E105, 0x1045802, {kw_masks.data() + 11175, 4}, 0x30EF9DF},
+    {0x170101, 0x1045802, {kw_masks.data() + 11179, 5}, 0x35FD99F},
+    {0x48114, 0x1045802, {kw_masks.data() + 11184, 4}, 0x306D9BF},
+    {0x14C184, 0x1045802, {kw_masks.data() + 11188, 5}, 0x31EFD9F},
+    {0x100001E6CB7, 0x1045802, {kw_masks.data() + 11193, 7}, 0x100017E7CBF},
+    {0x100001AE013, 0x1045802, {kw_masks.data() + 11200, 6}, 0x100017EFD17},
+    {0x100001EE953, 0x1045802, {kw_masks.data() + 11206, 8}, 0x100017EFD57},
+    {0x1000118E803, 0x1045802, {kw_masks.data() + 11214, 7}, 0x100017EF9D3},
+    {0x200100005E602B, 0x1045802, {kw_masks.data() + 11221, 8}, 0x200100017E783B},
+    {0x100009A6417, 0x1045802, {kw_masks.data() + 11229, 8}, 0x10001FE7D57},
+    {0x100011EE813, 0x1045802, {kw_masks.data() + 11237, 8}, 0x100017EF9D3},
+    {0x100003E6012, 0x1045802, {kw_masks.data() + 11245, 7}, 0x100017E7973},
+    {0x100003E6033, 0x1045802, {kw_masks.data() + 11252, 8}, 0x100017E793B},
+    {0x100001E6C07, 0x1045802, {kw_masks.data() + 11260, 9}, 0x100017EFD57},
+    {0x100005EE00B, 0x1045802, {kw_masks.data() + 11269, 7}, 0x100017EF81B},
+    {0x100001CE023, 0x1045802, {kw_masks.data() + 11276, 7}, 0x100017EF83B},
+    {0x100005E600B, 0x1045802, {kw_masks.data() + 11283, 7}, 0x100017E781B},
+    {0x100005C602B, 0x1045802, {kw_masks.data() + 11290, 7}, 0x100017E783B},
+    {0x100001CE013, 0x1045802, {kw_masks.data() + 11297, 7}, 0x100013EF91F},
+    {0x100001CE002, 0x1045802, {kw_masks.data() + 11304, 5}, 0x100013FF813},
+    {0x100001A601E, 0x1045802, {kw_masks.data() + 11309, 5}, 0x100013E791F},
+    {0x10000186216, 0x1045802, {kw_masks.data() + 11314, 4}, 0x100013C7A17},
+    {0x3115, 0x1045802, {kw_masks.data() + 11318, 6}, 0x1267937},
+    {0x1000018710A, 0x1045802, {kw_masks.data() + 11324, 6}, 0x100017E79DB},
+    {0x100001A61C2, 0x1045802, {kw_masks.data() + 11330, 6}, 0x100013E79D3},
+    {0x100000E2013, 0x1045802, {kw_masks.data() + 11336, 11}, 0x100013EF9D7},
+    {0x460910, 0x1045802, {kw_masks.data() + 11347, 14}, 0x200000017EFDBF},
+    {0x100002A711B, 0x1045802, {kw_masks.data() + 11361, 9}, 0x100013EF99F},
+    {0x1000000F9B2, 0x1045802, {kw_masks.data() + 11370, 7}, 0x100012CF9B7},
+    {0x10000043971, 0x1045802, {kw_masks.data() + 11377, 4}, 0x1000146797B},
+    {0x10000043951, 0x1045802, {kw_masks.data() + 11381, 4}, 0x1000106795B},
+    {0x100010E785B, 0x1045802, {kw_masks.data() + 11385, 3}, 0x100010E785B},
+    {0x1189900, 0x1045802, {kw_masks.data() + 11388, 7}, 0xFFFFFFFFFFFFFFFF},
+    {0x148800, 0x1045802, {kw_masks.data() + 11395, 3}, 0x80000011CD883},
+    {0x143100, 0x1045802, {kw_masks.data() + 11398, 6}, 0xFFFFFFFFFFFFFFFF},
+    {0x200118, 0x1045802, {kw_masks.data() + 11404, 6}, 0xFFFFFFFFFFFFFFFF},
+    {0x100013529D1, 0x1045802, {kw_masks.data() + 11410, 7}, 0x100017F79D3},
+    {0x1082120, 0x1045802, {kw_masks.data() + 11417, 5}, 0x13E79BB},
+    {0x100009A7D1F, 0x1045802, {kw_masks.data() + 11422, 7}, 0x300019EFD5F},
+    {0x100009F7D15, 0x1045802, {kw_masks.data() + 11429, 8}, 0xB00019FFD57},
+    {0x100001F7519, 0x1045802, {kw_masks.data() + 11437, 5}, 0x900011FFD1F},
+    {0x100005F7591, 0x1045802, {kw_masks.data() + 11442, 6}, 0x900015FFD9F},
+    {0x10000CA7D95, 0x1045802, {kw_masks.data() + 11448, 6}, 0x30001DEFD9F},
+    {0x100008A7D1D, 0x1045802, {kw_masks.data() + 11454, 5}, 0x300019EFD1F},
+    {0x10001640089, 0x1045802, {kw_masks.data() + 11459, 3}, 0x100017CF98F},
+    {0x100019220D5, 0x1045802, {kw_masks.data() + 11462, 4}, 0x10001967CD7},
+    {0x100012669D9, 0x1045802, {kw_masks.data() + 11466, 10}, 0x1000136F9DF},
+    {0x1000104591F, 0x1045802, {kw_masks.data() + 11476, 6}, 0x100011EF9BF},
+    {0x10001067956, 0x1045802, {kw_masks.data() + 11482, 4}, 0x100010E79D6},
+    {0x20000000160938, 0x1045802, {kw_masks.data() + 11486, 7}, 0x200000011E7DFA},
+    {0x100000A391A, 0x1045802, {kw_masks.data() + 11493, 8}, 0x100010EF99F},
+    {0x1000000305B, 0x1045802, {kw_masks.data() + 11501, 4}, 0x100010E78DB},
+    {0x1000106FB73, 0x1045802, {kw_masks.data() + 11505, 9}, 0x100016EFBF7},
+    {0x1000042499C, 0x1045802, {kw_masks.data() + 11514, 8}, 0x100016E59DF},
+    {0x100001A7497, 0x1045802, {kw_masks.data() + 11522, 13}, 0xFFFFFFFFFFFFFFFF},
+    {0x10000C84596, 0x1045802, {kw_masks.data() + 11535, 10}, 0xFFFFFFFFFFFFFFFF},
+    {0x10000021495, 0x1045802, {kw_masks.data() + 11545, 10}, 0xFFFFFFFFFFFFFFFF},
+    {0x10000065405, 0x1045802, {kw_masks.data() + 11555, 9}, 0xFFFFFFFFFFFFFFFF},
+    {0x100001E7407, 0x1045802, {kw_masks.data() + 11564, 10}, 0xFFFFFFFFFFFFFFFF},
+    {0x1000112C804, 0x1045802, {kw_masks.data() + 11574, 5}, 0x100011ED896},
+    {0x1000112C81E, 0x1045802, {kw_masks.data() + 11579, 6}, 0x100011ED89E},
+    {0x100000AFD11, 0x1045802, {kw_masks.data() + 11585, 5}, 0x100010EFD93},
+    {0x200100000EC5D9, 0x1045802, {kw_masks.data() + 11590, 7}, 0x240100010EDDDB},
+    {0x200100000EE1D9, 0x1045802, {kw_masks.data() + 11597, 7}, 0x240100010EF9DB},
+    {0x68C11, 0x1045802, {kw_masks.data() + 11604, 4}, 0x40000010EDC93},
+    {0x10AC1C4, 0x1045802, {kw_masks.data() + 11608, 4}, 0x10ED9D6},
+    {0xE0158, 0x1045802, {kw_masks.data() + 11612, 4}, 0x10E59DA},
+    {0x100000A1419, 0x1045802, {kw_masks.data() + 11616, 6}, 0x100010E5C9B},
+    {0xE8811, 0x1045802, {kw_masks.data() + 11622, 11}, 0x11FFD9B},
+    {0x94001008415, 0x1045802, {kw_masks.data() + 11633, 1}, 0x9400104DC17},
+    {0x4014001008415, 0x1045802, {kw_masks.data() + 11634, 1}, 0x401400104DC17},
+    {0x14005008415, 0x1045802, {kw_masks.data() + 11635, 3}, 0x1400706DC17},
+    {0x14009008415, 0x1045802, {kw_masks.data() + 11638, 3}, 0x1400904FC17},
+    {0x14011008415, 0x1045802, {kw_masks.data() + 11641, 3}, 0x140114CDC17},
+    {0x14021008415, 0x1045802, {kw_masks.data() + 11644, 3}, 0x140210EDC97},
+    {0x14041008415, 0x1045802, {kw_masks.data() + 11647, 3}, 0x1404116DC37},
+    {0x14081008415, 0x1045802, {kw_masks.data() + 11650, 3}, 0x1408124DD37},
+    {0x14101008415, 0x1045802, {kw_masks.data() + 11653, 3}, 0x1410184DD17},
+    {0x14201008415, 0x1045802, {kw_masks.data() + 11656, 3}, 0x1420124FC17},
+    {0x14401008415, 0x1045802, {kw_masks.data() + 11659, 3}, 0x144010CDDD7},
+    {0x14801008415, 0x1045802, {kw_masks.data() + 11662, 3}, 0x1480104FD17},
+    {0x1400D008415, 0x1045802, {kw_masks.data() + 11665, 2}, 0x1400D04DC17},
+    {0x100001EA915, 0x1045802, {kw_masks.data() + 11667, 6}, 0x100011EF99F},
+    {0x100005EE915, 0x1045802, {kw_masks.data() + 11673, 6}, 0x100015EF99F},
+    {0x100001EB112, 0x1045802, {kw_masks.data() + 11679, 4}, 0x100791EF993},
+    {0x100011CF902, 0x1045802, {kw_masks.data() + 11683, 7}, 0xFFFFFFFFFFFFFFFF},
+    {0x100001EA911, 0x1045802, {kw_masks.data() + 11690, 6}, 0x100011EF997},
+    {0x301000118E81B, 0x1045802, {kw_masks.data() + 11696, 4}, 0x30100011CF89B},
+    {0x301000118E81B, 0x1045802, {kw_masks.data() + 11700, 5}, 0x30100011CF89B},
+    {0x301000118E81A, 0x1045802, {kw_masks.data() + 11705, 5}, 0x30100011CF89B},
+    {0x10000186806, 0x1045802, {kw_masks.data() + 11710, 3}, 0x100011CF887},
+    {0x10000186806, 0x1045802, {kw_masks.data() + 11713, 3}, 0x100011CF887},
+    {0x100001A6032, 0x1045802, {kw_masks.data() + 11716, 3}, 0x100011EF8B3},
+    {0xA7121, 0x1045802, {kw_masks.data() + 11719, 3}, 0x11EF9A3},
+    {0x1000018610A, 0x1045802, {kw_masks.data() + 11722, 4}, 0x100011CF99B},
+    {0x1000002191C, 0x1045802, {kw_masks.data() + 11726, 4}, 0x1000116F99F},
+    {0x10000586012, 0x1045802, {kw_masks.data() + 11730, 3}, 0x100015CF893},
+    {0x10000186042, 0x1045802, {kw_masks.data() + 11733, 3}, 0x100011CF8C3},
+    {0x301000118E81A, 0x1045802, {kw_masks.data() + 11736, 5}, 0x30100011CF89B},
+    {0x10000186402, 0x1045802, {kw_masks.data() + 11741, 4}, 0x100011CFC83},
+    {0x1000018E002, 0x1045802, {kw_masks.data() + 11745, 4}, 0x100011EFDC3},
+    {0x100001C6002, 0x1045802, {kw_masks.data() + 11749, 4}, 0x100011CF893},
+    {0x3000018E002, 0x1045802, {kw_masks.data() + 11753, 5}, 0x300011EFC83},
+    {0x100003C6002, 0x1045802, {kw_masks.data() + 11758, 4}, 0x100013EF893},
+    {0xFFFFFFFFFFFFFFFF, 0x1045802, {kw_masks.data() + 11762, 5}, 0xFFFFFFFFFFFFFFFF},
+    {0xFFFFFFFFFFFFFFFF, 0x1045802, {kw_masks.data() + 11767, 6}, 0xFFFFFFFFFFFFFFFF},
+    {0xFFFFFFFFFFFFFFFF, 0x1045802, {kw_masks.data() + 11773, 6}, 0xFFFFFFFFFFFFFFFF},
+    {0xFFFFFFFFFFFFFFFF, 0x1045802, {kw_masks.data() + 11779, 7}, 0xFFFFFFFFFFFFFFFF},
+    {0xFFFFFFFFFFFFFFFF, 0x1045802, {kw_masks.data() + 11786, 5}, 0xFFFFFFFFFFFFFFFF},
+    {0xFFFFFFFFFFFFFFFF, 0x1045802, {kw_masks.data() + 11791, 5}, 0xFFFFFFFFFFFFFFFF},
+    {0xFFFFFFFFFFFFFFFF, 0x1045802, {kw_masks.data() + 11796, 5}, 0xFFFFFFFFFFFFFFFF},
+    {0xFFFFFFFFFFFFFFFF, 0x1045802, {kw_masks.data() + 11801, 6}, 0xFFFFFFFFFFFFFFFF},
+    {0xFFFFFFFFFFFFFFFF, 0x1045802, {kw_masks.data() + 11807, 5}, 0xFFFFFFFFFFFFFFFF},
+    {0xFFFFFFFFFFFFFFFF, 0x1045802, {kw_masks.data() + 11812, 5}, 0xFFFFFFFFFFFFFFFF},
+    {0xFFFFFFFFFFFFFFFF, 0x1045802, {kw_masks.data() + 11817, 5}, 0xFFFFFFFFFFFFFFFF},
+    {0xFFFFFFFFFFFFFFFF, 0x1045802, {kw_masks.data() + 11822, 6}, 0xFFFFFFFFFFFFFFFF},
+    {0xFFFFFFFFFFFFFFFF, 0x1045802, {kw_masks.data() + 11828, 5}, 0xFFFFFFFFFFFFFFFF},
+    {0xFFFFFFFFFFFFFFFF, 0x1045802, {kw_masks.data() + 11833, 5}, 0xFFFFFFFFFFFFFFFF},
+    {0xFFFFFFFFFFFFFFFF, 0x1045802, {kw_masks.data() + 11838, 5}, 0xFFFFFFFFFFFFFFFF},
+    {0xFFFFFFFFFFFFFFFF, 0x1045802, {kw_masks.data() + 11843, 6}, 0xFFFFFFFFFFFFFFFF},
+    {0xFFFFFFFFFFFFFFFF, 0x1045802, {kw_masks.data() + 11849, 6}, 0xFFFFFFFFFFFFFFFF},
+    {0x1000002091C, 0x1045802, {kw_masks.data() + 11855, 3}, 0x100010E595E},
+    {0x10000026955, 0x1045802, {kw_masks.data() + 11858, 3}, 0x100010E7957},
+    {0x10001424914, 0x1045802, {kw_masks.data() + 11861, 3}, 0x100014E5956},
+    {0x10000022954, 0x1045802, {kw_masks.data() + 11864, 3}, 0x100010E7956},
+    {0x10000120916, 0x1045802, {kw_masks.data() + 11867, 3}, 0x100011E5956},
+    {0x10000128914, 0x1045802, {kw_masks.data() + 11870, 3}, 0x100011ED956},
+    {0x10000426916, 0x1045802, {kw_masks.data() + 11873, 3}, 0x100014E7956},
+    {0x10000020D17, 0x1045802, {kw_masks.data() + 11876, 3}, 0x100010E5D57},
+    {0x100004A0994, 0x1045802, {kw_masks.data() + 11879, 3}, 0x100014E59D6},
+    {0x10000170019, 0x1045802, {kw_masks.data() + 11882, 5}, 0x100011FF95F},
+    {0x10000176051, 0x1045802, {kw_masks.data() + 11887, 3}, 0x100011F7957},
+    {0x10001574811, 0x1045802, {kw_masks.data() + 11890, 5}, 0x100015FF95F},
+    {0x10000172051, 0x1045802, {kw_masks.data() + 11895, 3}, 0x100011F7957},
+    {0x10000170813, 0x1045802, {kw_masks.data() + 11898, 3}, 0x100011F5957},
+    {0x10000178811, 0x1045802, {kw_masks.data() + 11901, 3}, 0x100011FD957},
+    {0x10000576013, 0x1045802, {kw_masks.data() + 11904, 3}, 0x100015F7957},
+    {0x10000170C57, 0x1045802, {kw_masks.data() + 11907, 4}, 0x100011F5D57},
+    {0x100005F09D1, 0x1045802, {kw_masks.data() + 11911, 4}, 0x100015F59D7},
+    {0x10000171D1F, 0x1045802, {kw_masks.data() + 11915, 4}, 0x100011F5D5F},
+    {0x100005F1199, 0x1045802, {kw_masks.data() + 11919, 4}, 0x100015F59DF},
+    {0x20010000171D1F, 0x1045802, {kw_masks.data() + 11923, 6}, 0x200100011F5D5F},
+    {0x200100005F1999, 0x1045802, {kw_masks.data() + 11929, 6}, 0x200100015F59DF},
+    {0x10000171C17, 0x1045802, {kw_masks.data() + 11935, 4}, 0x100011F5D57},
+    {0x100005F1991, 0x1045802, {kw_masks.data() + 11939, 4}, 0x100015F59D7},
+    {0x10000027959, 0x1045802, {kw_masks.data() + 11943, 4}, 0x100010E795F},
+    {0x1000012795B, 0x1045802, {kw_masks.data() + 11947, 4}, 0x100011E795F},
+    {0x10000067959, 0x1045802, {kw_masks.data() + 11951, 4}, 0x100010E795F},
+    {0x1000014791B, 0x1045802, {kw_masks.data() + 11955, 4}, 0x100011E795F},
+    {0x100001AE959, 0x1045802, {kw_masks.data() + 11959, 5}, 0x100011EF95F},
+    {0x100004AE959, 0x1045802, {kw_masks.data() + 11964, 5}, 0x100014EF95F},
+    {0x10000487189, 0x1045802, {kw_masks.data() + 11969, 4}, 0x100014E79DF},
+    {0x100001A610B, 0x1045802, {kw_masks.data() + 11973, 3}, 0x100011E795F},
+    {0x100005F6193, 0x1045802, {kw_masks.data() + 11976, 5}, 0x100015F79DF},
+    {0x100001F6C17, 0x1045802, {kw_masks.data() + 11981, 4}, 0x100011F7D57},
+    {0x100001308FD, 0x40861, {kw_masks.data() + 11985, 10}, 0x100005FFDFD},
+    {0x100001A2961, 0x40861, {kw_masks.data() + 11995, 5}, 0x100001EE965},
+    {0x1000006487D, 0x40861, {kw_masks.data() + 12000, 6}, 0x100000EEB7F},
+    {0x10000000C67, 0x40861, {kw_masks.data() + 12006, 3}, 0x10000642D67},
+    {0x100004809F1, 0x40861, {kw_masks.data() + 12009, 3}, 0x100006C29F1},
+    {0x10000426963, 0x40861, {kw_masks.data() + 12012, 15}, 0x10001DFE97B},
+    {0x100000E2879, 0x40861, {kw_masks.data() + 12027, 6}, 0x100005EADFB},
+    {0x100000A8971, 0x40861, {kw_masks.data() + 12033, 6}, 0x100011EEB79},
+    {0x1400004697D, 0x40861, {kw_masks.data() + 12039, 4}, 0x140011E697D},
+    {0x14000026869, 0x40861, {kw_masks.data() + 12043, 3}, 0x140011E686D},
+    {0x140001E397B, 0x40861, {kw_masks.data() + 12046, 5}, 0x140011E797F},
+    {0x140000C29E1, 0x40861, {kw_masks.data() + 12051, 3}, 0x140011E69E5},
+    {0x4140001A296B, 0x40861, {kw_masks.data() + 12054, 4}, 0x4140011E696F},
+    {0x14000102961, 0x40861, {kw_masks.data() + 12058, 3}, 0x140011E6965},
+    {0x14000002963, 0x40861, {kw_masks.data() + 12061, 3}, 0x140011E6967},
+    {0x14000023971, 0x40861, {kw_masks.data() + 12064, 3}, 0x140011E7975},
+    {0x14000006861, 0x40861, {kw_masks.data() + 12067, 3}, 0x140011E6865},
+    {0x140000A2965, 0x40861, {kw_masks.data() + 12070, 3}, 0x140011E6965},
+    {0x140000A2971, 0x40861, {kw_masks.data() + 12073, 3}, 0x140011E6975},
+    {0x14000067975, 0x40861, {kw_masks.data() + 12076, 4}, 0x140011E7975},
+    {0x140001E0961, 0x40861, {kw_masks.data() + 12080, 3}, 0x140011E6965},
+    {0x140001E0961, 0x40861, {kw_masks.data() + 12083, 3}, 0x140011E6965},
+    {0x14000120863, 0x40861, {kw_masks.data() + 12086, 3}, 0x140011E6867},
+    {0xFFFFFFFFFFFFFFFF, 0x40861, {kw_masks.data() + 12089, 4}, 0xFFFFFFFFFFFFFFFF},
+    {0x14002022B73, 0x40861, {kw_masks.data() + 12093, 3}, 0x140031E6B77},
+    {0x4140022669F3, 0x40861, {kw_masks.data() + 12096, 4}, 0x4140033E69F7},
+    {0x1400006486B, 0x40861, {kw_masks.data() + 12100, 3}, 0x140011E686F},
+    {0x140000428FB, 0x40861, {kw_masks.data() + 12103, 3}, 0x140011E68FF},
+    {0x14000101973, 0x40861, {kw_masks.data() + 12106, 3}, 0x140011E7977},
+    {0x14000166D63, 0x40861, {kw_masks.data() + 12109, 4}, 0x140011E6D67},
+    {0x14000120963, 0x40861, {kw_masks.data() + 12113, 3}, 0x140011E6967},
+    {0x140000229E3, 0x40861, {kw_masks.data() + 12116, 3}, 0x140011E69E7},
+    {0x1400012296B, 0x40861, {kw_masks.data() + 12119, 3}, 0x140011E696F},
+    {0x14000002973, 0x40861, {kw_masks.data() + 12122, 3}, 0x140011E6977},
+    {0xFFFFFFFFFFFFFFFF, 0x40861, {kw_masks.data() + 12125, 4}, 0xFFFFFFFFFFFFFFFF},
+    {0x1400012187B, 0x40861, {kw_masks.data() + 12129, 3}, 0x140011E787F},
+    {0x14000122973, 0x40861, {kw_masks.data() + 12132, 3}, 0x140011E6977},
+    {0x14000204963, 0x40861, {kw_masks.data() + 12135, 3}, 0x140013E6967},
+    {0x140000E29FF, 0x40861, {kw_masks.data() + 12138, 4}, 0x140011E69FF},
+    {0x14002020963, 0x40861, {kw_masks.data() + 12142, 3}, 0x140031E6967},
+    {0x140000418E3, 0x40861, {kw_masks.data() + 12145, 3}, 0x140011E78E7},
+    {0x140001828E3, 0x40861, {kw_masks.data() + 12148, 3}, 0x140011E68E7},
+    {0x140003C697B, 0x40861, {kw_masks.data() + 12151, 4}, 0x140013E697F},
+    {0x140004C6863, 0x40861, {kw_masks.data() + 12155, 3}, 0x140015E6867},
+    {0x14000160873, 0x40861, {kw_masks.data() + 12158, 3}, 0x140011E6877},
+    {0x14002000973, 0x40861, {kw_masks.data() + 12161, 3}, 0x140031E6977},
+    {0x1400000286D, 0x40861, {kw_masks.data() + 12164, 3}, 0x140011E686D},
+    {0x3014000046D7D, 0x40861, {kw_masks.data() + 12167, 5}, 0x30140011E6D7D},
+    {0x20014000046DE5, 0x40861, {kw_masks.data() + 12172, 4}, 0x200140011E6DE5},
+    {0x140001AA977, 0x40861, {kw_masks.data() + 12176, 5}, 0x140011EE977},
+    {0x20014002226977, 0x40861, {kw_masks.data() + 12181, 4}, 0x200140033E6977},
+    {0x140024E2979, 0x40861, {kw_masks.data() + 12185, 3}, 0x140035E697D},
+    {0xFFFFFFFFFFFFFFFF, 0x40861, {kw_masks.data() + 12188, 4}, 0xFFFFFFFFFFFFFFFF},
+    {0x14000046D6D, 0x40861, {kw_masks.data() + 12192, 4}, 0x140011E6D6D},
+    {0x140000009F5, 0x40861, {kw_masks.data() + 12196, 3}, 0x140011E69F5},
+    {0x14000027875, 0x40861, {kw_masks.data() + 12199, 3}, 0x140011E7875},
+    {0x140000029E5, 0x40861, {kw_masks.data() + 12202, 3}, 0x140011E69E5},
+    {0x14000005967, 0x40861, {kw_masks.data() + 12205, 3}, 0x140011E7967},
+    {0x140000EE97D, 0x40861, {kw_masks.data() + 12208, 4}, 0x140011EE97D},
+    {0x14000060C61, 0x40861, {kw_masks.data() + 12212, 3}, 0x140011E6C65},
+    {0x140000E4965, 0x40861, {kw_masks.data() + 12215, 4}, 0x140011E6965},
+    {0x14000100867, 0x40861, {kw_masks.data() + 12219, 3}, 0x140011E6867},
+    {0x1400022887D, 0x40861, {kw_masks.data() + 12222, 4}, 0x140013EE87D},
+    {0xFFFFFFFFFFFFFFFF, 0x40861, {kw_masks.data() + 12226, 3}, 0xFFFFFFFFFFFFFFFF},
+    {0x140000E39ED, 0x40861, {kw_masks.data() + 12229, 4}, 0x140011E79ED},
+    {0x14001168865, 0x40861, {kw_masks.data() + 12233, 3}, 0x140011EE865},
+    {0x140020009F5, 0x40861, {kw_masks.data() + 12236, 3}, 0x140031E69F5},
+    {0x14001023871, 0x40861, {kw_masks.data() + 12239, 3}, 0x140011E7875},
+    {0x1400002497D, 0x40861, {kw_masks.data() + 12242, 4}, 0x140011E697D},
+    {0x14000184B6B, 0x40861, {kw_masks.data() + 12246, 3}, 0x140011E6B6F},
+    {0x14000023C79, 0x40861, {kw_masks.data() + 12249, 3}, 0x140011E7C7D},
+    {0x1400000796D, 0x40861, {kw_masks.data() + 12252, 3}, 0x140011E796D},
+    {0x1400012F97F, 0x40861, {kw_masks.data() + 12255, 4}, 0x140011EF97F},
+    {0x14000020971, 0x40861, {kw_masks.data() + 12259, 3}, 0x140011E6975},
+    {0x414000181975, 0x40861, {kw_masks.data() + 12262, 4}, 0x4140011E7975},
+    {0x1400012487D, 0x40861, {kw_masks.data() + 12266, 3}, 0x140011E687D},
+    {0x140000C6971, 0x40861, {kw_masks.data() + 12269, 3}, 0x140011E6975},
+    {0x14001088871, 0x40861, {kw_masks.data() + 12272, 3}, 0x140011EE875},
+    {0x140004E28F1, 0x40861, {kw_masks.data() + 12275, 4}, 0x140015E68F5},
+    {0x140000A0971, 0x40861, {kw_masks.data() + 12279, 3}, 0x140011E6975},
+    {0x1400004A961, 0x40861, {kw_masks.data() + 12282, 3}, 0x140011EE965},
+    {0x1400008C9F1, 0x40861, {kw_masks.data() + 12285, 3}, 0x140011EE9F5},
+    {0x1400012E971, 0x40861, {kw_masks.data() + 12288, 4}, 0x140011EE975},
+    {0x14000002969, 0x40861, {kw_masks.data() + 12292, 3}, 0x140011E696D},
+    {0x14000000B61, 0x40861, {kw_masks.data() + 12295, 3}, 0x140011E6B65},
+    {0x14000042D69, 0x40861, {kw_masks.data() + 12298, 4}, 0x140011E6D6D},
+    {0x14000067975, 0x40861, {kw_masks.data() + 12302, 3}, 0x140011E7975},
+    {0x14000066979, 0x40861, {kw_masks.data() + 12305, 4}, 0x140011E697D},
+    {0x14000022875, 0x40861, {kw_masks.data() + 12309, 3}, 0x140011E6875},
+    {0x14000006863, 0x40861, {kw_masks.data() + 12312, 3}, 0x140011E6867},
+    {0x14000187D79, 0x40861, {kw_masks.data() + 12315, 4}, 0x140011E7D7D},
+    {0x14000022879, 0x40861, {kw_masks.data() + 12319, 3}, 0x140011E687D},
+    {0x14000024971, 0x40861, {kw_masks.data() + 12322, 3}, 0x140011E6975},
+    {0x140001229F5, 0x40861, {kw_masks.data() + 12325, 4}, 0x140011E69F5},
+    {0x14001162871, 0x40861, {kw_masks.data() + 12329, 3}, 0x140011E6875},
+    {0x140000028E1, 0x40861, {kw_masks.data() + 12332, 3}, 0x140011E68E5},
+    {0x140000A0963, 0x40861, {kw_masks.data() + 12335, 3}, 0x140011E6967},
+    {0x14000022879, 0x40861, {kw_masks.data() + 12338, 3}, 0x140011E687D},
+    {0x14000001963, 0x40861, {kw_masks.data() + 12341, 3}, 0x140011E7967},
+    {0x14000102971, 0x40861, {kw_masks.data() + 12344, 3}, 0x140011E6975},
+    {0x1400010C879, 0x40861, {kw_masks.data() + 12347, 3}, 0x140011EE87D},
+    {0x140001B6971, 0x40861, {kw_masks.data() + 12350, 4}, 0x140011F6975},
+    {0x14000020875, 0x40861, {kw_masks.data() + 12354, 3}, 0x140011E6875},
+    {0x4140005E69FD, 0x40861, {kw_masks.data() + 12357, 6}, 0x4140015E69FD},
+    {0x14000181871, 0x40861, {kw_masks.data() + 12363, 3}, 0x140011E7875},
+    {0x14000101861, 0x40861, {kw_masks.data() + 12366, 3}, 0x140011E7865},
+    {0x20014000142973, 0x40861, {kw_masks.data() + 12369, 4}, 0x200140011E6977},
+    {0x14001102861, 0x40861, {kw_masks.data() + 12373, 3}, 0x140011E6865},
+    {0x14000066DE5, 0x40861, {kw_masks.data() + 12376, 6}, 0x140011E6DE5},
+    {0x4140000679FD, 0x40861, {kw_masks.data() + 12382, 5}, 0x4140011E79FD},
+    {0x140001668E9, 0x40861, {kw_masks.data() + 12387, 3}, 0x140011E68ED},
+    {0x140000A4965, 0x40861, {kw_masks.data() + 12390, 3}, 0x140011E6965},
+    {0x140000809E1, 0x40861, {kw_masks.data() + 12393, 3}, 0x140011E69E5},
+    {0x140011228E1, 0x40861, {kw_masks.data() + 12396, 3}, 0x140011E68E5},
+    {0x1400106296D, 0x40861, {kw_masks.data() + 12399, 4}, 0x140011E696D},
+    {0x14000046979, 0x40861, {kw_masks.data() + 12403, 3}, 0x140011E697D},
+    {0x14000022979, 0x40861, {kw_masks.data() + 12406, 3}, 0x140011E697D},
+    {0x14000060971, 0x40861, {kw_masks.data() + 12409, 3}, 0x140011E6975},
+    {0x14000047971, 0x40861, {kw_masks.data() + 12412, 4}, 0x140011E7975},
+    {0x14000002969, 0x40861, {kw_masks.data() + 12416, 3}, 0x140011E696D},
+    {0x140010E69FF, 0x40861, {kw_masks.data() + 12419, 6}, 0x140011E69FF},
+    {0x14000030961, 0x40861, {kw_masks.data() + 12425, 3}, 0x140011F6965},
+    {0x14000022961, 0x40861, {kw_masks.data() + 12428, 3}, 0x140011E6965},
+    {0x1400000297D, 0x40861, {kw_masks.data() + 12431, 3}, 0x140011E697D},
+    {0x14001080961, 0x40861, {kw_masks.data() + 12434, 3}, 0x140011E6965},
+    {0x14001060A71, 0x40861, {kw_masks.data() + 12437, 3}, 0x140011E6A75},
+    {0x14000001B65, 0x40861, {kw_masks.data() + 12440, 3}, 0x140011E7B65},
+    {0x14000026A69, 0x40861, {kw_masks.data() + 12443, 3}, 0x140011E6A6D},
+    {0x1400000AA61, 0x40861, {kw_masks.data() + 12446, 3}, 0x140011EEA65},
+    {0x14001002C71, 0x40861, {kw_masks.data() + 12449, 3}, 0x140011E6C75},
+    {0x140030E2C61, 0x40861, {kw_masks.data() + 12452, 3}, 0x140031E6C65},
+    {0x1400000596F, 0x40861, {kw_masks.data() + 12455, 3}, 0x140011E796F},
+    {0x140000A0D63, 0x40861, {kw_masks.data() + 12458, 3}, 0x140011E6D67},
+    {0x14000065865, 0x40861, {kw_masks.data() + 12461, 3}, 0x140011E7865},
+    {0x404140002C2D71, 0x40861, {kw_masks.data() + 12464, 5}, 0x404140013E6D75},
+    {0x140000A6CF1, 0x40861, {kw_masks.data() + 12469, 4}, 0x140011E6CF5},
+    {0x140001E4CF1, 0x40861, {kw_masks.data() + 12473, 4}, 0x140011E6CF5},
+    {0x14000580D61, 0x40861, {kw_masks.data() + 12477, 3}, 0x140015E6D65},
+    {0x1400104396D, 0x40861, {kw_masks.data() + 12480, 4}, 0x140011E796D},
+    {0x140020C2CE1, 0x40861, {kw_masks.data() + 12484, 3}, 0x140031E6CE5},
+    {0x14000044861, 0x40861, {kw_masks.data() + 12487, 3}, 0x140011E6865},
+    {0x14000006873, 0x40861, {kw_masks.data() + 12490, 3}, 0x140011E6877},
+    {0x400140001C0965, 0x40861, {kw_masks.data() + 12493, 4}, 0x400140011E6965},
+    {0x140000C29F5, 0x40861, {kw_masks.data() + 12497, 3}, 0x140011E69F5},
+    {0x14000062D61, 0x40861, {kw_masks.data() + 12500, 4}, 0x140011E6D65},
+    {0x14000020973, 0x40861, {kw_masks.data() + 12504, 3}, 0x140011E6977},
+    {0x140000C48F1, 0x40861, {kw_masks.data() + 12507, 3}, 0x140011E68F5},
+    {0x140001829E1, 0x40861, {kw_masks.data() + 12510, 3}, 0x140011E69E5},
+    {0x14000925873, 0x40861, {kw_masks.data() + 12513, 3}, 0x140019E7877},
+    {0x14000280961, 0x40861, {kw_masks.data() + 12516, 3}, 0x140013E6965},
+    {0x14001000963, 0x40861, {kw_masks.data() + 12519, 3}, 0x140011E6967},
+    {0x14000025865, 0x40861, {kw_masks.data() + 12522, 3}, 0x140011E7865},
+    {0x14000007865, 0x40861, {kw_masks.data() + 12525, 3}, 0x140011E7865},
+    {0x14000205869, 0x40861, {kw_masks.data() + 12528, 3}, 0x140013E786D},
+    {0x140000A7871, 0x40861, {kw_masks.data() + 12531, 3}, 0x140011E7875},
+    {0x400140000E3961, 0x40861, {kw_masks.data() + 12534, 4}, 0x400140011E7965},
+    {0x1400006186D, 0x40861, {kw_masks.data() + 12538, 3}, 0x140011E786D},
+    {0x140000639E9, 0x40861, {kw_masks.data() + 12541, 4}, 0x140011E79ED},
+    {0x140000A79FD, 0x40861, {kw_masks.data() + 12545, 4}, 0x140011E79FD},
+    {0x14000001961, 0x40861, {kw_masks.data() + 12549, 3}, 0x140011E7965},
+    {0x3014001123863, 0x40861, {kw_masks.data() + 12552, 4}, 0x30140011E7867},
+    {0x14000007961, 0x40861, {kw_masks.data() + 12556, 3}, 0x140011E7965},
+    {0x140000679E5, 0x40861, {kw_masks.data() + 12559, 5}, 0x140011E79E5},
+    {0x140000E79F9, 0x40861, {kw_masks.data() + 12564, 5}, 0x140011E79FD},
+    {0x140001B3971, 0x40861, {kw_masks.data() + 12569, 3}, 0x140011F7975},
+    {0x140001A3961, 0x40861, {kw_masks.data() + 12572, 3}, 0x140011E7965},
+    {0x140000E7871, 0x40861, {kw_masks.data() + 12575, 3}, 0x140011E7875},
+    {0x14000081861, 0x40861, {kw_masks.data() + 12578, 3}, 0x140011E7865},
+    {0x140001E1961, 0x40861, {kw_masks.data() + 12581, 3}, 0x140011E7965},
+    {0x14000241979, 0x40861, {kw_masks.data() + 12584, 3}, 0x140013E797D},
+    {0x14000401961, 0x40861, {kw_masks.data() + 12587, 3}, 0x140015E7965},
+    {0x14000805975, 0x40861, {kw_masks.data() + 12590, 3}, 0x140019E7975},
+    {0x14001041961, 0x40861, {kw_masks.data() + 12593, 3}, 0x140011E7965},
+    {0x14002115973, 0x40861, {kw_masks.data() + 12596, 3}, 0x140031F7977},
+    {0x14000003963, 0x40861, {kw_masks.data() + 12599, 3}, 0x140011E7967},
+    {0x1400040697D, 0x40861, {kw_masks.data() + 12602, 4}, 0x140015E697D},
+    {0x14000022971, 0x40861, {kw_masks.data() + 12606, 3}, 0x140011E6975},
+    {0x14000066D69, 0x40861, {kw_masks.data() + 12609, 4}, 0x140011E6D6D},
+    {0x14000022971, 0x40861, {kw_masks.data() + 12613, 3}, 0x140011E6975},
+    {0x14000122965, 0x40861, {kw_masks.data() + 12616, 3}, 0x140011E6965},
+    {0x140000E28F9, 0x40861, {kw_masks.data() + 12619, 3}, 0x140011E68FD},
+    {0x14001426861, 0x40861, {kw_masks.data() + 12622, 3}, 0x140015E6865},
+    {0x1400000A871, 0x40861, {kw_masks.data() + 12625, 3}, 0x140011EE875},
+    {0x14000122861, 0x40861, {kw_masks.data() + 12628, 3}, 0x140011E6865},
+    {0x14000102971, 0x40861, {kw_masks.data() + 12631, 3}, 0x140011E6975},
+    {0x14002402879, 0x40861, {kw_masks.data() + 12634, 4}, 0x140035E687D},
+    {0x14000007861, 0x40861, {kw_masks.data() + 12638, 3}, 0x140011E7865},
+    {0x1400000B861, 0x40861, {kw_masks.data() + 12641, 3}, 0x140011EF865},
+    {0x14000128871, 0x40861, {kw_masks.data() + 12644, 3}, 0x140011EE875},
+    {0x1400106E9F5, 0x40861, {kw_masks.data() + 12647, 4}, 0x140011EE9F5},
+    {0x1400050A971, 0x40861, {kw_masks.data() + 12651, 5}, 0x140015EE975},
+    {0x1400004A9F1, 0x40861, {kw_masks.data() + 12656, 3}, 0x140011EE9F5},
+    {0x140000CAD61, 0x40861, {kw_masks.data() + 12659, 3}, 0x140011EED65},
+    {0x1400000E869, 0x40861, {kw_masks.data() + 12662, 3}, 0x140011EE86D},
+    {0x404140001FF971, 0x40861, {kw_masks.data() + 12665, 5}, 0x404140011FF975},
+    {0x140000EA96D, 0x40861, {kw_masks.data() + 12670, 4}, 0x140011EE96D},
+    {0x140001AC975, 0x40861, {kw_masks.data() + 12674, 4}, 0x140011EE975},
+    {0x140000EE971, 0x40861, {kw_masks.data() + 12678, 4}, 0x140011EE975},
+    {0x140001AC861, 0x40861, {kw_masks.data() + 12682, 3}, 0x140011EE865},
+    {0x14000108861, 0x40861, {kw_masks.data() + 12685, 3}, 0x140011EE865},
+    {0x14001128861, 0x40861, {kw_masks.data() + 12688, 3}, 0x140011EE865},
+    {0x140000B0861, 0x40861, {kw_masks.data() + 12691, 3}, 0x140011F6865},
+    {0xFFFFFFFFFFFFFFFF, 0x40861, {kw_masks.data() + 12694, 3}, 0xFFFFFFFFFFFFFFFF},
+    {0x14000027961, 0x40861, {kw_masks.data() + 12697, 3}, 0x140011E7965},
+    {0x14000060973, 0x40861, {kw_masks.data() + 12700, 3}, 0x140011E6977},
+    {0x14000160961, 0x40861, {kw_masks.data() + 12703, 3}, 0x140011E6965},
+    {0x14000422869, 0x40861, {kw_masks.data() + 12706, 3}, 0x140015E686D},
+    {0x1400016096B, 0x40861, {kw_masks.data() + 12709, 4}, 0x140011E696F},
+    {0x14000047969, 0x40861, {kw_masks.data() + 12713, 4}, 0x140011E796D},
+    {0x140010408F5, 0x40861, {kw_masks.data() + 12717, 3}, 0x140011E68F5},
+    {0x14000142869, 0x40861, {kw_masks.data() + 12720, 3}, 0x140011E686D},
+    {0x14000442879, 0x40861, {kw_masks.data() + 12723, 3}, 0x140015E687D},
+    {0x1400006E971, 0x40861, {kw_masks.data() + 12726, 3}, 0x140011EE975},
+    {0x400140000C28F1, 0x40861, {kw_masks.data() + 12729, 4}, 0x400140011E68F5},
+    {0x14000246971, 0x40861, {kw_masks.data() + 12733, 3}, 0x140013E6975},
+    {0x414001263A7B, 0x40861, {kw_masks.data() + 12736, 5}, 0x4140013E7A7F},
+    {0x14000244D61, 0x40861, {kw_masks.data() + 12741, 3}, 0x140013E6D65},
+    {0x14000066971, 0x40861, {kw_masks.data() + 12744, 4}, 0x140011E6975},
+    {0x14000067961, 0x40861, {kw_masks.data() + 12748, 4}, 0x140011E7965},
+    {0x14000042871, 0x40861, {kw_masks.data() + 12752, 3}, 0x140011E6875},
+    {0x14000045961, 0x40861, {kw_masks.data() + 12755, 3}, 0x140011E7965},
+    {0x14000163971, 0x40861, {kw_masks.data() + 12758, 3}, 0x140011E7975},
+    {0x140001C68E9, 0x40861, {kw_masks.data() + 12761, 4}, 0x140011E68ED},
+    {0xFFFFFFFFFFFFFFFF, 0x40861, {kw_masks.data() + 12765, 5}, 0xFFFFFFFFFFFFFFFF},
+    {0x14000264879, 0x40861, {kw_masks.data() + 12770, 4}, 0x140013E687D},
+    {0x140000E3971, 0x40861, {kw_masks.data() + 12774, 4}, 0x140011E7975},
+    {0x14001060961, 0x40861, {kw_masks.data() + 12778, 3}, 0x140011E6965},
+    {0x140004C2971, 0x40861, {kw_masks.data() + 12781, 3}, 0x140015E6975},
+    {0x140001E29ED, 0x40861, {kw_masks.data() + 12784, 5}, 0x140011E69ED},
+    {0x4140001E6D6D, 0x40861, {kw_masks.data() + 12789, 5}, 0x4140011E6D6D},
+    {0x140000008ED, 0x40861, {kw_masks.data() + 12794, 3}, 0x140011E68ED},
+    {0x140001E69F5, 0x40861, {kw_masks.data() + 12797, 5}, 0x140011E69F5},
+    {0x14000084861, 0x40861, {kw_masks.data() + 12802, 3}, 0x140011E6865},
+    {0x140000829E9, 0x40861, {kw_masks.data() + 12805, 3}, 0x140011E69ED},
+    {0x140000C2F61, 0x40861, {kw_masks.data() + 12808, 3}, 0x140011E6F65},
+    {0x14000184C71, 0x40861, {kw_masks.data() + 12811, 3}, 0x140011E6C75},
+    {0x200140000E5971, 0x40861, {kw_masks.data() + 12814, 4}, 0x200140011E7975},
+    {0x140001E3D71, 0x40861, {kw_masks.data() + 12818, 3}, 0x140011E7D75},
+    {0x140001C2961, 0x40861, {kw_masks.data() + 12821, 3}, 0x140011E6965},
+    {0x14000086861, 0x40861, {kw_masks.data() + 12824, 3}, 0x140011E6865},
+    {0xFFFFFFFFFFFFFFFF, 0x40861, {kw_masks.data() + 12827, 3}, 0xFFFFFFFFFFFFFFFF},
+    {0x4140000A696B, 0x40861, {kw_masks.data() + 12830, 4}, 0x4140011E696F},
+    {0x14000380861, 0x40861, {kw_masks.data() + 12834, 3}, 0x140013E6865},
+    {0x14000482961, 0x40861, {kw_masks.data() + 12837, 3}, 0x140015E6965},
+    {0x14002082961, 0x40861, {kw_masks.data() + 12840, 3}, 0x140031E6965},
+    {0x14000122D71, 0x40861, {kw_masks.data() + 12843, 3}, 0x140011E6D75},
+    {0x14000102869, 0x40861, {kw_masks.data() + 12846, 3}, 0x140011E686D},
+    {0x400140011C6969, 0x40861, {kw_masks.data() + 12849, 4}, 0x400140011E696D},
+    {0x140001C6979, 0x40861, {kw_masks.data() + 12853, 4}, 0x140011E697D},
+    {0x140001C2979, 0x40861, {kw_masks.data() + 12857, 4}, 0x140011E697D},
+    {0x14001120861, 0x40861, {kw_masks.data() + 12861, 3}, 0x140011E6865},
+    {0x140021C2D73, 0x40861, {kw_masks.data() + 12864, 3}, 0x140031E6D77},
+    {0x14001282965, 0x40861, {kw_masks.data() + 12867, 4}, 0x140013E6965},
+    {0x404140002E297D, 0x40861, {kw_masks.data() + 12871, 5}, 0x404140013E697D},
+    {0x14002302871, 0x40861, {kw_masks.data() + 12876, 3}, 0x140033E6875},
+    {0x140002E29EB, 0x40861, {kw_masks.data() + 12879, 5}, 0x140013E69EF},
+    {0x40014000362969, 0x40861, {kw_masks.data() + 12884, 4}, 0x400140013E696D},
+    {0x14000283971, 0x40861, {kw_masks.data() + 12888, 3}, 0x140013E7975},
+    {0x14000382861, 0x40861, {kw_masks.data() + 12891, 3}, 0x140013E6865},
+    {0x4140005C2961, 0x40861, {kw_masks.data() + 12894, 4}, 0x4140015E6965},
+    {0x14000045861, 0x40861, {kw_masks.data() + 12898, 3}, 0x140011E7865},
+    {0x14000244C61, 0x40861, {kw_masks.data() + 12901, 3}, 0x140013E6C65},
+    {0x14001003871, 0x40861, {kw_masks.data() + 12904, 3}, 0x140011E7875},
+    {0x14001085871, 0x40861, {kw_masks.data() + 12907, 3}, 0x140011E7875},
+    {0x140001E49E5, 0x40861, {kw_masks.data() + 12910, 4}, 0x140011E69E5},
+    {0x14002001963, 0x40861, {kw_masks.data() + 12914, 3}, 0x140031E7967},
+    {0x14002401973, 0x40861, {kw_masks.data() + 12917, 3}, 0x140035E7977},
+    {0x14000002879, 0x40861, {kw_masks.data() + 12920, 3}, 0x1400034697B},
+    {0x140000C686D, 0x40861, {kw_masks.data() + 12923, 3}, 0x140003C696F},
+    {0x14000440871, 0x40861, {kw_masks.data() + 12926, 3}, 0x1400074697B},
+    {0x1000014A940, 0x81081, {kw_masks.data() + 12929, 3}, 0x100001CB9C9},
+    {0x200000000C2891, 0x81081, {kw_masks.data() + 12932, 6}, 0x200000000CF9D1},
+    {0x110811, 0x81081, {kw_masks.data() + 12938, 3}, 0x1D39D1},
+    {0x200000000A20D1, 0x81081, {kw_masks.data() + 12941, 6}, 0x200000000E79D5},
+    {0x100002A2915, 0x81081, {kw_masks.data() + 12947, 9}, 0x100002EFDB7},
+    {0x80918, 0x81081, {kw_masks.data() + 12956, 1}, 0x81999},
+    {0x10000024821, 0x81081, {kw_masks.data() + 12957, 6}, 0x100013F79F1},
+    {0x8F814, 0x81081, {kw_masks.data() + 12963, 1}, 0x8F895},
+    {0x100000AA939, 0x81081, {kw_masks.data() + 12964, 2}, 0x100000AB9B9},
+    {0x100008E0190, 0x81081, {kw_masks.data() + 12966, 4}, 0x100009F39B1},
+    {0x100008E6198, 0x81081, {kw_masks.data() + 12970, 4}, 0x100008E7199},
+    {0x100010C9010, 0x81081, {kw_masks.data() + 12974, 5}, 0x100011EF995},
+    {0xA3114, 0x81081, {kw_masks.data() + 12979, 9}, 0x14EF9FD},
+    {0x2803, 0x81081, {kw_masks.data() + 12988, 6}, 0x4A3DFF},
+    {0x10000087830, 0x81081, {kw_masks.data() + 12994, 5}, 0x100000EF9B7},
+    {0x10000087811, 0x81081, {kw_masks.data() + 12999, 3}, 0x10000087891},
+    {0x100000C7831, 0x81081, {kw_masks.data() + 13002, 2}, 0x100000C78B1},
+    {0x100000E7117, 0x81081, {kw_masks.data() + 13004, 6}, 0x100001E7997},
+    {0x100000E711F, 0x81081, {kw_masks.data() + 13010, 4}, 0x100000E719F},
+    {0x100000E7917, 0x81081, {kw_masks.data() + 13014, 3}, 0x100000E7997},
+    {0x1000002E038, 0x81081, {kw_masks.data() + 13017, 6}, 0x400100000FF8BB},
+    {0x200100011AE00D, 0x81081, {kw_masks.data() + 13023, 5}, 0x200100011EF9CD},
+    {0x200100011AE00D, 0x81081, {kw_masks.data() + 13028, 3}, 0x200100011EF1CD},
+    {0x200100011E7101, 0x81081, {kw_masks.data() + 13031, 5}, 0x200100011E71D5},
+    {0x10000143140, 0x81081, {kw_masks.data() + 13036, 3}, 0x100001E31C7},
+    {0x2000000016F900, 0x81081, {kw_masks.data() + 13039, 5}, 0x200000001EF9C1},
+    {0x100001CC808, 0x81081, {kw_masks.data() + 13044, 2}, 0x100001CD889},
+    {0x10000246989, 0x81081, {kw_masks.data() + 13046, 4}, 0x100003E7DD9},
+    {0x100001C3110, 0x81081, {kw_masks.data() + 13050, 2}, 0x100001C3191},
+    {0x100000EC511, 0x81081, {kw_masks.data() + 13052, 3}, 0x100000ED591},
+    {0x100000AE151, 0x81081, {kw_masks.data() + 13055, 7}, 0x100001EFBF5},
+    {0x100001AC813, 0x81081, {kw_masks.data() + 13062, 2}, 0x100001AD893},
+    {0x100001F4011, 0x81081, {kw_masks.data() + 13064, 6}, 0x100009F79DD},
+    {0x100001A4016, 0x81081, {kw_masks.data() + 13070, 2}, 0x100001A5097},
+    {0x100001A40A0, 0x81081, {kw_masks.data() + 13072, 2}, 0x100001A50A1},
+    {0xAE901, 0x81081, {kw_masks.data() + 13074, 2}, 0x10AF981},
+    {0x100010C2160, 0x81081, {kw_masks.data() + 13076, 2}, 0x100010C31E1},
+    {0x100000A29D1, 0x81081, {kw_masks.data() + 13078, 5}, 0x100000E79D5},
+    {0x2851, 0x81081, {kw_masks.data() + 13083, 2}, 0x1838D5},
+    {0x10000163859, 0x81081, {kw_masks.data() + 13085, 2}, 0x100001E38D9},
+    {0x1000006A9D5, 0x81081, {kw_masks.data() + 13087, 3}, 0x100000EB9D5},
+    {0x240118, 0x81081, {kw_masks.data() + 13090, 6}, 0x3ED99D},
+    {0x100002C6118, 0x81081, {kw_masks.data() + 13096, 3}, 0x100002C7199},
+    {0x28811, 0x81081, {kw_masks.data() + 13099, 1}, 0xA9891},
+    {0x100000AE811, 0x81081, {kw_masks.data() + 13100, 2}, 0x100000AF891},
+    {0x1000000694D, 0x81081, {kw_masks.data() + 13102, 6}, 0x10000597BDD},
+    {0x10000024945, 0x81081, {kw_masks.data() + 13108, 3}, 0x100003E7BDD},
+    {0xE6114, 0x81081, {kw_masks.data() + 13111, 4}, 0xEF195},
+    {0x106100, 0x81081, {kw_masks.data() + 13115, 4}, 0x1CF995},
+    {0xA2951, 0x81081, {kw_masks.data() + 13119, 2}, 0x1E39D5},
+    {0x100001A695B, 0x81081, {kw_masks.data() + 13121, 3}, 0x100001E79DF},
+    {0x100000AA951, 0x81081, {kw_masks.data() + 13124, 2}, 0x100000AB9D1},
+    {0x100001A6955, 0x81081, {kw_masks.data() + 13126, 2}, 0x100001A79D5},
+    {0x100001E2975, 0x81081, {kw_masks.data() + 13128, 2}, 0x100001E39F5},
+    {0x100003A7951, 0x81081, {kw_masks.data() + 13130, 2}, 0x100003A79D1},
+    {0x100004E6D55, 0x81081, {kw_masks.data() + 13132, 2}, 0x100004E7DD5},
+    {0x100005E6D55, 0x81081, {kw_masks.data() + 13134, 3}, 0x100005E7DD5},
+    {0x100005E6D55, 0x81081, {kw_masks.data() + 13137, 3}, 0x100005E7DD5},
+    {0xA40B0, 0x81081, {kw_masks.data() + 13140, 2}, 0xA59F5},
+    {0x140017, 0x81081, {kw_masks.data() + 13142, 2}, 0x1C59D7},
+    {0xA4101, 0x81081, {kw_masks.data() + 13144, 1}, 0xA5181},
+    {0xAE100, 0x81081, {kw_masks.data() + 13145, 2}, 0x10AF981},
+    {0x100001C7108, 0x81081, {kw_masks.data() + 13147, 4}, 0x100001E71CF},
+    {0x840014, 0x81081, {kw_masks.data() + 13151, 1}, 0x8C1095},
+    {0x100000AF154, 0x81081, {kw_masks.data() + 13152, 2}, 0x100000AF1D5},
+    {0x85194, 0x81081, {kw_masks.data() + 13154, 1}, 0x85195},
+    {0x100000AC919, 0x81081, {kw_masks.data() + 13155, 10}, 0x100016EF9BF},
+    {0x100002E0918, 0x81081, {kw_masks.data() + 13165, 3}, 0x100032E1999},
+    {0x100032E2919, 0x81081, {kw_masks.data() + 13168, 5}, 0x100032EF999},
+    {0x10000642111, 0x81081, {kw_masks.data() + 13173, 4}, 0x100007E39D5},
+    {0x100005AC09D, 0x81081, {kw_masks.data() + 13177, 2}, 0x100005AD09D},
+    {0x10000086918, 0x81081, {kw_masks.data() + 13179, 2}, 0x10000087999},
+    {0x100001C3918, 0x81081, {kw_masks.data() + 13181, 2}, 0x100001C3999},
+    {0x100011DD915, 0x81081, {kw_masks.data() + 13183, 4}, 0x100011DD995},
+    {0x100011DF915, 0x81081, {kw_masks.data() + 13187, 3}, 0x100011DF995},
+    {0x100019BD911, 0x81081, {kw_masks.data() + 13190, 6}, 0x100019FF9D5},
+    {0x100019BF917, 0x81081, {kw_masks.data() + 13196, 5}, 0x100019BF997},
+    {0x100019BF995, 0x81081, {kw_masks.data() + 13201, 5}, 0x100019BF995},
+    {0x100001D5811, 0x81081, {kw_masks.data() + 13206, 5}, 0x100019FF995},
+    {0x100001D7811, 0x81081, {kw_masks.data() + 13211, 3}, 0x100001D7891},
+    {0x100001F5811, 0x81081, {kw_masks.data() + 13214, 2}, 0x100001F5891},
+    {0x100000A8918, 0x81081, {kw_masks.data() + 13216, 2}, 0x100000A9999},
+    {0x10000110811, 0x81081, {kw_masks.data() + 13218, 4}, 0x100011D1995},
+    {0x10000396911, 0x81081, {kw_masks.data() + 13222, 1}, 0x10000397991},
+    {0x100013B7955, 0x81081, {kw_masks.data() + 13223, 2}, 0x100013B79D5},
+    {0x100004A213E, 0x81081, {kw_masks.data() + 13225, 2}, 0x100004A31BF},
+    {0x100000ED995, 0x81081, {kw_masks.data() + 13227, 2}, 0x100000ED995},
+    {0x100011B5955, 0x81081, {kw_masks.data() + 13229, 2}, 0x100011B59D5},
+    {0x100019BD9D1, 0x81081, {kw_masks.data() + 13231, 6}, 0x100019FF9D1},
+    {0x100019BD971, 0x81081, {kw_masks.data() + 13237, 3}, 0x100019BD9F1},
+    {0x10000156815, 0x81081, {kw_masks.data() + 13240, 2}, 0x100001D7895},
+    {0x10000156815, 0x81081, {kw_masks.data() + 13242, 2}, 0x100001D7895},
+    {0x10000132951, 0x81081, {kw_masks.data() + 13244, 5}, 0x100011F39D5},
+    {0x100001B6951, 0x81081, {kw_masks.data() + 13249, 3}, 0x100019BF9D1},
+    {0x100000EE01C, 0x81081, {kw_masks.data() + 13252, 1}, 0x100000EF09D},
+    {0xC1111, 0x81081, {kw_masks.data() + 13253, 2}, 0xEF19D},
+    {0x100001B6951, 0x81081, {kw_masks.data() + 13255, 1}, 0x100001B79D1},
+    {0x100001F0811, 0x81081, {kw_masks.data() + 13256, 2}, 0x100001F1891},
+    {0x10000194819, 0x81081, {kw_masks.data() + 13258, 4}, 0x100001B79F9},
+    {0x1000119693B, 0x81081, {kw_masks.data() + 13262, 2}, 0x100011979BB},
+    {0x1000116101B, 0x81081, {kw_masks.data() + 13264, 1}, 0x100011E109B},
+    {0x100001D6919, 0x81081, {kw_masks.data() + 13265, 2}, 0x100001D7999},
+    {0x10000196811, 0x81081, {kw_masks.data() + 13267, 4}, 0x10001197991},
+    {0x1000008691D, 0x81081, {kw_masks.data() + 13271, 4}, 0x100008AF99D},
+    {0x1000008691D, 0x81081, {kw_masks.data() + 13275, 2}, 0x1000008799D},
+    {0x100013F2915, 0x81081, {kw_masks.data() + 13277, 4}, 0x100013F3995},
+    {0x200100001F6891, 0x81081, {kw_masks.data() + 13281, 7}, 0x200100011F7991},
+    {0x200100001B68D1, 0x81081, {kw_masks.data() + 13288, 7}, 0x200100011F79D1},
+    {0x200100003F6891, 0x81081, {kw_masks.data() + 13295, 7}, 0x200100013F7995},
+    {0x200100003B68D1, 0x81081, {kw_masks.data() + 13302, 7}, 0x200100013F79D5},
+    {0x200100001D6893, 0x81081, {kw_masks.data() + 13309, 5}, 0x200100001D7893},
+    {0x200100001B68D3, 0x81081, {kw_masks.data() + 13314, 5}, 0x200100001B78D3},
+    {0x200100001C3895, 0x81081, {kw_masks.data() + 13319, 6}, 0x200100011D3995},
+    {0x200100001A30D5, 0x81081, {kw_masks.data() + 13325, 6}, 0x200100011F39D5},
+    {0x482012, 0x81081, {kw_masks.data() + 13331, 3}, 0x59B9B7},
+    {0x10000396911, 0x81081, {kw_masks.data() + 13334, 2}, 0x10000397991},
+    {0x200100000C6891, 0x81081, {kw_masks.data() + 13336, 6}, 0x200100011D7995},
+    {0x200100000A60D1, 0x81081, {kw_masks.data() + 13342, 6}, 0x200100011F79D5},
+    {0x200100001F6991, 0x81081, {kw_masks.data() + 13348, 5}, 0x200100001F7991},
+    {0x200100001B69D1, 0x81081, {kw_masks.data() + 13353, 5}, 0x200100001B79D1},
+    {0x200100003F6991, 0x81081, {kw_masks.data() + 13358, 3}, 0x200100003F7991},
+    {0x200100003B29D1, 0x81081, {kw_masks.data() + 13361, 6}, 0x200100013F39D5},
+    {0x200100003F6991, 0x81081, {kw_masks.data() + 13367, 5}, 0x200100003F7991},
+    {0x200100003B69D1, 0x81081, {kw_masks.data() + 13372, 5}, 0x200100003B79D1},
+    {0x200100000E68D1, 0x81081, {kw_masks.data() + 13377, 3}, 0x200100000E78D1},
+    {0x200100000E68D1, 0x81081, {kw_masks.data() + 13380, 3}, 0x200100000E78D1},
+    {0x200100000E69D1, 0x81081, {kw_masks.data() + 13383, 5}, 0x200100000E79D1},
+    {0x200100000E69D1, 0x81081, {kw_masks.data() + 13388, 5}, 0x200100000E79D1},
+    {0x6801C, 0x81081, {kw_masks.data() + 13393, 7}, 0x4EFD9D},
+    {0x14001C, 0x81081, {kw_masks.data() + 13400, 7}, 0x1EF5DD},
+    {0x100001FC81D, 0x81081, {kw_masks.data() + 13407, 2}, 0x100001FD89D},
+    {0x100001F481D, 0x81081, {kw_masks.data() + 13409, 2}, 0x100001F589D},
+    {0x100003FE91D, 0x81081, {kw_masks.data() + 13411, 2}, 0x100003FF99D},
+    {0x100003F691D, 0x81081, {kw_masks.data() + 13413, 2}, 0x100003F799D},
+    {0x100000EE01C, 0x81081, {kw_masks.data() + 13415, 3}, 0x100000EF09D},
+    {0x100001C601C, 0x81081, {kw_masks.data() + 13418, 6}, 0x100001EF19D},
+    {0x100001C4032, 0x81081, {kw_masks.data() + 13424, 4}, 0x100001C79BF},
+    {0x1E8010, 0x81081, {kw_masks.data() + 13428, 5}, 0x1EF99D},
+    {0x100001C6033, 0x81081, {kw_masks.data() + 13433, 2}, 0x100001C70B3},
+    {0x100001EE031, 0x81081, {kw_masks.data() + 13435, 2}, 0x100001EF0B1},
+    {0x100001D0813, 0x81081, {kw_masks.data() + 13437, 2}, 0x100001D1893},
+    {0x100001F8811, 0x81081, {kw_masks.data() + 13439, 4}, 0x100011F9995},
+    {0x100001F69B3, 0x81081, {kw_masks.data() + 13443, 4}, 0x100001F79B3},
+    {0x100001FE9B1, 0x81081, {kw_masks.data() + 13447, 4}, 0x100001FF9B1},
+    {0x100005D69B3, 0x81081, {kw_masks.data() + 13451, 3}, 0x100005D79B3},
+    {0x100005FE9B1, 0x81081, {kw_masks.data() + 13454, 3}, 0x100005FF9B1},
+    {0x1C1910, 0x81081, {kw_masks.data() + 13457, 1}, 0x1C1991},
+    {0x100001CF915, 0x81081, {kw_masks.data() + 13458, 2}, 0x100001CF995},
+    {0x100001C7910, 0x81081, {kw_masks.data() + 13460, 5}, 0x100001C79DB},
+    {0x10000175171, 0x81081, {kw_masks.data() + 13465, 2}, 0x100001F51F1},
+    {0x10000176971, 0x81081, {kw_masks.data() + 13467, 2}, 0x100001F79F1},
+    {0x100001F5971, 0x81081, {kw_masks.data() + 13469, 3}, 0x100001F59F1},
+    {0x100001F6971, 0x81081, {kw_masks.data() + 13472, 3}, 0x100001F79F1},
+    {0x10000178015, 0x81081, {kw_masks.data() + 13475, 2}, 0x100001F9095},
+    {0x10000178015, 0x81081, {kw_masks.data() + 13477, 2}, 0x100001F9095},
+    {0x1000016891C, 0x81081, {kw_masks.data() + 13479, 8}, 0x100003EF9DD},
+    {0x1000016391C, 0x81081, {kw_masks.data() + 13487, 5}, 0x100011E79BD},
+    {0x100000E191C, 0x81081, {kw_masks.data() + 13492, 8}, 0x100003EF9DD},
+    {0x1000026699D, 0x81081, {kw_masks.data() + 13500, 5}, 0x200100002E7D9D},
+    {0x100000AC91D, 0x81081, {kw_masks.data() + 13505, 10}, 0x10000BAF9DD},
+    {0x100000AE95D, 0x81081, {kw_masks.data() + 13515, 3}, 0x100000AF9DD},
+    {0x100000ECD1D, 0x81081, {kw_masks.data() + 13518, 3}, 0x100000EDD9D},
+    {0x1000017091D, 0x81081, {kw_masks.data() + 13521, 8}, 0x100013F799F},
+    {0x1000006099D, 0x81081, {kw_masks.data() + 13529, 2}, 0x100000E199D},
+    {0x10000178819, 0x81081, {kw_masks.data() + 13531, 4}, 0x200100001FFD9D},
+    {0x10000173119, 0x81081, {kw_masks.data() + 13535, 4}, 0x200100001F7D9F},
+    {0x100001F1119, 0x81081, {kw_masks.data() + 13539, 2}, 0x100001F1199},
+    {0x100001FC019, 0x81081, {kw_masks.data() + 13541, 3}, 0x100001FD099},
+    {0x100000A05C5, 0x81081, {kw_masks.data() + 13544, 7}, 0x100013EFDDF},
+    {0x10000080C35, 0x81081, {kw_masks.data() + 13551, 9}, 0x100013E7DBD},
+    {0x1000048640D, 0x81081, {kw_masks.data() + 13560, 3}, 0x1000048F48D},
+    {0x10000188405, 0x81081, {kw_masks.data() + 13563, 6}, 0x100001CDCB7},
+    {0xE6111, 0x81081, {kw_masks.data() + 13569, 2}, 0x1E719D},
+    {0x45818, 0x81081, {kw_masks.data() + 13571, 1}, 0xC5899},
+    {0x1A0010, 0x81081, {kw_masks.data() + 13572, 7}, 0x13E79F9},
+    {0x64034, 0x81081, {kw_masks.data() + 13579, 1}, 0xE50B5},
+    {0x100003EA9D7, 0x81081, {kw_masks.data() + 13580, 5}, 0x100003EB9D7},
+    {0x100003E69DF, 0x81081, {kw_masks.data() + 13585, 5}, 0x100003E79DF},
+    {0x100002EE018, 0x81081, {kw_masks.data() + 13590, 3}, 0x100002EF099},
+    {0x100001A6010, 0x81081, {kw_masks.data() + 13593, 2}, 0x100001A7091},
+    {0x100000E603C, 0x81081, {kw_masks.data() + 13595, 3}, 0x100000E70BD},
+    {0x100003E69DF, 0x81081, {kw_masks.data() + 13598, 6}, 0x100003E79DF},
+    {0x100001EE91D, 0x81081, {kw_masks.data() + 13604, 6}, 0x100001EF99D},
+    {0x100001E691D, 0x81081, {kw_masks.data() + 13610, 6}, 0x100001EF99D},
+    {0x1000016F863, 0x81081, {kw_masks.data() + 13616, 2}, 0x100001EF8E3},
+    {0x100001EF947, 0x81081, {kw_masks.data() + 13618, 3}, 0x100001EF9C7},
+    {0x100001FF873, 0x81081, {kw_masks.data() + 13621, 3}, 0x100001FF8F3},
+    {0x100001FF957, 0x81081, {kw_masks.data() + 13624, 4}, 0x100001FF9D7},
+    {0x26941, 0x81081, {kw_masks.data() + 13628, 1}, 0xA79C1},
+    {0x10000005171, 0x81081, {kw_masks.data() + 13629, 1}, 0x100000851F1},
+    {0x189901, 0x81081, {kw_masks.data() + 13630, 1}, 0x189981},
+    {0x100009A73D5, 0x81081, {kw_masks.data() + 13631, 6}, 0x200100009F7BFD},
+    {0xA2915, 0x81081, {kw_masks.data() + 13637, 1}, 0xA3995},
+    {0x824000, 0x81081, {kw_masks.data() + 13638, 1}, 0x8A5081},
+    {0x2009, 0x81081, {kw_masks.data() + 13639, 1}, 0x83089},
+    {0x26000, 0x81081, {kw_masks.data() + 13640, 1}, 0xA7081},
+    {0x100004A29D5, 0x81081, {kw_masks.data() + 13641, 3}, 0x100004A39D5},
+    {0x100000A29D1, 0x81081, {kw_masks.data() + 13644, 4}, 0x200100000E39DD},
+    {0x2001000102694D, 0x81081, {kw_masks.data() + 13648, 2}, 0x200100010A79CD},
+    {0x20010001026945, 0x81081, {kw_masks.data() + 13650, 6}, 0x200100011E7BCD},
+    {0x200100010E6115, 0x81081, {kw_masks.data() + 13656, 8}, 0x200100010EF9DD},
+    {0x20010001126101, 0x81081, {kw_masks.data() + 13664, 8}, 0x200100011EF9DD},
+    {0x100000AF119, 0x81081, {kw_masks.data() + 13672, 2}, 0x100000AF199},
+    {0x100000AC019, 0x81081, {kw_masks.data() + 13674, 2}, 0x100000AD099},
+    {0x100000EC011, 0x81081, {kw_masks.data() + 13676, 2}, 0x100000ED091},
+    {0x100002C7118, 0x81081, {kw_masks.data() + 13678, 2}, 0x100002C7199},
+    {0x100001A6B01, 0x81081, {kw_masks.data() + 13680, 5}, 0x100015AFB93},
+    {0x100001EF93D, 0x81081, {kw_masks.data() + 13685, 5}, 0x100001EF9BD},
+    {0x100001EF9FD, 0x81081, {kw_masks.data() + 13690, 5}, 0x100001EF9FD},
+    {0x100001ED93C, 0x81081, {kw_masks.data() + 13695, 3}, 0x100001ED9BD},
+    {0x100001ED1DC, 0x81081, {kw_masks.data() + 13698, 3}, 0x100001ED1DD},
+    {0x100003F0919, 0x81081, {kw_masks.data() + 13701, 3}, 0x100003F1999},
+    {0x10001124945, 0x81081, {kw_masks.data() + 13704, 2}, 0x100011A59C5},
+    {0x1000112694D, 0x81081, {kw_masks.data() + 13706, 2}, 0x100011A79CD},
+    {0x100001C481A, 0x81081, {kw_masks.data() + 13708, 2}, 0x100001C589B},
+    {0x100001EC81A, 0x81081, {kw_masks.data() + 13710, 2}, 0x100001ED89B},
+    {0x100001E691E, 0x81081, {kw_masks.data() + 13712, 5}, 0x100001EF99F},
+    {0x1000010691A, 0x81081, {kw_masks.data() + 13717, 2}, 0x1000018799B},
+    {0xAC5A4, 0x81081, {kw_masks.data() + 13719, 3}, 0xEF5B5},
+    {0x100001BE819, 0x81081, {kw_masks.data() + 13722, 2}, 0x100001BF899},
+    {0x200100004C6999, 0x81081, {kw_masks.data() + 13724, 3}, 0x200100004C7999},
+    {0x200100004A61D9, 0x81081, {kw_masks.data() + 13727, 3}, 0x200100004A71D9},
+    {0x200100013E3895, 0x81081, {kw_masks.data() + 13730, 7}, 0x200100013F3995},
+    {0x200100013A30D5, 0x81081, {kw_masks.data() + 13737, 7}, 0x200100013F39D5},
+    {0x200100001F68D1, 0x81081, {kw_masks.data() + 13744, 4}, 0x200100001F78D1},
+    {0x200100001F68D1, 0x81081, {kw_masks.data() + 13748, 4}, 0x200100001F78D1},
+    {0x200100001F6891, 0x81081, {kw_masks.data() + 13752, 3}, 0x200100001F7891},
+    {0x200100001B68D1, 0x81081, {kw_masks.data() + 13755, 3}, 0x200100001B78D1},
+    {0x100001FC81D, 0x81081, {kw_masks.data() + 13758, 2}, 0x100001FD89D},
+    {0x100001F481D, 0x81081, {kw_masks.data() + 13760, 2}, 0x100001F589D},
+    {0x100001FE81D, 0x81081, {kw_masks.data() + 13762, 4}, 0x100001FF89D},
+    {0x100001F681D, 0x81081, {kw_masks.data() + 13766, 4}, 0x100001F789D},
+    {0x100001F7971, 0x81081, {kw_masks.data() + 13770, 4}, 0x100001F79F1},
+    {0x100001F6971, 0x81081, {kw_masks.data() + 13774, 4}, 0x100001F79F1},
+    {0x100001F7971, 0x81081, {kw_masks.data() + 13778, 4}, 0x100001F79F1},
+    {0x100001F6971, 0x81081, {kw_masks.data() + 13782, 4}, 0x100001F79F1},
+    {0x200100003D6993, 0x81081, {kw_masks.data() + 13786, 5}, 0x200100003D7993},
+    {0x200100003B69D3, 0x81081, {kw_masks.data() + 13791, 5}, 0x200100003B79D3},
+    {0x100003FE91F, 0x81081, {kw_masks.data() + 13796, 4}, 0x100003FF99F},
+    {0x100003D691F, 0x81081, {kw_masks.data() + 13800, 4}, 0x100003D799F},
+    {0x100001EF863, 0x81081, {kw_masks.data() + 13804, 3}, 0x100001EF8E3},
+    {0x100001EF95F, 0x81081, {kw_masks.data() + 13807, 5}, 0x100001EF9DF},
+    {0x100001FF873, 0x81081, {kw_masks.data() + 13812, 4}, 0x100001FF8F3},
+    {0x100001FF95F, 0x81081, {kw_masks.data() + 13816, 10}, 0x100011FF9DF},
+    {0x100002E8915, 0x81081, {kw_masks.data() + 13826, 3}, 0x100002E9995},
+    {0x100020EF999, 0x81081, {kw_masks.data() + 13829, 3}, 0x100020EF999},
+    {0x100001EE9D9, 0x81081, {kw_masks.data() + 13832, 5}, 0x100001EF9DD},
+    {0x100004EE9D9, 0x81081, {kw_masks.data() + 13837, 5}, 0x100004EF9DD},
+    {0x100024E7DF1, 0x81081, {kw_masks.data() + 13842, 4}, 0x100024E7DF1},
+    {0x100026E7DBF, 0x81081, {kw_masks.data() + 13846, 6}, 0x100026E7DBF},
+    {0x100026E7DBF, 0x81081, {kw_masks.data() + 13852, 7}, 0x100026E7DBF},
+    {0x100006879BB, 0x81081, {kw_masks.data() + 13859, 3}, 0x100006879BB},
+    {0x100006A79B3, 0x81081, {kw_masks.data() + 13862, 2}, 0x100006A79B3},
+    {0x100006E79B3, 0x81081, {kw_masks.data() + 13864, 3}, 0x100006E79B3},
+    {0x100005A79BB, 0x81081, {kw_masks.data() + 13867, 2}, 0x100005A79BB},
+    {0x100024E7DB1, 0x81081, {kw_masks.data() + 13869, 4}, 0x100024E7DB1},
+    {0x100024E6DD5, 0x81081, {kw_masks.data() + 13873, 4}, 0x100024E7DD5},
+    {0x100026E6DBF, 0x81081, {kw_masks.data() + 13877, 6}, 0x100026E7DBF},
+    {0x100026E7DBF, 0x81081, {kw_masks.data() + 13883, 7}, 0x100026E7DBF},
+    {0x100006E6197, 0x81081, {kw_masks.data() + 13890, 2}, 0x100006E7197},
+    {0x100006E7997, 0x81081, {kw_masks.data() + 13892, 3}, 0x100006E7997},
+    {0x100020EF1D3, 0x81081, {kw_masks.data() + 13895, 3}, 0x100020EF1D3},
+    {0x100000E79D9, 0x81081, {kw_masks.data() + 13898, 3}, 0x100000E79D9},
+    {0x100004E79D5, 0x81081, {kw_masks.data() + 13901, 4}, 0x100004E79D5},
+    {0x12A91D, 0x81081, {kw_masks.data() + 13905, 2}, 0x1AF9DD},
+    {0x100001CE012, 0x81081, {kw_masks.data() + 13907, 2}, 0x100001CF093},
+    {0x100001EE010, 0x81081, {kw_masks.data() + 13909, 2}, 0x100001EF091},
+    {0x200100000E99FB, 0x81081, {kw_masks.data() + 13911, 4}, 0x200100000E99FB},
+    {0x200100000E99DB, 0x81081, {kw_masks.data() + 13915, 4}, 0x200100000E99DB},
+    {0x100004E6198, 0x81081, {kw_masks.data() + 13919, 2}, 0x100004E7199},
+    {0x100003EE95E, 0x81081, {kw_masks.data() + 13921, 4}, 0x100003EF9DF},
+    {0x100001EE95C, 0x81081, {kw_masks.data() + 13925, 3}, 0x100001EF9DD},
+    {0x100026E6D97, 0x81081, {kw_masks.data() + 13928, 4}, 0x100026E7D97},
+    {0x100000E79DD, 0x81081, {kw_masks.data() + 13932, 4}, 0x100001EF9DD},
+    {0x10000246948, 0x81081, {kw_masks.data() + 13936, 2}, 0x100002C79C9},
+    {0x100000879FD, 0x81081, {kw_masks.data() + 13938, 4}, 0x100004879FD},
+    {0x1000017695D, 0x81081, {kw_masks.data() + 13942, 4}, 0x100009F79DF},
+    {0x1000017495D, 0x81081, {kw_masks.data() + 13946, 4}, 0x100009F59DF},
+    {0x100004A719D, 0x81081, {kw_masks.data() + 13950, 4}, 0x100004A719D},
+    {0x10000486189, 0x81081, {kw_masks.data() + 13954, 1}, 0x10000487189},
+    {0x100005EF979, 0x81081, {kw_masks.data() + 13955, 3}, 0x100005EF9F9},
+    {0x100004A69DC, 0x81081, {kw_masks.data() + 13958, 5}, 0x100005AFDDF},
+    {0x100005AE9BC, 0x81081, {kw_masks.data() + 13963, 5}, 0x100005EF9BD},
+    {0x100001A6B30, 0x81081, {kw_masks.data() + 13968, 3}, 0x100001A7BB1},
+    {0x100001A63D0, 0x81081, {kw_masks.data() + 13971, 3}, 0x100001A73D1},
+    {0x100001A6B30, 0x81081, {kw_masks.data() + 13974, 3}, 0x100001A7BB1},
+    {0x100001A8C55, 0x81081, {kw_masks.data() + 13977, 3}, 0x100001A9CD5},
+    {0x100004A6C5D, 0x81081, {kw_masks.data() + 13980, 3}, 0x100004A7CDD},
+    {0x100001E69FB, 0x81081, {kw_masks.data() + 13983, 4}, 0x100001E79FB},
+    {0x100000A2DFD, 0x81081, {kw_masks.data() + 13987, 3}, 0x100000A3DFD},
+    {0x10000189931, 0x81081, {kw_masks.data() + 13990, 2}, 0x100001899B1},
+    {0x100000A6DC5, 0x81081, {kw_masks.data() + 13992, 3}, 0x100000A7DC5},
+    {0x10000086C75, 0x81081, {kw_masks.data() + 13995, 3}, 0x10000087CF5},
+    {0x100007ACD97, 0x81081, {kw_masks.data() + 13998, 6}, 0x100007AFD9F},
+    {0x100033A69DB, 0x81081, {kw_masks.data() + 14004, 4}, 0x100033A79DB},
+    {0x200100006C719D, 0x81081, {kw_masks.data() + 14008, 7}, 0x200100006EF99D},
+    {0x200100006E7DBD, 0x81081, {kw_masks.data() + 14015, 10}, 0x200100006EFDBD},
+    {0x200100006E75DD, 0x81081, {kw_masks.data() + 14025, 11}, 0x200100006EFDDF},
+    {0x100005F0DBD, 0x81081, {kw_masks.data() + 14036, 8}, 0x100015FDDBD},
+    {0x100005F05DD, 0x81081, {kw_masks.data() + 14044, 9}, 0x100015FDDDF},
+    {0x100005F1DB7, 0x81081, {kw_masks.data() + 14053, 7}, 0x100005F7DF7},
+    {0x100005F1DD7, 0x81081, {kw_masks.data() + 14060, 7}, 0x100005F7DD7},
+    {0x100000A3DF7, 0x81081, {kw_masks.data() + 14067, 7}, 0x100001F7DF7},
+    {0x100000A3DD7, 0x81081, {kw_masks.data() + 14074, 7}, 0x100001F7DD7},
+    {0x100001A7DFF, 0x81081, {kw_masks.data() + 14081, 7}, 0x100003A7DFF},
+    {0x100001A7DDF, 0x81081, {kw_masks.data() + 14088, 7}, 0x100003A7DDF},
+    {0x100004E5DB7, 0x81081, {kw_masks.data() + 14095, 6}, 0x100004E5DB7},
+    {0x100004E5DD7, 0x81081, {kw_masks.data() + 14101, 6}, 0x100004E5DD7},
+    {0x100000EB9BD, 0x81081, {kw_masks.data() + 14107, 5}, 0x100001EF9FD},
+    {0x100000EB9FD, 0x81081, {kw_masks.data() + 14112, 5}, 0x100001EF9FD},
+    {0x100002A991F, 0x81081, {kw_masks.data() + 14117, 4}, 0x100002A999F},
+    {0x100020CE101, 0x81081, {kw_masks.data() + 14121, 2}, 0x100020CF181},
+    {0x1000308E915, 0x81081, {kw_masks.data() + 14123, 3}, 0x1000308F995},
+    {0x100015A0DB7, 0x81081, {kw_masks.data() + 14126, 4}, 0x100015A1DB7},
+    {0x100015A0DD7, 0x81081, {kw_masks.data() + 14130, 4}, 0x100015A1DD7},
+    {0x100004EA9B1, 0x81081, {kw_masks.data() + 14134, 3}, 0x100004EB9B1},
+    {0x100004EA1D1, 0x81081, {kw_masks.data() + 14137, 3}, 0x100004EB1D1},
+    {0x100020A7D77, 0x81081, {kw_masks.data() + 14140, 4}, 0x100020A7DF7},
+    {0x100020A75D7, 0x81081, {kw_masks.data() + 14144, 4}, 0x100020A75D7},
+    {0x100020A6D7F, 0x81081, {kw_masks.data() + 14148, 4}, 0x100020A7DFF},
+    {0x100020A65DF, 0x81081, {kw_masks.data() + 14152, 4}, 0x100020A75DF},
+    {0x100005F2DBF, 0x81081, {kw_masks.data() + 14156, 4}, 0x100005F3DBF},
+    {0x100005F25DF, 0x81081, {kw_masks.data() + 14160, 4}, 0x100005F35DF},
+    {0x100005FEDB7, 0x81081, {kw_masks.data() + 14164, 6}, 0x100005FFDB7},
+    {0x100005F75D7, 0x81081, {kw_masks.data() + 14170, 6}, 0x100005F75D7},
+    {0x100005F7DB7, 0x81081, {kw_masks.data() + 14176, 6}, 0x100005F7DB7},
+    {0x100005FE5D7, 0x81081, {kw_masks.data() + 14182, 6}, 0x100005FF5D7},
+    {0x100004A6DFF, 0x81081, {kw_masks.data() + 14188, 4}, 0x100004A7DFF},
+    {0x100004A6DDF, 0x81081, {kw_masks.data() + 14192, 4}, 0x100004A7DDF},
+    {0x200100000E2CB7, 0x81081, {kw_masks.data() + 14196, 5}, 0x200100000E3CB7},
+    {0x200100000A25D7, 0x81081, {kw_masks.data() + 14201, 5}, 0x200100000A35D7},
+    {0x200100001A6CFF, 0x81081, {kw_masks.data() + 14206, 6}, 0x200100001A7CFF},
+    {0x200100001E6DDF, 0x81081, {kw_masks.data() + 14212, 6}, 0x200100001E7DDF},
+    {0x100000E4DB7, 0x81081, {kw_masks.data() + 14218, 5}, 0x100000E5DB7},
+    {0x100000E4DD7, 0x81081, {kw_masks.data() + 14223, 5}, 0x100000E5DD7},
+    {0x1000008603C, 0x81081, {kw_masks.data() + 14228, 2}, 0x100000870BD},
+    {0x100022A2955, 0x81081, {kw_masks.data() + 14230, 3}, 0x100022A39D5},
+    {0x100001EF979, 0x81081, {kw_masks.data() + 14233, 4}, 0x100001EF9F9},
+    {0x100007F29D1, 0x81081, {kw_masks.data() + 14237, 4}, 0x100007F39D1},
+    {0x100005E79D9, 0x81081, {kw_masks.data() + 14241, 4}, 0x100005E79D9},
+    {0x100004C29D9, 0x81081, {kw_masks.data() + 14245, 2}, 0x100004C39D9},
+    {0x10000182855, 0x81081, {kw_masks.data() + 14247, 2}, 0x100001838D5},
+    {0x100000EE9F5, 0x81081, {kw_masks.data() + 14249, 4}, 0x100000EF9F5},
+    {0x1000016E9D5, 0x81081, {kw_masks.data() + 14253, 4}, 0x100001EF9D5},
+    {0x100001A2859, 0x81081, {kw_masks.data() + 14257, 2}, 0x100001A38D9},
+    {0x10000262859, 0x81081, {kw_masks.data() + 14259, 2}, 0x100002E38D9},
+    {0x100005A29DB, 0x81081, {kw_masks.data() + 14261, 2}, 0x100005A39DB},
+    {0x100007E29DB, 0x81081, {kw_masks.data() + 14263, 3}, 0x100007E39DB},
+    {0x1000011E953, 0x81081, {kw_masks.data() + 14266, 4}, 0x1000019F9D3},
+    {0x1000051E95B, 0x81081, {kw_masks.data() + 14270, 4}, 0x1000059F9DB},
+    {0x100005EF9D9, 0x81081, {kw_masks.data() + 14274, 9}, 0x100005EF9D9},
+    {0x100005EF9F9, 0x81081, {kw_masks.data() + 14283, 9}, 0x100005EF9F9},
+    {0x100005EF9D9, 0x81081, {kw_masks.data() + 14292, 9}, 0x100005EF9D9},
+    {0x100005EF9F9, 0x81081, {kw_masks.data() + 14301, 9}, 0x100005EF9F9},
+    {0x100005EF9D9, 0x81081, {kw_masks.data() + 14310, 9}, 0x100005EF9D9},
+    {0x100005EF9F9, 0x81081, {kw_masks.data() + 14319, 9}, 0x100005EF9F9},
+    {0x100005EF9D9, 0x81081, {kw_masks.data() + 14328, 9}, 0x100005EF9D9},
+    {0x100005EF9F9, 0x81081, {kw_masks.data() + 14337, 9}, 0x100005EF9F9},
+    {0x100012E9018, 0x81081, {kw_masks.data() + 14346, 3}, 0x100012E9099},
+    {0x100016ED193, 0x81081, {kw_masks.data() + 14349, 3}, 0x100016ED193},
+    {0x100016ED997, 0x81081, {kw_masks.data() + 14352, 5}, 0x100016ED997},
+    {0x100016ED1D3, 0x81081, {kw_masks.data() + 14357, 5}, 0x100016ED1D3},
+    {0x100016ED9B3, 0x81081, {kw_masks.data() + 14362, 5}, 0x100016ED9B3},
+    {0x100024A6997, 0x81081, {kw_masks.data() + 14367, 3}, 0x100024A7997},
+    {0x100002A091F, 0x81081, {kw_masks.data() + 14370, 3}, 0x100002A199F},
+    {0x1000002891D, 0x81081, {kw_masks.data() + 14373, 2}, 0x100000A999D},
+    {0x1000036491C, 0x81081, {kw_masks.data() + 14375, 3}, 0x100003E599D},
+    {0x1000012A91D, 0x81081, {kw_masks.data() + 14378, 2}, 0x100001AB99D},
+    {0x100032AE9BF, 0x81081, {kw_masks.data() + 14380, 7}, 0x100032AF9BF},
+    {0x10000DED99C, 0x81081, {kw_masks.data() + 14387, 2}, 0x10000DED99D},
+    {0x200100006E6D5D, 0x81081, {kw_masks.data() + 14389, 5}, 0x200100006E7DDD},
+    {0x100005AC9D5, 0x81081, {kw_masks.data() + 14394, 4}, 0x100005AD9D5},
+    {0x100005A099E, 0x81081, {kw_masks.data() + 14398, 3}, 0x100005A199F},
+    {0x100001A091E, 0x81081, {kw_masks.data() + 14401, 2}, 0x100001A199F},
+    {0x200100000E299D, 0x81081, {kw_masks.data() + 14403, 3}, 0x200100000E399D},
+    {0x200100000A29DD, 0x81081, {kw_masks.data() + 14406, 3}, 0x200100000A39DD},
+    {0x100004E59D5, 0x81081, {kw_masks.data() + 14409, 3}, 0x100004E59D5},
+    {0x100024E6DD5, 0x81081, {kw_masks.data() + 14412, 5}, 0x100024E7DD5},
+    {0x100001769D9, 0x81081, {kw_masks.data() + 14417, 4}, 0x100001F79D9},
+    {0x100001769F9, 0x81081, {kw_masks.data() + 14421, 4}, 0x100001F79F9},
+    {0x100001F0519, 0x81081, {kw_masks.data() + 14425, 2}, 0x100001F1599},
+    {0x1000017191D, 0x81081, {kw_masks.data() + 14427, 3}, 0x100001F199D},
+    {0x10000170019, 0x81081, {kw_masks.data() + 14430, 2}, 0x100001F1099},
+    {0x100005F6319, 0x81081, {kw_masks.data() + 14432, 3}, 0x100005F7399},
+    {0x100006A69DB, 0x81081, {kw_masks.data() + 14435, 3}, 0x100006A79DB},
+    {0x100005A29DB, 0x81081, {kw_masks.data() + 14438, 2}, 0x100005A39DB},
+    {0x100000E2951, 0x81081, {kw_masks.data() + 14440, 1}, 0x100000E39D1},
+    {0x100004E79F3, 0x81081, {kw_masks.data() + 14441, 3}, 0x100004E79F3},
+    {0x100002A69F3, 0x81081, {kw_masks.data() + 14444, 4}, 0x100002A79F3},
+    {0x100002E297F, 0x81081, {kw_masks.data() + 14448, 5}, 0x100002E39FF},
+    {0x100002E29DF, 0x81081, {kw_masks.data() + 14453, 5}, 0x100002E39DF},
+    {0x10000484DB7, 0x81081, {kw_masks.data() + 14458, 4}, 0x10000485DB7},
+    {0x100004A4DF7, 0x81081, {kw_masks.data() + 14462, 4}, 0x100004A5DF7},
+    {0x10000484D17, 0x81081, {kw_masks.data() + 14466, 2}, 0x10000485D97},
+    {0x100004C1DB7, 0x81081, {kw_masks.data() + 14468, 4}, 0x100004C1DB7},
+    {0x100004E1DF7, 0x81081, {kw_masks.data() + 14472, 4}, 0x100004E1DF7},
+    {0x100005E49D1, 0x81081, {kw_masks.data() + 14476, 5}, 0x100007E59F7},
+    {0x10000164CC7, 0x81081, {kw_masks.data() + 14481, 2}, 0x100001E5CC7},
+    {0x10001482974, 0x81081, {kw_masks.data() + 14483, 3}, 0x100014839F5},
+    {0x100014A29F4, 0x81081, {kw_masks.data() + 14486, 3}, 0x100014A39F5},
+    {0x1000158697E, 0x81081, {kw_masks.data() + 14489, 4}, 0x100015879FF},
+    {0x100015A69FE, 0x81081, {kw_masks.data() + 14493, 4}, 0x100015A79FF},
+    {0x1000108F934, 0x81081, {kw_masks.data() + 14497, 5}, 0x100010CF9B5},
+    {0x100012A6130, 0x81081, {kw_masks.data() + 14502, 3}, 0x100012A71B1},
+    {0x100016A29FF, 0x81081, {kw_masks.data() + 14505, 4}, 0x100016A39FF},
+    {0x2001000018F91B, 0x81081, {kw_masks.data() + 14509, 3}, 0x2001000018F99B},
+    {0x100005F699D, 0x81081, {kw_masks.data() + 14512, 4}, 0x100005F799F},
+    {0x10000062115, 0x81081, {kw_masks.data() + 14516, 1}, 0x100000E3195},
+    {0x100001EC8BC, 0x81081, {kw_masks.data() + 14517, 2}, 0x100001ED8BD},
+    {0x100001FA959, 0x81081, {kw_masks.data() + 14519, 4}, 0x100001FB9D9},
+    {0x100007FE9DB, 0x81081, {kw_masks.data() + 14523, 6}, 0x100007FF9DB},
+    {0x100000EE91D, 0x81081, {kw_masks.data() + 14529, 3}, 0x100000EF99D},
+    {0x100000E0DD5, 0x81081, {kw_masks.data() + 14532, 4}, 0x100003F7DD5},
+    {0x10A719D, 0x81081, {kw_masks.data() + 14536, 3}, 0x10A759D},
+    {0x200100004AEDFF, 0x81081, {kw_masks.data() + 14539, 6}, 0x200100004AFDFF},
+    {0x200100004AEDFF, 0x81081, {kw_masks.data() + 14545, 6}, 0x200100004AFDFF},
+    {0x100004A7D8F, 0x81081, {kw_masks.data() + 14551, 4}, 0x100004A7D8F},
+    {0x10002006C57, 0x81081, {kw_masks.data() + 14555, 2}, 0x10002087CD7},
+    {0x100004A699D, 0x81081, {kw_masks.data() + 14557, 4}, 0x100004A799D},
+    {0x100004A6D9F, 0x81081, {kw_masks.data() + 14561, 4}, 0x100004A7D9F},
+    {0x200100005F419B, 0x81081, {kw_masks.data() + 14565, 4}, 0x200100005F519B},
+    {0x20010000174C1F, 0x81081, {kw_masks.data() + 14569, 4}, 0x200100001F5C9F},
+    {0x200100004A719B, 0x81081, {kw_masks.data() + 14573, 4}, 0x200100004A719B},
+    {0x20010000027D1F, 0x81081, {kw_masks.data() + 14577, 4}, 0x200100000A7D9F},
+    {0x200100004A499F, 0x81081, {kw_masks.data() + 14581, 4}, 0x200100004A599F},
+    {0x20010000024D1F, 0x81081, {kw_masks.data() + 14585, 4}, 0x200100000A5D9F},
+    {0x20000001120819, 0x81081, {kw_masks.data() + 14589, 5}, 0x200000015A79DD},
+    {0x100003EC919, 0x81081, {kw_masks.data() + 14594, 3}, 0x100003ED999},
+    {0x100007E499B, 0x81081, {kw_masks.data() + 14597, 2}, 0x100007E599B},
+    {0x100027E6D99, 0x81081, {kw_masks.data() + 14599, 4}, 0x100027E7D99},
+    {0x1000014494A, 0x81081, {kw_masks.data() + 14603, 2}, 0x100001C59CB},
+    {0x1000036495A, 0x81081, {kw_masks.data() + 14605, 6}, 0x100003E79DF},
+    {0x1000014C81A, 0x81081, {kw_masks.data() + 14611, 2}, 0x100001CD89B},
+    {0x100001E8910, 0x81081, {kw_masks.data() + 14613, 2}, 0x100001E9991},
+    {0x200100003AED7F, 0x81081, {kw_masks.data() + 14615, 5}, 0x200100003AFDFF},
+    {0x200100003AEDDF, 0x81081, {kw_masks.data() + 14620, 5}, 0x200100003AFDDF},
+    {0x1082100, 0x81081, {kw_masks.data() + 14625, 1}, 0x1083181},
+    {0x1003100, 0x81081, {kw_masks.data() + 14626, 1}, 0x1083181},
+    {0x200100010AE91D, 0x81081, {kw_masks.data() + 14627, 4}, 0x200100010AF99D},
+    {0x200100011EE91D, 0x81081, {kw_masks.data() + 14631, 4}, 0x200100011EF99D},
+    {0x200100010EF91D, 0x81081, {kw_masks.data() + 14635, 4}, 0x200100010EF99D},
+    {0x200100015AE199, 0x81081, {kw_masks.data() + 14639, 4}, 0x200100015AF199},
+    {0x200100015EE991, 0x81081, {kw_masks.data() + 14643, 4}, 0x200100015EF991},
+    {0x200100011FE115, 0x81081, {kw_masks.data() + 14647, 4}, 0x200100011FF195},
+    {0x200100011FE111, 0x81081, {kw_masks.data() + 14651, 4}, 0x200100011FF191},
+    {0x100004AE95D, 0x81081, {kw_masks.data() + 14655, 4}, 0x100004AF9DD},
+    {0x100004AC955, 0x81081, {kw_masks.data() + 14659, 3}, 0x100004AD9D5},
+    {0x200100010EF111, 0x81081, {kw_masks.data() + 14662, 3}, 0x200100010EF191},
+    {0x100005C5808, 0x81081, {kw_masks.data() + 14665, 3}, 0x100005C5889},
+    {0x100005E79D1, 0x81081, {kw_masks.data() + 14668, 2}, 0x100005E79D1},
+    {0x100001BE959, 0x81081, {kw_masks.data() + 14670, 3}, 0x100001BF9D9},
+    {0x100000AA971, 0x81081, {kw_masks.data() + 14673, 3}, 0x100000AB9F1},
+    {0x100005E6DDB, 0x81081, {kw_masks.data() + 14676, 3}, 0x100005E7DDB},
+    {0x100006E29D1, 0x81081, {kw_masks.data() + 14679, 3}, 0x100006E39D1},
+    {0x100001A6925, 0x81081, {kw_masks.data() + 14682, 2}, 0x100001A79A5},
+    {0x100004E6D55, 0x81081, {kw_masks.data() + 14684, 2}, 0x100004E7DD5},
+    {0x100005AE9DD, 0x81081, {kw_masks.data() + 14686, 6}, 0x100005AF9DD},
+    {0x100005EF9DD, 0x81081, {kw_masks.data() + 14692, 6}, 0x100005EF9DD},
+    {0x100001AE9DD, 0x81081, {kw_masks.data() + 14698, 5}, 0x100001AF9DD},
+    {0x100001AE959, 0x81081, {kw_masks.data() + 14703, 4}, 0x100001AF9D9},
+    {0x100001BE951, 0x81081, {kw_masks.data() + 14707, 3}, 0x100001BF9D1},
+    {0x100004E6DF9, 0x81081, {kw_masks.data() + 14710, 4}, 0x100004E7DF9},
+    {0x100004E39D1, 0x81081, {kw_masks.data() + 14714, 3}, 0x100004E39D1},
+    {0x100004E69D5, 0x81081, {kw_masks.data() + 14717, 2}, 0x100004E79D5},
+    {0x100005A69D1, 0x81081, {kw_masks.data() + 14719, 2}, 0x100005A79D1},
+    {0x100006A69D3, 0x81081, {kw_masks.data() + 14721, 3}, 0x100007AF9D3},
+    {0x100005A29DB, 0x81081, {kw_masks.data() + 14724, 3}, 0x100005A79DB},
+    {0x6300, 0x81081, {kw_masks.data() + 14727, 3}, 0x4A7BD3},
+    {0x100000AE971, 0x81081, {kw_masks.data() + 14730, 4}, 0x100000AF9F1},
+    {0x100020CF195, 0x81081, {kw_masks.data() + 14734, 3}, 0x100020CF195},
+    {0x100020CF1D5, 0x81081, {kw_masks.data() + 14737, 3}, 0x100020CF1D5},
+    {0x100020EF395, 0x81081, {kw_masks.data() + 14740, 3}, 0x100020EF395},
+    {0x100007EF9D7, 0x81081, {kw_masks.data() + 14743, 5}, 0x100007EF9D7},
+    {0x10000FEF9F7, 0x81081, {kw_masks.data() + 14748, 5}, 0x10000FEF9F7},
+    {0x100007CE9DB, 0x81081, {kw_masks.data() + 14753, 7}, 0x100007EF9FF},
+    {0x100005CE9DA, 0x81081, {kw_masks.data() + 14760, 4}, 0x100005CF9DB},
+    {0x100005CE9DA, 0x81081, {kw_masks.data() + 14764, 7}, 0x100007EF9FF},
+    {0x100005EC906, 0x81081, {kw_masks.data() + 14771, 6}, 0x100005EF9CF},
+    {0x100005EADD7, 0x81081, {kw_masks.data() + 14777, 4}, 0x100005EBDD7},
+    {0x100007C71D7, 0x81081, {kw_masks.data() + 14781, 4}, 0x100007C71D7},
+    {0x100005C79DA, 0x81081, {kw_masks.data() + 14785, 4}, 0x100005C79DB},
+    {0x100005C79E9, 0x81081, {kw_masks.data() + 14789, 4}, 0x100005C79E9},
+    {0x100005E71C8, 0x81081, {kw_masks.data() + 14793, 4}, 0x100005E71C9},
+    {0x100001EA9F5, 0x81081, {kw_masks.data() + 14797, 5}, 0x100001EB9F5},
+    {0x100001EA9F5, 0x81081, {kw_masks.data() + 14802, 5}, 0x100001EB9F5},
+    {0x100003EC01C, 0x81081, {kw_masks.data() + 14807, 3}, 0x100003ED09D},
+    {0x100007CF9DF, 0x81081, {kw_masks.data() + 14810, 4}, 0x100007CF9DF},
+    {0x100005EF9DF, 0x81081, {kw_masks.data() + 14814, 3}, 0x100005EF9DF},
+    {0x100005ED99E, 0x81081, {kw_masks.data() + 14817, 4}, 0x100005ED99F},
+    {0x100001ED08D, 0x81081, {kw_masks.data() + 14821, 2}, 0x100001ED08D},
+    {0x100001EF9F5, 0x81081, {kw_masks.data() + 14823, 5}, 0x100001EF9F5},
+    {0x100001EF9F5, 0x81081, {kw_masks.data() + 14828, 5}, 0x100001EF9F5},
+    {0x10000DEF9FD, 0x81081, {kw_masks.data() + 14833, 5}, 0x10000DEF9FD},
+    {0x100001EF95F, 0x81081, {kw_masks.data() + 14838, 4}, 0x100001EF9DF},
+    {0x1000026695C, 0x81081, {kw_masks.data() + 14842, 3}, 0x100002E79DD},
+    {0x100001EA951, 0x81081, {kw_masks.data() + 14845, 3}, 0x100001EB9D1},
+    {0x100001E3951, 0x81081, {kw_masks.data() + 14848, 3}, 0x100001E39D1},
+    {0x100001EF955, 0x81081, {kw_masks.data() + 14851, 3}, 0x100001EF9D5},
+    {0x100001AE11C, 0x81081, {kw_masks.data() + 14854, 2}, 0x100001AF19D},
+    {0x100001AE1DD, 0x81081, {kw_masks.data() + 14856, 3}, 0x100001AF1DD},
+    {0x100020EF915, 0x81081, {kw_masks.data() + 14859, 3}, 0x100020EF995},
+    {0x100001AF94D, 0x81081, {kw_masks.data() + 14862, 2}, 0x100001AF9CD},
+    {0x100004E619C, 0x81081, {kw_masks.data() + 14864, 2}, 0x100004E719D},
+    {0x100005C71C0, 0x81081, {kw_masks.data() + 14866, 6}, 0x100005E71C7},
+    {0x100007A6193, 0x81081, {kw_masks.data() + 14872, 2}, 0x100007A7193},
+    {0x100006E6197, 0x81081, {kw_masks.data() + 14874, 2}, 0x100006E7197},
+    {0x100004E69DD, 0x81081, {kw_masks.data() + 14876, 2}, 0x100004E79DD},
+    {0x100005A69C5, 0x81081, {kw_masks.data() + 14878, 2}, 0x100005A79C5},
+    {0x100003E6117, 0x81081, {kw_masks.data() + 14880, 3}, 0x100003E7197},
+    {0x100003E6117, 0x81081, {kw_masks.data() + 14883, 3}, 0x100003E7197},
+    {0x100003E6117, 0x81081, {kw_masks.data() + 14886, 4}, 0x100003E7197},
+    {0x100003E6117, 0x81081, {kw_masks.data() + 14890, 4}, 0x100003E7197},
+    {0x100005C639B, 0x81081, {kw_masks.data() + 14894, 3}, 0x100005C739B},
+    {0x100004E639F, 0x81081, {kw_masks.data() + 14897, 3}, 0x100004E739F},
+    {0x100005E69BC, 0x81081, {kw_masks.data() + 14900, 3}, 0x100005E79BD},
+    {0x100004E69BC, 0x81081, {kw_masks.data() + 14903, 3}, 0x100004E79BD},
+    {0x100001F691F, 0x81081, {kw_masks.data() + 14906, 3}, 0x100001F799F},
+    {0x1000017691B, 0x81081, {kw_masks.data() + 14909, 3}, 0x100001F799B},
+    {0x100005EF9BD, 0x81081, {kw_masks.data() + 14912, 5}, 0x100005EF9BD},
+    {0x100006869DF, 0x81081, {kw_masks.data() + 14917, 3}, 0x100006879DF},
+    {0x100006A49DF, 0x81081, {kw_masks.data() + 14920, 3}, 0x100006A59DF},
+    {0x1000010695F, 0x81081, {kw_masks.data() + 14923, 2}, 0x100001879DF},
+    {0x1000012495F, 0x81081, {kw_masks.data() + 14925, 2}, 0x100001A59DF},
+    {0x100004E695D, 0x81081, {kw_masks.data() + 14927, 3}, 0x100004E79DD},
+    {0x100004E6955, 0x81081, {kw_masks.data() + 14930, 3}, 0x100004E79D5},
+    {0x1000006E951, 0x81081, {kw_masks.data() + 14933, 2}, 0x100000EF9D1},
+    {0x1000006E959, 0x81081, {kw_masks.data() + 14935, 2}, 0x100000EF9D9},
+    {0x1000022E95D, 0x81081, {kw_masks.data() + 14937, 2}, 0x100002AF9DD},
+    {0x100004C79DD, 0x81081, {kw_masks.data() + 14939, 3}, 0x100004C79DD},
+    {0x100004E59DD, 0x81081, {kw_masks.data() + 14942, 3}, 0x100004E59DD},
+    {0x100024E69CD, 0x81081, {kw_masks.data() + 14945, 3}, 0x100024E79CD},
+    {0x100024E69CD, 0x81081, {kw_masks.data() + 14948, 3}, 0x100024E79CD},
+    {0x100007A69DF, 0x81081, {kw_masks.data() + 14951, 3}, 0x100007A79DF},
+    {0x100005A69DF, 0x81081, {kw_masks.data() + 14954, 2}, 0x100005A79DF},
+    {0x100005A69DF, 0x81081, {kw_masks.data() + 14956, 3}, 0x100005A79DF},
+    {0x100007E399B, 0x81081, {kw_masks.data() + 14959, 3}, 0x100007E399B},
+    {0x100007A49DF, 0x81081, {kw_masks.data() + 14962, 3}, 0x100007A59DF},
+    {0x1000012695F, 0x81081, {kw_masks.data() + 14965, 4}, 0x100001A79DF},
+    {0x100020E711D, 0x81081, {kw_masks.data() + 14969, 3}, 0x100020E719D},
+    {0x100020E6155, 0x81081, {kw_masks.data() + 14972, 3}, 0x100020E71D5},
+    {0x100005D69DB, 0x81081, {kw_masks.data() + 14975, 4}, 0x100005D79DB},
+    {0x1000068699F, 0x81081, {kw_masks.data() + 14979, 3}, 0x1000068799F},
+    {0x100027EED9F, 0x81081, {kw_masks.data() + 14982, 8}, 0x100027EFD9F},
+    {0x100026EED97, 0x81081, {kw_masks.data() + 14990, 5}, 0x100026EFD97},
+    {0x100006AC99B, 0x81081, {kw_masks.data() + 14995, 4}, 0x100006AD99B},
+    {0x100004EE9D9, 0x81081, {kw_masks.data() + 14999, 4}, 0x100004EF9D9},
+    {0x10000163901, 0x81081, {kw_masks.data() + 15003, 2}, 0x100001E3981},
+    {0x100007A61DF, 0x81081, {kw_masks.data() + 15005, 3}, 0x100007A71DF},
+    {0x100005F0D91, 0x81081, {kw_masks.data() + 15008, 2}, 0x100005F1D91},
+    {0x10000DF79B5, 0x81081, {kw_masks.data() + 15010, 4}, 0x10000DF79B5},
+    {0x100019BD911, 0x81081, {kw_masks.data() + 15014, 2}, 0x100019BD991},
+    {0x1000035E953, 0x81081, {kw_masks.data() + 15016, 4}, 0x100003DF9D3},
+    {0x1000035E953, 0x81081, {kw_masks.data() + 15020, 4}, 0x100003DF9D3},
+    {0x100003FE95B, 0x81081, {kw_masks.data() + 15024, 5}, 0x100003FF9DB},
+    {0x1000011681F, 0x81081, {kw_masks.data() + 15029, 3}, 0x1000019789F},
+    {0x100007D6955, 0x81081, {kw_masks.data() + 15032, 4}, 0x100007D79D5},
+    {0x100003F69D5, 0x81081, {kw_masks.data() + 15036, 4}, 0x100003F79D5},
+    {0x100007D69DB, 0x81081, {kw_masks.data() + 15040, 6}, 0x100007D79DB},
+    {0x100007F69BB, 0x81081, {kw_masks.data() + 15046, 4}, 0x100007F79BB},
+    {0x200100004E299D, 0x81081, {kw_masks.data() + 15050, 4}, 0x200100004E399D},
+    {0x200100004E29DD, 0x81081, {kw_masks.data() + 15054, 4}, 0x200100004E39DD},
+    {0x200100007F7D93, 0x81081, {kw_masks.data() + 15058, 5}, 0x200100007F7D93},
+    {0x200100007F75D3, 0x81081, {kw_masks.data() + 15063, 5}, 0x200100007F75D3},
+    {0x200100001D2899, 0x81081, {kw_masks.data() + 15068, 5}, 0x200100001D3899},
+    {0x200100001F68D9, 0x81081, {kw_masks.data() + 15073, 4}, 0x200100001F78D9},
+    {0x200100005F6999, 0x81081, {kw_masks.data() + 15077, 6}, 0x200100005F7999},
+    {0x200100005F69D9, 0x81081, {kw_masks.data() + 15083, 6}, 0x200100005F79D9},
+    {0x200100007F699B, 0x81081, {kw_masks.data() + 15089, 6}, 0x200100007F799B},
+    {0x200100007F69DB, 0x81081, {kw_masks.data() + 15095, 6}, 0x200100007F79DB},
+    {0x200100007F69DB, 0x81081, {kw_masks.data() + 15101, 7}, 0x200100007F79DB},
+    {0x200100007F69FB, 0x81081, {kw_masks.data() + 15108, 7}, 0x200100007F79FB},
+    {0x200100008EF991, 0x81081, {kw_masks.data() + 15115, 3}, 0x200100008EF991},
+    {0x200100008AF1D1, 0x81081, {kw_masks.data() + 15118, 3}, 0x200100008AF1D1},
+    {0x200100001D69D9, 0x81081, {kw_masks.data() + 15121, 6}, 0x200100001D79D9},
+    {0x200100001F69D9, 0x81081, {kw_masks.data() + 15127, 6}, 0x200100001F79D9},
+    {0x200100008EF999, 0x81081, {kw_masks.data() + 15133, 4}, 0x200100008EF999},
+    {0x200100008AF1D9, 0x81081, {kw_masks.data() + 15137, 4}, 0x200100008AF1D9},
+    {0x200100003F69DB, 0x81081, {kw_masks.data() + 15141, 7}, 0x200100003F79DB},
+    {0x200100003F69DB, 0x81081, {kw_masks.data() + 15148, 7}, 0x200100003F79DB},
+    {0x200100003F7993, 0x81081, {kw_masks.data() + 15155, 6}, 0x200100003F7993},
+    {0x200100003F79D3, 0x81081, {kw_masks.data() + 15161, 5}, 0x200100003F79D3},
+    {0x200100002E79D3, 0x81081, {kw_masks.data() + 15166, 5}, 0x200100002E79D3},
+    {0x200100002E79D3, 0x81081, {kw_masks.data() + 15171, 5}, 0x200100002E79D3},
+    {0x200100003F69DB, 0x81081, {kw_masks.data() + 15176, 7}, 0x200100003F79DB},
+    {0x200100003F69DB, 0x81081, {kw_masks.data() + 15183, 7}, 0x200100003F79DB},
+    {0x200100003F68DB, 0x81081, {kw_masks.data() + 15190, 6}, 0x200100003F78DB},
+    {0x200100003F68DB, 0x81081, {kw_masks.data() + 15196, 6}, 0x200100003F78DB},
+    {0x200100001F6899, 0x81081, {kw_masks.data() + 15202, 4}, 0x200100001F7899},
+    {0x200100001F68D9, 0x81081, {kw_masks.data() + 15206, 4}, 0x200100001F78D9},
+    {0x200100005F6999, 0x81081, {kw_masks.data() + 15210, 6}, 0x200100005F7999},
+    {0x200100005F69D9, 0x81081, {kw_masks.data() + 15216, 6}, 0x200100005F79D9},
+    {0x200100001F699B, 0x81081, {kw_masks.data() + 15222, 5}, 0x200100001F799B},
+    {0x200100001B69DB, 0x81081, {kw_masks.data() + 15227, 9}, 0x200100011F79DF},
+    {0x200100001F699B, 0x81081, {kw_masks.data() + 15236, 6}, 0x200100001F799B},
+    {0x200100001F69DB, 0x81081, {kw_masks.data() + 15242, 6}, 0x200100001F79DB},
+    {0x200100000E7991, 0x81081, {kw_masks.data() + 15248, 3}, 0x200100000E7991},
+    {0x200100000E79D1, 0x81081, {kw_masks.data() + 15251, 3}, 0x200100000E79D1},
+    {0x200100003F79D3, 0x81081, {kw_masks.data() + 15254, 6}, 0x200100003F79D3},
+    {0x200100003F79D3, 0x81081, {kw_masks.data() + 15260, 6}, 0x200100003F79D3},
+    {0x200100001C689B, 0x81081, {kw_masks.data() + 15266, 6}, 0x200100011C799F},
+    {0x200100001E68DB, 0x81081, {kw_masks.data() + 15272, 4}, 0x200100001E78DB},
+    {0x200100005E699B, 0x81081, {kw_masks.data() + 15276, 5}, 0x200100005E799B},
+    {0x200100002EE9D1, 0x81081, {kw_masks.data() + 15281, 4}, 0x200100002EF9D1},
+    {0x200100000E29DB, 0x81081, {kw_masks.data() + 15285, 4}, 0x200100000E39DB},
+    {0x200100013E689F, 0x81081, {kw_masks.data() + 15289, 4}, 0x200100013E789F},
+    {0x200100013E68DF, 0x81081, {kw_masks.data() + 15293, 4}, 0x200100013E78DF},
+    {0x200100013F689F, 0x81081, {kw_masks.data() + 15297, 7}, 0x200100013F789F},
+    {0x200100013F68DF, 0x81081, {kw_masks.data() + 15304, 7}, 0x200100013F78DF},
+    {0x100000E3891, 0x81081, {kw_masks.data() + 15311, 2}, 0x100000E3891},
+    {0x100000A28D1, 0x81081, {kw_masks.data() + 15313, 2}, 0x100000A38D1},
+    {0x100001F7891, 0x81081, {kw_masks.data() + 15315, 3}, 0x100001F7891},
+    {0x100001B68D1, 0x81081, {kw_masks.data() + 15318, 3}, 0x100001B78D1},
+    {0x100017DF9D3, 0x81081, {kw_masks.data() + 15321, 4}, 0x100017DF9D3},
+    {0x2001000037E95F, 0x81081, {kw_masks.data() + 15325, 6}, 0x200100003FF9DF},
+    {0x2001000035695F, 0x81081, {kw_masks.data() + 15331, 6}, 0x200100003D79DF},
+    {0x200100003FE95F, 0x81081, {kw_masks.data() + 15337, 6}, 0x200100003FF9DF},
+    {0x200100003D695F, 0x81081, {kw_masks.data() + 15343, 6}, 0x200100003D79DF},
+    {0x1000037E95F, 0x81081, {kw_masks.data() + 15349, 4}, 0x100003FF9DF},
+    {0x1000035695F, 0x81081, {kw_masks.data() + 15353, 4}, 0x100003D79DF},
+    {0x100003FE81F, 0x81081, {kw_masks.data() + 15357, 4}, 0x100003FF89F},
+    {0x100003D681F, 0x81081, {kw_masks.data() + 15361, 4}, 0x100003D789F},
+    {0x100003FD81F, 0x81081, {kw_masks.data() + 15365, 4}, 0x100003FD89F},
+    {0x100003D581F, 0x81081, {kw_masks.data() + 15369, 4}, 0x100003D589F},
+    {0x100003FF81F, 0x81081, {kw_masks.data() + 15373, 5}, 0x100003FF89F},
+    {0x100003D781F, 0x81081, {kw_masks.data() + 15378, 5}, 0x100003D789F},
+    {0x1000016C81E, 0x81081, {kw_masks.data() + 15383, 2}, 0x100001ED89F},
+    {0x1000014481E, 0x81081, {kw_masks.data() + 15385, 2}, 0x100001C589F},
+    {0x100005C419A, 0x81081, {kw_masks.data() + 15387, 2}, 0x100005C519B},
+    {0x100005EC198, 0x81081, {kw_masks.data() + 15389, 2}, 0x100005ED199},
+    {0x100005CE9D2, 0x81081, {kw_masks.data() + 15391, 4}, 0x100005CF9D3},
+    {0x100005EE9D2, 0x81081, {kw_masks.data() + 15395, 4}, 0x100005EF9D3},
+    {0x100005CF9D7, 0x81081, {kw_masks.data() + 15399, 4}, 0x100005CF9D7},
+    {0x100005EF9D7, 0x81081, {kw_masks.data() + 15403, 4}, 0x100005EF9D7},
+    {0x100007F49BB, 0x81081, {kw_masks.data() + 15407, 4}, 0x100007F59BB},
+    {0x100007FC9BB, 0x81081, {kw_masks.data() + 15411, 4}, 0x100007FD9BB},
+    {0x100003D6973, 0x81081, {kw_masks.data() + 15415, 4}, 0x100003D79F3},
+    {0x100003FE973, 0x81081, {kw_masks.data() + 15419, 4}, 0x100003FF9F3},
+    {0x100003EC93B, 0x81081, {kw_masks.data() + 15423, 4}, 0x100003ED9BB},
+    {0x100003EC93B, 0x81081, {kw_masks.data() + 15427, 4}, 0x100003ED9BB},
+    {0x100003D5833, 0x81081, {kw_masks.data() + 15431, 4}, 0x100003D58B3},
+    {0x100003FD833, 0x81081, {kw_masks.data() + 15435, 4}, 0x100003FD8B3},
+    {0x100003D6833, 0x81081, {kw_masks.data() + 15439, 4}, 0x100003D78B3},
+    {0x100003FE833, 0x81081, {kw_masks.data() + 15443, 4}, 0x100003FF8B3},
+    {0x100009FE833, 0x81081, {kw_masks.data() + 15447, 5}, 0x100009FF8B3},
+    {0x100009FE1D3, 0x81081, {kw_masks.data() + 15452, 5}, 0x100009FF1D3},
+    {0x100001C481E, 0x81081, {kw_masks.data() + 15457, 2}, 0x100001C589F},
+    {0x100001EC81C, 0x81081, {kw_masks.data() + 15459, 2}, 0x100001ED89D},
+    {0x100001F481F, 0x81081, {kw_masks.data() + 15461, 3}, 0x100001F589F},
+    {0x100001FC81D, 0x81081, {kw_masks.data() + 15464, 3}, 0x100001FD89D},
+    {0x100003EC013, 0x81081, {kw_masks.data() + 15467, 3}, 0x100003ED093},
+    {0x100003EC013, 0x81081, {kw_masks.data() + 15470, 3}, 0x100003ED093},
+    {0x100003C4013, 0x81081, {kw_masks.data() + 15473, 2}, 0x100003C5093},
+    {0x100003EC013, 0x81081, {kw_masks.data() + 15475, 2}, 0x100003ED093},
+    {0x100001E811A, 0x81081, {kw_masks.data() + 15477, 3}, 0x100001E919B},
+    {0x100015EE39B, 0x81081, {kw_masks.data() + 15480, 5}, 0x100015EF39B},
+    {0x100004EF979, 0x81081, {kw_masks.data() + 15485, 3}, 0x100004EF9F9},
+    {0x100004AC5B4, 0x81081, {kw_masks.data() + 15488, 3}, 0x100004AD5B5},
+    {0x100002E6915, 0x81081, {kw_masks.data() + 15491, 2}, 0x100002E7995},
+    {0x26560, 0x81081, {kw_masks.data() + 15493, 3}, 0xAF5F9},
+    {0x26560, 0x81081, {kw_masks.data() + 15496, 2}, 0xAF5F9},
+    {0x100000E4CB5, 0x81081, {kw_masks.data() + 15498, 3}, 0x100000E5CB5},
+    {0x100004E648D, 0x81081, {kw_masks.data() + 15501, 3}, 0x100004E748D},
+    {0x100001EC485, 0x81081, {kw_masks.data() + 15504, 3}, 0x100001ED485},
+    {0x100005EA99D, 0x81081, {kw_masks.data() + 15507, 1}, 0x100005EB99D},
+    {0x100003EA9D7, 0x81081, {kw_masks.data() + 15508, 7}, 0x100013EF9FF},
+    {0x100003E693F, 0x81081, {kw_masks.data() + 15515, 5}, 0x100003E79BF},
+    {0x100003E693F, 0x81081, {kw_masks.data() + 15520, 5}, 0x100003E79BF},
+    {0x100003E693F, 0x81081, {kw_masks.data() + 15525, 5}, 0x100003E79BF},
+    {0x100003E79FF, 0x81081, {kw_masks.data() + 15530, 6}, 0x100003E79FF},
+    {0x100006E659F, 0x81081, {kw_masks.data() + 15536, 4}, 0x100006E759F},
+    {0x100005EE59F, 0x81081, {kw_masks.data() + 15540, 4}, 0x100005EF59F},
+    {0x100007EE49F, 0x81081, {kw_masks.data() + 15544, 5}, 0x100007EF49F},
+    {0x10000586C1F, 0x81081, {kw_masks.data() + 15549, 3}, 0x10000587C9F},
+    {0x1000018CC1F, 0x81081, {kw_masks.data() + 15552, 4}, 0x1000018FD9F},
+    {0x100001E6D5A, 0x81081, {kw_masks.data() + 15556, 4}, 0x100001E7DDB},
+    {0x100003E6D5A, 0x81081, {kw_masks.data() + 15560, 5}, 0x100003E7DDB},
+    {0x100006E69D9, 0x81081, {kw_masks.data() + 15565, 6}, 0x100006E79D9},
+    {0x100006A6997, 0x81081, {kw_masks.data() + 15571, 4}, 0x100006A7997},
+    {0x100006A6997, 0x81081, {kw_masks.data() + 15575, 4}, 0x100006A7997},
+    {0x100004A6D9F, 0x81081, {kw_masks.data() + 15579, 6}, 0x100014E7DBF},
+    {0x100024EED91, 0x81081, {kw_masks.data() + 15585, 3}, 0x100024EFD91},
+    {0x100004AC999, 0x81081, {kw_masks.data() + 15588, 3}, 0x100004AD999},
+    {0x100012AE917, 0x81081, {kw_masks.data() + 15591, 6}, 0x100012AF997},
+    {0x100026EED97, 0x81081, {kw_masks.data() + 15597, 5}, 0x100026EFD97},
+    {0x100000AE915, 0x81081, {kw_masks.data() + 15602, 3}, 0x100000AF995},
+    {0x200100000EA999, 0x81081, {kw_masks.data() + 15605, 4}, 0x200100000EB999},
+    {0x200100000EA9D9, 0x81081, {kw_masks.data() + 15609, 4}, 0x200100000EB9D9},
+    {0x200100001F699B, 0x81081, {kw_masks.data() + 15613, 6}, 0x200100001F799B},
+    {0x200100001F69DB, 0x81081, {kw_masks.data() + 15619, 6}, 0x200100001F79DB},
+    {0x100011EE91B, 0x81081, {kw_masks.data() + 15625, 4}, 0x100011EF99B},
+    {0x100002AC957, 0x81081, {kw_masks.data() + 15629, 5}, 0x100002AD9D7},
+    {0x100001EC91B, 0x81081, {kw_masks.data() + 15634, 3}, 0x100001ED99B},
+    {0x100006A0997, 0x81081, {kw_masks.data() + 15637, 5}, 0x100006E5F9F},
+    {0x200100016A2997, 0x81081, {kw_masks.data() + 15642, 6}, 0x200100016E7F9F},
+    {0x200100004AE971, 0x464001, {kw_masks.data() + 15648, 5}, 0x200100004EE979},
+    {0x200100005AE141, 0x464001, {kw_masks.data() + 15653, 5}, 0x200100005EE149},
+    {0x200100004AE1C1, 0x464001, {kw_masks.data() + 15658, 8}, 0x200100005EE9ED},
+    {0x200100004AE149, 0x464001, {kw_masks.data() + 15666, 5}, 0x200100004EE149},
+    {0x200100004A49F1, 0x464001, {kw_masks.data() + 15671, 6}, 0x200100004E69F1},
+    {0x2001000052E009, 0x464001, {kw_masks.data() + 15677, 4}, 0x2001000056E009},
+    {0x200100005AC831, 0x464001, {kw_masks.data() + 15681, 9}, 0x200100005EE9BD},
+    {0x200100005AC1C1, 0x464001, {kw_masks.data() + 15690, 9}, 0x200100005EE9DD},
+    {0x200100004A61C9, 0x464001, {kw_masks.data() + 15699, 9}, 0x200100005E69DD},
+    {0x200100004A6839, 0x464001, {kw_masks.data() + 15708, 9}, 0x200100005E69BD},
+    {0x100004E4C39, 0x464001, {kw_masks.data() + 15717, 3}, 0x100004E4C39},
+    {0x100004E45D9, 0x464001, {kw_masks.data() + 15720, 3}, 0x100004E45D9},
+    {0x100006E4839, 0x464001, {kw_masks.data() + 15723, 3}, 0x100006E4839},
+    {0x100006E41D9, 0x464001, {kw_masks.data() + 15726, 3}, 0x100006E41D9},
+    {0x100004E48B9, 0x464001, {kw_masks.data() + 15729, 7}, 0x100005E48BD},
+    {0x100005EC099, 0x464001, {kw_masks.data() + 15736, 7}, 0x100005EC0BD},
+    {0x100004E41D9, 0x464001, {kw_masks.data() + 15743, 10}, 0x100005E6BFD},
+    {0x100004E6099, 0x464001, {kw_masks.data() + 15753, 9}, 0x100005E70BD},
+    {0x100004E4939, 0x464001, {kw_masks.data() + 15762, 3}, 0x100004E4939},
+    {0x100004E49C9, 0x464001, {kw_masks.data() + 15765, 6}, 0x100004E6BDD},
+    {0x100004E583B, 0x464001, {kw_masks.data() + 15771, 4}, 0x100004E583B},
+    {0x1000056D02B, 0x464001, {kw_masks.data() + 15775, 4}, 0x1000056D02B},
+    {0x100004E51EB, 0x464001, {kw_masks.data() + 15779, 6}, 0x100004EF9FB},
+    {0x1000046702B, 0x464001, {kw_masks.data() + 15785, 6}, 0x100014EF8BB},
+    {0x100005EE19B, 0x464001, {kw_masks.data() + 15791, 5}, 0x100005EE19B},
+    {0x100007A69F5, 0x464001, {kw_masks.data() + 15796, 6}, 0x100007E6DFD},
+    {0x100007A69F5, 0x464001, {kw_masks.data() + 15802, 6}, 0x100007E6DFD},
+    {0x100004EC839, 0x464001, {kw_masks.data() + 15808, 3}, 0x100004EC839},
+    {0x100004EC9C9, 0x464001, {kw_masks.data() + 15811, 3}, 0x100004EC9C9},
+    {0x100006A49F1, 0x464001, {kw_masks.data() + 15814, 4}, 0x100006E49F1},
+    {0x100004E4DF1, 0x464001, {kw_masks.data() + 15818, 4}, 0x100004E4DF1},
+    {0x10002466149, 0x464001, {kw_masks.data() + 15822, 4}, 0x100034E695D},
+    {0x100005EC939, 0x464001, {kw_masks.data() + 15826, 4}, 0x100005EC939},
+    {0x100005EC1C9, 0x464001, {kw_masks.data() + 15830, 4}, 0x100005EC1C9},
+    {0x100004EE939, 0x464001, {kw_masks.data() + 15834, 4}, 0x100004EE939},
+    {0x100004EE1C9, 0x464001, {kw_masks.data() + 15838, 4}, 0x100004EE1C9},
+    {0x100004E61DD, 0x464001, {kw_masks.data() + 15842, 6}, 0x100004E69FD},
+    {0x100004E683D, 0x464001, {kw_masks.data() + 15848, 4}, 0x100004E683D},
+    {0x100004EFD15, 0x464001, {kw_masks.data() + 15852, 4}, 0x100004EFD15},
+    {0x100004EDD15, 0x464001, {kw_masks.data() + 15856, 4}, 0x100004EDD15},
+    {0x100004E68D3, 0x464001, {kw_masks.data() + 15860, 6}, 0x100004E78D3},
+    {0x100006E49FB, 0x464001, {kw_masks.data() + 15866, 8}, 0x100006E49FB},
+    {0x100004EED15, 0x464001, {kw_masks.data() + 15874, 4}, 0x100004EED15},
+    {0x1000046ED15, 0x464001, {kw_masks.data() + 15878, 4}, 0x1000046ED15},
+    {0x100005EE8BB, 0x464001, {kw_masks.data() + 15882, 4}, 0x100005EE8BB},
+    {0x100004EE8BB, 0x464001, {kw_masks.data() + 15886, 4}, 0x100004EE8BB},
+    {0x100005EE1CB, 0x464001, {kw_masks.data() + 15890, 4}, 0x100005EE1CB},
+    {0x100005EE8BB, 0x464001, {kw_masks.data() + 15894, 4}, 0x100005EE8BB},
+    {0x100005EE1CB, 0x464001, {kw_masks.data() + 15898, 4}, 0x100005EE1CB},
+    {0x100004EE1CB, 0x464001, {kw_masks.data() + 15902, 4}, 0x100004EE1CB},
+    {0x100004EE1CB, 0x464001, {kw_masks.data() + 15906, 4}, 0x100004EE1CB},
+    {0x100004EE8BB, 0x464001, {kw_masks.data() + 15910, 4}, 0x100004EE8BB},
+    {0x100006E49F9, 0x464001, {kw_masks.data() + 15914, 4}, 0x100006E49F9},
+    {0x200100005EE149, 0x464001, {kw_masks.data() + 15918, 11}, 0x200100005EE979},
+    {0x200100006EE9F1, 0x464001, {kw_masks.data() + 15929, 10}, 0x200100006EE9F9},
+    {0x100004EC939, 0x464001, {kw_masks.data() + 15939, 3}, 0x100004EC939},
+    {0x1000056C119, 0x464001, {kw_masks.data() + 15942, 3}, 0x1000056C119},
+    {0x100004EC1D9, 0x464001, {kw_masks.data() + 15945, 3}, 0x100004EC1D9},
+    {0x1000046E119, 0x464001, {kw_masks.data() + 15948, 3}, 0x1000046E119},
+    {0x100006EE9F9, 0x464001, {kw_masks.data() + 15951, 4}, 0x100006EE9F9},
+    {0x100006EE9F9, 0x464001, {kw_masks.data() + 15955, 4}, 0x100006EE9F9},
+    {0x100005E4C3B, 0x464001, {kw_masks.data() + 15959, 4}, 0x100005E4C3B},
+    {0x100005E4DFB, 0x464001, {kw_masks.data() + 15963, 5}, 0x100005E4DFB},
+    {0x100005E4DDB, 0x464001, {kw_masks.data() + 15968, 4}, 0x100005E4DDB},
+    {0x100005E483B, 0x464001, {kw_masks.data() + 15972, 3}, 0x100005E483B},
+    {0x1000056C81B, 0x464001, {kw_masks.data() + 15975, 3}, 0x1000056C81B},
+    {0x100005E49DB, 0x464001, {kw_masks.data() + 15978, 3}, 0x100005E49DB},
+    {0x1000056681B, 0x464001, {kw_masks.data() + 15981, 3}, 0x1000056681B},
+    {0x100005A49FB, 0x464001, {kw_masks.data() + 15984, 4}, 0x100005E49FB},
+    {0x1000052E81B, 0x464001, {kw_masks.data() + 15988, 4}, 0x1000056E81B},
+    {0x100005E689B, 0x464001, {kw_masks.data() + 15992, 4}, 0x100005E689B},
+    {0x100005E689B, 0x464001, {kw_masks.data() + 15996, 4}, 0x100005E689B},
+    {0x100005E489B, 0x464001, {kw_masks.data() + 16000, 4}, 0x100005E489B},
+    {0x100005E489B, 0x464001, {kw_masks.data() + 16004, 4}, 0x100005E489B},
+    {0x100004EC939, 0x464001, {kw_masks.data() + 16008, 3}, 0x100004EC939},
+    {0x100004EC9D9, 0x464001, {kw_masks.data() + 16011, 3}, 0x100004EC9D9},
+    {0x100005F4979, 0x464001, {kw_masks.data() + 16014, 3}, 0x100005F4979},
+    {0x100005F49D9, 0x464001, {kw_masks.data() + 16017, 3}, 0x100005F49D9},
+    {0x100005ECC1B, 0x464001, {kw_masks.data() + 16020, 6}, 0x100005ECC5B},
+    {0x100005E6C1B, 0x464001, {kw_masks.data() + 16026, 6}, 0x100005EEC5B},
+    {0x100004E48B9, 0x464001, {kw_masks.data() + 16032, 3}, 0x100004E48B9},
+    {0x1000056C099, 0x464001, {kw_masks.data() + 16035, 3}, 0x1000056C099},
+    {0x100004E41D9, 0x464001, {kw_masks.data() + 16038, 3}, 0x100004E41D9},
+    {0x10000466099, 0x464001, {kw_masks.data() + 16041, 3}, 0x10000466099},
+    {0x100004E483B, 0x464001, {kw_masks.data() + 16044, 5}, 0x100004E483B},
+    {0x100004E41CB, 0x464001, {kw_masks.data() + 16049, 5}, 0x100004E41CB},
+    {0x100004E48B9, 0x464001, {kw_masks.data() + 16054, 4}, 0x100004E49B9},
+    {0x1000056C889, 0x464001, {kw_masks.data() + 16058, 9}, 0x108807EC9BD},
+    {0x100004E49C9, 0x464001, {kw_masks.data() + 16067, 8}, 0x108805EC9DD},
+    {0x10000466889, 0x464001, {kw_masks.data() + 16075, 4}, 0x100004E6999},
+    {0x1000056D8AB, 0x464001, {kw_masks.data() + 16079, 8}, 0x100005EDDBF},
+    {0x100005EE999, 0x464001, {kw_masks.data() + 16087, 6}, 0x100007EED9D},
+    {0x100025EE99B, 0x464001, {kw_masks.data() + 16093, 9}, 0x100025EED9F},
+    {0x100007EE99F, 0x464001, {kw_masks.data() + 16102, 8}, 0x100007EFD9F},
+    {0x100005EC99B, 0x464001, {kw_masks.data() + 16110, 6}, 0x100007EC99F},
+    {0x100005EE99B, 0x464001, {kw_masks.data() + 16116, 7}, 0x100007EED9F},
+    {0x100004E59F9, 0x464001, {kw_masks.data() + 16123, 6}, 0x100005EDDFD},
+    {0x100004E6095, 0x464001, {kw_masks.data() + 16129, 5}, 0x100004E7095},
+    {0x100005E6095, 0x464001, {kw_masks.data() + 16134, 5}, 0x100005E609D},
+    {0x100005AE199, 0x464001, {kw_masks.data() + 16139, 5}, 0x100005EE9DD},
+    {0x100004E59D5, 0x464001, {kw_masks.data() + 16144, 4}, 0x100004E59D5},
+    {0x100005EE839, 0x464001, {kw_masks.data() + 16148, 4}, 0x100005EE839},
+    {0x100004E41D9, 0x464001, {kw_masks.data() + 16152, 3}, 0x100004E41D9},
+    {0x100006E4DBD, 0x464001, {kw_masks.data() + 16155, 4}, 0x100006E4DBD},
+    {0x100006E4DDD, 0x464001, {kw_masks.data() + 16159, 7}, 0x100007EEDFD},
+    {0x100006E4DF5, 0x464001, {kw_masks.data() + 16166, 8}, 0x100006EEDF5},
+    {0x100007E4DBF, 0x464001, {kw_masks.data() + 16174, 5}, 0x100007E4DBF},
+    {0x100007E4DDF, 0x464001, {kw_masks.data() + 16179, 8}, 0x100007E6DFF},
+    {0x100007E4DFF, 0x464001, {kw_masks.data() + 16187, 9}, 0x100007E6DFF},
+    {0x200100004EE8B9, 0x464001, {kw_masks.data() + 16196, 4}, 0x200100004EE8B9},
+    {0x200100004EE1D9, 0x464001, {kw_masks.data() + 16200, 4}, 0x200100004EE1D9},
+    {0x200100004AE9F9, 0x464001, {kw_masks.data() + 16204, 5}, 0x200100004EE9F9},
+    {0x1000057C819, 0x464001, {kw_masks.data() + 16209, 3}, 0x1000057C819},
+    {0x1000057E819, 0x464001, {kw_masks.data() + 16212, 3}, 0x1000057E819},
+    {0x100004EED5D, 0x464001, {kw_masks.data() + 16215, 4}, 0x100004EED5D},
+    {0x1000046CD5D, 0x464001, {kw_masks.data() + 16219, 4}, 0x1000046CD5D},
+    {0x100005EC9DD, 0x464001, {kw_masks.data() + 16223, 4}, 0x100005EC9DD},
+    {0x100004E6879, 0x464001, {kw_masks.data() + 16227, 3}, 0x100004E6879},
+    {0x100004E69C9, 0x464001, {kw_masks.data() + 16230, 3}, 0x100004E69C9},
+    {0x100004A69F1, 0x464001, {kw_masks.data() + 16233, 4}, 0x100004E69F1},
+    {0x100005E687B, 0x464001, {kw_masks.data() + 16237, 4}, 0x100005E687B},
+    {0x100005E69DB, 0x464001, {kw_masks.data() + 16241, 4}, 0x100005E69DB},
+    {0x100005A69FB, 0x464001, {kw_masks.data() + 16245, 5}, 0x100005E69FB},
+    {0x100004E787B, 0x464001, {kw_masks.data() + 16250, 5}, 0x100004EF87B},
+    {0x100004E79EB, 0x464001, {kw_masks.data() + 16255, 5}, 0x100004EF9EB},
+    {0x100005E787B, 0x464001, {kw_masks.data() + 16260, 5}, 0x100005E787B},
+    {0x100005E79FB, 0x464001, {kw_masks.data() + 16265, 5}, 0x100005E79FB},
+    {0x100005F69D9, 0x464001, {kw_masks.data() + 16270, 4}, 0x100005F69D9},
+    {0x200100006E4DDD, 0x464001, {kw_masks.data() + 16274, 9}, 0x200100007EEFDD},
+    {0x200100007E4DDF, 0x464001, {kw_masks.data() + 16283, 10}, 0x200100007E6FFF},
+    {0x100007E4DBF, 0x464001, {kw_masks.data() + 16293, 5}, 0x100007E4DBF},
+    {0x100007E4DDF, 0x464001, {kw_masks.data() + 16298, 5}, 0x100007E4DDF},
+    {0x100007E4DFF, 0x464001, {kw_masks.data() + 16303, 6}, 0x100007E4DFF},
+    {0x200100004E51FB, 0x464001, {kw_masks.data() + 16309, 6}, 0x200100004ED1FB},
+    {0x100005E583B, 0x464001, {kw_masks.data() + 16315, 5}, 0x100005ED83B},
+    {0x100005E59FB, 0x464001, {kw_masks.data() + 16320, 5}, 0x100005ED9FB},
+    {0x100024E6D99, 0x464001, {kw_masks.data() + 16325, 4}, 0x100024E6D99},
+    {0x100025EED99, 0x464001, {kw_masks.data() + 16329, 4}, 0x100025EED99},
+    {0x100005EC919, 0x464001, {kw_masks.data() + 16333, 3}, 0x100005EC919},
+    {0x100004EE919, 0x464001, {kw_masks.data() + 16336, 3}, 0x100004EE919},
+    {0x100005E48BB, 0x464001, {kw_masks.data() + 16339, 4}, 0x100005E48BB},
+    {0x100005E49DB, 0x464001, {kw_masks.data() + 16343, 4}, 0x100005E49DB},
+    {0x100004EC9B9, 0x464001, {kw_masks.data() + 16347, 4}, 0x100004EC9B9},
+    {0x100004EC9D9, 0x464001, {kw_masks.data() + 16351, 4}, 0x100004EC9D9},
+    {0x200100004EC9D9, 0x464001, {kw_masks.data() + 16355, 6}, 0x200100004EC9D9},
+    {0x100004E51D9, 0x464001, {kw_masks.data() + 16361, 4}, 0x100004E51D9},
+    {0x100005EC00B, 0x464001, {kw_masks.data() + 16365, 3}, 0x100005EC00B},
+    {0x100004E600B, 0x464001, {kw_masks.data() + 16368, 3}, 0x100004E600B},
+    {0x100006E4DDD, 0x464001, {kw_masks.data() + 16371, 8}, 0x100006EEFDD},
+    {0x100007E4DDF, 0x464001, {kw_masks.data() + 16379, 9}, 0x100007E6FFF},
+    {0x200100004E49D9, 0x464001, {kw_masks.data() + 16388, 9}, 0x200100006EFBDF},
+    {0x200100006E4DDD, 0x464001, {kw_masks.data() + 16397, 10}, 0x200100007E6FDD},
+    {0x200100007E4DDF, 0x464001, {kw_masks.data() + 16407, 12}, 0x200100007E6FFF},
+    {0x200100004E4939, 0x464001, {kw_masks.data() + 16419, 3}, 0x200100004E4939},
+    {0x200100004E49C9, 0x464001, {kw_masks.data() + 16422, 3}, 0x200100004E49C9},
+    {0x200100005E493B, 0x464001, {kw_masks.data() + 16425, 4}, 0x200100005E493B},
+    {0x200100005E49DB, 0x464001, {kw_masks.data() + 16429, 4}, 0x200100005E49DB},
+    {0x100004E7D3F, 0x464001, {kw_masks.data() + 16433, 4}, 0x100004E7D3F},
+    {0x100004E7DCF, 0x464001, {kw_masks.data() + 16437, 4}, 0x100004E7DCF},
+    {0x100004E7D3F, 0x464001, {kw_masks.data() + 16441, 5}, 0x100004E7D3F},
+    {0x100004E7DEF, 0x464001, {kw_masks.data() + 16446, 5}, 0x100004E7DEF},
+    {0x100005E6099, 0x464001, {kw_masks.data() + 16451, 5}, 0x100005E6099},
+    {0x100005E6099, 0x464001, {kw_masks.data() + 16456, 5}, 0x100005E6099},
+    {0x100004E6591, 0x464001, {kw_masks.data() + 16461, 4}, 0x100004E6591},
+    {0x100004E6591, 0x464001, {kw_masks.data() + 16465, 4}, 0x100004E6591},
+    {0x100005E4591, 0x464001, {kw_masks.data() + 16469, 4}, 0x100005E4591},
+    {0x100005E4591, 0x464001, {kw_masks.data() + 16473, 4}, 0x100005E4591},
+    {0x100004E6099, 0x464001, {kw_masks.data() + 16477, 4}, 0x100004E6099},
+    {0x100005E6099, 0x464001, {kw_masks.data() + 16481, 4}, 0x100005E6099},
+    {0x100005E6099, 0x464001, {kw_masks.data() + 16485, 4}, 0x100005E6099},
+    {0x100005E6099, 0x464001, {kw_masks.data() + 16489, 4}, 0x100005E6099},
+    {0x1000006696D, 0x464001, {kw_masks.data() + 16493, 4}, 0x1000046696D},
+    {0x1000006696D, 0x464001, {kw_masks.data() + 16497, 4}, 0x1000046696D},
+    {0x100005E61D5, 0x464001, {kw_masks.data() + 16501, 5}, 0x100005E61D5},
+    {0x100005E61D5, 0x464001, {kw_masks.data() + 16506, 5}, 0x100005E61D5},
+    {0x100004E69FD, 0x464001, {kw_masks.data() + 16511, 6}, 0x100004E69FD},
+    {0x100005E69DD, 0x464001, {kw_masks.data() + 16517, 6}, 0x100005E69DD},
+    {0x100004E61D5, 0x464001, {kw_masks.data() + 16523, 5}, 0x100004E61D5},
+    {0x100004E61D5, 0x464001, {kw_masks.data() + 16528, 5}, 0x100004E61D5},
+    {0x100016AE9DD, 0x464001, {kw_masks.data() + 16533, 5}, 0x100016EE9DD},
+    {0x100007AE1C5, 0x464001, {kw_masks.data() + 16538, 8}, 0x100007EE1DD},
+    {0x100007A61CD, 0x464001, {kw_masks.data() + 16546, 8}, 0x100007EE1DD},
+    {0x100007EE9FD, 0x464001, {kw_masks.data() + 16554, 6}, 0x100007EE9FD},
+    {0x100007EE1DD, 0x464001, {kw_masks.data() + 16560, 6}, 0x100007EE1DD},
+    {0x200100004E4DDD, 0x464001, {kw_masks.data() + 16566, 5}, 0x200100004E4DDD},
+    {0x200100004E6D3D, 0x464001, {kw_masks.data() + 16571, 5}, 0x200100004E6D3D},
+    {0x100004EED15, 0x464001, {kw_masks.data() + 16576, 4}, 0x100004EED15},
+    {0x100004E7D17, 0x464001, {kw_masks.data() + 16580, 4}, 0x100004E7D17},
+    {0x100005EFD95, 0x464001, {kw_masks.data() + 16584, 5}, 0x100005EFD95},
+    {0x100005EED95, 0x464001, {kw_masks.data() + 16589, 5}, 0x100005EED95},
+    {0x100005E5DD5, 0x464001, {kw_masks.data() + 16594, 5}, 0x100005E5DD5},
+    {0x100005E7D35, 0x464001, {kw_masks.data() + 16599, 5}, 0x100005E7D35},
+    {0x100004E6D1D, 0x464001, {kw_masks.data() + 16604, 4}, 0x100004E6D1D},
+    {0x10000464D1D, 0x464001, {kw_masks.data() + 16608, 4}, 0x10000464D1D},
+    {0x100006E49FB, 0x464001, {kw_masks.data() + 16612, 5}, 0x100006E49FB},
+    {0x100006E49FB, 0x464001, {kw_masks.data() + 16617, 5}, 0x100006E49FB},
+    {0x100006E49FB, 0x464001, {kw_masks.data() + 16622, 5}, 0x100006E49FB},
+    {0x100005EC9DB, 0x464001, {kw_masks.data() + 16627, 4}, 0x100005EC9DB},
+    {0x100005EC9BB, 0x464001, {kw_masks.data() + 16631, 4}, 0x100005EC9BB},
+    {0x10000DE41C9, 0x464001, {kw_masks.data() + 16635, 3}, 0x10000DE41C9},
+    {0x100005E59F5, 0x464001, {kw_masks.data() + 16638, 6}, 0x100005E59F5},
+    {0x200100005ED9BD, 0x464001, {kw_masks.data() + 16644, 6}, 0x200100005ED9BD},
+    {0x100005AE9FB, 0x464001, {kw_masks.data() + 16650, 6}, 0x100005EE9FB},
+    {0x100005AE9FB, 0x464001, {kw_masks.data() + 16656, 6}, 0x100005EE9FB},
+    {0x100005AE9FB, 0x464001, {kw_masks.data() + 16662, 6}, 0x100005EE9FB},
+    {0x100005AE9FB, 0x464001, {kw_masks.data() + 16668, 6}, 0x100005EE9FB},
+    {0x100001AE9F3, 0x464001, {kw_masks.data() + 16674, 5}, 0x100005EE9F3},
+    {0x100005AE1CB, 0x464001, {kw_masks.data() + 16679, 5}, 0x100005EE1CB},
+    {0x100004AE9FB, 0x464001, {kw_masks.data() + 16684, 5}, 0x100004EE9FB},
+    {0x100005AE8BB, 0x464001, {kw_masks.data() + 16689, 5}, 0x100005EE8BB},
+    {0x100005EE9BB, 0x464001, {kw_masks.data() + 16694, 5}, 0x100005EE9BB},
+    {0x100005EE1CB, 0x464001, {kw_masks.data() + 16699, 5}, 0x100005EE1CB},
+    {0x100005EE1CB, 0x464001, {kw_masks.data() + 16704, 5}, 0x100005EE1CB},
+    {0x100004EE1CB, 0x464001, {kw_masks.data() + 16709, 5}, 0x100004EE1CB},
+    {0x100004EE9BB, 0x464001, {kw_masks.data() + 16714, 5}, 0x100004EE9BB},
+    {0x100004EE1CB, 0x464001, {kw_masks.data() + 16719, 5}, 0x100004EE1CB},
+    {0x100005EE9BB, 0x464001, {kw_masks.data() + 16724, 5}, 0x100005EE9BB},
+    {0x100004EE9BB, 0x464001, {kw_masks.data() + 16729, 5}, 0x100004EE9BB},
+    {0x100005EF9BB, 0x464001, {kw_masks.data() + 16734, 5}, 0x100005EF9BB},
+    {0x100005EF1EB, 0x464001, {kw_masks.data() + 16739, 5}, 0x100005EF1EB},
+    {0x100005EF1EB, 0x464001, {kw_masks.data() + 16744, 5}, 0x100005EF1EB},
+    {0x100004EF1EB, 0x464001, {kw_masks.data() + 16749, 5}, 0x100004EF1EB},
+    {0x100004EF9BB, 0x464001, {kw_masks.data() + 16754, 5}, 0x100004EF9BB},
+    {0x100004EF1EB, 0x464001, {kw_masks.data() + 16759, 5}, 0x100004EF1EB},
+    {0x100005EF9BB, 0x464001, {kw_masks.data() + 16764, 5}, 0x100005EF9BB},
+    {0x100004EF9BB, 0x464001, {kw_masks.data() + 16769, 5}, 0x100004EF9BB},
+    {0x100007EE9BB, 0x464001, {kw_masks.data() + 16774, 6}, 0x100007EE9BB},
+    {0x100005EE9FB, 0x464001, {kw_masks.data() + 16780, 6}, 0x100005EE9FB},
+    {0x100007EE1DB, 0x464001, {kw_masks.data() + 16786, 6}, 0x100007EE1DB},
+    {0x100004EE9FB, 0x464001, {kw_masks.data() + 16792, 6}, 0x100004EE9FB},
+    {0x100007EE9FB, 0x464001, {kw_masks.data() + 16798, 6}, 0x100007EE9FB},
+    {0x100006EE9FB, 0x464001, {kw_masks.data() + 16804, 6}, 0x100006EE9FB},
+    {0x100007EE9FB, 0x464001, {kw_masks.data() + 16810, 6}, 0x100007EE9FB},
+    {0x100006EE9FB, 0x464001, {kw_masks.data() + 16816, 6}, 0x100006EE9FB},
+    {0x100007EE9FB, 0x464001, {kw_masks.data() + 16822, 7}, 0x100007EE9FB},
+    {0x100004EE9FB, 0x464001, {kw_masks.data() + 16829, 7}, 0x100004EE9FB},
+    {0x100007EE9DB, 0x464001, {kw_masks.data() + 16836, 7}, 0x100007EE9DB},
+    {0x100004EE9DB, 0x464001, {kw_masks.data() + 16843, 7}, 0x100004EE9DB},
+    {0x100005EE9FB, 0x464001, {kw_masks.data() + 16850, 7}, 0x100005EE9FB},
+    {0x100005EE9FB, 0x464001, {kw_masks.data() + 16857, 7}, 0x100005EE9FB},
+    {0x100005A69DB, 0x464001, {kw_masks.data() + 16864, 5}, 0x100005E69DB},
+    {0x100007F69DB, 0x464001, {kw_masks.data() + 16869, 5}, 0x100007F69DB},
+    {0x100006EC9DB, 0x464001, {kw_masks.data() + 16874, 5}, 0x100006EC9DB},
+    {0x100006EC93B, 0x464001, {kw_masks.data() + 16879, 5}, 0x100006EC93B},
+    {0x100006EC9DB, 0x464001, {kw_masks.data() + 16884, 5}, 0x100006EC9DB},
+    {0x100007F59DB, 0x464001, {kw_masks.data() + 16889, 5}, 0x100007F59DB},
+    {0x200100006E68BB, 0x464001, {kw_masks.data() + 16894, 5}, 0x200100006E68BB},
+    {0x200100005E68F9, 0x464001, {kw_masks.data() + 16899, 5}, 0x200100005E68F9},
+    {0x200100006E61DB, 0x464001, {kw_masks.data() + 16904, 5}, 0x200100006E61DB},
+    {0x100007E41DB, 0x464001, {kw_masks.data() + 16909, 4}, 0x100007E41DB},
+    {0x100005E48FB, 0x464001, {kw_masks.data() + 16913, 4}, 0x100005E48FB},
+    {0x100007EC83B, 0x464001, {kw_masks.data() + 16917, 4}, 0x100007EC83B},
+    {0x100000C09B1, 0x464001, {kw_masks.data() + 16921, 3}, 0x100004E49B1},
+    {0x100000E09E1, 0x464001, {kw_masks.data() + 16924, 3}, 0x100004E49E1},
+    {0x100001C89A1, 0x464001, {kw_masks.data() + 16927, 3}, 0x100005EC9A1},
+    {0x100004C69A9, 0x464001, {kw_masks.data() + 16930, 3}, 0x100004E69A9},
+    {0x100004E79F9, 0x464001, {kw_masks.data() + 16933, 5}, 0x100004E79F9},
+    {0x100005EF9D9, 0x464001, {kw_masks.data() + 16938, 5}, 0x100005EF9D9},
+    {0x100004E79D9, 0x464001, {kw_masks.data() + 16943, 5}, 0x100004E79D9},
+    {0x100004E79D9, 0x464001, {kw_masks.data() + 16948, 5}, 0x100004E79D9},
+    {0x100005E79F9, 0x464001, {kw_masks.data() + 16953, 5}, 0x100005E79F9},
+    {0x100005EF9D9, 0x464001, {kw_masks.data() + 16958, 5}, 0x100005EF9D9},
+    {0x100005E79D9, 0x464001, {kw_masks.data() + 16963, 5}, 0x100005E79D9},
+    {0x100005E79D9, 0x464001, {kw_masks.data() + 16968, 5}, 0x100005E79D9},
+    {0x100004E69F9, 0x464001, {kw_masks.data() + 16973, 5}, 0x100004E69F9},
+    {0x100005EE9D9, 0x464001, {kw_masks.data() + 16978, 5}, 0x100005EE9D9},
+    {0x100004E69D9, 0x464001, {kw_masks.data() + 16983, 5}, 0x100004E69D9},
+    {0x100004E69D9, 0x464001, {kw_masks.data() + 16988, 5}, 0x100004E69D9},
+    {0x100005F59B9, 0x464001, {kw_masks.data() + 16993, 5}, 0x100005F59B9},
+    {0x100005FD999, 0x464001, {kw_masks.data() + 16998, 5}, 0x100005FD999},
+    {0x100005F59D9, 0x464001, {kw_masks.data() + 17003, 5}, 0x100005F59D9},
+    {0x100005F7999, 0x464001, {kw_masks.data() + 17008, 5}, 0x100005F7999},
+    {0x100005F49B9, 0x464001, {kw_masks.data() + 17013, 4}, 0x100005F49B9},
+    {0x100005FC999, 0x464001, {kw_masks.data() + 17017, 4}, 0x100005FC999},
+    {0x100005F49D9, 0x464001, {kw_masks.data() + 17021, 4}, 0x100005F49D9},
+    {0x100005F6999, 0x464001, {kw_masks.data() + 17025, 4}, 0x100005F6999},
+    {0x100017F49B9, 0x464001, {kw_masks.data() + 17029, 5}, 0x100017F49B9},
+    {0x100017FC999, 0x464001, {kw_masks.data() + 17034, 5}, 0x100017FC999},
+    {0x100017F49D9, 0x464001, {kw_masks.data() + 17039, 5}, 0x100017F49D9},
+    {0x100017F6999, 0x464001, {kw_masks.data() + 17044, 5}, 0x100017F6999},
+    {0x100017F49F9, 0x464001, {kw_masks.data() + 17049, 6}, 0x100017F49F9},
+    {0x100017FC9D9, 0x464001, {kw_masks.data() + 17055, 6}, 0x100017FC9D9},
+    {0x100017F49D9, 0x464001, {kw_masks.data() + 17061, 6}, 0x100017F49D9},
+    {0x100017F69D9, 0x464001, {kw_masks.data() + 17067, 6}, 0x100017F69D9},
+    {0x200100004E69F9, 0x464001, {kw_masks.data() + 17073, 6}, 0x200100004E69F9},
+    {0x200100005EE9F9, 0x464001, {kw_masks.data() + 17079, 6}, 0x200100005EE9F9},
+    {0x200100004E69F9, 0x464001, {kw_masks.data() + 17085, 6}, 0x200100004E69F9},
+    {0x200100004E69F9, 0x464001, {kw_masks.data() + 17091, 6}, 0x200100004E69F9},
+    {0x200100005E79F9, 0x464001, {kw_masks.data() + 17097, 6}, 0x200100005E79F9},
+    {0x200100005EF9F9, 0x464001, {kw_masks.data() + 17103, 6}, 0x200100005EF9F9},
+    {0x200100005E79F9, 0x464001, {kw_masks.data() + 17109, 6}, 0x200100005E79F9},
+    {0x200100005E79F9, 0x464001, {kw_masks.data() + 17115, 6}, 0x200100005E79F9},
+    {0x200100004E69FB, 0x464001, {kw_masks.data() + 17121, 6}, 0x200100004E69FB},
+    {0x200100005EE9FB, 0x464001, {kw_masks.data() + 17127, 6}, 0x200100005EE9FB},
+    {0x200100004E69FB, 0x464001, {kw_masks.data() + 17133, 6}, 0x200100004E69FB},
+    {0x200100004E69FB, 0x464001, {kw_masks.data() + 17139, 6}, 0x200100004E69FB},
+    {0x200100016E69F9, 0x464001, {kw_masks.data() + 17145, 6}, 0x200100016E69F9},
+    {0x200100017EE9F9, 0x464001, {kw_masks.data() + 17151, 6}, 0x200100017EE9F9},
+    {0x200100016E69F9, 0x464001, {kw_masks.data() + 17157, 6}, 0x200100016E69F9},
+    {0x200100016E69F9, 0x464001, {kw_masks.data() + 17163, 6}, 0x200100016E69F9},
+    {0x200100016E69F9, 0x464001, {kw_masks.data() + 17169, 7}, 0x200100016E69F9},
+    {0x200100017EE9F9, 0x464001, {kw_masks.data() + 17176, 7}, 0x200100017EE9F9},
+    {0x200100016E69F9, 0x464001, {kw_masks.data() + 17183, 7}, 0x200100016E69F9},
+    {0x200100016E69F9, 0x464001, {kw_masks.data() + 17190, 7}, 0x200100016E69F9},
+    {0x200100004EE979, 0x464001, {kw_masks.data() + 17197, 4}, 0x200100004EE979},
+    {0x200100005EE179, 0x464001, {kw_masks.data() + 17201, 4}, 0x200100005EE179},
+    {0x200100004EE1F9, 0x464001, {kw_masks.data() + 17205, 4}, 0x200100004EE1F9},
+    {0x200100004EE179, 0x464001, {kw_masks.data() + 17209, 4}, 0x200100004EE179},
+    {0x100005F4839, 0x464001, {kw_masks.data() + 17213, 3}, 0x100005F4839},
+    {0x1000057C019, 0x464001, {kw_masks.data() + 17216, 3}, 0x1000057C019},
+    {0x100005F41D9, 0x464001, {kw_masks.data() + 17219, 3}, 0x100005F41D9},
+    {0x10000576019, 0x464001, {kw_masks.data() + 17222, 3}, 0x10000576019},
+    {0x100004ED83D, 0x464001, {kw_masks.data() + 17225, 3}, 0x100004ED83D},
+    {0x1000056D01D, 0x464001, {kw_masks.data() + 17228, 3}, 0x1000056D01D},
+    {0x100004ED1DD, 0x464001, {kw_masks.data() + 17231, 3}, 0x100004ED1DD},
+    {0x1000046F01D, 0x464001, {kw_masks.data() + 17234, 3}, 0x1000046F01D},
+    {0x100016ED8BD, 0x464001, {kw_masks.data() + 17237, 4}, 0x100016ED8BD},
+    {0x1000176D09D, 0x464001, {kw_masks.data() + 17241, 4}, 0x1000176D09D},
+    {0x100016ED1DD, 0x464001, {kw_masks.data() + 17245, 4}, 0x100016ED1DD},
+    {0x1000166F09D, 0x464001, {kw_masks.data() + 17249, 4}, 0x1000166F09D},
+    {0x100016E48B9, 0x464001, {kw_masks.data() + 17253, 3}, 0x100016E48B9},
+    {0x1000176C099, 0x464001, {kw_masks.data() + 17256, 3}, 0x1000176C099},
+    {0x100016E41D9, 0x464001, {kw_masks.data() + 17259, 3}, 0x100016E41D9},
+    {0x10001666099, 0x464001, {kw_masks.data() + 17262, 3}, 0x10001666099},
+    {0x200100004E6939, 0x464001, {kw_masks.data() + 17265, 4}, 0x200100004E6939},
+    {0x2001000056E139, 0x464001, {kw_masks.data() + 17269, 4}, 0x2001000056E139},
+    {0x200100004E61F9, 0x464001, {kw_masks.data() + 17273, 4}, 0x200100004E61F9},
+    {0x20010000466139, 0x464001, {kw_masks.data() + 17277, 4}, 0x20010000466139},
+    {0x200100004E61B1, 0x464001, {kw_masks.data() + 17281, 5}, 0x200100004E61B1},
+    {0x200100004E61B1, 0x464001, {kw_masks.data() + 17286, 5}, 0x200100004E61B1},
+    {0x200100005E61B1, 0x464001, {kw_masks.data() + 17291, 5}, 0x200100005E61B1},
+    {0x200100005E61B1, 0x464001, {kw_masks.data() + 17296, 5}, 0x200100005E61B1},
+    {0x200100004E69F1, 0x464001, {kw_masks.data() + 17301, 5}, 0x200100004E69F1},
+    {0x2001000056E139, 0x464001, {kw_masks.data() + 17306, 5}, 0x2001000056E139},
+    {0x200100004E49FB, 0x464001, {kw_masks.data() + 17311, 6}, 0x200100004E49FB},
+    {0x200100005EC9DB, 0x464001, {kw_masks.data() + 17317, 6}, 0x200100005EC9DB},
+    {0x200100004E49DB, 0x464001, {kw_masks.data() + 17323, 6}, 0x200100004E49DB},
+    {0x200100004E69DB, 0x464001, {kw_masks.data() + 17329, 6}, 0x200100004E69DB},
+    {0x200100004E69DB, 0x464001, {kw_masks.data() + 17335, 7}, 0x200100004E69DB},
+    {0x200100004E69DB, 0x464001, {kw_masks.data() + 17342, 7}, 0x200100004E69DB},
+    {0x200100005E49DB, 0x464001, {kw_masks.data() + 17349, 7}, 0x200100005E49DB},
+    {0x200100005E49DB, 0x464001, {kw_masks.data() + 17356, 7}, 0x200100005E49DB},
+    {0x200100004E49BB, 0x464001, {kw_masks.data() + 17363, 5}, 0x200100004E49BB},
+    {0x2001000056C19B, 0x464001, {kw_masks.data() + 17368, 5}, 0x2001000056C19B},
+    {0x200100004E41DB, 0x464001, {kw_masks.data() + 17373, 5}, 0x200100004E41DB},
+    {0x2001000046619B, 0x464001, {kw_masks.data() + 17378, 5}, 0x2001000046619B},
+    {0x200100004E619B, 0x464001, {kw_masks.data() + 17383, 6}, 0x200100004E619B},
+    {0x200100004E619B, 0x464001, {kw_masks.data() + 17389, 6}, 0x200100004E619B},
+    {0x200100005E419B, 0x464001, {kw_masks.data() + 17395, 6}, 0x200100005E419B},
+    {0x200100005E419B, 0x464001, {kw_masks.data() + 17401, 6}, 0x200100005E419B},
+    {0x200100005E59BB, 0x464001, {kw_masks.data() + 17407, 6}, 0x200100005E59BB},
+    {0x2001000056D19B, 0x464001, {kw_masks.data() + 17413, 6}, 0x2001000056D19B},
+    {0x200100005E51DB, 0x464001, {kw_masks.data() + 17419, 6}, 0x200100005E51DB},
+    {0x2001000056719B, 0x464001, {kw_masks.data() + 17425, 6}, 0x2001000056719B},
+    {0x200100005E719B, 0x464001, {kw_masks.data() + 17431, 7}, 0x200100005E719B},
+    {0x200100005E719B, 0x464001, {kw_masks.data() + 17438, 7}, 0x200100005E719B},
+    {0x200100005E519B, 0x464001, {kw_masks.data() + 17445, 7}, 0x200100005E519B},
+    {0x200100005E519B, 0x464001, {kw_masks.data() + 17452, 7}, 0x200100005E519B},
+    {0x200100016E49BB, 0x464001, {kw_masks.data() + 17459, 6}, 0x200100016E49BB},
+    {0x2001000176C19B, 0x464001, {kw_masks.data() + 17465, 6}, 0x2001000176C19B},
+    {0x200100016E41DB, 0x464001, {kw_masks.data() + 17471, 6}, 0x200100016E41DB},
+    {0x2001000166619B, 0x464001, {kw_masks.data() + 17477, 6}, 0x2001000166619B},
+    {0x200100016E619B, 0x464001, {kw_masks.data() + 17483, 7}, 0x200100016E619B},
+    {0x200100016E619B, 0x464001, {kw_masks.data() + 17490, 7}, 0x200100016E619B},
+    {0x200100017E419B, 0x464001, {kw_masks.data() + 17497, 7}, 0x200100017E419B},
+    {0x200100017E419B, 0x464001, {kw_masks.data() + 17504, 7}, 0x200100017E419B},
+    {0x200100016E49BB, 0x464001, {kw_masks.data() + 17511, 7}, 0x200100016E49BB},
+    {0x2001000176C19B, 0x464001, {kw_masks.data() + 17518, 7}, 0x2001000176C19B},
+    {0x200100016E41DB, 0x464001, {kw_masks.data() + 17525, 7}, 0x200100016E41DB},
+    {0x2001000166619B, 0x464001, {kw_masks.data() + 17532, 7}, 0x2001000166619B},
+    {0x200100016E619B, 0x464001, {kw_masks.data() + 17539, 8}, 0x200100016E619B},
+    {0x200100016E619B, 0x464001, {kw_masks.data() + 17547, 8}, 0x200100016E619B},
+    {0x200100017E419B, 0x464001, {kw_masks.data() + 17555, 8}, 0x200100017E419B},
+    {0x200100017E419B, 0x464001, {kw_masks.data() + 17563, 8}, 0x200100017E419B},
+    {0x100004E69F9, 0x464001, {kw_masks.data() + 17571, 3}, 0x100004E69F9},
+    {0x100005EE9D9, 0x464001, {kw_masks.data() + 17574, 3}, 0x100005EE9D9},
+    {0x100004E69D9, 0x464001, {kw_masks.data() + 17577, 3}, 0x100004E69D9},
+    {0x100004E69D9, 0x464001, {kw_masks.data() + 17580, 3}, 0x100004E69D9},
+    {0x100004E69F9, 0x464001, {kw_masks.data() + 17583, 6}, 0x100004E69F9},
+    {0x100005EE9D9, 0x464001, {kw_masks.data() + 17589, 6}, 0x100005EE9D9},
+    {0x100004E69D9, 0x464001, {kw_masks.data() + 17595, 6}, 0x100004E69D9},
+    {0x100004E69D9, 0x464001, {kw_masks.data() + 17601, 6}, 0x100004E69D9},
+    {0x100004E69BD, 0x464001, {kw_masks.data() + 17607, 4}, 0x100004E69BD},
+    {0x100005EE99D, 0x464001, {kw_masks.data() + 17611, 4}, 0x100005EE99D},
+    {0x100004E69DD, 0x464001, {kw_masks.data() + 17615, 4}, 0x100004E69DD},
+    {0x100004E699D, 0x464001, {kw_masks.data() + 17619, 4}, 0x100004E699D},
+    {0x100016E61B9, 0x464001, {kw_masks.data() + 17623, 5}, 0x100016E61B9},
+    {0x100016E41B9, 0x464001, {kw_masks.data() + 17628, 6}, 0x100016E41B9},
+    {0x100016E69B9, 0x464001, {kw_masks.data() + 17634, 6}, 0x100016E69B9},
+    {0x100016E61B9, 0x464001, {kw_masks.data() + 17640, 6}, 0x100016E61B9},
+    {0x200100004E59BB, 0x464001, {kw_masks.data() + 17646, 5}, 0x200100004E59BB},
+    {0x100004E51DB, 0x464001, {kw_masks.data() + 17651, 5}, 0x100004E51DB},
+    {0x100004EC9B9, 0x464001, {kw_masks.data() + 17656, 5}, 0x100004EC9B9},
+    {0x100004EC1D9, 0x464001, {kw_masks.data() + 17661, 5}, 0x100004EC1D9},
+    {0x200100004E49B9, 0x464001, {kw_masks.data() + 17666, 5}, 0x200100004E49B9},
+    {0x200100004E41D9, 0x464001, {kw_masks.data() + 17671, 5}, 0x200100004E41D9},
+    {0x200100004E49F9, 0x464001, {kw_masks.data() + 17676, 5}, 0x200100004E49F9},
+    {0x200100004E49F9, 0x464001, {kw_masks.data() + 17681, 5}, 0x200100004E49F9},
+    {0x200100004E4DBF, 0x464001, {kw_masks.data() + 17686, 6}, 0x200100004E4DBF},
+    {0x200100004E4DDF, 0x464001, {kw_masks.data() + 17692, 6}, 0x200100004E4DDF},
+    {0x200100004E69B9, 0x464001, {kw_masks.data() + 17698, 6}, 0x200100004E69B9},
+    {0x200100004E69F9, 0x464001, {kw_masks.data() + 17704, 6}, 0x200100004E69F9},
+    {0x100004E61B9, 0x464001, {kw_masks.data() + 17710, 5}, 0x100004E61B9},
+    {0x100004E41B9, 0x464001, {kw_masks.data() + 17715, 6}, 0x100004E41B9},
+    {0x100005EE1D9, 0x464001, {kw_masks.data() + 17721, 6}, 0x100005EE1D9},
+    {0x100007EE1DD, 0x464001, {kw_masks.data() + 17727, 7}, 0x100007EE1DD},
+    {0x100004E4DD9, 0x464001, {kw_masks.data() + 17734, 4}, 0x100004E4DD9},
+    {0x100004E6C0F, 0x464001, {kw_masks.data() + 17738, 4}, 0x100004E6C0F},
+    {0x100007F6979, 0x464001, {kw_masks.data() + 17742, 4}, 0x100007F6979},
+    {0x100007FE159, 0x464001, {kw_masks.data() + 17746, 4}, 0x100007FE159},
+    {0x100007F61D9, 0x464001, {kw_masks.data() + 17750, 4}, 0x100007F61D9},
+    {0x100007F6159, 0x464001, {kw_masks.data() + 17754, 4}, 0x100007F6159},
+    {0x100004E70B3, 0x464001, {kw_masks.data() + 17758, 4}, 0x100004E70B3},
+    {0x100004E70B3, 0x464001, {kw_masks.data() + 17762, 4}, 0x100004E70B3},
+    {0x100005E50B3, 0x464001, {kw_masks.data() + 17766, 4}, 0x100005E50B3},
+    {0x100005E50B3, 0x464001, {kw_masks.data() + 17770, 4}, 0x100005E50B3},
+    {0x100004E7839, 0x464001, {kw_masks.data() + 17774, 3}, 0x100004E7839},
+    {0x100004E71E9, 0x464001, {kw_masks.data() + 17777, 3}, 0x100004E71E9},
+    {0x100006E69F9, 0x464001, {kw_masks.data() + 17780, 5}, 0x100006E69F9},
+    {0x100006EE9F9, 0x464001, {kw_masks.data() + 17785, 5}, 0x100006EE9F9},
+    {0x100006EE9FB, 0x464001, {kw_masks.data() + 17790, 6}, 0x100006EE9FB},
+    {0x100006EE9FB, 0x464001, {kw_masks.data() + 17796, 6}, 0x100006EE9FB},
+    {0x100006EE9FB, 0x464001, {kw_masks.data() + 17802, 6}, 0x100006EE9FB},
+    {0x100006EE9FB, 0x464001, {kw_masks.data() + 17808, 6}, 0x100006EE9FB},
+    {0x10000DE69C9, 0x464001, {kw_masks.data() + 17814, 4}, 0x10000DE69C9},
+    {0x100005E69DB, 0x464001, {kw_masks.data() + 17818, 5}, 0x100005E69DB},
+    {0x100004AE9FB, 0x464001, {kw_masks.data() + 17823, 6}, 0x100004EE9FB},
+    {0x24809, 0x1122014, {kw_masks.data() + 17829, 7}, 0xFFFFFFFFFFFFFFFF},
+    {0x82014, 0x1122014, {kw_masks.data() + 17836, 2}, 0x11E2154},
+    {0x10E008, 0x1122014, {kw_masks.data() + 17838, 10}, 0x11EE9DF},
+    {0x10001526414, 0x1122014, {kw_masks.data() + 17848, 3}, 0x10001566554},
+    {0x1002010, 0x1122014, {kw_masks.data() + 17851, 7}, 0x116B357},
+    {0x20010001166154, 0x1122014, {kw_masks.data() + 17858, 3}, 0x20010001166154},
+    {0xFFFFFFFFFFFFFFFF, 0x1122014, {kw_masks.data() + 17861, 5}, 0xFFFFFFFFFFFFFFFF},
+    {0x2124114, 0x1122014, {kw_masks.data() + 17866, 4}, 0x3166156},
+    {0x100000220B5, 0x1122014, {kw_masks.data() + 17870, 4}, 0x100011621F5},
+    {0x20901, 0x1122014, {kw_masks.data() + 17874, 3}, 0x1162955},
+    {0x1900, 0x1122014, {kw_masks.data() + 17877, 3}, 0x1163954},
+    {0x10000022151, 0x1122014, {kw_masks.data() + 17880, 3}, 0x10001162155},
+    {0x100000CA191, 0x1122014, {kw_masks.data() + 17883, 3}, 0x100011EA1D5},
+    {0x128010, 0x1122014, {kw_masks.data() + 17886, 3}, 0x116A154},
+    {0x406000, 0x1122014, {kw_masks.data() + 17889, 4}, 0x156E554},
+    {0x10000462D91, 0x1122014, {kw_masks.data() + 17893, 5}, 0x10001572DD5},
+    {0x100002C7159, 0x1122014, {kw_masks.data() + 17898, 3}, 0x100013E715D},
+    {0x124010, 0x1122014, {kw_masks.data() + 17901, 4}, 0x1166154},
+    {0x1000008ED01, 0x1122014, {kw_masks.data() + 17905, 3}, 0x100011EED55},
+    {0x100001A7D41, 0x1122014, {kw_masks.data() + 17908, 3}, 0x100011E7D55},
+    {0x100000631CD, 0x1122014, {kw_masks.data() + 17911, 2}, 0x100011631DD},
+    {0x1000102B051, 0x1122014, {kw_masks.data() + 17913, 5}, 0x1000116B175},
+    {0x4C010, 0x1122014, {kw_masks.data() + 17918, 3}, 0x116E974},
+    {0x1000112A141, 0x1122014, {kw_masks.data() + 17921, 3}, 0x1000116A155},
+    {0x1E0801, 0x1122014, {kw_masks.data() + 17924, 4}, 0x11E2955},
+    {0x10001322581, 0x1122014, {kw_masks.data() + 17928, 3}, 0x100013625D5},
+    {0x100000021DD, 0x1122014, {kw_masks.data() + 17931, 3}, 0x100011621DD},
+    {0x100003E6910, 0x1122014, {kw_masks.data() + 17934, 4}, 0x100013E6954},
+    {0x4D910, 0x1122014, {kw_masks.data() + 17938, 3}, 0x116F954},
+    {0x100020C25D1, 0x1122014, {kw_masks.data() + 17941, 3}, 0x100031E25D5},
+    {0x1000012A119, 0x1122014, {kw_masks.data() + 17944, 4}, 0x1000116A15D},
+    {0x100001E0D81, 0x1122014, {kw_masks.data() + 17948, 3}, 0x100011E2DD5},
+    {0x1000006754D, 0x1122014, {kw_masks.data() + 17951, 3}, 0x1000116755D},
+    {0x100020A3313, 0x1122014, {kw_masks.data() + 17954, 3}, 0x100031E3357},
+    {0x120812, 0x1122014, {kw_masks.data() + 17957, 3}, 0x1162956},
+    {0x10000026951, 0x1122014, {kw_masks.data() + 17960, 3}, 0x10001166955},
+    {0x86106, 0x1122014, {kw_masks.data() + 17963, 3}, 0x11E6156},
+    {0x10000047140, 0x1122014, {kw_masks.data() + 17966, 2}, 0x10001167154},
+    {0x10001162949, 0x1122014, {kw_masks.data() + 17968, 3}, 0x1000116295D},
+    {0x100008A7D15, 0x18E105, {kw_masks.data() + 17971, 5}, 0x100009AFD77},
+    {0x100001B7501, 0x18E105, {kw_masks.data() + 17976, 4}, 0x100001BFD1F},
+    {0x100000421C1, 0x18E105, {kw_masks.data() + 17980, 9}, 0x100005EF9DF},
+    {0xAA014, 0x18E105, {kw_masks.data() + 17989, 5}, 0x200000001EE155},
+    {0x6B019, 0x18E105, {kw_masks.data() + 17994, 3}, 0x1EF11D},
+    {0x100014EC191, 0x18E105, {kw_masks.data() + 17997, 5}, 0x100015FE9D5},
+    {0x100000EA9B1, 0x18E105, {kw_masks.data() + 18002, 3}, 0x100001EE9F5},
+    {0x100000EE995, 0x18E105, {kw_masks.data() + 18005, 8}, 0x100001EEDDF},
+    {0xE0511, 0x18E105, {kw_masks.data() + 18013, 3}, 0x5EED1D},
+    {0x5005, 0x18E105, {kw_masks.data() + 18016, 8}, 0x1EF99D},
+    {0x2000000114B190, 0x18E105, {kw_masks.data() + 18024, 5}, 0x200000011CF1DD},
+    {0x2C118, 0x18E105, {kw_masks.data() + 18029, 6}, 0x1EF93D},
+    {0x40881, 0x18E105, {kw_masks.data() + 18035, 7}, 0x7FEDFF},
+    {0x6804, 0x18E105, {kw_masks.data() + 18042, 1}, 0x18E905},
+    {0x47914, 0x18E105, {kw_masks.data() + 18043, 2}, 0x200000001CF915},
+    {0x100001F7511, 0x18E105, {kw_masks.data() + 18045, 2}, 0x100001FF515},
+    {0x200000000C2141, 0x18E105, {kw_masks.data() + 18047, 13}, 0x200000005EFDDF},
+    {0x100001FE417, 0x18E105, {kw_masks.data() + 18060, 6}, 0x100001FEDF7},
+    {0x40C87, 0x18E105, {kw_masks.data() + 18066, 4}, 0x7EED9F},
+    {0x100001F4C17, 0x18E105, {kw_masks.data() + 18070, 6}, 0x100001FEDD7},
+    {0x100009A3935, 0x18E105, {kw_masks.data() + 18076, 11}, 0x10000FEF9FD},
+    {0x10000406910, 0x18E105, {kw_masks.data() + 18087, 7}, 0x100005EE9DD},
+    {0x100002A2055, 0x18E105, {kw_masks.data() + 18094, 5}, 0x100003BE557},
+    {0x100011AEC17, 0x18E105, {kw_masks.data() + 18099, 7}, 0x100015AED77},
+    {0x100011E4C17, 0x18E105, {kw_masks.data() + 18106, 7}, 0x100015EEDD7},
+    {0x100A090, 0x18E105, {kw_masks.data() + 18113, 2}, 0x11CE19D},
+    {0x2001000102E5D3, 0x18E105, {kw_masks.data() + 18115, 3}, 0x200100011AE5D7},
+    {0x100001601F9, 0x18E105, {kw_masks.data() + 18118, 2}, 0x100001EE1FD},
+    {0x10000042099, 0x18E105, {kw_masks.data() + 18120, 2}, 0x100001CE19D},
+    {0x10000041099, 0x18E105, {kw_masks.data() + 18122, 2}, 0x100001CF19D},
+    {0x100020A6983, 0x18E105, {kw_masks.data() + 18124, 5}, 0x100021FE99F},
+    {0x100003A691F, 0x18E105, {kw_masks.data() + 18129, 3}, 0x100003AE91F},
+    {0x1000050691A, 0x18E105, {kw_masks.data() + 18132, 3}, 0x1000058E91F},
+    {0x100000EC8B1, 0x18E105, {kw_masks.data() + 18135, 9}, 0x100001FFDFD},
+    {0x100000EC1D1, 0x18E105, {kw_masks.data() + 18144, 8}, 0x100001FFDD5},
+    {0x100004EC9D1, 0x18E105, {kw_masks.data() + 18152, 8}, 0x100005FFDD5},
+    {0x200108003F7DD9, 0x18E105, {kw_masks.data() + 18160, 6}, 0x200108003FFDDD},
+    {0x100001B7D31, 0x18E105, {kw_masks.data() + 18166, 8}, 0x100001FFD3F},
+    {0x100001B75C1, 0x18E105, {kw_masks.data() + 18174, 7}, 0x100001FFDDF},
+    {0x100005B7DC1, 0x18E105, {kw_masks.data() + 18181, 8}, 0x100005FFDDF},
+    {0x200108003F7DDB, 0x18E105, {kw_masks.data() + 18189, 6}, 0x200108003FFDDF},
+    {0x10000062159, 0x18E105, {kw_masks.data() + 18195, 7}, 0x100001EED5F},
+    {0x1000016695B, 0x18E105, {kw_masks.data() + 18202, 6}, 0x100001EED5F},
+    {0x180812, 0x18E105, {kw_masks.data() + 18208, 5}, 0x1EFD1F},
+    {0x100001A2953, 0x18E105, {kw_masks.data() + 18213, 2}, 0x100001AE957},
+    {0x100000A6819, 0x18E105, {kw_masks.data() + 18215, 3}, 0x100001AE91D},
+    {0x100004A4819, 0x18E105, {kw_masks.data() + 18218, 3}, 0x100005AE91D},
+    {0x48910, 0x18E105, {kw_masks.data() + 18221, 7}, 0x21EF99D},
+    {0x1000108E191, 0x18E105, {kw_masks.data() + 18228, 4}, 0x100011CE19D},
+    {0x10000029910, 0x18E105, {kw_masks.data() + 18232, 7}, 0x100001EF9DD},
+    {0x100001EE1D9, 0x18E105, {kw_masks.data() + 18239, 5}, 0x100011EF1DD},
+    {0x29110, 0x18E105, {kw_masks.data() + 18244, 3}, 0x1EF135},
+    {0x1000012D91A, 0x18E105, {kw_masks.data() + 18247, 4}, 0x100001EF99F},
+    {0x100000A9910, 0x18E105, {kw_masks.data() + 18251, 7}, 0x100181EF99D},
+    {0x10000269118, 0x18E105, {kw_masks.data() + 18258, 2}, 0x100003EF11D},
+    {0x1000036D91A, 0x18E105, {kw_masks.data() + 18260, 3}, 0x100003EF91F},
+    {0x100002E9918, 0x18E105, {kw_masks.data() + 18263, 3}, 0x100003EF91D},
+    {0xA0015, 0x18E105, {kw_masks.data() + 18266, 1}, 0x1AE115},
+    {0x200100001FFD71, 0x18E105, {kw_masks.data() + 18267, 7}, 0x200100001FFD75},
+    {0x200100001FFDD1, 0x18E105, {kw_masks.data() + 18274, 7}, 0x200100001FFDD5},
+    {0x10000023435, 0x18E105, {kw_masks.data() + 18281, 7}, 0x100001EF7FD},
+    {0x100009A7D1F, 0x18E105, {kw_masks.data() + 18288, 7}, 0x300009AFD5F},
+    {0xA6153, 0x18E105, {kw_masks.data() + 18295, 2}, 0x1AE157},
+    {0x226910, 0x18E105, {kw_masks.data() + 18297, 5}, 0x3EFD55},
+    {0x1A2118, 0x18E105, {kw_masks.data() + 18302, 3}, 0x1AE55D},
+    {0x100000A0195, 0x18E105, {kw_masks.data() + 18305, 5}, 0x100001FE195},
+    {0x100000EE115, 0x18E105, {kw_masks.data() + 18310, 3}, 0x100001EE115},
+    {0xE1111, 0x18E105, {kw_masks.data() + 18313, 3}, 0x1EF51D},
+    {0x1000118A892, 0x18E105, {kw_masks.data() + 18316, 2}, 0x1000118E997},
+    {0x100000E69A5, 0x18E105, {kw_masks.data() + 18318, 6}, 0x100013EEDFD},
+    {0x100005F0DB7, 0x18E105, {kw_masks.data() + 18324, 4}, 0x100005FEDB7},
+    {0x100005F0DD7, 0x18E105, {kw_masks.data() + 18328, 4}, 0x100005FEDD7},
+    {0x100001F7D1B, 0x18E105, {kw_masks.data() + 18332, 3}, 0x100001FFD1F},
+    {0x100009F7D15, 0x18E105, {kw_masks.data() + 18335, 3}, 0x100009FFD15},
+    {0x100009F7D15, 0x18E105, {kw_masks.data() + 18338, 8}, 0xB00009FFD57},
+    {0x100000E6151, 0x18E105, {kw_masks.data() + 18346, 3}, 0x100001EE155},
+    {0x1000066E95C, 0x18E105, {kw_masks.data() + 18349, 3}, 0x100007EE95D},
+    {0x100005E0C3F, 0x18E105, {kw_masks.data() + 18352, 3}, 0x100005EED3F},
+    {0x100005E0DDF, 0x18E105, {kw_masks.data() + 18355, 3}, 0x100005EEDDF},
+    {0x100004E4D11, 0x18E105, {kw_masks.data() + 18358, 2}, 0x100005EED15},
+    {0x1000026791C, 0x18E105, {kw_masks.data() + 18360, 2}, 0x100003EF91D},
+    {0x1000014C814, 0x18E105, {kw_masks.data() + 18362, 2}, 0x100001CE915},
+    {0x100016E6D5D, 0x18E105, {kw_masks.data() + 18364, 4}, 0x100017EED5D},
+    {0x10000167955, 0x18E105, {kw_masks.data() + 18368, 11}, 0xFFFFFFFFFFFFFFFF},
+    {0x100005420C9, 0x18E105, {kw_masks.data() + 18379, 2}, 0x100005CE1CD},
+    {0x100003A2118, 0x18E105, {kw_masks.data() + 18381, 2}, 0x100003AE11D},
+    {0x100005AFD35, 0x18E105, {kw_masks.data() + 18383, 5}, 0x100005EFDB5},
+    {0x100001AE19D, 0x18E105, {kw_masks.data() + 18388, 3}, 0x100001AE19D},
+    {0x10000139919, 0x18E105, {kw_masks.data() + 18391, 2}, 0x100001BF91D},
+    {0x100001AE12D, 0x18E105, {kw_masks.data() + 18393, 3}, 0x100001AE12D},
+    {0x1000038E13D, 0x18E105, {kw_masks.data() + 18396, 6}, 0x10000BBE57D},
+    {0x1000058E10D, 0x18E105, {kw_masks.data() + 18402, 3}, 0x1000058E10D},
+    {0x100001A5429, 0x18E105, {kw_masks.data() + 18405, 3}, 0x100001AF52D},
+    {0x100000E401C, 0x18E105, {kw_masks.data() + 18408, 2}, 0x100001EE11D},
+    {0xA6904, 0x18E105, {kw_masks.data() + 18410, 5}, 0x11EF99F},
+    {0x100003E493D, 0x18E105, {kw_masks.data() + 18415, 3}, 0x100003EE93D},
+    {0x100001E7DD3, 0x18E105, {kw_masks.data() + 18418, 4}, 0x100001EFDD7},
+    {0x100001E7DDB, 0x18E105, {kw_masks.data() + 18422, 5}, 0x100001EFDDF},
+    {0x100001E6D37, 0x18E105, {kw_masks.data() + 18427, 3}, 0x100001EED37},
+    {0x100001E65D7, 0x18E105, {kw_masks.data() + 18430, 3}, 0x100001EE5D7},
+    {0x100001E6D3F, 0x18E105, {kw_masks.data() + 18433, 4}, 0x100001EED3F},
+    {0x100001E65DF, 0x18E105, {kw_masks.data() + 18437, 4}, 0x100001EE5DF},
+    {0x100000EFD19, 0x18E105, {kw_masks.data() + 18441, 3}, 0x100001EFD1D},
+    {0x100000EFD19, 0x18E105, {kw_masks.data() + 18444, 4}, 0x100001EFD1D},
+    {0x100000EF519, 0x18E105, {kw_masks.data() + 18448, 3}, 0x100001EF51D},
+    {0x100000EED37, 0x18E105, {kw_masks.data() + 18451, 3}, 0x100001EED37},
+    {0x100000EE5D7, 0x18E105, {kw_masks.data() + 18454, 3}, 0x100001EE5D7},
+    {0x10000170119, 0x18E105, {kw_masks.data() + 18457, 2}, 0x100001FE11D},
+    {0x100000E7D3F, 0x18E105, {kw_masks.data() + 18459, 4}, 0x100001EFD3F},
+    {0x100000E75DF, 0x18E105, {kw_masks.data() + 18463, 4}, 0x100001EF5DF},
+    {0x100000E691D, 0x18E105, {kw_masks.data() + 18467, 2}, 0x100001EE91D},
+    {0x6C0C1, 0x18E105, {kw_masks.data() + 18469, 1}, 0x1EE1C5},
+    {0x1000006C4F9, 0x18E105, {kw_masks.data() + 18470, 2}, 0x100001EE5FD},
+    {0x1000026C4F9, 0x18E105, {kw_masks.data() + 18472, 3}, 0x100003EE5FD},
+    {0x10CC999, 0x18E105, {kw_masks.data() + 18475, 2}, 0x11CE99D},
+    {0x100000C481A, 0x18E105, {kw_masks.data() + 18477, 2}, 0x100001CE91F},
+    {0x1000046600D, 0x18E105, {kw_masks.data() + 18479, 2}, 0x100005EE10D},
+    {0x1000056E00D, 0x18E105, {kw_masks.data() + 18481, 2}, 0x100005EE10D},
+    {0x200100000AE9D9, 0x18E105, {kw_masks.data() + 18483, 6}, 0x200100001EF9DD},
+    {0x1000111E99A, 0x18E105, {kw_masks.data() + 18489, 3}, 0x1000119E99F},
+    {0x100002A615B, 0x18E105, {kw_masks.data() + 18492, 3}, 0x100003AE15F},
+    {0x1000002B887, 0x18E105, {kw_masks.data() + 18495, 2}, 0x100001AF987},
+    {0x100014EA199, 0x18E105, {kw_masks.data() + 18497, 2}, 0x100015EE19D},
+    {0x100006A69DB, 0x18E105, {kw_masks.data() + 18499, 3}, 0x100007AE9DF},
+    {0x100004ECCB7, 0x18E105, {kw_masks.data() + 18502, 4}, 0x100005EEDB7},
+    {0x100004ECDD7, 0x18E105, {kw_masks.data() + 18506, 4}, 0x100005EEDD7},
+    {0x1000068499B, 0x18E105, {kw_masks.data() + 18510, 3}, 0x1000078E99F},
+    {0x1000048499A, 0x18E105, {kw_masks.data() + 18513, 3}, 0x1000058E99F},
+    {0x100007B09B7, 0x18E105, {kw_masks.data() + 18516, 4}, 0x100007BE9B7},
+    {0x100007B09D7, 0x18E105, {kw_masks.data() + 18520, 4}, 0x100007BE9D7},
+    {0x100000ACCB7, 0x18E105, {kw_masks.data() + 18524, 4}, 0x100001AEDB7},
+    {0x100000ACDF7, 0x18E105, {kw_masks.data() + 18528, 4}, 0x100001AEDF7},
+    {0x100000A5CB7, 0x18E105, {kw_masks.data() + 18532, 4}, 0x100001AFDB7},
+    {0x100000A5DF7, 0x18E105, {kw_masks.data() + 18536, 4}, 0x100001AFDF7},
+    {0x100015E0D3F, 0x18E105, {kw_masks.data() + 18540, 3}, 0x100015EED3F},
+    {0x100015E05DF, 0x18E105, {kw_masks.data() + 18543, 3}, 0x100015EE5DF},
+    {0x100001EE9BB, 0x18E105, {kw_masks.data() + 18546, 3}, 0x100001EE9BF},
+    {0x100001EE9DB, 0x18E105, {kw_masks.data() + 18549, 3}, 0x100001EE9DF},
+    {0x100007EE11D, 0x18E105, {kw_masks.data() + 18552, 6}, 0x100007EE11D},
+    {0x100007EE11D, 0x18E105, {kw_masks.data() + 18558, 6}, 0x100007EE11D},
+    {0x100001FE13D, 0x18E105, {kw_masks.data() + 18564, 4}, 0x100001FE13D},
+    {0x100002A5539, 0x18E105, {kw_masks.data() + 18568, 3}, 0x100003AF53D},
+    {0x100003F7519, 0x18E105, {kw_masks.data() + 18571, 5}, 0x100003FF51D},
+    {0x100002A091D, 0x18E105, {kw_masks.data() + 18576, 2}, 0x100003AE91D},
+    {0x100000AE140, 0x18E105, {kw_masks.data() + 18578, 2}, 0x100001AE145},
+    {0x100004ED919, 0x18E105, {kw_masks.data() + 18580, 4}, 0x100005EF91D},
+    {0x100001A701D, 0x18E105, {kw_masks.data() + 18584, 2}, 0x100001AF11D},
+    {0x100000E4119, 0x18E105, {kw_masks.data() + 18586, 2}, 0x100001EE11D},
+    {0x1000006511D, 0x18E105, {kw_masks.data() + 18588, 2}, 0x100001EF11D},
+    {0x100001E791C, 0x18E105, {kw_masks.data() + 18590, 2}, 0x100001EF91D},
+    {0x100005A09F9, 0x18E105, {kw_masks.data() + 18592, 3}, 0x100005AE9FD},
+    {0x100005A01D9, 0x18E105, {kw_masks.data() + 18595, 3}, 0x100005AE1DD},
+    {0x100001A2059, 0x18E105, {kw_masks.data() + 18598, 2}, 0x100001AE15D},
+    {0x100000CE9F5, 0x18E105, {kw_masks.data() + 18600, 4}, 0x100001CE9F5},
+    {0x200100004C5099, 0x18E105, {kw_masks.data() + 18604, 4}, 0x200100005CF19D},
+    {0x200100000E1099, 0x18E105, {kw_masks.data() + 18608, 3}, 0x200100001EF19D},
+    {0x100001EE9F5, 0x18E105, {kw_masks.data() + 18611, 3}, 0x100001EE9F5},
+    {0x10000AE491D, 0x18E105, {kw_masks.data() + 18614, 3}, 0x10000BEE91D},
+    {0x100016A2955, 0x18E105, {kw_masks.data() + 18617, 3}, 0x100017AE955},
+    {0x189905, 0x18E105, {kw_masks.data() + 18620, 1}, 0x18F905},
+    {0x1000110E89A, 0x18E105, {kw_masks.data() + 18621, 2}, 0x1000118E99F},
+    {0x1000026501D, 0x18E105, {kw_masks.data() + 18623, 2}, 0x100003EF11D},
+    {0x200108007F7D1B, 0x18E105, {kw_masks.data() + 18625, 5}, 0x200108007FFD1F},
+    {0x100005EA9B9, 0x18E105, {kw_masks.data() + 18630, 3}, 0x100005EE9BD},
+    {0x1000016FD1B, 0x18E105, {kw_masks.data() + 18633, 3}, 0x100001EFD1F},
+    {0x100016A6D19, 0x18E105, {kw_masks.data() + 18636, 3}, 0x100017AED1D},
+    {0x100016A6D9B, 0x18E105, {kw_masks.data() + 18639, 4}, 0x100017AED9F},
+    {0x10001604C01, 0x18E105, {kw_masks.data() + 18643, 2}, 0x1000178ED05},
+    {0x10001684D89, 0x18E105, {kw_masks.data() + 18645, 3}, 0x1000178ED8D},
+    {0x100001C5C1F, 0x18E105, {kw_masks.data() + 18648, 3}, 0x100001CFD1F},
+    {0x100001C4918, 0x18E105, {kw_masks.data() + 18651, 4}, 0x100003EE95D},
+    {0x100000A8959, 0x18E105, {kw_masks.data() + 18655, 2}, 0x100001AE95D},
+    {0x1000020591D, 0x18E105, {kw_masks.data() + 18657, 2}, 0x1000038F91D},
+    {0x100001694C1, 0x18E105, {kw_masks.data() + 18659, 2}, 0x100001EF5C5},
+    {0x100003EBC15, 0x18E105, {kw_masks.data() + 18661, 3}, 0x100003EFD15},
+    {0x1000026619C, 0x18E105, {kw_masks.data() + 18664, 3}, 0x100003EE19D},
+    {0x100014EC1C7, 0x18E105, {kw_masks.data() + 18667, 4}, 0x100015EE1C7},
+    {0x100014EC9B7, 0x18E105, {kw_masks.data() + 18671, 4}, 0x100015EE9B7},
+    {0x100000EE955, 0x18E105, {kw_masks.data() + 18675, 4}, 0x100001EE955},
+    {0x10000AA7D1D, 0x18E105, {kw_masks.data() + 18679, 3}, 0x10000BAFD1D},
+    {0x100003F7D19, 0x18E105, {kw_masks.data() + 18682, 3}, 0x100003FFD1D},
+    {0x100005F4DB7, 0x18E105, {kw_masks.data() + 18685, 4}, 0x100005FEDB7},
+    {0x100005F45D7, 0x18E105, {kw_masks.data() + 18689, 4}, 0x100005FE5D7},
+    {0x100005F4DBF, 0x18E105, {kw_masks.data() + 18693, 5}, 0x100005FEDBF},
+    {0x100005F4DDF, 0x18E105, {kw_masks.data() + 18698, 5}, 0x100005FEDDF},
+    {0x100000EE9B1, 0x18E105, {kw_masks.data() + 18703, 4}, 0x100001EE9B5},
+    {0x100000EE9F1, 0x18E105, {kw_masks.data() + 18707, 4}, 0x100001EE9F5},
+    {0x100000EF9B3, 0x18E105, {kw_masks.data() + 18711, 4}, 0x100001EF9B7},
+    {0x100000EF9F3, 0x18E105, {kw_masks.data() + 18715, 4}, 0x100001EF9F7},
+    {0x1000111E992, 0x18E105, {kw_masks.data() + 18719, 2}, 0x1000119E997},
+    {0x10002CE69CB, 0x48091, {kw_masks.data() + 18721, 8}, 0x1008AEEF9DF},
+    {0x10003EE69DB, 0x48091, {kw_masks.data() + 18729, 4}, 0x10003EEE9DB},
+    {0x10000EE69DF, 0x48091, {kw_masks.data() + 18733, 8}, 0x10048EEF9DF},
+    {0x10001EE69DF, 0x48091, {kw_masks.data() + 18741, 4}, 0x10001EEE9DF},
+    {0x10002CEE9DB, 0x48091, {kw_masks.data() + 18745, 6}, 0x10002CEE9DB},
+    {0x10003EEE9DB, 0x48091, {kw_masks.data() + 18751, 6}, 0x10003EEE9DB},
+    {0x10000EEE9DF, 0x48091, {kw_masks.data() + 18757, 6}, 0x10000EEE9DF},
+    {0x10001EEE9DF, 0x48091, {kw_masks.data() + 18763, 6}, 0x10001EEE9DF},
+    {0x10002DFE9DB, 0x48091, {kw_masks.data() + 18769, 6}, 0x10002DFE9DB},
+    {0x10003FFE9DB, 0x48091, {kw_masks.data() + 18775, 6}, 0x10003FFE9DB},
+    {0x10000FFE9DF, 0x48091, {kw_masks.data() + 18781, 6}, 0x10000FFE9DF},
+    {0x10001FFE9DF, 0x48091, {kw_masks.data() + 18787, 6}, 0x10001FFE9DF},
+    {0x10000CE69CB, 0x48091, {kw_masks.data() + 18793, 9}, 0x10108EEF9DF},
+    {0x10001EE69DB, 0x48091, {kw_masks.data() + 18802, 6}, 0x10001EEE9DB},
+    {0x10001EE69DB, 0x48091, {kw_masks.data() + 18808, 6}, 0x10001EEE9DB},
+    {0x10001EE61DB, 0x48091, {kw_masks.data() + 18814, 5}, 0x10001EEE1DB},
+    {0x10000CE69FB, 0x48091, {kw_masks.data() + 18819, 9}, 0x10208EEF9FF},
+    {0x10001EE69FB, 0x48091, {kw_masks.data() + 18828, 6}, 0x10001EEE9FB},
+    {0x10001EE69FB, 0x48091, {kw_masks.data() + 18834, 6}, 0x10001EEE9FB},
+    {0x10001EE69FB, 0x48091, {kw_masks.data() + 18840, 5}, 0x10001EEE9FB},
+    {0x10000DEE9CB, 0x48091, {kw_masks.data() + 18845, 9}, 0x10408FEF9DF},
+    {0x10001FEE9DB, 0x48091, {kw_masks.data() + 18854, 6}, 0x10001FEE9DB},
+    {0x10001FEE9DB, 0x48091, {kw_masks.data() + 18860, 6}, 0x10001FEE9DB},
+    {0x10001FEE1DB, 0x48091, {kw_masks.data() + 18866, 5}, 0x10001FEE1DB},
+    {0x10000DEE9FB, 0x48091, {kw_masks.data() + 18871, 9}, 0x10808FEF9FF},
+    {0x10001FEE9FB, 0x48091, {kw_masks.data() + 18880, 6}, 0x10001FEE9FB},
+    {0x10001FEE9FB, 0x48091, {kw_masks.data() + 18886, 6}, 0x10001FEE9FB},
+    {0x10001FEE9FB, 0x48091, {kw_masks.data() + 18892, 5}, 0x10001FEE9FB},
+    {0x10000EE69DF, 0x48091, {kw_masks.data() + 18897, 9}, 0x10014EEF9DF},
+    {0x10001EE69DF, 0x48091, {kw_masks.data() + 18906, 10}, 0x10025EEF9DF},
+    {0x10001FEE9DB, 0x48091, {kw_masks.data() + 18916, 7}, 0x10001FEE9DB},
+    {0x10001FEE9DB, 0x48091, {kw_masks.data() + 18923, 7}, 0x10001FEE9DB},
+    {0x10001EE69DF, 0x48091, {kw_masks.data() + 18930, 6}, 0x10001EEE9DF},
+    {0x10001FEE9DB, 0x48091, {kw_masks.data() + 18936, 7}, 0x10001FEE9DB},
+    {0x10001FEE9DB, 0x48091, {kw_masks.data() + 18943, 7}, 0x10001FEE9DB},
+    {0x10001EE69DF, 0x48091, {kw_masks.data() + 18950, 5}, 0x10001EEE9DF},
+    {0x10000EE69FF, 0x48091, {kw_masks.data() + 18955, 9}, 0x10018EEF9FF},
+    {0x10001EE69FF, 0x48091, {kw_masks.data() + 18964, 10}, 0x10045EEF9FF},
+    {0x10001FEE9FB, 0x48091, {kw_masks.data() + 18974, 7}, 0x10001FEE9FB},
+    {0x10001FEE9FB, 0x48091, {kw_masks.data() + 18981, 7}, 0x10001FEE9FB},
+    {0x10001EE69FF, 0x48091, {kw_masks.data() + 18988, 6}, 0x10001EEE9FF},
+    {0x10001FEE9FB, 0x48091, {kw_masks.data() + 18994, 7}, 0x10001FEE9FB},
+    {0x10001FEE9FB, 0x48091, {kw_masks.data() + 19001, 7}, 0x10001FEE9FB},
+    {0x10001EE69FF, 0x48091, {kw_masks.data() + 19008, 5}, 0x10001EEE9FF},
+    {0x10002CE69CB, 0x48091, {kw_masks.data() + 19013, 9}, 0x10012EEF9DF},
+    {0x10001EE69FB, 0x48091, {kw_masks.data() + 19022, 7}, 0x10001EEE9FB},
+    {0x10001EE69FB, 0x48091, {kw_masks.data() + 19029, 7}, 0x10001EEE9FB},
+    {0x10003EE69DB, 0x48091, {kw_masks.data() + 19036, 10}, 0x10017EEF9DF},
+    {0x10003EE69DB, 0x48091, {kw_masks.data() + 19046, 6}, 0x10003EEE9DB},
+    {0x10001EE69FB, 0x48091, {kw_masks.data() + 19052, 7}, 0x10001EEE9FB},
+    {0x10001EE69FB, 0x48091, {kw_masks.data() + 19059, 7}, 0x10001EEE9FB},
+    {0x10003EE69DB, 0x48091, {kw_masks.data() + 19066, 5}, 0x10003EEE9DB},
+    {0x10002DEE9CB, 0x48091, {kw_masks.data() + 19071, 9}, 0x10032FEF9DF},
+    {0x10001FEE9FB, 0x48091, {kw_masks.data() + 19080, 7}, 0x10001FEE9FB},
+    {0x10001FEE9FB, 0x48091, {kw_masks.data() + 19087, 7}, 0x10001FEE9FB},
+    {0x10003FEE9DB, 0x48091, {kw_masks.data() + 19094, 10}, 0x1000FFEF9DF},
+    {0x10003FEE9DB, 0x48091, {kw_masks.data() + 19104, 6}, 0x10003FEE9DB},
+    {0x10001FEE9FB, 0x48091, {kw_masks.data() + 19110, 7}, 0x10001FEE9FB},
+    {0x10001FEE9FB, 0x48091, {kw_masks.data() + 19117, 7}, 0x10001FEE9FB},
+    {0x10003FEE9DB, 0x48091, {kw_masks.data() + 19124, 5}, 0x10003FEE9DB},
+    {0x10002EE69DF, 0x48091, {kw_masks.data() + 19129, 9}, 0x10052EEF9DF},
+    {0x10001EE69FF, 0x48091, {kw_masks.data() + 19138, 7}, 0x10001EEE9FF},
+    {0x10001EE69FF, 0x48091, {kw_masks.data() + 19145, 7}, 0x10001EEE9FF},
+    {0x10003EE69DF, 0x48091, {kw_masks.data() + 19152, 10}, 0x1002BEEF9DF},
+    {0x10003FEE9DB, 0x48091, {kw_masks.data() + 19162, 7}, 0x10003FEE9DB},
+    {0x10003FEE9DB, 0x48091, {kw_masks.data() + 19169, 7}, 0x10003FEE9DB},
+    {0x10003EE69DF, 0x48091, {kw_masks.data() + 19176, 6}, 0x10003EEE9DF},
+    {0x10001FEE9FB, 0x48091, {kw_masks.data() + 19182, 8}, 0x10001FEE9FB},
+    {0x10001FEE9FB, 0x48091, {kw_masks.data() + 19190, 8}, 0x10001FEE9FB},
+    {0x10001FEE9FB, 0x48091, {kw_masks.data() + 19198, 8}, 0x10001FEE9FB},
+    {0x10001FEE9FB, 0x48091, {kw_masks.data() + 19206, 8}, 0x10001FEE9FB},
+    {0x10003FEE9DB, 0x48091, {kw_masks.data() + 19214, 7}, 0x10003FEE9DB},
+    {0x10003FEE9DB, 0x48091, {kw_masks.data() + 19221, 7}, 0x10003FEE9DB},
+    {0x10001EE69FF, 0x48091, {kw_masks.data() + 19228, 7}, 0x10001EEE9FF},
+    {0x10001EE69FF, 0x48091, {kw_masks.data() + 19235, 7}, 0x10001EEE9FF},
+    {0x10003EE69DF, 0x48091, {kw_masks.data() + 19242, 5}, 0x10003EEE9DF},
+    {0x10002DE69DB, 0x48091, {kw_masks.data() + 19247, 6}, 0x10002DEE9DB},
+    {0x10003FE69DB, 0x48091, {kw_masks.data() + 19253, 6}, 0x10003FEE9DB},
+    {0x10000FE69DF, 0x48091, {kw_masks.data() + 19259, 6}, 0x10000FEE9DF},
+    {0x10001FE69DF, 0x48091, {kw_masks.data() + 19265, 6}, 0x10001FEE9DF},
+    {0x10002DE69DB, 0x48091, {kw_masks.data() + 19271, 4}, 0x10002DEE9DB},
+    {0x10000FE695F, 0x48091, {kw_masks.data() + 19275, 4}, 0x10000FEE9DF},
+    {0x10000DE69DB, 0x48091, {kw_masks.data() + 19279, 6}, 0x10000DEE9DB},
+    {0x10000DE69DB, 0x48091, {kw_masks.data() + 19285, 6}, 0x10000DEE9DB},
+    {0x10000DE69DB, 0x48091, {kw_masks.data() + 19291, 5}, 0x10000DEE9DB},
+    {0x10000DE697B, 0x48091, {kw_masks.data() + 19296, 6}, 0x10000DEE9FB},
+    {0x10000DE697B, 0x48091, {kw_masks.data() + 19302, 6}, 0x10000DEE9FB},
+    {0x10000DE697B, 0x48091, {kw_masks.data() + 19308, 5}, 0x10000DEE9FB},
+    {0x10000DEE9DB, 0x48091, {kw_masks.data() + 19313, 6}, 0x10000DEE9DB},
+    {0x10000DEE9DB, 0x48091, {kw_masks.data() + 19319, 6}, 0x10000DEE9DB},
+    {0x10000DEE9DB, 0x48091, {kw_masks.data() + 19325, 5}, 0x10000DEE9DB},
+    {0x10000DEE97B, 0x48091, {kw_masks.data() + 19330, 6}, 0x10000DEE9FB},
+    {0x10000DEE97B, 0x48091, {kw_masks.data() + 19336, 6}, 0x10000DEE9FB},
+    {0x10000DEE97B, 0x48091, {kw_masks.data() + 19342, 5}, 0x10000DEE9FB},
+    {0x10000FE69DF, 0x48091, {kw_masks.data() + 19347, 6}, 0x10000FEE9DF},
+    {0x10000FE69DF, 0x48091, {kw_masks.data() + 19353, 6}, 0x10000FEE9DF},
+    {0x10000FE69DF, 0x48091, {kw_masks.data() + 19359, 5}, 0x10000FEE9DF},
+    {0x10000FE697F, 0x48091, {kw_masks.data() + 19364, 6}, 0x10000FEE9FF},
+    {0x10000FE697F, 0x48091, {kw_masks.data() + 19370, 6}, 0x10000FEE9FF},
+    {0x10000FE697F, 0x48091, {kw_masks.data() + 19376, 5}, 0x10000FEE9FF},
+    {0x10002DE69DB, 0x48091, {kw_masks.data() + 19381, 6}, 0x10002DEE9DB},
+    {0x10002DE69DB, 0x48091, {kw_masks.data() + 19387, 6}, 0x10002DEE9DB},
+    {0x10002DE69DB, 0x48091, {kw_masks.data() + 19393, 5}, 0x10002DEE9DB},
+    {0x10002DEE9DB, 0x48091, {kw_masks.data() + 19398, 6}, 0x10002DEE9DB},
+    {0x10002DEE9DB, 0x48091, {kw_masks.data() + 19404, 6}, 0x10002DEE9DB},
+    {0x10002DEE9DB, 0x48091, {kw_masks.data() + 19410, 5}, 0x10002DEE9DB},
+    {0x10002FE69DF, 0x48091, {kw_masks.data() + 19415, 6}, 0x10002FEE9DF},
+    {0x10002FE69DF, 0x48091, {kw_masks.data() + 19421, 6}, 0x10002FEE9DF},
+    {0x10002FE69DF, 0x48091, {kw_masks.data() + 19427, 5}, 0x10002FEE9DF},
+    {0x10000CE69CF, 0x48091, {kw_masks.data() + 19432, 6}, 0x10000CEE9DF},
+    {0x10000CE69FF, 0x48091, {kw_masks.data() + 19438, 6}, 0x10000CEE9FF},
+    {0x10000DEE9FF, 0x48091, {kw_masks.data() + 19444, 6}, 0x10000DEE9FF},
+    {0x10000DEE9CF, 0x48091, {kw_masks.data() + 19450, 6}, 0x10000DEE9DF},
+    {0x10000DEE9FB, 0x48091, {kw_masks.data() + 19456, 8}, 0x10000DEE9FB},
+    {0x10000DEE9FB, 0x48091, {kw_masks.data() + 19464, 8}, 0x10000DEE9FB},
+    {0x10000CE69CF, 0x48091, {kw_masks.data() + 19472, 5}, 0x10000CEE9DF},
+    {0x10000CE69FB, 0x48091, {kw_masks.data() + 19477, 4}, 0x10000CEE9FB},
+    {0x10000DEE9CB, 0x48091, {kw_masks.data() + 19481, 4}, 0x10000DEE9DB},
+    {0x10000CE69CB, 0x48091, {kw_masks.data() + 19485, 4}, 0x10000CEE9DB},
+    {0x10000CE69CB, 0x48091, {kw_masks.data() + 19489, 4}, 0x10000CEE9DB},
+    {0x10001EE69FB, 0x48091, {kw_masks.data() + 19493, 4}, 0x10001EEE9FB},
+    {0x10001F6E1DB, 0x48091, {kw_masks.data() + 19497, 4}, 0x10001F6E1DB},
+    {0x10001EE61DB, 0x48091, {kw_masks.data() + 19501, 4}, 0x10001EEE1DB},
+    {0x10001E661DB, 0x48091, {kw_masks.data() + 19505, 4}, 0x10001E6E1DB},
+    {0x10001EE69FB, 0x48091, {kw_masks.data() + 19509, 6}, 0x10001EEE9FB},
+    {0x10001FEE9DB, 0x48091, {kw_masks.data() + 19515, 6}, 0x10001FEE9DB},
+    {0x10001EE69FB, 0x48091, {kw_masks.data() + 19521, 6}, 0x10001EEE9FB},
+    {0x10001FEE9DB, 0x48091, {kw_masks.data() + 19527, 6}, 0x10001FEE9DB},
+    {0x1000012CCB7, 0x48091, {kw_masks.data() + 19533, 3}, 0x1000016CCB7},
+    {0x100004A6DD6, 0x48091, {kw_masks.data() + 19536, 4}, 0x100004EEDD7},
+    {0x100005B6C17, 0x48091, {kw_masks.data() + 19540, 4}, 0x100005FEC97},
+    {0x100004E4DD6, 0x48091, {kw_masks.data() + 19544, 4}, 0x100004ECDD7},
+    {0x10000424CB7, 0x48091, {kw_masks.data() + 19548, 3}, 0x1000046CCB7},
+    {0x100006E4DF6, 0x48091, {kw_masks.data() + 19551, 4}, 0x100006ECDF7},
+    {0x100005F4C97, 0x48091, {kw_masks.data() + 19555, 4}, 0x100005FCC97},
+    {0x100006E6DD6, 0x48091, {kw_masks.data() + 19559, 4}, 0x100006EEDD7},
+    {0x10000104C26, 0x48091, {kw_masks.data() + 19563, 3}, 0x1000014CDBF},
+    {0x100002C6DF6, 0x48091, {kw_masks.data() + 19566, 4}, 0x100002CEDF7},
+    {0x100001F4CB7, 0x48091, {kw_masks.data() + 19570, 4}, 0x100001FCCB7},
+    {0x100002C4DF6, 0x48091, {kw_masks.data() + 19574, 4}, 0x100002CCDF7},
+    {0x10000084CB7, 0x48091, {kw_masks.data() + 19578, 3}, 0x100000CCCB7},
+    {0x100000E4DF6, 0x48091, {kw_masks.data() + 19581, 4}, 0x100000ECDF7},
+    {0x100001B6C37, 0x48091, {kw_masks.data() + 19585, 4}, 0x100001FECB7},
+    {0x10000086DF6, 0x48091, {kw_masks.data() + 19589, 4}, 0x100000CEDF7},
+    {0x100000A4DE7, 0x48091, {kw_masks.data() + 19593, 3}, 0x100000ECDF7},
+    {0x100000C09D9, 0x48091, {kw_masks.data() + 19596, 2}, 0x100000C89D9},
+    {0x10000141199, 0x48091, {kw_masks.data() + 19598, 5}, 0x100001CDDBD},
+    {0x10000060499, 0x48091, {kw_masks.data() + 19603, 2}, 0x10000068499},
+    {0x100001AEDD6, 0x48091, {kw_masks.data() + 19605, 4}, 0x100001EEDD7},
+    {0x100000A6DD6, 0x48091, {kw_masks.data() + 19609, 4}, 0x100000EEDD7},
+    {0x100005B6839, 0x48091, {kw_masks.data() + 19613, 3}, 0x100005FE8B9},
+    {0x100005B69D9, 0x48091, {kw_masks.data() + 19616, 3}, 0x100005FE9D9},
+    {0x100001BA839, 0x48091, {kw_masks.data() + 19619, 3}, 0x100001FA8B9},
+    {0x100005BE9F9, 0x48091, {kw_masks.data() + 19622, 5}, 0x100005FE9F9},
+    {0x100005BE9F9, 0x48091, {kw_masks.data() + 19627, 5}, 0x100005FE9F9},
+    {0x100005BE9F9, 0x48091, {kw_masks.data() + 19632, 5}, 0x100005FE9F9},
+    {0x100005BE9F9, 0x48091, {kw_masks.data() + 19637, 5}, 0x100005FE9F9},
+    {0x100001BA1D9, 0x48091, {kw_masks.data() + 19642, 3}, 0x100001FA1D9},
+    {0x100005BE9F9, 0x48091, {kw_masks.data() + 19645, 5}, 0x100005FE9F9},
+    {0x100005BE9F9, 0x48091, {kw_masks.data() + 19650, 5}, 0x100005FE9F9},
+    {0x10000170939, 0x48091, {kw_masks.data() + 19655, 7}, 0x100009FFDFF},
+    {0x10000574891, 0x48091, {kw_masks.data() + 19662, 7}, 0x100015FD99F},
+    {0x100005F699D, 0x48091, {kw_masks.data() + 19669, 6}, 0x100005FE99D},
+    {0x100005F69FD, 0x48091, {kw_masks.data() + 19675, 7}, 0x100005FFDFF},
+    {0x100025F69B1, 0x48091, {kw_masks.data() + 19682, 4}, 0x100025FE9B1},
+    {0x100007F09B5, 0x48091, {kw_masks.data() + 19686, 4}, 0x100007F89B5},
+    {0x100001F69F5, 0x48091, {kw_masks.data() + 19690, 4}, 0x100001FE9F5},
+    {0x100005FC9F1, 0x48091, {kw_masks.data() + 19694, 6}, 0x100005FC9F1},
+    {0x100005FC9F1, 0x48091, {kw_masks.data() + 19700, 6}, 0x100005FC9F1},
+    {0x100001F69FD, 0x48091, {kw_masks.data() + 19706, 4}, 0x100001FE9FD},
+    {0x10000171C17, 0x48091, {kw_masks.data() + 19710, 5}, 0x100001FDDD7},
+    {0x100005F1991, 0x48091, {kw_masks.data() + 19715, 4}, 0x100005FD9D5},
+    {0x100000A297D, 0x48091, {kw_masks.data() + 19719, 3}, 0x100000EADFF},
+    {0x100004A68D5, 0x48091, {kw_masks.data() + 19722, 3}, 0x100004EE9D5},
+    {0x100002A297D, 0x48091, {kw_masks.data() + 19725, 6}, 0x100002EFDFF},
+    {0x100006A29D5, 0x48091, {kw_masks.data() + 19731, 3}, 0x100006EA9D5},
+    {0x1000002D979, 0x48091, {kw_masks.data() + 19734, 3}, 0x1000006DDFF},
+    {0x100004AD9D1, 0x48091, {kw_masks.data() + 19737, 2}, 0x100004ED9D1},
+    {0x200100001AE979, 0x48091, {kw_masks.data() + 19739, 7}, 0x200100005EEDFF},
+    {0x200100005AE9D1, 0x48091, {kw_masks.data() + 19746, 7}, 0x200100005EE9D1},
+    {0x200100001EF979, 0x48091, {kw_masks.data() + 19753, 7}, 0x200100001EFDFF},
+    {0x200100005EF9D1, 0x48091, {kw_masks.data() + 19760, 7}, 0x200100005EF9D1},
+    {0x1000118E803, 0x48091, {kw_masks.data() + 19767, 7}, 0x100015EEDD7},
+    {0x200100004AE9D1, 0x48091, {kw_masks.data() + 19774, 9}, 0x200100004EE9D5},
+    {0x200100000EF9F9, 0x48091, {kw_masks.data() + 19783, 7}, 0x200100000EFDFF},
+    {0x200100004EF9D1, 0x48091, {kw_masks.data() + 19790, 7}, 0x200100004EF9D1},
+    {0x200100000AE9F8, 0x48091, {kw_masks.data() + 19797, 6}, 0x200100000EEDFF},
+    {0x200100004AE9D0, 0x48091, {kw_masks.data() + 19803, 9}, 0x200100004EE9FD},
+    {0x200100004AE979, 0x48091, {kw_masks.data() + 19812, 7}, 0x200100004EEDFF},
+    {0x200100004AE9D9, 0x48091, {kw_masks.data() + 19819, 8}, 0x200100004EF9D9},
+    {0x200100004EF979, 0x48091, {kw_masks.data() + 19827, 7}, 0x200100004EFDFF},
+    {0x200100004EF9D9, 0x48091, {kw_masks.data() + 19834, 7}, 0x200100004EF9D9},
+    {0x100003E6012, 0x48091, {kw_masks.data() + 19841, 7}, 0x100007EEDF7},
+    {0x200100004AE9F1, 0x48091, {kw_masks.data() + 19848, 9}, 0x200100004EF9FD},
+    {0x200100000EF979, 0x48091, {kw_masks.data() + 19857, 7}, 0x200100000EFDFF},
+    {0x200100004EF9F1, 0x48091, {kw_masks.data() + 19864, 7}, 0x200100004EF9F1},
+    {0x200100000AE978, 0x48091, {kw_masks.data() + 19871, 6}, 0x200100000EEDFF},
+    {0x200100004AE9F0, 0x48091, {kw_masks.data() + 19877, 9}, 0x200100004EEDFF},
+    {0x10000007939, 0x48091, {kw_masks.data() + 19886, 3}, 0x1000004FDBF},
+    {0x10000407989, 0x48091, {kw_masks.data() + 19889, 3}, 0x100004CF999},
+    {0x100004879FD, 0x48091, {kw_masks.data() + 19892, 7}, 0x100004CFDFF},
+    {0x100004A69FD, 0x48091, {kw_masks.data() + 19899, 14}, 0x100015EFFFF},
+    {0x2006850, 0x48091, {kw_masks.data() + 19913, 3}, 0x216F9DB},
+    {0x10000424994, 0x48091, {kw_masks.data() + 19916, 4}, 0x100004EE9D5},
+    {0x100000A491C, 0x48091, {kw_masks.data() + 19920, 2}, 0x100000EC99D},
+    {0x100006A09B5, 0x48091, {kw_masks.data() + 19922, 4}, 0x100006E89B5},
+    {0x100000E6914, 0x48091, {kw_masks.data() + 19926, 6}, 0x100011EE9DF},
+    {0x1000002093C, 0x48091, {kw_masks.data() + 19932, 3}, 0x10000068DBF},
+    {0x100000A09BD, 0x48091, {kw_masks.data() + 19935, 5}, 0x100000E8DBF},
+    {0x100000A09FD, 0x48091, {kw_masks.data() + 19940, 5}, 0x100000E8DFF},
+    {0x100004249BD, 0x48091, {kw_masks.data() + 19945, 5}, 0x1000046CDBF},
+    {0x100001289BD, 0x48091, {kw_masks.data() + 19950, 5}, 0x10000168DBF},
+    {0x100001BA9FD, 0x48091, {kw_masks.data() + 19955, 6}, 0x100001FADFF},
+    {0x100001BA93F, 0x48091, {kw_masks.data() + 19961, 8}, 0x100001FADBF},
+    {0x100000A09BD, 0x48091, {kw_masks.data() + 19969, 5}, 0x100000E8DBF},
+    {0x100000A09FD, 0x48091, {kw_masks.data() + 19974, 5}, 0x100000E8DFF},
+    {0x100003E2912, 0x48091, {kw_masks.data() + 19979, 2}, 0x100003EA993},
+    {0x100005F69FD, 0x48091, {kw_masks.data() + 19981, 7}, 0x100007FE9FD},
+    {0x100007EA9B5, 0x48091, {kw_masks.data() + 19988, 5}, 0x100007EA9B5},
+    {0x100006E69B5, 0x48091, {kw_masks.data() + 19993, 5}, 0x100006EE9B5},
+    {0x100001BA93D, 0x48091, {kw_masks.data() + 19998, 5}, 0x100001FA9BD},
+    {0x100001BA9DD, 0x48091, {kw_masks.data() + 20003, 5}, 0x100001FA9DD},
+    {0x100005B69DD, 0x48091, {kw_masks.data() + 20008, 5}, 0x100005FE9DD},
+    {0x100005B693D, 0x48091, {kw_masks.data() + 20013, 5}, 0x100005FE9BD},
+    {0x100001289B5, 0x48091, {kw_masks.data() + 20018, 3}, 0x100001689B5},
+    {0x100004249B5, 0x48091, {kw_masks.data() + 20021, 3}, 0x1000046C9B5},
+    {0x100004A69F9, 0x48091, {kw_masks.data() + 20024, 5}, 0x100004EEDFF},
+    {0x100004A6979, 0x48091, {kw_masks.data() + 20029, 5}, 0x100004EEDFF},
+    {0x100001AA979, 0x48091, {kw_masks.data() + 20034, 5}, 0x100001EADFF},
+    {0x100001AA9F9, 0x48091, {kw_masks.data() + 20039, 5}, 0x100001EADFF},
+    {0x10000584892, 0x48091, {kw_masks.data() + 20044, 3}, 0x100005CC993},
+    {0x100005F0DB7, 0x48091, {kw_masks.data() + 20047, 4}, 0x100005F8DB7},
+    {0x100005F0DF7, 0x48091, {kw_masks.data() + 20051, 4}, 0x100005F8DF7},
+    {0x100005FEDFF, 0x48091, {kw_masks.data() + 20055, 6}, 0x100005FEDFF},
+    {0x100005F6DFF, 0x48091, {kw_masks.data() + 20061, 6}, 0x100005FEDFF},
+    {0x100007F29D7, 0x48091, {kw_masks.data() + 20067, 5}, 0x100007FA9D7},
+    {0x200100005AE9D9, 0x48091, {kw_masks.data() + 20072, 5}, 0x200100005EE9D9},
+    {0x200100005AEDF7, 0x48091, {kw_masks.data() + 20077, 6}, 0x200100005EEDF7},
+    {0x200100005AEDF7, 0x48091, {kw_masks.data() + 20083, 6}, 0x200100005EEDF7},
+    {0x100004249D5, 0x48091, {kw_masks.data() + 20089, 4}, 0x1000046E9D5},
+    {0x100005FA9B9, 0x48091, {kw_masks.data() + 20093, 5}, 0x100005FA9B9},
+    {0x100005F69B9, 0x48091, {kw_masks.data() + 20098, 5}, 0x100005FE9B9},
+    {0x100005F69D9, 0x48091, {kw_masks.data() + 20103, 5}, 0x100005FE9D9},
+    {0x100005FE9D9, 0x48091, {kw_masks.data() + 20108, 6}, 0x100005FE9D9},
+    {0x100005BA9BD, 0x48091, {kw_masks.data() + 20114, 5}, 0x100005FA9BD},
+    {0x100005B69BD, 0x48091, {kw_masks.data() + 20119, 5}, 0x100005FE9BD},
+    {0x100005B69DD, 0x48091, {kw_masks.data() + 20124, 5}, 0x100005FE9DD},
+    {0x100005BE9DD, 0x48091, {kw_masks.data() + 20129, 7}, 0x100005FE9DD},
+    {0x100001AA971, 0x48091, {kw_masks.data() + 20136, 3}, 0x100001EA9F1},
+    {0x100001AA9D1, 0x48091, {kw_masks.data() + 20139, 3}, 0x100001EA9D1},
+    {0x100004A6971, 0x48091, {kw_masks.data() + 20142, 3}, 0x100004EE9F1},
+    {0x100005F1199, 0x48091, {kw_masks.data() + 20145, 7}, 0x100015FD9DD},
+    {0x10000171D1F, 0x48091, {kw_masks.data() + 20152, 4}, 0x100001FDDDF},
+    {0x100004A69D1, 0x48091, {kw_masks.data() + 20156, 3}, 0x100004EE9D1},
+    {0x200100000EEDF7, 0x48091, {kw_masks.data() + 20159, 6}, 0x200100000EEDF7},
+    {0x200100001EEDD7, 0x48091, {kw_masks.data() + 20165, 6}, 0x200100001EEDD7},
+    {0x200100000EEDD7, 0x48091, {kw_masks.data() + 20171, 5}, 0x200100000EEDD7},
+    {0x200100004EEDDF, 0x48091, {kw_masks.data() + 20176, 6}, 0x200100004EEDDF},
+    {0x100010E1DD7, 0x48091, {kw_masks.data() + 20182, 4}, 0x100010E9DD7},
+    {0x100005A599E, 0x48091, {kw_masks.data() + 20186, 4}, 0x100005ED99F},
+    {0x100004A499E, 0x48091, {kw_masks.data() + 20190, 3}, 0x100004EC99F},
+    {0x100016A0995, 0x48091, {kw_masks.data() + 20193, 3}, 0x100016E8995},
+    {0x100016A0995, 0x48091, {kw_masks.data() + 20196, 4}, 0x100016E8995},
+    {0x10001EA1995, 0x48091, {kw_masks.data() + 20200, 4}, 0x10001EE9995},
+    {0x100004E7DD7, 0x48091, {kw_masks.data() + 20204, 5}, 0x100004EFDD7},
+    {0x100001A6059, 0x48091, {kw_masks.data() + 20209, 2}, 0x100001EE0D9},
+    {0x100011F2D17, 0x48091, {kw_masks.data() + 20211, 3}, 0x100011FAD97},
+    {0x100011F1DD7, 0x48091, {kw_masks.data() + 20214, 4}, 0x100011F9DD7},
+    {0x100005F09D1, 0x48091, {kw_masks.data() + 20218, 3}, 0x100005F89D1},
+    {0x100005F1199, 0x48091, {kw_masks.data() + 20221, 3}, 0x100005F9199},
+    {0x100005F499B, 0x48091, {kw_masks.data() + 20224, 4}, 0x100017FC99B},
+    {0x100017F0191, 0x48091, {kw_masks.data() + 20228, 3}, 0x100017F8191},
+    {0x100017F0191, 0x48091, {kw_masks.data() + 20231, 4}, 0x100017F8191},
+    {0x10001FF1991, 0x48091, {kw_masks.data() + 20235, 4}, 0x10001FF9991},
+    {0x100017F7DD7, 0x48091, {kw_masks.data() + 20239, 6}, 0x100017FFDD7},
+    {0x100005F7DDF, 0x48091, {kw_masks.data() + 20245, 5}, 0x100005FFDDF},
+    {0x100001F0051, 0x48091, {kw_masks.data() + 20250, 2}, 0x100001F80D1},
+    {0x10001087D0F, 0x48091, {kw_masks.data() + 20252, 3}, 0x100010CFD9F},
+    {0x10001267D1F, 0x48091, {kw_masks.data() + 20255, 4}, 0x1000126FD9F},
+    {0x10000147D1F, 0x48091, {kw_masks.data() + 20259, 4}, 0x1000014FD9F},
+    {0x100016E7DDF, 0x48091, {kw_masks.data() + 20263, 6}, 0x100016EFDDF},
+    {0x10000587DDF, 0x48091, {kw_masks.data() + 20269, 5}, 0x100005CFDDF},
+    {0x100000A7159, 0x48091, {kw_masks.data() + 20274, 2}, 0x100000EF1D9},
+    {0x10003086D57, 0x48091, {kw_masks.data() + 20276, 3}, 0x100030CEDD7},
+    {0x10003267C57, 0x48091, {kw_masks.data() + 20279, 4}, 0x1000326FCD7},
+    {0x10002147D5F, 0x48091, {kw_masks.data() + 20283, 4}, 0x1000214FDDF},
+    {0x100024C7DD7, 0x48091, {kw_masks.data() + 20287, 5}, 0x100024CFDD7},
+    {0x100000E65D4, 0x48091, {kw_masks.data() + 20292, 3}, 0x100000EE5D5},
+    {0x100000E4DD4, 0x48091, {kw_masks.data() + 20295, 3}, 0x100000ECDD5},
+    {0x1000016555C, 0x48091, {kw_masks.data() + 20298, 3}, 0x1000016D5DD},
+    {0x10000064C5E, 0x48091, {kw_masks.data() + 20301, 3}, 0x1000006CCDF},
+    {0x10001264C5E, 0x48091, {kw_masks.data() + 20304, 4}, 0x1000126CCDF},
+    {0x100012644D5, 0x48091, {kw_masks.data() + 20308, 4}, 0x1000126C4D5},
+    {0x10001AE5CD5, 0x48091, {kw_masks.data() + 20312, 4}, 0x10001AEDCD5},
+    {0x100000E2991, 0x48091, {kw_masks.data() + 20316, 2}, 0x100000EA991},
+    {0x100000E09D1, 0x48091, {kw_masks.data() + 20318, 2}, 0x100000E89D1},
+    {0x100001E1919, 0x48091, {kw_masks.data() + 20320, 2}, 0x100001E9999},
+    {0x100000E491B, 0x48091, {kw_masks.data() + 20322, 2}, 0x100000EC99B},
+    {0x100012E0991, 0x48091, {kw_masks.data() + 20324, 2}, 0x100012E8991},
+    {0x100012E0991, 0x48091, {kw_masks.data() + 20326, 3}, 0x100012E8991},
+    {0x10001AE1991, 0x48091, {kw_masks.data() + 20329, 3}, 0x10001AE9991},
+    {0x100002ECDF9, 0x48091, {kw_masks.data() + 20332, 4}, 0x100002ECDF9},
+    {0x100003ED539, 0x48091, {kw_masks.data() + 20336, 4}, 0x100003ED5B9},
+    {0x100002ECD3B, 0x48091, {kw_masks.data() + 20340, 4}, 0x100002ECDBB},
+    {0x100012EC5B9, 0x48091, {kw_masks.data() + 20344, 4}, 0x100012EC5B9},
+    {0x100012EC5B9, 0x48091, {kw_masks.data() + 20348, 5}, 0x100012EC5B9},
+    {0x10001AEDDB9, 0x48091, {kw_masks.data() + 20353, 5}, 0x10001AEDDB9},
+    {0x100008ECDD9, 0x48091, {kw_masks.data() + 20358, 4}, 0x100008ECDD9},
+    {0x100009ED519, 0x48091, {kw_masks.data() + 20362, 4}, 0x100009ED599},
+    {0x100008ECD1B, 0x48091, {kw_masks.data() + 20366, 4}, 0x100008ECD9B},
+    {0x10001AEC599, 0x48091, {kw_masks.data() + 20370, 4}, 0x10001AEC599},
+    {0x10001AEC599, 0x48091, {kw_masks.data() + 20374, 5}, 0x10001AEC599},
+    {0x10001AEDD99, 0x48091, {kw_masks.data() + 20379, 5}, 0x10001AEDD99},
+    {0x100000ECDD9, 0x48091, {kw_masks.data() + 20384, 4}, 0x100000ECDD9},
+    {0x100001ED5D9, 0x48091, {kw_masks.data() + 20388, 4}, 0x100001ED5D9},
+    {0x100000ECDDB, 0x48091, {kw_masks.data() + 20392, 4}, 0x100000ECDDB},
+    {0x100012EC5D9, 0x48091, {kw_masks.data() + 20396, 4}, 0x100012EC5D9},
+    {0x100012EC5D9, 0x48091, {kw_masks.data() + 20400, 5}, 0x100012EC5D9},
+    {0x100000EEDDF, 0x48091, {kw_masks.data() + 20405, 5}, 0x100000EEDDF},
+    {0x100001EFD9F, 0x48091, {kw_masks.data() + 20410, 5}, 0x100001EFD9F},
+    {0x100000EED9F, 0x48091, {kw_masks.data() + 20415, 4}, 0x100000EED9F},
+    {0x100005EF999, 0x48091, {kw_masks.data() + 20419, 5}, 0x100005EF999},
+    {0x100001EEDFF, 0x48091, {kw_masks.data() + 20424, 5}, 0x100001EEDFF},
+    {0x100001EFD3F, 0x48091, {kw_masks.data() + 20429, 5}, 0x100001EFDBF},
+    {0x100001EED3F, 0x48091, {kw_masks.data() + 20434, 4}, 0x100001EEDBF},
+    {0x100005EF9B9, 0x48091, {kw_masks.data() + 20438, 5}, 0x100005EF9B9},
+    {0x100007EE9F9, 0x48091, {kw_masks.data() + 20443, 7}, 0x100007EE9F9},
+    {0x100002EEDFF, 0x48091, {kw_masks.data() + 20450, 5}, 0x100002EEDFF},
+    {0x100012EEDBF, 0x48091, {kw_masks.data() + 20455, 5}, 0x100012EEDBF},
+    {0x100009EFD1F, 0x48091, {kw_masks.data() + 20460, 5}, 0x100009EFD9F},
+    {0x10001AEED9F, 0x48091, {kw_masks.data() + 20465, 5}, 0x10001AEED9F},
+    {0x10000CEE999, 0x48091, {kw_masks.data() + 20470, 4}, 0x10000CEE999},
+    {0x100001EFDDF, 0x48091, {kw_masks.data() + 20474, 5}, 0x100001EFDDF},
+    {0x100012EEDDF, 0x48091, {kw_masks.data() + 20479, 5}, 0x100012EEDDF},
+    {0x100012EEDDF, 0x48091, {kw_masks.data() + 20484, 6}, 0x100012EEDDF},
+    {0x100016EE9D9, 0x48091, {kw_masks.data() + 20490, 5}, 0x100016EE9D9},
+    {0x100006EEDDF, 0x48091, {kw_masks.data() + 20495, 5}, 0x100006EEDDF},
+    {0x100016EED9F, 0x48091, {kw_masks.data() + 20500, 5}, 0x100016EED9F},
+    {0x100016EE999, 0x48091, {kw_masks.data() + 20505, 5}, 0x100016EE999},
+    {0x100000A295D, 0x48091, {kw_masks.data() + 20510, 2}, 0x100000EA9DD},
+    {0x100002A295D, 0x48091, {kw_masks.data() + 20512, 3}, 0x100002EA9DD},
+    {0x1000017091D, 0x48091, {kw_masks.data() + 20515, 2}, 0x1000017899D},
+    {0x100003F295D, 0x48091, {kw_masks.data() + 20517, 3}, 0x100003FA9DD},
+    {0x100004EE199, 0x48091, {kw_masks.data() + 20520, 4}, 0x100004EE199},
+    {0x10000AA7D1D, 0x10001045906, {kw_masks.data() + 20524, 5}, 0x10001AEFD5F},
+    {0x10000026413, 0x10001045906, {kw_masks.data() + 20529, 6}, 0x100013EFDDF},
+    {0xC6114, 0x10001045906, {kw_masks.data() + 20535, 5}, 0x100014EF9D7},
+    {0x60119, 0x10001045906, {kw_masks.data() + 20540, 3}, 0xFFFFFFFFFFFFFFFF},
+    {0x10AC1C4, 0x10001045906, {kw_masks.data() + 20543, 3}, 0x100010EF9C6},
+    {0x10000181970, 0x10001045906, {kw_masks.data() + 20546, 13}, 0x100013FFDFF},
+    {0x86151, 0x10001045906, {kw_masks.data() + 20559, 6}, 0x100010EF9DF},
+    {0xE0158, 0x10001045906, {kw_masks.data() + 20565, 5}, 0x100010E7D5F},
+    {0x27005, 0x10001045906, {kw_masks.data() + 20570, 4}, 0x1000126F917},
+    {0x20058, 0x10001045906, {kw_masks.data() + 20574, 4}, 0x1000116F9FE},
+    {0x2000000014B900, 0x10001045906, {kw_masks.data() + 20578, 8}, 0x200100491FF957},
+    {0x10000182015, 0x10001045906, {kw_masks.data() + 20586, 3}, 0x100011C7917},
+    {0x100000294C1, 0x10001045906, {kw_masks.data() + 20589, 6}, 0x1000146FDD7},
+    {0x10000085918, 0x10001045906, {kw_masks.data() + 20595, 11}, 0x100011EFDDF},
+    {0x91D, 0x10001045906, {kw_masks.data() + 20606, 1}, 0x1000104591F},
+    {0x100001A19D0, 0x10001045906, {kw_masks.data() + 20607, 11}, 0x100013FFDDF},
+    {0x100003F7519, 0x10001045906, {kw_masks.data() + 20618, 4}, 0x100013F7D1F},
+    {0x100001CF945, 0x10001045906, {kw_masks.data() + 20622, 7}, 0x100011EF95F},
+    {0x10000246148, 0x10001045906, {kw_masks.data() + 20629, 4}, 0x1000134795E},
+    {0x100000E3159, 0x10001045906, {kw_masks.data() + 20633, 2}, 0x100010E795F},
+    {0x100004A4915, 0x10001045906, {kw_masks.data() + 20635, 2}, 0x100014E5917},
+    {0x144090, 0x10001045906, {kw_masks.data() + 20637, 1}, 0x10001145996},
+    {0x1000052C099, 0x10001045906, {kw_masks.data() + 20638, 2}, 0x1000156D99F},
+    {0x10000426099, 0x10001045906, {kw_masks.data() + 20640, 2}, 0x1000146799F},
+    {0x2AC314, 0x10001045906, {kw_masks.data() + 20642, 1}, 0x100012EDB16},
+    {0x2E8114, 0x10001045906, {kw_masks.data() + 20643, 1}, 0x100012ED916},
+    {0x10001602911, 0x10001045906, {kw_masks.data() + 20644, 2}, 0x10001647917},
+    {0x10000082974, 0x10001045906, {kw_masks.data() + 20646, 4}, 0x100011CF977},
+    {0x100000A29D4, 0x10001045906, {kw_masks.data() + 20650, 2}, 0x100010E79D6},
+    {0x100000A4830, 0x10001045906, {kw_masks.data() + 20652, 4}, 0x100014EF93F},
+    {0x100000A49E0, 0x10001045906, {kw_masks.data() + 20656, 2}, 0x100010E59E6},
+    {0x100000AD1C6, 0x10001045906, {kw_masks.data() + 20658, 3}, 0x100010ED9C6},
+    {0x100000AD836, 0x10001045906, {kw_masks.data() + 20661, 3}, 0x100010ED936},
+    {0x100000AC1C4, 0x10001045906, {kw_masks.data() + 20664, 3}, 0x100010ED9C6},
+    {0x100000AC834, 0x10001045906, {kw_masks.data() + 20667, 3}, 0x100010ED936},
+    {0x100002E6158, 0x10001045906, {kw_masks.data() + 20670, 5}, 0x100012E795E},
+    {0x10002176851, 0x10001045906, {kw_masks.data() + 20675, 4}, 0x1000357FD57},
+    {0x20005, 0x10001045906, {kw_masks.data() + 20679, 4}, 0x100010EF917},
+    {0xC3050, 0x10001045906, {kw_masks.data() + 20683, 3}, 0x100011EF977},
+    {0xE4014, 0x10001045906, {kw_masks.data() + 20686, 1}, 0x100010E5916},
+    {0x100000AE89C, 0x10001045906, {kw_masks.data() + 20687, 2}, 0x100010EF99E},
+    {0x100000EE10D, 0x10001045906, {kw_masks.data() + 20689, 3}, 0x100011EF91F},
+    {0x100007F0119, 0x10001045906, {kw_masks.data() + 20692, 2}, 0x100017F591F},
+    {0x100000EE975, 0x10001045906, {kw_masks.data() + 20694, 9}, 0x108810EFD7F},
+    {0x100001E6158, 0x10001045906, {kw_masks.data() + 20703, 5}, 0x100011E7D5F},
+    {0x100000AE834, 0x10001045906, {kw_masks.data() + 20708, 3}, 0x100010EF936},
+    {0x100000AE1D4, 0x10001045906, {kw_masks.data() + 20711, 3}, 0x100010EF9D6},
+    {0x100000A7836, 0x10001045906, {kw_masks.data() + 20714, 3}, 0x100010E7936},
+    {0x100000A71D6, 0x10001045906, {kw_masks.data() + 20717, 3}, 0x100010E79D6},
+    {0x100000AE9F1, 0x10001045906, {kw_masks.data() + 20720, 3}, 0x100010EF9F7},
+    {0x100000A79F3, 0x10001045906, {kw_masks.data() + 20723, 3}, 0x100010E79F7},
+    {0x426020, 0x10001045906, {kw_masks.data() + 20726, 1}, 0x10001467926},
+    {0x41910, 0x10001045906, {kw_masks.data() + 20727, 1}, 0x10001045916},
+    {0x100025EE99B, 0x10001045906, {kw_masks.data() + 20728, 8}, 0x100035EFD9F},
+    {0x1000108E510, 0x10001045906, {kw_masks.data() + 20736, 2}, 0x100010CFD16},
+    {0x100000E41D1, 0x10001045906, {kw_masks.data() + 20738, 4}, 0x100010E5DDF},
+    {0x100008A6957, 0x10001045906, {kw_masks.data() + 20742, 4}, 0x100018E7D57},
+    {0x102441B, 0x10001045906, {kw_masks.data() + 20746, 2}, 0x100011EDD1F},
+    {0x200100000AED77, 0x10001045906, {kw_masks.data() + 20748, 4}, 0x200100010EFD77},
+    {0x200100000AEDD7, 0x10001045906, {kw_masks.data() + 20752, 4}, 0x200100010EFDD7},
+    {0x100000E48B1, 0x10001045906, {kw_masks.data() + 20756, 4}, 0x100010E5DBF},
+    {0x10002022152, 0x10001045906, {kw_masks.data() + 20760, 2}, 0x10003067956},
+    {0x10A290C, 0x10001045906, {kw_masks.data() + 20762, 1}, 0x100010E790E},
+    {0x2001000012E939, 0x10001045906, {kw_masks.data() + 20763, 3}, 0x2001000116F93F},
+    {0x10E1010, 0x10001045906, {kw_masks.data() + 20766, 1}, 0x100010E5916},
+    {0x100001A6801, 0x10001045906, {kw_masks.data() + 20767, 2}, 0x100011E7907},
+    {0x10000067158, 0x10001045906, {kw_masks.data() + 20769, 2}, 0x1000106795E},
+    {0x100000AE915, 0x10001045906, {kw_masks.data() + 20771, 2}, 0x100010EF917},
+    {0x4C810, 0x10001045906, {kw_masks.data() + 20773, 1}, 0x1000104D916},
+    {0x1A6016, 0x10001045906, {kw_masks.data() + 20774, 1}, 0x100011E7916},
+    {0x1E6514, 0x10001045906, {kw_masks.data() + 20775, 1}, 0x100011E7D16},
+    {0x200100011CF937, 0x10001045906, {kw_masks.data() + 20776, 4}, 0x200100011CF937},
+    {0x100011DF9AF, 0x10001045906, {kw_masks.data() + 20780, 5}, 0x100011DF9AF},
+    {0x100011DF93F, 0x10001045906, {kw_masks.data() + 20785, 5}, 0x100011DF93F},
+    {0x100013DF93F, 0x10001045906, {kw_masks.data() + 20790, 5}, 0x100013DF93F},
+    {0x100011DF92F, 0x10001045906, {kw_masks.data() + 20795, 5}, 0x100011DF92F},
+    {0x100011DFB2F, 0x10001045906, {kw_masks.data() + 20800, 5}, 0x100011DFB2F},
+    {0x100011FF93F, 0x10001045906, {kw_masks.data() + 20805, 5}, 0x100011FF93F},
+    {0x100011EF937, 0x10001045906, {kw_masks.data() + 20810, 5}, 0x100011EF937},
+    {0x100011EFB37, 0x10001045906, {kw_masks.data() + 20815, 5}, 0x100011EFB37},
+    {0x100011EF9A7, 0x10001045906, {kw_masks.data() + 20820, 5}, 0x100011EF9A7},
+    {0x100011EFDA7, 0x10001045906, {kw_masks.data() + 20825, 5}, 0x100011EFDA7},
+    {0x100011DF9AF, 0x10001045906, {kw_masks.data() + 20830, 5}, 0x100011DF9AF},
+    {0x100011DFDAF, 0x10001045906, {kw_masks.data() + 20835, 5}, 0x100011DFDAF},
+    {0x200100011DF9BF, 0x10001045906, {kw_masks.data() + 20840, 6}, 0x200100011DF9BF},
+    {0x200100011FF9FF, 0x10001045906, {kw_masks.data() + 20846, 6}, 0x200100011FF9FF},
+    {0x100017EF93F, 0x10001045906, {kw_masks.data() + 20852, 5}, 0x100017EF93F},
+    {0x100017EF9FF, 0x10001045906, {kw_masks.data() + 20857, 5}, 0x100017EF9FF},
+    {0x100015FF93F, 0x10001045906, {kw_masks.data() + 20862, 6}, 0x100015FF93F},
+    {0x100015FF9EF, 0x10001045906, {kw_masks.data() + 20868, 6}, 0x100015FF9EF},
+    {0x100011EFDB7, 0x10001045906, {kw_masks.data() + 20874, 5}, 0x100011EFDB7},
+    {0x100015EFD3F, 0x10001045906, {kw_masks.data() + 20879, 7}, 0x100015EFD3F},
+    {0x100011CF93F, 0x10001045906, {kw_masks.data() + 20886, 5}, 0x100011CF93F},
+    {0x100015FF93F, 0x10001045906, {kw_masks.data() + 20891, 6}, 0x100015FF93F},
+    {0x100011DF93F, 0x10001045906, {kw_masks.data() + 20897, 5}, 0x100011DF93F},
+    {0x100015CFF2F, 0x10001045906, {kw_masks.data() + 20902, 7}, 0x100015CFF2F},
+    {0x100017EF93F, 0x10001045906, {kw_masks.data() + 20909, 5}, 0x100017EF93F},
+    {0x100015FF92F, 0x10001045906, {kw_masks.data() + 20914, 6}, 0x100015FF92F},
+    {0x100013EFD37, 0x10001045906, {kw_masks.data() + 20920, 7}, 0x100017EFD3F},
+    {0x100011CF93F, 0x10001045906, {kw_masks.data() + 20927, 5}, 0x100011CF93F},
+    {0x100011FF93F, 0x10001045906, {kw_masks.data() + 20932, 6}, 0x100011FF93F},
+    {0x100011DF93F, 0x10001045906, {kw_masks.data() + 20938, 5}, 0x100011DF93F},
+    {0x100011CFF27, 0x10001045906, {kw_masks.data() + 20943, 7}, 0x100015CFF2F},
+    {0x100017EF93F, 0x10001045906, {kw_masks.data() + 20950, 5}, 0x100017EF93F},
+    {0x100015FF92F, 0x10001045906, {kw_masks.data() + 20955, 6}, 0x100015FF92F},
+    {0x100011FF93F, 0x10001045906, {kw_masks.data() + 20961, 5}, 0x100011FF93F},
+    {0x100011EF93F, 0x10001045906, {kw_masks.data() + 20966, 5}, 0x100011EF93F},
+    {0x100011EF93F, 0x10001045906, {kw_masks.data() + 20971, 5}, 0x100011EF93F},
+    {0x100011EFB3F, 0x10001045906, {kw_masks.data() + 20976, 5}, 0x100011EFB3F},
+    {0x100011EF93F, 0x10001045906, {kw_masks.data() + 20981, 5}, 0x100011EF93F},
+    {0x100011CFBB7, 0x10001045906, {kw_masks.data() + 20986, 6}, 0x100011CFBB7},
+    {0x100011DF93F, 0x10001045906, {kw_masks.data() + 20992, 5}, 0x100011DF93F},
+    {0x100011EF937, 0x10001045906, {kw_masks.data() + 20997, 5}, 0x100011EF937},
+    {0x100011DF92F, 0x10001045906, {kw_masks.data() + 21002, 5}, 0x100011DF92F},
+    {0x100011EFD3F, 0x10001045906, {kw_masks.data() + 21007, 7}, 0x100015EFD3F},
+    {0x100011EF93F, 0x10001045906, {kw_masks.data() + 21014, 5}, 0x100011EF93F},
+    {0x100011EF93F, 0x10001045906, {kw_masks.data() + 21019, 5}, 0x100011EF93F},
+    {0x100011EFB3F, 0x10001045906, {kw_masks.data() + 21024, 6}, 0x100011EFBBF},
+    {0x100011EF93F, 0x10001045906, {kw_masks.data() + 21030, 6}, 0x100011EF9BF},
+    {0x100015CF9BF, 0x10001045906, {kw_masks.data() + 21036, 6}, 0x100015CF9BF},
+    {0x100011CF9B7, 0x10001045906, {kw_masks.data() + 21042, 6}, 0x100011CF9B7},
+    {0x100011EF93F, 0x10001045906, {kw_masks.data() + 21048, 6}, 0x100011EFD3F},
+    {0x200100011EF9FF, 0x10001045906, {kw_masks.data() + 21054, 6}, 0x200100011EF9FF},
+    {0x100011EF927, 0x10001045906, {kw_masks.data() + 21060, 5}, 0x100011EF927},
+    {0x100011CF93F, 0x10001045906, {kw_masks.data() + 21065, 5}, 0x100011CF93F},
+    {0x100031CF93F, 0x10001045906, {kw_masks.data() + 21070, 4}, 0x100031CF93F},
+    {0x100011CF93F, 0x10001045906, {kw_masks.data() + 21074, 5}, 0x100011CF93F},
+    {0x100011EF93F, 0x10001045906, {kw_masks.data() + 21079, 5}, 0x100011EF93F},
+    {0x100011DF93F, 0x10001045906, {kw_masks.data() + 21084, 6}, 0x100011DF93F},
+    {0x100011DF93F, 0x10001045906, {kw_masks.data() + 21090, 5}, 0x100011DF93F},
+    {0x100015EF93F, 0x10001045906, {kw_masks.data() + 21095, 6}, 0x100015EF93F},
+    {0x100011EF93F, 0x10001045906, {kw_masks.data() + 21101, 6}, 0x100011EF93F},
+    {0x100011CF927, 0x10001045906, {kw_masks.data() + 21107, 4}, 0x100011CF927},
+    {0x100011EF9A7, 0x10001045906, {kw_masks.data() + 21111, 4}, 0x100011EF9A7},
+    {0x100011CF977, 0x10001045906, {kw_masks.data() + 21115, 4}, 0x100011CF977},
+    {0x100011EF9BF, 0x10001045906, {kw_masks.data() + 21119, 5}, 0x100011EF9BF},
+    {0x100011EF93F, 0x10001045906, {kw_masks.data() + 21124, 5}, 0x100011EF93F},
+    {0x100011EF93F, 0x10001045906, {kw_masks.data() + 21129, 5}, 0x100011EF93F},
+    {0x100011EF97F, 0x10001045906, {kw_masks.data() + 21134, 5}, 0x100011EF97F},
+    {0x100011CF9A7, 0x10001045906, {kw_masks.data() + 21139, 4}, 0x100011CF9A7},
+    {0x100000A7495, 0x10001045906, {kw_masks.data() + 21143, 3}, 0x100010E7D97},
+    {0x100024E69D9, 0x10001045906, {kw_masks.data() + 21146, 5}, 0x100034E79DF},
+    {0x1000096E89A, 0x10001045906, {kw_masks.data() + 21151, 3}, 0x1000196F99E},
+    {0x10001045812, 0x10001045906, {kw_masks.data() + 21154, 2}, 0x10001045916},
+    {0x100006A799D, 0x10001045906, {kw_masks.data() + 21156, 4}, 0x100016E799F},
+    {0x100010E7912, 0x10001045906, {kw_masks.data() + 21160, 2}, 0x100010E7916},
+    {0x100011E791E, 0x10001045906, {kw_masks.data() + 21162, 3}, 0x100011E791E},
+    {0x100011E791E, 0x10001045906, {kw_masks.data() + 21165, 3}, 0x100011E791E},
+    {0x1000104D993, 0x10001045906, {kw_masks.data() + 21168, 2}, 0x1000104D997},
+    {0x100010CF906, 0x10001045906, {kw_masks.data() + 21170, 2}, 0x100010CF906},
+    {0x100007F2995, 0x10001045906, {kw_masks.data() + 21172, 6}, 0x100017F7997},
+    {0x100010E7812, 0x10001045906, {kw_masks.data() + 21178, 2}, 0x100010E7916},
+    {0x100012E7D13, 0x10001045906, {kw_masks.data() + 21180, 3}, 0x100012E7D17},
+    {0x10001045892, 0x10001045906, {kw_masks.data() + 21183, 3}, 0x100010E7996},
+    {0x100024A699F, 0x10001045906, {kw_masks.data() + 21186, 5}, 0x100035EF99F},
+    {0x100004A695D, 0x10001045906, {kw_masks.data() + 21191, 5}, 0x100015EFD5F},
+    {0x100004E6D97, 0x10001045906, {kw_masks.data() + 21196, 5}, 0x100014EFD97},
+    {0x1000114780A, 0x10001045906, {kw_masks.data() + 21201, 2}, 0x1000114790E},
+    {0x100010C7813, 0x10001045906, {kw_masks.data() + 21203, 2}, 0x100010C7917},
+    {0x100010E5992, 0x10001045906, {kw_masks.data() + 21205, 2}, 0x100010E5996},
+    {0x200100011EF996, 0x10001045906, {kw_masks.data() + 21207, 5}, 0x200100011EF996},
+    {0x200100011EF916, 0x10001045906, {kw_masks.data() + 21212, 5}, 0x200100011EF916},
+    {0x200100017CF91B, 0x10001045906, {kw_masks.data() + 21217, 5}, 0x200100017CF91F},
+    {0x200100013CD913, 0x10001045906, {kw_masks.data() + 21222, 5}, 0x200100013CD917},
+    {0x100015E793E, 0x10001045906, {kw_masks.data() + 21227, 5}, 0x100015E793E},
+    {0x200100015E7937, 0x10001045906, {kw_masks.data() + 21232, 3}, 0x200100015E7937},
+    {0x100011DF92F, 0x10001045906, {kw_masks.data() + 21235, 4}, 0x100011DF92F},
+    {0x100010EDD1F, 0x10001045906, {kw_masks.data() + 21239, 4}, 0x100010EDD1F},
+    {0x1000036C151, 0x10001045906, {kw_masks.data() + 21243, 2}, 0x1000136D957},
+    {0x1000088A051, 0x10001045906, {kw_masks.data() + 21245, 2}, 0x100018CF957},
+    {0x100010EF916, 0x10001045906, {kw_masks.data() + 21247, 3}, 0x100010EF916},
+    {0x10001067817, 0x10001045906, {kw_masks.data() + 21250, 3}, 0x10001067917},
+    {0x100001EEDB1, 0x10001045906, {kw_masks.data() + 21253, 4}, 0x100011EFDB7},
+    {0x100008EE9B1, 0x10001045906, {kw_masks.data() + 21257, 3}, 0x100018EF9B7},
+    {0x100004EEDB1, 0x10001045906, {kw_masks.data() + 21260, 4}, 0x100014EFDB7},
+    {0x100001EE5D1, 0x10001045906, {kw_masks.data() + 21264, 4}, 0x100011EFDD7},
+    {0x100008EE1D1, 0x10001045906, {kw_masks.data() + 21268, 3}, 0x100018EF9D7},
+    {0x100004EEDD1, 0x10001045906, {kw_masks.data() + 21271, 4}, 0x100014EFDD7},
+    {0x100001FEC37, 0x10001045906, {kw_masks.data() + 21275, 5}, 0x100011FFD37},
+    {0x100009F6D37, 0x10001045906, {kw_masks.data() + 21280, 4}, 0x100019F7D37},
+    {0x100005F6C37, 0x10001045906, {kw_masks.data() + 21284, 5}, 0x100015F7D37},
+    {0x100001FE5D7, 0x10001045906, {kw_masks.data() + 21289, 5}, 0x100011FFDD7},
+    {0x100009F65D7, 0x10001045906, {kw_masks.data() + 21294, 4}, 0x100019F7DD7},
+    {0x100005F6DD7, 0x10001045906, {kw_masks.data() + 21298, 5}, 0x100015F7DD7},
+    {0x100011ACCB7, 0x10001045906, {kw_masks.data() + 21303, 5}, 0x100011EDDB7},
+    {0x100011A9D3F, 0x10001045906, {kw_masks.data() + 21308, 5}, 0x100011EDD3F},
+    {0x100015A4CB7, 0x10001045906, {kw_masks.data() + 21313, 5}, 0x100015E5DB7},
+    {0x100019E6D17, 0x10001045906, {kw_masks.data() + 21318, 3}, 0x100019E7D17},
+    {0x100011ACDD7, 0x10001045906, {kw_masks.data() + 21321, 5}, 0x100011EDDD7},
+    {0x100011A9DDF, 0x10001045906, {kw_masks.data() + 21326, 5}, 0x100011EDDDF},
+    {0x100015A4DD7, 0x10001045906, {kw_masks.data() + 21331, 5}, 0x100015E5DD7},
+    {0x100008E6951, 0x10001045906, {kw_masks.data() + 21336, 2}, 0x100018E7957},
+    {0x100028E6991, 0x10001045906, {kw_masks.data() + 21338, 3}, 0x100038E7997},
+    {0x100015EEDF7, 0x10001045906, {kw_masks.data() + 21341, 8}, 0x100015EFDF7},
+    {0x100015EEDF7, 0x10001045906, {kw_masks.data() + 21349, 8}, 0x100015EFDF7},
+    {0x100001CF101, 0x10001045906, {kw_masks.data() + 21357, 2}, 0x100011CF907},
+    {0x100001C7103, 0x10001045906, {kw_masks.data() + 21359, 2}, 0x100011C7907},
+    {0x100001FC417, 0x10001045906, {kw_masks.data() + 21361, 3}, 0x100011FDD17},
+    {0x100001F5417, 0x10001045906, {kw_masks.data() + 21364, 3}, 0x100011F5D17},
+    {0x100003FD417, 0x10001045906, {kw_masks.data() + 21367, 5}, 0x100013FDD17},
+    {0x100010E590F, 0x10001045906, {kw_masks.data() + 21372, 3}, 0x100010E590F},
+    {0x10000AA6937, 0x10001045906, {kw_masks.data() + 21375, 4}, 0x10001AE7937},
+    {0x10000AA69D7, 0x10001045906, {kw_masks.data() + 21379, 4}, 0x10001AE79D7},
+    {0x2001000A0E6995, 0x10001045906, {kw_masks.data() + 21383, 3}, 0x2001000B0E7997},
+    {0x200100220E6995, 0x10001045906, {kw_masks.data() + 21386, 3}, 0x200100230E7997},
+    {0x200102020E6995, 0x10001045906, {kw_masks.data() + 21389, 3}, 0x200102030E7997},
+    {0x200108020E6995, 0x10001045906, {kw_masks.data() + 21392, 3}, 0x200108030E7997},
+    {0x100012EF9DF, 0x10001045906, {kw_masks.data() + 21395, 6}, 0x100012EF9DF},
+    {0x100012E79DF, 0x10001045906, {kw_masks.data() + 21401, 6}, 0x100012E79DF},
+    {0x100016E79DF, 0x10001045906, {kw_masks.data() + 21407, 5}, 0x100016E79DF},
+    {0x100034E79DF, 0x10001045906, {kw_masks.data() + 21412, 6}, 0x100034E79DF},
+    {0x100035EF9DF, 0x10001045906, {kw_masks.data() + 21418, 6}, 0x100035EF9DF},
+    {0x100016E79DF, 0x10001045906, {kw_masks.data() + 21424, 5}, 0x100016E79DF},
+    {0x100034E79DB, 0x10001045906, {kw_masks.data() + 21429, 6}, 0x100034E79DF},
+    {0x100035EF9DB, 0x10001045906, {kw_masks.data() + 21435, 6}, 0x100035EF9DF},
+    {0x100016E79DF, 0x10001045906, {kw_masks.data() + 21441, 5}, 0x100016E79DF},
+    {0x100036E79DB, 0x10001045906, {kw_masks.data() + 21446, 6}, 0x100036E79DF},
+    {0x100037EF9DB, 0x10001045906, {kw_masks.data() + 21452, 6}, 0x100037EF9DF},
+    {0x100034E79DB, 0x10001045906, {kw_masks.data() + 21458, 5}, 0x100034E79DF},
+    {0x100031EF9DB, 0x10001045906, {kw_masks.data() + 21463, 5}, 0x100031EF9DF},
+    {0x100012EF9FF, 0x10001045906, {kw_masks.data() + 21468, 6}, 0x100012EF9FF},
+    {0x100012E79FF, 0x10001045906, {kw_masks.data() + 21474, 6}, 0x100012E79FF},
+    {0x100001F4031, 0x10001045906, {kw_masks.data() + 21480, 2}, 0x100011F5937},
+    {0x100011E7812, 0x10001045906, {kw_masks.data() + 21482, 2}, 0x100011E7916},
+    {0x10000186216, 0x10001045906, {kw_masks.data() + 21484, 3}, 0x100011C7B16},
+    {0x10000AE6915, 0x10001045906, {kw_masks.data() + 21487, 3}, 0x10001AE7917},
+    {0x100002A1917, 0x10001045906, {kw_masks.data() + 21490, 2}, 0x100012E5917},
+    {0x100002E79D5, 0x10001045906, {kw_masks.data() + 21492, 4}, 0x100012E79D7},
+    {0x100002E79D5, 0x10001045906, {kw_masks.data() + 21496, 4}, 0x100012E79D7},
+    {0x100006E79D5, 0x10001045906, {kw_masks.data() + 21500, 5}, 0x100016E79D7},
+    {0x100006E79D5, 0x10001045906, {kw_masks.data() + 21505, 5}, 0x100016E79D7},
+    {0x100004E7B9D, 0x10001045906, {kw_masks.data() + 21510, 4}, 0x100014E7B9F},
+    {0x100000E1915, 0x10001045906, {kw_masks.data() + 21514, 2}, 0x100010E5917},
+    {0x100000E1915, 0x10001045906, {kw_masks.data() + 21516, 2}, 0x100010E5917},
+    {0x100000EB915, 0x10001045906, {kw_masks.data() + 21518, 2}, 0x100010EF917},
+    {0x100001A60D9, 0x10001045906, {kw_masks.data() + 21520, 2}, 0x100011E79DF},
+    {0x140030, 0x10001045906, {kw_masks.data() + 21522, 1}, 0x10001145936},
+    {0x100000EE191, 0x10001045906, {kw_masks.data() + 21523, 2}, 0x100010EF997},
+    {0x100000EF193, 0x10001045906, {kw_masks.data() + 21525, 2}, 0x100010EF997},
+    {0x100011ACC17, 0x10001045906, {kw_masks.data() + 21527, 3}, 0x100011EDD17},
+    {0x100011A5C17, 0x10001045906, {kw_masks.data() + 21530, 3}, 0x100011E5D17},
+    {0x100000ECD97, 0x10001045906, {kw_masks.data() + 21533, 4}, 0x100010EDD97},
+    {0x100000E5D97, 0x10001045906, {kw_masks.data() + 21537, 4}, 0x100010E5D97},
+    {0x100025A9191, 0x10001045906, {kw_masks.data() + 21541, 2}, 0x100035ED997},
+    {0x100024A29D6, 0x10001045906, {kw_masks.data() + 21543, 3}, 0x100034E79D6},
+    {0xE21D1, 0x10001045906, {kw_masks.data() + 21546, 1}, 0x100010E79D7},
+    {0xC2831, 0x10001045906, {kw_masks.data() + 21547, 1}, 0x100010C7937},
+    {0x100001A2015, 0x10001045906, {kw_masks.data() + 21548, 2}, 0x100011E7917},
+    {0x100000E6915, 0x10001045906, {kw_masks.data() + 21550, 2}, 0x100010E7917},
+    {0x100018CF91F, 0x10001045906, {kw_masks.data() + 21552, 3}, 0x100018CF91F},
+    {0x100009A6417, 0x10001045906, {kw_masks.data() + 21555, 16}, 0x10001FEFDFF},
+    {0x100001E6C07, 0x10001045906, {kw_masks.data() + 21571, 17}, 0x100017EFDFF},
+    {0x100011EE813, 0x10001045906, {kw_masks.data() + 21588, 12}, 0x100017EFDDF},
+    {0x4CC085, 0x10001045906, {kw_masks.data() + 21600, 3}, 0x100014CDD97},
+    {0x100000A5D14, 0x10001045906, {kw_masks.data() + 21603, 2}, 0x100010E5D16},
+    {0x200100001AFD7F, 0x10001045906, {kw_masks.data() + 21605, 7}, 0x200100013EFD7F},
+    {0x200100001AFDDF, 0x10001045906, {kw_masks.data() + 21612, 6}, 0x200100015EFDFF},
+    {0x200100001AFD5F, 0x10001045906, {kw_masks.data() + 21618, 6}, 0x200100011EFD5F},
+    {0x200100005AFD5F, 0x10001045906, {kw_masks.data() + 21624, 6}, 0x200100015EFD5F},
+    {0x100001CE013, 0x10001045906, {kw_masks.data() + 21630, 5}, 0x100013EF91F},
+    {0x100001CE002, 0x10001045906, {kw_masks.data() + 21635, 4}, 0x100011FFD17},
+    {0x100001A601E, 0x10001045906, {kw_masks.data() + 21639, 4}, 0x100011E7D1F},
+    {0x1000146D812, 0x10001045906, {kw_masks.data() + 21643, 2}, 0x1000146D916},
+    {0x2001000146F832, 0x10001045906, {kw_masks.data() + 21645, 3}, 0x2001000146F936},
+    {0x1000146F812, 0x10001045906, {kw_masks.data() + 21648, 2}, 0x1000146F916},
+    {0x1000146D812, 0x10001045906, {kw_masks.data() + 21650, 3}, 0x1000146D916},
+    {0x10001265812, 0x10001045906, {kw_masks.data() + 21653, 3}, 0x10001265916},
+    {0x142000, 0x10001045906, {kw_masks.data() + 21656, 8}, 0x100015EFDD7},
+    {0x10480C, 0x10001045906, {kw_masks.data() + 21664, 3}, 0x100015E599F},
+    {0x121813, 0x10001045906, {kw_masks.data() + 21667, 5}, 0x100015E79D7},
+    {0x447001, 0x10001045906, {kw_masks.data() + 21672, 6}, 0x100014E799F},
+    {0x85014, 0x10001045906, {kw_masks.data() + 21678, 2}, 0x100010CD917},
+    {0x100000E0C07, 0x10001045906, {kw_masks.data() + 21680, 2}, 0x100010E5D07},
+    {0x100004E0191, 0x10001045906, {kw_masks.data() + 21682, 2}, 0x100014E5997},
+    {0x829C0, 0x10001045906, {kw_masks.data() + 21684, 1}, 0x100010C79C6},
+    {0x1E7098, 0x10001045906, {kw_masks.data() + 21685, 1}, 0x100011E799E},
+    {0x142000, 0x10001045906, {kw_masks.data() + 21686, 4}, 0x100011479DF},
+    {0x1000004615D, 0x10001045906, {kw_masks.data() + 21690, 5}, 0x100011C79DF},
+    {0x1000004615C, 0x10001045906, {kw_masks.data() + 21695, 5}, 0x1000116F9FF},
+    {0x186304, 0x10001045906, {kw_masks.data() + 21700, 4}, 0x100011C7B9F},
+    {0xCE100, 0x10001045906, {kw_masks.data() + 21704, 1}, 0x100010CF906},
+    {0x8E890, 0x10001045906, {kw_masks.data() + 21705, 3}, 0x100010CFD97},
+    {0x1000048E990, 0x10001045906, {kw_masks.data() + 21708, 2}, 0x100014CF996},
+    {0x10000884803, 0x10001045906, {kw_masks.data() + 21710, 2}, 0x100018C5907},
+    {0x10000C84596, 0x10001045906, {kw_masks.data() + 21712, 8}, 0xFFFFFFFFFFFFFFFF},
+    {0x10000C84983, 0x10001045906, {kw_masks.data() + 21720, 2}, 0x10001CC5987},
+    {0xE0911, 0x10001045906, {kw_masks.data() + 21722, 4}, 0x100014E791F},
+    {0x100004CC1D4, 0x10001045906, {kw_masks.data() + 21726, 3}, 0x100014CD9D6},
+    {0x1000004CDD7, 0x10001045906, {kw_masks.data() + 21729, 3}, 0x1000104DDD7},
+    {0x65485, 0x10001045906, {kw_masks.data() + 21732, 3}, 0x100010EFD87},
+    {0x100003E48BB, 0x10001045906, {kw_masks.data() + 21735, 5}, 0x100013E59BF},
+    {0x1000088ED7F, 0x10001045906, {kw_masks.data() + 21740, 4}, 0x100018CFD7F},
+    {0x100008AEDDF, 0x10001045906, {kw_masks.data() + 21744, 4}, 0x100018EFDDF},
+    {0x10000C8E9F8, 0x10001045906, {kw_masks.data() + 21748, 4}, 0x10001CCF9FE},
+    {0x1000098E158, 0x10001045906, {kw_masks.data() + 21752, 8}, 0x10001DEF9FF},
+    {0x10000CAE1D8, 0x10001045906, {kw_masks.data() + 21760, 7}, 0x10001CEF9FF},
+    {0x10000C8E1D8, 0x10001045906, {kw_masks.data() + 21767, 4}, 0x10001CCF9DE},
+    {0x10000166C1F, 0x10001045906, {kw_masks.data() + 21771, 8}, 0x100011EFDBF},
+    {0x100001C6145, 0x10001045906, {kw_masks.data() + 21779, 2}, 0x100011C7947},
+    {0x2A411D, 0x10001045906, {kw_masks.data() + 21781, 2}, 0x100012E795F},
+    {0x202418B, 0x10001045906, {kw_masks.data() + 21783, 2}, 0x100030679CF},
+    {0x14001D, 0x10001045906, {kw_masks.data() + 21785, 1}, 0x1000114591F},
+    {0x2481, 0x10001045906, {kw_masks.data() + 21786, 1}, 0x10001047D87},
+    {0x100008E408C, 0x10001045906, {kw_masks.data() + 21787, 4}, 0x100018E79DF},
+    {0x10000024184, 0x10001045906, {kw_masks.data() + 21791, 5}, 0x100010E79D7},
+    {0x10000066935, 0x10001045906, {kw_masks.data() + 21796, 2}, 0x10001067937},
+    {0x10000165A35, 0x10001045906, {kw_masks.data() + 21798, 4}, 0x100011EFB37},
+    {0x100000E201D, 0x10001045906, {kw_masks.data() + 21802, 6}, 0x100011E795F},
+    {0x10001065923, 0x10001045906, {kw_masks.data() + 21808, 3}, 0x10001067927},
+    {0x100000C0589, 0x10001045906, {kw_masks.data() + 21811, 3}, 0x100010C7D8F},
+    {0x10000063D9D, 0x10001045906, {kw_masks.data() + 21814, 2}, 0x10001067D9F},
+    {0x1000104D817, 0x10001045906, {kw_masks.data() + 21816, 4}, 0x1000114F9F7},
+    {0x10001002141, 0x10001045906, {kw_masks.data() + 21820, 9}, 0x100013E797F},
+    {0x100002A71F1, 0x10001045906, {kw_masks.data() + 21829, 3}, 0x100112F79F7},
+    {0x100000A5D71, 0x10001045906, {kw_masks.data() + 21832, 3}, 0x100411E5D7F},
+    {0x100000A5171, 0x10001045906, {kw_masks.data() + 21835, 3}, 0x100110E5977},
+    {0x100001A71F9, 0x10001045906, {kw_masks.data() + 21838, 3}, 0x100431E79FF},
+    {0x100004A7169, 0x10001045906, {kw_masks.data() + 21841, 3}, 0x10041DE796F},
+    {0x100004A5171, 0x10001045906, {kw_masks.data() + 21844, 3}, 0x100214E7D77},
+    {0x100001A7161, 0x10001045906, {kw_masks.data() + 21847, 3}, 0x100411E7977},
+    {0x100000A51F1, 0x10001045906, {kw_masks.data() + 21850, 3}, 0x100091E7DF7},
+    {0x100004258B9, 0x10001045906, {kw_masks.data() + 21853, 4}, 0x100015E79FF},
+    {0x10000426175, 0x10001045906, {kw_masks.data() + 21857, 5}, 0x100014E79FF},
+    {0x10000043975, 0x10001045906, {kw_masks.data() + 21862, 10}, 0x10001FEF9FF},
+    {0x10000043D77, 0x10001045906, {kw_masks.data() + 21872, 3}, 0x10001047D77},
+    {0x100015E2191, 0x10001045906, {kw_masks.data() + 21875, 4}, 0x100015EF997},
+    {0x100001F7131, 0x10001045906, {kw_masks.data() + 21879, 6}, 0x100013F79B7},
+    {0x100001F7811, 0x10001045906, {kw_masks.data() + 21885, 6}, 0x100013F7997},
+    {0x1121014, 0x10001045906, {kw_masks.data() + 21891, 5}, 0x10001BF7D97},
+    {0x10000043971, 0x10001045906, {kw_masks.data() + 21896, 7}, 0x1000176F9F7},
+    {0xA0091, 0x10001045906, {kw_masks.data() + 21903, 4}, 0x100010E7997},
+    {0x10000043951, 0x10001045906, {kw_masks.data() + 21907, 7}, 0x100010679D7},
+    {0x1A8310, 0x10001045906, {kw_masks.data() + 21914, 4}, 0x100011EFB97},
+    {0x1E2001, 0x10001045906, {kw_masks.data() + 21918, 4}, 0x100011E799F},
+    {0x162001, 0x10001045906, {kw_masks.data() + 21922, 4}, 0x100011EF997},
+    {0x18A010, 0x10001045906, {kw_masks.data() + 21926, 5}, 0x100011CF9D7},
+    {0x18C800, 0x10001045906, {kw_masks.data() + 21931, 1}, 0x100011CD906},
+    {0x100004C25D4, 0x10001045906, {kw_masks.data() + 21932, 3}, 0x100014C7DD6},
+    {0x100005D2194, 0x10001045906, {kw_masks.data() + 21935, 3}, 0x100015D7996},
+    {0x100004E4594, 0x10001045906, {kw_masks.data() + 21938, 3}, 0x100014E5D96},
+    {0x100004CC196, 0x10001045906, {kw_masks.data() + 21941, 3}, 0x100014CD996},
+    {0x100004C25D4, 0x10001045906, {kw_masks.data() + 21944, 3}, 0x100014C7DD6},
+    {0x100004CA195, 0x10001045906, {kw_masks.data() + 21947, 3}, 0x100014CF997},
+    {0x10000042DD7, 0x10001045906, {kw_masks.data() + 21950, 3}, 0x10001047DD7},
+    {0x10000152C97, 0x10001045906, {kw_masks.data() + 21953, 3}, 0x10001157D97},
+    {0x10000064C97, 0x10001045906, {kw_masks.data() + 21956, 3}, 0x10001065D97},
+    {0x1000004CD97, 0x10001045906, {kw_masks.data() + 21959, 3}, 0x1000104DD97},
+    {0x100000C2DD7, 0x10001045906, {kw_masks.data() + 21962, 3}, 0x100010C7DD7},
+    {0x1000044A095, 0x10001045906, {kw_masks.data() + 21965, 5}, 0x10001D4FD9F},
+    {0x100001C8119, 0x10001045906, {kw_masks.data() + 21970, 5}, 0x100011EDD5F},
+    {0x100005E0191, 0x10001045906, {kw_masks.data() + 21975, 3}, 0x100015E5997},
+    {0x100005C7199, 0x10001045906, {kw_masks.data() + 21978, 3}, 0x100015C799F},
+    {0x100001C0906, 0x10001045906, {kw_masks.data() + 21981, 6}, 0x100011E5D5F},
+    {0x100005C8199, 0x10001045906, {kw_masks.data() + 21987, 3}, 0x100015CD99F},
+    {0x100001E0191, 0x10001045906, {kw_masks.data() + 21990, 8}, 0x100013E7DDF},
+    {0x100001C7109, 0x10001045906, {kw_masks.data() + 21998, 5}, 0x100011E7D5F},
+    {0x100005C0996, 0x10001045906, {kw_masks.data() + 22003, 3}, 0x100015C5996},
+    {0x100000EE1C0, 0x10001045906, {kw_masks.data() + 22006, 4}, 0x100010EF9D7},
+    {0x100001B6011, 0x10001045906, {kw_masks.data() + 22010, 3}, 0x100011F7997},
+    {0x100000861D0, 0x10001045906, {kw_masks.data() + 22013, 4}, 0x100013F79D7},
+    {0x100000C71DB, 0x10001045906, {kw_masks.data() + 22017, 4}, 0x100013F79DF},
+    {0x100008C719B, 0x10001045906, {kw_masks.data() + 22021, 4}, 0x10001BF799F},
+    {0x80821, 0x10001045906, {kw_masks.data() + 22025, 5}, 0x100011C7977},
+    {0x100001E3945, 0x10001045906, {kw_masks.data() + 22030, 3}, 0x100011E7947},
+    {0x68081, 0x10001045906, {kw_masks.data() + 22033, 10}, 0xFFFFFFFFFFFFFFFF},
+    {0x100014E4115, 0x10001045906, {kw_masks.data() + 22043, 3}, 0x100014E5917},
+    {0x100010E4115, 0x10001045906, {kw_masks.data() + 22046, 3}, 0x100010E5917},
+    {0x10001367957, 0x10001045906, {kw_masks.data() + 22049, 3}, 0x10001367957},
+    {0x200100090EF977, 0x10001045906, {kw_masks.data() + 22052, 4}, 0x200100090EF977},
+    {0x200100110EF977, 0x10001045906, {kw_masks.data() + 22056, 4}, 0x200100110EF977},
+    {0x200100210EF977, 0x10001045906, {kw_masks.data() + 22060, 4}, 0x200100210EF977},
+    {0x200100410EF977, 0x10001045906, {kw_masks.data() + 22064, 4}, 0x200100410EF977},
+    {0x200100810EF977, 0x10001045906, {kw_masks.data() + 22068, 4}, 0x200100810EF977},
+    {0x200101010EF977, 0x10001045906, {kw_masks.data() + 22072, 4}, 0x200101010EF977},
+    {0x200102010EF977, 0x10001045906, {kw_masks.data() + 22076, 4}, 0x200102010EF977},
+    {0x100010E7977, 0x10001045906, {kw_masks.data() + 22080, 4}, 0x100010E7977},
+    {0x10001067956, 0x10001045906, {kw_masks.data() + 22084, 5}, 0x10001367D57},
+    {0x1000106D81F, 0x10001045906, {kw_masks.data() + 22089, 3}, 0x1000106D91F},
+    {0x200100010ED91F, 0x10001045906, {kw_masks.data() + 22092, 4}, 0x200100010ED91F},
+    {0x1082120, 0x10001045906, {kw_masks.data() + 22096, 9}, 0x100013EF97F},
+    {0x2001000800013D, 0x10001045906, {kw_masks.data() + 22105, 2}, 0x2001000904593F},
+    {0x2001001000013D, 0x10001045906, {kw_masks.data() + 22107, 2}, 0x2001001104593F},
+    {0x2001002000013D, 0x10001045906, {kw_masks.data() + 22109, 2}, 0x2001002104593F},
+    {0x2001004000013D, 0x10001045906, {kw_masks.data() + 22111, 2}, 0x2001004104593F},
+    {0x2001008000013D, 0x10001045906, {kw_masks.data() + 22113, 2}, 0x2001008104593F},
+    {0x2001010000013D, 0x10001045906, {kw_masks.data() + 22115, 2}, 0x2001010104593F},
+    {0x100004A49DC, 0x10001045906, {kw_masks.data() + 22117, 4}, 0x100014E59DE},
+    {0x100004E499C, 0x10001045906, {kw_masks.data() + 22121, 4}, 0x100014E599E},
+    {0x100004A4DDF, 0x10001045906, {kw_masks.data() + 22125, 5}, 0x100014E5DDF},
+    {0x100004E4D9F, 0x10001045906, {kw_masks.data() + 22130, 5}, 0x100014E5D9F},
+    {0x10001027061, 0x10001045906, {kw_masks.data() + 22135, 2}, 0x10001067967},
+    {0x10001027161, 0x10001045906, {kw_masks.data() + 22137, 2}, 0x10001067967},
+    {0x100010A7179, 0x10001045906, {kw_masks.data() + 22139, 3}, 0x100010E797F},
+    {0x10001067979, 0x10001045906, {kw_masks.data() + 22142, 3}, 0x1000106797F},
+    {0x10001067979, 0x10001045906, {kw_masks.data() + 22145, 3}, 0x1000106797F},
+    {0x100010A7179, 0x10001045906, {kw_masks.data() + 22148, 3}, 0x100010E797F},
+    {0x100004809F1, 0x10001045906, {kw_masks.data() + 22151, 2}, 0x100014C59F7},
+    {0x10000000C67, 0x10001045906, {kw_masks.data() + 22153, 2}, 0x10001045D67},
+    {0x1000002B59D, 0x10001045906, {kw_masks.data() + 22155, 7}, 0x100014EFDDF},
+    {0x1000046401C, 0x10001045906, {kw_masks.data() + 22162, 9}, 0x100015EFD5F},
+    {0x1000104591F, 0x10001045906, {kw_masks.data() + 22171, 6}, 0x100011EF93F},
+    {0x10000042817, 0x10001045906, {kw_masks.data() + 22177, 11}, 0x100035EFBDF},
+    {0x1917, 0x10001045906, {kw_masks.data() + 22188, 5}, 0x100010E5997},
+    {0x424830, 0x10001045906, {kw_masks.data() + 22193, 3}, 0x100014E7937},
+    {0x20051, 0x10001045906, {kw_masks.data() + 22196, 6}, 0x100014E79D7},
+    {0x100000E50B1, 0x10001045906, {kw_masks.data() + 22202, 2}, 0x100010E59B7},
+    {0x100010C5803, 0x10001045906, {kw_masks.data() + 22204, 6}, 0x100011EF997},
+    {0x20000000160938, 0x10001045906, {kw_masks.data() + 22210, 5}, 0x200100011E7DFE},
+    {0x100005E6999, 0x10001045906, {kw_masks.data() + 22215, 3}, 0x100015E799F},
+    {0x100002E69D4, 0x10001045906, {kw_masks.data() + 22218, 6}, 0x100012EFDD7},
+    {0x100002E69F4, 0x10001045906, {kw_masks.data() + 22224, 6}, 0x100013EFDFF},
+    {0x422141, 0x10001045906, {kw_masks.data() + 22230, 3}, 0x100015E7947},
+    {0x1000014797B, 0x10001045906, {kw_masks.data() + 22233, 4}, 0x100019C79FF},
+    {0x1000014795B, 0x10001045906, {kw_masks.data() + 22237, 4}, 0x100019C79DF},
+    {0x100000E7D7D, 0x10001045906, {kw_masks.data() + 22241, 5}, 0x100019E7DFF},
+    {0x10000043979, 0x10001045906, {kw_masks.data() + 22246, 7}, 0x100019EF9FF},
+    {0x100004E7DD1, 0x10001045906, {kw_masks.data() + 22253, 8}, 0x100015E7DDF},
+    {0x100010E785B, 0x10001045906, {kw_masks.data() + 22261, 6}, 0x100010E7D7F},
+    {0x100006E7DD5, 0x10001045906, {kw_masks.data() + 22267, 7}, 0x100016E7DD7},
+    {0x100024E7DD1, 0x10001045906, {kw_masks.data() + 22274, 7}, 0x100034E7DD7},
+    {0x100005E199D, 0x10001045906, {kw_masks.data() + 22281, 7}, 0x100015E79DF},
+    {0x10001065953, 0x10001045906, {kw_masks.data() + 22288, 2}, 0x10001065957},
+    {0x1000126591E, 0x10001045906, {kw_masks.data() + 22290, 2}, 0x1000126591E},
+    {0x100011EF99B, 0x10001045906, {kw_masks.data() + 22292, 3}, 0x100011EF99F},
+    {0x6124, 0x10001045906, {kw_masks.data() + 22295, 6}, 0x100013EF9FF},
+    {0x10000122831, 0x10001045906, {kw_masks.data() + 22301, 6}, 0x100011E79FF},
+    {0x1A2010, 0x10001045906, {kw_masks.data() + 22307, 1}, 0x100011E7916},
+    {0x60014, 0x10001045906, {kw_masks.data() + 22308, 1}, 0x10001065916},
+    {0x48801, 0x10001045906, {kw_masks.data() + 22309, 1}, 0x1000104D907},
+    {0x106200, 0x10001045906, {kw_masks.data() + 22310, 1}, 0x10001147B06},
+    {0x2C0011, 0x10001045906, {kw_masks.data() + 22311, 1}, 0x100012C5917},
+    {0x26184, 0x10001045906, {kw_masks.data() + 22312, 1}, 0x10001067986},
+    {0x10000087D87, 0x10001045906, {kw_masks.data() + 22313, 3}, 0x100010C7D87},
+    {0x8C0910, 0x10001045906, {kw_masks.data() + 22316, 1}, 0x100018C5916},
+    {0x8C1910, 0x10001045906, {kw_masks.data() + 22317, 1}, 0x100018C5916},
+    {0x912104, 0x10001045906, {kw_masks.data() + 22318, 1}, 0x10001957906},
+    {0x1F0119, 0x10001045906, {kw_masks.data() + 22319, 1}, 0x100011F591F},
+    {0x10001170419, 0x10001045906, {kw_masks.data() + 22320, 4}, 0x100011FFD1F},
+    {0x100005E31D9, 0x10001045906, {kw_masks.data() + 22324, 3}, 0x100015E79DF},
+    {0x100005E25D9, 0x10001045906, {kw_masks.data() + 22327, 3}, 0x100015E7DDF},
+    {0x100001E3CCF, 0x10001045906, {kw_masks.data() + 22330, 3}, 0x100011E7DCF},
+    {0x100001E2DCF, 0x10001045906, {kw_masks.data() + 22333, 3}, 0x100011E7DCF},
+    {0x22101, 0x10001045906, {kw_masks.data() + 22336, 3}, 0x100014E7997},
+    {0x10000447C07, 0x10001045906, {kw_masks.data() + 22339, 4}, 0x10001647D97},
+    {0x100005A69CD, 0x10001045906, {kw_masks.data() + 22343, 5}, 0x100015E79DF},
+    {0x100005EE1DC, 0x10001045906, {kw_masks.data() + 22348, 4}, 0x100015EF9DE},
+    {0x100001EEDDF, 0x10001045906, {kw_masks.data() + 22352, 4}, 0x100011EFDDF},
+    {0x100005F7199, 0x10001045906, {kw_masks.data() + 22356, 3}, 0x100015F799F},
+    {0x10000066955, 0x10001045906, {kw_masks.data() + 22359, 3}, 0x100010E795F},
+    {0x1000006091F, 0x10001045906, {kw_masks.data() + 22362, 2}, 0x1000106591F},
+    {0x8504, 0x10001045906, {kw_masks.data() + 22364, 6}, 0x100011EFDDF},
+    {0x1000006294D, 0x10001045906, {kw_masks.data() + 22370, 4}, 0x1000106794F},
+    {0xFFFFFFFFFFFFFFFF, 0x10001045906, {kw_masks.data() + 22374, 10}, 0xFFFFFFFFFFFFFFFF},
+    {0x1000006695D, 0x10001045906, {kw_masks.data() + 22384, 5}, 0x1000106795F},
+    {0x42185, 0x10001045906, {kw_masks.data() + 22389, 4}, 0x100011F799F},
+    {0x200100014A6935, 0x10001045906, {kw_masks.data() + 22393, 5}, 0x200100014E7937},
+    {0x200100014A4D37, 0x10001045906, {kw_masks.data() + 22398, 5}, 0x200100014E5D37},
+    {0x200100014A49B5, 0x10001045906, {kw_masks.data() + 22403, 5}, 0x200100014E59B7},
+    {0x100000A3C77, 0x10001045906, {kw_masks.data() + 22408, 4}, 0x100010E7D77},
+    {0x100004A39F1, 0x10001045906, {kw_masks.data() + 22412, 4}, 0x100014E79F7},
+    {0x10000666958, 0x10001045906, {kw_masks.data() + 22416, 3}, 0x1000166795E},
+    {0x200100016AE9D9, 0x10001045906, {kw_masks.data() + 22419, 7}, 0x200100016EF9DF},
+    {0x100010E683C, 0x10001045906, {kw_masks.data() + 22426, 3}, 0x100010E793E},
+    {0x100001F0919, 0x10001045906, {kw_masks.data() + 22429, 4}, 0x100011F791F},
+    {0x100005F6DFF, 0x10001045906, {kw_masks.data() + 22433, 9}, 0x100017F7DFF},
+    {0x100001A0C07, 0x10001045906, {kw_masks.data() + 22442, 7}, 0x100013E7DDF},
+    {0x200100090E293C, 0x10001045906, {kw_masks.data() + 22449, 3}, 0x200100090E793E},
+    {0x200100110E293C, 0x10001045906, {kw_masks.data() + 22452, 3}, 0x200100110E793E},
+    {0x100011E7927, 0x10001045906, {kw_masks.data() + 22455, 3}, 0x100011E7927},
+    {0x100016E6D9F, 0x10001045906, {kw_masks.data() + 22458, 8}, 0x100017EFDBF},
+    {0xAB051, 0x10001045906, {kw_masks.data() + 22466, 3}, 0x100010EF9D7},
+    {0x200100000AB9DD, 0x10001045906, {kw_masks.data() + 22469, 4}, 0x200100010EF9DF},
+    {0x200100000AB9FD, 0x10001045906, {kw_masks.data() + 22473, 4}, 0x200100010EF9FF},
+    {0x100002AB159, 0x10001045906, {kw_masks.data() + 22477, 2}, 0x100012EF95F},
+    {0x10000066D9F, 0x10001045906, {kw_masks.data() + 22479, 4}, 0x100010EFD9F},
+    {0x100000E6190, 0x10001045906, {kw_masks.data() + 22483, 4}, 0x100010E79D6},
+    {0xC0815, 0x10001045906, {kw_masks.data() + 22487, 1}, 0x100010C5917},
+    {0x100000E4194, 0x10001045906, {kw_masks.data() + 22488, 2}, 0x100010E5996},
+    {0x100005A41D3, 0x10001045906, {kw_masks.data() + 22490, 4}, 0x100015E59F7},
+    {0x100004E29D9, 0x10001045906, {kw_masks.data() + 22494, 5}, 0x100015EF9DF},
+    {0x100011ED9F3, 0x10001045906, {kw_masks.data() + 22499, 3}, 0x100011ED9F7},
+    {0x187101, 0x10001045906, {kw_masks.data() + 22502, 1}, 0x100011C7907},
+    {0x1000012785B, 0x10001045906, {kw_masks.data() + 22503, 6}, 0x100011E79DF},
+    {0x1020030, 0x10001045906, {kw_masks.data() + 22509, 4}, 0x100010EF977},
+    {0x10000176035, 0x10001045906, {kw_masks.data() + 22513, 4}, 0x100011F7937},
+    {0x60510, 0x10001045906, {kw_masks.data() + 22517, 4}, 0x100014E7D16},
+    {0x100000C0515, 0x10001045906, {kw_masks.data() + 22521, 4}, 0x100010E7D57},
+    {0x1000016E957, 0x10001045906, {kw_masks.data() + 22525, 13}, 0x100015EFDFF},
+    {0x1000104FE13, 0x10001045906, {kw_masks.data() + 22538, 3}, 0x1000104FF17},
+    {0x100012E78DB, 0x10001045906, {kw_masks.data() + 22541, 6}, 0x100012EFDDF},
+    {0x1000017EC17, 0x10001045906, {kw_masks.data() + 22547, 5}, 0x100013FFD1F},
+    {0x100024EFDFF, 0x10001045906, {kw_masks.data() + 22552, 11}, 0x100034EFFFF},
+    {0x100010E4D37, 0x10001045906, {kw_masks.data() + 22563, 3}, 0x100010E5D37},
+    {0x1000016C91F, 0x10001045906, {kw_masks.data() + 22566, 3}, 0x1000116D91F},
+    {0x64104, 0x10001045906, {kw_masks.data() + 22569, 6}, 0x100011EFD57},
+    {0x1000046491F, 0x10001045906, {kw_masks.data() + 22575, 3}, 0x1000146591F},
+    {0x100004E4194, 0x10001045906, {kw_masks.data() + 22578, 2}, 0x100014E5996},
+    {0x100000CE9D5, 0x10001045906, {kw_masks.data() + 22580, 3}, 0x100010CF9D7},
+    {0x100002A8119, 0x10001045906, {kw_masks.data() + 22583, 2}, 0x100012ED91F},
+    {0x2A911, 0x10001045906, {kw_masks.data() + 22585, 7}, 0x100012EFB77},
+    {0x20E810, 0x10001045906, {kw_masks.data() + 22592, 5}, 0x200100012EF91F},
+    {0x100012A618D, 0x10001045906, {kw_masks.data() + 22597, 8}, 0x100012EFDDF},
+    {0x100004A21C9, 0x10001045906, {kw_masks.data() + 22605, 3}, 0x100014E79DF},
+    {0x100004AE9D4, 0x10001045906, {kw_masks.data() + 22608, 3}, 0x100014EF9D6},
+    {0xA914, 0x10001045906, {kw_masks.data() + 22611, 1}, 0x1000104F916},
+    {0x100001AA9D4, 0x10001045906, {kw_masks.data() + 22612, 3}, 0x100011EF9D6},
+    {0x10000482192, 0x10001045906, {kw_masks.data() + 22615, 2}, 0x100014C7996},
+    {0x10000002D07, 0x10001045906, {kw_masks.data() + 22617, 3}, 0x1000104FD17},
+    {0x10000021495, 0x10001045906, {kw_masks.data() + 22620, 2}, 0x10001065D97},
+    {0x10000021495, 0x10001045906, {kw_masks.data() + 22622, 8}, 0xFFFFFFFFFFFFFFFF},
+    {0x1000098F905, 0x10001045906, {kw_masks.data() + 22630, 1}, 0x100019CF907},
+    {0x1189900, 0x10001045906, {kw_masks.data() + 22631, 7}, 0xFFFFFFFFFFFFFFFF},
+    {0x10000884803, 0x10001045906, {kw_masks.data() + 22638, 1}, 0x100018C5907},
+    {0x10001A84893, 0x10001045906, {kw_masks.data() + 22639, 2}, 0x10001AC5997},
+    {0x100001E6D5C, 0x10001045906, {kw_masks.data() + 22641, 3}, 0x100011E7D5E},
+    {0x100012644D5, 0x10001045906, {kw_masks.data() + 22644, 3}, 0x10001265DD7},
+    {0x100000EE014, 0x10001045906, {kw_masks.data() + 22647, 3}, 0x100010EF916},
+    {0x100012EE095, 0x10001045906, {kw_masks.data() + 22650, 4}, 0x100012EF997},
+    {0x100000E6905, 0x10001045906, {kw_masks.data() + 22654, 5}, 0x100010E79D7},
+    {0x100004E699D, 0x10001045906, {kw_masks.data() + 22659, 4}, 0x100014E799F},
+    {0x100001E691D, 0x10001045906, {kw_masks.data() + 22663, 3}, 0x100011E791F},
+    {0x100000E5815, 0x10001045906, {kw_masks.data() + 22666, 2}, 0x100010E5917},
+    {0x100002E4129, 0x10001045906, {kw_masks.data() + 22668, 6}, 0x100017E7BFF},
+    {0x200100001EC539, 0x10001045906, {kw_masks.data() + 22674, 4}, 0x200100011EDD3F},
+    {0x200100001EED3B, 0x10001045906, {kw_masks.data() + 22678, 4}, 0x200100011EFD3F},
+    {0x200100013EEDBB, 0x10001045906, {kw_masks.data() + 22682, 5}, 0x200100013EFDBF},
+    {0x200100001ECD3F, 0x10001045906, {kw_masks.data() + 22687, 4}, 0x200100011EDD3F},
+    {0x100001EED3F, 0x10001045906, {kw_masks.data() + 22691, 4}, 0x100011EFD3F},
+    {0x100005EE1B9, 0x10001045906, {kw_masks.data() + 22695, 4}, 0x100015EF9BF},
+    {0x100005E6999, 0x10001045906, {kw_masks.data() + 22699, 4}, 0x100015E799F},
+    {0x100004E099D, 0x10001045906, {kw_masks.data() + 22703, 3}, 0x100014E599F},
+    {0x100000EEC17, 0x10001045906, {kw_masks.data() + 22706, 4}, 0x100010EFD17},
+    {0x100004E2D97, 0x10001045906, {kw_masks.data() + 22710, 4}, 0x100014E7D97},
+    {0x100001E6D1F, 0x10001045906, {kw_masks.data() + 22714, 3}, 0x100011E7D1F},
+    {0x100013E6D9F, 0x10001045906, {kw_masks.data() + 22717, 4}, 0x100013E7D9F},
+    {0x100004EA991, 0x10001045906, {kw_masks.data() + 22721, 2}, 0x100014EF997},
+    {0x100004E4199, 0x10001045906, {kw_masks.data() + 22723, 3}, 0x100014E599F},
+    {0x100012E0591, 0x10001045906, {kw_masks.data() + 22726, 2}, 0x100012E5D97},
+    {0x100000EE515, 0x10001045906, {kw_masks.data() + 22728, 3}, 0x100010EFD17},
+    {0x200100000EC5D9, 0x10001045906, {kw_masks.data() + 22731, 5}, 0x240100010EDDDF},
+    {0x200100000EE1D9, 0x10001045906, {kw_masks.data() + 22736, 6}, 0x240100010EFDDF},
+    {0x100004EE9D9, 0x10001045906, {kw_masks.data() + 22742, 4}, 0x100014EF9DF},
+    {0x100008EED1F, 0x10001045906, {kw_masks.data() + 22746, 4}, 0x100018EFD1F},
+    {0x100000EEDDF, 0x10001045906, {kw_masks.data() + 22750, 5}, 0x100010EFDDF},
+    {0x100012EEDDF, 0x10001045906, {kw_masks.data() + 22755, 6}, 0x100012EFDDF},
+    {0x100006EED1F, 0x10001045906, {kw_masks.data() + 22761, 4}, 0x100016EFD1F},
+    {0x100008EE519, 0x10001045906, {kw_masks.data() + 22765, 4}, 0x100019EFD1F},
+    {0x200100000EC519, 0x10001045906, {kw_masks.data() + 22769, 3}, 0x200100010EDD1F},
+    {0x200100000EE51D, 0x10001045906, {kw_masks.data() + 22772, 5}, 0x200100010EFD1F},
+    {0x200100012EC599, 0x10001045906, {kw_masks.data() + 22777, 4}, 0x200100012EDD9F},
+    {0x10000CEEDBF, 0x10001045906, {kw_masks.data() + 22781, 5}, 0x10001CEFDBF},
+    {0x100000A4C37, 0x10001045906, {kw_masks.data() + 22786, 2}, 0x100010E5D37},
+    {0x100004A49B0, 0x10001045906, {kw_masks.data() + 22788, 2}, 0x100014E59B6},
+    {0x100001AEDFF, 0x10001045906, {kw_masks.data() + 22790, 5}, 0x100011EFDFF},
+    {0x100000EE9DD, 0x10001045906, {kw_masks.data() + 22795, 6}, 0x100010EF9DF},
+    {0x200100016EED99, 0x10001045906, {kw_masks.data() + 22801, 5}, 0x200100016EFD9F},
+    {0x446C31, 0x10001045906, {kw_masks.data() + 22806, 4}, 0x100014E7DBF},
+    {0x100004E6DF1, 0x10001045906, {kw_masks.data() + 22810, 3}, 0x100014E7DF7},
+    {0x10001666CB5, 0x10001045906, {kw_masks.data() + 22813, 3}, 0x10001667DB7},
+    {0x68C11, 0x10001045906, {kw_masks.data() + 22816, 2}, 0x401000106DD17},
+    {0x10001268C91, 0x10001045906, {kw_masks.data() + 22818, 2}, 0x1000126DD97},
+    {0x200100000EED1B, 0x10001045906, {kw_masks.data() + 22820, 4}, 0x200100010EFF1F},
+    {0x200100000ECDD9, 0x10001045906, {kw_masks.data() + 22824, 5}, 0x200100010EDDDF},
+    {0x200100012ECDD9, 0x10001045906, {kw_masks.data() + 22829, 7}, 0x200100013EFDFF},
+    {0x100004E499D, 0x10001045906, {kw_masks.data() + 22836, 3}, 0x100014E599F},
+    {0x200100005FC9D9, 0x10001045906, {kw_masks.data() + 22839, 6}, 0x200100015FD9DF},
+    {0x200100005FC1D9, 0x10001045906, {kw_masks.data() + 22845, 6}, 0x200100015FD9DF},
+    {0x100005F49D9, 0x10001045906, {kw_masks.data() + 22851, 5}, 0x100015F59DF},
+    {0x100005FC1D9, 0x10001045906, {kw_masks.data() + 22856, 5}, 0x100015FD9DF},
+    {0x10000DC7D9F, 0x10001045906, {kw_masks.data() + 22861, 4}, 0x10001DC7D9F},
+    {0x100002A09D7, 0x10001045906, {kw_masks.data() + 22865, 3}, 0x100012E59D7},
+    {0x100003A191F, 0x10001045906, {kw_masks.data() + 22868, 3}, 0x100013E591F},
+    {0x100012A0997, 0x10001045906, {kw_masks.data() + 22871, 3}, 0x100012E5997},
+    {0x100013F7DDD, 0x10001045906, {kw_masks.data() + 22874, 7}, 0x100013F7DDF},
+    {0x100013F7DD5, 0x10001045906, {kw_masks.data() + 22881, 6}, 0x100013F7DD7},
+    {0x100013B7D9F, 0x10001045906, {kw_masks.data() + 22887, 7}, 0x100013F7D9F},
+    {0x100013B7D9F, 0x10001045906, {kw_masks.data() + 22894, 6}, 0x100013F7D9F},
+    {0x100017F7DD5, 0x10001045906, {kw_masks.data() + 22900, 7}, 0x100017F7DD7},
+    {0x100017B7D9F, 0x10001045906, {kw_masks.data() + 22907, 7}, 0x100017F7D9F},
+    {0x100003EF1DD, 0x10001045906, {kw_masks.data() + 22914, 5}, 0x100013EF9DF},
+    {0x10001AA7D95, 0x10001045906, {kw_masks.data() + 22919, 4}, 0x10001AE7D97},
+    {0x100008A7995, 0x10001045906, {kw_masks.data() + 22923, 6}, 0x10001BEFD97},
+    {0x100000A0099, 0x10001045906, {kw_masks.data() + 22929, 6}, 0x100012E7D9F},
+    {0x100013A4C9F, 0x10001045906, {kw_masks.data() + 22935, 5}, 0x100013E5D9F},
+    {0x100000A48B1, 0x10001045906, {kw_masks.data() + 22940, 4}, 0x100011E59BF},
+    {0x100001A48BB, 0x10001045906, {kw_masks.data() + 22944, 7}, 0x100013E59BF},
+    {0x100001EF9B9, 0x10001045906, {kw_masks.data() + 22951, 4}, 0x100011EF9BF},
+    {0x100001EF1D9, 0x10001045906, {kw_masks.data() + 22955, 4}, 0x100011EF9DF},
+    {0x100001EF9B9, 0x10001045906, {kw_masks.data() + 22959, 5}, 0x100011EF9BF},
+    {0x100001EF9F9, 0x10001045906, {kw_masks.data() + 22964, 5}, 0x100011EF9FF},
+    {0x200100001AFD7F, 0x10001045906, {kw_masks.data() + 22969, 6}, 0x200100011EFD7F},
+    {0x200100001AFDDF, 0x10001045906, {kw_masks.data() + 22975, 6}, 0x200100011EFDDF},
+    {0x200100013BFDF1, 0x10001045906, {kw_masks.data() + 22981, 7}, 0x200100013FFDF7},
+    {0x200100013BFDD1, 0x10001045906, {kw_masks.data() + 22988, 7}, 0x200100013FFDD7},
+    {0x200100012AFDF7, 0x10001045906, {kw_masks.data() + 22995, 6}, 0x200100012EFDF7},
+    {0x200100012AFDD7, 0x10001045906, {kw_masks.data() + 23001, 6}, 0x200100012EFDD7},
+    {0x100000E7DF7, 0x10001045906, {kw_masks.data() + 23007, 6}, 0x100010E7DF7},
+    {0x100000E7DD7, 0x10001045906, {kw_masks.data() + 23013, 6}, 0x100010E7DD7},
+    {0x100011A7D3F, 0x10001045906, {kw_masks.data() + 23019, 5}, 0x100011E7D3F},
+    {0x100011A7DDF, 0x10001045906, {kw_masks.data() + 23024, 5}, 0x100011E7DDF},
+    {0x100002A695F, 0x10001045906, {kw_masks.data() + 23029, 5}, 0x100012E795F},
+    {0x100006A695F, 0x10001045906, {kw_masks.data() + 23034, 5}, 0x100016E795F},
+    {0x100002A29DF, 0x10001045906, {kw_masks.data() + 23039, 5}, 0x100012E79DF},
+    {0x100003A697F, 0x10001045906, {kw_masks.data() + 23044, 5}, 0x100013E797F},
+    {0x100002A297F, 0x10001045906, {kw_masks.data() + 23049, 5}, 0x100012E797F},
+    {0x10000AE295F, 0x10001045906, {kw_masks.data() + 23054, 5}, 0x10001AE795F},
+    {0x100002E295F, 0x10001045906, {kw_masks.data() + 23059, 5}, 0x100012E795F},
+    {0x100002A29DF, 0x10001045906, {kw_masks.data() + 23064, 5}, 0x100012E79DF},
+    {0x100002A295F, 0x10001045906, {kw_masks.data() + 23069, 5}, 0x100012E795F},
+    {0x100003A395F, 0x10001045906, {kw_masks.data() + 23074, 5}, 0x100013E795F},
+    {0x200100000E697F, 0x10001045906, {kw_masks.data() + 23079, 6}, 0x200100010E797F},
+    {0x200100004E697F, 0x10001045906, {kw_masks.data() + 23085, 6}, 0x200100014E797F},
+    {0x200100000E29FF, 0x10001045906, {kw_masks.data() + 23091, 6}, 0x200100010E79FF},
+    {0x200100001E697F, 0x10001045906, {kw_masks.data() + 23097, 6}, 0x200100011E797F},
+    {0x200100002E297F, 0x10001045906, {kw_masks.data() + 23103, 6}, 0x200100012E797F},
+    {0x200100008E297F, 0x10001045906, {kw_masks.data() + 23109, 6}, 0x200100018E797F},
+    {0x200100002E297F, 0x10001045906, {kw_masks.data() + 23115, 6}, 0x200100012E797F},
+    {0x200100000E29FF, 0x10001045906, {kw_masks.data() + 23121, 6}, 0x200100010E79FF},
+    {0x200100000E297F, 0x10001045906, {kw_masks.data() + 23127, 6}, 0x200100010E797F},
+    {0x200100001E397F, 0x10001045906, {kw_masks.data() + 23133, 6}, 0x200100011E797F},
+    {0x200100002E697F, 0x10001045906, {kw_masks.data() + 23139, 7}, 0x200100012E797F},
+    {0x200100006E697F, 0x10001045906, {kw_masks.data() + 23146, 7}, 0x200100016E797F},
+    {0x200100002E29FF, 0x10001045906, {kw_masks.data() + 23153, 7}, 0x200100012E79FF},
+    {0x200100003E697F, 0x10001045906, {kw_masks.data() + 23160, 7}, 0x200100013E797F},
+    {0x200100002E297F, 0x10001045906, {kw_masks.data() + 23167, 7}, 0x200100012E797F},
+    {0x20010000AE297F, 0x10001045906, {kw_masks.data() + 23174, 7}, 0x20010001AE797F},
+    {0x200100002E297F, 0x10001045906, {kw_masks.data() + 23181, 7}, 0x200100012E797F},
+    {0x200100002E29FF, 0x10001045906, {kw_masks.data() + 23188, 7}, 0x200100012E79FF},
+    {0x200100002E297F, 0x10001045906, {kw_masks.data() + 23195, 7}, 0x200100012E797F},
+    {0x200100003E397F, 0x10001045906, {kw_masks.data() + 23202, 7}, 0x200100013E797F},
+    {0x200100016E41D9, 0x10001045906, {kw_masks.data() + 23209, 5}, 0x200100016E59DF},
+    {0x100017E4091, 0x10001045906, {kw_masks.data() + 23214, 4}, 0x100017E5997},
+    {0x100016E41D9, 0x10001045906, {kw_masks.data() + 23218, 3}, 0x100016E59DF},
+    {0x100016E6091, 0x10001045906, {kw_masks.data() + 23221, 4}, 0x100016E7997},
+    {0x100004EE1E9, 0x10001045906, {kw_masks.data() + 23225, 4}, 0x100014EF9EF},
+    {0x200100017EE1D9, 0x10001045906, {kw_masks.data() + 23229, 5}, 0x200100017EF9DF},
+    {0x200100004E69D9, 0x10001045906, {kw_masks.data() + 23234, 4}, 0x200100014E79DF},
+    {0x200100016E69D9, 0x10001045906, {kw_masks.data() + 23238, 5}, 0x200100016E79DF},
+    {0x200100004E69D9, 0x10001045906, {kw_masks.data() + 23243, 5}, 0x200100014E79DF},
+    {0x200100016E69D9, 0x10001045906, {kw_masks.data() + 23248, 6}, 0x200100016E79DF},
+    {0x100004A41C1, 0x10001045906, {kw_masks.data() + 23254, 7}, 0x100014E7DDF},
+    {0x200100004EC9D9, 0x10001045906, {kw_masks.data() + 23261, 5}, 0x200100014ED9DF},
+    {0x200100004E59DB, 0x10001045906, {kw_masks.data() + 23266, 5}, 0x200100014E59DF},
+    {0x100004E4DDF, 0x10001045906, {kw_masks.data() + 23271, 3}, 0x100014E5DDF},
+    {0x100017E6DDF, 0x10001045906, {kw_masks.data() + 23274, 6}, 0x100017E7DDF},
+    {0x100017EEDDF, 0x10001045906, {kw_masks.data() + 23280, 6}, 0x100017EFDDF},
+    {0x100005F4DCF, 0x10001045906, {kw_masks.data() + 23286, 4}, 0x100015F5DCF},
+    {0x200100016EEDDF, 0x10001045906, {kw_masks.data() + 23290, 6}, 0x200100016EFDDF},
+    {0x200100004E41D9, 0x10001045906, {kw_masks.data() + 23296, 5}, 0x200100014E59DF},
+    {0x200100004E49F9, 0x10001045906, {kw_masks.data() + 23301, 5}, 0x200100014E59FF},
+    {0x200100004E4DDF, 0x10001045906, {kw_masks.data() + 23306, 6}, 0x200100014E5DDF},
+    {0x200100004E69F9, 0x10001045906, {kw_masks.data() + 23312, 6}, 0x200100014E79FF},
+    {0x200100016E49D9, 0x10001045906, {kw_masks.data() + 23318, 7}, 0x200100016E59DF},
+    {0x200100017EC1D9, 0x10001045906, {kw_masks.data() + 23325, 7}, 0x200100017ED9DF},
+    {0x200100004E69DD, 0x10001045906, {kw_masks.data() + 23332, 7}, 0x200100014E79DF},
+    {0x200100005EE1DD, 0x10001045906, {kw_masks.data() + 23339, 7}, 0x200100015EF9DF},
+    {0x100016E49DD, 0x10001045906, {kw_masks.data() + 23346, 5}, 0x100016E59DF},
+    {0x200100004E41F9, 0x10001045906, {kw_masks.data() + 23351, 4}, 0x200100014E59FF},
+    {0x200100005E4CBF, 0x10001045906, {kw_masks.data() + 23355, 5}, 0x200100015E5DBF},
+    {0x200100004E4DFF, 0x10001045906, {kw_masks.data() + 23360, 4}, 0x200100014E5DFF},
+    {0x200100004E6CBF, 0x10001045906, {kw_masks.data() + 23364, 5}, 0x200100014E7DBF},
+    {0x200100017E4CBF, 0x10001045906, {kw_masks.data() + 23369, 6}, 0x200100017E5DBF},
+    {0x200100016E4DFF, 0x10001045906, {kw_masks.data() + 23375, 5}, 0x200100016E5DFF},
+    {0x200100016E6CBF, 0x10001045906, {kw_masks.data() + 23380, 6}, 0x200100016E7DBF},
+    {0x200100004EC1DB, 0x10001045906, {kw_masks.data() + 23386, 4}, 0x200100014ED9DF},
+    {0x200100016EE5D9, 0x10001045906, {kw_masks.data() + 23390, 5}, 0x200100016EFDDF},
+    {0x200100004E49D9, 0x10001045906, {kw_masks.data() + 23395, 4}, 0x200100014E59DF},
+    {0x200100016E49D9, 0x10001045906, {kw_masks.data() + 23399, 5}, 0x200100016E59DF},
+    {0x200100005EE9D9, 0x10001045906, {kw_masks.data() + 23404, 4}, 0x200100015EF9DF},
+    {0x100004E6191, 0x10001045906, {kw_masks.data() + 23408, 4}, 0x100014E7997},
+    {0x100004E6191, 0x10001045906, {kw_masks.data() + 23412, 4}, 0x100014E7997},
+    {0x100005E4191, 0x10001045906, {kw_masks.data() + 23416, 4}, 0x100015E5997},
+    {0x100005E4191, 0x10001045906, {kw_masks.data() + 23420, 4}, 0x100015E5997},
+    {0x100004A49F1, 0x10001045906, {kw_masks.data() + 23424, 4}, 0x100014E59F7},
+    {0x100004A4831, 0x10001045906, {kw_masks.data() + 23428, 7}, 0x100014E7D3F},
+    {0x1000052C001, 0x10001045906, {kw_masks.data() + 23435, 7}, 0x100015EFD9F},
+    {0x10000426009, 0x10001045906, {kw_masks.data() + 23442, 7}, 0x100015E7D9F},
+    {0x100004E6C97, 0x10001045906, {kw_masks.data() + 23449, 4}, 0x100014E7D97},
+    {0x100004E6C97, 0x10001045906, {kw_masks.data() + 23453, 4}, 0x100014E7D97},
+    {0x100005E4C97, 0x10001045906, {kw_masks.data() + 23457, 4}, 0x100015E5D97},
+    {0x100005E4C97, 0x10001045906, {kw_masks.data() + 23461, 4}, 0x100015E5D97},
+    {0x100004A4DF7, 0x10001045906, {kw_masks.data() + 23465, 4}, 0x100014E5DF7},
+    {0x1000052EC0F, 0x10001045906, {kw_masks.data() + 23469, 4}, 0x1000156FD0F},
+    {0x100004EE1C9, 0x10001045906, {kw_masks.data() + 23473, 4}, 0x100014EF9CF},
+    {0x100005EC1C9, 0x10001045906, {kw_masks.data() + 23477, 4}, 0x100015ED9CF},
+    {0x100004EE9B9, 0x10001045906, {kw_masks.data() + 23481, 4}, 0x100014EF9BF},
+    {0x100005EC9B9, 0x10001045906, {kw_masks.data() + 23485, 4}, 0x100015ED9BF},
+    {0x100005FCDB7, 0x10001045906, {kw_masks.data() + 23489, 4}, 0x100015FDDB7},
+    {0x100005F5DB7, 0x10001045906, {kw_masks.data() + 23493, 4}, 0x100015F5DB7},
+    {0x100005FEDFF, 0x10001045906, {kw_masks.data() + 23497, 6}, 0x100015FFDFF},
+    {0x100005F6DFF, 0x10001045906, {kw_masks.data() + 23503, 6}, 0x100015F7DFF},
+    {0x10000487DBF, 0x10001045906, {kw_masks.data() + 23509, 4}, 0x100014C7DBF},
+    {0x100004A7DEF, 0x10001045906, {kw_masks.data() + 23513, 4}, 0x100014E7DEF},
+    {0x1000048FDAF, 0x10001045906, {kw_masks.data() + 23517, 4}, 0x100014CFDAF},
+    {0x10000487DAF, 0x10001045906, {kw_masks.data() + 23521, 4}, 0x100014C7DAF},
+    {0x100001F4019, 0x10001045906, {kw_masks.data() + 23525, 2}, 0x100011F591F},
+    {0x10001371C17, 0x10001045906, {kw_masks.data() + 23527, 4}, 0x10001375D17},
+    {0x100017F1991, 0x10001045906, {kw_masks.data() + 23531, 4}, 0x100017F5997},
+    {0x1000008EC57, 0x10001045906, {kw_masks.data() + 23535, 2}, 0x100010CFD57},
+    {0x1000048E1D1, 0x10001045906, {kw_masks.data() + 23537, 2}, 0x100014CF9D7},
+    {0x10000C861D1, 0x10001045906, {kw_masks.data() + 23539, 2}, 0x10001CC79D7},
+    {0x10000806CD7, 0x10001045906, {kw_masks.data() + 23541, 2}, 0x10001847DD7},
+    {0x100028A6DD7, 0x10001045906, {kw_masks.data() + 23543, 3}, 0x100038E7DD7},
+    {0x10000020D57, 0x10001045906, {kw_masks.data() + 23546, 3}, 0x10001065D57},
+    {0x10000107D1F, 0x10001045906, {kw_masks.data() + 23549, 3}, 0x10001147D1F},
+    {0x10000587199, 0x10001045906, {kw_masks.data() + 23552, 3}, 0x100015C799F},
+    {0x10002107D5F, 0x10001045906, {kw_masks.data() + 23555, 3}, 0x10003147D5F},
+    {0x100025879D8, 0x10001045906, {kw_masks.data() + 23558, 3}, 0x100035C79DE},
+    {0x10000047D0F, 0x10001045906, {kw_masks.data() + 23561, 3}, 0x10001047D0F},
+    {0x10002047C57, 0x10001045906, {kw_masks.data() + 23564, 3}, 0x10003047D57},
+    {0x100024C79D1, 0x10001045906, {kw_masks.data() + 23567, 3}, 0x100034C79D7},
+    {0x100020EED97, 0x10001045906, {kw_masks.data() + 23570, 3}, 0x100030EFD97},
+    {0x100024EE991, 0x10001045906, {kw_masks.data() + 23573, 3}, 0x100034EF997},
+    {0x100002E8D17, 0x10001045906, {kw_masks.data() + 23576, 3}, 0x100012EDD17},
+    {0x100006E8995, 0x10001045906, {kw_masks.data() + 23579, 3}, 0x100016ED997},
+    {0x100004E59B5, 0x10001045906, {kw_masks.data() + 23582, 4}, 0x100014E59B7},
+    {0x100004E48B9, 0x10001045906, {kw_masks.data() + 23586, 3}, 0x100014E59BF},
+    {0x100005EC9BD, 0x10001045906, {kw_masks.data() + 23589, 4}, 0x100015ED9BF},
+    {0x100005F6979, 0x10001045906, {kw_masks.data() + 23593, 4}, 0x100015F797F},
+    {0x200100006E4DBD, 0x10001045906, {kw_masks.data() + 23597, 6}, 0x200100016E5DBF},
+    {0x200100007E4DBF, 0x10001045906, {kw_masks.data() + 23603, 7}, 0x200100017E5DBF},
+    {0x200100004E58BB, 0x10001045906, {kw_masks.data() + 23610, 5}, 0x200100014E59BF},
+    {0x200100004EC9B9, 0x10001045906, {kw_masks.data() + 23615, 6}, 0x200100014ED9BF},
+    {0x100004E59B9, 0x10001045906, {kw_masks.data() + 23621, 4}, 0x100014E59BF},
+    {0x100006E4DBD, 0x10001045906, {kw_masks.data() + 23625, 5}, 0x100016E5DBF},
+    {0x100007E4DBF, 0x10001045906, {kw_masks.data() + 23630, 6}, 0x100017E5DBF},
+    {0x200100004E49B9, 0x10001045906, {kw_masks.data() + 23636, 5}, 0x200100014E59BF},
+    {0x200100006E4DBD, 0x10001045906, {kw_masks.data() + 23641, 7}, 0x200100016E5DBF},
+    {0x200100007E4DBF, 0x10001045906, {kw_masks.data() + 23648, 8}, 0x200100017E5DBF},
+    {0x10000DE48F9, 0x10001045906, {kw_masks.data() + 23656, 3}, 0x10001DE59FF},
+    {0x100016AE97D, 0x10001045906, {kw_masks.data() + 23659, 5}, 0x100016EF97F},
+    {0x100007F697B, 0x10001045906, {kw_masks.data() + 23664, 5}, 0x100017F797F},
+    {0x100006EC93B, 0x10001045906, {kw_masks.data() + 23669, 6}, 0x100016ED93F},
+    {0x100007F583B, 0x10001045906, {kw_masks.data() + 23675, 6}, 0x100017F593F},
+    {0x200100005E61D9, 0x10001045906, {kw_masks.data() + 23681, 5}, 0x200100015E79DF},
+    {0x100005EC1D9, 0x10001045906, {kw_masks.data() + 23686, 4}, 0x100015ED9DF},
+    {0x100005FC839, 0x10001045906, {kw_masks.data() + 23690, 3}, 0x100015FD93F},
+    {0x100005FC9D9, 0x10001045906, {kw_masks.data() + 23693, 3}, 0x100015FD9DF},
+    {0x100006EC9DB, 0x10001045906, {kw_masks.data() + 23696, 6}, 0x100016ED9DF},
+    {0x100007F59DB, 0x10001045906, {kw_masks.data() + 23702, 6}, 0x100017F59DF},
+    {0x100006EC93B, 0x10001045906, {kw_masks.data() + 23708, 5}, 0x100016ED93F},
+    {0x100007F583B, 0x10001045906, {kw_masks.data() + 23713, 5}, 0x100017F593F},
+    {0x100006EC93B, 0x10001045906, {kw_masks.data() + 23718, 6}, 0x100016ED93F},
+    {0x100006EC9DB, 0x10001045906, {kw_masks.data() + 23724, 6}, 0x100016ED9DF},
+    {0x200100024E69D9, 0x10001045906, {kw_masks.data() + 23730, 5}, 0x200100034E79DF},
+    {0x100004E6899, 0x10001045906, {kw_masks.data() + 23735, 4}, 0x100014E799F},
+    {0x100005E6C9F, 0x10001045906, {kw_masks.data() + 23739, 4}, 0x100015E7D9F},
+    {0x100000E1C07, 0x10001045906, {kw_masks.data() + 23743, 3}, 0x100010E5D07},
+    {0x100004E1991, 0x10001045906, {kw_masks.data() + 23746, 3}, 0x100014E5997},
+    {0x200100000AEDD7, 0x10001045906, {kw_masks.data() + 23749, 4}, 0x200100010EFDD7},
+    {0x200100004AE1D1, 0x10001045906, {kw_masks.data() + 23753, 4}, 0x200100014EF9D7},
+    {0x100016C6999, 0x10001045906, {kw_masks.data() + 23757, 5}, 0x100017EF9BF},
+    {0x100016E299D, 0x10001045906, {kw_masks.data() + 23762, 5}, 0x100017EF9BF},
+    {0x10001220995, 0x10001045906, {kw_masks.data() + 23767, 8}, 0x100016EF9F7},
+    {0x100012E099D, 0x10001045906, {kw_masks.data() + 23775, 5}, 0x100012EF99F},
+    {0x100004E6D99, 0x10001045906, {kw_masks.data() + 23780, 5}, 0x100014E7D9F},
+    {0x100005E6D9F, 0x10001045906, {kw_masks.data() + 23785, 5}, 0x100015E7D9F},
+    {0x100024E6999, 0x10001045906, {kw_masks.data() + 23790, 5}, 0x100034E799F},
+    {0x100025E6D9F, 0x10001045906, {kw_masks.data() + 23795, 5}, 0x100035E7D9F},
+    {0x100004EE1DB, 0x10001045906, {kw_masks.data() + 23800, 7}, 0x100014EF9DF},
+    {0x100004EE1DB, 0x10001045906, {kw_masks.data() + 23807, 8}, 0x100014EF9DF},
+    {0x200100004E69F9, 0x10001045906, {kw_masks.data() + 23815, 4}, 0x200100014E79FF},
+    {0x200100005EE9D9, 0x10001045906, {kw_masks.data() + 23819, 4}, 0x200100015EF9DF},
+    {0x200100004E69D9, 0x10001045906, {kw_masks.data() + 23823, 4}, 0x200100014E79DF},
+    {0x200100004E69D9, 0x10001045906, {kw_masks.data() + 23827, 4}, 0x200100014E79DF},
+    {0x200100004A69F9, 0x10001045906, {kw_masks.data() + 23831, 5}, 0x200100014E79FF},
+    {0x200100005AE9D9, 0x10001045906, {kw_masks.data() + 23836, 5}, 0x200100015EF9DF},
+    {0x200100004E69D9, 0x10001045906, {kw_masks.data() + 23841, 5}, 0x200100014E79DF},
+    {0x200100004E69D9, 0x10001045906, {kw_masks.data() + 23846, 5}, 0x200100014E79DF},
+    {0x200100005E69D9, 0x10001045906, {kw_masks.data() + 23851, 5}, 0x200100015E79DF},
+    {0x200100005E69D9, 0x10001045906, {kw_masks.data() + 23856, 5}, 0x200100015E79DF},
+    {0x200100004E69F9, 0x10001045906, {kw_masks.data() + 23861, 5}, 0x200100014E79FF},
+    {0x200100005EE9D9, 0x10001045906, {kw_masks.data() + 23866, 5}, 0x200100015EF9DF},
+    {0x200100004E69D9, 0x10001045906, {kw_masks.data() + 23871, 5}, 0x200100014E79DF},
+    {0x200100004E69D9, 0x10001045906, {kw_masks.data() + 23876, 5}, 0x200100014E79DF},
+    {0x200100004EEDDD, 0x10001045906, {kw_masks.data() + 23881, 6}, 0x200100014EFDDF},
+    {0x200100004EEDDD, 0x10001045906, {kw_masks.data() + 23887, 6}, 0x200100014EFDDF},
+    {0x200100004E69FB, 0x10001045906, {kw_masks.data() + 23893, 7}, 0x200100014E79FF},
+    {0x200100005EE9DB, 0x10001045906, {kw_masks.data() + 23900, 7}, 0x200100015EF9DF},
+    {0x200100004E69DB, 0x10001045906, {kw_masks.data() + 23907, 7}, 0x200100014E79DF},
+    {0x200100004E69DB, 0x10001045906, {kw_masks.data() + 23914, 7}, 0x200100014E79DF},
+    {0x200100004E69DB, 0x10001045906, {kw_masks.data() + 23921, 7}, 0x200100014E79DF},
+    {0x200100004E69DB, 0x10001045906, {kw_masks.data() + 23928, 6}, 0x200100014E79DF},
+    {0x200100005E69DB, 0x10001045906, {kw_masks.data() + 23934, 7}, 0x200100015E79DF},
+    {0x200100005E69DB, 0x10001045906, {kw_masks.data() + 23941, 6}, 0x200100015E79DF},
+    {0x200100025E6DFB, 0x10001045906, {kw_masks.data() + 23947, 8}, 0x200100037E7DFF},
+    {0x200100025EEDDB, 0x10001045906, {kw_masks.data() + 23955, 9}, 0x200100035EFDDF},
+    {0x200100025E6DDB, 0x10001045906, {kw_masks.data() + 23964, 8}, 0x200100037E7DDF},
+    {0x200100025E6DDB, 0x10001045906, {kw_masks.data() + 23972, 9}, 0x200100035EFDDF},
+    {0x100030A6D93, 0x10001045906, {kw_masks.data() + 23981, 3}, 0x100030E7D97},
+    {0x100012A0D17, 0x10001045906, {kw_masks.data() + 23984, 3}, 0x100012E5D17},
+    {0x200100006E69F9, 0x10001045906, {kw_masks.data() + 23987, 6}, 0x200100016E79FF},
+    {0x200100005EE9F9, 0x10001045906, {kw_masks.data() + 23993, 6}, 0x200100015EF9FF},
+    {0x200100006E69F9, 0x10001045906, {kw_masks.data() + 23999, 6}, 0x200100016E79FF},
+    {0x200100005EE9F9, 0x10001045906, {kw_masks.data() + 24005, 6}, 0x200100015EF9FF},
+    {0x200100004EE9F9, 0x10001045906, {kw_masks.data() + 24011, 5}, 0x200100014EF9FF},
+    {0x200100005EE9D9, 0x10001045906, {kw_masks.data() + 24016, 5}, 0x200100015EF9DF},
+    {0x200100004EE9D9, 0x10001045906, {kw_masks.data() + 24021, 5}, 0x200100014EF9DF},
+    {0x200100004EE9D9, 0x10001045906, {kw_masks.data() + 24026, 5}, 0x200100014EF9DF},
+    {0x100004E4DBF, 0x10001045906, {kw_masks.data() + 24031, 5}, 0x100014E5DBF},
+    {0x100005ECD9F, 0x10001045906, {kw_masks.data() + 24036, 5}, 0x100015EDD9F},
+    {0x100004E4DDF, 0x10001045906, {kw_masks.data() + 24041, 5}, 0x100014E5DDF},
+    {0x100004E6D9F, 0x10001045906, {kw_masks.data() + 24046, 5}, 0x100014E7D9F},
+    {0x200100005EEDDD, 0x10001045906, {kw_masks.data() + 24051, 6}, 0x200100015EFDDF},
+    {0x200100005EFDDF, 0x10001045906, {kw_masks.data() + 24057, 6}, 0x200100015EFDDF},
+    {0x200100005EEDFD, 0x10001045906, {kw_masks.data() + 24063, 6}, 0x200100015EFDFF},
+    {0x200100005EEDDD, 0x10001045906, {kw_masks.data() + 24069, 6}, 0x200100015EFDDF},
+    {0x100001A2830, 0x10001045906, {kw_masks.data() + 24075, 2}, 0x100011E7936},
+    {0x100001A21D0, 0x10001045906, {kw_masks.data() + 24077, 2}, 0x100011E79D6},
+    {0x10000482930, 0x10001045906, {kw_masks.data() + 24079, 2}, 0x100014C7936},
+    {0x100004A29D0, 0x10001045906, {kw_masks.data() + 24081, 2}, 0x100014E79D6},
+    {0x100005E6D75, 0x10001045906, {kw_masks.data() + 24083, 6}, 0x100015EFD77},
+    {0x100004E4DCF, 0x10001045906, {kw_masks.data() + 24089, 3}, 0x100014E5DCF},
+    {0x100017D69F3, 0x10001045906, {kw_masks.data() + 24092, 6}, 0x100017FF9F7},
+    {0x100010EF937, 0x10001045906, {kw_masks.data() + 24098, 3}, 0x100010EF937},
+    {0x200100005FC9F9, 0x10001045906, {kw_masks.data() + 24101, 6}, 0x200100015FD9FF},
+    {0x200100005FC9D9, 0x10001045906, {kw_masks.data() + 24107, 6}, 0x200100015FD9DF},
+    {0x200100005FC9D9, 0x10001045906, {kw_masks.data() + 24113, 6}, 0x200100015FD9DF},
+    {0x200100005F69F9, 0x10001045906, {kw_masks.data() + 24119, 6}, 0x200100015F79FF},
+    {0x100005F4DBF, 0x10001045906, {kw_masks.data() + 24125, 4}, 0x100015F5DBF},
+    {0x100005FCD9F, 0x10001045906, {kw_masks.data() + 24129, 4}, 0x100015FDD9F},
+    {0x100005F4DDF, 0x10001045906, {kw_masks.data() + 24133, 4}, 0x100015F5DDF},
+    {0x100005F6D9F, 0x10001045906, {kw_masks.data() + 24137, 4}, 0x100015F7D9F},
+    {0x200100004EE9F9, 0x10001045906, {kw_masks.data() + 24141, 7}, 0x200100014EF9FF},
+    {0x200100004EE9D9, 0x10001045906, {kw_masks.data() + 24148, 7}, 0x200100014EF9DF},
+    {0x200100005EE9F9, 0x10001045906, {kw_masks.data() + 24155, 7}, 0x200100015EF9FF},
+    {0x200100005EE9D9, 0x10001045906, {kw_masks.data() + 24162, 7}, 0x200100015EF9DF},
+    {0x200100005EE9F9, 0x10001045906, {kw_masks.data() + 24169, 7}, 0x200100015EF9FF},
+    {0x200100005EE9D9, 0x10001045906, {kw_masks.data() + 24176, 7}, 0x200100015EF9DF},
+    {0x200100004EE9F9, 0x10001045906, {kw_masks.data() + 24183, 7}, 0x200100014EF9FF},
+    {0x200100004EE9D9, 0x10001045906, {kw_masks.data() + 24190, 7}, 0x200100014EF9DF},
+    {0x100007E6C3F, 0x10001045906, {kw_masks.data() + 24197, 5}, 0x100017E7D3F},
+    {0x100007E6DDF, 0x10001045906, {kw_masks.data() + 24202, 5}, 0x100017E7DDF},
+    {0x100007EEC3F, 0x10001045906, {kw_masks.data() + 24207, 5}, 0x100017EFD3F},
+    {0x100007EEDDF, 0x10001045906, {kw_masks.data() + 24212, 5}, 0x100017EFDDF},
+    {0x100007EEC3F, 0x10001045906, {kw_masks.data() + 24217, 5}, 0x100017EFD3F},
+    {0x100007EEDDF, 0x10001045906, {kw_masks.data() + 24222, 5}, 0x100017EFDDF},
+    {0x100007E6C3F, 0x10001045906, {kw_masks.data() + 24227, 5}, 0x100017E7D3F},
+    {0x100007E6DDF, 0x10001045906, {kw_masks.data() + 24232, 5}, 0x100017E7DDF},
+    {0x100004A693B, 0x10001045906, {kw_masks.data() + 24237, 4}, 0x100014E793F},
+    {0x100004A61CB, 0x10001045906, {kw_masks.data() + 24241, 4}, 0x100014E79CF},
+    {0x100005AE933, 0x10001045906, {kw_masks.data() + 24245, 4}, 0x100015EF937},
+    {0x100005AE1C3, 0x10001045906, {kw_masks.data() + 24249, 4}, 0x100015EF9C7},
+    {0x100005AE933, 0x10001045906, {kw_masks.data() + 24253, 4}, 0x100015EF937},
+    {0x100005AE1C3, 0x10001045906, {kw_masks.data() + 24257, 4}, 0x100015EF9C7},
+    {0x100004A693B, 0x10001045906, {kw_masks.data() + 24261, 4}, 0x100014E793F},
+    {0x100004A61CB, 0x10001045906, {kw_masks.data() + 24265, 4}, 0x100014E79CF},
+    {0x100025EF9BB, 0x10001045906, {kw_masks.data() + 24269, 7}, 0x100035EFDBF},
+    {0x10000DAE9DF, 0x10001045906, {kw_masks.data() + 24276, 5}, 0x10001DEF9DF},
+    {0x100007FE9D1, 0x10001045906, {kw_masks.data() + 24281, 5}, 0x100017FF9D7},
+    {0x100007FEDDF, 0x10001045906, {kw_masks.data() + 24286, 7}, 0x100017FFDDF},
+    {0x1000037ED57, 0x10001045906, {kw_masks.data() + 24293, 6}, 0x1000137FDD7},
+    {0x10000C849C3, 0x10001045906, {kw_masks.data() + 24299, 3}, 0x10001CC59C7},
+    {0x1000082091C, 0x10001045906, {kw_masks.data() + 24302, 1}, 0x1000186591E},
+    {0x1000082491E, 0x10001045906, {kw_masks.data() + 24303, 2}, 0x1000186591E},
+    {0x100001F2C1F, 0x10001045906, {kw_masks.data() + 24305, 3}, 0x100011F7D1F},
+    {0x100000A7D1F, 0x10001045906, {kw_masks.data() + 24308, 3}, 0x100010E7D1F},
+    {0x100001AEC5F, 0x10001045906, {kw_masks.data() + 24311, 3}, 0x100011EFD5F},
+    {0x100020A6DC7, 0x10001045906, {kw_masks.data() + 24314, 3}, 0x100030E7DC7},
+    {0x10000086C47, 0x10001045906, {kw_masks.data() + 24317, 2}, 0x100010C7D47},
+    {0x200100001AFD5F, 0x10001045906, {kw_masks.data() + 24319, 6}, 0x200100011EFD5F},
+    {0x200100005AFD5F, 0x10001045906, {kw_masks.data() + 24325, 6}, 0x200100015EFD5F},
+    {0x200100001AFD7F, 0x10001045906, {kw_masks.data() + 24331, 6}, 0x200100011EFD7F},
+    {0x200100001AFDDF, 0x10001045906, {kw_masks.data() + 24337, 6}, 0x200100011EFDDF},
+    {0x100005AF030, 0x10001045906, {kw_masks.data() + 24343, 3}, 0x100015EF936},
+    {0x100000ACDB7, 0x10001045906, {kw_masks.data() + 24346, 4}, 0x100010EDDB7},
+    {0x100000A5DB7, 0x10001045906, {kw_masks.data() + 24350, 4}, 0x100010E5DB7},
+    {0x100001EEDFF, 0x10001045906, {kw_masks.data() + 24354, 5}, 0x100011EFDFF},
+    {0x100001EEDFF, 0x10001045906, {kw_masks.data() + 24359, 6}, 0x100011EFDFF},
+    {0x100005EE1BC, 0x10001045906, {kw_masks.data() + 24365, 4}, 0x100015EF9BE},
+    {0x100005EE1BD, 0x10001045906, {kw_masks.data() + 24369, 5}, 0x100015EF9BF},
+    {0x100001FE11D, 0x10001045906, {kw_masks.data() + 24374, 3}, 0x100011FF91F},
+    {0x100011E2155, 0x10001045906, {kw_masks.data() + 24377, 3}, 0x100011F7957},
+    {0x1000012D441, 0x10001045906, {kw_masks.data() + 24380, 2}, 0x1000116DD47},
+    {0x100005AD820, 0x10001045906, {kw_masks.data() + 24382, 3}, 0x100015ED926},
+    {0x100001AD8B0, 0x10001045906, {kw_masks.data() + 24385, 3}, 0x100011ED9B6},
+    {0x100001AD820, 0x10001045906, {kw_masks.data() + 24388, 3}, 0x100011ED926},
+    {0x100003AD930, 0x10001045906, {kw_masks.data() + 24391, 3}, 0x100013ED936},
+    {0x1EE801, 0x10001045906, {kw_masks.data() + 24394, 1}, 0x100011EF907},
+    {0x6E111, 0x10001045906, {kw_masks.data() + 24395, 1}, 0x1000106F917},
+    {0xE0011, 0x10001045906, {kw_masks.data() + 24396, 1}, 0x100010E5917},
+    {0x10001D1, 0x10001045906, {kw_masks.data() + 24397, 1}, 0x100010459D7},
+    {0x14C880, 0x10001045906, {kw_masks.data() + 24398, 1}, 0x1000114D986},
+    {0x142010, 0x10001045906, {kw_masks.data() + 24399, 1}, 0x10001147916},
+    {0x100004C7991, 0x10001045906, {kw_masks.data() + 24400, 3}, 0x100014C7997},
+    {0x10000067D0F, 0x10001045906, {kw_masks.data() + 24403, 6}, 0x100011E7D9F},
+    {0x100001A79D1, 0x10001045906, {kw_masks.data() + 24409, 4}, 0x100011E79D7},
+    {0x10C10C, 0x10001045906, {kw_masks.data() + 24413, 1}, 0x1000114D90E},
+    {0x40099, 0x10001045906, {kw_masks.data() + 24414, 1}, 0x1000104599F},
+    {0x2140010, 0x10001045906, {kw_masks.data() + 24415, 1}, 0x10003145916},
+    {0x66400, 0x10001045906, {kw_masks.data() + 24416, 1}, 0x10001067D06},
+    {0xE801, 0x10001045906, {kw_masks.data() + 24417, 1}, 0x1000104F907},
+    {0xC5019, 0x10001045906, {kw_masks.data() + 24418, 1}, 0x100010C591F},
+    {0x342805, 0x10001045906, {kw_masks.data() + 24419, 1}, 0x10001347907},
+    {0x4E118, 0x10001045906, {kw_masks.data() + 24420, 1}, 0x1000104F91E},
+    {0x100000E0CB7, 0x10001045906, {kw_masks.data() + 24421, 4}, 0x100010E5DB7},
+    {0x100000E0DE7, 0x10001045906, {kw_masks.data() + 24425, 4}, 0x100010E5DE7},
+    {0x100004E0DB7, 0x10001045906, {kw_masks.data() + 24429, 4}, 0x100014E5DB7},
+    {0x100004E0DE7, 0x10001045906, {kw_masks.data() + 24433, 4}, 0x100014E5DE7},
+    {0x200100004E69F9, 0x10001045906, {kw_masks.data() + 24437, 9}, 0x200100015E79FF},
+    {0x200100005EE9D9, 0x10001045906, {kw_masks.data() + 24446, 9}, 0x200100015EF9FF},
+    {0x200100004E69D9, 0x10001045906, {kw_masks.data() + 24455, 9}, 0x200100015E79FF},
+    {0x200100004E69D9, 0x10001045906, {kw_masks.data() + 24464, 9}, 0x200100015E79FF},
+    {0x10000067130, 0x10001045906, {kw_masks.data() + 24473, 3}, 0x10001067936},
+    {0x100004E5130, 0x10001045906, {kw_masks.data() + 24476, 3}, 0x100014E5936},
+    {0x42019, 0x10001045906, {kw_masks.data() + 24479, 1}, 0x1000104791F},
+    {0x100013E7957, 0x10001045906, {kw_masks.data() + 24480, 4}, 0x100013E7957},
+    {0x100013E7957, 0x10001045906, {kw_masks.data() + 24484, 4}, 0x100013E7957},
+    {0x100011F7957, 0x10001045906, {kw_masks.data() + 24488, 4}, 0x100011F7957},
+    {0x100013E7957, 0x10001045906, {kw_masks.data() + 24492, 4}, 0x100013E7957},
+    {0x100011E7957, 0x10001045906, {kw_masks.data() + 24496, 4}, 0x100011E7957},
+    {0x100011E795F, 0x10001045906, {kw_masks.data() + 24500, 4}, 0x100011E795F},
+    {0x100015D69F3, 0x10001045906, {kw_masks.data() + 24504, 6}, 0x100015FF9F7},
+    {0x100011C791A, 0x10001045906, {kw_masks.data() + 24510, 3}, 0x100015CF91F},
+    {0x100010ED81B, 0x10001045906, {kw_masks.data() + 24513, 3}, 0x100014EF91F},
+    {0x1000114581A, 0x10001045906, {kw_masks.data() + 24516, 3}, 0x1000154F91F},
+    {0x1000104D81B, 0x10001045906, {kw_masks.data() + 24519, 3}, 0x1000144F91F},
+    {0x100002E29D9, 0x10001045906, {kw_masks.data() + 24522, 4}, 0x100017E79DF},
+    {0x1000116D997, 0x10001045906, {kw_masks.data() + 24526, 3}, 0x1000116D997},
+    {0x100004EE9F1, 0x10001045906, {kw_masks.data() + 24529, 4}, 0x100014EF9F7},
+    {0x100005CE9F1, 0x10001045906, {kw_masks.data() + 24533, 4}, 0x100015CF9F7},
+    {0x100000EE9F1, 0x10001045906, {kw_masks.data() + 24537, 4}, 0x100010EF9F7},
+    {0x100001CE9F1, 0x10001045906, {kw_masks.data() + 24541, 4}, 0x100011CF9F7},
+    {0x100005EE9F9, 0x10001045906, {kw_masks.data() + 24545, 5}, 0x100015EF9FF},
+    {0x100005EE9F9, 0x10001045906, {kw_masks.data() + 24550, 5}, 0x100015EF9FF},
+    {0x100001EE9F9, 0x10001045906, {kw_masks.data() + 24555, 5}, 0x100011EF9FF},
+    {0x100001EE9F9, 0x10001045906, {kw_masks.data() + 24560, 5}, 0x100011EF9FF},
+    {0x100006EE9F1, 0x10001045906, {kw_masks.data() + 24565, 5}, 0x100016EF9F7},
+    {0x100007CE9F1, 0x10001045906, {kw_masks.data() + 24570, 5}, 0x100017CF9F7},
+    {0x100002EE9F1, 0x10001045906, {kw_masks.data() + 24575, 5}, 0x100012EF9F7},
+    {0x100003CE9F1, 0x10001045906, {kw_masks.data() + 24580, 5}, 0x100013CF9F7},
+    {0x100016EE9F1, 0x10001045906, {kw_masks.data() + 24585, 6}, 0x100016EF9F7},
+    {0x100017CE9F1, 0x10001045906, {kw_masks.data() + 24591, 6}, 0x100017CF9F7},
+    {0x100012EE9F1, 0x10001045906, {kw_masks.data() + 24597, 6}, 0x100012EF9F7},
+    {0x100013CE9F1, 0x10001045906, {kw_masks.data() + 24603, 6}, 0x100013CF9F7},
+    {0x100005EE1DA, 0x10001045906, {kw_masks.data() + 24609, 4}, 0x100015EF9DE},
+    {0x100005CE1DA, 0x10001045906, {kw_masks.data() + 24613, 4}, 0x100015CF9DE},
+    {0x100001EE1DB, 0x10001045906, {kw_masks.data() + 24617, 4}, 0x100011EF9DF},
+    {0x100001CE1DB, 0x10001045906, {kw_masks.data() + 24621, 4}, 0x100011CF9DF},
+    {0x100017EE1DB, 0x10001045906, {kw_masks.data() + 24625, 5}, 0x100017EF9DF},
+    {0x100017CE1DB, 0x10001045906, {kw_masks.data() + 24630, 5}, 0x100017CF9DF},
+    {0x100013EE1DB, 0x10001045906, {kw_masks.data() + 24635, 5}, 0x100013EF9DF},
+    {0x100013CE1DB, 0x10001045906, {kw_masks.data() + 24640, 5}, 0x100013CF9DF},
+    {0x100005F7991, 0x10001045906, {kw_masks.data() + 24645, 4}, 0x100015F7997},
+    {0x100005F7D97, 0x10001045906, {kw_masks.data() + 24649, 5}, 0x100015F7D97},
+    {0x100001F7919, 0x10001045906, {kw_masks.data() + 24654, 6}, 0x100011F7D3F},
+    {0x100001F7D1F, 0x10001045906, {kw_masks.data() + 24660, 8}, 0x100013F7D3F},
+    {0x100004E4C3D, 0x10001045906, {kw_masks.data() + 24668, 2}, 0x100014E5D3F},
+    {0x100005EC41D, 0x10001045906, {kw_masks.data() + 24670, 2}, 0x100015EDD1F},
+    {0x100004E45DD, 0x10001045906, {kw_masks.data() + 24672, 2}, 0x100014E5DDF},
+    {0x100004E641D, 0x10001045906, {kw_masks.data() + 24674, 2}, 0x100014E7D1F},
+    {0x100001EF955, 0x10001045906, {kw_masks.data() + 24676, 7}, 0x100015EF95F},
+    {0x100013EF9D5, 0x10001045906, {kw_masks.data() + 24683, 5}, 0x100013EF9D7},
+    {0x100001AF951, 0x10001045906, {kw_masks.data() + 24688, 4}, 0x100011EF957},
+    {0x100013AF9D1, 0x10001045906, {kw_masks.data() + 24692, 5}, 0x100013EF9D7},
+    {0x100012EF099, 0x10001045906, {kw_masks.data() + 24697, 3}, 0x100012EF99F},
+    {0x100004EF099, 0x10001045906, {kw_masks.data() + 24700, 4}, 0x100014EF99F},
+    {0x200100013F7DBF, 0x10001045906, {kw_masks.data() + 24704, 9}, 0x200100013F7DBF},
+    {0x200100013F7DBF, 0x10001045906, {kw_masks.data() + 24713, 8}, 0x200100013F7DBF},
+    {0x200100017F7DBF, 0x10001045906, {kw_masks.data() + 24721, 9}, 0x200100017F7DBF},
+    {0x100012A71D3, 0x10001045906, {kw_masks.data() + 24730, 3}, 0x100012E79D7},
+    {0x200100000E7173, 0x10001045906, {kw_masks.data() + 24733, 4}, 0x200100010E7977},
+    {0x200100012E71F3, 0x10001045906, {kw_masks.data() + 24737, 5}, 0x200100012E79F7},
+    {0x10001364999, 0x10001045906, {kw_masks.data() + 24742, 3}, 0x1000136599F},
+    {0x10001364999, 0x10001045906, {kw_masks.data() + 24745, 4}, 0x1000136599F},
+    {0x1000002449F, 0x10001045906, {kw_masks.data() + 24749, 2}, 0x10001065D9F},
+    {0x1000026449F, 0x10001045906, {kw_masks.data() + 24751, 3}, 0x10001265D9F},
+    {0x100000A8DD5, 0x20450, {kw_masks.data() + 24754, 4}, 0x100000A8DD5},
+    {0x100000E1CD1, 0x20450, {kw_masks.data() + 24758, 4}, 0x100000E1CD1},
+    {0x100000E9DD5, 0x20450, {kw_masks.data() + 24762, 5}, 0x100000E9DD5},
+    {0x100000E9DD5, 0x20450, {kw_masks.data() + 24767, 5}, 0x100000E9DD5},
+    {0x10000163D51, 0x20450, {kw_masks.data() + 24772, 5}, 0x10000963D59},
+    {0x100010ABDDD, 0x20450, {kw_masks.data() + 24777, 5}, 0x100010ABDDD},
+    {0x100010EBDD9, 0x20450, {kw_masks.data() + 24782, 5}, 0x100010EBDD9},
+    {0x1000102F551, 0x20450, {kw_masks.data() + 24787, 4}, 0x100011EF557},
+    {0x100013E7D5B, 0x20450, {kw_masks.data() + 24791, 6}, 0x100013E7D5B},
+    {0x100011E7D5B, 0x20450, {kw_masks.data() + 24797, 6}, 0x100011E7D5B},
+    {0x100013E7D5B, 0x20450, {kw_masks.data() + 24803, 7}, 0x100013E7D5B},
+    {0x100010ACD55, 0x20450, {kw_masks.data() + 24810, 4}, 0x100010ACD55},
+    {0x100004EEDD5, 0x20450, {kw_masks.data() + 24814, 5}, 0x100004EEDD5},
+    {0x100004EEDD5, 0x20450, {kw_masks.data() + 24819, 5}, 0x100004EEDD5},
+    {0x100004EEDD5, 0x20450, {kw_masks.data() + 24824, 5}, 0x100004EEDD5},
+    {0x100004EEDD5, 0x20450, {kw_masks.data() + 24829, 5}, 0x100004EEDD5},
+    {0x100004EFDD5, 0x20450, {kw_masks.data() + 24834, 5}, 0x100004EFDD5},
+    {0x100005EEDD5, 0x20450, {kw_masks.data() + 24839, 5}, 0x100005EEDD5},
+    {0x100004EFDD5, 0x20450, {kw_masks.data() + 24844, 5}, 0x100004EFDD5},
+    {0x100014E7DD9, 0x20450, {kw_masks.data() + 24849, 6}, 0x100014E7DD9},
+    {0x100000A8DD5, 0x20450, {kw_masks.data() + 24855, 4}, 0x100000A8DD5},
+    {0x100000A8D57, 0x20450, {kw_masks.data() + 24859, 4}, 0x100000A8D57},
+    {0x100000A9D55, 0x20450, {kw_masks.data() + 24863, 5}, 0x100001AFD75},
+    {0x100000A8D5D, 0x20450, {kw_masks.data() + 24868, 4}, 0x100000A8D5D},
+    {0x100000EED55, 0x20450, {kw_masks.data() + 24872, 4}, 0x100000EED55},
+    {0x100020A8D55, 0x20450, {kw_masks.data() + 24876, 4}, 0x100020A8D55},
+    {0x100000A8D55, 0x20450, {kw_masks.data() + 24880, 4}, 0x100000A8D55},
+    {0x100000A8DD5, 0x20450, {kw_masks.data() + 24884, 4}, 0x100000A8DD5},
+    {0x100000ACD55, 0x20450, {kw_masks.data() + 24888, 5}, 0x100000ECD5D},
+    {0x100000A8D55, 0x20450, {kw_masks.data() + 24893, 4}, 0x100000A8D55},
+    {0x100000A9D5D, 0x20450, {kw_masks.data() + 24897, 4}, 0x100000A9D5D},
+    {0x100001A9D55, 0x20450, {kw_masks.data() + 24901, 4}, 0x100001A9D55},
+    {0x100001AAD55, 0x20450, {kw_masks.data() + 24905, 4}, 0x100001AAD55},
+    {0x100008A8D55, 0x20450, {kw_masks.data() + 24909, 4}, 0x100008A8D55},
+    {0x100000AFD55, 0x20450, {kw_masks.data() + 24913, 4}, 0x100000AFD55},
+    {0x100000A8D55, 0x20450, {kw_masks.data() + 24917, 4}, 0x100000A8D55},
+    {0x100000ACDD5, 0x20450, {kw_masks.data() + 24921, 4}, 0x100000ACDD5},
+    {0x100000E9D55, 0x20450, {kw_masks.data() + 24925, 4}, 0x100000E9D55},
+    {0x100001A8D55, 0x20450, {kw_masks.data() + 24929, 4}, 0x100001A8D55},
+    {0x100001EED55, 0x20450, {kw_masks.data() + 24933, 4}, 0x100001EED55},
+    {0x100000A8DD5, 0x20450, {kw_masks.data() + 24937, 4}, 0x100000A8DD5},
+    {0x100000A8DD5, 0x20450, {kw_masks.data() + 24941, 4}, 0x100000A8DD5},
+    {0x100000E8D55, 0x20450, {kw_masks.data() + 24945, 4}, 0x100000E8D55},
+    {0x100000ADD55, 0x20450, {kw_masks.data() + 24949, 4}, 0x100000ADD55},
+    {0x100014ACDDD, 0x20450, {kw_masks.data() + 24953, 5}, 0x100014ACDDD},
+    {0x100015EEDDD, 0x20450, {kw_masks.data() + 24958, 5}, 0x100015EEDDD},
+    {0x100004EFDD1, 0x20450, {kw_masks.data() + 24963, 5}, 0x100004EFDD1},
+    {0x100004EFDD1, 0x20450, {kw_masks.data() + 24968, 5}, 0x100004EFDD1},
+    {0x100004E7DD1, 0x20450, {kw_masks.data() + 24973, 5}, 0x100004E7DD1},
+    {0x100004E7DD1, 0x20450, {kw_masks.data() + 24978, 5}, 0x100004E7DD1},
+    {0x100015EFDD9, 0x20450, {kw_masks.data() + 24983, 6}, 0x100015EFDD9},
+    {0x100000E9CD1, 0x20450, {kw_masks.data() + 24989, 4}, 0x100000E9CD1},
+    {0x100000E1C53, 0x20450, {kw_masks.data() + 24993, 4}, 0x100000E1C53},
+    {0x100000E1C51, 0x20450, {kw_masks.data() + 24997, 4}, 0x100000E1C51},
+    {0x100000E1C59, 0x20450, {kw_masks.data() + 25001, 4}, 0x100000E1C59},
+    {0x100000EFD51, 0x20450, {kw_masks.data() + 25005, 4}, 0x100000EFD51},
+    {0x100020E1C51, 0x20450, {kw_masks.data() + 25009, 4}, 0x100020E1C51},
+    {0x100000E1C51, 0x20450, {kw_masks.data() + 25013, 4}, 0x100000E1C51},
+    {0x100000E1CD1, 0x20450, {kw_masks.data() + 25017, 4}, 0x100000E1CD1},
+    {0x100000E5D51, 0x20450, {kw_masks.data() + 25021, 4}, 0x100000E5D51},
+    {0x100000E9C51, 0x20450, {kw_masks.data() + 25025, 4}, 0x100000E9C51},
+    {0x100000E1C59, 0x20450, {kw_masks.data() + 25029, 5}, 0x100000E1C5B},
+    {0x100001E1C51, 0x20450, {kw_masks.data() + 25034, 4}, 0x100001E1C51},
+    {0x100001E3C51, 0x20450, {kw_masks.data() + 25038, 4}, 0x100001E3C51},
+    {0x100008E1D51, 0x20450, {kw_masks.data() + 25042, 4}, 0x100008E1D51},
+    {0x100000E7D55, 0x20450, {kw_masks.data() + 25046, 4}, 0x100000E7D55},
+    {0x100000E9D51, 0x20450, {kw_masks.data() + 25050, 4}, 0x100000E9D51},
+    {0x100000E5CD1, 0x20450, {kw_masks.data() + 25054, 4}, 0x100000E5CD1},
+    {0x100000E3D71, 0x20450, {kw_masks.data() + 25058, 10}, 0x100000E7DF9},
+    {0x100000E1D51, 0x20450, {kw_masks.data() + 25068, 4}, 0x100000E1D51},
+    {0x100001E1C51, 0x20450, {kw_masks.data() + 25072, 4}, 0x100001E1C51},
+    {0x100001EFD51, 0x20450, {kw_masks.data() + 25076, 4}, 0x100001EFD51},
+    {0x100000E9DD1, 0x20450, {kw_masks.data() + 25080, 4}, 0x100000E9DD1},
+    {0x100000E1DD5, 0x20450, {kw_masks.data() + 25084, 4}, 0x100000E1DD5},
+    {0x100000E9D51, 0x20450, {kw_masks.data() + 25088, 4}, 0x100000E9D51},
+    {0x100000E5C51, 0x20450, {kw_masks.data() + 25092, 4}, 0x100000E5C51},
+    {0x100014E5DD9, 0x20450, {kw_masks.data() + 25096, 5}, 0x100014E5DD9},
+    {0x100015EFDD9, 0x20450, {kw_masks.data() + 25101, 5}, 0x100015EFDD9},
+    {0x100004E7DD5, 0x20450, {kw_masks.data() + 25106, 5}, 0x100004E7DD5},
+    {0x100005EFDD1, 0x20450, {kw_masks.data() + 25111, 5}, 0x100005EFDD1},
+    {0x100004E7DD1, 0x20450, {kw_masks.data() + 25116, 5}, 0x100004E7DD1},
+    {0x100010EDD57, 0x20450, {kw_masks.data() + 25121, 4}, 0x100010EDD57},
+    {0x100010E5C53, 0x20450, {kw_masks.data() + 25125, 4}, 0x100011E5C5F},
+    {0x100010E5CD3, 0x20450, {kw_masks.data() + 25129, 4}, 0x100010EDDD7},
+    {0x100015EFDD2, 0x20450, {kw_masks.data() + 25133, 4}, 0x100015EFDD2},
+    {0x100015EFDDF, 0x20450, {kw_masks.data() + 25137, 5}, 0x100015EFDDF},
+    {0x100015EFDDB, 0x20450, {kw_masks.data() + 25142, 5}, 0x100015EFDDB},
+    {0x1000106DDD2, 0x20450, {kw_masks.data() + 25147, 3}, 0x1000106DDD2},
+    {0x1000106DD52, 0x20450, {kw_masks.data() + 25150, 4}, 0x1000106DD53},
+    {0x10001065D53, 0x20450, {kw_masks.data() + 25154, 3}, 0x10001065D53},
+    {0x100000ACDD5, 0x20450, {kw_masks.data() + 25157, 4}, 0x100000ACDD5},
+    {0x100000EDDD5, 0x20450, {kw_masks.data() + 25161, 5}, 0x100000EDDD5},
+    {0x100000E1D51, 0x20450, {kw_masks.data() + 25166, 3}, 0x100000E1D51},
+    {0x100000E1D51, 0x20450, {kw_masks.data() + 25169, 4}, 0x100000E1D51},
+    {0x100000A1D59, 0x20450, {kw_masks.data() + 25173, 3}, 0x100000A1D59},
+    {0x100000E1D59, 0x20450, {kw_masks.data() + 25176, 4}, 0x100000E1D59},
+    {0x100000ACC51, 0x20450, {kw_masks.data() + 25180, 3}, 0x100000ACC51},
+    {0x100000EDC51, 0x20450, {kw_masks.data() + 25183, 4}, 0x100000EDC51},
+    {0x100000E9D51, 0x20450, {kw_masks.data() + 25187, 3}, 0x100000E9D51},
+    {0x100000E9D51, 0x20450, {kw_masks.data() + 25190, 4}, 0x100000E9D51},
+    {0x100000EC995, 0x20450, {kw_masks.data() + 25194, 4}, 0x100000ECDD5},
+    {0x100000ED995, 0x20450, {kw_masks.data() + 25198, 4}, 0x100000EDDD5},
+    {0x100000AC935, 0x20450, {kw_masks.data() + 25202, 4}, 0x100000ACD75},
+    {0x100000ED935, 0x20450, {kw_masks.data() + 25206, 4}, 0x100000EDD75},
+    {0x100000ACD95, 0x20450, {kw_masks.data() + 25210, 4}, 0x100000ACDD5},
+    {0x100000EDD95, 0x20450, {kw_masks.data() + 25214, 4}, 0x100000EDDD5},
+    {0x100000AC995, 0x20450, {kw_masks.data() + 25218, 4}, 0x100000ACDD5},
+    {0x100000ED995, 0x20450, {kw_masks.data() + 25222, 4}, 0x100000EDDD5},
+    {0x100000AE955, 0x20450, {kw_masks.data() + 25226, 4}, 0x100000AED55},
+    {0x100000EF955, 0x20450, {kw_masks.data() + 25230, 4}, 0x100000EFD55},
+    {0x100000ED995, 0x20450, {kw_masks.data() + 25234, 4}, 0x100000EDDD5},
+    {0x100000ED995, 0x20450, {kw_masks.data() + 25238, 4}, 0x100000EDDD5},
+    {0x100000AC91D, 0x20450, {kw_masks.data() + 25242, 4}, 0x100000ACD5D},
+    {0x100000ED91D, 0x20450, {kw_masks.data() + 25246, 4}, 0x100000EDD5D},
+    {0x1000106DC53, 0x20450, {kw_masks.data() + 25250, 4}, 0x100010EDD57},
+    {0x10001065CD2, 0x20450, {kw_masks.data() + 25254, 4}, 0x100010E5DDB},
+    {0x100011E7D53, 0x20450, {kw_masks.data() + 25258, 6}, 0x100011E7D53},
+    {0x100010A4C50, 0x20450, {kw_masks.data() + 25264, 3}, 0x100010A4C50},
+    {0x100010EDDD7, 0x20450, {kw_masks.data() + 25267, 4}, 0x100010EDDD7},
+    {0x100011EFD53, 0x20450, {kw_masks.data() + 25271, 5}, 0x100011EFDD3},
+    {0x100000ECDD5, 0x20450, {kw_masks.data() + 25276, 4}, 0x100000ECDD5},
+    {0x100000E5CD1, 0x20450, {kw_masks.data() + 25280, 4}, 0x100000E5CD1},
+    {0x100011EFD57, 0x20450, {kw_masks.data() + 25284, 5}, 0x100011EFD57},
+    {0x100000EAD55, 0x20450, {kw_masks.data() + 25289, 4}, 0x100000EAD55},
+    {0x100000E3C51, 0x20450, {kw_masks.data() + 25293, 4}, 0x100000E3C51},
+    {0x100014E5DD2, 0x20450, {kw_masks.data() + 25297, 4}, 0x100014E5DD2},
+    {0x100013EFD5F, 0x20450, {kw_masks.data() + 25301, 7}, 0x100013EFD5F},
+    {0x100011EFD5F, 0x20450, {kw_masks.data() + 25308, 7}, 0x100011EFD5F},
+    {0x100013EFD5F, 0x20450, {kw_masks.data() + 25315, 9}, 0x100013EFD5F},
+    {0x100005EC114, 0x10000167032, {kw_masks.data() + 25324, 3}, 0x100005FF13F},
+    {0x100001E8194, 0x10000167032, {kw_masks.data() + 25327, 3}, 0x100001EF1BE},
+    {0x100001EE114, 0x10000167032, {kw_masks.data() + 25330, 2}, 0x100001EF136},
+    {0x100003B6975, 0x10000167032, {kw_masks.data() + 25332, 4}, 0x100003F7977},
+    {0x100003A69F5, 0x10000167032, {kw_masks.data() + 25336, 4}, 0x100003E79F7},
+    {0x100003F69F5, 0x10000167032, {kw_masks.data() + 25340, 4}, 0x100003F79F7},
+    {0x100021EC114, 0x10000167032, {kw_masks.data() + 25344, 2}, 0x100021EF136},
+    {0x100001EB915, 0x10000167032, {kw_masks.data() + 25346, 4}, 0x100001EF937},
+    {0x100001EC134, 0x10000167032, {kw_masks.data() + 25350, 2}, 0x100001EF136},
+    {0x100003E8134, 0x10000167032, {kw_masks.data() + 25352, 2}, 0x100003EF136},
+    {0x100009E8114, 0x10000167032, {kw_masks.data() + 25354, 2}, 0x100009EF136},
+    {0x100003EA114, 0x10000167032, {kw_masks.data() + 25356, 2}, 0x100003EF136},
+    {0x100001E81D4, 0x10000167032, {kw_masks.data() + 25358, 2}, 0x100001EF1F6},
+    {0x100001EA114, 0x10000167032, {kw_masks.data() + 25360, 2}, 0x100001EF136},
+    {0x100001EA954, 0x10000167032, {kw_masks.data() + 25362, 3}, 0x100001EF976},
+    {0x100001EB114, 0x10000167032, {kw_masks.data() + 25365, 2}, 0x100001EF136},
+    {0x100001FA955, 0x10000167032, {kw_masks.data() + 25367, 3}, 0x100001FF977},
+    {0x100001EA9B5, 0x10000167032, {kw_masks.data() + 25370, 3}, 0x100001EF9B7},
+    {0x100001EA1D5, 0x10000167032, {kw_masks.data() + 25373, 3}, 0x100001EF1F7},
+    {0x100001EB915, 0x10000167032, {kw_masks.data() + 25376, 4}, 0x100001EF937},
+    {0x100021EC116, 0x10000167032, {kw_masks.data() + 25380, 2}, 0x100021EF136},
+    {0x100001EE116, 0x10000167032, {kw_masks.data() + 25382, 2}, 0x100001EF136},
+    {0x100005EC106, 0x10000167032, {kw_masks.data() + 25384, 2}, 0x100005EF136},
+    {0x100001E8196, 0x10000167032, {kw_masks.data() + 25386, 2}, 0x100001EF1B6},
+    {0x100001EC126, 0x10000167032, {kw_masks.data() + 25388, 2}, 0x100001EF136},
+    {0x100003E8136, 0x10000167032, {kw_masks.data() + 25390, 2}, 0x100003EF136},
+    {0x100009E8106, 0x10000167032, {kw_masks.data() + 25392, 2}, 0x100009EF136},
+    {0x100003EA116, 0x10000167032, {kw_masks.data() + 25394, 2}, 0x100003EF136},
+    {0x100001E81D6, 0x10000167032, {kw_masks.data() + 25396, 2}, 0x100001EF1F6},
+    {0x100001EA116, 0x10000167032, {kw_masks.data() + 25398, 2}, 0x100001EF136},
+    {0x100001EA946, 0x10000167032, {kw_masks.data() + 25400, 3}, 0x100001EF976},
+    {0x100001EB106, 0x10000167032, {kw_masks.data() + 25403, 2}, 0x100001EF136},
+    {0x100001FA957, 0x10000167032, {kw_masks.data() + 25405, 3}, 0x100001FF977},
+    {0x100001EA9B7, 0x10000167032, {kw_masks.data() + 25408, 3}, 0x100001EF9B7},
+    {0x100001EA1D7, 0x10000167032, {kw_masks.data() + 25411, 3}, 0x100001EF1F7},
+    {0x100001EB917, 0x10000167032, {kw_masks.data() + 25414, 4}, 0x100001EF937},
+    {0x100001EB917, 0x10000167032, {kw_masks.data() + 25418, 4}, 0x100001EF937},
+    {0x100001EF917, 0x10000167032, {kw_masks.data() + 25422, 4}, 0x100001EF937},
+    {0x100009EB917, 0x10000167032, {kw_masks.data() + 25426, 4}, 0x100009EF937},
+    {0x100005EB997, 0x10000167032, {kw_masks.data() + 25430, 5}, 0x100005EF9B7},
+    {0x100001EB997, 0x10000167032, {kw_masks.data() + 25435, 4}, 0x100001EF9B7},
+    {0x100001EBD17, 0x10000167032, {kw_masks.data() + 25439, 4}, 0x100001EFD37},
+    {0x100001EB917, 0x10000167032, {kw_masks.data() + 25443, 4}, 0x100001EF937},
+    {0x100001EB917, 0x10000167032, {kw_masks.data() + 25447, 4}, 0x100001EF937},
+    {0x100001EB917, 0x10000167032, {kw_masks.data() + 25451, 4}, 0x100001EF937},
+    {0x100001EB917, 0x10000167032, {kw_masks.data() + 25455, 4}, 0x100001EF937},
+    {0x100001EB917, 0x10000167032, {kw_masks.data() + 25459, 4}, 0x100001EF937},
+    {0x100001EB917, 0x10000167032, {kw_masks.data() + 25463, 4}, 0x100001EF937},
+    {0x100003E69F5, 0x10000167032, {kw_masks.data() + 25467, 4}, 0x100003E79F7},
+    {0x100003A69F5, 0x10000167032, {kw_masks.data() + 25471, 4}, 0x100003E79F7},
+    {0x100003A69F5, 0x10000167032, {kw_masks.data() + 25475, 4}, 0x100003E79F7},
+    {0x100003A69FD, 0x10000167032, {kw_masks.data() + 25479, 4}, 0x100003E79FF},
+    {0x100007E69ED, 0x10000167032, {kw_masks.data() + 25483, 4}, 0x100007E79FF},
+    {0x100003A69F5, 0x10000167032, {kw_masks.data() + 25487, 4}, 0x100003E79F7},
+    {0x100007E69E5, 0x10000167032, {kw_masks.data() + 25491, 4}, 0x100007E79F7},
+    {0x100003E69F5, 0x10000167032, {kw_masks.data() + 25495, 4}, 0x100003E79F7},
+    {0x100003E69E5, 0x10000167032, {kw_masks.data() + 25499, 4}, 0x100003E79F7},
+    {0x10000BE69F5, 0x10000167032, {kw_masks.data() + 25503, 4}, 0x10000BE79F7},
+    {0x10000BE69F5, 0x10000167032, {kw_masks.data() + 25507, 4}, 0x10000BE79F7},
+    {0x100003A69F5, 0x10000167032, {kw_masks.data() + 25511, 4}, 0x100003E79F7},
+    {0x100003E69F5, 0x10000167032, {kw_masks.data() + 25515, 4}, 0x100003E79F7},
+    {0x100003E69F5, 0x10000167032, {kw_masks.data() + 25519, 4}, 0x100003E79F7},
+    {0x100003E69F5, 0x10000167032, {kw_masks.data() + 25523, 4}, 0x100003E79F7},
+    {0x100001A7135, 0x10000167032, {kw_masks.data() + 25527, 3}, 0x100001E7137},
+    {0x10000127811, 0x10000167032, {kw_masks.data() + 25530, 3}, 0x10000167833},
+    {0x100005A7811, 0x10000167032, {kw_masks.data() + 25533, 3}, 0x100005E7833},
+    {0x100001A7891, 0x10000167032, {kw_masks.data() + 25536, 3}, 0x100001E78B3},
+    {0x10000127831, 0x10000167032, {kw_masks.data() + 25539, 3}, 0x10000167833},
+    {0x10000327931, 0x10000167032, {kw_masks.data() + 25542, 3}, 0x10000367933},
+    {0x10000967911, 0x10000167032, {kw_masks.data() + 25545, 3}, 0x10000967933},
+    {0x10000367811, 0x10000167032, {kw_masks.data() + 25548, 3}, 0x10000367833},
+    {0x100001A79D1, 0x10000167032, {kw_masks.data() + 25551, 3}, 0x100001E79F3},
+    {0x10000127911, 0x10000167032, {kw_masks.data() + 25554, 3}, 0x10000167933},
+    {0x100001A7811, 0x10000167032, {kw_masks.data() + 25557, 3}, 0x100001E7833},
+    {0x10000327811, 0x10000167032, {kw_masks.data() + 25560, 3}, 0x10000367833},
+    {0x100007A7811, 0x10000167032, {kw_masks.data() + 25563, 3}, 0x100007E7833},
+    {0x100011A7931, 0x10000167032, {kw_masks.data() + 25566, 3}, 0x100011E7933},
+    {0x10000127899, 0x10000167032, {kw_masks.data() + 25569, 4}, 0x100001678BB},
+    {0x100003279B9, 0x10000167032, {kw_masks.data() + 25573, 4}, 0x100003679BB},
+    {0x100001E7899, 0x10000167032, {kw_masks.data() + 25577, 4}, 0x100001E78BB},
+    {0x10000167811, 0x10000167032, {kw_masks.data() + 25581, 4}, 0x10000167833},
+    {0x100005E7811, 0x10000167032, {kw_masks.data() + 25585, 4}, 0x100005E7833},
+    {0x100001E7891, 0x10000167032, {kw_masks.data() + 25589, 4}, 0x100001E78B3},
+    {0x10000167831, 0x10000167032, {kw_masks.data() + 25593, 4}, 0x10000167833},
+    {0x10000367931, 0x10000167032, {kw_masks.data() + 25597, 4}, 0x10000367933},
+    {0x10000967911, 0x10000167032, {kw_masks.data() + 25601, 4}, 0x10000967933},
+    {0x10000367811, 0x10000167032, {kw_masks.data() + 25605, 4}, 0x10000367833},
+    {0x100001E79D1, 0x10000167032, {kw_masks.data() + 25609, 4}, 0x100001E79F3},
+    {0x10000167911, 0x10000167032, {kw_masks.data() + 25613, 4}, 0x10000167933},
+    {0x100001E7811, 0x10000167032, {kw_masks.data() + 25617, 4}, 0x100001E7833},
+    {0x10000367811, 0x10000167032, {kw_masks.data() + 25621, 4}, 0x10000367833},
+    {0x100007E7811, 0x10000167032, {kw_masks.data() + 25625, 4}, 0x100007E7833},
+    {0x100011E7931, 0x10000167032, {kw_masks.data() + 25629, 4}, 0x100011E7933},
+    {0x10000167899, 0x10000167032, {kw_masks.data() + 25633, 5}, 0x100001678BB},
+    {0x100003679B9, 0x10000167032, {kw_masks.data() + 25638, 5}, 0x100003679BB},
+    {0x100001E7899, 0x10000167032, {kw_masks.data() + 25643, 5}, 0x100001E78BB},
+    {0x100001E789D, 0x10000167032, {kw_masks.data() + 25648, 4}, 0x100001E78BF},
+    {0x100003E79B9, 0x10000167032, {kw_masks.data() + 25652, 4}, 0x100003E79BB},
+    {0x100001E7899, 0x10000167032, {kw_masks.data() + 25656, 4}, 0x100001E78BB},
+    {0x10000367899, 0x10000167032, {kw_masks.data() + 25660, 8}, 0x100003EF9FF},
+    {0x100002E391D, 0x10000167032, {kw_masks.data() + 25668, 4}, 0x100003E793F},
+    {0x100009E7931, 0x10000167032, {kw_masks.data() + 25672, 5}, 0x100009E7933},
+    {0x100011A7931, 0x10000167032, {kw_masks.data() + 25677, 5}, 0x100011E7933},
+    {0x100011E79B9, 0x10000167032, {kw_masks.data() + 25682, 4}, 0x100011E79BB},
+    {0x100001E7899, 0x10000167032, {kw_masks.data() + 25686, 5}, 0x100001E78BB},
+    {0x100023E69FD, 0x10000167032, {kw_masks.data() + 25691, 4}, 0x100023E79FF},
+    {0x100005A6158, 0x10000167032, {kw_masks.data() + 25695, 3}, 0x100005E717A},
+    {0x100001A21D8, 0x10000167032, {kw_masks.data() + 25698, 3}, 0x100001E71FA},
+    {0x100000E9995, 0x100010E2835, {kw_masks.data() + 25701, 3}, 0x100010EB9B5},
+    {0x100000E9995, 0x100010E2835, {kw_masks.data() + 25704, 3}, 0x100010EB9B5},
+    {0x100000E999D, 0x100010E2835, {kw_masks.data() + 25707, 3}, 0x100010EB9BD},
+    {0x100000E99D5, 0x100010E2835, {kw_masks.data() + 25710, 3}, 0x100010EB9F5},
+    {0x100000E9B95, 0x100010E2835, {kw_masks.data() + 25713, 3}, 0x100010EBBB5},
+    {0x100000E9D95, 0x100010E2835, {kw_masks.data() + 25716, 3}, 0x100010EBDB5},
+    {0x100000EB995, 0x100010E2835, {kw_masks.data() + 25719, 3}, 0x100010EB9B5},
+    {0x100000ED995, 0x100010E2835, {kw_masks.data() + 25722, 3}, 0x100010EF9B5},
+    {0x100000E9995, 0x100010E2835, {kw_masks.data() + 25725, 5}, 0x100014EF9B5},
+    {0x100000F9995, 0x100010E2835, {kw_masks.data() + 25730, 3}, 0x100010FB9B5},
+    {0x100000E9995, 0x100010E2835, {kw_masks.data() + 25733, 3}, 0x100010EB9B5},
+    {0x100000E9995, 0x100010E2835, {kw_masks.data() + 25736, 3}, 0x100010EB9B5},
+    {0x100001E9995, 0x100010E2835, {kw_masks.data() + 25739, 3}, 0x100011EB9B5},
+    {0x100002E9995, 0x100010E2835, {kw_masks.data() + 25742, 3}, 0x100012EB9B5},
+    {0x100004E9995, 0x100010E2835, {kw_masks.data() + 25745, 3}, 0x100014EB9B5},
+    {0x100008E9995, 0x100010E2835, {kw_masks.data() + 25748, 3}, 0x100018EB9B5},
+    {0x100010E9995, 0x100010E2835, {kw_masks.data() + 25751, 3}, 0x100010EB9B5},
+    {0x100020E9995, 0x100010E2835, {kw_masks.data() + 25754, 3}, 0x100030EB9B5},
+    {0x100000E9995, 0x100010E2835, {kw_masks.data() + 25757, 3}, 0x100010EB9B5},
+    {0x100000E9997, 0x100010E2835, {kw_masks.data() + 25760, 3}, 0x100010EB9B7},
+    {0x100000E9995, 0x100010E2835, {kw_masks.data() + 25763, 3}, 0x100010EB9B5},
+    {0x100000E999D, 0x100010E2835, {kw_masks.data() + 25766, 3}, 0x100010EB9BD},
+    {0x100000E99B5, 0x100010E2835, {kw_masks.data() + 25769, 3}, 0x100010EB9B5},
+    {0x100000E9995, 0x100010E2835, {kw_masks.data() + 25772, 3}, 0x100010EB9B5},
+    {0x100000E9995, 0x100010E2835, {kw_masks.data() + 25775, 3}, 0x100010EB9B5},
+    {0x100000E9B95, 0x100010E2835, {kw_masks.data() + 25778, 3}, 0x100010EBBB5},
+    {0x100000E9D95, 0x100010E2835, {kw_masks.data() + 25781, 3}, 0x100010EBDB5},
+    {0x100000E9995, 0x100010E2835, {kw_masks.data() + 25784, 3}, 0x100010EB9B5},
+    {0x100000E9995, 0x100010E2835, {kw_masks.data() + 25787, 3}, 0x100010EB9B5},
+    {0x100000EB995, 0x100010E2835, {kw_masks.data() + 25790, 3}, 0x100010EB9B5},
+    {0x100000E9995, 0x100010E2835, {kw_masks.data() + 25793, 3}, 0x100010EB9B5},
+    {0x100000F9995, 0x100010E2835, {kw_masks.data() + 25796, 3}, 0x100010FB9B5},
+    {0x100000E9995, 0x100010E2835, {kw_masks.data() + 25799, 3}, 0x100010EB9B5},
+    {0x100000E9995, 0x100010E2835, {kw_masks.data() + 25802, 3}, 0x100010EB9B5},
+    {0x100000E9995, 0x100010E2835, {kw_masks.data() + 25805, 3}, 0x100010EB9B5},
+    {0x100001E9995, 0x100010E2835, {kw_masks.data() + 25808, 3}, 0x100011EB9B5},
+    {0x100002E9995, 0x100010E2835, {kw_masks.data() + 25811, 3}, 0x100012EB9B5},
+    {0x100004E9995, 0x100010E2835, {kw_masks.data() + 25814, 3}, 0x100014EB9B5},
+    {0x100008E9995, 0x100010E2835, {kw_masks.data() + 25817, 3}, 0x100018EB9B5},
+    {0x100010E9995, 0x100010E2835, {kw_masks.data() + 25820, 3}, 0x100010EB9B5},
+    {0x100020E9995, 0x100010E2835, {kw_masks.data() + 25823, 3}, 0x100030EB9B5},
+    {0x100000ED99F, 0x100010E2835, {kw_masks.data() + 25826, 4}, 0x100010EF9BF},
+    {0x100000ED99F, 0x100010E2835, {kw_masks.data() + 25830, 4}, 0x100010EF9BF},
+    {0x100000ED99F, 0x100010E2835, {kw_masks.data() + 25834, 4}, 0x100010EF9BF},
+    {0x100000ED99F, 0x100010E2835, {kw_masks.data() + 25838, 4}, 0x100010EF9BF},
+    {0x100000ED99F, 0x100010E2835, {kw_masks.data() + 25842, 4}, 0x100010EF9BF},
+    {0x100000ED9BF, 0x100010E2835, {kw_masks.data() + 25846, 4}, 0x100010EF9BF},
+    {0x100000ED9DF, 0x100010E2835, {kw_masks.data() + 25850, 4}, 0x100010EF9FF},
+    {0x100000ED99F, 0x100010E2835, {kw_masks.data() + 25854, 4}, 0x100010EF9BF},
+    {0x100000ED99F, 0x100010E2835, {kw_masks.data() + 25858, 4}, 0x100010EF9BF},
+    {0x100000EDB9F, 0x100010E2835, {kw_masks.data() + 25862, 4}, 0x100010EFBBF},
+    {0x100000EDD9F, 0x100010E2835, {kw_masks.data() + 25866, 4}, 0x100010EFDBF},
+    {0x100000ED99F, 0x100010E2835, {kw_masks.data() + 25870, 4}, 0x100010EF9BF},
+    {0x100000ED99F, 0x100010E2835, {kw_masks.data() + 25874, 4}, 0x100010EF9BF},
+    {0x100000EF99F, 0x100010E2835, {kw_masks.data() + 25878, 4}, 0x100010EF9BF},
+    {0x100000ED99F, 0x100010E2835, {kw_masks.data() + 25882, 4}, 0x100010EF9BF},
+    {0x100000ED99F, 0x100010E2835, {kw_masks.data() + 25886, 4}, 0x100010EF9BF},
+    {0x100000FD99F, 0x100010E2835, {kw_masks.data() + 25890, 4}, 0x100010FF9BF},
+    {0x100000ED99F, 0x100010E2835, {kw_masks.data() + 25894, 4}, 0x100010EF9BF},
+    {0x100000ED99F, 0x100010E2835, {kw_masks.data() + 25898, 4}, 0x100010EF9BF},
+    {0x100000ED99F, 0x100010E2835, {kw_masks.data() + 25902, 4}, 0x100010EF9BF},
+    {0x100001ED99F, 0x100010E2835, {kw_masks.data() + 25906, 4}, 0x100011EF9BF},
+    {0x100002ED99F, 0x100010E2835, {kw_masks.data() + 25910, 4}, 0x100012EF9BF},
+    {0x100004ED99F, 0x100010E2835, {kw_masks.data() + 25914, 4}, 0x100014EF9BF},
+    {0x100008ED99F, 0x100010E2835, {kw_masks.data() + 25918, 4}, 0x100018EF9BF},
+    {0x100010ED99F, 0x100010E2835, {kw_masks.data() + 25922, 4}, 0x100010EF9BF},
+    {0x100020ED99F, 0x100010E2835, {kw_masks.data() + 25926, 4}, 0x100030EF9BF},
+    {0x100000ED99F, 0x100010E2835, {kw_masks.data() + 25930, 4}, 0x100010EF9BF},
+    {0x100000ED99F, 0x100010E2835, {kw_masks.data() + 25934, 4}, 0x100010EF9BF},
+    {0x100000ED99F, 0x100010E2835, {kw_masks.data() + 25938, 4}, 0x100010EF9BF},
+    {0x100000ED99F, 0x100010E2835, {kw_masks.data() + 25942, 4}, 0x100010EF9BF},
+    {0x100000ED99F, 0x100010E2835, {kw_masks.data() + 25946, 4}, 0x100010EF9BF},
+    {0x100000ED9BF, 0x100010E2835, {kw_masks.data() + 25950, 4}, 0x100010EF9BF},
+    {0x100000ED9DF, 0x100010E2835, {kw_masks.data() + 25954, 4}, 0x100010EF9FF},
+    {0x100000ED99F, 0x100010E2835, {kw_masks.data() + 25958, 4}, 0x100010EF9BF},
+    {0x100000ED99F, 0x100010E2835, {kw_masks.data() + 25962, 4}, 0x100010EF9BF},
+    {0x100000EDB9F, 0x100010E2835, {kw_masks.data() + 25966, 4}, 0x100010EFBBF},
+    {0x100000EDD9F, 0x100010E2835, {kw_masks.data() + 25970, 4}, 0x100010EFDBF},
+    {0x100000ED99F, 0x100010E2835, {kw_masks.data() + 25974, 4}, 0x100010EF9BF},
+    {0x100000ED99F, 0x100010E2835, {kw_masks.data() + 25978, 4}, 0x100010EF9BF},
+    {0x100000EF99F, 0x100010E2835, {kw_masks.data() + 25982, 4}, 0x100010EF9BF},
+    {0x100000ED99F, 0x100010E2835, {kw_masks.data() + 25986, 4}, 0x100010EF9BF},
+    {0x100000ED99F, 0x100010E2835, {kw_masks.data() + 25990, 4}, 0x100010EF9BF},
+    {0x100000FD99F, 0x100010E2835, {kw_masks.data() + 25994, 4}, 0x100010FF9BF},
+    {0x100000ED99F, 0x100010E2835, {kw_masks.data() + 25998, 4}, 0x100010EF9BF},
+    {0x100000ED99F, 0x100010E2835, {kw_masks.data() + 26002, 4}, 0x100010EF9BF},
+    {0x100000ED99F, 0x100010E2835, {kw_masks.data() + 26006, 4}, 0x100010EF9BF},
+    {0x100001ED99F, 0x100010E2835, {kw_masks.data() + 26010, 4}, 0x100011EF9BF},
+    {0x100002ED99F, 0x100010E2835, {kw_masks.data() + 26014, 4}, 0x100012EF9BF},
+    {0x100004ED99F, 0x100010E2835, {kw_masks.data() + 26018, 4}, 0x100014EF9BF},
+    {0x100008ED99F, 0x100010E2835, {kw_masks.data() + 26022, 4}, 0x100018EF9BF},
+    {0x100010ED99F, 0x100010E2835, {kw_masks.data() + 26026, 4}, 0x100010EF9BF},
+    {0x100020ED99F, 0x100010E2835, {kw_masks.data() + 26030, 4}, 0x100030EF9BF},
+    {0x100001A9DB5, 0x100010E2835, {kw_masks.data() + 26034, 3}, 0x100011EBDB5},
+    {0x100001A9DB7, 0x100010E2835, {kw_masks.data() + 26037, 3}, 0x100011EBDB7},
+    {0x100001A9DBD, 0x100010E2835, {kw_masks.data() + 26040, 3}, 0x100011EBDBD},
+    {0x100001A9DB5, 0x100010E2835, {kw_masks.data() + 26043, 3}, 0x100011EBDB5},
+    {0x100001A9DB5, 0x100010E2835, {kw_masks.data() + 26046, 3}, 0x100011EBDB5},
+    {0x100001A9DF5, 0x100010E2835, {kw_masks.data() + 26049, 3}, 0x100011EBDF5},
+    {0x100001A9FB5, 0x100010E2835, {kw_masks.data() + 26052, 3}, 0x100011EBFB5},
+    {0x100001A9DB5, 0x100010E2835, {kw_masks.data() + 26055, 3}, 0x100011EBDB5},
+    {0x100001A9DB5, 0x100010E2835, {kw_masks.data() + 26058, 3}, 0x100011EBDB5},
+    {0x100001A9DB5, 0x100010E2835, {kw_masks.data() + 26061, 7}, 0x10001DEFFB5},
+    {0x100001ABDB5, 0x100010E2835, {kw_masks.data() + 26068, 3}, 0x100011EBDB5},
+    {0x100001ADDB5, 0x100010E2835, {kw_masks.data() + 26071, 3}, 0x100011EFDB5},
+    {0x100001A9DB5, 0x100010E2835, {kw_masks.data() + 26074, 3}, 0x100011EBDB5},
+    {0x100001B9DB5, 0x100010E2835, {kw_masks.data() + 26077, 3}, 0x100011FBDB5},
+    {0x100001E9DB5, 0x100010E2835, {kw_masks.data() + 26080, 7}, 0x100011EFDFD},
+    {0x100001A9DB5, 0x100010E2835, {kw_masks.data() + 26087, 3}, 0x100011EBDB5},
+    {0x100001A9DB5, 0x100010E2835, {kw_masks.data() + 26090, 3}, 0x100011EBDB5},
+    {0x100003A9DB5, 0x100010E2835, {kw_masks.data() + 26093, 3}, 0x100013EBDB5},
+    {0x100005A9DB5, 0x100010E2835, {kw_masks.data() + 26096, 3}, 0x100015EBDB5},
+    {0x100009A9DB5, 0x100010E2835, {kw_masks.data() + 26099, 3}, 0x100019EBDB5},
+    {0x100011A9DB5, 0x100010E2835, {kw_masks.data() + 26102, 3}, 0x100011EBDB5},
+    {0x100001E1DB5, 0x100010E2835, {kw_masks.data() + 26105, 3}, 0x100011E3DB5},
+    {0x100001E1DB7, 0x100010E2835, {kw_masks.data() + 26108, 3}, 0x100011E3DB7},
+    {0x100001E1DB5, 0x100010E2835, {kw_masks.data() + 26111, 3}, 0x100011E3DB5},
+    {0x100001E1DBD, 0x100010E2835, {kw_masks.data() + 26114, 3}, 0x100011E3DBD},
+    {0x100001E1DB5, 0x100010E2835, {kw_masks.data() + 26117, 3}, 0x100011E3DB5},
+    {0x100001E1DB5, 0x100010E2835, {kw_masks.data() + 26120, 3}, 0x100011E3DB5},
+    {0x100001E1DF5, 0x100010E2835, {kw_masks.data() + 26123, 3}, 0x100011E3DF5},
+    {0x100001E1DB5, 0x100010E2835, {kw_masks.data() + 26126, 3}, 0x100011E3DB5},
+    {0x100001E1DB5, 0x100010E2835, {kw_masks.data() + 26129, 3}, 0x100011E3DB5},
+    {0x100001E1FB5, 0x100010E2835, {kw_masks.data() + 26132, 3}, 0x100011E3FB5},
+    {0x100001E1DB5, 0x100010E2835, {kw_masks.data() + 26135, 3}, 0x100011E3DB5},
+    {0x100001E1DB5, 0x100010E2835, {kw_masks.data() + 26138, 3}, 0x100011E3DB5},
+    {0x100001E1DB5, 0x100010E2835, {kw_masks.data() + 26141, 3}, 0x100011E3DB5},
+    {0x100001E3DB5, 0x100010E2835, {kw_masks.data() + 26144, 3}, 0x100011E3DB5},
+    {0x100001E5DB5, 0x100010E2835, {kw_masks.data() + 26147, 3}, 0x100011E7DB5},
+    {0x100001E9DB5, 0x100010E2835, {kw_masks.data() + 26150, 3}, 0x100011EBDB5},
+    {0x100001F1DB5, 0x100010E2835, {kw_masks.data() + 26153, 3}, 0x100011F3DB5},
+    {0x100001E1DB5, 0x100010E2835, {kw_masks.data() + 26156, 3}, 0x100011E3DB5},
+    {0x100001E1DB5, 0x100010E2835, {kw_masks.data() + 26159, 3}, 0x100011E3DB5},
+    {0x100001E1DB5, 0x100010E2835, {kw_masks.data() + 26162, 3}, 0x100011E3DB5},
+    {0x100001E1DB5, 0x100010E2835, {kw_masks.data() + 26165, 3}, 0x100011E3DB5},
+    {0x100003E1DB5, 0x100010E2835, {kw_masks.data() + 26168, 3}, 0x100013E3DB5},
+    {0x100005E1DB5, 0x100010E2835, {kw_masks.data() + 26171, 3}, 0x100015E3DB5},
+    {0x100009E1DB5, 0x100010E2835, {kw_masks.data() + 26174, 3}, 0x100019E3DB5},
+    {0x100011E1DB5, 0x100010E2835, {kw_masks.data() + 26177, 3}, 0x100011E3DB5},
+    {0x100021E1DB5, 0x100010E2835, {kw_masks.data() + 26180, 3}, 0x100031E3DB5},
+    {0x200100001EDD9F, 0x100010E2835, {kw_masks.data() + 26183, 4}, 0x200100011EFDBF},
+    {0x200100001EDD9F, 0x100010E2835, {kw_masks.data() + 26187, 4}, 0x200100011EFDBF},
+    {0x200100001EDD9F, 0x100010E2835, {kw_masks.data() + 26191, 4}, 0x200100011EFDBF},
+    {0x200100001EDD9F, 0x100010E2835, {kw_masks.data() + 26195, 4}, 0x200100011EFDBF},
+    {0x200100001EDDBF, 0x100010E2835, {kw_masks.data() + 26199, 4}, 0x200100011EFDBF},
+    {0x200100001EDDDF, 0x100010E2835, {kw_masks.data() + 26203, 4}, 0x200100011EFDFF},
+    {0x200100001EDD9F, 0x100010E2835, {kw_masks.data() + 26207, 4}, 0x200100011EFDBF},
+    {0x200100001EDF9F, 0x100010E2835, {kw_masks.data() + 26211, 4}, 0x200100011EFFBF},
+    {0x200100001EDD9F, 0x100010E2835, {kw_masks.data() + 26215, 4}, 0x200100011EFDBF},
+    {0x200100001EDD9F, 0x100010E2835, {kw_masks.data() + 26219, 4}, 0x200100011EFDBF},
+    {0x200100001EDD9F, 0x100010E2835, {kw_masks.data() + 26223, 4}, 0x200100011EFDBF},
+    {0x200100001EDD9F, 0x100010E2835, {kw_masks.data() + 26227, 4}, 0x200100011EFDBF},
+    {0x200100001EDD9F, 0x100010E2835, {kw_masks.data() + 26231, 4}, 0x200100011EFDBF},
+    {0x200100001EDD9F, 0x100010E2835, {kw_masks.data() + 26235, 4}, 0x200100011EFDBF},
+    {0x200100001EDD9F, 0x100010E2835, {kw_masks.data() + 26239, 4}, 0x200100011EFDBF},
+    {0x200100003EDD9F, 0x100010E2835, {kw_masks.data() + 26243, 4}, 0x200100013EFDBF},
+    {0x200100005EDD9F, 0x100010E2835, {kw_masks.data() + 26247, 4}, 0x200100015EFDBF},
+    {0x200100009EDD9F, 0x100010E2835, {kw_masks.data() + 26251, 4}, 0x200100019EFDBF},
+    {0x200100011EDD9F, 0x100010E2835, {kw_masks.data() + 26255, 4}, 0x200100011EFDBF},
+    {0x200100001E5D9F, 0x100010E2835, {kw_masks.data() + 26259, 4}, 0x200100011E7DBF},
+    {0x200100001E5D9F, 0x100010E2835, {kw_masks.data() + 26263, 4}, 0x200100011E7DBF},
+    {0x200100001E5D9F, 0x100010E2835, {kw_masks.data() + 26267, 4}, 0x200100011E7DBF},
+    {0x200100001E5D9F, 0x100010E2835, {kw_masks.data() + 26271, 4}, 0x200100011E7DBF},
+    {0x200100001E5D9F, 0x100010E2835, {kw_masks.data() + 26275, 4}, 0x200100011E7DBF},
+    {0x200100001E5DBF, 0x100010E2835, {kw_masks.data() + 26279, 4}, 0x200100011E7DBF},
+    {0x200100001E5DDF, 0x100010E2835, {kw_masks.data() + 26283, 4}, 0x200100011E7DFF},
+    {0x200100001E5D9F, 0x100010E2835, {kw_masks.data() + 26287, 4}, 0x200100011E7DBF},
+    {0x200100001E5D9F, 0x100010E2835, {kw_masks.data() + 26291, 4}, 0x200100011E7DBF},
+    {0x200100001E5F9F, 0x100010E2835, {kw_masks.data() + 26295, 4}, 0x200100011E7FBF},
+    {0x200100001E5D9F, 0x100010E2835, {kw_masks.data() + 26299, 4}, 0x200100011E7DBF},
+    {0x200100001E5D9F, 0x100010E2835, {kw_masks.data() + 26303, 4}, 0x200100011E7DBF},
+    {0x200100001E5D9F, 0x100010E2835, {kw_masks.data() + 26307, 4}, 0x200100011E7DBF},
+    {0x200100001E7D9F, 0x100010E2835, {kw_masks.data() + 26311, 4}, 0x200100011E7DBF},
+    {0x200100001E5D9F, 0x100010E2835, {kw_masks.data() + 26315, 4}, 0x200100011E7DBF},
+    {0x200100001EDD9F, 0x100010E2835, {kw_masks.data() + 26319, 4}, 0x200100011EFDBF},
+    {0x200100001F5D9F, 0x100010E2835, {kw_masks.data() + 26323, 4}, 0x200100011F7DBF},
+    {0x200100001E5D9F, 0x100010E2835, {kw_masks.data() + 26327, 4}, 0x200100011E7DBF},
+    {0x200100001E5D9F, 0x100010E2835, {kw_masks.data() + 26331, 4}, 0x200100011E7DBF},
+    {0x200100001E5D9F, 0x100010E2835, {kw_masks.data() + 26335, 4}, 0x200100011E7DBF},
+    {0x200100001E5D9F, 0x100010E2835, {kw_masks.data() + 26339, 4}, 0x200100011E7DBF},
+    {0x200100003E5D9F, 0x100010E2835, {kw_masks.data() + 26343, 4}, 0x200100013E7DBF},
+    {0x200100005E5D9F, 0x100010E2835, {kw_masks.data() + 26347, 4}, 0x200100015E7DBF},
+    {0x200100009E5D9F, 0x100010E2835, {kw_masks.data() + 26351, 4}, 0x200100019E7DBF},
+    {0x200100011E5D9F, 0x100010E2835, {kw_masks.data() + 26355, 4}, 0x200100011E7DBF},
+    {0x200100021E5D9F, 0x100010E2835, {kw_masks.data() + 26359, 4}, 0x200100031E7DBF},
+    {0x100001ADDBF, 0x100010E2835, {kw_masks.data() + 26363, 4}, 0x100011EFDBF},
+    {0x100001ADDBF, 0x100010E2835, {kw_masks.data() + 26367, 4}, 0x100011EFDBF},
+    {0x100001ADDBF, 0x100010E2835, {kw_masks.data() + 26371, 4}, 0x100011EFDBF},
+    {0x100001ADDBF, 0x100010E2835, {kw_masks.data() + 26375, 4}, 0x100011EFDBF},
+    {0x100001ADDBF, 0x100010E2835, {kw_masks.data() + 26379, 4}, 0x100011EFDBF},
+    {0x100001ADDBF, 0x100010E2835, {kw_masks.data() + 26383, 4}, 0x100011EFDBF},
+    {0x100001ADDFF, 0x100010E2835, {kw_masks.data() + 26387, 4}, 0x100011EFDFF},
+    {0x100001ADDBF, 0x100010E2835, {kw_masks.data() + 26391, 4}, 0x100011EFDBF},
+    {0x100001ADDBF, 0x100010E2835, {kw_masks.data() + 26395, 4}, 0x100011EFDBF},
+    {0x100001ADFBF, 0x100010E2835, {kw_masks.data() + 26399, 4}, 0x100011EFFBF},
+    {0x100001ADDBF, 0x100010E2835, {kw_masks.data() + 26403, 4}, 0x100011EFDBF},
+    {0x100001ADDBF, 0x100010E2835, {kw_masks.data() + 26407, 4}, 0x100011EFDBF},
+    {0x100001ADDBF, 0x100010E2835, {kw_masks.data() + 26411, 4}, 0x100011EFDBF},
+    {0x100001AFDBF, 0x100010E2835, {kw_masks.data() + 26415, 4}, 0x100011EFDBF},
+    {0x100001ADDBF, 0x100010E2835, {kw_masks.data() + 26419, 4}, 0x100011EFDBF},
+    {0x100001ADDBF, 0x100010E2835, {kw_masks.data() + 26423, 4}, 0x100011EFDBF},
+    {0x100001BDDBF, 0x100010E2835, {kw_masks.data() + 26427, 4}, 0x100011FFDBF},
+    {0x100001ADDBF, 0x100010E2835, {kw_masks.data() + 26431, 4}, 0x100011EFDBF},
+    {0x100001EDDBF, 0x100010E2835, {kw_masks.data() + 26435, 4}, 0x100011EFDBF},
+    {0x100001ADDBF, 0x100010E2835, {kw_masks.data() + 26439, 4}, 0x100011EFDBF},
+    {0x100001ADDBF, 0x100010E2835, {kw_masks.data() + 26443, 4}, 0x100011EFDBF},
+    {0x100003ADDBF, 0x100010E2835, {kw_masks.data() + 26447, 4}, 0x100013EFDBF},
+    {0x100005ADDBF, 0x100010E2835, {kw_masks.data() + 26451, 4}, 0x100015EFDBF},
+    {0x100009ADDBF, 0x100010E2835, {kw_masks.data() + 26455, 4}, 0x100019EFDBF},
+    {0x100011ADDBF, 0x100010E2835, {kw_masks.data() + 26459, 4}, 0x100011EFDBF},
+    {0x100021ADDBF, 0x100010E2835, {kw_masks.data() + 26463, 4}, 0x100031EFDBF},
+    {0x100001E5DBF, 0x100010E2835, {kw_masks.data() + 26467, 4}, 0x100011E7DBF},
+    {0x100001E5DBF, 0x100010E2835, {kw_masks.data() + 26471, 4}, 0x100011E7DBF},
+    {0x100001E5DBF, 0x100010E2835, {kw_masks.data() + 26475, 4}, 0x100011E7DBF},
+    {0x100001E5DBF, 0x100010E2835, {kw_masks.data() + 26479, 4}, 0x100011E7DBF},
+    {0x100001E5DBF, 0x100010E2835, {kw_masks.data() + 26483, 4}, 0x100011E7DBF},
+    {0x100001E5DBF, 0x100010E2835, {kw_masks.data() + 26487, 4}, 0x100011E7DBF},
+    {0x100001E5DFF, 0x100010E2835, {kw_masks.data() + 26491, 4}, 0x100011E7DFF},
+    {0x100001E5DBF, 0x100010E2835, {kw_masks.data() + 26495, 4}, 0x100011E7DBF},
+    {0x100001E5DBF, 0x100010E2835, {kw_masks.data() + 26499, 4}, 0x100011E7DBF},
+    {0x100001E5FBF, 0x100010E2835, {kw_masks.data() + 26503, 4}, 0x100011E7FBF},
+    {0x100001E5DBF, 0x100010E2835, {kw_masks.data() + 26507, 4}, 0x100011E7DBF},
+    {0x100001E5DBF, 0x100010E2835, {kw_masks.data() + 26511, 4}, 0x100011E7DBF},
+    {0x100001E5DBF, 0x100010E2835, {kw_masks.data() + 26515, 4}, 0x100011E7DBF},
+    {0x100001E7DBF, 0x100010E2835, {kw_masks.data() + 26519, 4}, 0x100011E7DBF},
+    {0x100001E5DBF, 0x100010E2835, {kw_masks.data() + 26523, 4}, 0x100011E7DBF},
+    {0x100001EDDBF, 0x100010E2835, {kw_masks.data() + 26527, 4}, 0x100011EFDBF},
+    {0x100001F5DBF, 0x100010E2835, {kw_masks.data() + 26531, 4}, 0x100011F7DBF},
+    {0x100001E5DBF, 0x100010E2835, {kw_masks.data() + 26535, 4}, 0x100011E7DBF},
+    {0x100001E5DBF, 0x100010E2835, {kw_masks.data() + 26539, 4}, 0x100011E7DBF},
+    {0x100001E5DBF, 0x100010E2835, {kw_masks.data() + 26543, 4}, 0x100011E7DBF},
+    {0x100001E5DBF, 0x100010E2835, {kw_masks.data() + 26547, 4}, 0x100011E7DBF},
+    {0x100003E5DBF, 0x100010E2835, {kw_masks.data() + 26551, 4}, 0x100013E7DBF},
+    {0x100005E5DBF, 0x100010E2835, {kw_masks.data() + 26555, 4}, 0x100015E7DBF},
+    {0x100009E5DBF, 0x100010E2835, {kw_masks.data() + 26559, 4}, 0x100019E7DBF},
+    {0x100011E5DBF, 0x100010E2835, {kw_masks.data() + 26563, 4}, 0x100011E7DBF},
+    {0x100021E5DBF, 0x100010E2835, {kw_masks.data() + 26567, 4}, 0x100031E7DBF},
+    {0x200100021E5DDF, 0x100010E2835, {kw_masks.data() + 26571, 5}, 0x200100031E7DFF},
+    {0x200100001E7DDF, 0x100010E2835, {kw_masks.data() + 26576, 5}, 0x200100011E7DFF},
+    {0x200100005E5DDF, 0x100010E2835, {kw_masks.data() + 26581, 5}, 0x200100015E7DFF},
+    {0x200100001E5DDF, 0x100010E2835, {kw_masks.data() + 26586, 5}, 0x200100011E7DFF},
+    {0x200100001E5DFF, 0x100010E2835, {kw_masks.data() + 26591, 5}, 0x200100011E7DFF},
+    {0x200100003E5DFF, 0x100010E2835, {kw_masks.data() + 26596, 5}, 0x200100013E7DFF},
+    {0x200100009E5DDF, 0x100010E2835, {kw_masks.data() + 26601, 5}, 0x200100019E7DFF},
+    {0x200100003E7DDF, 0x100010E2835, {kw_masks.data() + 26606, 5}, 0x200100013E7DFF},
+    {0x200100001E5DDF, 0x100010E2835, {kw_masks.data() + 26611, 5}, 0x200100011E7DFF},
+    {0x200100001E7DDF, 0x100010E2835, {kw_masks.data() + 26616, 5}, 0x200100011E7DFF},
+}};
+
+} // namespace
+
+const SearchMasks &glyph::searchMasks(const Item &item) { return g_masks[&item - items().data()]; }
@@ -0,0 +1,34 @@
+#include <catch2/catch_test_macros.hpp>
+#include "glyph/glyph.hpp"
+#include "glyph/search.hpp"
+
+TEST_CASE("generated search masks match the masks of the item texts") {
+  for (const auto &item : glyph::items()) {
+    const auto &masks = glyph::searchMasks(item);
+
+    REQUIRE(masks.name == glyph::textMask(item.name));
+    REQUIRE(masks.category == glyph::textMask(glyph::categoryLabel(item.category)));
+    REQUIRE(masks.keywords.size() == item.keywords.size());
+
+    glyph::CharMask all = masks.name | masks.category;
+    for (size_t i = 0; i != item.keywords.size(); ++i) {
+      REQUIRE(masks.keywords[i] == glyph::textMask(item.keywords[i]));
+      all |= masks.keywords[i];
+    }
+    REQUIRE(masks.all == all);
+  }
+}
+
+TEST_CASE("text masks cover the masks of their subsequences") {
+  using glyph::covers;
+  using glyph::patternMask;
+  using glyph::textMask;
+
+  REQUIRE(covers(textMask("Grinning Face"), patternMask("gf")));
+  REQUIRE(covers(textMask("keycap: 10"), patternMask("KEY10")));
+  REQUIRE_FALSE(covers(textMask("grinning face"), patternMask("heart")));
+
+  // folded before matching, so never ruled out
+  REQUIRE(covers(textMask("piñata"), patternMask("pinata")));
+  REQUIRE(covers(textMask("cat"), patternMask("café")));
+}
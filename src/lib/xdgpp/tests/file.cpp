@@ -1,5 +1,7 @@
 #include <xdgpp/xdgpp.hpp>
 #include <catch2/catch_test_macros.hpp>
+#include <fstream>
+#include <iterator>
 
 constexpr const char *GROUP = XDGPP_GROUP;
 
@@ -45,3 +47,18 @@ TEST_CASE("fromId should return valid desktop file if found", GROUP) {
     REQUIRE(file.has_value());
   }
 }
+
+TEST_CASE("desktop file from data should match the one read from disk", GROUP) {
+  auto const path = FIXTURES / "firefox-bin.desktop";
+  auto const fromFile = xdgpp::DesktopFile::fromFile(path, FIXTURES);
+  std::ifstream ifs(path);
+  std::string const data{std::istreambuf_iterator<char>(ifs), {}};
+  auto const fromData = xdgpp::DesktopFile::fromData(data, path, FIXTURES);
+
+  REQUIRE(fromData.isValid());
+  REQUIRE(fromData.id() == fromFile.id());
+  REQUIRE(fromData.path() == fromFile.path());
+  REQUIRE(fromData.name() == fromFile.name());
+  REQUIRE(fromData.exec() == fromFile.exec());
+  REQUIRE(fromData.actions().size() == fromFile.actions().size());
+}
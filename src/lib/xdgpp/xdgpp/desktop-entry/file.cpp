@@ -16,6 +16,14 @@ DesktopFile DesktopFile::fromFile(const std::filesystem::path &file,
   return DesktopFile(id, file, DesktopEntry::fromFile(file));
 }
 
+DesktopFile DesktopFile::fromData(std::string_view data, const std::filesystem::path &file,
+                                  const std::optional<std::filesystem::path> &appDir,
+                                  const ParseOptions &opts) {
+  auto id = appDir ? DesktopFile::relativeId(file, appDir.value()) : file.filename().string();
+
+  return DesktopFile(id, file, DesktopEntry::fromData(data, opts));
+}
+
 std::string DesktopFile::relativeId(const std::filesystem::path &file, const std::filesystem::path &appDir) {
   std::string id = file.lexically_relative(appDir);
   auto normalize = [](char c) { return c == '/' ? '.' : c; };
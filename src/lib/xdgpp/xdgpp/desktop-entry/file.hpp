@@ -13,6 +13,13 @@ public:
   static DesktopFile fromFile(const std::filesystem::path &file,
                               const std::optional<std::filesystem::path> &appDir);
 
+  /**
+   * Same as `fromFile`, for contents that were read from `file` already.
+   */
+  static DesktopFile fromData(std::string_view data, const std::filesystem::path &file,
+                              const std::optional<std::filesystem::path> &appDir,
+                              const ParseOptions &opts = {});
+
   /**
    * Look for the desktop entry with that ID.
    * .desktop suffix is optional
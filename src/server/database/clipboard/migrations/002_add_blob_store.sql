@@ -0,0 +1,21 @@
+-- Offer data is stored once per distinct content, in a file named after its hash, and shared by all the
+-- offers of all the selections that hold the same bytes (text/plain, UTF8_STRING and TEXT aliases of the
+-- same text, the same screenshot copied twice...).
+CREATE TABLE IF NOT EXISTS blob (
+	hash TEXT PRIMARY KEY, -- keyed with the clipboard encryption key for encrypted blobs
+	encryption_type INT NOT NULL,
+	size INTEGER NOT NULL,
+	ref_count INTEGER NOT NULL DEFAULT 0 -- maintained by the triggers below
+);
+
+-- NULL for offers stored before blobs existed, their data is in a file named after the offer id
+ALTER TABLE data_offer ADD COLUMN blob_hash TEXT REFERENCES blob(hash);
+
+CREATE INDEX IF NOT EXISTS idx_blob_orphan
+ON blob(ref_count) WHERE ref_count = 0;
+
+CREATE TRIGGER data_offer_blob_ai AFTER INSERT ON data_offer WHEN new.blob_hash IS NOT NULL BEGIN
+  UPDATE blob SET ref_count = ref_count + 1 WHERE hash = new.blob_hash; END;
+
+CREATE TRIGGER data_offer_blob_ad AFTER DELETE ON data_offer WHEN old.blob_hash IS NOT NULL BEGIN
+  UPDATE blob SET ref_count = ref_count - 1 WHERE hash = old.blob_hash; END;
@@ -0,0 +1,22 @@
+-- Small renditions of a selection for the history to show without reading its data: a normalized
+-- excerpt of text, and thumbnails of images at two pixel densities. They are stored as blobs, like the
+-- offer data, and go away with their selection.
+CREATE TABLE IF NOT EXISTS selection_preview (
+	selection_id TEXT NOT NULL,
+	kind INT NOT NULL,
+	blob_hash TEXT NOT NULL REFERENCES blob(hash),
+	mime_type TEXT NOT NULL,
+	PRIMARY KEY (selection_id, kind),
+	FOREIGN KEY(selection_id)
+	REFERENCES selection(id)
+	ON DELETE CASCADE
+);
+
+-- version of the preview generation that last ran on the selection, 0 if it never did
+ALTER TABLE selection ADD COLUMN preview_version INTEGER NOT NULL DEFAULT 0;
+
+CREATE TRIGGER selection_preview_blob_ai AFTER INSERT ON selection_preview BEGIN
+  UPDATE blob SET ref_count = ref_count + 1 WHERE hash = new.blob_hash; END;
+
+CREATE TRIGGER selection_preview_blob_ad AFTER DELETE ON selection_preview BEGIN
+  UPDATE blob SET ref_count = ref_count - 1 WHERE hash = old.blob_hash; END;
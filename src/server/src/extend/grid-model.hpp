@@ -5,6 +5,7 @@
 #include "extend/image-model.hpp"
 #include "extend/pagination-model.hpp"
 #include "extend/dropdown-model.hpp"
+#include "extend/render-patch.hpp"
 #include "ui/image/url.hpp"
 #include "services/clipboard/clipboard-content.hpp"
 
@@ -28,6 +29,8 @@ constexpr double insetRatio(GridInset inset) {
 struct GridItemViewModel {
   using Content = std::variant<ImageLikeModel, ColorLike>;
 
+  // given by the reconciler, see `RenderPatch`
+  uint64_t key = 0;
   std::string id;
   std::string title;
   std::string subtitle;
@@ -39,6 +42,7 @@ struct GridItemViewModel {
 };
 
 struct GridSectionModel {
+  uint64_t key = 0;
   std::string title;
   std::string subtitle;
 
@@ -76,3 +80,5 @@ struct GridModel {
   std::optional<PaginationModel> pagination;
   std::optional<GridSearchBarAccessory> searchBarAccessory;
 };
+
+using GridPatch = RenderPatch<GridModel, GridChild>;
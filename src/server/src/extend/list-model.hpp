@@ -7,10 +7,13 @@
 #include "extend/image-model.hpp"
 #include "extend/dropdown-model.hpp"
 #include "extend/pagination-model.hpp"
+#include "extend/render-patch.hpp"
 #include "services/clipboard/clipboard-content.hpp"
 
 struct ListItemViewModel {
   bool changed = false;
+  // given by the reconciler, see `RenderPatch`
+  uint64_t key = 0;
   std::string id;
   std::string title;
   std::string subtitle;
@@ -23,6 +26,7 @@ struct ListItemViewModel {
 };
 
 struct ListSectionModel {
+  uint64_t key = 0;
   std::string title;
   std::string subtitle;
   std::vector<ListItemViewModel> children;
@@ -49,3 +53,5 @@ struct ListModel {
   std::optional<PaginationModel> pagination;
   std::optional<ListSearchBarAccessory> searchBarAccessory;
 };
+
+using ListPatch = RenderPatch<ListModel, ListChild>;
@@ -304,6 +304,7 @@ struct ClipboardContentWire {
 };
 
 struct ListItemViewModelWire {
+  uint64_t key = 0;
   std::string id;
   FlexString title;
   FlexString subtitle;
@@ -315,6 +316,7 @@ struct ListItemViewModelWire {
 };
 
 struct ListSectionModelWire {
+  uint64_t key = 0;
   std::string title;
   std::string subtitle;
   std::vector<ListItemViewModelWire> children;
@@ -358,6 +360,7 @@ struct ListModelWire {
 };
 
 struct GridItemViewModelWire {
+  uint64_t key = 0;
   std::string id;
   std::string title;
   std::string subtitle;
@@ -369,6 +372,7 @@ struct GridItemViewModelWire {
 };
 
 struct GridSectionModelWire {
+  uint64_t key = 0;
   std::string title;
   std::string subtitle;
   std::optional<double> aspectRatio;
@@ -795,9 +799,13 @@ static std::optional<Clipboard::Content> toClipboardContent(std::optional<Clipbo
   return std::nullopt;
 }
 
+// Items without an id go by their key, which unlike their position survives incremental renders.
+static std::string fallbackId(uint64_t key, size_t index) { return std::to_string(key ? key : index); }
+
 static ListItemViewModel toListItemViewModel(ListItemViewModelWire w) {
   ListItemViewModel m;
   m.changed = true;
+  m.key = w.key;
   m.id = std::move(w.id);
   m.title = takeString(std::move(w.title));
   m.subtitle = takeString(std::move(w.subtitle));
@@ -817,12 +825,13 @@ static ListItemViewModel toListItemViewModel(ListItemViewModelWire w) {
 
 static ListSectionModel toListSectionModel(ListSectionModelWire w) {
   ListSectionModel m;
+  m.key = w.key;
   m.title = std::move(w.title);
   m.subtitle = std::move(w.subtitle);
   m.children.reserve(w.children.size());
   for (size_t i = 0; i < w.children.size(); ++i) {
     auto item = toListItemViewModel(std::move(w.children[i]));
-    if (item.id.empty()) item.id = std::to_string(i);
+    if (item.id.empty()) item.id = fallbackId(item.key, i);
     m.children.emplace_back(std::move(item));
   }
   return m;
@@ -852,7 +861,7 @@ static ListModel toListModel(ListModelWire &w) {
         child,
         [&](ListItemViewModelWire &c) {
           auto item = toListItemViewModel(std::move(c));
-          if (item.id.empty()) item.id = std::to_string(index);
+          if (item.id.empty()) item.id = fallbackId(item.key, index);
           m.items.emplace_back(std::move(item));
         },
         [&](ListSectionModelWire &c) { m.items.emplace_back(toListSectionModel(std::move(c))); },
@@ -867,6 +876,7 @@ static ListModel toListModel(ListModelWire &w) {
 
 static GridItemViewModel toGridItemViewModel(GridItemViewModelWire w) {
   GridItemViewModel m;
+  m.key = w.key;
   m.id = std::move(w.id);
   m.title = std::move(w.title);
   m.subtitle = std::move(w.subtitle);
@@ -883,6 +893,7 @@ static GridItemViewModel toGridItemViewModel(GridItemViewModelWire w) {
 
 static GridSectionModel toGridSectionModel(GridSectionModelWire w) {
   GridSectionModel m;
+  m.key = w.key;
   m.title = std::move(w.title);
   m.subtitle = std::move(w.subtitle);
   m.aspectRatio = w.aspectRatio;
@@ -892,7 +903,7 @@ static GridSectionModel toGridSectionModel(GridSectionModelWire w) {
   m.children.reserve(w.children.size());
   for (size_t i = 0; i < w.children.size(); ++i) {
     auto item = toGridItemViewModel(std::move(w.children[i]));
-    if (item.id.empty()) item.id = std::to_string(i);
+    if (item.id.empty()) item.id = fallbackId(item.key, i);
     m.children.emplace_back(std::move(item));
   }
   return m;
@@ -926,7 +937,7 @@ static GridModel toGridModel(GridModelWire &w) {
         child,
         [&](GridItemViewModelWire &c) {
           auto item = toGridItemViewModel(std::move(c));
-          if (item.id.empty()) item.id = std::to_string(index);
+          if (item.id.empty()) item.id = fallbackId(item.key, index);
           m.items.emplace_back(std::move(item));
         },
         [&](GridSectionModelWire &c) { m.items.emplace_back(toGridSectionModel(std::move(c))); },
@@ -1181,9 +1192,81 @@ template <> struct glz::meta<RootWireModel> {
   static constexpr auto ids = std::array{"list", "grid", "detail", "form"};
 };
 
+template <> struct glz::meta<PatchOpKind> {
+  using enum PatchOpKind;
+  static constexpr auto value =
+      glz::enumerate("insert", Insert, "update", Update, "remove", Remove, "move", Move);
+};
+
+template <typename WireChild> struct PatchOpWire {
+  PatchOpKind op = PatchOpKind::Update;
+  uint64_t key = 0;
+  uint64_t parent = 0;
+  uint64_t after = 0;
+  std::optional<WireChild> node;
+};
+
+// `root` holds the props of the list or grid and its children other than items and sections
+struct ListPatchWire {
+  ListModelWire root;
+  std::vector<PatchOpWire<ListWireChild>> ops;
+};
+
+struct GridPatchWire {
+  GridModelWire root;
+  std::vector<PatchOpWire<GridWireChild>> ops;
+};
+
+using PatchWireModel = std::variant<ListPatchWire, GridPatchWire>;
+
+template <> struct glz::meta<PatchWireModel> {
+  static constexpr std::string_view tag = TAG;
+  static constexpr auto ids = std::array{"list", "grid"};
+};
+
+static std::optional<ListChild> toListChild(ListWireChild &w) {
+  std::optional<ListChild> child;
+  match(
+      w,
+      [&](ListItemViewModelWire &c) {
+        auto item = toListItemViewModel(std::move(c));
+        if (item.id.empty()) item.id = fallbackId(item.key, 0);
+        child = std::move(item);
+      },
+      [&](ListSectionModelWire &c) { child = toListSectionModel(std::move(c)); }, [](auto &) {});
+  return child;
+}
+
+static std::optional<GridChild> toGridChild(GridWireChild &w) {
+  std::optional<GridChild> child;
+  match(
+      w,
+      [&](GridItemViewModelWire &c) {
+        auto item = toGridItemViewModel(std::move(c));
+        if (item.id.empty()) item.id = fallbackId(item.key, 0);
+        child = std::move(item);
+      },
+      [&](GridSectionModelWire &c) { child = toGridSectionModel(std::move(c)); }, [](auto &) {});
+  return child;
+}
+
+template <typename Child, typename WireChild, typename Convert>
+static std::vector<PatchOp<Child>> toPatchOps(std::vector<PatchOpWire<WireChild>> &wire, Convert convert) {
+  std::vector<PatchOp<Child>> ops;
+  ops.reserve(wire.size());
+  for (auto &w : wire) {
+    PatchOp<Child> op{.kind = w.op, .key = w.key, .parent = w.parent, .after = w.after};
+    if (w.node) op.node = convert(*w.node);
+    ops.emplace_back(std::move(op));
+  }
+  return ops;
+}
+
+// A view carries either its whole `root`, or a `patch` against the root it was last rendered with.
 struct ViewEntry {
   bool dirty = true;
   std::optional<RootWireModel> root;
+  std::optional<PatchWireModel> patch;
 };
 
 struct RenderPayload {
@@ -1210,6 +1293,23 @@ ParsedRenderData parseRenderPayload(std::string_view json) {
     RenderRoot rr;
     rr.dirty = view.dirty;
 
+    if (view.patch) {
+      match(
+          *view.patch,
+          [&](ListPatchWire &w) {
+            ListPatch patch{.root = toListModel(w.root), .ops = toPatchOps<ListChild>(w.ops, toListChild)};
+            patch.root.dirty = view.dirty;
+            rr.root = std::move(patch);
+          },
+          [&](GridPatchWire &w) {
+            GridPatch patch{.root = toGridModel(w.root), .ops = toPatchOps<GridChild>(w.ops, toGridChild)};
+            patch.root.dirty = view.dirty;
+            rr.root = std::move(patch);
+          });
+      result.items.emplace_back(std::move(rr));
+      continue;
+    }
+
     if (!view.root.has_value()) {
       rr.root = InvalidModel{QString("Empty view root")};
       result.items.emplace_back(std::move(rr));
@@ -11,7 +11,8 @@ struct InvalidModel {
   QString error;
 };
 
-using RenderModel = std::variant<ListModel, GridModel, FormModel, RootDetailModel, InvalidModel>;
+using RenderModel =
+    std::variant<ListModel, GridModel, FormModel, RootDetailModel, InvalidModel, ListPatch, GridPatch>;
 
 struct RenderRoot {
   bool dirty;
@@ -0,0 +1,291 @@
+#pragma once
+#include <QDebug>
+#include <algorithm>
+#include <cstdint>
+#include <optional>
+#include <unordered_map>
+#include <unordered_set>
+#include <variant>
+#include <vector>
+
+enum class PatchOpKind { Insert, Update, Remove, Move };
+
+/**
+ * One step of an incremental render. Items and sections are addressed by the key the reconciler gives
+ * them, which stays the same for as long as they are mounted. The steps of a parent come in the order
+ * of its new children, so that the sibling an item goes after is always in place already.
+ */
+template <typename Child> struct PatchOp {
+  PatchOpKind kind = PatchOpKind::Update;
+  uint64_t key = 0;
+  // section holding the item, 0 for the root
+  uint64_t parent = 0;
+  // sibling the item goes after, 0 to go first
+  uint64_t after = 0;
+  // the new item or section, sections are sent without their items on update
+  std::optional<Child> node;
+};
+
+// The props of a list or grid root along with the steps turning its current items into the new ones.
+template <typename Model, typename Child> struct RenderPatch {
+  // `items` is always empty
+  Model root;
+  std::vector<PatchOp<Child>> ops;
+};
+
+namespace render_patch {
+
+namespace detail {
+
+template <typename T> uint64_t keyOf(const T &value) { return value.key; }
+
+template <typename... Ts> uint64_t keyOf(const std::variant<Ts...> &value) {
+  return std::visit([](const auto &v) { return v.key; }, value);
+}
+
+// Children by key, linked in their current order, so that placing one after another is constant time.
+template <typename T> class KeyedList {
+public:
+  explicit KeyedList(std::vector<T> &children) {
+    m_links.reserve(children.size());
+    for (auto &child : children) {
+      link(keyOf(child), std::move(child), m_tail);
+    }
+    children.clear();
+  }
+
+  T *find(uint64_t key) {
+    auto it = m_links.find(key);
+    return it == m_links.end() ? nullptr : &it->second.value;
+  }
+
+  bool contains(uint64_t key) const { return m_links.contains(key); }
+
+  void insert(uint64_t key, T value, uint64_t after) {
+    if (m_links.contains(key)) unlink(key);
+    link(key, std::move(value), after);
+  }
+
+  void move(uint64_t key, uint64_t after) {
+    auto node = m_links.extract(key);
+    relink(node.key(), node.mapped().prev, node.mapped().next);
+    link(key, std::move(node.mapped().value), after);
+  }
+
+  void takeInto(std::vector<T> &out) {
+    out.reserve(m_links.size());
+    for (uint64_t key = m_head; key != 0;) {
+      auto &entry = m_links.at(key);
+      out.emplace_back(std::move(entry.value));
+      key = entry.next;
+    }
+    m_links.clear();
+  }
+
+private:
+  struct Link {
+    T value;
+    uint64_t prev = 0;
+    uint64_t next = 0;
+  };
+
+  void link(uint64_t key, T value, uint64_t after) {
+    uint64_t const next = after ? m_links.at(after).next : m_head;
+
+    m_links.insert_or_assign(key, Link{.value = std::move(value), .prev = after, .next = next});
+    if (after) {
+      m_links.at(after).next = key;
+    } else {
+      m_head = key;
+    }
+    if (next) {
+      m_links.at(next).prev = key;
+    } else {
+      m_tail = key;
+    }
+  }
+
+  void unlink(uint64_t key) {
+    auto node = m_links.extract(key);
+    relink(key, node.mapped().prev, node.mapped().next);
+  }
+
+  // closes the gap left by `key`
+  void relink(uint64_t key, uint64_t prev, uint64_t next) {
+    if (prev) {
+      m_links.at(prev).next = next;
+    } else if (m_head == key) {
+      m_head = next;
+    }
+    if (next) {
+      m_links.at(next).prev = prev;
+    } else if (m_tail == key) {
+      m_tail = prev;
+    }
+  }
+
+  std::unordered_map<uint64_t, Link> m_links;
+  uint64_t m_head = 0;
+  uint64_t m_tail = 0;
+};
+
+/**
+ * Applies the steps of one parent: removals first, then updates and placements in order. `take` turns
+ * the node of a step into a child of this parent (empty when it is not one), and `update` applies an
+ * update to an existing child. Returns whether every step applied.
+ */
+template <typename T, typename Child, typename Take, typename Update>
+bool applyTo(std::vector<T> &children, const std::vector<const PatchOp<Child> *> &ops, Take take,
+             Update update) {
+  std::unordered_set<uint64_t> removed;
+  bool reorders = false;
+  bool applied = true;
+
+  for (const auto *op : ops) {
+    if (op->kind == PatchOpKind::Remove) removed.insert(op->key);
+    if (op->kind == PatchOpKind::Insert || op->kind == PatchOpKind::Move) reorders = true;
+  }
+
+  if (!removed.empty()) {
+    auto const erased =
+        std::erase_if(children, [&](const T &child) { return removed.contains(keyOf(child)); });
+    if (erased != removed.size()) {
+      qWarning() << "render patch: removing items that are not there";
+      applied = false;
+    }
+  }
+
+  if (!reorders) {
+    std::unordered_map<uint64_t, size_t> index;
+    index.reserve(children.size());
+    for (size_t i = 0; i != children.size(); ++i) {
+      index.emplace(keyOf(children[i]), i);
+    }
+
+    for (const auto *op : ops) {
+      if (op->kind != PatchOpKind::Update || !op->node) continue;
+      if (auto it = index.find(op->key); it != index.end()) {
+        update(children[it->second], *op->node);
+      } else {
+        qWarning() << "render patch: no item with key" << op->key << "to update";
+        applied = false;
+      }
+    }
+    return applied;
+  }
+
+  KeyedList<T> list(children);
+
+  for (const auto *op : ops) {
+    bool const placeable = op->key != op->after && (op->after == 0 || list.contains(op->after));
+
+    switch (op->kind) {
+    case PatchOpKind::Remove:
+      break;
+    case PatchOpKind::Update:
+      if (auto *child = list.find(op->key); child && op->node) {
+        update(*child, *op->node);
+      } else {
+        qWarning() << "render patch: no item with key" << op->key << "to update";
+        applied = false;
+      }
+      break;
+    case PatchOpKind::Insert:
+      if (!op->node || !placeable) {
+        qWarning() << "render patch: cannot insert item with key" << op->key;
+        applied = false;
+      } else if (auto child = take(*op->node)) {
+        list.insert(op->key, std::move(*child), op->after);
+      } else {
+        applied = false;
+      }
+      break;
+    case PatchOpKind::Move:
+      if (!list.contains(op->key) || !placeable) {
+        qWarning() << "render patch: cannot move item with key" << op->key;
+        applied = false;
+      } else {
+        list.move(op->key, op->after);
+      }
+      break;
+    }
+  }
+
+  list.takeInto(children);
+  return applied;
+}
+
+} // namespace detail
+
+/**
+ * Applies `ops` to the root items of a list or grid, in which sections hold items of their own. Steps
+ * that do not fit the current items are skipped with a warning, and false is returned: the items then
+ * differ from what the extension has, which has to send them whole again.
+ */
+template <typename Item, typename Section>
+bool apply(std::vector<std::variant<Item, Section>> &items,
+           const std::vector<PatchOp<std::variant<Item, Section>>> &ops) {
+  using Child = std::variant<Item, Section>;
+  using Op = PatchOp<Child>;
+
+  // the steps of every parent, parents in the order they first show up: the root always comes first
+  std::vector<uint64_t> parents;
+  std::unordered_map<uint64_t, std::vector<const Op *>> byParent;
+
+  for (const auto &op : ops) {
+    auto &parentOps = byParent[op.parent];
+    if (parentOps.empty()) parents.push_back(op.parent);
+    parentOps.push_back(&op);
+  }
+
+  auto updateSection = [](Section &section, Section next) {
+    next.children = std::move(section.children);
+    section = std::move(next);
+  };
+
+  bool applied = true;
+
+  for (uint64_t const parent : parents) {
+    const auto &parentOps = byParent.at(parent);
+
+    if (parent == 0) {
+      applied &= detail::applyTo<Child>(
+          items, parentOps, [](const Child &node) { return std::optional<Child>(node); },
+          [&](Child &child, const Child &node) {
+            auto *section = std::get_if<Section>(&child);
+            auto *next = std::get_if<Section>(&node);
+            if (section && next) {
+              updateSection(*section, *next);
+            } else {
+              child = node;
+            }
+          });
+      continue;
+    }
+
+    auto it = std::ranges::find_if(items, [&](const Child &child) {
+      auto *section = std::get_if<Section>(&child);
+      return section && section->key == parent;
+    });
+
+    if (it == items.end()) {
+      qWarning() << "render patch: no section with key" << parent;
+      applied = false;
+      continue;
+    }
+
+    applied &= detail::applyTo<Item>(
+        std::get<Section>(*it).children, parentOps,
+        [](const Child &node) -> std::optional<Item> {
+          if (auto *item = std::get_if<Item>(&node)) return *item;
+          return std::nullopt;
+        },
+        [](Item &item, const Child &node) {
+          if (auto *next = std::get_if<Item>(&node)) item = *next;
+        });
+  }
+
+  return applied;
+}
+
+} // namespace render_patch
@@ -11,7 +11,7 @@ public:
   ExtensionManagerBus(ExtensionManager &manager) : m_manager(manager) {}
 
   void send(std::string_view data) override {
-    m_manager.client().manager()->messageExtension(m_sessionId, std::string{data});
+    m_manager.messageExtension(m_sessionId, data);
   }
 
   void setSessionId(std::string str) { m_sessionId = std::move(str); }
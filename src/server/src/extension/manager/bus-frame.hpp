@@ -0,0 +1,67 @@
+#pragma once
+#include <cstdint>
+#include <expected>
+#include <string>
+#include <string_view>
+
+/**
+ * Frames exchanged with the extension manager over its standard streams: a big endian u32 length followed
+ * by the body. A body starting with `{` is a manager JSON-RPC message. Once binary framing is negotiated
+ * (see `Manager.setFraming`), extension messages travel in frames of their own instead, holding the raw
+ * bytes of the message rather than a JSON string that both ends would have to escape and unescape again.
+ */
+namespace bus_frame {
+
+enum class Kind : uint8_t {
+  // u8 session id length, session id, message bytes up to the end of the frame
+  ExtensionMessage = 1,
+};
+
+struct ExtensionMessage {
+  std::string_view sessionId;
+  std::string_view payload;
+};
+
+constexpr size_t LENGTH_SIZE = sizeof(uint32_t);
+
+inline bool isRpc(std::string_view body) { return !body.empty() && body.front() == '{'; }
+
+inline void appendLength(std::string &out, uint32_t length) {
+  out.push_back(static_cast<char>(length >> 24));
+  out.push_back(static_cast<char>(length >> 16));
+  out.push_back(static_cast<char>(length >> 8));
+  out.push_back(static_cast<char>(length));
+}
+
+// Replaces `out` with the whole frame, length included.
+inline std::expected<void, std::string> encodeExtensionMessage(std::string &out, std::string_view sessionId,
+                                                               std::string_view payload) {
+  if (sessionId.size() > UINT8_MAX) return std::unexpected("session id too long");
+
+  size_t const size = 2 + sessionId.size() + payload.size();
+  if (size > UINT32_MAX) return std::unexpected("extension message too large");
+
+  out.clear();
+  out.reserve(LENGTH_SIZE + size);
+  appendLength(out, static_cast<uint32_t>(size));
+  out.push_back(static_cast<char>(Kind::ExtensionMessage));
+  out.push_back(static_cast<char>(sessionId.size()));
+  out.append(sessionId);
+  out.append(payload);
+  return {};
+}
+
+// The views point into `body`.
+inline std::expected<ExtensionMessage, std::string> decodeExtensionMessage(std::string_view body) {
+  if (body.size() < 2) return std::unexpected("truncated frame");
+  if (static_cast<Kind>(body[0]) != Kind::ExtensionMessage) {
+    return std::unexpected("unknown frame kind " + std::to_string(static_cast<uint8_t>(body[0])));
+  }
+
+  size_t const idLength = static_cast<uint8_t>(body[1]);
+  if (body.size() < 2 + idLength) return std::unexpected("truncated session id");
+
+  return ExtensionMessage{.sessionId = body.substr(2, idLength), .payload = body.substr(2 + idLength)};
+}
+
+} // namespace bus_frame
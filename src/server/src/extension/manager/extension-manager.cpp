@@ -29,6 +29,16 @@ void Bus::sendMessage(const QByteArray &data) {
   device->waitForBytesWritten(1000);
 }
 
+void Bus::sendExtensionMessage(std::string_view sessionId, std::string_view data) {
+  if (auto const res = bus_frame::encodeExtensionMessage(m_frame, sessionId, data); !res) {
+    qWarning() << "Failed to frame extension message:" << res.error();
+    return;
+  }
+
+  device->write(m_frame.data(), static_cast<qint64>(m_frame.size()));
+  device->waitForBytesWritten(1000);
+}
+
 void Bus::readyRead() {
   while (device->bytesAvailable() > 0) {
     auto read = device->readAll();
@@ -44,8 +54,15 @@ void Bus::readyRead() {
       if (!isComplete) break;
 
       auto packet = _message.data.sliced(sizeof(uint32_t), length);
+      std::string_view const body{packet.constData(), static_cast<size_t>(packet.size())};
 
-      emit messageReceived(packet);
+      if (bus_frame::isRpc(body)) {
+        emit messageReceived(packet);
+      } else if (auto msg = bus_frame::decodeExtensionMessage(body)) {
+        emit extensionMessageReceived(std::string{msg->sessionId}, msg->payload);
+      } else {
+        qWarning() << "Dropping extension manager frame:" << msg.error();
+      }
 
       _message.data = _message.data.sliced(sizeof(uint32_t) + length);
     }
@@ -70,6 +87,7 @@ ExtensionManager::ExtensionManager() : m_bus(&m_process), m_rpc(m_bus), m_client
   connect(&m_process, &QProcess::started, this, &ExtensionManager::processStarted);
   connect(m_client.manager(), &manager::ManagerService::extensionMessage, this,
           &ExtensionManager::extensionMessageReceived);
+  connect(&m_bus, &Bus::extensionMessageReceived, this, &ExtensionManager::extensionMessageReceived);
   connect(m_client.manager(), &manager::ManagerService::extensionCrash, this,
           &ExtensionManager::extensionCrashed);
 
@@ -152,7 +170,33 @@ bool ExtensionManager::hasDevelopmentSession(const QString &id) const {
   return m_developmentSessions.contains(id);
 }
 
-void ExtensionManager::processStarted() { emit started(); }
+void ExtensionManager::messageExtension(const std::string &sessionId, std::string_view data) {
+  if (m_framing == manager::BusFraming::Binary) {
+    m_bus.sendExtensionMessage(sessionId, data);
+    return;
+  }
+
+  m_client.manager()->messageExtension(sessionId, std::string{data});
+}
+
+void ExtensionManager::negotiateFraming() {
+  auto future = m_client.manager()->setFraming(manager::BusFraming::Binary);
+
+  future.then(this, [this](const std::expected<bool, std::string> &res) {
+    if (!res) {
+      qWarning() << "Extension manager framing negotiation failed, staying on JSON:" << res.error();
+      return;
+    }
+    if (*res) m_framing = manager::BusFraming::Binary;
+  });
+}
+
+void ExtensionManager::processStarted() {
+  // a new manager process starts out with JSON, like any manager that does not know about framing
+  m_framing = manager::BusFraming::Json;
+  negotiateFraming();
+  emit started();
+}
 
 void ExtensionManager::finished(int exitCode, QProcess::ExitStatus status) {
   if (m_stopping) {
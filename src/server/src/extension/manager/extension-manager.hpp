@@ -3,6 +3,7 @@
 #include <QJsonArray>
 #include <QString>
 #include "generated/manager.hpp"
+#include "extension/manager/bus-frame.hpp"
 #include "extension/node-runtime/node-runtime.hpp"
 #include <QUuid>
 #include <QtCore>
@@ -37,6 +38,8 @@ class Bus : public QObject, public manager::AbstractTransport {
   MessageBuffer _message = {.length = 0};
 
   QIODevice *device = nullptr;
+  std::string m_frame;
+
   void sendMessage(const QByteArray &data);
   void readyRead();
   void send(std::string_view data) override;
@@ -44,8 +47,12 @@ class Bus : public QObject, public manager::AbstractTransport {
 public:
   Bus(QIODevice *socket);
 
+  // Only once the manager agreed to binary framing, see `bus_frame`.
+  void sendExtensionMessage(std::string_view sessionId, std::string_view data);
+
 signals:
   void messageReceived(const QByteArray &msg);
+  void extensionMessageReceived(const std::string &sessionId, std::string_view data) const;
 };
 
 struct PendingManagerRequestInfo {
@@ -78,17 +85,23 @@ public:
 
   manager::Client &client() { return m_client; }
 
+  // Forwards a message to the extension running as `sessionId`, in whatever framing was negotiated.
+  void messageExtension(const std::string &sessionId, std::string_view data);
+
   // void unloadCommand(const QString &sessionId);
   void handleManagerResponse(const QString &action, QJsonObject &data);
   void finished(int exitCode, QProcess::ExitStatus status);
   void readError();
 
 private:
+  void negotiateFraming();
+
   QProcess m_process;
   Bus m_bus;
   manager::RpcTransport m_rpc;
   manager::Client m_client;
   NodeRuntime m_node;
   bool m_stopping = false;
+  manager::BusFraming m_framing = manager::BusFraming::Json;
   std::unordered_set<QString> m_developmentSessions;
 };
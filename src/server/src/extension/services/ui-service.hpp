@@ -25,7 +25,8 @@ class ExtUIService : public tsapi::AbstractUI {
 
   struct ViewEntry {
     BaseView *baseView;
-    std::function<void(const RenderModel &)> renderFn;
+    // false when the view has to be sent whole again
+    std::function<bool(const RenderModel &)> renderFn;
   };
 
 public:
@@ -116,7 +117,7 @@ public:
     m_navigation->setNavigationTitle(m_command->name());
     m_navigation->setNavigationIcon(m_command->iconUrl());
 
-    m_views.emplace_back(ViewEntry{host, [host](const RenderModel &m) { host->render(m); }});
+    m_views.emplace_back(ViewEntry{host, [host](const RenderModel &m) { return host->render(m); }});
 
     QTimer::singleShot(0, this, [this]() { emitviewPushed(); });
 
@@ -182,13 +183,17 @@ public:
 private slots:
   void modelCreated() {
     auto models = m_modelWatcher.result();
+    bool resync = false;
 
     for (size_t i = 0; i < models.items.size() && i < m_views.size(); ++i) {
       const auto &model = models.items[i];
       const auto &entry = m_views[i];
-      if (model.dirty) entry.renderFn(model.root);
+      if (model.dirty && !entry.renderFn(model.root)) resync = true;
     }
 
+    // what is shown no longer matches what the extension diffs against
+    if (resync) emitfullRenderRequested();
+
     processNextRender();
   }
 
@@ -103,7 +103,14 @@ public:
     excludedPaths.setDescription(tr("Directories to exclude from file indexing"));
     excludedPaths.setDefaultValue(QJsonArray{});
 
-    return {indexing, paths, excludedPaths};
+    auto residentIndex = Preference::makeCheckbox("residentIndex");
+    residentIndex.setTitle(tr("Keep index in memory"));
+    residentIndex.setDescription(
+        tr("Keep a compact copy of the file index in memory so searches skip the database. Faster on large "
+           "indexes, at the cost of a few hundred bytes of memory per indexed file."));
+    residentIndex.setDefaultValue(false);
+
+    return {indexing, paths, excludedPaths, residentIndex};
 #else
     return {};
 #endif
@@ -7,21 +7,30 @@
 #include <cstdint>
 #include <expected>
 #include <filesystem>
+#include <memory>
 #include <optional>
 #include <qlogging.h>
 #include <string>
 #include <string_view>
+#include <unordered_map>
 #include <utility>
+#include <vector>
 
 namespace db {
 
 static constexpr int BUSY_TIMEOUT_MS = 5000;
 
+class StatementCache;
+
 class Statement {
   sqlite3_stmt *m_stmt = nullptr;
   sqlite3 *m_db = nullptr;
+  // where the statement goes back to instead of being finalized, if it came from one
+  StatementCache *m_cache = nullptr;
   bool m_valid = true;
 
+  void release();
+
   int paramIndex(const char *name) const {
     if (!m_stmt) return 0;
     return sqlite3_bind_parameter_index(m_stmt, name);
@@ -32,29 +41,32 @@ public:
 
   explicit operator bool() const { return m_valid; }
 
-  Statement(sqlite3_stmt *stmt, sqlite3 *db) : m_stmt(stmt), m_db(db) {}
+  Statement(sqlite3_stmt *stmt, sqlite3 *db, StatementCache *cache = nullptr)
+      : m_stmt(stmt), m_db(db), m_cache(cache) {}
 
-  ~Statement() {
-    if (m_stmt) sqlite3_finalize(m_stmt);
-  }
+  ~Statement() { release(); }
 
   Statement(const Statement &) = delete;
   Statement &operator=(const Statement &) = delete;
 
-  Statement(Statement &&other) noexcept : m_stmt(other.m_stmt), m_db(other.m_db), m_valid(other.m_valid) {
+  Statement(Statement &&other) noexcept
+      : m_stmt(other.m_stmt), m_db(other.m_db), m_cache(other.m_cache), m_valid(other.m_valid) {
     other.m_stmt = nullptr;
     other.m_db = nullptr;
+    other.m_cache = nullptr;
     other.m_valid = false;
   }
 
   Statement &operator=(Statement &&other) noexcept {
     if (this != &other) {
-      if (m_stmt) sqlite3_finalize(m_stmt);
+      release();
       m_stmt = other.m_stmt;
       m_db = other.m_db;
+      m_cache = other.m_cache;
       m_valid = other.m_valid;
       other.m_stmt = nullptr;
       other.m_db = nullptr;
+      other.m_cache = nullptr;
       other.m_valid = false;
     }
     return *this;
@@ -151,6 +163,55 @@ public:
   std::string lastError() const { return sqlite3_errmsg(m_db); }
 };
 
+/**
+ * Prepared statements of a connection kept around between uses, keyed by the SQL they were prepared from.
+ * A statement is taken out while in use, so that the same query can be running twice at once.
+ */
+class StatementCache {
+  std::unordered_map<std::string, std::vector<sqlite3_stmt *>> m_idle;
+  std::unordered_map<sqlite3_stmt *, std::string> m_sql;
+
+public:
+  StatementCache() = default;
+
+  ~StatementCache() {
+    for (auto &[stmt, _] : m_sql) {
+      sqlite3_finalize(stmt);
+    }
+  }
+
+  StatementCache(const StatementCache &) = delete;
+  StatementCache &operator=(const StatementCache &) = delete;
+
+  sqlite3_stmt *take(std::string_view sql) {
+    auto it = m_idle.find(std::string(sql));
+    if (it == m_idle.end() || it->second.empty()) return nullptr;
+
+    auto *stmt = it->second.back();
+    it->second.pop_back();
+    return stmt;
+  }
+
+  // a statement newly prepared from `sql`, to give back once done with it
+  void adopt(sqlite3_stmt *stmt, std::string_view sql) { m_sql.emplace(stmt, sql); }
+
+  void give(sqlite3_stmt *stmt) {
+    sqlite3_reset(stmt);
+    sqlite3_clear_bindings(stmt);
+    m_idle[m_sql.at(stmt)].push_back(stmt);
+  }
+};
+
+inline void Statement::release() {
+  if (!m_stmt) return;
+
+  if (m_cache) {
+    m_cache->give(m_stmt);
+  } else {
+    sqlite3_finalize(m_stmt);
+  }
+}
+
 class Transaction {
   sqlite3 *m_db = nullptr;
   bool m_done = false;
@@ -194,25 +255,43 @@ public:
 
 class Database {
   sqlite3 *m_handle = nullptr;
+  // behind a pointer so that cached statements still in use survive moving the connection
+  mutable std::unique_ptr<StatementCache> m_cache;
 
   explicit Database(sqlite3 *handle) : m_handle(handle) {}
 
+  sqlite3_stmt *prepareRaw(std::string_view sql) const {
+    sqlite3_stmt *stmt = nullptr;
+    int const rc = sqlite3_prepare_v2(m_handle, sql.data(), static_cast<int>(sql.size()), &stmt, nullptr);
+    if (rc != SQLITE_OK) {
+      qWarning("db::prepare failed: %s (sql: %.*s)", sqlite3_errmsg(m_handle), static_cast<int>(sql.size()),
+               sql.data());
+      return nullptr;
+    }
+    return stmt;
+  }
+
 public:
   Database() = default;
 
   ~Database() {
+    m_cache.reset();
     if (m_handle) sqlite3_close_v2(m_handle);
   }
 
   Database(const Database &) = delete;
   Database &operator=(const Database &) = delete;
 
-  Database(Database &&other) noexcept : m_handle(other.m_handle) { other.m_handle = nullptr; }
+  Database(Database &&other) noexcept : m_handle(other.m_handle), m_cache(std::move(other.m_cache)) {
+    other.m_handle = nullptr;
+  }
 
   Database &operator=(Database &&other) noexcept {
     if (this != &other) {
+      m_cache.reset();
       if (m_handle) sqlite3_close_v2(m_handle);
       m_handle = other.m_handle;
+      m_cache = std::move(other.m_cache);
       other.m_handle = nullptr;
     }
     return *this;
@@ -261,16 +340,30 @@ public:
   }
 
   Statement prepare(std::string_view sql) const {
-    sqlite3_stmt *stmt = nullptr;
-    int const rc = sqlite3_prepare_v2(m_handle, sql.data(), static_cast<int>(sql.size()), &stmt, nullptr);
-    if (rc != SQLITE_OK) {
-      qWarning("db::prepare failed: %s (sql: %.*s)", sqlite3_errmsg(m_handle), static_cast<int>(sql.size()),
-               sql.data());
-      return {};
-    }
+    auto *stmt = prepareRaw(sql);
+    if (!stmt) return {};
     return {stmt, m_handle};
   }
 
+  /**
+   * Like `prepare`, but the statement is reset and kept for the next time the same SQL is prepared instead
+   * of being finalized. For long-lived connections that run the same queries over and over.
+   * Cached statements must not outlive the connection.
+   */
+  Statement prepareCached(std::string_view sql) const {
+    if (!m_cache) m_cache = std::make_unique<StatementCache>();
+
+    auto *stmt = m_cache->take(sql);
+
+    if (!stmt) {
+      stmt = prepareRaw(sql);
+      if (!stmt) return {};
+      m_cache->adopt(stmt, sql);
+    }
+
+    return {stmt, m_handle, m_cache.get()};
+  }
+
   bool exec(const char *sql) const {
     return sqlite3_exec(m_handle, sql, nullptr, nullptr, nullptr) == SQLITE_OK;
   }
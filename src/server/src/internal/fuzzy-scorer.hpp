@@ -1,6 +1,7 @@
 #pragma once
 
 #include "fuzzy/fuzzy-searchable.hpp"
+#include "fuzzy/ranking.hpp"
 #include "fuzzy/scored.hpp"
 #include <QtConcurrent>
 #include <algorithm>
@@ -16,6 +17,7 @@
  * in order to spare allocations.
  * Automatically splits the dataset in batches and dispatch the scoring work to multiple threads if the
  * dataset is huge.
+ * Results are ranked lazily, a page at a time as they are read (see fuzzy::Ranking).
  */
 template <typename T> class FuzzyScorer {
 public:
@@ -23,10 +25,11 @@ public:
   static constexpr size_t PARALLEL_THRESHOLD = 1000;
   static constexpr size_t MIN_BATCH = 256;
   using TScored = Scored<const T *>;
+  using Results = fuzzy::Ranking<TScored>;
 
-  std::span<Scored<const T *>> score(std::span<const T> items, std::string_view text,
-                                     const Scorer &scorer) const {
-    m_data.reserve(items.size());
+  const Results &score(std::span<const T> items, std::string_view text, const Scorer &scorer) const {
+    m_results.clear();
+    m_results.reserve(items.size());
     fuzzy::Query const query{text};
 
     if (items.size() < PARALLEL_THRESHOLD) { return scoreSync(items, query, scorer); }
@@ -34,21 +37,17 @@ public:
   }
 
 private:
-  std::span<Scored<const T *>> scoreSync(std::span<const T> items, const fuzzy::Query &query,
-                                         const Scorer &scorer) const {
-    m_data.clear();
-
+  const Results &scoreSync(std::span<const T> items, const fuzzy::Query &query, const Scorer &scorer) const {
     for (auto &item : items) {
-      if (auto m = scorer(item, query); m.accepted()) { m_data.emplace_back(TScored(&item, m.score)); }
+      if (auto m = scorer(item, query); m.accepted()) { m_results.emplace_back(TScored(&item, m.score)); }
     }
 
-    std::ranges::stable_sort(m_data, std::greater{});
-    return m_data;
+    return m_results;
   }
 
-  std::span<Scored<const T *>> scoreParallel(std::span<const T> items, const fuzzy::Query &query,
-                                             const Scorer &scorer) const {
-    std::vector<QFuture<size_t>> futures;
+  const Results &scoreParallel(std::span<const T> items, const fuzzy::Query &query,
+                               const Scorer &scorer) const {
+    std::vector<QFuture<void>> futures;
     const int poolThreads = QThreadPool::globalInstance()->maxThreadCount();
     const size_t threads = poolThreads > 0 ? static_cast<size_t>(poolThreads) : 1;
     const size_t batchSize = std::max(MIN_BATCH, (items.size() + threads - 1) / threads);
@@ -62,8 +61,6 @@ private:
       const size_t end = std::min(start + batchSize, items.size());
 
       futures[i] = QtConcurrent::run([this, start, end, &scorer, &query, items]() {
-        size_t zeroCount = 0;
-
         for (auto i = start; i != end; ++i) {
           const auto &item = items[i];
 
@@ -72,27 +69,23 @@ private:
             m_data[i].score = m.score;
           } else {
             m_data[i].score = 0;
-            zeroCount += 1;
           }
         }
-
-        return zeroCount;
       });
     }
 
     auto future = QtFuture::whenAll(futures.begin(), futures.end());
     future.waitForFinished(); // all captures are safe, since we block here
-    size_t zeroCount = 0;
 
-    for (const auto &future : futures) {
-      zeroCount += future.result();
+    // in item order, as the sequential pass adds them
+    for (const auto &entry : m_data) {
+      if (entry.score) m_results.push_back(entry);
     }
 
-    std::ranges::stable_sort(m_data, std::greater{});
-
-    // all zeros are on the right, we can just cut them off from view
-    return {m_data.data(), m_data.size() - zeroCount};
+    return m_results;
   }
 
+  // per item scores of a parallel pass, zero for rejected items
   mutable std::vector<Scored<const T *>> m_data;
+  mutable Results m_results;
 };
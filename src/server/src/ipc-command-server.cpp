@@ -282,7 +282,10 @@ ipc_gen::Result<ipc_gen::DMenuResponse>::Future IpcService::dmenu(ipc_gen::DMenu
 
   // Convert to the DMenu-specific request type used by the view host
   ipc_gen::DMenuRequest viewReq = std::move(request);
-  auto view = new DMenuViewHost(viewReq);
+  bool const streamed = viewReq.stream.value_or(false);
+  auto view = new DMenuViewHost(std::move(viewReq));
+
+  if (streamed && m_caller) m_caller->dmenu = view;
 
   using Watcher = QFutureWatcher<ipc_gen::Result<ipc_gen::DMenuResponse>::Type>;
   auto watcher = new Watcher;
@@ -311,6 +314,14 @@ ipc_gen::Result<ipc_gen::DMenuResponse>::Future IpcService::dmenu(ipc_gen::DMenu
   return future;
 }
 
+ipc_gen::Result<void>::Future IpcService::dmenuAppend(std::string chunk, bool done) {
+  if (!m_caller || !m_caller->dmenu)
+    return ipc_gen::Result<void>::fail("No dmenu is streaming on this connection");
+
+  m_caller->dmenu->appendInput(chunk, done);
+  return ipc_gen::Result<void>::ok();
+}
+
 ipc_gen::Result<void>::Future IpcService::browserInit(ipc_gen::BrowserInitRequest req) {
   if (!m_caller) return ipc_gen::Result<void>::fail("No caller context");
 
@@ -408,6 +419,8 @@ void IpcCommandServer::handleDisconnection(QLocalSocket *conn) {
   auto it = std::ranges::find_if(m_clients, [conn](const ClientInfo &info) { return info.conn == conn; });
 
   if (it->browser) { m_ctx.services->browserExtension()->unregisterBrowser(it->browser->id); }
+  // a client gone before it sent `done` has nothing more to stream
+  if (it->dmenu) it->dmenu->appendInput({}, true);
 
   m_transport.forgetConn(conn);
   if (m_transport.conn == conn) m_transport.conn = nullptr;
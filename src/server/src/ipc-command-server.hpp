@@ -2,6 +2,7 @@
 #include "common/context.hpp"
 #include <QLocalSocket>
 #include <QFutureWatcher>
+#include <QPointer>
 #include <cstdint>
 #include <QDebug>
 #include <format>
@@ -11,6 +12,8 @@
 #include "generated/ipc-server.hpp"
 #include "common/qt.hpp"
 
+class DMenuViewHost;
+
 struct ClientInfo {
   QLocalSocket *conn;
   struct {
@@ -18,6 +21,8 @@ struct ClientInfo {
     uint32_t length;
   } frame;
   std::optional<ipc_gen::BrowserInitRequest> browser;
+  // the dmenu this client streams its input to, see `dmenuAppend`
+  QPointer<DMenuViewHost> dmenu;
 };
 
 class IpcService : public ipc_gen::AbstractIpc {
@@ -32,6 +37,7 @@ public:
   ipc_gen::Result<ipc_gen::LaunchCommandResponse>::Future
   launchCommand(ipc_gen::LaunchCommandRequest req) override;
   ipc_gen::Result<ipc_gen::DMenuResponse>::Future dmenu(ipc_gen::DMenuRequest req) override;
+  ipc_gen::Result<void>::Future dmenuAppend(std::string chunk, bool done) override;
   ipc_gen::Result<void>::Future browserInit(ipc_gen::BrowserInitRequest req) override;
   ipc_gen::Result<void>::Future browserTabsChanged(std::vector<ipc_gen::BrowserTabInfo> tabs) override;
   ipc_gen::Result<std::vector<ipc_gen::FileResult>>::Future fsQuery(std::string q,
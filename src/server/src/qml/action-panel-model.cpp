@@ -281,7 +281,7 @@ void ActionPanelModel::buildFlatList(std::vector<FlatItem> &out) const {
   out.reserve(m_allActions.size() + m_sections.size() * 2);
 
   bool needsDivider = false;
-  std::vector<Scored<int>> scored;
+  fuzzy::Ranking<Scored<int>> scored;
 
   for (int s = 0; std::cmp_less(s, m_sections.size()); ++s) {
     const auto &section = m_sections[s];
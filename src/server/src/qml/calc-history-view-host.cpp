@@ -106,7 +106,7 @@ void CalcHistoryViewHost::textChanged(const QString &text) {
   if (explicitCalc || text.size() >= CALCULATOR_MIN_CHARS) {
     QString calcQuery = explicitCalc ? text.mid(1) : text;
 
-    if (auto res = m_calc->backend()->compute(calcQuery, {})) {
+    if (auto res = m_calc->compute(calcQuery)) {
       m_liveSection.setResult(std::move(res.value()));
     }
   }
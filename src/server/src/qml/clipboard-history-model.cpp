@@ -16,6 +16,17 @@
 
 void ClipboardHistorySection::setEntries(const PaginatedResponse<ClipboardHistoryEntry> &page) {
   m_entries = page.data;
+  m_thumbnails.clear();
+  m_thumbnails.reserve(m_entries.size());
+
+  for (const auto &entry : m_entries) {
+    if (entry.thumbnail.isEmpty()) {
+      m_thumbnails.emplace_back();
+    } else {
+      m_thumbnails.emplace_back(ImageURL::rawData(entry.thumbnail, entry.thumbnailMimeType));
+    }
+  }
+
   notifyChanged();
 }
 
@@ -28,7 +39,10 @@ QString ClipboardHistorySection::itemSubtitle(int i) const {
   return getRelativeTimeString(dt);
 }
 
-std::optional<ImageURL> ClipboardHistorySection::itemIcon(int i) const { return iconForEntry(m_entries[i]); }
+std::optional<ImageURL> ClipboardHistorySection::itemIcon(int i) const {
+  if (m_thumbnails[i]) return m_thumbnails[i];
+  return iconForEntry(m_entries[i]);
+}
 
 ImageURL ClipboardHistorySection::iconForEntry(const ClipboardHistoryEntry &entry) const {
   switch (entry.kind) {
@@ -47,6 +47,8 @@ private:
   ImageURL iconForEntry(const ClipboardHistoryEntry &entry) const;
 
   std::vector<ClipboardHistoryEntry> m_entries;
+  // built once per page rather than on every repaint, the data URLs of thumbnails aren't small
+  std::vector<std::optional<ImageURL>> m_thumbnails;
   DefaultAction m_defaultAction = DefaultAction::Copy;
   std::function<void(const ClipboardHistoryEntry &)> m_onEntrySelected;
 };
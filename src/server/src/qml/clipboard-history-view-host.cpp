@@ -9,8 +9,11 @@
 #include <QDateTime>
 #include <QDir>
 #include <QFile>
+#include <QGuiApplication>
 #include <QUrl>
 
+static constexpr qsizetype MAX_TEXT_DISPLAY = 10 * 1024;
+
 static QString kindLabel(ClipboardOfferKind kind) {
   switch (kind) {
   case ClipboardOfferKind::Text:
@@ -207,10 +210,32 @@ void ClipboardHistoryViewHost::loadDetail(const ClipboardHistoryEntry &entry) {
     m_detailEncryptionIcon.clear();
   }
 
-  auto data = m_clipman->getMainOfferData(entry.id);
-  if (!data) {
+  const auto &mime = entry.mimeType;
+  bool const isText = Utils::isTextMimeType(mime) || mime == "text/uri-list";
+
+  // the previews made at indexing time, so that going through the history never reads the data itself
+  if (mime.startsWith("image/")) {
+    auto const kind = qApp->devicePixelRatio() > 1 ? ClipboardPreviewKind::Thumbnail2x
+                                                   : ClipboardPreviewKind::Thumbnail;
+    if (auto preview = m_clipman->retrievePreview(entry.id, kind)) {
+      m_detailImageSource = qml::imageSourceFor(ImageURL::rawData(preview->data, preview->mimeType));
+      m_hasDetail = true;
+      emit detailChanged();
+      return;
+    }
+  }
+
+  if (isText) {
+    if (auto preview = m_clipman->retrievePreview(entry.id, ClipboardPreviewKind::Excerpt)) {
+      setTextDetail(mime, preview->data);
+      return;
+    }
+  }
+
+  auto offer = m_clipman->openMainOffer(entry.id);
+  if (!offer) {
     m_hasDetailError = true;
-    switch (data.error()) {
+    switch (offer.error()) {
     case ClipboardService::OfferDecryptionError::DecryptionFailed:
       m_detailErrorTitle = tr("Decryption failed");
       m_detailErrorDescription =
@@ -235,12 +260,47 @@ void ClipboardHistoryViewHost::loadDetail(const ClipboardHistoryEntry &entry) {
     return;
   }
 
-  const auto &rawData = data.value();
-  const auto &mime = entry.mimeType;
+  // not previewed yet
+  auto &device = *offer.value();
+
+  if (mime.startsWith("image/")) {
+    auto const cacheDir = QString::fromStdString(Omnicast::cacheDir().string());
+    QDir().mkpath(cacheDir);
+    QString const path = cacheDir + QStringLiteral("/clipboard-") + entry.md5sum;
+    QFile f(path);
+    if (!f.exists() && f.open(QIODevice::WriteOnly)) {
+      // a chunk at a time, large images are never held in memory whole
+      static constexpr qint64 COPY_CHUNK_SIZE = 64 * 1024;
+      while (!device.atEnd()) {
+        QByteArray const chunk = device.read(COPY_CHUNK_SIZE);
+        if (chunk.isEmpty() || f.write(chunk) != chunk.size()) {
+          qWarning() << "Failed to copy clipboard image to" << path << device.errorString();
+          f.remove();
+          break;
+        }
+      }
+      f.close();
+    }
+    m_detailImageSource = qml::imageSourceFor(ImageURL::local(path));
+    m_hasDetail = true;
+    emit detailChanged();
+    return;
+  }
 
+  if (isText) {
+    setTextDetail(mime, device.read(MAX_TEXT_DISPLAY));
+    return;
+  }
+
+  m_hasDetail = true;
+  emit detailChanged();
+}
+
+void ClipboardHistoryViewHost::setTextDetail(const QString &mime, const QByteArray &text) {
   if (mime == "text/uri-list") {
-    QString const text(rawData);
-    auto paths = text.split("\r\n", Qt::SkipEmptyParts);
+    // excerpts have their line endings normalized, the data itself uses CRLF
+    QString const list = QString::fromUtf8(text).replace(QStringLiteral("\r\n"), QStringLiteral("\n"));
+    auto paths = list.split('\n', Qt::SkipEmptyParts);
     if (paths.size() == 1) {
       QUrl const url(paths.at(0));
       if (url.isLocalFile()) {
@@ -258,29 +318,7 @@ void ClipboardHistoryViewHost::loadDetail(const ClipboardHistoryEntry &entry) {
     }
   }
 
-  if (mime.startsWith("image/")) {
-    auto const cacheDir = QString::fromStdString(Omnicast::cacheDir().string());
-    QDir().mkpath(cacheDir);
-    QString const path = cacheDir + QStringLiteral("/clipboard-") + entry.md5sum;
-    QFile f(path);
-    if (!f.exists() && f.open(QIODevice::WriteOnly)) {
-      f.write(rawData);
-      f.close();
-    }
-    m_detailImageSource = qml::imageSourceFor(ImageURL::local(path));
-    m_hasDetail = true;
-    emit detailChanged();
-    return;
-  }
-
-  if (Utils::isTextMimeType(mime) || mime == "text/uri-list") {
-    static constexpr qsizetype MAX_DISPLAY = 10 * 1024;
-    m_detailTextContent = QString::fromUtf8(rawData.first(qMin<qsizetype>(rawData.size(), MAX_DISPLAY)));
-    m_hasDetail = true;
-    emit detailChanged();
-    return;
-  }
-
+  m_detailTextContent = QString::fromUtf8(text.left(MAX_TEXT_DISPLAY));
   m_hasDetail = true;
   emit detailChanged();
 }
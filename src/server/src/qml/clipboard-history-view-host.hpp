@@ -74,6 +74,7 @@ private:
   void handleMonitoringChanged(bool monitoring);
   void handleDataRetrieved(int totalCount);
   void loadDetail(const ClipboardHistoryEntry &entry);
+  void setTextDetail(const QString &mime, const QByteArray &text);
   void clearDetail();
   void saveDropdownFilter(const QString &value);
   std::optional<QString> getSavedDropdownFilter();
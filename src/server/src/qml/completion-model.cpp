@@ -205,7 +205,7 @@ void CompletionModel::rebuildFlatList() {
   m_flat.clear();
 
   const bool showHeaders = m_sections.size() > 1;
-  std::vector<Scored<int>> scored;
+  fuzzy::Ranking<Scored<int>> scored;
 
   for (int s = 0; std::cmp_less(s, m_sections.size()); ++s) {
     const auto &section = m_sections[s];
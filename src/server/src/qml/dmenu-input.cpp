@@ -0,0 +1,70 @@
+#include "dmenu-input.hpp"
+#include "fuzzy/fuzzy-searchable.hpp"
+#include <algorithm>
+
+void DMenuInput::append(std::string_view text) {
+  while (!text.empty()) {
+    auto chunk = std::make_shared<Chunk>();
+    size_t end = 0;
+
+    chunk->base = m_size;
+    chunk->entries.reserve(CHUNK_SIZE);
+
+    // find where the first CHUNK_SIZE entries end, so that the chunk only copies those
+    for (size_t count = 0; end < text.size() && count < CHUNK_SIZE;) {
+      size_t const eol = std::min(text.find('\n', end), text.size());
+      if (eol > end) ++count;
+      end = std::min(eol + 1, text.size());
+    }
+
+    chunk->text = text.substr(0, end);
+    text.remove_prefix(end);
+
+    std::string_view const copied = chunk->text;
+    for (size_t start = 0; start < copied.size();) {
+      size_t const eol = std::min(copied.find('\n', start), copied.size());
+      if (eol > start) chunk->entries.emplace_back(copied.substr(start, eol - start));
+      start = eol + 1;
+    }
+
+    if (chunk->entries.empty()) continue;
+
+    m_size += chunk->entries.size();
+    m_chunks.emplace_back(std::move(chunk));
+  }
+}
+
+std::string_view DMenuInput::at(size_t index) const {
+  if (index >= m_size) return {};
+
+  auto it = std::ranges::upper_bound(m_chunks, index, {}, [](const ChunkPtr &chunk) { return chunk->base; });
+  const auto &chunk = **std::prev(it);
+
+  return chunk.entries[index - chunk.base];
+}
+
+std::vector<DMenuInput::ChunkPtr> DMenuInput::chunks(size_t from, size_t limit) const {
+  std::vector<ChunkPtr> out;
+  auto it = std::ranges::upper_bound(m_chunks, from, {}, [](const ChunkPtr &chunk) { return chunk->base; });
+
+  if (it != m_chunks.begin()) --it;
+
+  for (; it != m_chunks.end() && (*it)->base < from + limit; ++it) {
+    if ((*it)->base + (*it)->entries.size() > from) out.emplace_back(*it);
+  }
+
+  return out;
+}
+
+std::vector<DMenuMatch> matchChunk(const DMenuInput::Chunk &chunk, std::string_view query, size_t from) {
+  fuzzy::Query const fuzzyQuery{query};
+  std::vector<DMenuMatch> matches;
+  size_t const skip = from > chunk.base ? from - chunk.base : 0;
+
+  for (size_t i = skip; i < chunk.entries.size(); ++i) {
+    auto const m = fuzzy::scoreWeighted({{chunk.entries[i], 1.0}}, fuzzyQuery);
+    if (m.accepted()) matches.push_back({{chunk.entries[i], chunk.base + i}, m.score});
+  }
+
+  return matches;
+}
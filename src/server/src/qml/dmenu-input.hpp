@@ -0,0 +1,49 @@
+#pragma once
+#include "fuzzy/scored.hpp"
+#include <cstddef>
+#include <memory>
+#include <span>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+/**
+ * The entries of a dmenu input, kept in chunks that never change or move once added: input can keep
+ * coming in while what came so far is being filtered on other threads, each holding on to the chunks it
+ * works on.
+ */
+class DMenuInput {
+public:
+  // the most entries in a chunk, which is also the unit of work when filtering
+  static constexpr size_t CHUNK_SIZE = 4096;
+
+  struct Chunk {
+    std::string text;
+    std::vector<std::string_view> entries;
+    // index of the first entry in the whole input
+    size_t base = 0;
+  };
+
+  using ChunkPtr = std::shared_ptr<const Chunk>;
+
+  // Adds the non-empty lines of `text`, a trailing line without a newline included.
+  void append(std::string_view text);
+
+  size_t size() const { return m_size; }
+  std::string_view at(size_t index) const;
+
+  // The chunks holding entries `from` and up, at most `limit` entries worth of them past `from`.
+  std::vector<ChunkPtr> chunks(size_t from, size_t limit) const;
+
+private:
+  std::vector<ChunkPtr> m_chunks;
+  size_t m_size = 0;
+};
+
+// an entry of the input along with its index in it
+using DMenuEntry = std::pair<std::string_view, size_t>;
+using DMenuMatch = Scored<DMenuEntry>;
+
+// The entries of `chunk` from the `from`th of the input up accepted by `query`, in input order.
+std::vector<DMenuMatch> matchChunk(const DMenuInput::Chunk &chunk, std::string_view query, size_t from);
@@ -1,6 +1,4 @@
 #include "dmenu-model.hpp"
-#include "common/enumerate.hpp"
-#include "fuzzy/fuzzy-searchable.hpp"
 #include "service-registry.hpp"
 #include "template-engine/template-engine.hpp"
 #include "services/clipboard/clipboard-service.hpp"
@@ -11,31 +9,78 @@
 #include <ranges>
 #include <utility>
 
-void DMenuSection::setRawEntries(std::vector<std::string_view> entries) {
-  m_entries = std::move(entries);
-  m_filtered.clear();
-  for (auto [idx, e] : vicinae::enumerate(m_entries)) {
-    m_filtered.push_back({{e, idx}, 0});
-  }
-  notifyChanged();
-}
+void DMenuSection::appendEntries(std::string_view text) { m_input.append(text); }
 
 void DMenuSection::setFilter(std::string_view query) {
-  std::string const queryStr(query);
+  m_query = query;
   m_currentSearchText = QString::fromUtf8(query.data(), query.size());
+  m_matched = 0;
+  m_stale = false;
+  m_incoming.clear();
+  m_hasIncoming = false;
+  // the model rebuilds right after
+  m_shown = m_input.size();
+
+  if (m_query.empty()) {
+    m_showAll = true;
+    m_filtered.clear();
+    return;
+  }
+
+  // keeps showing the previous results until the first matches come in
+  if (m_input.size() > SYNC_MATCH_LIMIT) {
+    m_stale = true;
+    return;
+  }
 
+  m_showAll = false;
   m_filtered.clear();
-  fuzzy::Query const fuzzyQuery{queryStr};
-  for (auto [idx, e] : vicinae::enumerate(m_entries)) {
-    auto const m = fuzzy::scoreWeighted({{e, 1.0}}, fuzzyQuery);
-    if (queryStr.empty() || m.accepted()) { m_filtered.push_back({{e, idx}, m.score}); }
+  for (const auto &chunk : m_input.chunks(0, m_input.size())) {
+    for (auto &match : matchChunk(*chunk, m_query, 0)) {
+      m_filtered.push_back(std::move(match));
+    }
+  }
+  m_matched = m_input.size();
+}
+
+std::optional<size_t> DMenuSection::pending() const {
+  if (m_query.empty() || m_matched >= m_input.size()) return std::nullopt;
+  return m_matched;
+}
+
+void DMenuSection::addMatches(size_t matchedUpTo, std::vector<DMenuMatch> matches) {
+  m_incoming.reserve(m_incoming.size() + matches.size());
+  for (auto &match : matches) {
+    m_incoming.push_back(std::move(match));
+  }
+  m_hasIncoming = true;
+  m_matched = matchedUpTo;
+}
+
+bool DMenuSection::applyIncoming() {
+  bool const replaced = m_stale && m_hasIncoming;
+
+  if (replaced) {
+    m_stale = false;
+    m_showAll = false;
+    m_filtered.clear();
   }
-  std::ranges::stable_sort(m_filtered, std::greater{});
+
+  if (m_showAll) m_shown = m_input.size();
+
+  m_filtered.reserve(m_filtered.size() + m_incoming.size());
+  for (auto &match : m_incoming) {
+    m_filtered.push_back(std::move(match));
+  }
+  m_incoming.clear();
+  m_hasIncoming = false;
+
+  return replaced;
 }
 
 QString DMenuSection::sectionName() const {
   if (m_noSection) return {};
-  return expandSectionName(m_filtered.size());
+  return expandSectionName(count());
 }
 
 QString DMenuSection::expandSectionName(size_t count) const {
@@ -44,8 +89,9 @@ QString DMenuSection::expandSectionName(size_t count) const {
   return engine.build(QString::fromUtf8(m_sectionTemplate.data(), m_sectionTemplate.size()));
 }
 
-DMenuSection::IndexedData DMenuSection::entryAt(int i) const {
-  if (i < 0 || std::cmp_greater_equal(i, m_filtered.size())) return {};
+DMenuEntry DMenuSection::entryAt(int i) const {
+  if (i < 0 || i >= count()) return {};
+  if (m_showAll) return {m_input.at(i), i};
   return m_filtered[i].data;
 }
 
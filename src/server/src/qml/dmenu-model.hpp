@@ -1,10 +1,13 @@
 #pragma once
-#include "fuzzy/scored.hpp"
+#include "dmenu-input.hpp"
+#include "fuzzy/ranking.hpp"
 #include "generated/ipc-server.hpp"
 #include "section-source.hpp"
 #include <QCoreApplication>
 #include <cstddef>
 #include <functional>
+#include <optional>
+#include <string>
 #include <string_view>
 #include <vector>
 
@@ -12,15 +15,28 @@ class DMenuSection : public SectionSource {
   Q_DECLARE_TR_FUNCTIONS(DMenuSection)
 
 public:
-  void setRawEntries(std::vector<std::string_view> entries);
+  // Up to this many entries are filtered right away, more are filtered off the GUI thread: see `pending`.
+  static constexpr size_t SYNC_MATCH_LIMIT = 20000;
+
+  void appendEntries(std::string_view text);
   void setSectionTemplate(std::string_view tpl) { m_sectionTemplate = tpl; }
   void setNoSection(bool v) { m_noSection = v; }
   void setNoQuickLook(bool v) { m_noQuickLook = v; }
   void setOutputFormat(ipc_gen::DMenuOutputFormat format) { m_outputFormat = format; }
   void setFilter(std::string_view query) override;
 
+  const DMenuInput &input() const { return m_input; }
+  const std::string &query() const { return m_query; }
+  // The first entry still to be filtered by the current query, if any.
+  std::optional<size_t> pending() const;
+  // Buffers the matches of the entries from `pending()` up to `matchedUpTo`, until `applyIncoming`.
+  void addMatches(size_t matchedUpTo, std::vector<DMenuMatch> matches);
+  // Shows the entries appended and the matches added since the last call, right before the model is
+  // notified. Returns whether they replace the results of the previous query rather than extend them.
+  bool applyIncoming();
+
   QString sectionName() const override;
-  int count() const override { return static_cast<int>(m_filtered.size()); }
+  int count() const override { return static_cast<int>(m_showAll ? m_shown : m_filtered.size()); }
 
   void setOnEntryChosen(std::function<void(const QString &)> cb) { m_onEntryChosen = std::move(cb); }
   void setOnFileHighlighted(std::function<void(std::string_view)> cb) { m_onFileHighlighted = std::move(cb); }
@@ -34,14 +50,25 @@ protected:
   std::unique_ptr<ActionPanelState> actionPanel(int i) const override;
 
 private:
-  using IndexedData = std::pair<std::string_view, std::size_t>;
-
-  IndexedData entryAt(int i) const;
+  DMenuEntry entryAt(int i) const;
   QString expandSectionName(size_t count) const;
   void selectEntry(const QString &text) const;
 
-  std::vector<std::string_view> m_entries;
-  std::vector<Scored<IndexedData>> m_filtered;
+  DMenuInput m_input;
+  std::string m_query;
+  // ranked a page at a time as rows are shown, large inputs are never sorted as a whole
+  fuzzy::Ranking<DMenuMatch> m_filtered;
+  // without a query, all of the input is shown in order instead
+  bool m_showAll = true;
+  // entries of the input shown without a query
+  size_t m_shown = 0;
+  // matches not shown yet, see `applyIncoming`
+  std::vector<DMenuMatch> m_incoming;
+  bool m_hasIncoming = false;
+  // entries of the input filtered by the current query so far
+  size_t m_matched = 0;
+  // whether `m_filtered` still holds the matches of the previous query, until the first ones come in
+  bool m_stale = false;
   std::string_view m_sectionTemplate = "Entries ({count})";
   QString m_currentSearchText;
   bool m_noSection = false;
@@ -4,7 +4,7 @@
 #include "keyboard/keybind.hpp"
 #include "utils/utils.hpp"
 #include "view-utils.hpp"
-#include <ranges>
+#include <QtConcurrent/QtConcurrent>
 
 namespace fs = std::filesystem;
 
@@ -34,10 +34,18 @@ void DMenuViewHost::initialize() {
   setSearchPlaceholderText(m_data.placeholder ? QString::fromStdString(*m_data.placeholder)
                                               : tr("Search entries..."));
 
-  auto entries = std::views::split(m_data.rawContent, std::string_view("\n")) |
-                 std::views::transform([](auto &&s) { return std::string_view(s); }) |
-                 std::views::filter([](auto &&s) { return !s.empty(); }) | std::ranges::to<std::vector>();
-  m_section.setRawEntries(std::move(entries));
+  // the input keeps a copy of its own, in chunks
+  m_streaming = m_data.stream.value_or(false);
+  m_section.appendEntries(m_data.rawContent);
+  m_data.rawContent.clear();
+  m_data.rawContent.shrink_to_fit();
+
+  m_publishTimer.setSingleShot(true);
+  m_publishTimer.setInterval(PUBLISH_INTERVAL);
+  connect(&m_publishTimer, &QTimer::timeout, this, [this]() {
+    if (m_publishPending) publish();
+  });
+  connect(&m_matching, &Watcher::finished, this, &DMenuViewHost::handleMatches);
 
   auto onChosen = [this](const QString &text) {
     m_selected = true;
@@ -58,17 +66,96 @@ void DMenuViewHost::loadInitialData() {
   } else {
     model()->setFilter({});
   }
+  updateLoading();
 }
 
 void DMenuViewHost::textChanged(const QString &text) {
   clearDetail();
+  ++m_generation;
+  m_matching.cancel();
   model()->setFilter(text);
+  matchPending();
+}
+
+void DMenuViewHost::appendInput(std::string_view chunk, bool done) {
+  m_section.appendEntries(chunk);
+  if (done) m_streaming = false;
+
+  if (m_section.query().empty()) {
+    schedulePublish();
+  } else {
+    matchPending();
+  }
+  updateLoading();
 }
 
 void DMenuViewHost::beforePop() {
+  m_matching.cancel();
   if (!m_selected) { emit selected(""); }
 }
 
+void DMenuViewHost::matchPending() {
+  // picked up again once the running match is done
+  if (m_matching.isRunning()) return;
+
+  auto const pending = m_section.pending();
+
+  if (!pending) {
+    updateLoading();
+    return;
+  }
+
+  auto chunks = m_section.input().chunks(*pending, MATCH_BATCH);
+  const auto &last = chunks.back();
+
+  m_matchingUpTo = last->base + last->entries.size();
+  m_matchingGeneration = m_generation;
+
+  auto match = [query = m_section.query(), from = *pending](const DMenuInput::ChunkPtr &chunk) {
+    return matchChunk(*chunk, query, from);
+  };
+  auto merge = [](std::vector<DMenuMatch> &out, const std::vector<DMenuMatch> &matches) {
+    out.insert(out.end(), matches.begin(), matches.end());
+  };
+
+  // chunks are matched in parallel, and merged back in input order so that ties rank as they come
+  m_matching.setFuture(QtConcurrent::mappedReduced<std::vector<DMenuMatch>>(std::move(chunks), match, merge,
+                                                                            QtConcurrent::OrderedReduce));
+  updateLoading();
+}
+
+void DMenuViewHost::handleMatches() {
+  auto future = m_matching.future();
+
+  if (!future.isCanceled() && m_matchingGeneration == m_generation) {
+    m_section.addMatches(m_matchingUpTo, future.takeResult());
+    schedulePublish();
+  }
+
+  matchPending();
+}
+
+void DMenuViewHost::schedulePublish() {
+  if (m_publishTimer.isActive()) {
+    m_publishPending = true;
+    return;
+  }
+  publish();
+}
+
+void DMenuViewHost::publish() {
+  m_publishPending = false;
+  m_publishTimer.start();
+
+  if (m_section.applyIncoming()) {
+    m_section.notifyChanged();
+  } else {
+    m_section.notifyItemsRefreshed();
+  }
+}
+
+void DMenuViewHost::updateLoading() { setLoading(m_streaming || m_matching.isRunning()); }
+
 void DMenuViewHost::loadDetail(std::string_view path) {
   auto fspath = fs::path(path);
 
@@ -2,6 +2,9 @@
 #include "dmenu-model.hpp"
 #include "generated/ipc-server.hpp"
 #include "list-view-host.hpp"
+#include <QFutureWatcher>
+#include <QTimer>
+#include <chrono>
 #include <qmimedatabase.h>
 
 class DMenuViewHost : public ListViewHost {
@@ -28,6 +31,9 @@ public:
   void beforePop() override;
   bool showBackButton() const override { return false; }
 
+  // Adds the lines of `chunk` to a streamed input, `done` once the input is complete.
+  void appendInput(std::string_view chunk, bool done);
+
   bool hasDetail() const { return m_hasDetail; }
   QString detailName() const { return m_detailName; }
   QString detailPath() const { return m_detailPath; }
@@ -39,11 +45,32 @@ protected:
   std::unique_ptr<ActionPanelState> emptyActionPanel() override;
 
 private:
+  // a match run covers at most this many entries, so that results of large inputs show up progressively
+  static constexpr size_t MATCH_BATCH = 64 * DMenuInput::CHUNK_SIZE;
+  // how often the list is updated while input or matches come in
+  static constexpr auto PUBLISH_INTERVAL = std::chrono::milliseconds(100);
+
   void loadDetail(std::string_view path);
   void clearDetail();
+  void matchPending();
+  void handleMatches();
+  void schedulePublish();
+  void publish();
+  void updateLoading();
+
+  using Watcher = QFutureWatcher<std::vector<DMenuMatch>>;
 
   ipc_gen::DMenuRequest m_data;
   DMenuSection m_section;
+  Watcher m_matching;
+  // entries the running match covers, and the query it was started for
+  size_t m_matchingUpTo = 0;
+  uint64_t m_matchingGeneration = 0;
+  // bumped by every new query, outdating the running match
+  uint64_t m_generation = 0;
+  QTimer m_publishTimer;
+  bool m_publishPending = false;
+  bool m_streaming = false;
   QMimeDatabase m_mimeDb;
   bool m_selected = false;
 
@@ -253,14 +253,14 @@ std::unique_ptr<ActionPanelState> EmojiGridSource::actionPanel(int i) const {
 
 // --- SearchEmojiGridSource ---
 
-void SearchEmojiGridSource::setResults(std::span<Scored<const glyph::Item *>> results) {
+void SearchEmojiGridSource::setResults(const Results *results) {
   m_results = results;
   notifyChanged();
 }
 
 const glyph::Item *SearchEmojiGridSource::emojiAt(int i) const {
-  if (i < 0 || std::cmp_greater_equal(i, m_results.size())) return nullptr;
-  return m_results[i].data;
+  if (i < 0 || i >= count()) return nullptr;
+  return (*m_results)[i].data;
 }
 
 std::unique_ptr<ActionPanelState> SearchEmojiGridSource::actionPanel(int i) const {
@@ -412,17 +412,7 @@ void EmojiGridModel::rebuildSections() {
 void EmojiGridModel::setFilter(const QString &text) {
   m_displayMode = text.isEmpty() ? DisplayMode::Root : DisplayMode::Search;
 
-  if (!text.isEmpty()) {
-    auto results = m_glyphService->search(text.toStdString());
-    if (m_categoryFilter) {
-      m_searchResultsStorage.clear();
-      for (const auto &scored : results)
-        if (scored.data->category == *m_categoryFilter) m_searchResultsStorage.push_back(scored);
-      m_searchResults = m_searchResultsStorage;
-    } else {
-      m_searchResults = results;
-    }
-  }
+  if (!text.isEmpty()) { m_searchResults = &m_glyphService->search(text.toStdString(), m_categoryFilter); }
 
   setSelectFirstOnReset(true);
   rebuildSections();
@@ -28,21 +28,24 @@ private:
 
 class SearchEmojiGridSource : public GridSource {
 public:
-  void setResults(std::span<Scored<const glyph::Item *>> results);
+  using Results = FuzzyScorer<glyph::Item>::Results;
+
+  void setResults(const Results *results);
 
   void setSkinTone(std::optional<emoji::SkinTone> tone) { m_skinTone = tone; }
 
   QString sectionName() const override {
-    return QCoreApplication::translate("SearchEmojiGridSource", "Results (%1)").arg(m_results.size());
+    return QCoreApplication::translate("SearchEmojiGridSource", "Results (%1)").arg(count());
   }
-  int count() const override { return static_cast<int>(m_results.size()); }
+  int count() const override { return m_results ? static_cast<int>(m_results->size()) : 0; }
 
   const glyph::Item *emojiAt(int i) const;
 
   std::unique_ptr<ActionPanelState> actionPanel(int i) const override;
 
 private:
-  std::span<Scored<const glyph::Item *>> m_results;
+  // owned by the glyph service, ranked as rows are read
+  const Results *m_results = nullptr;
   std::optional<emoji::SkinTone> m_skinTone;
 };
 
@@ -86,6 +89,5 @@ private:
   std::vector<const glyph::Item *> m_recent;
   std::span<const glyph::Section> m_sections;
   std::unordered_map<const glyph::Item *, GlyphMetadata, GlyphItemHash> m_metadataCache;
-  std::vector<Scored<const glyph::Item *>> m_searchResultsStorage;
-  std::span<Scored<const glyph::Item *>> m_searchResults;
+  const SearchEmojiGridSource::Results *m_searchResults = nullptr;
 };
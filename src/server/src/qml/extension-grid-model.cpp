@@ -96,16 +96,29 @@ ExtensionGridModel::ExtensionGridModel(NotifyFn notify, QObject *parent)
 
 void ExtensionGridModel::setExtensionData(const GridModel &model, bool resetSelection) {
   m_model = model;
-  m_placeholder = QString::fromStdString(model.searchPlaceholderText);
+  applyModel(resetSelection);
+}
+
+bool ExtensionGridModel::applyPatch(const GridPatch &patch, bool resetSelection) {
+  auto items = std::move(m_model.items);
+  m_model = patch.root;
+  m_model.items = std::move(items);
+  bool const applied = render_patch::apply(m_model.items, patch.ops);
+  applyModel(resetSelection);
+  return applied;
+}
+
+void ExtensionGridModel::applyModel(bool resetSelection) {
+  m_placeholder = QString::fromStdString(m_model.searchPlaceholderText);
 
-  if (model.columns) { setColumns(*model.columns); }
-  if (model.aspectRatio > 0.0) { setAspectRatio(model.aspectRatio); }
-  if (m_fit != model.fit) {
-    m_fit = model.fit;
+  if (m_model.columns) { setColumns(*m_model.columns); }
+  if (m_model.aspectRatio > 0.0) { setAspectRatio(m_model.aspectRatio); }
+  if (m_fit != m_model.fit) {
+    m_fit = m_model.fit;
     emit fitChanged();
   }
 
-  double newInset = insetRatio(model.inset);
+  double newInset = insetRatio(m_model.inset);
   if (m_fit == ObjectFit::Fill) newInset = 0.0;
   setInset(newInset);
 
@@ -2,6 +2,7 @@
 #include "extend/grid-model.hpp"
 #include "image-url.hpp"
 #include "extension/extension-action-panel-builder.hpp"
+#include "fuzzy/ranking.hpp"
 #include "fuzzy/scored.hpp"
 #include "grid-source.hpp"
 #include "section-grid-model.hpp"
@@ -39,7 +40,7 @@ public:
 private:
   std::string m_name;
   std::vector<GridItemViewModel> m_items;
-  std::vector<Scored<int>> m_filtered;
+  fuzzy::Ranking<Scored<int>> m_filtered;
   std::optional<int> m_columns;
   std::optional<double> m_aspectRatio;
   std::optional<GridInset> m_inset;
@@ -64,6 +65,9 @@ public:
   explicit ExtensionGridModel(NotifyFn notify, QObject *parent = nullptr);
 
   void setExtensionData(const GridModel &model, bool resetSelection = true);
+  // Applies an incremental render to the items of the last one. False when some steps did not fit the
+  // current items.
+  bool applyPatch(const GridPatch &patch, bool resetSelection);
   void setFilter(const QString &text);
   QString searchPlaceholder() const;
   QUrl qmlComponentUrl() const { return QUrl(QStringLiteral("qrc:/Vicinae/ExtensionGridView.qml")); }
@@ -90,6 +94,7 @@ protected:
 
 private:
   const GridItemViewModel *resolveItem(int section, int item) const;
+  void applyModel(bool resetSelection);
   void rebuildFromSections(bool resetSelection);
 
   NotifyFn m_notify;
@@ -25,9 +25,10 @@ template <> struct fuzzy::FuzzySearchable<ListItemViewModel> {
 
 ExtensionListSection::ExtensionListSection(std::string name, std::vector<ListItemViewModel> items,
                                            bool filtering, NotifyFn notify,
-                                           const std::optional<ActionPannelModel> *globalActions)
+                                           const std::optional<ActionPannelModel> *globalActions,
+                                           uint64_t key)
     : m_name(std::move(name)), m_items(std::move(items)), m_filtering(filtering), m_notify(std::move(notify)),
-      m_globalActions(globalActions) {}
+      m_globalActions(globalActions), m_key(key) {}
 
 int ExtensionListSection::count() const {
   if (m_filtering && !m_query.empty()) return static_cast<int>(m_filtered.size());
@@ -51,6 +52,10 @@ void ExtensionListSection::onSelected(int i) {
 
 QString ExtensionListSection::itemId(int i) const { return QString::fromStdString(itemAt(i).id); }
 
+uint64_t ExtensionListSection::itemKey(int i) const { return itemAt(i).key; }
+
+bool ExtensionListSection::itemChanged(int i) const { return itemAt(i).changed; }
+
 QString ExtensionListSection::itemTitle(int i) const { return QString::fromStdString(itemAt(i).title); }
 
 QString ExtensionListSection::itemSubtitle(int i) const { return QString::fromStdString(itemAt(i).subtitle); }
@@ -99,7 +104,21 @@ ExtensionListModel::ExtensionListModel(NotifyFn notify, QObject *parent)
 void ExtensionListModel::setExtensionData(const ListModel &model, bool resetSelection) {
   bool const wasShowingDetail = m_model.isShowingDetail;
   m_model = model;
-  m_placeholder = QString::fromStdString(model.searchPlaceholderText);
+  rebuildSections(wasShowingDetail, resetSelection);
+}
+
+bool ExtensionListModel::applyPatch(const ListPatch &patch, bool resetSelection) {
+  bool const wasShowingDetail = m_model.isShowingDetail;
+  auto items = std::move(m_model.items);
+  m_model = patch.root;
+  m_model.items = std::move(items);
+  bool const applied = render_patch::apply(m_model.items, patch.ops);
+  rebuildSections(wasShowingDetail, resetSelection);
+  return applied;
+}
+
+void ExtensionListModel::rebuildSections(bool wasShowingDetail, bool resetSelection) {
+  m_placeholder = QString::fromStdString(m_model.searchPlaceholderText);
 
   clearSources();
   m_ownedSections.clear();
@@ -110,7 +129,7 @@ void ExtensionListModel::setExtensionData(const ListModel &model, bool resetSele
   auto flushFree = [&]() {
     if (freeBuf.empty()) return;
     auto section = std::make_unique<ExtensionListSection>(std::move(freeItems), std::move(freeBuf),
-                                                          model.filtering, m_notify, &m_model.actions);
+                                                          m_model.filtering, m_notify, &m_model.actions);
     section->setOnItemSelected([this](const ListItemViewModel *item) { handleItemSelected(item); });
     addSource(section.get());
     m_ownedSections.push_back(std::move(section));
@@ -118,16 +137,21 @@ void ExtensionListModel::setExtensionData(const ListModel &model, bool resetSele
     freeItems = {};
   };
 
-  for (const auto &child : model.items) {
+  // the sections get the changes of this render, the items kept for the next one do not
+  for (auto &child : m_model.items) {
     if (auto item = std::get_if<ListItemViewModel>(&child)) {
       freeBuf.push_back(*item);
+      item->changed = false;
     } else if (auto sec = std::get_if<ListSectionModel>(&child)) {
       flushFree();
-      auto section = std::make_unique<ExtensionListSection>(sec->title, sec->children, model.filtering,
-                                                            m_notify, &m_model.actions);
+      auto section = std::make_unique<ExtensionListSection>(sec->title, sec->children, m_model.filtering,
+                                                            m_notify, &m_model.actions, sec->key);
       section->setOnItemSelected([this](const ListItemViewModel *item) { handleItemSelected(item); });
       addSource(section.get());
       m_ownedSections.push_back(std::move(section));
+      for (auto &item : sec->children) {
+        item.changed = false;
+      }
     }
   }
   flushFree();
@@ -2,6 +2,7 @@
 #include "extend/list-model.hpp"
 #include "image-url.hpp"
 #include "extension/extension-action-panel-builder.hpp"
+#include "fuzzy/ranking.hpp"
 #include "fuzzy/scored.hpp"
 #include "section-list-model.hpp"
 #include "section-source.hpp"
@@ -15,9 +16,11 @@ public:
   using NotifyFn = ExtensionActionPanelBuilder::NotifyFn;
 
   ExtensionListSection(std::string name, std::vector<ListItemViewModel> items, bool filtering,
-                       NotifyFn notify, const std::optional<ActionPannelModel> *globalActions);
+                       NotifyFn notify, const std::optional<ActionPannelModel> *globalActions,
+                       uint64_t key = 0);
 
   QString sectionName() const override { return QString::fromStdString(m_name); }
+  uint64_t sectionKey() const override { return m_key; }
   int count() const override;
   void setFilter(std::string_view query) override;
 
@@ -30,6 +33,8 @@ public:
 
 protected:
   QString itemId(int i) const override;
+  uint64_t itemKey(int i) const override;
+  bool itemChanged(int i) const override;
   QString itemTitle(int i) const override;
   QString itemSubtitle(int i) const override;
   std::optional<ImageURL> itemIcon(int i) const override;
@@ -41,11 +46,12 @@ protected:
 private:
   std::string m_name;
   std::vector<ListItemViewModel> m_items;
-  std::vector<Scored<int>> m_filtered;
+  fuzzy::Ranking<Scored<int>> m_filtered;
   bool m_filtering;
   std::string m_query;
   NotifyFn m_notify;
   const std::optional<ActionPannelModel> *m_globalActions;
+  uint64_t m_key;
   std::function<void(const ListItemViewModel *)> m_onItemSelected;
 };
 
@@ -64,6 +70,9 @@ public:
   explicit ExtensionListModel(NotifyFn notify, QObject *parent = nullptr);
 
   void setExtensionData(const ListModel &model, bool resetSelection);
+  // Applies an incremental render to the items of the last one, rows only move or change where they did.
+  // False when some steps did not fit the current items.
+  bool applyPatch(const ListPatch &patch, bool resetSelection);
   void setFilter(const QString &text);
 
   QString searchPlaceholder() const;
@@ -85,6 +94,7 @@ protected:
   void onSelectionCleared() override;
 
 private:
+  void rebuildSections(bool wasShowingDetail, bool resetSelection);
   void handleItemSelected(const ListItemViewModel *item);
   void refreshCurrentDetail();
   void setCurrentDetail(const DetailModel *detail);
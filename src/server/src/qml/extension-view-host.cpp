@@ -69,7 +69,7 @@ void ExtensionViewHost::setActions(std::unique_ptr<ActionPanelState> actions) {
   BaseView::setActions(static_cast<ActionPanelView *>(view));
 }
 
-void ExtensionViewHost::render(const RenderModel &model) {
+bool ExtensionViewHost::render(const RenderModel &model) {
   bool const wasFirstRender = m_firstRender;
 
   auto needsSwitch = [&]() -> bool {
@@ -78,20 +78,35 @@ void ExtensionViewHost::render(const RenderModel &model) {
     if (std::holds_alternative<GridModel>(model)) return !activeModel<ExtensionGridModel>();
     if (std::holds_alternative<RootDetailModel>(model)) return !std::holds_alternative<DetailState>(m_model);
     if (std::holds_alternative<FormModel>(model)) return !activeModel<ExtensionFormModel>();
+    if (std::holds_alternative<ListPatch>(model)) return !activeModel<ExtensionListModel>();
+    if (std::holds_alternative<GridPatch>(model)) return !activeModel<ExtensionGridModel>();
     return false;
   };
 
+  bool const isPatch = std::holds_alternative<ListPatch>(model) || std::holds_alternative<GridPatch>(model);
+
+  // a patch only ever follows a full render of the same root
+  if (isPatch && needsSwitch()) {
+    qWarning() << "Extension sent a patch for a view it did not render";
+    return false;
+  }
+
   if (needsSwitch()) {
     m_firstRender = false;
     switchViewType(model);
   }
 
   QString currentText = searchText();
+  bool applied = true;
 
   if (auto *listModel = std::get_if<ListModel>(&model)) {
     renderList(*listModel);
   } else if (auto *gridModel = std::get_if<GridModel>(&model)) {
     renderGrid(*gridModel);
+  } else if (auto *listPatch = std::get_if<ListPatch>(&model)) {
+    applied = renderList(listPatch->root, listPatch);
+  } else if (auto *gridPatch = std::get_if<GridPatch>(&model)) {
+    applied = renderGrid(gridPatch->root, gridPatch);
   } else if (auto *detailModel = std::get_if<RootDetailModel>(&model)) {
     renderDetail(*detailModel);
   } else if (auto *formModel = std::get_if<FormModel>(&model)) {
@@ -108,6 +123,8 @@ void ExtensionViewHost::render(const RenderModel &model) {
     setSearchText(currentText);
     ++m_searchEventCount;
   }
+
+  return applied;
 }
 
 void ExtensionViewHost::switchViewType(const RenderModel &model) {
@@ -141,7 +158,7 @@ void ExtensionViewHost::switchViewType(const RenderModel &model) {
   emit viewTypeChanged();
 }
 
-void ExtensionViewHost::renderList(const ListModel &model) {
+bool ExtensionViewHost::renderList(const ListModel &model, const ListPatch *patch) {
   auto *list = activeModel<ExtensionListModel>();
   m_onSearchTextChange = model.onSearchTextChange;
   m_filtering = model.filtering;
@@ -174,14 +191,22 @@ void ExtensionViewHost::renderList(const ListModel &model) {
 
   emit paginationChanged();
 
+  bool applied = true;
+
   if (model.dirty) {
     m_selectFirstOnReset = m_shouldResetSelection;
     emit selectFirstOnResetChanged();
-    list->setExtensionData(model, m_shouldResetSelection);
+    if (patch) {
+      applied = list->applyPatch(*patch, m_shouldResetSelection);
+    } else {
+      list->setExtensionData(model, m_shouldResetSelection);
+    }
     m_selectFirstOnReset = true;
     emit selectFirstOnResetChanged();
     m_shouldResetSelection = false;
   }
+
+  return applied;
 }
 
 void ExtensionViewHost::onLoadMore() {
@@ -191,7 +216,7 @@ void ExtensionViewHost::onLoadMore() {
   }
 }
 
-void ExtensionViewHost::renderGrid(const GridModel &model) {
+bool ExtensionViewHost::renderGrid(const GridModel &model, const GridPatch *patch) {
   auto *grid = activeModel<ExtensionGridModel>();
   m_onSearchTextChange = model.onSearchTextChange;
   m_filtering = model.filtering;
@@ -224,10 +249,18 @@ void ExtensionViewHost::renderGrid(const GridModel &model) {
 
   emit paginationChanged();
 
+  bool applied = true;
+
   if (model.dirty) {
-    grid->setExtensionData(model, m_shouldResetSelection);
+    if (patch) {
+      applied = grid->applyPatch(*patch, m_shouldResetSelection);
+    } else {
+      grid->setExtensionData(model, m_shouldResetSelection);
+    }
     m_shouldResetSelection = false;
   }
+
+  return applied;
 }
 
 void ExtensionViewHost::textChanged(const QString &text) {
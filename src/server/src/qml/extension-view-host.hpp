@@ -36,7 +36,8 @@ public:
   void loadInitialData() override;
   void onReactivated() override;
 
-  void render(const RenderModel &model);
+  // False when `model` is a patch that does not apply to what is shown, the view is to be sent whole again.
+  bool render(const RenderModel &model);
   void setActions(std::unique_ptr<ActionPanelState> actions) override;
 
   void textChanged(const QString &text) override;
@@ -84,8 +85,10 @@ private:
                                  ExtensionFormModel *, DetailState>;
 
   void switchViewType(const RenderModel &model);
-  void renderList(const ListModel &model);
-  void renderGrid(const GridModel &model);
+  // `model` holds the props of the root alone when rendering a patch
+  // false when the patch did not apply
+  bool renderList(const ListModel &model, const ListPatch *patch = nullptr);
+  bool renderGrid(const GridModel &model, const GridPatch *patch = nullptr);
   void renderDetail(const RootDetailModel &model);
   void renderForm(const FormModel &model);
   void notifyExtension(const QString &handler, const QJsonArray &args);
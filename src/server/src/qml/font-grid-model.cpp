@@ -72,7 +72,7 @@ void FontGridSource::setBucket(QString name, std::vector<const FontFamily *> fam
   m_search = false;
 }
 
-void FontGridSource::setResults(QString name, std::span<Scored<const FontFamily *>> results) {
+void FontGridSource::setResults(QString name, const FuzzyScorer<FontFamily>::Results *results) {
   m_name = std::move(name);
   m_results = results;
   m_search = true;
@@ -140,12 +140,12 @@ void FontGridModel::setFilter(const QString &text) {
   } else {
     m_mode = Mode::Search;
     const auto &all = m_fontService->fontFamilies();
-    auto results = m_scorer.score(std::span<const FontFamily>(all), text.toStdString(),
+    const auto &results = m_scorer.score(std::span<const FontFamily>(all), text.toStdString(),
                                   [this](const FontFamily &f, const fuzzy::Query &query) -> fuzzy::Match {
                                     if (m_categoryFilter && !f.has(*m_categoryFilter)) return {};
                                     return fuzzy::scoreWeighted({{f.name.toStdString(), 1.0}}, query);
                                   });
-    m_searchSource.setResults(tr("Results (%1)").arg(results.size()), results);
+    m_searchSource.setResults(tr("Results (%1)").arg(results.size()), &results);
   }
   applyReset();
 }
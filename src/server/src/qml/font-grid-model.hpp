@@ -13,16 +13,16 @@
 class FontGridSource : public GridSource {
 public:
   void setBucket(QString name, std::vector<const FontFamily *> families);
-  void setResults(QString name, std::span<Scored<const FontFamily *>> results);
+  void setResults(QString name, const FuzzyScorer<FontFamily>::Results *results);
 
   QString sectionName() const override { return m_name; }
   int count() const override {
-    return m_search ? static_cast<int>(m_results.size()) : static_cast<int>(m_families.size());
+    return m_search ? static_cast<int>(m_results->size()) : static_cast<int>(m_families.size());
   }
 
   const FontFamily *familyAt(int i) const {
     if (i < 0 || i >= count()) return nullptr;
-    return m_search ? m_results[i].data : m_families[i];
+    return m_search ? (*m_results)[i].data : m_families[i];
   }
 
   std::unique_ptr<ActionPanelState> actionPanel(int i) const override;
@@ -31,7 +31,8 @@ private:
   QString m_name;
   bool m_search = false;
   std::vector<const FontFamily *> m_families;
-  std::span<Scored<const FontFamily *>> m_results;
+  // owned by the model's scorer, ranked as rows are read
+  const FuzzyScorer<FontFamily>::Results *m_results = nullptr;
 };
 
 class FontGridModel : public SectionGridModel {
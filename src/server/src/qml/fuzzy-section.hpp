@@ -40,7 +40,7 @@ protected:
   virtual std::unique_ptr<ActionPanelState> buildActionPanel(const T &item) const = 0;
 
   std::vector<T> m_items;
-  std::vector<Scored<int>> m_filtered;
+  fuzzy::Ranking<Scored<int>> m_filtered;
   std::string m_query;
 
 private:
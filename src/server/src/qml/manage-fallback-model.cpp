@@ -9,8 +9,7 @@ void EnabledFallbackSection::sortFiltered() {
     return std::distance(m_fallbacks.begin(), std::ranges::find(m_fallbacks, m_items[scored.data]));
   };
 
-  std::ranges::stable_sort(m_filtered,
-                           [&](const auto &a, const auto &b) { return fallbackPos(a) < fallbackPos(b); });
+  m_filtered.sortBy([&](const auto &a, const auto &b) { return fallbackPos(a) < fallbackPos(b); });
 }
 
 QString EnabledFallbackSection::displayTitle(const RootItemPtr &item) const { return item->title(); }
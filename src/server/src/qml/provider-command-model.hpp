@@ -64,7 +64,7 @@ private:
 
   std::vector<Command> m_allCommands;
   std::vector<int> m_visibleIndices;
-  std::vector<Scored<int>> m_scored;
+  fuzzy::Ranking<Scored<int>> m_scored;
   QString m_filter;
 };
 
@@ -0,0 +1,31 @@
+#include "root-search-executor.hpp"
+
+uint64_t RootSearchExecutor::next() {
+  auto const generation = ++*m_generation;
+
+  for (auto &run : m_abortable) {
+    if (run.running && *run.running) run.abort();
+    run = {};
+  }
+
+  return generation;
+}
+
+QThreadPool *RootSearchExecutor::lane(Source source) {
+  // A single thread per source: runs of a source never overlap, and a lookup stuck on a dead mount holds up
+  // no other source. Never destroyed, as that would wait for it.
+  static auto *const lanes = [] {
+    auto *pools = new std::array<QThreadPool, SOURCE_COUNT>;
+    for (auto &pool : *pools) {
+      pool.setMaxThreadCount(1);
+    }
+    return pools;
+  }();
+
+  return &(*lanes)[index(source)];
+}
+
+void RootSearchExecutor::report(Source source, std::chrono::microseconds elapsed, bool applied) {
+  m_timings[index(source)] = elapsed;
+  emit sourceTimed(source, elapsed, applied);
+}
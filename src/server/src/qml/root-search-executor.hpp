@@ -0,0 +1,130 @@
+#pragma once
+#include <QFuture>
+#include <QObject>
+#include <QThreadPool>
+#include <QtConcurrent>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <optional>
+
+/**
+ * Runs the sources of a root search that can block (path lookups, the calculator, the file index) off the
+ * GUI thread. Every keystroke starts a new generation, and a source finishing after that has its result
+ * dropped rather than applied, so that a slow source can neither stall typing nor overwrite newer results.
+ * Each run is timed, see `sourceTimed`.
+ */
+class RootSearchExecutor : public QObject {
+  Q_OBJECT
+
+public:
+  enum class Source { Items, Path, Calculator, Files };
+  Q_ENUM(Source)
+
+  static constexpr size_t SOURCE_COUNT = 4;
+
+  explicit RootSearchExecutor(QObject *parent = nullptr) : QObject(parent) {}
+
+  // Starts a new generation, outdating whatever is still running and aborting the runs that can be.
+  uint64_t next();
+
+  // How long the last run of `source` took, whether it was applied or not.
+  std::chrono::microseconds lastTiming(Source source) const { return m_timings[index(source)]; }
+
+  // Times a source that runs on the calling thread.
+  template <typename F> void timed(Source source, F &&fn) {
+    auto const start = Clock::now();
+    std::forward<F>(fn)();
+    report(source, since(start), true);
+  }
+
+  /**
+   * Runs `job` on the lane of `source` and hands its result to `apply` on the thread of the executor,
+   * unless a new generation started in the meantime. Runs still waiting for their lane when outdated
+   * are skipped.
+   */
+  template <typename T> void run(Source source, std::function<T()> job, std::function<void(T)> apply) {
+    run<T>(source, lane(source), std::move(job), std::move(apply));
+  }
+
+  /**
+   * Same as above, on a lane owned by someone else (see CalculatorService::lane). `abort` is called on the
+   * thread of the executor when a new generation starts while `job` is still running.
+   */
+  template <typename T>
+  void run(Source source, QThreadPool *pool, std::function<T()> job, std::function<void(T)> apply,
+           std::function<void()> abort = {}) {
+    auto const generation = m_generation->load();
+    auto running = std::make_shared<std::atomic<bool>>(false);
+
+    if (abort) m_abortable[index(source)] = {.running = running, .abort = std::move(abort)};
+
+    auto future = QtConcurrent::run(
+        pool, [job = std::move(job), current = m_generation, generation, running = std::move(running)]() {
+          Outcome<T> outcome;
+          if (*current != generation) return outcome;
+
+          auto const start = Clock::now();
+          running->store(true);
+          outcome.value = job();
+          running->store(false);
+          outcome.elapsed = since(start);
+          return outcome;
+        });
+
+    future.then(this, [this, source, generation, apply = std::move(apply)](Outcome<T> outcome) {
+      if (!outcome.value) return;
+      bool const current = generation == *m_generation;
+      report(source, outcome.elapsed, current);
+      if (current) apply(std::move(*outcome.value));
+    });
+  }
+
+  // Same as `run`, for work that is asynchronous already.
+  template <typename T> void watch(Source source, QFuture<T> future, std::function<void(T)> apply) {
+    auto const generation = m_generation->load();
+    auto const start = Clock::now();
+
+    future.then(this, [this, source, generation, start, apply = std::move(apply)](T value) {
+      bool const current = generation == *m_generation;
+      report(source, since(start), current);
+      if (current) apply(std::move(value));
+    });
+  }
+
+signals:
+  void sourceTimed(RootSearchExecutor::Source source, std::chrono::microseconds elapsed, bool applied);
+
+private:
+  using Clock = std::chrono::steady_clock;
+
+  struct Abortable {
+    std::shared_ptr<std::atomic<bool>> running;
+    std::function<void()> abort;
+  };
+
+  template <typename T> struct Outcome {
+    // empty when skipped
+    std::optional<T> value;
+    std::chrono::microseconds elapsed{};
+  };
+
+  static size_t index(Source source) { return static_cast<size_t>(source); }
+
+  static std::chrono::microseconds since(Clock::time_point start) {
+    return std::chrono::duration_cast<std::chrono::microseconds>(Clock::now() - start);
+  }
+
+  static QThreadPool *lane(Source source);
+
+  void report(Source source, std::chrono::microseconds elapsed, bool applied);
+
+  // read by the lanes to skip outdated runs, and shared with them as they may outlive the executor
+  std::shared_ptr<std::atomic<uint64_t>> m_generation = std::make_shared<std::atomic<uint64_t>>(0);
+  std::array<std::chrono::microseconds, SOURCE_COUNT> m_timings{};
+  // the last run of each source, if it can be aborted
+  std::array<Abortable, SOURCE_COUNT> m_abortable{};
+};
@@ -27,7 +27,6 @@ RootSearchModel::RootSearchModel(const ViewScope &scope, QObject *parent)
   m_fileSearchDebounce.setSingleShot(true);
 
   connect(&m_fileSearchDebounce, &QTimer::timeout, this, &RootSearchModel::startFileSearch);
-  connect(&m_fileWatcher, &FileSearchWatcher::finished, this, &RootSearchModel::handleFileSearchFinished);
 
   connect(m_config, &config::Manager::configChanged, this,
           [this](const config::ConfigValue &next, const config::ConfigValue &) {
@@ -71,11 +70,20 @@ void RootSearchModel::setFilter(const QString &text) {
   setSelectFirstOnReset(true);
   scope().clearActions();
 
+  m_executor.next();
+  m_pathMatch = false;
   m_calcSource->setResult({});
   m_filesSource->setFiles({});
   m_fileSearchDebounce.stop();
 
-  bool const directMatch = rerunSearch();
+  rerunSearch();
+
+  // a link is the only result, nothing else needs to run
+  if (m_query.empty() || m_linkSource->count() > 0) return;
+
+  startPathLookup();
+  startCalculator();
+  m_fileSearchDebounce.start();
 }
 
 void RootSearchModel::refresh() {
@@ -86,23 +94,21 @@ void RootSearchModel::refresh() {
   refreshActionPanel();
 }
 
-bool RootSearchModel::rerunSearch() {
+void RootSearchModel::rerunSearch() {
   auto text = QString::fromStdString(m_query);
 
-  if (!text.isEmpty() && text.startsWith('/')) {
-    std::error_code ec;
-    if (std::filesystem::exists(m_query, ec)) {
-      m_updateSource->setUpdate({});
-      m_linkSource->setLink({});
-      m_resultsSource->setItems({});
-      m_resultsSource->setQueryEmpty(false);
-      m_filesSource->setFiles({{std::filesystem::path(m_query), 1.0}});
-      m_newsSource->setItems({});
-      m_favoritesSource->setItems({});
-      m_fallbackSource->setItems({});
-      rebuild();
-      return true;
-    }
+  if (m_pathMatch) {
+    m_updateSource->setUpdate({});
+    m_linkSource->setLink({});
+    m_calcSource->setResult({});
+    m_resultsSource->setItems({});
+    m_resultsSource->setQueryEmpty(false);
+    m_filesSource->setFiles({{std::filesystem::path(m_query), 1.0}});
+    m_newsSource->setItems({});
+    m_favoritesSource->setItems({});
+    m_fallbackSource->setItems({});
+    rebuild();
+    return;
   }
 
   if (!text.isEmpty()) {
@@ -115,7 +121,7 @@ bool RootSearchModel::rerunSearch() {
         m_newsSource->setItems({});
         m_favoritesSource->setItems({});
         rebuild();
-        return true;
+        return;
       }
     }
   }
@@ -124,15 +130,22 @@ bool RootSearchModel::rerunSearch() {
   m_resultsSource->setQueryEmpty(m_query.empty());
   m_fallbackSource->setQuery(m_query);
 
+  // root items are searched right here: they are in memory, and only ever changed on this thread
   std::vector<RootItemManager::ScoredItem> scored;
+  m_executor.timed(RootSearchExecutor::Source::Items, [&]() {
+    if (m_query.empty()) {
+      m_manager->search("", scored, {.includeFavorites = false, .prioritizeAliased = false});
+    } else {
+      m_manager->search(text, scored);
+    }
+  });
+
   if (m_query.empty()) {
-    m_manager->search("", scored, {.includeFavorites = false, .prioritizeAliased = false});
     m_updateSource->setUpdate(m_updateService->available());
     m_newsSource->setItems(m_newsService->activeItems());
     m_favoritesSource->setItems(m_manager->queryFavorites());
     m_fallbackSource->setItems({});
   } else {
-    m_manager->search(text, scored);
     m_updateSource->setUpdate({});
     m_newsSource->setItems({});
     m_favoritesSource->setItems({});
@@ -148,25 +161,52 @@ bool RootSearchModel::rerunSearch() {
     });
   }
 
-  bool inhibitCalculator = !results.empty();
-
   m_resultsSource->setItems(std::move(results));
 
-  if (!text.isEmpty()) {
-    if (text.startsWith("=")) {
-      if (auto res = m_calculator->backend()->compute(QString::fromStdString(m_query.substr(1)), {})) {
-        m_calcSource->setResult(res.value());
-      }
-    } else if (!inhibitCalculator && m_query.size() >= CALCULATOR_MIN_CHARS) {
-      if (auto res = m_calculator->backend()->compute(QString::fromStdString(m_query), {})) {
-        m_calcSource->setResult(res.value());
-      }
-    }
-    m_fileSearchDebounce.start();
+  rebuild();
+}
+
+void RootSearchModel::startPathLookup() {
+  if (!m_query.starts_with('/')) return;
+
+  m_executor.run<bool>(
+      RootSearchExecutor::Source::Path,
+      [path = m_query]() {
+        std::error_code ec;
+        return std::filesystem::exists(path, ec);
+      },
+      [this](bool exists) {
+        if (!exists) return;
+        m_pathMatch = true;
+        m_fileSearchDebounce.stop();
+        rerunSearch();
+        refreshActionPanel();
+      });
+}
+
+void RootSearchModel::startCalculator() {
+  QString question;
+
+  if (m_query.starts_with('=')) {
+    question = QString::fromStdString(m_query.substr(1));
+  } else if (m_resultsSource->count() == 0 && m_query.size() >= CALCULATOR_MIN_CHARS) {
+    question = QString::fromStdString(m_query);
+  } else {
+    return;
   }
 
-  rebuild();
-  return false;
+  // on the calculator lane, which every other computation goes through as well
+  m_executor.run<AbstractCalculatorBackend::ComputeResult>(
+      RootSearchExecutor::Source::Calculator, CalculatorService::lane(),
+      [calculator = m_calculator, question]() { return calculator->backend()->compute(question, {}); },
+      [this](AbstractCalculatorBackend::ComputeResult result) {
+        if (m_pathMatch || !result) return;
+        m_calcSource->setResult(std::move(result).value());
+        // shown on top of the results, as if it had been computed along with them
+        rebuild();
+        refreshActionPanel();
+      },
+      [calculator = m_calculator]() { calculator->backend()->abort(); });
 }
 
 void RootSearchModel::setSelectedIndex(int index) {
@@ -218,17 +258,17 @@ const RootItem *RootSearchModel::selectedRootItem() const {
 }
 
 void RootSearchModel::startFileSearch() {
-  if (!m_fileSearchEnabled || m_query.size() < MIN_FS_TEXT_LENGTH) return;
-  if (m_fileWatcher.isRunning()) { m_fileWatcher.cancel(); }
-  m_fileSearchQuery = m_query;
-  m_fileWatcher.setFuture(m_fileService->queryAsync(m_query));
+  if (!m_fileSearchEnabled || m_pathMatch || m_query.size() < MIN_FS_TEXT_LENGTH) return;
+
+  m_executor.watch<std::vector<IndexerFileResult>>(
+      RootSearchExecutor::Source::Files, m_fileService->queryAsync(m_query, {.session = "root-search"}),
+      [this](std::vector<IndexerFileResult> files) {
+        m_filesSource->setFiles(std::move(files));
+        applyLateResult();
+      });
 }
 
-void RootSearchModel::handleFileSearchFinished() {
-  if (!m_fileWatcher.isFinished() || m_fileSearchQuery != m_query) return;
-  m_filesSource->setFiles(m_fileWatcher.result());
-  m_fileSearchQuery.clear();
-
+void RootSearchModel::applyLateResult() {
   auto saved = selectFirstOnReset();
   setSelectFirstOnReset(false);
   rebuild();
@@ -1,9 +1,9 @@
 #pragma once
+#include "root-search-executor.hpp"
 #include "root-search-sources.hpp"
 #include "section-list-model.hpp"
 #include "services/calculator-service/abstract-calculator-backend.hpp"
 #include "services/files-service/abstract-file-indexer.hpp"
-#include <QFutureWatcher>
 #include <QTimer>
 #include <string>
 
@@ -20,9 +20,6 @@ class RootSearchModel : public SectionListModel {
   Q_OBJECT
 
 public:
-  using CalculatorWatcher = QFutureWatcher<AbstractCalculatorBackend::ComputeResult>;
-  using FileSearchWatcher = QFutureWatcher<std::vector<IndexerFileResult>>;
-
   explicit RootSearchModel(const ViewScope &scope, QObject *parent = nullptr);
 
   Q_INVOKABLE void setFilter(const QString &text);
@@ -30,12 +27,16 @@ public:
 
   const RootItem *selectedRootItem() const;
 
+  // per source timings of the searches, see RootSearchExecutor
+  const RootSearchExecutor &executor() const { return m_executor; }
+
 private:
   void refresh();
-  bool rerunSearch();
+  void rerunSearch();
+  void startPathLookup();
   void startCalculator();
   void startFileSearch();
-  void handleFileSearchFinished();
+  void applyLateResult();
 
   static constexpr int MIN_FS_TEXT_LENGTH = 3;
 
@@ -59,9 +60,9 @@ private:
   std::string m_query;
   QString m_lastCompleterItemId;
 
+  RootSearchExecutor m_executor;
   QTimer m_fileSearchDebounce;
-  FileSearchWatcher m_fileWatcher;
-  std::string m_calculatorSearchQuery;
-  std::string m_fileSearchQuery;
+  // the query is the path of an existing file, which is then the only result
+  bool m_pathMatch = false;
   bool m_fileSearchEnabled = false;
 };
@@ -127,7 +127,8 @@ void SearchFilesViewHost::handleDebounce() {
   m_lastSearchText = query;
   m_resultMode = ResultMode::IndexedSearch;
   setLoading(true);
-  m_pendingResults.setFuture(fileService->queryAsync(query.toStdString(), {.category = selectedCategory()}));
+  m_pendingResults.setFuture(fileService->queryAsync(
+      query.toStdString(), {.category = selectedCategory(), .session = "search-files"}));
 }
 
 void SearchFilesViewHost::handleSearchResults() {
@@ -1,3 +1,6 @@
+#include <algorithm>
+#include <unordered_map>
+#include <unordered_set>
 #include <utility>
 
 #include "drag-utils.hpp"
@@ -5,6 +8,33 @@
 #include "services/navigation/list-navigation.hpp"
 #include "view-utils.hpp"
 
+namespace {
+
+// Which of `values` make up a longest increasing subsequence of them.
+std::vector<bool> longestIncreasing(const std::vector<int> &values) {
+  // position of the smallest last value of an increasing subsequence of every length
+  std::vector<int> tails;
+  std::vector<int> previous(values.size(), -1);
+
+  for (int i = 0; std::cmp_less(i, values.size()); ++i) {
+    auto it = std::ranges::lower_bound(tails, values[i], {}, [&](int pos) { return values[pos]; });
+    if (it != tails.begin()) previous[i] = *std::prev(it);
+    if (it == tails.end()) {
+      tails.push_back(i);
+    } else {
+      *it = i;
+    }
+  }
+
+  std::vector<bool> member(values.size(), false);
+  for (int i = tails.empty() ? -1 : tails.back(); i != -1; i = previous[i]) {
+    member[i] = true;
+  }
+  return member;
+}
+
+} // namespace
+
 SectionListModel::SectionListModel(QObject *parent) : QAbstractListModel(parent) {
   connect(&ThemeService::instance(), &ThemeService::themeChanged, this, [this]() {
     if (rowCount() > 0) emit dataChanged(index(0), index(rowCount() - 1), {IconSource});
@@ -302,11 +332,13 @@ void SectionListModel::rebuildFlatList() {
 
     auto name = source->sectionName();
     if (!name.isEmpty()) {
-      newFlat.push_back({.kind = FlatItem::SectionHeader, .sourceIdx = s, .itemIdx = -1});
+      newFlat.push_back(
+          {.kind = FlatItem::SectionHeader, .sourceIdx = s, .itemIdx = -1, .key = source->sectionKey()});
     }
 
     for (int i = 0; i < itemCount; ++i) {
-      newFlat.push_back({.kind = FlatItem::DataItem, .sourceIdx = s, .itemIdx = i});
+      newFlat.push_back(
+          {.kind = FlatItem::DataItem, .sourceIdx = s, .itemIdx = i, .key = source->itemKey(i)});
     }
   }
 
@@ -322,22 +354,24 @@ void SectionListModel::rebuildFlatList() {
     return;
   }
 
-  if (newCount < oldCount) {
-    beginRemoveRows({}, newCount, oldCount - 1);
-    m_flat = std::move(newFlat);
-    endRemoveRows();
-  } else if (newCount > oldCount) {
-    beginInsertRows({}, oldCount, newCount - 1);
-    m_flat = std::move(newFlat);
-    endInsertRows();
-  } else {
-    m_flat = std::move(newFlat);
-  }
+  int const prevSelected = m_selectedIndex;
 
-  int const overlap = std::min(oldCount, newCount);
-  if (overlap > 0) emit dataChanged(index(0), index(overlap - 1));
+  if (!updateKeyedRows(newFlat)) {
+    if (newCount < oldCount) {
+      beginRemoveRows({}, newCount, oldCount - 1);
+      m_flat = std::move(newFlat);
+      endRemoveRows();
+    } else if (newCount > oldCount) {
+      beginInsertRows({}, oldCount, newCount - 1);
+      m_flat = std::move(newFlat);
+      endInsertRows();
+    } else {
+      m_flat = std::move(newFlat);
+    }
 
-  int const prevSelected = m_selectedIndex;
+    int const overlap = std::min(oldCount, newCount);
+    if (overlap > 0) emit dataChanged(index(0), index(overlap - 1));
+  }
 
   if (newCount == 0) {
     m_selectedIndex = -1;
@@ -349,3 +383,127 @@ void SectionListModel::rebuildFlatList() {
 
   if (m_selectedIndex != prevSelected) emit selectedIndexChanged();
 }
+
+bool SectionListModel::updateKeyedRows(const std::vector<FlatItem> &newFlat) {
+  auto const unkeyed = [](const FlatItem &row) { return row.key == 0; };
+  if (m_flat.empty() || std::ranges::any_of(m_flat, unkeyed) || std::ranges::any_of(newFlat, unkeyed)) {
+    return false;
+  }
+
+  int const newCount = static_cast<int>(newFlat.size());
+  std::unordered_map<uint64_t, int> newRows;
+  std::unordered_set<uint64_t> oldKeys;
+  newRows.reserve(newFlat.size());
+  oldKeys.reserve(m_flat.size());
+
+  for (int i = 0; i < newCount; ++i) {
+    if (!newRows.emplace(newFlat[i].key, i).second) return false;
+  }
+  for (const auto &row : m_flat) {
+    if (!oldKeys.insert(row.key).second) return false;
+  }
+
+  bool const hasSelection = m_selectedIndex >= 0 && std::cmp_less(m_selectedIndex, m_flat.size());
+  uint64_t const selectedKey = hasSelection ? m_flat[m_selectedIndex].key : 0;
+
+  // rows that stay point to their new data from now on, the ones that changed are refreshed last
+  for (auto &row : m_flat) {
+    if (auto it = newRows.find(row.key); it != newRows.end()) row = newFlat[it->second];
+  }
+
+  // removals, one signal per run of rows
+  for (int end = static_cast<int>(m_flat.size()); end > 0;) {
+    if (newRows.contains(m_flat[end - 1].key)) {
+      --end;
+      continue;
+    }
+    int start = end - 1;
+    while (start > 0 && !newRows.contains(m_flat[start - 1].key)) {
+      --start;
+    }
+    beginRemoveRows({}, start, end - 1);
+    m_flat.erase(m_flat.begin() + start, m_flat.begin() + end);
+    endRemoveRows();
+    end = start;
+  }
+
+  // moves: the longest run of rows already in order stays put, the others go after the row they follow
+  std::vector<int> order;
+  order.reserve(m_flat.size());
+  for (const auto &row : m_flat) {
+    order.emplace_back(newRows.at(row.key));
+  }
+
+  std::vector<bool> moving(newFlat.size(), false);
+  auto const staying = longestIncreasing(order);
+  for (size_t i = 0; i != order.size(); ++i) {
+    if (!staying[i]) moving[order[i]] = true;
+  }
+
+  auto const rowOf = [&](uint64_t key) {
+    return static_cast<int>(std::ranges::find(m_flat, key, &FlatItem::key) - m_flat.begin());
+  };
+
+  uint64_t previous = 0;
+  for (int i = 0; i < newCount; ++i) {
+    uint64_t const key = newFlat[i].key;
+    if (!oldKeys.contains(key)) continue;
+
+    if (moving[i]) {
+      int const from = rowOf(key);
+      int const after = previous ? rowOf(previous) : -1;
+      int const to = from < after ? after : after + 1;
+
+      if (to != from) {
+        beginMoveRows({}, from, from, {}, to > from ? to + 1 : to);
+        auto const row = m_flat[from];
+        m_flat.erase(m_flat.begin() + from);
+        m_flat.insert(m_flat.begin() + to, row);
+        endMoveRows();
+      }
+    }
+    previous = key;
+  }
+
+  // insertions, one signal per run of rows
+  for (int i = 0; i < newCount;) {
+    if (oldKeys.contains(newFlat[i].key)) {
+      ++i;
+      continue;
+    }
+    int end = i + 1;
+    while (end < newCount && !oldKeys.contains(newFlat[end].key)) {
+      ++end;
+    }
+    beginInsertRows({}, i, end - 1);
+    m_flat.insert(m_flat.begin() + i, newFlat.begin() + i, newFlat.begin() + end);
+    endInsertRows();
+    i = end;
+  }
+
+  // rows that stayed are only refreshed when they changed, headers always are as they show the count
+  auto const changed = [&](int row) {
+    const auto &flat = m_flat[row];
+    if (!oldKeys.contains(flat.key)) return false;
+    return flat.kind == FlatItem::SectionHeader || m_sources[flat.sourceIdx]->itemChanged(flat.itemIdx);
+  };
+
+  for (int row = 0; row < newCount;) {
+    if (!changed(row)) {
+      ++row;
+      continue;
+    }
+    int end = row + 1;
+    while (end < newCount && changed(end)) {
+      ++end;
+    }
+    emit dataChanged(index(row), index(end - 1));
+    row = end;
+  }
+
+  if (selectedKey) {
+    if (auto it = newRows.find(selectedKey); it != newRows.end()) m_selectedIndex = it->second;
+  }
+
+  return true;
+}
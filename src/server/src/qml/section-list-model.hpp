@@ -1,6 +1,7 @@
 #pragma once
 #include <QAbstractListModel>
 
+#include <cstdint>
 #include <memory>
 #include <vector>
 
@@ -75,9 +76,12 @@ private:
     enum Kind { SectionHeader, DataItem } kind;
     int sourceIdx;
     int itemIdx;
+    // see SectionSource::itemKey
+    uint64_t key = 0;
   };
 
   void rebuildFlatList();
+  bool updateKeyedRows(const std::vector<FlatItem> &newFlat);
   void rebuildCustomRoleDefaults();
 
   ViewScope m_scope;
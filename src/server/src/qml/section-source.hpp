@@ -2,6 +2,7 @@
 #include <QMimeData>
 #include <QVariantList>
 
+#include <cstdint>
 #include <functional>
 #include <memory>
 #include <optional>
@@ -28,6 +29,13 @@ public:
   virtual std::optional<ImageURL> itemIcon(int i) const = 0;
   virtual AccessoryList itemAccessories(int) const { return {}; }
 
+  // Keys telling sections and items apart across rebuilds, for the model to move and update rows in place
+  // rather than refresh all of them. 0 when the source has none.
+  virtual uint64_t sectionKey() const { return 0; }
+  virtual uint64_t itemKey(int) const { return 0; }
+  // Whether a keyed item changed since the previous rebuild.
+  virtual bool itemChanged(int) const { return true; }
+
   virtual bool isDraggable(int) const { return false; }
   virtual std::unique_ptr<QMimeData> dragMimeData(int) const { return {}; }
 
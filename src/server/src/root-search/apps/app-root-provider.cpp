@@ -51,10 +51,12 @@ AccessoryList AppRootItem::accessories() const {
   return {{.text = category.isEmpty() ? tr("Application") : category, .color = SemanticColor::TextMuted}};
 }
 
-EntrypointId AppRootItem::uniqueId() const {
-  return EntrypointId("applications", m_app->id().remove(".desktop").toStdString());
+EntrypointId AppRootItem::entrypointId(const AbstractApplication &app) {
+  return EntrypointId("applications", app.id().remove(".desktop").toStdString());
 }
 
+EntrypointId AppRootItem::uniqueId() const { return entrypointId(*m_app); }
+
 ImageURL AppRootItem::iconUrl() const { return m_app->iconUrl(); }
 
 std::unique_ptr<ActionPanelState> AppRootItem::newActionPanel(ApplicationContext *ctx,
@@ -158,6 +160,26 @@ std::vector<std::shared_ptr<RootItem>> AppRootProvider::loadItems() const {
 
 AppRootProvider::AppRootProvider(AppService &appService) : m_appService(appService) {
   connect(&m_appService, &AppService::appsChanged, this, &AppRootProvider::itemsChanged);
+  connect(&m_appService, &AppService::appsUpdated, this, &AppRootProvider::handleAppsUpdated);
+}
+
+void AppRootProvider::handleAppsUpdated(const AbstractAppDatabase::AppChanges &changes) const {
+  std::vector<std::shared_ptr<RootItem>> items;
+  std::vector<EntrypointId> removed;
+
+  for (const auto &app : changes.updated) {
+    if (app->displayable()) {
+      items.emplace_back(std::make_shared<AppRootItem>(app));
+    } else {
+      removed.emplace_back(AppRootItem::entrypointId(*app));
+    }
+  }
+
+  for (const auto &app : changes.removed) {
+    removed.emplace_back(AppRootItem::entrypointId(*app));
+  }
+
+  emit itemsUpdated(items, removed);
 }
 
 PreferenceList AppRootProvider::preferences() const { return m_appService.provider()->preferences(); }
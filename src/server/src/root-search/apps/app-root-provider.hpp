@@ -25,6 +25,8 @@ class AppRootItem : public RootItem {
   bool isActive() const override;
 
 public:
+  static EntrypointId entrypointId(const AbstractApplication &app);
+
   const AbstractApplication &app() const { return *m_app.get(); }
   AppRootItem(const std::shared_ptr<AbstractApplication> &app) : m_app(app) {}
 };
@@ -42,6 +44,9 @@ public:
   PreferenceList preferences() const override;
   void preferencesChanged(const QJsonObject &preferences) override;
 
+private:
+  void handleAppsUpdated(const AbstractAppDatabase::AppChanges &changes) const;
+
 public:
   AppRootProvider(AppService &appService);
 };
@@ -111,6 +111,16 @@ class AbstractAppDatabase : public QObject {
 public:
   using AppPtr = std::shared_ptr<AbstractApplication>;
 
+  /**
+   * What a rescan changed. Updated apps are either new or replace the app with the same id.
+   */
+  struct AppChanges {
+    std::vector<AppPtr> updated;
+    std::vector<AppPtr> removed;
+
+    bool empty() const { return updated.empty() && removed.empty(); }
+  };
+
   /**
    * A target is a string that can be an URI, a path to a file or something else entirely.
    * Wherever a target is passed, the method should do its best to find openers for it.
@@ -139,6 +149,15 @@ public:
    */
   virtual bool scan() = 0;
 
+  /**
+   * Same as `scan`, for implementations that can tell what changed since the previous scan.
+   * Returns nothing if they can't, in which case any app may have changed.
+   */
+  virtual std::optional<AppChanges> rescan() {
+    scan();
+    return std::nullopt;
+  }
+
   /**
    * Launch an instance of the application with the provided set of arguments.
    * How this is done is very implementation dependent but a few things are to be kept in mind:
@@ -155,10 +155,22 @@ bool AppService::scanSync() {
   return result;
 }
 
+void AppService::rescan() {
+  reinstallWatches(m_provider->searchPaths());
+
+  auto const changes = m_provider->rescan();
+
+  if (!changes) {
+    emit appsChanged();
+  } else if (!changes->empty()) {
+    emit appsUpdated(*changes);
+  }
+}
+
 AppService::AppService(OmniDatabase &db) : m_db(db), m_provider(createLocalProvider()) {
   m_rescanDebounce->setSingleShot(true);
   m_rescanDebounce->setInterval(500);
-  connect(m_rescanDebounce, &QTimer::timeout, this, [this] { scanSync(); });
+  connect(m_rescanDebounce, &QTimer::timeout, this, &AppService::rescan);
 
   reinstallWatches(m_provider->searchPaths());
   connect(m_watcher, &QFileSystemWatcher::directoryChanged, this, &AppService::handleDirectoryChanged);
@@ -81,6 +81,11 @@ public:
    */
   bool scanSync();
 
+  /**
+   * Same as `scanSync`, but only notifies about the apps that changed, if the provider can tell.
+   */
+  void rescan();
+
   std::vector<std::shared_ptr<AbstractApplication>> findOpeners(const QString &target) const;
 
   /**
@@ -94,4 +99,5 @@ public:
 
 signals:
   void appsChanged() const;
+  void appsUpdated(const AbstractAppDatabase::AppChanges &changes) const;
 };
@@ -0,0 +1,145 @@
+#include "services/app-service/xdg/desktop-file-cache.hpp"
+#include <glaze/beve/read.hpp>
+#include <glaze/beve/write.hpp>
+#include <qlogging.h>
+#include <set>
+#include <xdgpp/desktop-entry/file.hpp>
+#include <xdgpp/locale/locale.hpp>
+
+namespace fs = std::filesystem;
+
+namespace {
+
+// bump whenever what gets cached changes
+constexpr uint32_t CACHE_VERSION = 1;
+
+struct Snapshot {
+  uint32_t version = 0;
+  std::string lang;
+  DesktopFileCache::Entries files;
+};
+
+} // namespace
+
+std::optional<DesktopFileCache::Stamp> DesktopFileCache::stamp(const fs::directory_entry &entry) {
+  std::error_code ec;
+  Stamp stamp;
+
+  stamp.mtime = entry.last_write_time(ec).time_since_epoch().count();
+  if (ec) return std::nullopt;
+
+  stamp.size = entry.file_size(ec);
+  if (ec) return std::nullopt;
+
+  if (entry.is_symlink(ec)) {
+    stamp.target = fs::canonical(entry.path(), ec).string();
+    if (ec) return std::nullopt;
+  }
+
+  return stamp;
+}
+
+std::vector<DesktopFileCache::Found>
+DesktopFileCache::scan(const std::vector<fs::path> &dirs, Entries &previous, Entries &current) {
+  std::set<std::string> seen;
+  std::vector<Found> found;
+
+  for (const auto &dir : dirs) {
+    std::error_code ec;
+
+    for (const auto &entry :
+         fs::recursive_directory_iterator(dir, fs::directory_options::skip_permission_denied, ec)) {
+      if (!entry.is_regular_file(ec)) continue;
+      if (!entry.path().filename().string().ends_with(".desktop")) continue;
+
+      std::string const id = xdgpp::DesktopFile::relativeId(entry.path(), dir);
+
+      if (seen.contains(id)) continue;
+      seen.insert(id);
+
+      auto const fileStamp = stamp(entry);
+      std::string const key = entry.path().string();
+
+      // the same file found through overlapping search paths
+      if (!fileStamp || current.contains(key)) continue;
+
+      auto node = previous.extract(key);
+      bool const stale = node.empty() || node.mapped().stamp != *fileStamp;
+
+      if (stale) {
+        current[key] = {.stamp = *fileStamp};
+      } else {
+        current.insert(std::move(node));
+      }
+
+      found.push_back({.path = entry.path(), .dir = dir, .stale = stale});
+    }
+  }
+
+  return found;
+}
+
+std::string DesktopFileCache::compact(std::string_view data, std::string_view lang) {
+  std::string out;
+
+  out.reserve(data.size() / 2);
+
+  while (!data.empty()) {
+    size_t const eol = data.find('\n');
+    std::string_view const line = data.substr(0, eol);
+
+    data.remove_prefix(eol == std::string_view::npos ? data.size() : eol + 1);
+
+    size_t const start = line.find_first_not_of(" \t\r\v\f");
+    if (start == std::string_view::npos || line[start] == '#') continue;
+
+    // Key[locale]=value, the reader only ever picks values from locales of its own language
+    size_t const equal = line.find('=');
+    size_t const open = line.find('[');
+
+    if (line[start] != '[' && open < equal) {
+      size_t const close = line.find(']', open);
+      if (close < equal && xdgpp::Locale::parse(line.substr(open + 1, close - open - 1)).lang() != lang) {
+        continue;
+      }
+    }
+
+    out.append(line);
+    out.push_back('\n');
+  }
+
+  return out;
+}
+
+DesktopFileCache::Entries DesktopFileCache::load(const fs::path &path, const std::string &lang) {
+  std::error_code ec;
+  Snapshot snapshot;
+  std::string buf;
+
+  if (!fs::exists(path, ec)) return {};
+
+  if (auto error = glz::read_file_beve(snapshot, path.string(), buf)) {
+    qWarning() << "Failed to load desktop file cache from" << path.c_str() << glz::format_error(error);
+    return {};
+  }
+
+  if (snapshot.version != CACHE_VERSION || snapshot.lang != lang) return {};
+
+  return std::move(snapshot.files);
+}
+
+bool DesktopFileCache::save(const fs::path &path, const std::string &lang, const Entries &entries) {
+  std::error_code ec;
+  std::string buf;
+  // the entries are copied once more than strictly needed, which is nothing next to reading the files
+  Snapshot const snapshot{.version = CACHE_VERSION, .lang = lang, .files = entries};
+
+  fs::create_directories(path.parent_path(), ec);
+
+  if (auto error = glz::write_file_beve(snapshot, path.string(), buf)) {
+    qWarning() << "Failed to save desktop file cache to" << path.c_str() << glz::format_error(error);
+    return false;
+  }
+
+  return true;
+}
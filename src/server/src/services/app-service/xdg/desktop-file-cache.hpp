@@ -0,0 +1,67 @@
+#pragma once
+#include <cstdint>
+#include <filesystem>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * Contents of the desktop files found during the last scan, persisted so that a later scan only has to
+ * read the files that changed since.
+ */
+class DesktopFileCache {
+public:
+  /**
+   * What tells a cached file apart from its current version.
+   * Nix stores every file with the same mtime and Flatpak swaps whole deployments by moving a symlink,
+   * so the target of symlinked files is part of it too.
+   */
+  struct Stamp {
+    std::string target;
+    int64_t mtime = 0;
+    uint64_t size = 0;
+
+    bool operator==(const Stamp &) const = default;
+  };
+
+  struct Entry {
+    Stamp stamp;
+    std::string data;
+  };
+
+  // keyed by path
+  using Entries = std::unordered_map<std::string, Entry>;
+
+  struct Found {
+    std::filesystem::path path;
+    // the search path it was found in
+    std::filesystem::path dir;
+    // new or changed since the last scan, its data has to be read again
+    bool stale = false;
+  };
+
+  static std::optional<Stamp> stamp(const std::filesystem::directory_entry &entry);
+
+  /**
+   * Finds the desktop files of `dirs`, the first one for every id. The entries of `previous` that are
+   * still current are moved to `current` and new or changed files get an empty one there: what is left
+   * in `previous` is gone.
+   */
+  static std::vector<Found> scan(const std::vector<std::filesystem::path> &dirs, Entries &previous,
+                                 Entries &current);
+
+  /**
+   * Drop what parsing `data` with a locale of language `lang` ignores anyway: comments, blank lines and
+   * the localized values of other languages, which are most of the size of a typical desktop file.
+   */
+  static std::string compact(std::string_view data, std::string_view lang);
+
+  /**
+   * Entries saved for `lang` or nothing, if the cache is missing, unreadable or was saved for another
+   * language.
+   */
+  static Entries load(const std::filesystem::path &path, const std::string &lang);
+  static bool save(const std::filesystem::path &path, const std::string &lang, const Entries &entries);
+};
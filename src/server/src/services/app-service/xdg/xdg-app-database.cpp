@@ -8,7 +8,11 @@
 #include "xdgpp/desktop-entry/exec.hpp"
 #include "xdgpp/desktop-entry/file.hpp"
 #include "xdgpp/mime/iterator.hpp"
+#include "vicinae.hpp"
 #include <algorithm>
+#include <QtConcurrent/QtConcurrent>
+#include <fstream>
+#include <iterator>
 #include <qstandardpaths.h>
 #include <qtenvironmentvariables.h>
 #include <ranges>
@@ -101,51 +105,119 @@ AppPtr XdgAppDatabase::findDefaultOpener(const QString &target) const {
 }
 
 bool XdgAppDatabase::scan() {
-  appMap.clear();
-  m_apps.clear();
-  m_mimeAppsLists.clear();
-  m_dataDirToApps.clear();
+  rescan();
+  return true;
+}
+
+std::optional<AbstractAppDatabase::AppChanges> XdgAppDatabase::rescan() {
+  struct Candidate {
+    fs::path path;
+    fs::path dir;
+    DesktopFileCache::Entry *cached = nullptr;
+    bool stale = false;
+    std::shared_ptr<XdgApplication> app;
+  };
+
   m_mimeAppsLists = xdgpp::getAllMimeAppsLists();
 
-  std::set<std::string> seen;
+  std::vector<Candidate> candidates;
+  DesktopFileCache::Entries cachedFiles;
+  std::unordered_map<std::string, std::shared_ptr<XdgApplication>> parsedFiles;
+  auto const found = DesktopFileCache::scan(searchPaths(), m_cachedFiles, cachedFiles);
 
-  for (const auto &dir : searchPaths()) {
-    std::error_code ec;
+  // some files changed or are gone
+  bool const cacheChanged =
+      !m_cachedFiles.empty() || std::ranges::any_of(found, &DesktopFileCache::Found::stale);
 
-    for (const auto &entry :
-         fs::recursive_directory_iterator(dir, fs::directory_options::skip_permission_denied, ec)) {
-      if (!entry.is_regular_file(ec)) continue;
-      if (!entry.path().filename().string().ends_with(".desktop")) continue;
+  for (const auto &file : found) {
+    std::string const key = file.path.string();
 
-      std::string const id = xdgpp::DesktopFile::relativeId(entry.path(), dir);
+    if (!file.stale) {
+      if (auto it = m_parsedFiles.find(key); it != m_parsedFiles.end()) parsedFiles.insert(*it);
+    }
 
-      if (seen.contains(id)) continue;
-      seen.insert(id);
+    candidates.push_back(
+        {.path = file.path, .dir = file.dir, .cached = &cachedFiles[key], .stale = file.stale});
+  }
 
-      auto file = xdgpp::DesktopFile::fromFile(entry.path(), dir);
+  std::vector<Candidate *> unparsed;
 
-      // we no longer check TryExec here, we still want to track the app even if it's
-      // not executable at scan time, because it may become executable later.
-      if (file.deleted()) continue;
+  for (auto &candidate : candidates) {
+    if (auto it = parsedFiles.find(candidate.path.string()); it != parsedFiles.end()) {
+      candidate.app = it->second;
+    } else {
+      unparsed.emplace_back(&candidate);
+    }
+  }
 
-      if (file.errorMessage()) {
-        qWarning() << "Desktop file" << file.path().c_str() << "is invalid" << *file.errorMessage();
-        continue;
-      }
+  // Every candidate only touches its own cache entry, which the map keeps at the same address. The locale
+  // is resolved beforehand as doing it for every file calls setlocale, which is not thread safe.
+  QtConcurrent::blockingMap(unparsed, [&](Candidate *candidate) {
+    if (candidate->stale) {
+      std::ifstream ifs(candidate->path);
+      std::string const data{std::istreambuf_iterator<char>(ifs), std::istreambuf_iterator<char>()};
+      candidate->cached->data = DesktopFileCache::compact(data, m_locale.lang());
+    }
 
-      auto app = std::make_shared<XdgApplication>(file);
+    auto file = xdgpp::DesktopFile::fromData(candidate->cached->data, candidate->path, candidate->dir,
+                                             {.locale = m_locale});
 
-      m_apps.emplace_back(app);
-      m_dataDirToApps[dir].emplace_back(app);
-      appMap[app->id()] = app;
+    // we no longer check TryExec here, we still want to track the app even if it's
+    // not executable at scan time, because it may become executable later.
+    if (file.deleted()) return;
 
-      for (const auto &action : app->actions()) {
-        appMap[action->id()] = action;
-      }
+    if (file.errorMessage()) {
+      qWarning() << "Desktop file" << file.path().c_str() << "is invalid" << *file.errorMessage();
+      return;
     }
+
+    candidate->app = std::make_shared<XdgApplication>(file);
+  });
+
+  for (const Candidate *candidate : unparsed) {
+    parsedFiles[candidate->path.string()] = candidate->app;
   }
 
-  return true;
+  std::unordered_map<QString, std::shared_ptr<XdgApplication>> previous;
+  AppChanges changes;
+
+  for (auto &app : m_apps) {
+    previous[app->id()] = std::move(app);
+  }
+
+  appMap.clear();
+  m_apps.clear();
+  m_dataDirToApps.clear();
+
+  for (const auto &candidate : candidates) {
+    const auto &app = candidate.app;
+
+    if (!app) continue;
+
+    m_apps.emplace_back(app);
+    m_dataDirToApps[candidate.dir].emplace_back(app);
+    appMap[app->id()] = app;
+
+    for (const auto &action : app->actions()) {
+      appMap[action->id()] = action;
+    }
+
+    auto it = previous.find(app->id());
+
+    if (it == previous.end() || it->second != app) changes.updated.emplace_back(app);
+    if (it != previous.end()) previous.erase(it);
+  }
+
+  for (auto &[id, app] : previous) {
+    changes.removed.emplace_back(std::move(app));
+  }
+
+  m_cachedFiles = std::move(cachedFiles);
+  m_parsedFiles = std::move(parsedFiles);
+
+  if (cacheChanged) DesktopFileCache::save(m_cachePath, m_locale.lang(), m_cachedFiles);
+
+  return changes;
 }
 
 AppPtr XdgAppDatabase::findDefaultTerminalFromSpec() const {
@@ -620,4 +692,8 @@ void XdgAppDatabase::applyPreferences(const QJsonObject &preferences) {
   }
 }
 
-XdgAppDatabase::XdgAppDatabase() { scan(); }
+XdgAppDatabase::XdgAppDatabase()
+    : m_locale(xdgpp::Locale::system()), m_cachePath(Omnicast::cacheDir() / "desktop-files.bin") {
+  m_cachedFiles = DesktopFileCache::load(m_cachePath, m_locale.lang());
+  scan();
+}
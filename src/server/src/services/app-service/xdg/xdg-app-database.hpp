@@ -1,6 +1,7 @@
 #pragma once
 #include <QCoreApplication>
 #include "services/app-service/abstract-app-db.hpp"
+#include "services/app-service/xdg/desktop-file-cache.hpp"
 #include <xdgpp/desktop-entry/file.hpp>
 #include "xdg-app.hpp"
 #include <qfileinfo.h>
@@ -9,6 +10,7 @@
 #include <qmimetype.h>
 #include <qobjectdefs.h>
 #include <qprocess.h>
+#include <xdgpp/locale/locale.hpp>
 #include <xdgpp/xdgpp.hpp>
 
 class XdgAppDatabase : public AbstractAppDatabase {
@@ -16,6 +18,7 @@ class XdgAppDatabase : public AbstractAppDatabase {
 
 public:
   bool scan() override;
+  std::optional<AppChanges> rescan() override;
   std::vector<std::filesystem::path> defaultSearchPaths() const override;
   AppPtr findByClass(const QString &name) const override;
   AppPtr findDefaultOpener(const QString &target) const override;
@@ -65,6 +68,13 @@ private:
   std::vector<std::shared_ptr<XdgApplication>> m_apps;
   std::optional<QString> m_launchPrefix;
 
+  // localized values are resolved for this one, computed once as parsing happens off the main thread
+  xdgpp::Locale m_locale;
+  std::filesystem::path m_cachePath;
+  DesktopFileCache::Entries m_cachedFiles;
+  // app parsed from every cached file that is still current, null for hidden or invalid ones
+  std::unordered_map<std::string, std::shared_ptr<XdgApplication>> m_parsedFiles;
+
   // apps segmented by data dir (needed for association resolution)
   std::unordered_map<std::filesystem::path, std::vector<std::shared_ptr<XdgApplication>>> m_dataDirToApps;
 };
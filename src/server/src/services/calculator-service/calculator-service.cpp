@@ -4,6 +4,8 @@
 #include "omni-database.hpp"
 #include "services/calculator-service/abstract-calculator-backend.hpp"
 #include "services/calculator-service/calculator-service.hpp"
+#include <QThreadPool>
+#include <QtConcurrent/QtConcurrent>
 #include <ranges>
 #include <qdatetime.h>
 #include <qlogging.h>
@@ -22,32 +24,53 @@
 
 using CalculatorRecord = CalculatorService::CalculatorRecord;
 
+QThreadPool *CalculatorService::lane() {
+  // never destroyed, as that would wait for a computation stuck on it
+  static auto *const pool = [] {
+    auto *pool = new QThreadPool;
+    pool->setMaxThreadCount(1);
+    return pool;
+  }();
+
+  return pool;
+}
+
+AbstractCalculatorBackend::ComputeResult CalculatorService::compute(const QString &question) {
+  return QtConcurrent::run(lane(), [this, question]() { return m_backend->compute(question, {}); }).result();
+}
+
+// m_backend is only written from the lane, while the GUI thread waits for it
 bool CalculatorService::setBackend(AbstractCalculatorBackend *newBackend) {
   if (m_backend == newBackend) return true;
 
-  if (!newBackend->start()) {
-    qWarning() << "Failed to start new calculator backend" << newBackend->id();
-    return false;
-  }
+  return QtConcurrent::run(lane(), [this, newBackend]() {
+           if (!newBackend->start()) {
+             qWarning() << "Failed to start new calculator backend" << newBackend->id();
+             return false;
+           }
 
-  qInfo() << "Started" << newBackend->displayName() << "calculator backend";
+           qInfo() << "Started" << newBackend->displayName() << "calculator backend";
 
-  if (m_backend) { m_backend->stop(); }
+           if (m_backend) { m_backend->stop(); }
 
-  m_backend = newBackend;
-  return true;
+           m_backend = newBackend;
+           return true;
+         })
+      .result();
 }
 
 void CalculatorService::startFirstHealthy() {
-  if (m_backend) m_backend->stop();
-
-  for (const auto &backend : m_backends) {
-    if (backend->start()) {
-      qInfo() << "Started" << backend->displayName() << "calculator backend";
-      m_backend = backend.get();
-      return;
+  QtConcurrent::run(lane(), [this]() {
+    if (m_backend) m_backend->stop();
+
+    for (const auto &backend : m_backends) {
+      if (backend->start()) {
+        qInfo() << "Started" << backend->displayName() << "calculator backend";
+        m_backend = backend.get();
+        return;
+      }
     }
-  }
+  }).waitForFinished();
 }
 
 bool CalculatorService::setBackend(const QString &id) {
@@ -315,7 +338,7 @@ void CalculatorService::updateConversionRecords() {
   };
 
   for (auto &record : m_records | std::views::filter(isConversionRecord)) {
-    auto result = m_backend->compute(record.question, {});
+    auto result = compute(record.question);
 
     if (!result) continue;
 
@@ -5,6 +5,8 @@
 #include <qobject.h>
 #include <qtmetamacros.h>
 
+class QThreadPool;
+
 /**
  * Service used for everything calculator, including performing actual calculation (using the configured
  * backend), and history management.
@@ -47,6 +49,19 @@ private:
 
 public:
   AbstractCalculatorBackend *backend() const;
+
+  /**
+   * The thread the backends are started, stopped and computed on. They are not thread safe (qalculate
+   * computes on a global calculator), so they must not be used from anywhere else.
+   */
+  static QThreadPool *lane();
+
+  /**
+   * Computes `question` with the current backend on the lane, waiting for the result.
+   * Not to be called from the lane itself.
+   */
+  AbstractCalculatorBackend::ComputeResult compute(const QString &question);
+
   using GroupedRecordList = std::vector<std::pair<QString, std::vector<CalculatorRecord>>>;
 
   void startFirstHealthy();
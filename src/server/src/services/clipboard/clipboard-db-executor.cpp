@@ -0,0 +1,30 @@
+#include "services/clipboard/clipboard-db-executor.hpp"
+
+static constexpr int READ_THREADS = 2;
+
+ClipboardDbExecutor::ClipboardDbExecutor(std::optional<db::EncryptionKey> key) : m_key(key) {
+  m_readPool.setMaxThreadCount(READ_THREADS);
+  m_writeLane.setMaxThreadCount(1);
+  // the lane is the thread that owns the writer most of the time, no point in letting it expire
+  m_writeLane.setExpiryTimeout(-1);
+}
+
+std::unique_ptr<ClipboardDatabase> ClipboardDbExecutor::takeReader() {
+  {
+    std::lock_guard const lock(m_readersLock);
+
+    if (!m_idleReaders.empty()) {
+      auto db = std::move(m_idleReaders.back());
+      m_idleReaders.pop_back();
+      return db;
+    }
+  }
+
+  // opened outside of the lock, this is the slow part
+  return std::make_unique<ClipboardDatabase>(m_key, ClipboardDatabase::Access::ReadOnly);
+}
+
+void ClipboardDbExecutor::giveReader(std::unique_ptr<ClipboardDatabase> db) {
+  std::lock_guard const lock(m_readersLock);
+  m_idleReaders.emplace_back(std::move(db));
+}
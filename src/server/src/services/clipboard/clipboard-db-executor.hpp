@@ -0,0 +1,81 @@
+#pragma once
+#include "services/clipboard/clipboard-db.hpp"
+#include <QFuture>
+#include <QThreadPool>
+#include <QtConcurrent>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <type_traits>
+#include <vector>
+
+/**
+ * Long-lived connections to the clipboard database, so that the key derivation and schema load of opening
+ * one are paid once rather than on every operation: a single writer, and a few read-only connections for
+ * history queries to run alongside it. Connections are opened when first needed.
+ *
+ * Writes that don't need an answer right away go to the write lane, a single thread that runs them in the
+ * order they were queued.
+ */
+class ClipboardDbExecutor {
+public:
+  explicit ClipboardDbExecutor(std::optional<db::EncryptionKey> key);
+
+  /**
+   * Runs `job` on the calling thread with the writer, once no other write is using it.
+   */
+  template <typename F> auto write(F &&job) {
+    std::lock_guard const lock(m_writerLock);
+
+    if (!m_writer) m_writer = std::make_unique<ClipboardDatabase>(m_key);
+
+    return std::invoke(std::forward<F>(job), *m_writer);
+  }
+
+  /**
+   * Runs `job` on the calling thread with a read-only connection of its own.
+   */
+  template <typename F> auto read(F &&job) {
+    ReaderLease const lease(*this);
+    return std::invoke(std::forward<F>(job), *lease.db);
+  }
+
+  /**
+   * Runs `job` on the write lane. It is handed no connection: it calls `write` for the part that needs
+   * one, so that whatever it does before (hashing, encrypting...) doesn't hold the writer.
+   */
+  template <typename F> QFuture<std::invoke_result_t<F>> queue(F job) {
+    return QtConcurrent::run(&m_writeLane, std::move(job));
+  }
+
+  template <typename F> QFuture<std::invoke_result_t<F, ClipboardDatabase &>> queueRead(F job) {
+    return QtConcurrent::run(&m_readPool, [this, job = std::move(job)]() { return read(job); });
+  }
+
+private:
+  struct ReaderLease {
+    explicit ReaderLease(ClipboardDbExecutor &executor) : executor(executor), db(executor.takeReader()) {}
+    ~ReaderLease() { executor.giveReader(std::move(db)); }
+    ReaderLease(const ReaderLease &) = delete;
+    ReaderLease &operator=(const ReaderLease &) = delete;
+
+    ClipboardDbExecutor &executor;
+    std::unique_ptr<ClipboardDatabase> db;
+  };
+
+  std::unique_ptr<ClipboardDatabase> takeReader();
+  void giveReader(std::unique_ptr<ClipboardDatabase> db);
+
+  std::optional<db::EncryptionKey> m_key;
+
+  std::mutex m_writerLock;
+  std::unique_ptr<ClipboardDatabase> m_writer;
+
+  std::mutex m_readersLock;
+  std::vector<std::unique_ptr<ClipboardDatabase>> m_idleReaders;
+
+  // last, so that they are done with their jobs before the connections go away
+  QThreadPool m_readPool;
+  QThreadPool m_writeLane;
+};
@@ -1,6 +1,8 @@
 #include "clipboard-db.hpp"
 #include "utils/migration-manager/migration-manager.hpp"
 #include "vicinae.hpp"
+#include <algorithm>
+#include <iterator>
 #include <qlogging.h>
 
 static constexpr const char *CLIPBOARD_PRAGMAS[] = {
@@ -8,8 +10,8 @@ static constexpr const char *CLIPBOARD_PRAGMAS[] = {
     "PRAGMA foreign_keys = ON"};
 
 std::optional<ClipboardSelectionRecord> ClipboardDatabase::findSelection(const QString &id) {
-  auto stmt = m_db.prepare(R"(
-    SELECT s.source, o.id, o.mime_type, o.encryption_type
+  auto stmt = m_db.prepareCached(R"(
+    SELECT s.source, o.id, COALESCE(o.blob_hash, o.id), o.mime_type, o.encryption_type
     FROM selection s
     LEFT JOIN data_offer o ON o.selection_id = s.id
     WHERE s.id = :id
@@ -27,8 +29,9 @@ std::optional<ClipboardSelectionRecord> ClipboardDatabase::findSelection(const Q
 
     ClipboardSelectionOfferRecord record;
     record.id = stmt.columnQString(1);
-    record.mimeType = stmt.columnQString(2);
-    record.encryption = static_cast<ClipboardEncryptionType>(stmt.columnInt(3));
+    record.file = stmt.columnQString(2);
+    record.mimeType = stmt.columnQString(3);
+    record.encryption = static_cast<ClipboardEncryptionType>(stmt.columnInt(4));
     selection->offers.emplace_back(record);
   }
 
@@ -64,14 +67,12 @@ PaginatedResponse<ClipboardHistoryEntry> ClipboardDatabase::query(int limit, int
                COUNT(*) OVER() as total_count
         FROM selection
         ORDER BY pinned_at DESC, updated_at DESC
-        LIMIT %1 OFFSET %2
+        LIMIT :limit OFFSET :offset
       ) s
       JOIN data_offer o
         ON o.selection_id = s.id
         AND o.mime_type = s.preferred_mime_type
-    )")
-                      .arg(limit)
-                      .arg(offset);
+    )");
   } else {
     queryString = R"(
       SELECT
@@ -96,7 +97,7 @@ PaginatedResponse<ClipboardHistoryEntry> ClipboardDatabase::query(int limit, int
       queryString += " JOIN selection_fts ON selection_fts.selection_id = selection.id ";
     }
 
-    if (!opts.query.isEmpty()) { queryString += " WHERE selection_fts MATCH '\"" + opts.query + "\"*' "; }
+    if (!opts.query.isEmpty()) { queryString += " WHERE selection_fts MATCH :match "; }
 
     if (opts.kind) {
       if (opts.query.isEmpty()) {
@@ -108,12 +109,19 @@ PaginatedResponse<ClipboardHistoryEntry> ClipboardDatabase::query(int limit, int
 
     queryString += " GROUP BY selection.id ";
     queryString += " ORDER BY pinned_at DESC, updated_at DESC";
-    queryString = QString("SELECT * FROM (%1) LIMIT %2 OFFSET %3").arg(queryString).arg(limit).arg(offset);
+    queryString = QString("SELECT * FROM (%1) LIMIT :limit OFFSET :offset").arg(queryString);
   }
 
-  auto stmt = m_db.prepare(queryString.toStdString());
+  // the same few shapes of query over and over, with everything that changes bound
+  auto stmt = m_db.prepareCached(queryString.toStdString());
 
+  stmt.bind(":limit", limit);
+  stmt.bind(":offset", offset);
   if (opts.kind) { stmt.bind(":kind", static_cast<int>(*opts.kind)); }
+  if (!opts.query.isEmpty()) {
+    // a prefix match on the whole query as a single phrase
+    stmt.bind(":match", QString("\"%1\"*").arg(QString(opts.query).replace('"', "\"\"")));
+  }
 
   while (stmt.step()) {
     ClipboardHistoryEntry dto{.id = stmt.columnQString(0),
@@ -139,7 +147,7 @@ PaginatedResponse<ClipboardHistoryEntry> ClipboardDatabase::query(int limit, int
 }
 
 std::optional<QString> ClipboardDatabase::retrieveKeywords(const QString &id) {
-  auto stmt = m_db.prepare("SELECT keywords FROM selection WHERE id = :id");
+  auto stmt = m_db.prepareCached("SELECT keywords FROM selection WHERE id = :id");
   stmt.bind(":id", id);
 
   if (!stmt.step()) return std::nullopt;
@@ -149,7 +157,7 @@ std::optional<QString> ClipboardDatabase::retrieveKeywords(const QString &id) {
 
 bool ClipboardDatabase::setKeywords(const QString &id, const QString &keywords) {
   return transaction([&](auto *) {
-    auto stmt = m_db.prepare("UPDATE selection SET keywords = :keywords WHERE id = :id");
+    auto stmt = m_db.prepareCached("UPDATE selection SET keywords = :keywords WHERE id = :id");
     stmt.bind(":id", id);
     stmt.bind(":keywords", keywords);
 
@@ -164,28 +172,29 @@ bool ClipboardDatabase::setKeywords(const QString &id, const QString &keywords)
 
 bool ClipboardDatabase::removeAll() {
   return m_db.exec("DELETE FROM selection_fts") && m_db.exec("DELETE FROM data_offer") &&
+         m_db.exec("DELETE FROM selection_preview") && m_db.exec("DELETE FROM blob") &&
          m_db.exec("DELETE FROM selection");
 }
 
 std::vector<QString> ClipboardDatabase::removeSelection(const QString &selectionId) {
   auto tx = m_db.transaction();
 
-  auto offerStmt = m_db.prepare(R"(
+  auto offerStmt = m_db.prepareCached(R"(
     DELETE FROM
       data_offer
     WHERE
       selection_id = :selection_id
-    RETURNING id
+    RETURNING id, blob_hash
   )");
   offerStmt.bind(":selection_id", selectionId);
 
-  std::vector<QString> deletedOffers;
+  std::vector<QString> unusedFiles;
 
   while (offerStmt.step()) {
-    deletedOffers.emplace_back(offerStmt.columnQString(0));
+    if (offerStmt.isNull(1)) unusedFiles.emplace_back(offerStmt.columnQString(0));
   }
 
-  auto selStmt = m_db.prepare("DELETE FROM selection WHERE id = :selection_id");
+  auto selStmt = m_db.prepareCached("DELETE FROM selection WHERE id = :selection_id");
   selStmt.bind(":selection_id", selectionId);
 
   if (!selStmt.exec()) {
@@ -194,15 +203,18 @@ std::vector<QString> ClipboardDatabase::removeSelection(const QString &selection
     return {};
   }
 
+  // the offers deleted above released their blobs, and so did the previews that went with the selection
+  std::ranges::move(removeUnusedBlobs(), std::back_inserter(unusedFiles));
+
   tx.commit();
 
-  return deletedOffers;
+  return unusedFiles;
 }
 
 std::optional<PreferredClipboardOfferRecord>
 ClipboardDatabase::findPreferredOffer(const QString &selectionId) {
-  auto stmt = m_db.prepare(R"(
-    SELECT o.id, o.encryption_type FROM data_offer o
+  auto stmt = m_db.prepareCached(R"(
+    SELECT o.id, COALESCE(o.blob_hash, o.id), o.encryption_type, o.mime_type FROM data_offer o
     JOIN selection s ON s.id = o.selection_id
     WHERE o.mime_type = s.preferred_mime_type
     AND selection_id = :selection
@@ -215,24 +227,107 @@ ClipboardDatabase::findPreferredOffer(const QString &selectionId) {
   }
 
   return PreferredClipboardOfferRecord{.id = stmt.columnQString(0),
-                                       .encryption = static_cast<ClipboardEncryptionType>(stmt.columnInt(1))};
+                                       .file = stmt.columnQString(1),
+                                       .encryption = static_cast<ClipboardEncryptionType>(stmt.columnInt(2)),
+                                       .mimeType = stmt.columnQString(3)};
+}
+
+std::vector<QString> ClipboardDatabase::removeUnusedBlobs() {
+  auto stmt = m_db.prepareCached("DELETE FROM blob WHERE ref_count <= 0 RETURNING hash");
+  std::vector<QString> files;
+
+  while (stmt.step()) {
+    files.emplace_back(stmt.columnQString(0));
+  }
+
+  return files;
+}
+
+bool ClipboardDatabase::removePreviews(const QString &selectionId) {
+  auto stmt = m_db.prepareCached("DELETE FROM selection_preview WHERE selection_id = :selection_id");
+  stmt.bind(":selection_id", selectionId);
+
+  return stmt.exec();
+}
+
+bool ClipboardDatabase::insertPreview(const InsertClipboardPreviewPayload &payload) {
+  auto stmt = m_db.prepareCached(R"(
+    INSERT INTO selection_preview (selection_id, kind, blob_hash, mime_type)
+    VALUES (:selection_id, :kind, :blob_hash, :mime_type)
+  )");
+  stmt.bind(":selection_id", payload.selectionId);
+  stmt.bind(":kind", static_cast<int>(payload.kind));
+  stmt.bind(":blob_hash", payload.blobHash);
+  stmt.bind(":mime_type", payload.mimeType);
+
+  if (!stmt.exec()) {
+    qWarning() << "Failed to insert preview" << stmt.lastError().c_str();
+    return false;
+  }
+
+  return true;
+}
+
+std::optional<ClipboardPreviewRecord> ClipboardDatabase::findPreview(const QString &selectionId,
+                                                                    ClipboardPreviewKind kind) {
+  auto stmt = m_db.prepareCached(R"(
+    SELECT p.blob_hash, p.mime_type, b.encryption_type FROM selection_preview p
+    JOIN blob b ON b.hash = p.blob_hash
+    WHERE p.selection_id = :selection_id AND p.kind = :kind
+  )");
+  stmt.bind(":selection_id", selectionId);
+  stmt.bind(":kind", static_cast<int>(kind));
+
+  if (!stmt.step()) return std::nullopt;
+
+  return ClipboardPreviewRecord{
+      .file = stmt.columnQString(0),
+      .mimeType = stmt.columnQString(1),
+      .encryption = static_cast<ClipboardEncryptionType>(stmt.columnInt(2)),
+  };
+}
+
+bool ClipboardDatabase::setPreviewVersion(const QString &selectionId, int version) {
+  auto stmt =
+      m_db.prepareCached("UPDATE selection SET preview_version = :version WHERE id = :id RETURNING id");
+  stmt.bind(":id", selectionId);
+  stmt.bind(":version", version);
+
+  return stmt.step();
+}
+
+std::vector<QString> ClipboardDatabase::findOutdatedPreviews(int version, const QString &afterId, int limit) {
+  auto stmt = m_db.prepareCached(R"(
+    SELECT id FROM selection WHERE preview_version < :version AND id > :after_id ORDER BY id LIMIT :limit
+  )");
+  stmt.bind(":version", version);
+  stmt.bind(":after_id", afterId);
+  stmt.bind(":limit", limit);
+
+  std::vector<QString> ids;
+
+  while (stmt.step()) {
+    ids.emplace_back(stmt.columnQString(0));
+  }
+
+  return ids;
 }
 
 bool ClipboardDatabase::setPinned(const QString &id, bool pinned) {
   if (pinned) {
-    auto stmt = m_db.prepare("UPDATE selection SET pinned_at = :epoch WHERE id = :id");
+    auto stmt = m_db.prepareCached("UPDATE selection SET pinned_at = :epoch WHERE id = :id");
     stmt.bind(":id", id);
     stmt.bind(":epoch", static_cast<int64_t>(QDateTime::currentSecsSinceEpoch()));
     return stmt.exec();
   }
 
-  auto stmt = m_db.prepare("UPDATE selection SET pinned_at = NULL WHERE id = :id");
+  auto stmt = m_db.prepareCached("UPDATE selection SET pinned_at = NULL WHERE id = :id");
   stmt.bind(":id", id);
   return stmt.exec();
 }
 
 bool ClipboardDatabase::insertSelection(const InsertSelectionPayload &payload) {
-  auto stmt = m_db.prepare(R"(
+  auto stmt = m_db.prepareCached(R"(
     INSERT INTO selection (id, kind, offer_count, hash_md5, preferred_mime_type, source, created_at, updated_at)
     VALUES (:id, :kind, :offer_count, :hash_md5, :preferred_mime_type, :source, :epoch, :epoch)
     RETURNING id, created_at;
@@ -262,8 +357,19 @@ bool ClipboardDatabase::transaction(const TxHandle &handle) {
   return false;
 }
 
+bool ClipboardDatabase::savepoint(const TxHandle &handle) {
+  if (!m_db.exec("SAVEPOINT clipboard")) return false;
+
+  if (handle(this)) { return m_db.exec("RELEASE clipboard"); }
+
+  m_db.exec("ROLLBACK TO clipboard");
+  m_db.exec("RELEASE clipboard");
+  return false;
+}
+
 bool ClipboardDatabase::tryBubbleUpSelection(const QString &idLike) {
-  auto stmt = m_db.prepare("UPDATE selection SET updated_at = :updated_at WHERE hash_md5 = :id OR id = :id");
+  auto stmt =
+      m_db.prepareCached("UPDATE selection SET updated_at = :updated_at WHERE hash_md5 = :id OR id = :id");
   stmt.bind(":id", idLike);
   stmt.bind(":updated_at", static_cast<int64_t>(QDateTime::currentSecsSinceEpoch()));
 
@@ -273,7 +379,7 @@ bool ClipboardDatabase::tryBubbleUpSelection(const QString &idLike) {
 }
 
 bool ClipboardDatabase::indexSelectionContent(const QString &selectionId, const QString &content) {
-  auto stmt = m_db.prepare(R"(
+  auto stmt = m_db.prepareCached(R"(
     INSERT INTO selection_fts (selection_id, content) VALUES (:selection_id, :content);
   )");
   stmt.bind(":selection_id", selectionId);
@@ -293,13 +399,39 @@ void ClipboardDatabase::runMigrations() {
   manager.runMigrations();
 }
 
+bool ClipboardDatabase::hasBlob(const QString &hash) {
+  auto stmt = m_db.prepareCached("SELECT 1 FROM blob WHERE hash = :hash");
+  stmt.bind(":hash", hash);
+
+  return stmt.step();
+}
+
+bool ClipboardDatabase::insertBlob(const InsertClipboardBlobPayload &payload) {
+  auto stmt = m_db.prepareCached(R"(
+    INSERT INTO blob (hash, encryption_type, size) VALUES (:hash, :encryption, :size)
+  )");
+  stmt.bind(":hash", payload.hash);
+  stmt.bind(":encryption", static_cast<int>(payload.encryption));
+  stmt.bind(":size", static_cast<int64_t>(payload.size));
+
+  if (!stmt.exec()) {
+    qCritical() << "Failed to insert blob" << stmt.lastError().c_str();
+    return false;
+  }
+
+  return true;
+}
+
 bool ClipboardDatabase::insertOffer(const InsertClipboardOfferPayload &payload) {
-  auto stmt = m_db.prepare(R"(
-    INSERT INTO data_offer (id, selection_id, mime_type, text_preview, content_hash_md5, encryption_type, size, kind, url_host)
-    VALUES (:id, :selection_id, :mime_type, :text_preview, :content_hash_md5, :encryption, :size, :kind, :url_host)
+  auto stmt = m_db.prepareCached(R"(
+    INSERT INTO data_offer (id, selection_id, blob_hash, mime_type, text_preview, content_hash_md5,
+                            encryption_type, size, kind, url_host)
+    VALUES (:id, :selection_id, :blob_hash, :mime_type, :text_preview, :content_hash_md5,
+            :encryption, :size, :kind, :url_host)
   )");
   stmt.bind(":id", payload.id);
   stmt.bind(":selection_id", payload.selectionId);
+  stmt.bind(":blob_hash", payload.blobHash);
   stmt.bind(":mime_type", payload.mimeType);
   stmt.bind(":text_preview", payload.textPreview);
   stmt.bind(":content_hash_md5", payload.md5sum);
@@ -316,7 +448,7 @@ bool ClipboardDatabase::insertOffer(const InsertClipboardOfferPayload &payload)
   return true;
 }
 
-ClipboardDatabase::ClipboardDatabase(std::optional<db::EncryptionKey> key) {
+ClipboardDatabase::ClipboardDatabase(std::optional<db::EncryptionKey> key, Access access) {
   auto result = db::Database::open(Omnicast::dataDir() / "clipboard.db");
 
   if (!result) {
@@ -332,6 +464,12 @@ ClipboardDatabase::ClipboardDatabase(std::optional<db::EncryptionKey> key) {
     }
   }
 
+  if (access == Access::ReadOnly) {
+    // the journal mode is a property of the file, set by the writer already
+    if (!m_db.exec("PRAGMA query_only = ON")) { qCritical() << "Failed to make clipboard reader read-only"; }
+    return;
+  }
+
   for (const auto &pragma : CLIPBOARD_PRAGMAS) {
     if (!m_db.exec(pragma)) { qCritical() << "Failed to execute pragma" << pragma; }
   }
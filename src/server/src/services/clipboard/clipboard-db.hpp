@@ -14,7 +14,10 @@ enum class ClipboardEncryptionType : std::uint8_t {
 
 struct PreferredClipboardOfferRecord {
   QString id;
+  // name of the file holding the offer data
+  QString file;
   ClipboardEncryptionType encryption;
+  QString mimeType;
 };
 
 enum class ClipboardOfferKind : std::uint8_t {
@@ -35,9 +38,16 @@ struct InsertSelectionPayload {
   std::optional<QString> source;
 };
 
+struct InsertClipboardBlobPayload {
+  QString hash;
+  ClipboardEncryptionType encryption;
+  quint64 size;
+};
+
 struct InsertClipboardOfferPayload {
   QString id;
   QString selectionId;
+  QString blobHash;
   QString mimeType;
   QString textPreview;
   QString md5sum;
@@ -47,6 +57,26 @@ struct InsertClipboardOfferPayload {
   std::optional<QString> urlHost;
 };
 
+enum class ClipboardPreviewKind : std::uint8_t {
+  Excerpt,
+  Thumbnail,
+  Thumbnail2x,
+};
+
+struct InsertClipboardPreviewPayload {
+  QString selectionId;
+  ClipboardPreviewKind kind;
+  QString blobHash;
+  QString mimeType;
+};
+
+struct ClipboardPreviewRecord {
+  // name of the file holding the preview
+  QString file;
+  QString mimeType;
+  ClipboardEncryptionType encryption;
+};
+
 struct InsertClipboardHistoryLine {
   QString mimeType;
   QString textPreview;
@@ -64,6 +94,9 @@ struct ClipboardHistoryEntry {
   ClipboardOfferKind kind;
   std::optional<QString> urlHost;
   ClipboardEncryptionType encryption;
+  // of image selections, filled by the clipboard service so that the list never needs the data itself
+  QByteArray thumbnail;
+  QString thumbnailMimeType;
 };
 
 struct ClipboardListSettings {
@@ -73,6 +106,8 @@ struct ClipboardListSettings {
 
 struct ClipboardSelectionOfferRecord {
   QString id;
+  // name of the file holding the offer data
+  QString file;
   QString mimeType;
   ClipboardEncryptionType encryption;
 };
@@ -87,8 +122,16 @@ class ClipboardDatabase {
 public:
   using TxHandle = std::function<bool(ClipboardDatabase *db)>;
 
+  enum class Access : std::uint8_t { ReadWrite, ReadOnly };
+
   bool transaction(const TxHandle &handle);
 
+  /**
+   * Like `transaction`, but nests in one: what `handle` did is undone on failure without rolling back
+   * the enclosing transaction.
+   */
+  bool savepoint(const TxHandle &handle);
+
   std::optional<ClipboardSelectionRecord> findSelection(const QString &id);
 
   PaginatedResponse<ClipboardHistoryEntry> query(int limit = 100, int offset = 0,
@@ -102,14 +145,41 @@ public:
   bool setPinned(const QString &id, bool pinned);
   bool tryBubbleUpSelection(const QString &idLike);
   bool insertSelection(const InsertSelectionPayload &payload);
+  bool hasBlob(const QString &hash);
+  bool insertBlob(const InsertClipboardBlobPayload &payload);
   bool insertOffer(const InsertClipboardOfferPayload &payload);
   bool indexSelectionContent(const QString &selectionId, const QString &content);
+
+  /**
+   * Returns the files that no offer refers to anymore: those of the blobs only this selection used and
+   * those of its offers stored before blobs existed.
+   */
   std::vector<QString> removeSelection(const QString &selectionId);
   std::optional<PreferredClipboardOfferRecord> findPreferredOffer(const QString &selectionId);
 
+  /**
+   * Delete the blobs nothing refers to anymore, returning the files that held them.
+   */
+  std::vector<QString> removeUnusedBlobs();
+
+  bool removePreviews(const QString &selectionId);
+  bool insertPreview(const InsertClipboardPreviewPayload &payload);
+  std::optional<ClipboardPreviewRecord> findPreview(const QString &selectionId, ClipboardPreviewKind kind);
+
+  /**
+   * Record that previews were generated for the selection at `version`.
+   * Returns false if the selection doesn't exist (anymore).
+   */
+  bool setPreviewVersion(const QString &selectionId, int version);
+
+  /**
+   * Up to `limit` selections whose previews are older than `version`, in id order from after `afterId`.
+   */
+  std::vector<QString> findOutdatedPreviews(int version, const QString &afterId, int limit);
+
   void runMigrations();
 
-  explicit ClipboardDatabase(std::optional<db::EncryptionKey> key);
+  explicit ClipboardDatabase(std::optional<db::EncryptionKey> key, Access access = Access::ReadWrite);
   ClipboardDatabase(ClipboardDatabase &&other) noexcept;
   ~ClipboardDatabase() = default;
 
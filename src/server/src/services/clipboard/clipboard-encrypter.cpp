@@ -1,7 +1,15 @@
 #include "services/clipboard/clipboard-encrypter.hpp"
+#include <QBuffer>
+#include <algorithm>
 #include <cstddef>
+#include <cstring>
+#include <optional>
 #include <span>
+#include <vector>
 #include "crypto/aes-gcm.hpp"
+#include "crypto/aes-gcm-stream.hpp"
+
+namespace Stream = Crypto::AES256GCMStream;
 
 static std::span<const std::byte> asBytes(const QByteArray &b) {
   return {reinterpret_cast<const std::byte *>(b.constData()), static_cast<size_t>(b.size())};
@@ -11,14 +19,149 @@ static QByteArray toQByteArray(std::span<const std::byte> b) {
   return {reinterpret_cast<const char *>(b.data()), static_cast<qsizetype>(b.size())};
 }
 
+namespace {
+
+/**
+ * Plaintext of a chunked container, decrypting the chunk the read position is in when it is needed.
+ * Holds a single chunk at a time whatever the size of the file.
+ */
+class ChunkDecryptingDevice : public QIODevice {
+public:
+  ChunkDecryptingDevice(std::unique_ptr<QFile> file, Stream::Decryptor decryptor)
+      : m_file(std::move(file)), m_decryptor(std::move(decryptor)) {}
+
+  QFile &file() { return *m_file; }
+
+  bool isSequential() const override { return false; }
+  qint64 size() const override { return static_cast<qint64>(m_decryptor.size()); }
+
+  bool loadChunk(size_t index) {
+    if (m_chunkIndex == index) return true;
+
+    m_chunkIndex.reset();
+    m_encrypted.resize(m_decryptor.encryptedChunkSize(index));
+    m_chunk.resize(static_cast<qsizetype>(m_encrypted.size() - Stream::TAG_SIZE));
+
+    auto const encryptedSize = static_cast<qint64>(m_encrypted.size());
+
+    if (!m_file->seek(static_cast<qint64>(m_decryptor.chunkOffset(index))) ||
+        m_file->read(reinterpret_cast<char *>(m_encrypted.data()), encryptedSize) != encryptedSize) {
+      setErrorString(QStringLiteral("Failed to read chunk from %1").arg(m_file->fileName()));
+      return false;
+    }
+
+    std::span<std::byte> const out(reinterpret_cast<std::byte *>(m_chunk.data()), m_chunk.size());
+
+    if (!m_decryptor.decryptChunk(index, m_encrypted, out)) {
+      setErrorString(QStringLiteral("Failed to decrypt chunk from %1").arg(m_file->fileName()));
+      return false;
+    }
+
+    m_chunkIndex = index;
+
+    return true;
+  }
+
+protected:
+  qint64 readData(char *data, qint64 maxSize) override {
+    qint64 const chunkSize = static_cast<qint64>(m_decryptor.chunkSize());
+    qint64 done = 0;
+
+    while (done < maxSize && pos() + done < size()) {
+      qint64 const at = pos() + done;
+      auto const index = static_cast<size_t>(at / chunkSize);
+
+      if (!loadChunk(index)) return done > 0 ? done : -1;
+
+      qint64 const offset = at - static_cast<qint64>(index) * chunkSize;
+      qint64 const n = std::min(maxSize - done, m_chunk.size() - offset);
+
+      std::memcpy(data + done, m_chunk.constData() + offset, n);
+      done += n;
+    }
+
+    return done;
+  }
+
+  qint64 writeData(const char *, qint64) override { return -1; }
+
+private:
+  std::unique_ptr<QFile> m_file;
+  Stream::Decryptor m_decryptor;
+  std::vector<std::byte> m_encrypted;
+  QByteArray m_chunk;
+  std::optional<size_t> m_chunkIndex;
+};
+
+} // namespace
+
 ClipboardEncrypter::EncryptResult ClipboardEncrypter::encrypt(const QByteArray &plain) const {
-  auto encrypted = Crypto::AES256GCM::encrypt(asBytes(plain), asBytes(m_key));
+  auto encrypted = Stream::encrypt(asBytes(plain), asBytes(m_key));
   if (!encrypted) return std::unexpected("Encryption failed");
   return toQByteArray(*encrypted);
 }
 
 ClipboardEncrypter::DecryptResult ClipboardEncrypter::decrypt(const QByteArray &encrypted) const {
+  if (Stream::isContainer(asBytes(encrypted))) {
+    if (auto decrypted = Stream::decrypt(asBytes(encrypted), asBytes(m_key))) return toQByteArray(*decrypted);
+  }
+
+  // written before chunked encryption, or a one-shot IV that happens to look like a container header
   auto decrypted = Crypto::AES256GCM::decrypt(asBytes(encrypted), asBytes(m_key));
   if (!decrypted) return std::unexpected("Decryption failed");
   return toQByteArray(*decrypted);
 }
+
+bool ClipboardEncrypter::encryptTo(const QByteArray &plain, QIODevice &out) const {
+  auto encryptor = Stream::Encryptor::create(asBytes(m_key));
+  if (!encryptor) return false;
+
+  std::vector<std::byte> buf(encryptor->header().begin(), encryptor->header().end());
+  auto const flush = [&]() {
+    auto const size = static_cast<qint64>(buf.size());
+    bool const ok = out.write(reinterpret_cast<const char *>(buf.data()), size) == size;
+    buf.clear();
+    return ok;
+  };
+
+  for (auto data = asBytes(plain); !data.empty();) {
+    auto const piece = data.first(std::min(data.size(), Stream::DEFAULT_CHUNK_SIZE));
+
+    data = data.subspan(piece.size());
+    if (!encryptor->update(piece, buf) || !flush()) return false;
+  }
+
+  return encryptor->finish(buf) && flush();
+}
+
+ClipboardEncrypter::OpenResult ClipboardEncrypter::openDecrypted(std::unique_ptr<QFile> file) const {
+  // written before chunked encryption, or a one-shot IV that happens to look like a container header
+  auto const openWhole = [this](QFile &source) -> OpenResult {
+    if (!source.seek(0)) return std::unexpected(QStringLiteral("Failed to read %1").arg(source.fileName()));
+
+    auto decrypted = Crypto::AES256GCM::decrypt(asBytes(source.readAll()), asBytes(m_key));
+    if (!decrypted) return std::unexpected("Decryption failed");
+
+    auto buffer = std::make_unique<QBuffer>();
+    buffer->setData(toQByteArray(*decrypted));
+    buffer->open(QIODevice::ReadOnly);
+    return buffer;
+  };
+
+  QByteArray const header = file->peek(Stream::HEADER_SIZE);
+
+  if (!Stream::isContainer(asBytes(header))) return openWhole(*file);
+
+  auto decryptor = Stream::Decryptor::open(asBytes(header), file->size(), asBytes(m_key));
+  if (!decryptor) return openWhole(*file);
+
+  auto device = std::make_unique<ChunkDecryptingDevice>(std::move(file), *std::move(decryptor));
+
+  // the device does its own buffering, a chunk at a time
+  device->open(QIODevice::ReadOnly | QIODevice::Unbuffered);
+
+  // fail on a wrong key now rather than on the first read, unless the file was one-shot encrypted after all
+  if (!device->loadChunk(0)) return openWhole(device->file());
+
+  return device;
+}
@@ -1,18 +1,33 @@
 #pragma once
 #include <QByteArray>
+#include <QFile>
+#include <QIODevice>
 #include <QString>
 #include <expected>
+#include <memory>
 
 class ClipboardEncrypter {
 public:
   using EncryptResult = std::expected<QByteArray, QString>;
   using DecryptResult = std::expected<QByteArray, QString>;
+  using OpenResult = std::expected<std::unique_ptr<QIODevice>, QString>;
 
   explicit ClipboardEncrypter(QByteArray key) : m_key(std::move(key)) {}
 
   EncryptResult encrypt(const QByteArray &plain) const;
   DecryptResult decrypt(const QByteArray &encrypted) const;
 
+  /**
+   * Encrypt `plain` to `out` a chunk at a time, without ever holding the whole ciphertext.
+   */
+  bool encryptTo(const QByteArray &plain, QIODevice &out) const;
+
+  /**
+   * Read-only device over the plaintext of `file`, which only decrypts the chunks that get read.
+   * Files written before chunked encryption, header lookalikes included, are decrypted whole upfront.
+   */
+  OpenResult openDecrypted(std::unique_ptr<QFile> file) const;
+
 private:
   QByteArray m_key;
 };
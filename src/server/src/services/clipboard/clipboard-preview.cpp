@@ -0,0 +1,104 @@
+#include "clipboard-preview.hpp"
+#include <QBuffer>
+#include <QImage>
+#include <QImageReader>
+#include <QImageWriter>
+#include <qlogging.h>
+#include "common/clipboard-formats.hpp"
+#include "utils.hpp"
+
+static QByteArray encodeThumbnail(const QImage &image, const QByteArray &format) {
+  static constexpr int THUMBNAIL_QUALITY = 80;
+  QByteArray data;
+  QBuffer buffer(&data);
+
+  buffer.open(QIODevice::WriteOnly);
+  QImageWriter writer(&buffer, format);
+  writer.setQuality(THUMBNAIL_QUALITY);
+
+  if (!writer.write(image)) {
+    qWarning() << "Failed to encode clipboard thumbnail:" << writer.errorString();
+    return {};
+  }
+
+  return data;
+}
+
+static QImage boundedTo(const QImage &image, int size) {
+  if (image.width() <= size && image.height() <= size) return image;
+  return image.scaled(size, size, Qt::KeepAspectRatio, Qt::SmoothTransformation);
+}
+
+namespace Clipboard {
+
+std::vector<GeneratedPreview> generatePreviews(const QString &mimeType, const QByteArray &data) {
+  std::vector<GeneratedPreview> previews;
+
+  if (Utils::isTextMimeType(mimeType) || mimeType == Clipboard::URI_LIST) {
+    QString text = QString::fromUtf8(data.left(EXCERPT_SIZE));
+
+    // a character cut in half at the end of the excerpt
+    while (data.size() > EXCERPT_SIZE && text.endsWith(QChar::ReplacementCharacter)) {
+      text.chop(1);
+    }
+    text.replace(QStringLiteral("\r\n"), QStringLiteral("\n")).replace('\r', '\n').remove(QChar::Null);
+
+    previews.push_back({.kind = ClipboardPreviewKind::Excerpt,
+                        .data = text.toUtf8(),
+                        .mimeType = QStringLiteral("text/plain;charset=utf-8")});
+    return previews;
+  }
+
+  if (!mimeType.startsWith("image/")) return previews;
+
+  QBuffer buffer;
+  QImageReader reader(&buffer);
+
+  buffer.setData(data);
+  reader.setAutoTransform(true);
+
+  // decoders that can (JPEG) decode straight to the smaller size, which is much faster for photos
+  if (QSize const size = reader.size(); size.isValid()) {
+    QSize const bound(THUMBNAIL_SIZE * 2, THUMBNAIL_SIZE * 2);
+    if (size.width() > bound.width() || size.height() > bound.height()) {
+      reader.setScaledSize(size.scaled(bound, Qt::KeepAspectRatio));
+    }
+  }
+
+  QImage const image = reader.read();
+
+  if (image.isNull()) {
+    qWarning() << "Failed to decode clipboard image for its thumbnail:" << reader.errorString();
+    return previews;
+  }
+
+  // not every Qt build has the WebP plugin
+  static bool const hasWebp = QImageWriter::supportedImageFormats().contains("webp");
+  QByteArray format = "webp";
+
+  if (!hasWebp) format = image.hasAlphaChannel() ? "png" : "jpeg";
+
+  QString const thumbnailMime = QStringLiteral("image/") + QString::fromLatin1(format);
+
+  // images smaller than the thumbnails come out the same at both sizes, and share a blob
+  for (auto const [kind, size] : {std::pair{ClipboardPreviewKind::Thumbnail, THUMBNAIL_SIZE},
+                                  std::pair{ClipboardPreviewKind::Thumbnail2x, THUMBNAIL_SIZE * 2}}) {
+    QByteArray encoded = encodeThumbnail(boundedTo(image, size), format);
+    if (encoded.isEmpty()) return {};
+    previews.push_back({.kind = kind, .data = std::move(encoded), .mimeType = thumbnailMime});
+  }
+
+  return previews;
+}
+
+std::optional<std::vector<GeneratedPreview>>
+backfillPreviews(const QString &mimeType, const std::expected<QByteArray, OfferDecryptionError> &data) {
+  if (data) return generatePreviews(mimeType, *data);
+
+  // left for when the clipboard has its key
+  if (data.error() == OfferDecryptionError::DecryptionRequired) return std::nullopt;
+
+  return std::vector<GeneratedPreview>{};
+}
+
+} // namespace Clipboard
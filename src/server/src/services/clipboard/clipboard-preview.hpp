@@ -0,0 +1,41 @@
+#pragma once
+#include <QByteArray>
+#include <QString>
+#include <expected>
+#include <optional>
+#include <vector>
+#include "services/clipboard/clipboard-db.hpp"
+
+namespace Clipboard {
+
+enum class OfferDecryptionError {
+  DecryptionRequired, // if encryption is disabled and data was previous encrypted
+  DecryptionFailed,
+  DataUnavailable,
+};
+
+// enough for the detail panel, which the 1x thumbnail is shown in too
+inline constexpr int THUMBNAIL_SIZE = 384;
+// more than the detail panel ever shows
+inline constexpr qsizetype EXCERPT_SIZE = 10 * 1024;
+
+struct GeneratedPreview {
+  ClipboardPreviewKind kind;
+  QByteArray data;
+  QString mimeType;
+};
+
+/**
+ * An excerpt of text offers, thumbnails bounded to `THUMBNAIL_SIZE` and twice that of image offers,
+ * nothing for the others or for images that can't be decoded.
+ */
+std::vector<GeneratedPreview> generatePreviews(const QString &mimeType, const QByteArray &data);
+
+/**
+ * The previews the backfill stores for an offer read as `data`, empty if it couldn't be read so that the
+ * selection isn't tried again. Nothing if the offer needs a key the clipboard doesn't have yet.
+ */
+std::optional<std::vector<GeneratedPreview>>
+backfillPreviews(const QString &mimeType, const std::expected<QByteArray, OfferDecryptionError> &data);
+
+} // namespace Clipboard
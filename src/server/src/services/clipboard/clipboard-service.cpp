@@ -1,6 +1,7 @@
 #include <QClipboard>
 #include "clipboard-service.hpp"
 #include <algorithm>
+#include <chrono>
 #include <filesystem>
 #include <numeric>
 #include <QGuiApplication>
@@ -22,12 +23,15 @@
 #include <QFutureWatcher>
 #include <QBuffer>
 #include <QImage>
+#include <QMessageAuthenticationCode>
 #include "clipboard-server-factory.hpp"
 #include <quuid.h>
 #include "services/clipboard/clipboard-db.hpp"
+#include "services/clipboard/clipboard-db-executor.hpp"
 #include "services/clipboard/selection-mime-data.hpp"
 #include "services/clipboard/clipboard-encrypter.hpp"
 #include "services/clipboard/clipboard-mime.hpp"
+#include "services/clipboard/clipboard-preview.hpp"
 #include "services/clipboard/clipboard-server.hpp"
 #include "utils.hpp"
 #ifdef Q_OS_LINUX
@@ -45,8 +49,10 @@
 
 namespace fs = std::filesystem;
 
+static constexpr std::chrono::seconds PREVIEW_BACKFILL_DELAY{10};
+
 bool ClipboardService::setPinned(const QString &id, bool pinned) {
-  if (!openDatabase().setPinned(id, pinned)) { return false; }
+  if (!m_db.write([&](ClipboardDatabase &db) { return db.setPinned(id, pinned); })) { return false; }
 
   emit selectionPinStatusChanged(id, pinned);
 
@@ -95,10 +101,15 @@ void ClipboardService::setRecordAllOffers(bool value) { m_recordAllOffers = valu
 
 void ClipboardService::setEncryptionKey(std::optional<db::EncryptionKey> key) {
   if (key) {
-    m_encrypter = std::make_unique<ClipboardEncrypter>(
-        QByteArray(reinterpret_cast<const char *>(key->data()), key->size()));
+    QByteArray const keyData(reinterpret_cast<const char *>(key->data()), key->size());
+
+    m_encrypter = std::make_unique<ClipboardEncrypter>(keyData);
+    // not the encryption key itself, which is only ever used to encrypt
+    m_blobHashKey =
+        QMessageAuthenticationCode::hash("clipboard blob hash", keyData, QCryptographicHash::Sha256);
   } else {
     m_encrypter.reset();
+    m_blobHashKey.clear();
   }
 }
 
@@ -163,9 +174,19 @@ void ClipboardService::scheduleClipboardRestore(int delayMs) {
 
 QFuture<PaginatedResponse<ClipboardHistoryEntry>>
 ClipboardService::listAll(int limit, int offset, const ClipboardListSettings &opts) const {
-  auto key = m_dbKey;
-  return QtConcurrent::run(
-      [opts, limit, offset, key]() { return ClipboardDatabase(key).query(limit, offset, opts); });
+  return m_db.queueRead([this, opts, limit, offset](ClipboardDatabase &db) {
+    auto page = db.query(limit, offset, opts);
+
+    for (auto &entry : page.data) {
+      if (entry.kind != ClipboardOfferKind::Image) continue;
+      if (auto thumbnail = readPreview(db, entry.id, ClipboardPreviewKind::Thumbnail)) {
+        entry.thumbnail = std::move(thumbnail->data);
+        entry.thumbnailMimeType = std::move(thumbnail->mimeType);
+      }
+    }
+
+    return page;
+  });
 }
 
 ClipboardOfferKind ClipboardService::getKind(const ClipboardDataOffer &offer) {
@@ -238,10 +259,10 @@ QString ClipboardService::getSelectionPreferredMimeType(const ClipboardSelection
 }
 
 bool ClipboardService::removeSelection(const QString &selectionId) {
-  auto cdb = openDatabase();
+  auto const unusedFiles = m_db.write([&](ClipboardDatabase &db) { return db.removeSelection(selectionId); });
 
-  for (const auto &offer : cdb.removeSelection(selectionId)) {
-    fs::remove(m_dataDir / offer.toStdString());
+  for (const auto &file : unusedFiles) {
+    fs::remove(m_dataDir / file.toStdString());
   }
 
   emit selectionRemoved(selectionId);
@@ -249,41 +270,56 @@ bool ClipboardService::removeSelection(const QString &selectionId) {
   return true;
 }
 
-std::expected<QByteArray, ClipboardService::OfferDecryptionError>
-ClipboardService::decryptOffer(const QByteArray &data, ClipboardEncryptionType type) const {
+std::expected<std::unique_ptr<QIODevice>, ClipboardService::OfferDecryptionError>
+ClipboardService::openOffer(const QString &file, ClipboardEncryptionType type) const {
+  fs::path const path = m_dataDir / file.toStdString();
+  auto device = std::make_unique<QFile>(path);
+
+  if (!device->open(QIODevice::ReadOnly)) {
+    qWarning() << "Failed to open file at" << path;
+    return std::unexpected(OfferDecryptionError::DataUnavailable);
+  }
+
   switch (type) {
   case ClipboardEncryptionType::Local: {
     if (!m_encrypter) { return std::unexpected(OfferDecryptionError::DecryptionRequired); }
-    auto decryption = m_encrypter->decrypt(data);
-    if (!decryption) { return std::unexpected(OfferDecryptionError::DecryptionFailed); }
-    return decryption.value();
+    auto decrypted = m_encrypter->openDecrypted(std::move(device));
+    if (!decrypted) { return std::unexpected(OfferDecryptionError::DecryptionFailed); }
+    return std::move(decrypted).value();
   }
   default:
-    return data;
+    return device;
   }
 }
 
 std::expected<QByteArray, ClipboardService::OfferDecryptionError>
-ClipboardService::getMainOfferData(const QString &selectionId) const {
-  auto cdb = openDatabase();
+ClipboardService::readOffer(QIODevice &device) {
+  QByteArray data = device.readAll();
 
-  auto offer = cdb.findPreferredOffer(selectionId);
+  // a chunk failing to decrypt halfway through
+  if (data.size() != device.size()) {
+    qWarning() << "Failed to read clipboard offer:" << device.errorString();
+    return std::unexpected(OfferDecryptionError::DecryptionFailed);
+  }
+
+  return data;
+}
+
+std::expected<std::unique_ptr<QIODevice>, ClipboardService::OfferDecryptionError>
+ClipboardService::openMainOffer(const QString &selectionId) const {
+  auto offer = m_db.read([&](ClipboardDatabase &db) { return db.findPreferredOffer(selectionId); });
 
   if (!offer) {
     qWarning() << "Can't find preferred offer for selection" << selectionId;
     return std::unexpected(OfferDecryptionError::DataUnavailable);
   };
 
-  fs::path const path = m_dataDir / offer->id.toStdString();
-
-  QFile file(path);
-
-  if (!file.open(QIODevice::ReadOnly)) {
-    qWarning() << "Failed to open file at" << path;
-    return std::unexpected(OfferDecryptionError::DataUnavailable);
-  }
+  return openOffer(offer->file, offer->encryption);
+}
 
-  return decryptOffer(file.readAll(), offer->encryption);
+std::expected<QByteArray, ClipboardService::OfferDecryptionError>
+ClipboardService::getMainOfferData(const QString &selectionId) const {
+  return openMainOffer(selectionId).and_then([](auto &&device) { return readOffer(*device); });
 }
 
 QByteArray ClipboardService::computeSelectionHash(const ClipboardSelection &selection) const {
@@ -296,6 +332,30 @@ QByteArray ClipboardService::computeSelectionHash(const ClipboardSelection &sele
   return hash.result();
 }
 
+QString ClipboardService::computeBlobHash(const QByteArray &data) const {
+  if (m_encrypter) {
+    return QMessageAuthenticationCode::hash(data, m_blobHashKey, QCryptographicHash::Blake2b_256).toHex();
+  }
+
+  return QCryptographicHash::hash(data, QCryptographicHash::Blake2b_256).toHex();
+}
+
+bool ClipboardService::writeBlob(const QString &hash, const QByteArray &data) const {
+  fs::path const targetPath = m_dataDir / hash.toStdString();
+  QFile targetFile(targetPath);
+
+  if (!targetFile.open(QIODevice::WriteOnly)) {
+    qWarning() << "Failed to open clipboard blob at" << targetPath;
+    return false;
+  }
+
+  if (!m_encrypter) return targetFile.write(data) == data.size();
+  if (m_encrypter->encryptTo(data, targetFile)) return true;
+
+  qWarning() << "Failed to encrypt clipboard selection";
+  return false;
+}
+
 bool ClipboardService::isClearSelection(const ClipboardSelection &selection) const {
   return std::accumulate(selection.offers.begin(), selection.offers.end(), 0,
                          [](size_t acc, auto &&item) { return acc + item.data.size(); }) == 0;
@@ -323,11 +383,11 @@ QString ClipboardService::getOfferTextPreview(const ClipboardDataOffer &offer) {
 }
 
 std::optional<QString> ClipboardService::retrieveKeywords(const QString &id) {
-  return openDatabase().retrieveKeywords(id);
+  return m_db.read([&](ClipboardDatabase &db) { return db.retrieveKeywords(id); });
 }
 
 bool ClipboardService::setKeywords(const QString &id, const QString &keywords) {
-  return openDatabase().setKeywords(id, keywords);
+  return m_db.write([&](ClipboardDatabase &db) { return db.setKeywords(id, keywords); });
 }
 
 ClipboardSelection &ClipboardService::sanitizeSelection(ClipboardSelection &selection) {
@@ -400,124 +460,351 @@ void ClipboardService::saveSelection(ClipboardSelection selection) {
     return;
   }
 
-  // we wait synchronously instead of queuing, in practice this will almost never happen,
-  // so adding queuing infrastructure seems unnecessary here.
-  if (m_indexingSelection.isRunning()) m_indexingSelection.waitForFinished();
-
-  m_indexingSelection.setFuture(
-      QtConcurrent::run([this, selection = std::move(selection), selectionHash, preferredKind,
-                         preferredMimeType]() -> std::expected<ClipboardHistoryEntry, QString> {
-        ClipboardHistoryEntry insertedEntry;
-        auto cdb = openDatabase();
-        const bool ok = cdb.transaction([&](ClipboardDatabase *db) {
-          if (db->tryBubbleUpSelection(selectionHash)) {
-            qInfo() << "A similar clipboard selection is already indexed: moving it on top of the history";
-            return true;
-          }
-
-          QString const selectionId = QUuid::createUuid().toString(QUuid::WithoutBraces);
-
-          if (!db->insertSelection({.id = selectionId,
-                                    .offerCount = static_cast<int>(selection.offers.size()),
-                                    .hash = selectionHash,
-                                    .preferredMimeType = preferredMimeType,
-                                    .kind = preferredKind,
-                                    .source = selection.sourceApp})) {
-            qWarning() << "failed to insert selection";
-            return false;
-          }
-
-          // Index all offers, including empty ones
-          for (const auto &offer : selection.offers) {
-            ClipboardOfferKind const kind = getKind(offer);
-            bool const isIndexableText = kind == ClipboardOfferKind::Text || kind == ClipboardOfferKind::Link;
-            QString const textPreview = getOfferTextPreview(offer);
-
-            if (isIndexableText && !offer.data.isEmpty()) {
-              if (!db->indexSelectionContent(selectionId, offer.data)) {
-                qWarning() << "Failed to index selection content for offer" << offer.mimeType;
-                return false;
-              }
-            }
-
-            auto md5sum = QCryptographicHash::hash(offer.data, QCryptographicHash::Md5).toHex();
-            auto offerId = QUuid::createUuid().toString(QUuid::WithoutBraces);
-            ClipboardEncryptionType encryption = ClipboardEncryptionType::None;
-
-            if (m_encrypter) encryption = ClipboardEncryptionType::Local;
-
-            InsertClipboardOfferPayload dto{
-                .id = offerId,
-                .selectionId = selectionId,
-                .mimeType = offer.mimeType,
-                .textPreview = textPreview,
-                .md5sum = md5sum,
-                .encryption = encryption,
-                .size = static_cast<quint64>(offer.data.size()),
-            };
-
-            if (kind == ClipboardOfferKind::Link) {
-              auto url = QUrl::fromEncoded(offer.data, QUrl::StrictMode);
-              if (url.scheme().startsWith("http")) { dto.urlHost = url.host(); }
-            }
-
-            if (!db->insertOffer(dto)) {
-              qWarning() << "Failed to insert offer" << offer.mimeType;
-              return false;
-            }
-
-            fs::path const targetPath = m_dataDir / offerId.toStdString();
-            QFile targetFile(targetPath);
-
-            if (!targetFile.open(QIODevice::WriteOnly)) { continue; }
-
-            if (m_encrypter) {
-              if (auto encrypted = m_encrypter->encrypt(offer.data)) {
-                targetFile.write(encrypted.value());
-                ClipboardHistoryEntry insertedEntry;
-              } else {
-                qWarning() << "Failed to encrypt clipboard selection";
-                return false;
-              }
-            } else {
-              targetFile.write(offer.data);
-            }
-
-            // Set the insertedEntry for the preferred offer
-            if (offer.mimeType == preferredMimeType) {
-              insertedEntry.id = selectionId;
-              insertedEntry.pinnedAt = 0;
-              insertedEntry.updatedAt = {};
-              insertedEntry.mimeType = offer.mimeType;
-              insertedEntry.md5sum = md5sum;
-              insertedEntry.textPreview = textPreview;
-            }
-          }
-
-          return true;
+  m_pending.push_back({.selection = std::move(selection),
+                       .hash = selectionHash,
+                       .kind = preferredKind,
+                       .preferredMimeType = preferredMimeType});
+
+  if (!m_ingestionScheduled) scheduleIngestion();
+}
+
+void ClipboardService::scheduleIngestion() {
+  m_ingestionScheduled = true;
+
+  m_db.queue([this, batch = std::exchange(m_pending, {})]() { return ingest(batch); })
+      .then(this, [this](const std::vector<IndexedSelection> &indexed) {
+        m_ingestionScheduled = false;
+        if (!m_pending.empty()) scheduleIngestion();
+
+        for (const auto &[entry, data] : indexed) {
+          // a selection moved on top already has previews
+          if (!entry.id.isEmpty()) queuePreviews(entry.id, entry.mimeType, data);
+          emit itemInserted(entry);
+        }
+      });
+}
+
+std::vector<ClipboardService::IndexedSelection>
+ClipboardService::ingest(const std::vector<PendingSelection> &batch) const {
+  // Aliases of the same data (text/plain, UTF8_STRING, TEXT...) share a blob, hashed only once.
+  // Hashed before taking the writer, which doesn't need to wait on it.
+  std::vector<std::vector<QString>> blobHashes;
+  blobHashes.reserve(batch.size());
+
+  for (const auto &pending : batch) {
+    auto const &offers = pending.selection.offers;
+    auto &hashes = blobHashes.emplace_back(offers.size());
+
+    for (size_t i = 0; i != offers.size(); ++i) {
+      size_t same = 0;
+
+      while (same != i && offers[same].data != offers[i].data) {
+        ++same;
+      }
+      hashes[i] = same == i ? computeBlobHash(offers[i].data) : hashes[same];
+    }
+  }
+
+  std::vector<IndexedSelection> indexed;
+  std::vector<QString> writtenBlobs;
+
+  // files of blobs the database does not have after all
+  auto const removeBlobs = [this](const std::vector<QString> &hashes) {
+    for (const auto &hash : hashes) {
+      std::error_code ec;
+      fs::remove(m_dataDir / hash.toStdString(), ec);
+    }
+  };
+
+  bool const committed = m_db.write([&](ClipboardDatabase &cdb) {
+    // a selection failing to index only undoes its own part of the batch
+    return cdb.transaction([&](ClipboardDatabase *db) {
+      for (size_t i = 0; i != batch.size(); ++i) {
+        std::optional<ClipboardHistoryEntry> entry;
+        std::vector<QString> written;
+
+        db->savepoint([&](ClipboardDatabase *sp) {
+          entry = indexSelection(*sp, batch[i], blobHashes[i], written);
+          return entry.has_value();
         });
 
-        if (!ok) return std::unexpected(QStringLiteral("Failed to insert selection"));
+        if (entry) {
+          auto const &offers = batch[i].selection.offers;
+          auto const preferred = std::ranges::find_if(
+              offers, [&](auto &&offer) { return offer.mimeType == batch[i].preferredMimeType; });
+
+          indexed.push_back({.entry = *std::move(entry), .data = preferred->data});
+          writtenBlobs.insert(writtenBlobs.end(), written.begin(), written.end());
+        } else {
+          qWarning() << "Failed to insert selection";
+          removeBlobs(written);
+        }
+      }
+
+      return true;
+    });
+  });
 
-        return insertedEntry;
-      }));
+  if (!committed) {
+    qWarning() << "Failed to commit clipboard selections, dropping" << indexed.size() << "of them";
+    removeBlobs(writtenBlobs);
+    indexed.clear();
+  }
+
+  return indexed;
+}
+
+std::optional<ClipboardHistoryEntry>
+ClipboardService::indexSelection(ClipboardDatabase &db, const PendingSelection &pending,
+                                 const std::vector<QString> &blobHashes,
+                                 std::vector<QString> &writtenBlobs) const {
+  auto const &[selection, selectionHash, preferredKind, preferredMimeType] = pending;
+  ClipboardHistoryEntry insertedEntry{};
+
+  if (db.tryBubbleUpSelection(selectionHash)) {
+    qInfo() << "A similar clipboard selection is already indexed: moving it on top of the history";
+    return insertedEntry;
+  }
+
+  QString const selectionId = QUuid::createUuid().toString(QUuid::WithoutBraces);
+
+  if (!db.insertSelection({.id = selectionId,
+                           .offerCount = static_cast<int>(selection.offers.size()),
+                           .hash = selectionHash,
+                           .preferredMimeType = preferredMimeType,
+                           .kind = preferredKind,
+                           .source = selection.sourceApp})) {
+    qWarning() << "failed to insert selection";
+    return std::nullopt;
+  }
+
+  // Index all offers, including empty ones
+  for (size_t i = 0; i != selection.offers.size(); ++i) {
+    const auto &offer = selection.offers[i];
+    QString const &blobHash = blobHashes[i];
+    ClipboardOfferKind const kind = getKind(offer);
+    bool const isIndexableText = kind == ClipboardOfferKind::Text || kind == ClipboardOfferKind::Link;
+    QString const textPreview = getOfferTextPreview(offer);
+
+    if (isIndexableText && !offer.data.isEmpty()) {
+      if (!db.indexSelectionContent(selectionId, offer.data)) {
+        qWarning() << "Failed to index selection content for offer" << offer.mimeType;
+        return std::nullopt;
+      }
+    }
+
+    // only ever shown for the preferred offer, which the selection hash is the md5 of already
+    bool const isPreferred = offer.mimeType == preferredMimeType;
+    auto md5sum = isPreferred ? QString(selectionHash) : QString();
+    auto offerId = QUuid::createUuid().toString(QUuid::WithoutBraces);
+    ClipboardEncryptionType encryption = ClipboardEncryptionType::None;
+
+    if (m_encrypter) encryption = ClipboardEncryptionType::Local;
+
+    if (!db.hasBlob(blobHash)) {
+      InsertClipboardBlobPayload const blob{
+          .hash = blobHash,
+          .encryption = encryption,
+          .size = static_cast<quint64>(offer.data.size()),
+      };
+
+      bool const inserted = db.insertBlob(blob);
+
+      if (inserted) writtenBlobs.emplace_back(blobHash);
+
+      if (!inserted || !writeBlob(blobHash, offer.data)) {
+        qWarning() << "Failed to store data for offer" << offer.mimeType;
+        return std::nullopt;
+      }
+    }
+
+    InsertClipboardOfferPayload dto{
+        .id = offerId,
+        .selectionId = selectionId,
+        .blobHash = blobHash,
+        .mimeType = offer.mimeType,
+        .textPreview = textPreview,
+        .md5sum = md5sum,
+        .encryption = encryption,
+        .size = static_cast<quint64>(offer.data.size()),
+    };
+
+    if (kind == ClipboardOfferKind::Link) {
+      auto url = QUrl::fromEncoded(offer.data, QUrl::StrictMode);
+      if (url.scheme().startsWith("http")) { dto.urlHost = url.host(); }
+    }
+
+    if (!db.insertOffer(dto)) {
+      qWarning() << "Failed to insert offer" << offer.mimeType;
+      return std::nullopt;
+    }
+
+    // Set the insertedEntry for the preferred offer
+    if (isPreferred) {
+      insertedEntry.id = selectionId;
+      insertedEntry.mimeType = offer.mimeType;
+      insertedEntry.md5sum = md5sum;
+      insertedEntry.textPreview = textPreview;
+    }
+  }
+
+  return insertedEntry;
+}
+
+bool ClipboardService::storePreviews(const QString &selectionId,
+                                     const std::vector<Clipboard::GeneratedPreview> &previews) const {
+  std::vector<QString> hashes;
+  std::vector<QString> unusedFiles;
+
+  hashes.reserve(previews.size());
+  for (const auto &preview : previews) {
+    hashes.emplace_back(computeBlobHash(preview.data));
+  }
+
+  bool const ok = m_db.write([&](ClipboardDatabase &cdb) {
+    return cdb.transaction([&](ClipboardDatabase *db) {
+      // checked first, so that no blob gets written for a selection removed in the meantime
+      if (!db->setPreviewVersion(selectionId, PREVIEW_VERSION)) return false;
+      if (!db->removePreviews(selectionId)) return false;
+
+      ClipboardEncryptionType const encryption =
+          m_encrypter ? ClipboardEncryptionType::Local : ClipboardEncryptionType::None;
+
+      for (size_t i = 0; i != previews.size(); ++i) {
+        auto const &preview = previews[i];
+
+        if (!db->hasBlob(hashes[i])) {
+          InsertClipboardBlobPayload const blob{
+              .hash = hashes[i],
+              .encryption = encryption,
+              .size = static_cast<quint64>(preview.data.size()),
+          };
+
+          if (!db->insertBlob(blob) || !writeBlob(hashes[i], preview.data)) return false;
+        }
+
+        if (!db->insertPreview({.selectionId = selectionId,
+                                .kind = preview.kind,
+                                .blobHash = hashes[i],
+                                .mimeType = preview.mimeType})) {
+          return false;
+        }
+      }
+
+      // those of the previews replaced, if they were made by an older version
+      unusedFiles = db->removeUnusedBlobs();
+
+      return true;
+    });
+  });
+
+  if (!ok) return false;
+
+  for (const auto &file : unusedFiles) {
+    fs::remove(m_dataDir / file.toStdString());
+  }
+
+  return true;
+}
+
+void ClipboardService::queuePreviews(const QString &selectionId, const QString &mimeType,
+                                     const QByteArray &data) {
+  QtConcurrent::run(&m_previewPool,
+                    [this, selectionId, mimeType, data]() {
+                      auto const previews = Clipboard::generatePreviews(mimeType, data);
+
+                      if (!storePreviews(selectionId, previews)) {
+                        qWarning() << "Failed to store previews for selection" << selectionId;
+                        return false;
+                      }
+
+                      return mimeType.startsWith("image/") && !previews.empty();
+                    })
+      .then(this, [this](bool thumbnailed) {
+        // for the list to pick the thumbnail up
+        if (thumbnailed) emit selectionUpdated();
+      });
+}
+
+ClipboardService::PreviewBackfill ClipboardService::backfillPreviewBatch(const QString &afterId) const {
+  static constexpr int BATCH_SIZE = 8;
+  PreviewBackfill backfill;
+
+  auto const ids = m_db.read(
+      [&](ClipboardDatabase &db) { return db.findOutdatedPreviews(PREVIEW_VERSION, afterId, BATCH_SIZE); });
+
+  for (const auto &id : ids) {
+    backfill.lastId = id;
+
+    auto const offer = m_db.read([&](ClipboardDatabase &db) { return db.findPreferredOffer(id); });
+    std::expected<QByteArray, OfferDecryptionError> data =
+        std::unexpected(OfferDecryptionError::DataUnavailable);
+
+    if (offer) {
+      data = openOffer(offer->file, offer->encryption).and_then([](auto &&device) {
+        return readOffer(*device);
+      });
+    }
+
+    auto const previews = Clipboard::backfillPreviews(offer ? offer->mimeType : QString(), data);
+
+    if (!previews) continue;
+
+    // stored even if there are none, for the selection not to be tried again
+    if (!storePreviews(id, *previews)) {
+      qWarning() << "Failed to store previews for selection" << id;
+      continue;
+    }
+
+    if (offer && offer->mimeType.startsWith("image/") && !previews->empty()) backfill.storedThumbnails = true;
+  }
+
+  return backfill;
+}
+
+void ClipboardService::backfillPreviews(const QString &afterId) {
+  QtConcurrent::run(&m_previewPool, [this, afterId]() { return backfillPreviewBatch(afterId); })
+      .then(this, [this](const PreviewBackfill &backfill) {
+        if (backfill.storedThumbnails) emit selectionUpdated();
+        if (!backfill.lastId.isEmpty()) backfillPreviews(backfill.lastId);
+      });
+}
+
+std::optional<ClipboardService::Preview> ClipboardService::readPreview(ClipboardDatabase &db,
+                                                                      const QString &selectionId,
+                                                                      ClipboardPreviewKind kind) const {
+  auto const record = db.findPreview(selectionId, kind);
+  if (!record) return std::nullopt;
+
+  auto data = openOffer(record->file, record->encryption).and_then([](auto &&device) {
+    return readOffer(*device);
+  });
+  if (!data) return std::nullopt;
+
+  return Preview{.data = *std::move(data), .mimeType = record->mimeType};
+}
+
+std::optional<ClipboardService::Preview> ClipboardService::retrievePreview(const QString &selectionId,
+                                                                          ClipboardPreviewKind kind) const {
+  return m_db.read([&](ClipboardDatabase &db) { return readPreview(db, selectionId, kind); });
 }
 
 std::optional<ClipboardSelection> ClipboardService::retrieveSelectionById(const QString &id) {
-  auto cdb = openDatabase();
   ClipboardSelection populatedSelection;
-  const auto selection = cdb.findSelection(id);
+  const auto selection = m_db.read([&](ClipboardDatabase &db) { return db.findSelection(id); });
 
   if (!selection) return std::nullopt;
 
   for (const auto &offer : selection->offers) {
     ClipboardDataOffer populatedOffer;
-    fs::path const path = m_dataDir / offer.id.toStdString();
-    QFile file(path);
+    auto device = openOffer(offer.file, offer.encryption);
 
-    if (!file.open(QIODevice::ReadOnly)) { continue; }
+    if (!device) {
+      if (device.error() == OfferDecryptionError::DataUnavailable) continue;
+      return {};
+    }
 
-    auto data = decryptOffer(file.readAll(), offer.encryption);
+    auto data = readOffer(**device);
 
     if (!data) return {};
 
@@ -591,9 +878,7 @@ bool ClipboardService::copySelectionRecord(const QString &id, const Clipboard::C
     return false;
   }
 
-  auto db = openDatabase();
-
-  if (!db.tryBubbleUpSelection(id)) {
+  if (!m_db.write([&](ClipboardDatabase &db) { return db.tryBubbleUpSelection(id); })) {
     qWarning() << "Failed to bubble up selection with id" << id;
     return false;
   }
@@ -624,9 +909,7 @@ Clipboard::ReadContent ClipboardService::readContent() {
 }
 
 bool ClipboardService::removeAllSelections() {
-  auto db = openDatabase();
-
-  if (!db.removeAll()) {
+  if (!m_db.write([](ClipboardDatabase &db) { return db.removeAll(); })) {
     qWarning() << "Failed to remove all clipboard selections";
     return false;
   }
@@ -642,7 +925,7 @@ bool ClipboardService::removeAllSelections() {
 AbstractClipboardServer *ClipboardService::clipboardServer() const { return m_clipboardServer.get(); }
 
 ClipboardService::ClipboardService(const std::filesystem::path &path, std::optional<db::EncryptionKey> key)
-    : m_dbKey(key) {
+    : m_db(key) {
   m_dataDir = path.parent_path() / "clipboard-data";
 
   {
@@ -664,12 +947,19 @@ ClipboardService::ClipboardService(const std::filesystem::path &path, std::optio
   }
 
   fs::create_directories(m_dataDir);
-  openDatabase().runMigrations();
+  m_db.write([](ClipboardDatabase &db) { db.runMigrations(); });
 
   connect(m_clipboardServer.get(), &AbstractClipboardServer::selectionAdded, this,
           &ClipboardService::saveSelection);
-  connect(&m_indexingSelection, &decltype(m_indexingSelection)::finished, this, [this]() {
-    if (m_indexingSelection.isCanceled()) return;
-    if (auto result = m_indexingSelection.result()) { emit itemInserted(*result); }
-  });
+
+  m_previewPool.setMaxThreadCount(1);
+  m_previewPool.setThreadPriority(QThread::LowPriority);
+
+  // out of the way of startup, and after the encryption key is set
+  QTimer::singleShot(PREVIEW_BACKFILL_DELAY, this, [this]() { backfillPreviews(); });
+}
+
+ClipboardService::~ClipboardService() {
+  // whatever didn't get its previews yet gets them from the next backfill
+  m_previewPool.clear();
 }
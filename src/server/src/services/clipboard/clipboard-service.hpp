@@ -3,7 +3,9 @@
 #include "common/types.hpp"
 #include "services/clipboard/clipboard-content.hpp"
 #include "services/clipboard/clipboard-db.hpp"
+#include "services/clipboard/clipboard-db-executor.hpp"
 #include "services/clipboard/clipboard-encrypter.hpp"
+#include "services/clipboard/clipboard-preview.hpp"
 #include "services/clipboard/clipboard-server.hpp"
 #include <QString>
 #include <expected>
@@ -19,6 +21,7 @@
 #include <qmimedata.h>
 #include <qmimedatabase.h>
 #include <qstringview.h>
+#include <QThreadPool>
 #include <QTimer>
 
 class ClipboardService : public QObject, public NonCopyable {
@@ -32,19 +35,21 @@ signals:
   void selectionRemoved(const QString &id) const;
   /**
    * When a selection is copied, its update time is modified which makes it appear on top
-   * of the list.
+   * of the list. Also emitted once thumbnails are ready for selections that had none.
    */
   void selectionUpdated() const;
   void monitoringChanged(bool value) const;
 
 public:
-  enum class OfferDecryptionError {
-    DecryptionRequired, // if encryption is disabled and data was previous encrypted
-    DecryptionFailed,
-    DataUnavailable,
+  using OfferDecryptionError = Clipboard::OfferDecryptionError;
+
+  struct Preview {
+    QByteArray data;
+    QString mimeType;
   };
 
   ClipboardService(const std::filesystem::path &path, std::optional<db::EncryptionKey> key = std::nullopt);
+  ~ClipboardService() override;
 
   static QString readText();
   static Clipboard::ReadContent readContent();
@@ -55,6 +60,18 @@ public:
   bool setKeywords(const QString &id, const QString &keywords);
 
   std::expected<QByteArray, OfferDecryptionError> getMainOfferData(const QString &selectionId) const;
+
+  /**
+   * Like `getMainOfferData`, but reads the data from disk as it is consumed instead of all at once.
+   */
+  std::expected<std::unique_ptr<QIODevice>, OfferDecryptionError>
+  openMainOffer(const QString &selectionId) const;
+
+  /**
+   * A rendition of the selection made when it was indexed, small enough to be shown without reading its
+   * data. Selections indexed before previews existed get theirs from a backfill shortly after startup.
+   */
+  std::optional<Preview> retrievePreview(const QString &selectionId, ClipboardPreviewKind kind) const;
   AbstractClipboardServer *clipboardServer() const;
   bool removeSelection(const QString &id);
   bool setPinned(const QString &id, bool pinned);
@@ -93,13 +110,21 @@ public:
   bool isEncryptionReady() const;
 
 private:
-  ClipboardDatabase openDatabase() const { return ClipboardDatabase(m_dbKey); }
+  /**
+   * A selection waiting for the write lane to index it.
+   */
+  struct PendingSelection {
+    ClipboardSelection selection;
+    QByteArray hash;
+    ClipboardOfferKind kind;
+    QString preferredMimeType;
+  };
 
   std::unique_ptr<ClipboardEncrypter> m_encrypter;
+  QByteArray m_blobHashKey;
 
   QMimeDatabase _mimeDb;
   std::filesystem::path m_dataDir;
-  std::optional<db::EncryptionKey> m_dbKey;
   std::unique_ptr<AbstractClipboardServer> m_clipboardServer;
 
   static QString getSelectionPreferredMimeType(const ClipboardSelection &selection);
@@ -112,17 +137,76 @@ private:
   QByteArray computeSelectionHash(const ClipboardSelection &selection) const;
   bool isClearSelection(const ClipboardSelection &selection) const;
 
+  /**
+   * Hash the data of an offer is stored under. Keyed when encrypting, so that the names of the files do
+   * not give away what they hold.
+   */
+  QString computeBlobHash(const QByteArray &data) const;
+  bool writeBlob(const QString &hash, const QByteArray &data) const;
+
   /**
    * Sanitize the passed selection by removing duplicate offers.
    * The selection is sanitized in place, no copy is made.
    */
   static ClipboardSelection &sanitizeSelection(ClipboardSelection &selection);
 
-  std::expected<QByteArray, ClipboardService::OfferDecryptionError>
-  decryptOffer(const QByteArray &data, ClipboardEncryptionType type) const;
+  std::expected<std::unique_ptr<QIODevice>, OfferDecryptionError>
+  openOffer(const QString &file, ClipboardEncryptionType type) const;
+  static std::expected<QByteArray, OfferDecryptionError> readOffer(QIODevice &device);
 
   static ClipboardOfferKind getKind(const ClipboardDataOffer &offer);
 
+  /**
+   * Hand what is pending to the write lane, all of it indexed in a single transaction.
+   * Whatever arrives while it runs waits for it to finish and forms the next batch.
+   */
+  void scheduleIngestion();
+
+  struct IndexedSelection {
+    ClipboardHistoryEntry entry;
+    // of the preferred offer, to make previews from
+    QByteArray data;
+  };
+
+  std::vector<IndexedSelection> ingest(const std::vector<PendingSelection> &batch) const;
+
+  /**
+   * Returns the entry to announce, which is empty if a similar selection was moved on top instead.
+   * The hashes of the blob files it writes are added to `writtenBlobs`, to remove if it is rolled back.
+   */
+  std::optional<ClipboardHistoryEntry> indexSelection(ClipboardDatabase &db, const PendingSelection &pending,
+                                                      const std::vector<QString> &blobHashes,
+                                                      std::vector<QString> &writtenBlobs) const;
+
+  /**
+   * Bumped when what `Clipboard::generatePreviews` makes changes, for the backfill to redo existing
+   * previews.
+   */
+  static constexpr int PREVIEW_VERSION = 1;
+
+  /**
+   * Generate the previews of a selection on the preview pool. `data` is that of its preferred offer.
+   */
+  void queuePreviews(const QString &selectionId, const QString &mimeType, const QByteArray &data);
+  bool storePreviews(const QString &selectionId,
+                     const std::vector<Clipboard::GeneratedPreview> &previews) const;
+
+  struct PreviewBackfill {
+    // to resume from, empty once there is nothing left
+    QString lastId;
+    bool storedThumbnails = false;
+  };
+
+  /**
+   * Generate the previews of the selections indexed before the current `PREVIEW_VERSION`, one batch at a
+   * time, so that the backfill stops with the service.
+   */
+  void backfillPreviews(const QString &afterId = {});
+  PreviewBackfill backfillPreviewBatch(const QString &afterId) const;
+
+  std::optional<Preview> readPreview(ClipboardDatabase &db, const QString &selectionId,
+                                     ClipboardPreviewKind kind) const;
+
   void restoreClipboard();
 
   bool m_recordAllOffers = true;
@@ -130,5 +214,11 @@ private:
   bool m_ignorePasswords = true;
   std::optional<ClipboardSelection> m_lastSelection;
   QTimer m_restoreTimer;
-  QFutureWatcher<std::expected<ClipboardHistoryEntry, QString>> m_indexingSelection;
+  std::vector<PendingSelection> m_pending;
+  bool m_ingestionScheduled = false;
+
+  // last, so that queued writes are done before the rest of the service goes away
+  mutable ClipboardDbExecutor m_db;
+  // after the database, which its jobs write to
+  QThreadPool m_previewPool;
 };
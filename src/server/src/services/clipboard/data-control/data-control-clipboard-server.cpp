@@ -3,8 +3,16 @@
 #include "services/clipboard/clipboard-server.hpp"
 #include <QtCore>
 #include <QGuiApplication>
+#include <cerrno>
 #include <cstdint>
+#include <cstring>
+#include <fcntl.h>
 #include <netinet/in.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <tuple>
+#include <unistd.h>
+#include <utility>
 #include <qlogging.h>
 #include <qprocess.h>
 #include <qdebug.h>
@@ -63,7 +71,32 @@ bool DataControlClipboardServer::start() {
 
   if (pidFile.exists() && pidFile.kill()) { qInfo() << "Killed existing data-control-server instance"; }
 
-  m_process.start(path->c_str(), {});
+  QStringList args;
+  int sockets[2];
+  int childSocket = -1;
+
+  if (m_fdSocket != -1) {
+    close(m_fdSocket);
+    m_fdSocket = -1;
+  }
+
+  // a new helper numbers its selections from the start again
+  dropNextFd();
+
+  // large offers come as memfds on this socket instead of being copied through stdout
+  if (socketpair(AF_UNIX, SOCK_SEQPACKET | SOCK_CLOEXEC, 0, sockets) == 0) {
+    m_fdSocket = sockets[0];
+    childSocket = sockets[1];
+    args << clipboard_proto::FD_SOCKET_ARG << QString::number(childSocket);
+    m_process.setChildProcessModifier([childSocket]() { fcntl(childSocket, F_SETFD, 0); });
+  } else {
+    qWarning() << "Failed to create data-control fd socket, large offers will be inlined:" << strerror(errno);
+    m_process.setChildProcessModifier({});
+  }
+
+  m_process.start(path->c_str(), args);
+
+  if (childSocket != -1) close(childSocket);
 
   if (!m_process.waitForStarted(maxWaitForStart)) {
     qCritical() << "Failed to start data-control-server process" << m_process.errorString();
@@ -81,6 +114,92 @@ void DataControlClipboardServer::handleReadError() {
   }
 }
 
+std::optional<DataControlClipboardServer::SpooledFd> DataControlClipboardServer::receiveFd() {
+  SpooledFd received;
+  iovec iov{.iov_base = &received.offer, .iov_len = sizeof(received.offer)};
+  alignas(cmsghdr) char control[CMSG_SPACE(sizeof(int))] = {};
+  msghdr msg{};
+
+  msg.msg_iov = &iov;
+  msg.msg_iovlen = 1;
+  msg.msg_control = control;
+  msg.msg_controllen = sizeof(control);
+
+  ssize_t rc = 0;
+
+  // sent ahead of the selection, so it is already there if it is coming at all
+  do {
+    rc = recvmsg(m_fdSocket, &msg, MSG_DONTWAIT | MSG_CMSG_CLOEXEC);
+  } while (rc == -1 && errno == EINTR);
+
+  cmsghdr *cmsg = rc > 0 ? CMSG_FIRSTHDR(&msg) : nullptr;
+
+  if (!cmsg || cmsg->cmsg_level != SOL_SOCKET || cmsg->cmsg_type != SCM_RIGHTS) return std::nullopt;
+
+  std::memcpy(&received.fd, CMSG_DATA(cmsg), sizeof(received.fd));
+
+  if (rc != sizeof(received.offer)) {
+    close(received.fd);
+    return std::nullopt;
+  }
+
+  return received;
+}
+
+void DataControlClipboardServer::dropNextFd() {
+  if (m_nextFd) close(m_nextFd->fd);
+  m_nextFd.reset();
+}
+
+std::optional<QByteArray> DataControlClipboardServer::receiveSpooledOffer(uint64_t selection,
+                                                                         uint32_t offer) {
+  int fd = -1;
+
+  while (fd == -1) {
+    auto next = m_nextFd ? std::exchange(m_nextFd, std::nullopt) : receiveFd();
+    if (!next) return std::nullopt;
+
+    auto const key = std::tie(next->offer.selection, next->offer.offer);
+
+    if (key == std::tie(selection, offer)) {
+      fd = next->fd;
+    } else if (key > std::tie(selection, offer)) {
+      // ours never came
+      m_nextFd = next;
+      return std::nullopt;
+    } else {
+      qWarning() << "data-control: dropping memfd of offer" << next->offer.offer << "of selection"
+                 << next->offer.selection;
+      close(next->fd);
+    }
+  }
+
+  struct stat st{};
+  constexpr int REQUIRED_SEALS = F_SEAL_SHRINK | F_SEAL_WRITE;
+
+  // sealed, so that its size and contents can't change while we read it
+  if ((fcntl(fd, F_GET_SEALS) & REQUIRED_SEALS) != REQUIRED_SEALS || fstat(fd, &st) == -1) {
+    close(fd);
+    return std::nullopt;
+  }
+
+  QByteArray data(st.st_size, Qt::Uninitialized);
+  qsizetype done = 0;
+
+  while (done < data.size()) {
+    ssize_t const rc = pread(fd, data.data() + done, data.size() - done, done);
+    if (rc == -1 && errno == EINTR) continue;
+    if (rc <= 0) break;
+    done += rc;
+  }
+
+  close(fd);
+
+  if (done != data.size()) return std::nullopt;
+
+  return data;
+}
+
 void DataControlClipboardServer::handleRead() {
   using SizeType = uint32_t;
   constexpr size_t TAG_SIZE = 1;
@@ -106,29 +225,36 @@ void DataControlClipboardServer::handleRead() {
           qWarning() << "Failed to parse clipboard selection";
         } else {
           bool concealed = false;
-          for (const auto &offer : selection.offers) {
+          ClipboardSelection cs;
+          cs.offers.reserve(selection.offers.size());
+
+          for (size_t i = 0; i != selection.offers.size(); ++i) {
+            const auto &offer = selection.offers[i];
+            QByteArray data;
+
+            if (offer.spooled) {
+              auto spooled = receiveSpooledOffer(selection.sequence, static_cast<uint32_t>(i));
+              if (!spooled) {
+                qWarning() << "data-control: missing spooled data for" << offer.mime_type;
+                continue;
+              }
+              data = *std::move(spooled);
+            } else {
+              data = QByteArray(reinterpret_cast<const char *>(offer.data.data()), offer.data.size());
+            }
+
             if (offer.mime_type == Clipboard::CONCEALED_MIME_TYPE) {
               concealed = true;
-              break;
+            } else if (offer.mime_type == Clipboard::PASSWORD_HINT_MIME_TYPE) {
+              cs.isPassword = true;
+            } else {
+              cs.offers.emplace_back(ClipboardDataOffer{QString::fromStdString(offer.mime_type), data});
             }
           }
+
           if (concealed) {
             qInfo() << "data-control: dropping concealed selection";
           } else {
-            ClipboardSelection cs;
-            cs.offers.reserve(selection.offers.size());
-
-            for (const auto &offer : selection.offers) {
-              if (offer.mime_type == Clipboard::PASSWORD_HINT_MIME_TYPE) {
-                cs.isPassword = true;
-                continue;
-              }
-              cs.offers.emplace_back(ClipboardDataOffer{
-                  QString::fromStdString(offer.mime_type),
-                  QByteArray(reinterpret_cast<const char *>(offer.data.data()), offer.data.size()),
-              });
-            }
-
             emit selectionAdded(cs);
           }
         }
@@ -170,6 +296,11 @@ bool DataControlClipboardServer::writeClipboard(QMimeData *data, const Clipboard
   return AbstractClipboardServer::writeClipboard(data, options);
 }
 
+DataControlClipboardServer::~DataControlClipboardServer() {
+  dropNextFd();
+  if (m_fdSocket != -1) close(m_fdSocket);
+}
+
 DataControlClipboardServer::DataControlClipboardServer() {
   connect(&m_process, &QProcess::readyReadStandardOutput, this, &DataControlClipboardServer::handleRead);
   connect(&m_process, &QProcess::readyReadStandardError, this, &DataControlClipboardServer::handleReadError);
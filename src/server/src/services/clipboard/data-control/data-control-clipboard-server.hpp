@@ -1,10 +1,13 @@
 #pragma once
 #include "services/clipboard/clipboard-server.hpp"
+#include "common/clipboard-protocol.hpp"
+#include <optional>
 #include <qprocess.h>
 
 class DataControlClipboardServer : public AbstractClipboardServer {
 public:
   DataControlClipboardServer();
+  ~DataControlClipboardServer() override;
   bool start() override;
   bool stop() override;
   bool isActivatable() const override;
@@ -18,6 +21,24 @@ private:
   void handleReadError();
   void handleExit(int code, QProcess::ExitStatus status);
 
+  struct SpooledFd {
+    clipboard_proto::SpooledOffer offer;
+    int fd = -1;
+  };
+
+  // the next memfd waiting on `m_fdSocket`, if any
+  std::optional<SpooledFd> receiveFd();
+
+  /**
+   * Data of offer `offer` of selection `selection`, which the helper spooled to a memfd passed on
+   * `m_fdSocket`. Memfds of earlier offers still on the socket are dropped on the way.
+   */
+  std::optional<QByteArray> receiveSpooledOffer(uint64_t selection, uint32_t offer);
+  void dropNextFd();
+
   QProcess m_process;
   std::string m_message;
+  int m_fdSocket = -1;
+  // received while looking for the memfd of an earlier offer, kept for the offer it belongs to
+  std::optional<SpooledFd> m_nextFd;
 };
@@ -18,6 +18,8 @@ struct IndexerFileResult {
 struct IndexerQueryParams {
   int limit = 100;
   std::optional<vicinae::FileCategory> category;
+  // queries of the same session supersede each other, the indexer stops working on the older one
+  std::optional<std::string> session;
 };
 
 struct IndexerAsyncQuery : public QObject {
@@ -250,6 +250,7 @@ void FileIndexer::preferenceValuesChanged(const QJsonObject &preferences) {
 
   m_config.paths = arrayField("indexingPaths");
   m_config.excluded_paths = arrayField("excludedIndexingPaths");
+  m_config.resident_index = preferences.value("residentIndex").toBool();
   m_wantRunning = preferences.value("autoIndexing").toBool();
 
   if (m_wantRunning) {
@@ -269,6 +270,7 @@ QFuture<std::vector<IndexerFileResult>> FileIndexer::queryAsync(std::string_view
 
   file_indexer_gen::QueryRequest req{.text = std::string{view}, .limit = params.limit};
   if (params.category) { req.category = toFileCategory(*params.category); }
+  req.session = params.session;
 
   return m_client.fileindexer()->query(req).then(
       [](std::expected<file_indexer_gen::QueryResponse, std::string> result) {
@@ -8,6 +8,7 @@
 #include "fuzzy/fuzzy-searchable.hpp"
 #include "fuzzy/fzf.hpp"
 #include "glyph/glyph.hpp"
+#include "glyph/search.hpp"
 #include "omni-database.hpp"
 #include <qfuture.h>
 #include <qfuturesynchronizer.h>
@@ -39,6 +40,16 @@ GlyphMetadata toMetadata(const SerializedEmojiMetadata &entry, const glyph::Item
   return meta;
 }
 
+// Whether a word of the query could match any of the fields of an item, ruling out most of the items
+// without matching them.
+bool mayMatch(const glyph::SearchMasks &masks, glyph::CharMask keyword, glyph::CharMask word) {
+  using glyph::covers;
+
+  if (!covers(masks.all | keyword, word)) return false;
+  if (covers(keyword, word) || covers(masks.name, word) || covers(masks.category, word)) return true;
+  return std::ranges::any_of(masks.keywords, [word](glyph::CharMask mask) { return covers(mask, word); });
+}
+
 } // namespace
 
 GlyphService::GlyphService(const std::filesystem::path &path, OmniDatabase *legacyDb) : m_path(path) {
@@ -56,11 +67,21 @@ bool GlyphService::load() {
   if (const auto error = glz::read_file_json(m_entries, m_path.string(), m_buf)) {
     qWarning() << "Failed to read emoji metadata:" << glz::format_error(error).c_str();
     m_entries.clear();
+    reindexEntries();
     return false;
   }
+  reindexEntries();
   return true;
 }
 
+void GlyphService::reindexEntries() {
+  m_entryIndex.clear();
+  m_entryIndex.reserve(m_entries.size());
+  for (size_t i = 0; i != m_entries.size(); ++i) {
+    m_entryIndex.emplace(m_entries[i].emoji, i);
+  }
+}
+
 bool GlyphService::save() {
   if (const auto error = glz::write_file_json(m_entries, m_path.string(), m_buf)) {
     qCritical() << "Failed to save emoji metadata:" << glz::format_error(error).c_str();
@@ -93,6 +114,7 @@ void GlyphService::migrateFromDatabase(OmniDatabase &db) {
   if (migrated.empty()) return;
 
   m_entries = std::move(migrated);
+  reindexEntries();
 
   if (!save()) return;
 
@@ -100,28 +122,48 @@ void GlyphService::migrateFromDatabase(OmniDatabase &db) {
 }
 
 SerializedEmojiMetadata const *GlyphService::findEntry(std::string_view emoji) const {
-  auto it = std::ranges::find(m_entries, emoji, &SerializedEmojiMetadata::emoji);
-  return it != m_entries.end() ? &*it : nullptr;
+  auto it = m_entryIndex.find(emoji);
+  return it != m_entryIndex.end() ? &m_entries[it->second] : nullptr;
 }
 
 SerializedEmojiMetadata *GlyphService::findEntry(std::string_view emoji) {
-  auto it = std::ranges::find(m_entries, emoji, &SerializedEmojiMetadata::emoji);
-  return it != m_entries.end() ? &*it : nullptr;
+  auto it = m_entryIndex.find(emoji);
+  return it != m_entryIndex.end() ? &m_entries[it->second] : nullptr;
 }
 
 SerializedEmojiMetadata &GlyphService::entryFor(std::string_view emoji) {
-  auto it = std::ranges::find(m_entries, emoji, &SerializedEmojiMetadata::emoji);
-  if (it != m_entries.end()) return *it;
+  if (auto *entry = findEntry(emoji)) return *entry;
+  m_entryIndex.emplace(std::string(emoji), m_entries.size());
   return m_entries.emplace_back(SerializedEmojiMetadata{.emoji = std::string(emoji)});
 }
 
-std::span<Scored<const glyph::Item *>> GlyphService::search(std::string_view query) const {
-  auto score = [this](const glyph::Item &data, const fuzzy::Query &query) {
+const FuzzyScorer<glyph::Item>::Results &GlyphService::search(std::string_view query,
+                                                              std::optional<glyph::Category> category) const {
+  fuzzy::Query const parsed{query};
+  std::vector<glyph::CharMask> words;
+
+  words.reserve(parsed.words.size());
+  for (const auto &word : parsed.words) {
+    words.emplace_back(glyph::patternMask(word.text));
+  }
+
+  auto const now = QDateTime::currentSecsSinceEpoch();
+
+  auto score = [&](const glyph::Item &data, const fuzzy::Query &query) -> fuzzy::Match {
+    if (category && data.category != *category) return {};
+
     using WS = fzf::WeightedString;
     const auto *entry = findEntry(data.character);
 
     // user defined keyword, we may or may not have one for this item
     std::string_view kw = entry && entry->keyword ? std::string_view{*entry->keyword} : "";
+    const auto &masks = glyph::searchMasks(data);
+    glyph::CharMask const kwMask = glyph::textMask(kw);
+
+    if (!std::ranges::all_of(words, [&](glyph::CharMask word) { return mayMatch(masks, kwMask, word); })) {
+      return {};
+    }
+
     std::initializer_list<WS> fields = {WS{kw, 2.0f}, WS{data.name, 1.0f},
                                         WS{glyph::categoryLabel(data.category), 0.5f}};
 
@@ -130,8 +172,7 @@ std::span<Scored<const glyph::Item *>> GlyphService::search(std::string_view que
     fuzzy::Match m{.score = qs.score, .quality = qs.quality};
 
     if (entry) {
-      double const f =
-          fuzzy::frecency(entry->visitCount, entry->lastVisitedAt, QDateTime::currentSecsSinceEpoch());
+      double const f = fuzzy::frecency(entry->visitCount, entry->lastVisitedAt, now);
       m.score += static_cast<int>(std::lround(fuzzy::FRECENCY_WEIGHT * f));
     }
 
@@ -175,20 +216,12 @@ std::vector<GlyphMetadata> GlyphService::getVisited() const {
 }
 
 std::vector<GlyphMetadata> GlyphService::mapMetadata(const std::vector<const glyph::Item *> &items) {
-  if (items.empty()) return {};
-
-  std::unordered_map<std::string_view, const SerializedEmojiMetadata *> byEmoji;
-  byEmoji.reserve(m_entries.size());
-  for (const auto &entry : m_entries) {
-    byEmoji.emplace(entry.emoji, &entry);
-  }
-
   std::vector<GlyphMetadata> metadatas;
   metadatas.reserve(items.size());
 
   for (const auto *item : items) {
-    if (auto it = byEmoji.find(item->character); it != byEmoji.end()) {
-      metadatas.emplace_back(toMetadata(*it->second, item));
+    if (const auto *entry = findEntry(item->character)) {
+      metadatas.emplace_back(toMetadata(*entry, item));
     } else {
       metadatas.emplace_back(GlyphMetadata{.data = item});
     }
@@ -9,6 +9,7 @@
 #include <optional>
 #include <string>
 #include <string_view>
+#include <unordered_map>
 #include <vector>
 #include "fuzzy/scored.hpp"
 
@@ -56,7 +57,9 @@ signals:
 public:
   GlyphService(const std::filesystem::path &path, OmniDatabase *legacyDb = nullptr);
 
-  std::span<Scored<const glyph::Item *>> search(std::string_view query) const;
+  // `category` restricts the results to a single category
+  const FuzzyScorer<glyph::Item>::Results &search(std::string_view query,
+                                                 std::optional<glyph::Category> category = {}) const;
 
   /**
    * Map metadata to the provided list of items.
@@ -78,17 +81,26 @@ public:
 private:
   void migrateFromDatabase(OmniDatabase &db);
 
+  struct StringHash {
+    using is_transparent = void;
+    size_t operator()(std::string_view str) const { return std::hash<std::string_view>()(str); }
+  };
+
   SerializedEmojiMetadata const *findEntry(std::string_view emoji) const;
   SerializedEmojiMetadata *findEntry(std::string_view emoji);
 
   // Return metadata entry for emoji, or create it if it doesn't exist
   SerializedEmojiMetadata &entryFor(std::string_view emoji);
 
+  void reindexEntries();
+
   bool load();
   bool save();
 
   std::filesystem::path m_path;
   std::vector<SerializedEmojiMetadata> m_entries;
+  // position in m_entries by emoji, as every glyph is looked up on every search
+  std::unordered_map<std::string, size_t, StringHash, std::equal_to<>> m_entryIndex;
   std::string m_buf;
 
   FuzzyScorer<glyph::Item> m_scorer;
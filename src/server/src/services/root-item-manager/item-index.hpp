@@ -0,0 +1,38 @@
+#pragma once
+#include <cstddef>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace item_index {
+
+/**
+ * Applies the changes a provider reported to `indexed`, whose items point to their entry of `metadata`
+ * through `meta`: the items of `removed` are dropped along with their metadata, the items of `updated`
+ * get fresh metadata and are indexed again by `index`, called with their position in `updated`. Every
+ * other item is kept as it is, cached scores included.
+ */
+template <typename Indexed, typename Key, typename Meta, typename Index>
+void update(std::vector<Indexed> &indexed, std::unordered_map<Key, Meta> &metadata,
+            const std::vector<Key> &updated, const std::vector<Key> &removed, Index &&index) {
+  std::unordered_set<const Meta *> replaced;
+
+  for (const auto *keys : {&removed, &updated}) {
+    for (const auto &key : *keys) {
+      if (auto it = metadata.find(key); it != metadata.end()) replaced.insert(&it->second);
+    }
+  }
+
+  std::erase_if(indexed, [&](const Indexed &item) { return replaced.contains(item.meta); });
+
+  for (const auto &key : removed) {
+    metadata.erase(key);
+  }
+
+  for (size_t i = 0; i != updated.size(); ++i) {
+    metadata[updated[i]] = {};
+    indexed.emplace_back(index(i));
+  }
+}
+
+} // namespace item_index
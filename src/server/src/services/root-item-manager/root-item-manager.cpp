@@ -1,9 +1,12 @@
 #include <qjsonvalue.h>
 #include <ranges>
 #include <algorithm>
+#include <limits>
 #include <unordered_map>
+#include <unordered_set>
 #include <qlogging.h>
 #include "root-item-manager.hpp"
+#include "item-index.hpp"
 #include "glaze-qt.hpp"
 #include "root-search/extensions/extension-root-provider.hpp"
 #include "fuzzy/fuzzy-searchable.hpp"
@@ -105,26 +108,8 @@ void RootItemManager::updateIndex() {
   m_metadata.clear();
 
   for (const auto &provider : m_providers) {
-    auto items = provider->loadItems();
-
-    for (const auto &item : items) {
-      // we build data ready to be searched on once during indexing, so that
-      // subsequent searches are not affected by useless conversions/copies.
-      SearchableRootItem sitem;
-      auto id = item->uniqueId();
-
-      sitem.item = item;
-      sitem.title = item->title().toStdString();
-      sitem.subtitle = item->subtitle().toStdString();
-      sitem.keywords = Utils::toStdStringVec(item->keywords());
-      sitem.meta = &m_metadata[id];
-      sitem.meta->item = item;
-
-      auto visitInfo = m_visitTracker.getVisit(id);
-
-      sitem.meta->visitCount = visitInfo.visitCount;
-      sitem.meta->lastVisitedAt = visitInfo.lastVisitedAt;
-      m_items.emplace_back(sitem);
+    for (const auto &item : provider->loadItems()) {
+      m_items.emplace_back(indexItem(item));
     }
   }
 
@@ -133,22 +118,73 @@ void RootItemManager::updateIndex() {
   emit itemsChanged();
 }
 
-double RootItemManager::SearchableRootItem::frecency() const {
-  return fuzzy::frecency(meta->visitCount, meta->lastVisitedAt, QDateTime::currentSecsSinceEpoch());
+void RootItemManager::updateItems(const std::vector<std::shared_ptr<RootItem>> &items,
+                                  const std::vector<EntrypointId> &removed) {
+  const auto &cfg = m_cfg.value();
+  auto favoriteSet = cfg.favorites | std::ranges::to<std::unordered_set>();
+  auto fallbackSet = cfg.fallbacks | std::ranges::to<std::unordered_set>();
+  auto updated = items | std::views::transform([](const auto &item) { return item->uniqueId(); }) |
+                 std::ranges::to<std::vector>();
+
+  item_index::update(m_items, m_metadata, updated, removed, [&](size_t i) {
+    auto sitem = indexItem(items[i]);
+    mergeItemConfig(sitem, cfg, favoriteSet, fallbackSet);
+    return sitem;
+  });
+
+  emit itemsChanged();
+}
+
+RootItemManager::SearchableRootItem RootItemManager::indexItem(const std::shared_ptr<RootItem> &item) {
+  // we build data ready to be searched on once during indexing, so that
+  // subsequent searches are not affected by useless conversions/copies.
+  SearchableRootItem sitem;
+  auto id = item->uniqueId();
+
+  sitem.item = item;
+  sitem.title = fzf::PreparedText{item->title().toStdString()};
+  sitem.subtitle = fzf::PreparedText{item->subtitle().toStdString()};
+  sitem.keywords = item->keywords() | std::views::transform([](const QString &keyword) {
+                     return fzf::PreparedText{keyword.toStdString()};
+                   }) |
+                   std::ranges::to<std::vector>();
+  sitem.meta = &m_metadata[id];
+  sitem.meta->item = item;
+
+  auto visitInfo = m_visitTracker.getVisit(id);
+
+  sitem.meta->visitCount = visitInfo.visitCount;
+  sitem.meta->lastVisitedAt = visitInfo.lastVisitedAt;
+
+  return sitem;
 }
 
-double RootItemManager::SearchableRootItem::fuzzyScore(const fuzzy::Query &query) const {
-  if (query.empty()) return 100.0 - fuzzy::FRECENCY_WEIGHT + fuzzy::FRECENCY_WEIGHT * frecency();
+double RootItemManager::SearchableRootItem::frecency(std::int64_t now) const {
+  static constexpr std::int64_t MAX_AGE_SECONDS = 60;
+  auto &cache = frecencyCache;
 
-  using WS = fzf::WeightedString;
-  std::string alias = meta->alias.value_or("");
-  std::initializer_list<WS> ss = {{title, 1.0f}, {subtitle, 0.5f}, {alias, 1.0f}};
-  auto kws = keywords | std::views::transform([](auto &&kw) { return WS{kw, 0.6f}; });
+  if (!cache.computedAt || now - *cache.computedAt >= MAX_AGE_SECONDS || now < *cache.computedAt ||
+      cache.visitCount != meta->visitCount || cache.lastVisitedAt != meta->lastVisitedAt) {
+    cache = {.computedAt = now,
+             .visitCount = meta->visitCount,
+             .lastVisitedAt = meta->lastVisitedAt,
+             .value = fuzzy::frecency(meta->visitCount, meta->lastVisitedAt, now)};
+  }
+
+  return cache.value;
+}
+
+double RootItemManager::SearchableRootItem::fuzzyScore(const fuzzy::Query &query, std::int64_t now) const {
+  if (query.empty()) return 100.0 - fuzzy::FRECENCY_WEIGHT + fuzzy::FRECENCY_WEIGHT * frecency(now);
+
+  using WT = fzf::WeightedText;
+  std::initializer_list<WT> ss = {{&title, 1.0f}, {&subtitle, 0.5f}, {&alias, 1.0f}};
+  auto kws = keywords | std::views::transform([](const fzf::PreparedText &kw) { return WT{&kw, 0.6f}; });
   auto const score = fzf::threadLocalMatcher().score_query(ss, kws, query);
 
   if (score.quality < fuzzy::MIN_QUALITY) return 0;
 
-  return score.score + fuzzy::FRECENCY_WEIGHT * frecency();
+  return score.score + fuzzy::FRECENCY_WEIGHT * frecency(now);
 }
 
 std::vector<RootItemManager::ScoredItem> RootItemManager::search(const QString &query,
@@ -162,40 +198,56 @@ void RootItemManager::search(const QString &query, std::vector<ScoredItem> &resu
                              const RootItemPrefixSearchOptions &opts) {
   std::string pattern = query.toStdString();
   fuzzy::Query const fuzzyQuery{pattern};
+  auto const now = QDateTime::currentSecsSinceEpoch();
+
+  // what the order depends on, worked out once per match rather than on every comparison
+  struct Ranked {
+    // length of the alias the query is a prefix of, prioritized over the score. Max when there is none.
+    size_t aliasLength;
+    double score;
+    SearchableRootItem *item;
+  };
+  std::vector<Ranked> ranked;
 
-  results.clear();
-  results.reserve(m_items.size());
+  ranked.reserve(m_items.size());
 
   for (auto &item : m_items) {
     if (!item.meta->enabled && !opts.includeDisabled) continue;
     if (opts.providerId && opts.providerId != item.meta->providerId) continue;
     if (item.meta->favorite && !opts.includeFavorites) continue;
-    double const fuzzyScore = item.fuzzyScore(fuzzyQuery);
+    double const fuzzyScore = item.fuzzyScore(fuzzyQuery, now);
 
     if (!fuzzyScore) { continue; }
 
-    results.emplace_back(ScoredItem{.meta = item.meta, .score = fuzzyScore, .item = item.item});
-  }
+    size_t aliasLength = std::numeric_limits<size_t>::max();
 
-  // we need stable sort to avoid flickering when updating quickly
-  std::ranges::stable_sort(results, [&](const auto &a, const auto &b) {
     if (opts.prioritizeAliased) {
-      bool const aa = !a.meta->alias.value_or("").empty() && a.meta->alias->starts_with(pattern);
-      bool const ab = !b.meta->alias.value_or("").empty() && b.meta->alias->starts_with(pattern);
-      // always prioritize matching aliases over score
-      if (aa != ab) { return aa > ab; }
-      if (aa && ab && a.meta->alias->size() != b.meta->alias->size()) {
-        return a.meta->alias->size() < b.meta->alias->size();
-      }
+      auto const &alias = item.meta->alias;
+      if (alias && !alias->empty() && alias->starts_with(pattern)) aliasLength = alias->size();
     }
 
+    ranked.emplace_back(Ranked{.aliasLength = aliasLength, .score = fuzzyScore, .item = &item});
+  }
+
+  // we need stable sort to avoid flickering when updating quickly
+  std::ranges::stable_sort(ranked, [](const Ranked &a, const Ranked &b) {
+    if (a.aliasLength != b.aliasLength) return a.aliasLength < b.aliasLength;
     return a.score > b.score;
   });
+
+  results.clear();
+  results.reserve(ranked.size());
+
+  for (const auto &entry : ranked) {
+    results.emplace_back(
+        ScoredItem{.meta = entry.item->meta, .score = entry.score, .item = entry.item->item});
+  }
 }
 
 std::vector<RootItemManager::ProviderSearchGroup>
 RootItemManager::searchGroupedByProvider(const QString &query, const RootItemPrefixSearchOptions &opts) {
   fuzzy::Query const fuzzyQuery{query.toStdString()};
+  auto const now = QDateTime::currentSecsSinceEpoch();
 
   std::unordered_map<std::string, RootProvider *> providerById;
   std::unordered_map<std::string, double> providerNameScore;
@@ -225,7 +277,7 @@ RootItemManager::searchGroupedByProvider(const QString &query, const RootItemPre
     const auto &providerId = item.meta->providerId;
     if (!providerById.contains(providerId)) continue;
 
-    double const titleScore = item.fuzzyScore(fuzzyQuery);
+    double const titleScore = item.fuzzyScore(fuzzyQuery, now);
     auto nameIt = providerNameScore.find(providerId);
     bool const providerMatched = nameIt != providerNameScore.end();
     if (titleScore <= 0 && !providerMatched) continue;
@@ -369,7 +421,12 @@ void RootItemManager::setPreferenceValues(const EntrypointId &id, const QJsonObj
 }
 
 bool RootItemManager::setAlias(const EntrypointId &id, std::string_view alias) {
-  m_metadata[id].alias = alias;
+  auto &meta = m_metadata[id];
+
+  meta.alias = alias;
+  if (auto it = std::ranges::find(m_items, &meta, &SearchableRootItem::meta); it != m_items.end()) {
+    it->alias = fzf::PreparedText{alias};
+  }
   m_cfg.mergeEntrypointWithUser(id, {.alias = std::string{alias}});
 
   return true;
@@ -566,6 +623,7 @@ void RootItemManager::loadProvider(std::unique_ptr<RootProvider> provider) {
   ptr->preferencesChanged(preferenceValues);
   ptr->initialized(preferenceValues);
   connect(ptr, &RootProvider::itemsChanged, this, [this]() { updateIndex(); });
+  connect(ptr, &RootProvider::itemsUpdated, this, &RootItemManager::updateItems);
 }
 
 RootProvider *RootItemManager::provider(std::string_view id) const {
@@ -619,46 +677,54 @@ RootItemManager::getFromSerializedEntrypointIds(std::span<const std::string> ids
   return entrypoints;
 }
 
-void RootItemManager::mergeConfigWithMetadata(const config::ConfigValue &cfg) {
-  auto favoriteSet = cfg.favorites | std::ranges::to<std::unordered_set>();
-  auto fallbackSet = cfg.fallbacks | std::ranges::to<std::unordered_set>();
+void RootItemManager::mergeItemConfig(SearchableRootItem &item, const config::ConfigValue &cfg,
+                                      const std::unordered_set<std::string> &favoriteSet,
+                                      const std::unordered_set<std::string> &fallbackSet) {
+  auto entrypointId = item.item->uniqueId();
+  const config::ProviderData *providerConfig = nullptr;
+  const config::ProviderItemData *itemConfig = nullptr;
 
-  for (const SearchableRootItem &item : m_items) {
-    auto entrypointId = item.item->uniqueId();
-    const config::ProviderData *providerConfig = nullptr;
-    const config::ProviderItemData *itemConfig = nullptr;
+  if (auto it = cfg.providers.find(entrypointId.provider); it != cfg.providers.end()) {
+    providerConfig = &it->second;
+  }
 
-    if (auto it = cfg.providers.find(entrypointId.provider); it != cfg.providers.end()) {
-      providerConfig = &it->second;
+  if (providerConfig) {
+    if (auto it = providerConfig->entrypoints.find(entrypointId.entrypoint);
+        it != providerConfig->entrypoints.end()) {
+      itemConfig = &it->second;
     }
+  }
 
-    if (providerConfig) {
-      if (auto it = providerConfig->entrypoints.find(entrypointId.entrypoint);
-          it != providerConfig->entrypoints.end()) {
-        itemConfig = &it->second;
-      }
-    }
+  auto &meta = m_metadata[entrypointId];
 
-    auto &meta = m_metadata[entrypointId];
+  meta.providerId = entrypointId.provider;
+  meta.enabled = !item.item->isDefaultDisabled();
+  meta.favorite = favoriteSet.contains(entrypointId);
+  meta.fallback = fallbackSet.contains(entrypointId);
 
-    meta.providerId = entrypointId.provider;
-    meta.enabled = !item.item->isDefaultDisabled();
-    meta.favorite = favoriteSet.contains(entrypointId);
-    meta.fallback = fallbackSet.contains(entrypointId);
+  if (itemConfig) {
+    item.item->preferenceValuesChanged(getItemPreferenceValues(entrypointId));
+    if (auto enabled = itemConfig->enabled) { meta.enabled = enabled.value(); }
+    if (auto alias = itemConfig->alias) { meta.alias = alias.value(); }
+    if (auto shortcut = itemConfig->shortcut) { meta.shortcut = shortcut.value(); }
+  }
 
-    if (itemConfig) {
-      item.item->preferenceValuesChanged(getItemPreferenceValues(entrypointId));
-      if (auto enabled = itemConfig->enabled) { meta.enabled = enabled.value(); }
-      if (auto alias = itemConfig->alias) { meta.alias = alias.value(); }
-      if (auto shortcut = itemConfig->shortcut) { meta.shortcut = shortcut.value(); }
-    }
+  item.alias = fzf::PreparedText{meta.alias.value_or("")};
 
-    if (providerConfig) {
-      if (auto enabled = providerConfig->enabled; enabled.has_value() && !enabled.value()) {
-        meta.enabled = false;
-      }
+  if (providerConfig) {
+    if (auto enabled = providerConfig->enabled; enabled.has_value() && !enabled.value()) {
+      meta.enabled = false;
     }
   }
+}
+
+void RootItemManager::mergeConfigWithMetadata(const config::ConfigValue &cfg) {
+  auto favoriteSet = cfg.favorites | std::ranges::to<std::unordered_set>();
+  auto fallbackSet = cfg.fallbacks | std::ranges::to<std::unordered_set>();
+
+  for (SearchableRootItem &item : m_items) {
+    mergeItemConfig(item, cfg, favoriteSet, fallbackSet);
+  }
 
   // update provider preferences to make sure they are in sync
   for (const auto &provider : m_providers) {
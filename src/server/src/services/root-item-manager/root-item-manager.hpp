@@ -13,6 +13,7 @@
 #include "preference.hpp"
 #include "ui/list-accessory/list-accessory.hpp"
 #include <cstdint>
+#include <unordered_set>
 #include <qdnslookup.h>
 #include <qjsonobject.h>
 #include <qjsonvalue.h>
@@ -146,6 +147,10 @@ signals:
   void itemsChanged() const;
   void itemRemoved(const QString &id) const;
 
+  // Only `items` were added or changed and the `removed` ones are gone, as an alternative to `itemsChanged`.
+  void itemsUpdated(const std::vector<std::shared_ptr<RootItem>> &items,
+                    const std::vector<EntrypointId> &removed) const;
+
 public:
   enum Type : std::uint8_t {
     ExtensionProvider, // a collection of commands
@@ -235,13 +240,27 @@ public:
 
   struct SearchableRootItem {
     std::shared_ptr<RootItem> item;
-    std::string title;
-    std::string subtitle;
-    std::vector<std::string> keywords;
+    // search keys, prepared when indexing (and the alias when it changes) so that scoring an item on
+    // every keystroke neither allocates nor classifies characters again
+    fzf::PreparedText title;
+    fzf::PreparedText subtitle;
+    fzf::PreparedText alias;
+    std::vector<fzf::PreparedText> keywords;
     RootItemMetadata *meta = nullptr;
 
-    double frecency() const;
-    double fuzzyScore(const fuzzy::Query &query) const;
+    // frecency only moves with the visits and by the day, so it is kept across keystrokes until the
+    // visits change or it is a minute old
+    struct FrecencyCache {
+      std::optional<std::int64_t> computedAt;
+      int visitCount = 0;
+      std::optional<std::uint64_t> lastVisitedAt;
+      double value = 0;
+    };
+    mutable FrecencyCache frecencyCache;
+
+    // `now` is read once per search pass, in unix seconds
+    double frecency(std::int64_t now) const;
+    double fuzzyScore(const fuzzy::Query &query, std::int64_t now) const;
   };
 
   struct ScoredItem {
@@ -309,6 +328,13 @@ public:
 
   void updateIndex();
 
+  /**
+   * Same as `updateIndex`, for a provider that knows which of its items changed: `items` are new or
+   * replace the items with the same id.
+   */
+  void updateItems(const std::vector<std::shared_ptr<RootItem>> &items,
+                   const std::vector<EntrypointId> &removed);
+
   /**
    * DESTRUCTIVE!
    * This will unload the provider AND wipe persisted data such as aliases, preferences, etc...
@@ -357,6 +383,10 @@ private:
   ScopedLocalStorage getProviderSecretStorage(const QString &providerId) const;
 
   void mergeConfigWithMetadata(const config::ConfigValue &cfg);
+  void mergeItemConfig(SearchableRootItem &item, const config::ConfigValue &cfg,
+                       const std::unordered_set<std::string> &favoriteSet,
+                       const std::unordered_set<std::string> &fallbackSet);
+  SearchableRootItem indexItem(const std::shared_ptr<RootItem> &item);
 
   std::vector<std::shared_ptr<RootItem>>
   getFromSerializedEntrypointIds(std::span<const std::string> ids) const;
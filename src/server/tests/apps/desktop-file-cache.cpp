@@ -0,0 +1,243 @@
+#include "services/app-service/xdg/desktop-file-cache.hpp"
+#include "services/root-item-manager/item-index.hpp"
+#include <algorithm>
+#include <catch2/catch_test_macros.hpp>
+#include <filesystem>
+#include <format>
+#include <fstream>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <unistd.h>
+#include <xdgpp/desktop-entry/entry.hpp>
+#include <xdgpp/locale/locale.hpp>
+
+namespace fs = std::filesystem;
+
+namespace {
+
+constexpr std::string_view FIREFOX = R"(# installed by the distribution package
+[Desktop Entry]
+Version=1.0
+Name=Firefox
+Name[fr]=Firefox
+Name[de_DE]=Firefox Browser
+GenericName=Web Browser
+GenericName[fr]=Navigateur Web
+GenericName[fr_CA]=Navigateur
+GenericName[sr@latin]=Veb pregledač
+  # indented comments too
+
+Comment=Browse the World Wide Web
+Comment[fr_FR]=Naviguer sur le Web
+Keywords=Internet;WWW;Browser;
+Keywords[de]=Internet;WWW;Browser;Web;
+Exec=firefox %u
+Icon=firefox
+Type=Application
+Actions=new-window;
+
+[Desktop Action new-window]
+Name=New Window
+Name[fr]=Nouvelle fenêtre
+Name[it]=Nuova finestra
+Exec=firefox --new-window %u
+)";
+
+fs::path temporaryCachePath() {
+  return fs::temp_directory_path() / std::format("vicinae-desktop-file-cache-{}.bin", getpid());
+}
+
+class ScopedAppDirs {
+public:
+  fs::path root = fs::temp_directory_path() / std::format("vicinae-app-dirs-{}", getpid());
+  fs::path user = root / "user" / "applications";
+  fs::path system = root / "system" / "applications";
+
+  ScopedAppDirs() {
+    fs::create_directories(user);
+    fs::create_directories(system);
+  }
+
+  ~ScopedAppDirs() {
+    std::error_code ec;
+    fs::remove_all(root, ec);
+  }
+
+  std::vector<fs::path> dirs() const { return {user, system}; }
+};
+
+void writeFile(const fs::path &path, std::string_view data) { std::ofstream(path) << data; }
+
+std::vector<std::string> names(const std::vector<DesktopFileCache::Found> &found, bool stale) {
+  std::vector<std::string> out;
+  for (const auto &file : found) {
+    if (file.stale == stale) out.emplace_back(file.path.filename().string());
+  }
+  std::ranges::sort(out);
+  return out;
+}
+
+struct Meta {
+  int version = 0;
+};
+
+struct Indexed {
+  std::string key;
+  Meta *meta = nullptr;
+  // stands for what indexing computes and caches
+  int scored = 0;
+};
+
+} // namespace
+
+TEST_CASE("compacted desktop files parse the same for the language they were compacted for") {
+  for (auto const *name : {"fr_CA", "fr", "de_DE", "sr@latin", "en_US"}) {
+    auto const locale = xdgpp::Locale::parse(name);
+    auto const compacted = DesktopFileCache::compact(FIREFOX, locale.lang());
+    auto const raw = xdgpp::DesktopEntry::fromData(FIREFOX, {.locale = locale});
+    auto const cached = xdgpp::DesktopEntry::fromData(compacted, {.locale = locale});
+
+    INFO(name);
+    REQUIRE(compacted.size() < FIREFOX.size());
+    REQUIRE(cached.name() == raw.name());
+    REQUIRE(cached.genericName() == raw.genericName());
+    REQUIRE(cached.comment() == raw.comment());
+    REQUIRE(cached.keywords() == raw.keywords());
+    REQUIRE(cached.actions().size() == raw.actions().size());
+    REQUIRE(cached.actions().front().name() == raw.actions().front().name());
+  }
+}
+
+TEST_CASE("compacting keeps unlocalized keys and the localized values of the language only") {
+  auto const compacted = DesktopFileCache::compact(FIREFOX, "fr");
+
+  REQUIRE(compacted.contains("[Desktop Entry]\n"));
+  REQUIRE(compacted.contains("[Desktop Action new-window]\n"));
+  REQUIRE(compacted.contains("GenericName[fr_CA]=Navigateur\n"));
+  REQUIRE(compacted.contains("Exec=firefox --new-window %u\n"));
+  REQUIRE(!compacted.contains('#'));
+  REQUIRE(!compacted.contains("[de"));
+  REQUIRE(!compacted.contains("[it]"));
+  REQUIRE(!compacted.contains("\n\n"));
+}
+
+TEST_CASE("cached desktop files are loaded back for the language they were saved for") {
+  auto const path = temporaryCachePath();
+  DesktopFileCache::Entries entries;
+
+  entries["/usr/share/applications/firefox.desktop"] = {
+      .stamp = {.mtime = 1, .size = FIREFOX.size()},
+      .data = DesktopFileCache::compact(FIREFOX, "fr"),
+  };
+  entries["/var/lib/flatpak/exports/share/applications/org.gimp.GIMP.desktop"] = {
+      .stamp = {.target = "/var/lib/flatpak/app/org.gimp.GIMP/current/active/export/org.gimp.GIMP.desktop",
+                .mtime = 1700000000,
+                .size = 4096},
+      .data = "[Desktop Entry]\nName=GIMP\n",
+  };
+
+  REQUIRE(DesktopFileCache::save(path, "fr", entries));
+
+  auto const loaded = DesktopFileCache::load(path, "fr");
+
+  REQUIRE(loaded.size() == entries.size());
+  for (auto const &[file, entry] : entries) {
+    REQUIRE(loaded.contains(file));
+    REQUIRE(loaded.at(file).stamp == entry.stamp);
+    REQUIRE(loaded.at(file).data == entry.data);
+  }
+
+  REQUIRE(DesktopFileCache::load(path, "de").empty());
+  fs::remove(path);
+  REQUIRE(DesktopFileCache::load(path, "fr").empty());
+}
+
+TEST_CASE("scanning desktop files tells the new and changed files from the current ones") {
+  ScopedAppDirs dirs;
+  DesktopFileCache::Entries previous;
+  DesktopFileCache::Entries current;
+
+  writeFile(dirs.system / "firefox.desktop", FIREFOX);
+  writeFile(dirs.system / "kitty.desktop", "[Desktop Entry]\nName=kitty\n");
+  writeFile(dirs.system / "gimp.desktop", "[Desktop Entry]\nName=GIMP\n");
+
+  auto found = DesktopFileCache::scan(dirs.dirs(), previous, current);
+
+  CHECK(names(found, true) == std::vector<std::string>{"firefox.desktop", "gimp.desktop", "kitty.desktop"});
+  REQUIRE(current.size() == 3);
+
+  previous = std::move(current);
+  current.clear();
+  found = DesktopFileCache::scan(dirs.dirs(), previous, current);
+
+  CHECK(names(found, true).empty());
+  CHECK(names(found, false).size() == 3);
+  CHECK(previous.empty());
+
+  // one of each: added, modified and removed
+  writeFile(dirs.system / "nautilus.desktop", "[Desktop Entry]\nName=Files\n");
+  writeFile(dirs.system / "kitty.desktop", "[Desktop Entry]\nName=kitty\nExec=kitty\n");
+  fs::remove(dirs.system / "gimp.desktop");
+
+  previous = std::move(current);
+  current.clear();
+  found = DesktopFileCache::scan(dirs.dirs(), previous, current);
+
+  CHECK(names(found, true) == std::vector<std::string>{"kitty.desktop", "nautilus.desktop"});
+  CHECK(names(found, false) == std::vector<std::string>{"firefox.desktop"});
+  REQUIRE(previous.size() == 1);
+  CHECK(previous.contains((dirs.system / "gimp.desktop").string()));
+  CHECK(current.size() == 3);
+}
+
+TEST_CASE("scanning desktop files keeps the first file found for an id") {
+  ScopedAppDirs dirs;
+  DesktopFileCache::Entries previous;
+  DesktopFileCache::Entries current;
+
+  writeFile(dirs.user / "firefox.desktop", "[Desktop Entry]\nName=My Firefox\n");
+  writeFile(dirs.system / "firefox.desktop", FIREFOX);
+
+  auto const found = DesktopFileCache::scan(dirs.dirs(), previous, current);
+
+  REQUIRE(found.size() == 1);
+  CHECK(found.front().path == dirs.user / "firefox.desktop");
+  CHECK(found.front().dir == dirs.user);
+  CHECK(current.size() == 1);
+}
+
+TEST_CASE("updating indexed items keeps the items that did not change") {
+  std::unordered_map<std::string, Meta> metadata;
+  std::vector<Indexed> indexed;
+  auto index = [&](const std::vector<std::string> &keys) {
+    return [&, keys](size_t i) { return Indexed{keys[i], &metadata[keys[i]], 1}; };
+  };
+
+  std::vector<std::string> const all{"firefox", "kitty", "gimp"};
+  item_index::update(indexed, metadata, all, {}, index(all));
+
+  for (auto &item : indexed) {
+    item.scored = 42;
+    item.meta->version = 7;
+  }
+
+  std::vector<std::string> const updated{"kitty", "nautilus"};
+  item_index::update(indexed, metadata, updated, {"gimp"}, index(updated));
+
+  REQUIRE(indexed.size() == 3);
+  CHECK(indexed[0].key == "firefox");
+  CHECK(indexed[0].scored == 42);
+  CHECK(indexed[0].meta == &metadata.at("firefox"));
+  CHECK(indexed[0].meta->version == 7);
+
+  // updated items are indexed again with fresh metadata, new ones alike
+  CHECK(indexed[1].key == "kitty");
+  CHECK(indexed[1].scored == 1);
+  CHECK(indexed[1].meta->version == 0);
+  CHECK(indexed[2].key == "nautilus");
+  CHECK(indexed[2].meta == &metadata.at("nautilus"));
+
+  CHECK_FALSE(metadata.contains("gimp"));
+  CHECK(metadata.size() == 3);
+}
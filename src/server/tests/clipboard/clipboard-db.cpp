@@ -0,0 +1,137 @@
+#include "services/clipboard/clipboard-db.hpp"
+#include <algorithm>
+#include <catch2/catch_test_macros.hpp>
+#include <cstdlib>
+#include <filesystem>
+#include <format>
+#include <unistd.h>
+#include <vector>
+
+namespace fs = std::filesystem;
+
+namespace {
+
+/**
+ * A migrated clipboard database of its own, in a data home that goes away with it.
+ */
+class ScopedClipboardDatabase {
+public:
+  fs::path root;
+
+  ScopedClipboardDatabase() : root(nextRoot()) {
+    fs::create_directories(root / "vicinae");
+    setenv("XDG_DATA_HOME", root.c_str(), 1);
+    db.emplace(std::nullopt);
+    db->runMigrations();
+  }
+
+  ~ScopedClipboardDatabase() {
+    db.reset();
+    std::error_code ec;
+    fs::remove_all(root, ec);
+  }
+
+  ClipboardDatabase *operator->() { return &*db; }
+
+private:
+  std::optional<ClipboardDatabase> db;
+
+  static fs::path nextRoot() {
+    static int count = 0;
+    return fs::temp_directory_path() / std::format("vicinae-clipboard-db-{}-{}", getpid(), count++);
+  }
+};
+
+void insertSelection(ScopedClipboardDatabase &db, const QString &id, const QString &dataHash) {
+  REQUIRE(db->insertSelection({.id = id,
+                               .offerCount = 1,
+                               .hash = id,
+                               .preferredMimeType = "image/png",
+                               .kind = ClipboardOfferKind::Image}));
+
+  if (!db->hasBlob(dataHash)) {
+    REQUIRE(db->insertBlob({.hash = dataHash, .encryption = ClipboardEncryptionType::None, .size = 4}));
+  }
+
+  REQUIRE(db->insertOffer({.id = id + "-offer",
+                           .selectionId = id,
+                           .blobHash = dataHash,
+                           .mimeType = "image/png",
+                           .encryption = ClipboardEncryptionType::None,
+                           .kind = ClipboardOfferKind::Image,
+                           .size = 4}));
+}
+
+void insertPreview(ScopedClipboardDatabase &db, const QString &selectionId, ClipboardPreviewKind kind,
+                   const QString &blobHash) {
+  if (!db->hasBlob(blobHash)) {
+    REQUIRE(db->insertBlob({.hash = blobHash, .encryption = ClipboardEncryptionType::None, .size = 4}));
+  }
+
+  REQUIRE(db->insertPreview(
+      {.selectionId = selectionId, .kind = kind, .blobHash = blobHash, .mimeType = "image/webp"}));
+}
+
+std::vector<QString> sorted(std::vector<QString> files) {
+  std::ranges::sort(files);
+  return files;
+}
+
+} // namespace
+
+TEST_CASE("clipboard previews release their blobs with their selection") {
+  ScopedClipboardDatabase db;
+
+  insertSelection(db, "a", "data-a");
+  // both sizes in one blob, as for images smaller than the thumbnails
+  insertPreview(db, "a", ClipboardPreviewKind::Thumbnail, "thumbnail-a");
+  insertPreview(db, "a", ClipboardPreviewKind::Thumbnail2x, "thumbnail-a");
+
+  CHECK(db->findPreview("a", ClipboardPreviewKind::Thumbnail2x).has_value());
+  CHECK(sorted(db->removeSelection("a")) == std::vector<QString>{"data-a", "thumbnail-a"});
+  CHECK_FALSE(db->hasBlob("thumbnail-a"));
+  CHECK_FALSE(db->findPreview("a", ClipboardPreviewKind::Thumbnail).has_value());
+}
+
+TEST_CASE("clipboard preview blobs shared with another selection are kept") {
+  ScopedClipboardDatabase db;
+
+  insertSelection(db, "a", "data-a");
+  insertSelection(db, "b", "data-b");
+  insertPreview(db, "a", ClipboardPreviewKind::Thumbnail, "thumbnail");
+  insertPreview(db, "b", ClipboardPreviewKind::Thumbnail, "thumbnail");
+
+  CHECK(db->removeSelection("a") == std::vector<QString>{"data-a"});
+  CHECK(db->hasBlob("thumbnail"));
+
+  CHECK(sorted(db->removeSelection("b")) == std::vector<QString>{"data-b", "thumbnail"});
+}
+
+TEST_CASE("clipboard previews replaced release their blobs") {
+  ScopedClipboardDatabase db;
+
+  insertSelection(db, "a", "data-a");
+  insertPreview(db, "a", ClipboardPreviewKind::Excerpt, "old");
+
+  REQUIRE(db->removePreviews("a"));
+  insertPreview(db, "a", ClipboardPreviewKind::Excerpt, "new");
+
+  CHECK(db->removeUnusedBlobs() == std::vector<QString>{"old"});
+  CHECK(db->findPreview("a", ClipboardPreviewKind::Excerpt)->file == "new");
+}
+
+TEST_CASE("clipboard selections with outdated previews are found in id order") {
+  ScopedClipboardDatabase db;
+
+  for (const auto *id : {"c", "a", "d", "b"}) {
+    insertSelection(db, id, QString("data-") + id);
+  }
+
+  REQUIRE(db->setPreviewVersion("b", 2));
+  CHECK_FALSE(db->setPreviewVersion("missing", 2));
+
+  CHECK(db->findOutdatedPreviews(2, {}, 2) == std::vector<QString>{"a", "c"});
+  CHECK(db->findOutdatedPreviews(2, "c", 2) == std::vector<QString>{"d"});
+  CHECK(db->findOutdatedPreviews(2, "d", 2).empty());
+  CHECK(db->findOutdatedPreviews(0, {}, 10).empty());
+}
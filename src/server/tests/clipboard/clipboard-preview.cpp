@@ -0,0 +1,109 @@
+#include "services/clipboard/clipboard-preview.hpp"
+#include <QBuffer>
+#include <QImage>
+#include <catch2/catch_test_macros.hpp>
+#include <utility>
+#include "common/clipboard-formats.hpp"
+
+using namespace Clipboard;
+
+namespace {
+
+QByteArray encodedImage(int width, int height) {
+  QImage image(width, height, QImage::Format_ARGB32);
+  QByteArray data;
+  QBuffer buffer(&data);
+
+  image.fill(Qt::red);
+  buffer.open(QIODevice::WriteOnly);
+  REQUIRE(image.save(&buffer, "png"));
+
+  return data;
+}
+
+QSize sizeOf(const GeneratedPreview &preview) { return QImage::fromData(preview.data).size(); }
+
+} // namespace
+
+TEST_CASE("clipboard excerpts normalize line endings") {
+  auto const previews = generatePreviews("text/plain", QByteArray("one\r\ntwo\rthree\nfour\0", 20));
+
+  REQUIRE(previews.size() == 1);
+  CHECK(previews[0].kind == ClipboardPreviewKind::Excerpt);
+  CHECK(previews[0].mimeType == "text/plain;charset=utf-8");
+  CHECK(previews[0].data == "one\ntwo\nthree\nfour");
+
+  auto const uris = generatePreviews(Clipboard::URI_LIST, "file:///tmp/a\r\nfile:///tmp/b\r\n");
+
+  REQUIRE(uris.size() == 1);
+  CHECK(uris[0].data == "file:///tmp/a\nfile:///tmp/b\n");
+}
+
+TEST_CASE("clipboard excerpts are cut at a character boundary") {
+  // "é" cut after its first byte, "€" after its first and second ones
+  for (auto const [headSize, tail] : {std::pair{EXCERPT_SIZE - 1, "\xc3\xa9 and more"},
+                                      std::pair{EXCERPT_SIZE - 1, "\xe2\x82\xac and more"},
+                                      std::pair{EXCERPT_SIZE - 2, "\xe2\x82\xac and more"}}) {
+    QByteArray const head(headSize, 'a');
+    auto const previews = generatePreviews("text/plain", head + tail);
+
+    REQUIRE(previews.size() == 1);
+    CHECK(previews[0].data == head);
+  }
+
+  QByteArray const fits = QByteArray(EXCERPT_SIZE - 2, 'a') + "\xc3\xa9";
+  auto const previews = generatePreviews("text/plain", fits);
+
+  REQUIRE(previews.size() == 1);
+  CHECK(previews[0].data == fits);
+}
+
+TEST_CASE("clipboard thumbnails are bounded at both sizes") {
+  auto const previews = generatePreviews("image/png", encodedImage(2000, 1000));
+
+  REQUIRE(previews.size() == 2);
+  CHECK(previews[0].kind == ClipboardPreviewKind::Thumbnail);
+  CHECK(sizeOf(previews[0]) == QSize(THUMBNAIL_SIZE, THUMBNAIL_SIZE / 2));
+  CHECK(previews[1].kind == ClipboardPreviewKind::Thumbnail2x);
+  CHECK(sizeOf(previews[1]) == QSize(THUMBNAIL_SIZE * 2, THUMBNAIL_SIZE));
+  CHECK(previews[0].mimeType.startsWith("image/"));
+
+  auto const tall = generatePreviews("image/png", encodedImage(500, 1000));
+
+  REQUIRE(tall.size() == 2);
+  CHECK(sizeOf(tall[0]) == QSize(THUMBNAIL_SIZE / 2, THUMBNAIL_SIZE));
+  CHECK(sizeOf(tall[1]) == QSize(THUMBNAIL_SIZE, THUMBNAIL_SIZE * 2));
+}
+
+TEST_CASE("clipboard thumbnails of small images are left at their size") {
+  auto const previews = generatePreviews("image/png", encodedImage(100, 50));
+
+  REQUIRE(previews.size() == 2);
+  CHECK(sizeOf(previews[0]) == QSize(100, 50));
+  CHECK(previews[0].data == previews[1].data);
+}
+
+TEST_CASE("clipboard previews are not made of other offers") {
+  CHECK(generatePreviews("application/octet-stream", "data").empty());
+  CHECK(generatePreviews("image/png", "not an image").empty());
+}
+
+TEST_CASE("clipboard preview backfill leaves offers it needs a key for") {
+  auto const required = std::unexpected(OfferDecryptionError::DecryptionRequired);
+
+  CHECK_FALSE(backfillPreviews("text/plain", required).has_value());
+
+  // stored empty, for the selection not to be tried again
+  for (auto const error : {OfferDecryptionError::DecryptionFailed, OfferDecryptionError::DataUnavailable}) {
+    auto const previews = backfillPreviews("text/plain", std::unexpected(error));
+
+    REQUIRE(previews.has_value());
+    CHECK(previews->empty());
+  }
+
+  auto const previews = backfillPreviews("text/plain", QByteArray("hello"));
+
+  REQUIRE(previews.has_value());
+  REQUIRE(previews->size() == 1);
+  CHECK(previews->front().data == "hello");
+}
@@ -0,0 +1,182 @@
+#include "extension/manager/bus-frame.hpp"
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <glaze/glaze.hpp>
+#include <format>
+#include <optional>
+#include <random>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace {
+
+constexpr std::string_view SESSION_ID = "0d9c3f7e-5b1a-4c8e-9f2d-6a7b8c9d0e1f";
+
+// What the generated manager client reads and writes for `extensionMessage` and `messageExtension`.
+struct IncomingMessage {
+  std::optional<int> id;
+  std::optional<std::string> method;
+  std::optional<std::string> error;
+  glz::raw_json result;
+  glz::raw_json params;
+};
+
+struct Request {
+  std::string jsonrpc;
+  std::string method;
+  int id;
+  glz::raw_json params;
+};
+
+struct Notification {
+  std::string jsonrpc;
+  std::string method;
+  glz::raw_json params;
+};
+
+struct ExtensionMessageParams {
+  std::string session_id;
+  std::string payload;
+};
+
+struct RenderParams {
+  std::string json;
+};
+
+std::string asJson(const auto &value) {
+  std::string out;
+  REQUIRE(!glz::write_json(value, out));
+  return out;
+}
+
+/**
+ * A `UI/render` request the way the reconciler sends it for a list of `count` items, each with a small
+ * inline icon: the views are a JSON string in the params of the request.
+ */
+std::string renderRequest(size_t count) {
+  std::mt19937 rng{42};
+  std::string icon(96, '\0');
+  std::string children;
+
+  for (auto &c : icon) {
+    c = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/"[rng() % 64];
+  }
+
+  for (size_t i = 0; i != count; ++i) {
+    if (i) children += ',';
+    children += std::format(R"({{"$t":"list-item","key":{},"props":{{"id":"item-{}","title":"Item \"{}\"",)"
+                            R"("subtitle":"/home/user/projects/{}",)"
+                            R"("icon":{{"source":"data:image/png;base64,{}"}},)"
+                            R"("accessories":[{{"text":"{} KB"}}]}},"children":[]}})",
+                            i + 1, i, i, rng() % 1000, icon, rng() % 4096);
+  }
+
+  auto views = std::format(R"({{"views":[{{"dirty":true,"root":{{"$t":"list","props":{{"isLoading":false,)"
+                           R"("filtering":true,"searchBarPlaceholder":"Search..."}},"children":[{}]}}}}]}})",
+                           children);
+
+  return asJson(Request{.jsonrpc = "2.0",
+                        .method = "UI/render",
+                        .id = 1,
+                        .params = asJson(RenderParams{.json = std::move(views)})});
+}
+
+std::string jsonFrame(std::string_view payload) {
+  return asJson(Notification{.jsonrpc = "2.0",
+                             .method = "Manager/extensionMessage",
+                             .params = asJson(ExtensionMessageParams{
+                                 .session_id = std::string{SESSION_ID}, .payload = std::string{payload}})});
+}
+
+std::string binaryFrame(std::string_view payload) {
+  std::string frame;
+  REQUIRE(bus_frame::encodeExtensionMessage(frame, SESSION_ID, payload));
+  return frame;
+}
+
+std::string_view bodyOf(std::string_view frame) { return frame.substr(bus_frame::LENGTH_SIZE); }
+
+// the extension message of a manager notification, as the generated client routes it
+size_t decodeJson(std::string_view frame) {
+  IncomingMessage msg;
+  ExtensionMessageParams params;
+
+  if (glz::read<glz::opts{.error_on_unknown_keys = false}>(msg, frame)) return 0;
+  if (glz::read_json(params, msg.params.str)) return 0;
+  return params.payload.size();
+}
+
+size_t decodeBinary(std::string_view frame) {
+  auto msg = bus_frame::decodeExtensionMessage(bodyOf(frame));
+  return msg ? msg->payload.size() : 0;
+}
+
+} // namespace
+
+TEST_CASE("extension message frames round trip", "[bus-frame]") {
+  std::string const payload = R"({"jsonrpc":"2.0","id":3,"method":"Storage/get","params":{"key":"é\n"}})";
+  auto const frame = binaryFrame(payload);
+
+  REQUIRE(frame.size() == bus_frame::LENGTH_SIZE + 2 + SESSION_ID.size() + payload.size());
+  // the length is big endian, and short here
+  REQUIRE(frame.starts_with(std::string{'\0', '\0', '\0'}));
+  REQUIRE(static_cast<uint8_t>(frame[3]) == 2 + SESSION_ID.size() + payload.size());
+  REQUIRE_FALSE(bus_frame::isRpc(bodyOf(frame)));
+
+  auto msg = bus_frame::decodeExtensionMessage(bodyOf(frame));
+  REQUIRE(msg);
+  REQUIRE(msg->sessionId == SESSION_ID);
+  REQUIRE(msg->payload == payload);
+}
+
+TEST_CASE("manager messages are told apart from binary frames", "[bus-frame]") {
+  REQUIRE(bus_frame::isRpc(R"({"jsonrpc":"2.0","id":1,"result":true})"));
+  REQUIRE_FALSE(bus_frame::isRpc(""));
+}
+
+TEST_CASE("malformed extension message frames are rejected", "[bus-frame]") {
+  using namespace std::string_view_literals;
+
+  REQUIRE_FALSE(bus_frame::decodeExtensionMessage(""));
+  REQUIRE_FALSE(bus_frame::decodeExtensionMessage("\x01"sv));
+  REQUIRE_FALSE(bus_frame::decodeExtensionMessage("\x01\x05id"sv));
+  REQUIRE_FALSE(bus_frame::decodeExtensionMessage("\x07\x00payload"sv));
+
+  auto empty = bus_frame::decodeExtensionMessage("\x01\x00"sv);
+  REQUIRE(empty);
+  REQUIRE(empty->sessionId.empty());
+  REQUIRE(empty->payload.empty());
+
+  std::string frame;
+  REQUIRE_FALSE(bus_frame::encodeExtensionMessage(frame, std::string(256, 'a'), "{}"));
+}
+
+TEST_CASE("both framings carry the same render payload", "[bus-frame]") {
+  auto const payload = renderRequest(50);
+
+  IncomingMessage msg;
+  ExtensionMessageParams params;
+  REQUIRE(!glz::read<glz::opts{.error_on_unknown_keys = false}>(msg, jsonFrame(payload)));
+  REQUIRE(!glz::read_json(params, msg.params.str));
+
+  auto const binary = binaryFrame(payload);
+  REQUIRE(params.payload == bus_frame::decodeExtensionMessage(bodyOf(binary))->payload);
+}
+
+TEST_CASE("extension bus framing throughput", "[!benchmark]") {
+  for (size_t const count : {50, 500, 5000}) {
+    auto const payload = renderRequest(count);
+    auto const json = jsonFrame(payload);
+    auto const binary = binaryFrame(payload);
+
+    BENCHMARK(std::format("render of {} items ({} KB): json decode", count, payload.size() / 1024)) {
+      return decodeJson(json);
+    };
+    BENCHMARK(std::format("render of {} items: binary decode", count)) { return decodeBinary(binary); };
+    BENCHMARK(std::format("render of {} items: json encode", count)) { return jsonFrame(payload).size(); };
+    BENCHMARK(std::format("render of {} items: binary encode", count)) {
+      return binaryFrame(payload).size();
+    };
+  }
+}
@@ -0,0 +1,123 @@
+#include "extend/render-patch.hpp"
+#include <catch2/catch_test_macros.hpp>
+#include <string>
+#include <variant>
+#include <vector>
+
+namespace {
+
+struct Item {
+  uint64_t key = 0;
+  std::string title;
+
+  bool operator==(const Item &) const = default;
+};
+
+struct Section {
+  uint64_t key = 0;
+  std::string title;
+  std::vector<Item> children;
+
+  bool operator==(const Section &) const = default;
+};
+
+using Child = std::variant<Item, Section>;
+using Op = PatchOp<Child>;
+
+Op insert(uint64_t key, uint64_t after, Child node, uint64_t parent = 0) {
+  return {.kind = PatchOpKind::Insert, .key = key, .parent = parent, .after = after, .node = std::move(node)};
+}
+
+Op move(uint64_t key, uint64_t after, uint64_t parent = 0) {
+  return {.kind = PatchOpKind::Move, .key = key, .parent = parent, .after = after};
+}
+
+Op remove(uint64_t key, uint64_t parent = 0) {
+  return {.kind = PatchOpKind::Remove, .key = key, .parent = parent};
+}
+
+Op update(uint64_t key, Child node, uint64_t parent = 0) {
+  return {.kind = PatchOpKind::Update, .key = key, .parent = parent, .node = std::move(node)};
+}
+
+std::vector<uint64_t> keys(const std::vector<Child> &items) {
+  std::vector<uint64_t> out;
+  for (const auto &child : items) {
+    out.push_back(std::visit([](const auto &v) { return v.key; }, child));
+  }
+  return out;
+}
+
+std::vector<uint64_t> keys(const std::vector<Item> &items) {
+  std::vector<uint64_t> out;
+  for (const auto &item : items) {
+    out.push_back(item.key);
+  }
+  return out;
+}
+
+std::vector<Child> threeItems() { return {Item{1, "one"}, Item{2, "two"}, Item{3, "three"}}; }
+
+} // namespace
+
+TEST_CASE("render patch inserts keyed items after their sibling") {
+  auto items = threeItems();
+
+  CHECK(render_patch::apply(items, {insert(4, 0, Item{4, "first"}), insert(5, 2, Item{5, "middle"})}));
+  CHECK(keys(items) == std::vector<uint64_t>{4, 1, 2, 5, 3});
+  CHECK(std::get<Item>(items[3]).title == "middle");
+}
+
+TEST_CASE("render patch moves keyed items") {
+  auto items = threeItems();
+
+  // the last item first, as the reconciler sends it: one step for one moved item
+  CHECK(render_patch::apply(items, {move(3, 0)}));
+  CHECK(keys(items) == std::vector<uint64_t>{3, 1, 2});
+
+  CHECK(render_patch::apply(items, {move(3, 2)}));
+  CHECK(keys(items) == std::vector<uint64_t>{1, 2, 3});
+}
+
+TEST_CASE("render patch removes keyed items") {
+  auto items = threeItems();
+
+  CHECK(render_patch::apply(items, {remove(2)}));
+  CHECK(keys(items) == std::vector<uint64_t>{1, 3});
+
+  // with a placement in the same patch
+  CHECK(render_patch::apply(items, {remove(1), insert(6, 3, Item{6, "six"})}));
+  CHECK(keys(items) == std::vector<uint64_t>{3, 6});
+}
+
+TEST_CASE("render patch updates keyed items in place") {
+  auto items = threeItems();
+
+  CHECK(render_patch::apply(items, {update(2, Item{2, "deux"})}));
+  CHECK(keys(items) == std::vector<uint64_t>{1, 2, 3});
+  CHECK(std::get<Item>(items[1]).title == "deux");
+}
+
+TEST_CASE("render patch updates sections without dropping their items") {
+  std::vector<Child> items{Section{10, "fruits", {Item{1, "apple"}, Item{2, "pear"}}}};
+
+  CHECK(render_patch::apply(items, {update(10, Section{10, "Fruits", {}}), update(2, Item{2, "plum"}, 10),
+                                    insert(3, 1, Item{3, "fig"}, 10)}));
+
+  auto const &section = std::get<Section>(items.front());
+  CHECK(section.title == "Fruits");
+  CHECK(keys(section.children) == std::vector<uint64_t>{1, 3, 2});
+  CHECK(section.children.back().title == "plum");
+}
+
+TEST_CASE("render patch reports steps that do not fit the current items") {
+  auto items = threeItems();
+
+  CHECK_FALSE(render_patch::apply(items, {update(7, Item{7, "missing"})}));
+  CHECK_FALSE(render_patch::apply(items, {move(7, 0)}));
+  CHECK_FALSE(render_patch::apply(items, {insert(8, 9, Item{8, "after nothing"})}));
+  CHECK_FALSE(render_patch::apply(items, {remove(7)}));
+  CHECK_FALSE(render_patch::apply(items, {insert(4, 0, Item{4, "orphan"}, 42)}));
+  // what fits is applied nonetheless
+  CHECK(keys(items) == std::vector<uint64_t>{1, 2, 3});
+}
@@ -0,0 +1,120 @@
+#include "qml/dmenu-input.hpp"
+#include <catch2/catch_test_macros.hpp>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace {
+
+std::string numberedLines(size_t count, size_t first = 0) {
+  std::string text;
+  for (size_t i = first; i != first + count; ++i) {
+    text += "entry-" + std::to_string(i) + "\n";
+  }
+  return text;
+}
+
+std::vector<size_t> bases(const std::vector<DMenuInput::ChunkPtr> &chunks) {
+  std::vector<size_t> out;
+  for (const auto &chunk : chunks) {
+    out.push_back(chunk->base);
+  }
+  return out;
+}
+
+std::vector<size_t> indexes(const std::vector<DMenuMatch> &matches) {
+  std::vector<size_t> out;
+  for (const auto &match : matches) {
+    out.push_back(match.data.second);
+  }
+  return out;
+}
+
+} // namespace
+
+TEST_CASE("dmenu input keeps non-empty lines") {
+  DMenuInput input;
+
+  input.append("firefox\n\nkitty\n\n\nnautilus");
+
+  REQUIRE(input.size() == 3);
+  CHECK(input.at(0) == "firefox");
+  CHECK(input.at(1) == "kitty");
+  // a trailing line without a newline is an entry as well
+  CHECK(input.at(2) == "nautilus");
+  CHECK(input.at(3).empty());
+
+  input.append("\n\n");
+  CHECK(input.size() == 3);
+}
+
+TEST_CASE("dmenu input splits large inputs into chunks") {
+  DMenuInput input;
+  size_t const total = DMenuInput::CHUNK_SIZE * 2 + 10;
+
+  input.append(numberedLines(total));
+
+  auto const chunks = input.chunks(0, total);
+
+  REQUIRE(input.size() == total);
+  CHECK(bases(chunks) == std::vector<size_t>{0, DMenuInput::CHUNK_SIZE, DMenuInput::CHUNK_SIZE * 2});
+  CHECK(chunks.back()->entries.size() == 10);
+  CHECK(input.at(DMenuInput::CHUNK_SIZE) == "entry-" + std::to_string(DMenuInput::CHUNK_SIZE));
+  CHECK(input.at(total - 1) == "entry-" + std::to_string(total - 1));
+}
+
+TEST_CASE("dmenu input appends chunks after the ones already there") {
+  DMenuInput input;
+
+  input.append(numberedLines(3));
+  auto const first = input.chunks(0, 3);
+  input.append(numberedLines(2, 3));
+
+  REQUIRE(input.size() == 5);
+  CHECK(input.at(3) == "entry-3");
+  CHECK(bases(input.chunks(0, 5)) == std::vector<size_t>{0, 3});
+  // chunks handed out before are left as they were
+  REQUIRE(first.size() == 1);
+  CHECK(first.front()->entries.size() == 3);
+}
+
+TEST_CASE("dmenu input hands out the chunks covering a range") {
+  DMenuInput input;
+
+  for (size_t i = 0; i != 4; ++i) {
+    input.append(numberedLines(10, i * 10));
+  }
+
+  CHECK(bases(input.chunks(0, 10)) == std::vector<size_t>{0});
+  // the chunk holding `from` comes first, even when it starts before it
+  CHECK(bases(input.chunks(15, 10)) == std::vector<size_t>{10, 20});
+  CHECK(bases(input.chunks(20, 100)) == std::vector<size_t>{20, 30});
+  CHECK(input.chunks(40, 10).empty());
+}
+
+TEST_CASE("dmenu matches chunk entries from the first one pending") {
+  DMenuInput input;
+
+  input.append("firefox\nkitty\nfirefox-esr\nthunderbird\n");
+  auto const chunk = input.chunks(0, input.size()).front();
+
+  CHECK(indexes(matchChunk(*chunk, "firefox", 0)) == std::vector<size_t>{0, 2});
+  CHECK(indexes(matchChunk(*chunk, "firefox", 1)) == std::vector<size_t>{2});
+  CHECK(matchChunk(*chunk, "firefox", 4).empty());
+
+  auto const matches = matchChunk(*chunk, "kitty", 0);
+  REQUIRE(matches.size() == 1);
+  CHECK(matches.front().data.first == "kitty");
+}
+
+TEST_CASE("dmenu matches index entries in the whole input") {
+  DMenuInput input;
+
+  input.append("alpha\nbeta\n");
+  input.append("gamma\nalpha-2\n");
+  auto const chunks = input.chunks(0, input.size());
+
+  REQUIRE(chunks.size() == 2);
+  CHECK(indexes(matchChunk(*chunks.back(), "alpha", 0)) == std::vector<size_t>{3});
+  CHECK(indexes(matchChunk(*chunks.back(), "alpha", 3)) == std::vector<size_t>{3});
+}
@@ -0,0 +1,183 @@
+#include "qml/root-search-executor.hpp"
+#include <catch2/catch_test_macros.hpp>
+#include <QCoreApplication>
+#include <QThreadPool>
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <optional>
+#include <vector>
+
+namespace {
+
+using Source = RootSearchExecutor::Source;
+
+// continuations are delivered through the event loop of the executor's thread
+void ensureApplication() {
+  static int argc = 1;
+  static char name[] = "root-search-executor-tests";
+  static char *argv[] = {name, nullptr};
+
+  if (!QCoreApplication::instance()) new QCoreApplication(argc, argv);
+}
+
+template <typename F> bool processEventsUntil(F &&done) {
+  auto const deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+
+  while (!done()) {
+    if (std::chrono::steady_clock::now() > deadline) return false;
+    QCoreApplication::processEvents(QEventLoop::AllEvents, 10);
+  }
+
+  return true;
+}
+
+struct Timing {
+  Source source;
+  bool applied;
+};
+
+} // namespace
+
+TEST_CASE("root search executor applies the result of the current generation") {
+  ensureApplication();
+  RootSearchExecutor executor;
+  QThreadPool pool;
+  std::optional<int> applied;
+
+  pool.setMaxThreadCount(1);
+  executor.next();
+  executor.run<int>(Source::Calculator, &pool, [] { return 42; }, [&](int value) { applied = value; });
+
+  REQUIRE(processEventsUntil([&] { return applied.has_value(); }));
+  CHECK(*applied == 42);
+}
+
+TEST_CASE("root search executor drops results that arrive after a newer generation started") {
+  ensureApplication();
+  RootSearchExecutor executor;
+  QThreadPool pool;
+  std::promise<void> release;
+  std::vector<Timing> timings;
+  bool applied = false;
+
+  pool.setMaxThreadCount(1);
+  QObject::connect(&executor, &RootSearchExecutor::sourceTimed,
+                   [&](Source source, std::chrono::microseconds, bool wasApplied) {
+                     timings.push_back({source, wasApplied});
+                   });
+
+  executor.run<int>(
+      Source::Calculator, &pool,
+      [started = release.get_future().share()] {
+        started.wait();
+        return 1;
+      },
+      [&](int) { applied = true; });
+
+  executor.next();
+  release.set_value();
+
+  REQUIRE(processEventsUntil([&] { return !timings.empty(); }));
+  pool.waitForDone();
+  QCoreApplication::processEvents();
+
+  CHECK_FALSE(applied);
+  REQUIRE(timings.size() == 1);
+  CHECK(timings.front().source == Source::Calculator);
+  CHECK_FALSE(timings.front().applied);
+}
+
+TEST_CASE("root search executor skips outdated runs still waiting for their lane") {
+  ensureApplication();
+  RootSearchExecutor executor;
+  QThreadPool pool;
+  std::promise<void> release;
+  std::atomic<bool> queuedRan = false;
+  std::optional<int> applied;
+
+  pool.setMaxThreadCount(1);
+
+  executor.run<int>(
+      Source::Calculator, &pool,
+      [started = release.get_future().share()] {
+        started.wait();
+        return 1;
+      },
+      [](int) {});
+  executor.run<int>(
+      Source::Calculator, &pool,
+      [&] {
+        queuedRan = true;
+        return 2;
+      },
+      [](int) {});
+
+  executor.next();
+  executor.run<int>(Source::Calculator, &pool, [] { return 3; }, [&](int value) { applied = value; });
+  release.set_value();
+
+  REQUIRE(processEventsUntil([&] { return applied.has_value(); }));
+  CHECK(*applied == 3);
+  CHECK_FALSE(queuedRan);
+}
+
+TEST_CASE("root search executor aborts a run outdated while it is in progress") {
+  ensureApplication();
+  RootSearchExecutor executor;
+  QThreadPool pool;
+  std::promise<void> started;
+  std::promise<void> aborted;
+  auto abortedFuture = aborted.get_future().share();
+  int abortCalls = 0;
+
+  pool.setMaxThreadCount(1);
+
+  executor.run<int>(
+      Source::Calculator, &pool,
+      [&started, abortedFuture] {
+        started.set_value();
+        abortedFuture.wait();
+        return 1;
+      },
+      [](int) {},
+      [&] {
+        ++abortCalls;
+        aborted.set_value();
+      });
+
+  started.get_future().wait();
+  executor.next();
+  pool.waitForDone();
+
+  CHECK(abortCalls == 1);
+
+  // nothing left to abort
+  executor.next();
+  CHECK(abortCalls == 1);
+}
+
+TEST_CASE("root search executor does not abort runs that have not started") {
+  ensureApplication();
+  RootSearchExecutor executor;
+  QThreadPool pool;
+  std::promise<void> release;
+  int abortCalls = 0;
+
+  pool.setMaxThreadCount(1);
+
+  executor.run<int>(
+      Source::Path, &pool,
+      [started = release.get_future().share()] {
+        started.wait();
+        return 1;
+      },
+      [](int) {});
+  executor.run<int>(Source::Calculator, &pool, [] { return 2; }, [](int) {}, [&] { ++abortCalls; });
+
+  executor.next();
+  release.set_value();
+  pool.waitForDone();
+
+  CHECK(abortCalls == 0);
+}
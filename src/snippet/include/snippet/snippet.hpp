@@ -1,10 +1,12 @@
 #pragma once
+#include <linux/input.h>
 #include <optional>
 #include <sys/epoll.h>
 #include <libudev.h>
 #include <unistd.h>
 #include <xkbcommon/xkbcommon.h>
 #include "linuxutils/keyboard.hpp"
+#include "trigger-automaton.hpp"
 #include "types.hpp"
 
 class Frame;
@@ -49,13 +51,16 @@ private:
   std::vector<std::string> enumerateDevices(const char *property);
   bool registerDevice(const char *device, DeviceType type);
   void removeDevice(std::vector<InputDevice>::iterator it);
+  void handleInputEvent(const InputDevice &device, const input_event &ev);
+  void rebuildTriggers();
+  const Snippet *findTriggered(bool wordSeparator) const;
   void emitExpansion(const Snippet &snippet);
   bool hasActiveModifiers() const;
   void flushPendingExpansion();
   void drainInputEvents();
   bool checkInputInterrupt();
 
-  std::string m_text;
+  TypedText m_text;
   std::optional<std::string> m_undoTrigger;
   std::optional<Snippet> m_pendingExpansion;
   udev *m_udev = nullptr;
@@ -64,6 +69,8 @@ private:
   xkb_state *m_kbState = nullptr;
   int m_epollFd = -1;
   std::vector<Snippet> m_snippets;
+  TriggerAutomaton m_triggers;
+  bool m_triggersStale = false;
   linuxutils::UInputKeyboard m_keyboard;
 
   Frame *m_ipcFrame = nullptr;
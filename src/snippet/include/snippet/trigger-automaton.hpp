@@ -0,0 +1,107 @@
+#pragma once
+#include <array>
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace snippet {
+
+/**
+ * Aho-Corasick automaton over snippet triggers, fed the typed text one byte at a time.
+ *
+ * A state stands for the longest end of the typed text that some trigger starts with, so that finding the
+ * triggers the text ends with takes one table lookup per typed byte, however many snippets there are.
+ * Bytes no trigger contains all share a single column of the transition table.
+ */
+class TriggerAutomaton {
+public:
+  using State = uint32_t;
+  static constexpr State ROOT = 0;
+
+  // Matches nothing.
+  TriggerAutomaton();
+
+  // Triggers are referred to by their index in `triggers`. Empty triggers never match.
+  explicit TriggerAutomaton(std::span<const std::string_view> triggers);
+
+  State next(State state, char c) const {
+    return m_next[state * m_columns + m_column[static_cast<uint8_t>(c)]];
+  }
+
+  State feed(State state, std::string_view text) const {
+    for (char const c : text) {
+      state = next(state, c);
+    }
+    return state;
+  }
+
+  /**
+   * The longest trigger the text of `state` ends with that is at most `maxLength` bytes long and for
+   * which `accept` returns true. Triggers of the same length are tried in index order.
+   */
+  template <typename Accept>
+  std::optional<size_t> find(State state, size_t maxLength, Accept &&accept) const {
+    for (State s = state; s != ROOT; s = m_outputLink[s]) {
+      if (m_depth[s] > maxLength) continue;
+      for (uint32_t const trigger : m_outputs[s]) {
+        if (accept(static_cast<size_t>(trigger))) return trigger;
+      }
+    }
+    return std::nullopt;
+  }
+
+  size_t stateCount() const { return m_depth.size(); }
+
+private:
+  // column of every byte, 0 for those no trigger contains
+  std::array<uint16_t, 256> m_column{};
+  size_t m_columns = 1;
+  // `m_columns` transitions per state
+  std::vector<State> m_next;
+  std::vector<uint32_t> m_depth;
+  // triggers spelling out the whole text of the state
+  std::vector<std::vector<uint32_t>> m_outputs;
+  // next shorter state some trigger ends at, ROOT if none
+  std::vector<State> m_outputLink;
+};
+
+/**
+ * The last bytes typed, at most `capacity` of them, along with the state of the automaton after each.
+ * Going back a byte is then just as cheap as going forward.
+ */
+class TypedText {
+public:
+  explicit TypedText(size_t capacity) : m_capacity(capacity) {
+    m_text.reserve(capacity);
+    m_states.reserve(capacity);
+  }
+
+  std::string_view text() const { return m_text; }
+  size_t size() const { return m_text.size(); }
+
+  void append(const TriggerAutomaton &automaton, std::string_view text);
+  void eraseLast();
+  void clear();
+
+  // Walks the text again, after `automaton` replaced the one it was typed with.
+  void reset(const TriggerAutomaton &automaton);
+
+  // Same as `TriggerAutomaton::find`, for the first `length` bytes of the text.
+  template <typename Accept>
+  std::optional<size_t> find(const TriggerAutomaton &automaton, size_t length, Accept &&accept) const {
+    if (length == 0 || length > m_text.size()) return std::nullopt;
+    // the state may account for bytes that have been dropped from the text since
+    return automaton.find(m_states[length - 1], length, std::forward<Accept>(accept));
+  }
+
+private:
+  size_t m_capacity;
+  std::string m_text;
+  std::vector<TriggerAutomaton::State> m_states;
+};
+
+}; // namespace snippet
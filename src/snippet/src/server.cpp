@@ -8,6 +8,7 @@
 #include <linux/input.h>
 #include <libudev.h>
 #include <poll.h>
+#include <span>
 #include <string_view>
 #include <xkbcommon/xkbcommon.h>
 #include <fcntl.h>
@@ -17,6 +18,8 @@
 #include <algorithm>
 
 static constexpr size_t MAX_BUFFER_SIZE = 32;
+// input events read from a device at once
+static constexpr size_t INPUT_EVENT_BATCH = 64;
 static constexpr uint32_t MAX_MESSAGE_SIZE = 64 * 1024;
 static constexpr const char *VIRTUAL_KB_NAME = "vicinae-snippet-virtual-keyboard";
 static constexpr std::string_view INPUT_EVENT_PREFIX = "/dev/input/event";
@@ -82,12 +85,10 @@ private:
 namespace snippet {
 
 SnippetService::SnippetService(snippet_gen::RpcTransport &transport)
-    : snippet_gen::AbstractSnippet(transport), m_udev(udev_new()),
+    : snippet_gen::AbstractSnippet(transport), m_text(MAX_BUFFER_SIZE), m_udev(udev_new()),
       m_xkb(xkb_context_new(XKB_CONTEXT_NO_FLAGS)),
       m_keymap(xkb_keymap_new_from_names(m_xkb, nullptr, XKB_KEYMAP_COMPILE_NO_FLAGS)),
-      m_kbState(xkb_state_new(m_keymap)) {
-  m_text.reserve(MAX_BUFFER_SIZE);
-}
+      m_kbState(xkb_state_new(m_keymap)) {}
 
 std::vector<std::string> SnippetService::enumerateDevices(const char *property) {
   udev_enumerate *enumerate = udev_enumerate_new(m_udev);
@@ -124,13 +125,14 @@ std::expected<snippet_gen::CreateSnippetResponse, std::string>
 SnippetService::createSnippet(snippet_gen::CreateSnippetRequest req) {
   std::cerr << "Created new snippet with trigger " << req.trigger << '\n';
   m_snippets.push_back(Snippet{.trigger = req.trigger, .mode = req.mode});
-  std::ranges::sort(m_snippets, [](auto &&a, auto &&b) { return a.trigger.size() > b.trigger.size(); });
+  m_triggersStale = true;
   return snippet_gen::CreateSnippetResponse{};
 }
 
 std::expected<snippet_gen::RemoveSnippetResponse, std::string>
 SnippetService::removeSnippet(snippet_gen::RemoveSnippetRequest req) {
   std::erase_if(m_snippets, [&](auto &&s) { return s.trigger == req.trigger; });
+  m_triggersStale = true;
   return snippet_gen::RemoveSnippetResponse{};
 }
 
@@ -193,17 +195,19 @@ std::expected<snippet_gen::KeyboardCapabilities, std::string> SnippetService::ge
 }
 
 void SnippetService::drainInputEvents() {
+  std::array<input_event, INPUT_EVENT_BATCH> events;
+
   for (const auto &dev : m_devices) {
     pollfd pfd = {.fd = dev.fd, .events = POLLIN, .revents = 0};
     while (poll(&pfd, 1, 0) > 0 && (pfd.revents & POLLIN)) {
-      input_event ev{};
-      if (read(dev.fd, &ev, sizeof(ev)) < static_cast<ssize_t>(sizeof(ev))) break;
+      if (read(dev.fd, events.data(), sizeof(events)) < static_cast<ssize_t>(sizeof(input_event))) break;
     }
   }
 }
 
 bool SnippetService::checkInputInterrupt() {
   std::array<epoll_event, 16> ready{};
+  std::array<input_event, INPUT_EVENT_BATCH> events;
   const int n = epoll_wait(m_epollFd, ready.data(), ready.size(), 0);
 
   for (int i = 0; i < n; ++i) {
@@ -211,11 +215,14 @@ bool SnippetService::checkInputInterrupt() {
     auto it = std::ranges::find(m_devices, fd, &InputDevice::fd);
     if (it == m_devices.end()) continue;
 
-    input_event ev{};
-    if (read(fd, &ev, sizeof(ev)) < static_cast<ssize_t>(sizeof(ev))) continue;
+    const auto rc = read(fd, events.data(), sizeof(events));
+    if (rc < static_cast<ssize_t>(sizeof(input_event))) continue;
 
     if (it->type == DeviceType::Pointer) return true;
-    if (ev.type == EV_KEY && ev.value == 1) return true;
+
+    for (const auto &ev : std::span(events).first(rc / sizeof(input_event))) {
+      if (ev.type == EV_KEY && ev.value == 1) return true;
+    }
   }
   return false;
 }
@@ -415,74 +422,105 @@ void SnippetService::listen(snippet_gen::Server &rpcServer) {
         continue;
       }
 
-      input_event inputEv;
-      std::array<char, 8> key;
-
-      const auto rc = read(fd, &inputEv, sizeof(inputEv));
+      std::array<input_event, INPUT_EVENT_BATCH> inputEvents;
+      const auto rc = read(fd, inputEvents.data(), sizeof(inputEvents));
 
       if (rc <= 0) {
         removeDevice(it);
         continue;
       }
 
-      if (static_cast<size_t>(rc) < sizeof(inputEv)) {
-        std::cerr << "read of invalid size for event: expected " << sizeof(inputEv) << ", got " << rc << '\n';
+      if (static_cast<size_t>(rc) % sizeof(input_event) != 0) {
+        std::cerr << "read of invalid size for events: expected a multiple of " << sizeof(input_event)
+                  << ", got " << rc << '\n';
         continue;
       }
 
-      if (it->type == DeviceType::Pointer) continue;
-      if (inputEv.type != EV_KEY) { continue; }
+      // when typing fast, a key press can come along with its release and the next keys: they are all
+      // handled on this wakeup
+      for (const auto &inputEv : std::span(inputEvents).first(rc / sizeof(input_event))) {
+        handleInputEvent(*it, inputEv);
+      }
+    }
+  }
+}
 
-      const xkb_keycode_t keycode = inputEv.code + 8;
+void SnippetService::handleInputEvent(const InputDevice &device, const input_event &inputEv) {
+  std::array<char, 8> key;
 
-      if (inputEv.value == 0) {
-        xkb_state_update_key(m_kbState, keycode, XKB_KEY_UP);
-        if (m_pendingExpansion && !hasActiveModifiers()) { flushPendingExpansion(); }
-      } else if (inputEv.value <= 2) {
-        const int len = xkb_state_key_get_utf8(m_kbState, keycode, key.data(), key.size());
-        const std::string_view keyStr{key.data(), static_cast<size_t>(len)};
+  if (device.type == DeviceType::Pointer) return;
+  if (inputEv.type != EV_KEY) { return; }
 
-        if (inputEv.value == 1) { xkb_state_update_key(m_kbState, keycode, XKB_KEY_DOWN); }
+  const xkb_keycode_t keycode = inputEv.code + 8;
 
-        if (m_undoTrigger && inputEv.value == 1) {
-          if (inputEv.code == KEY_BACKSPACE) {
-            std::cerr << "SNIPPET UNDO: " << *m_undoTrigger << '\n';
-            emitundoSnippet({.trigger = *m_undoTrigger});
-            m_undoTrigger.reset();
-            continue;
-          }
-          m_undoTrigger.reset();
-        }
+  if (inputEv.value == 0) {
+    xkb_state_update_key(m_kbState, keycode, XKB_KEY_UP);
+    if (m_pendingExpansion && !hasActiveModifiers()) { flushPendingExpansion(); }
+  } else if (inputEv.value <= 2) {
+    const int len = xkb_state_key_get_utf8(m_kbState, keycode, key.data(), key.size());
+    const std::string_view keyStr{key.data(), static_cast<size_t>(len)};
 
-        if (!keyStr.empty()) {
-          if (inputEv.code == KEY_BACKSPACE) {
-            if (!m_text.empty()) { m_text.erase(m_text.end() - 1); }
-          } else if (std::isprint(keyStr.at(0))) {
-            m_text.append(keyStr);
-            if (m_text.size() > MAX_BUFFER_SIZE) { m_text.erase(0, m_text.size() - MAX_BUFFER_SIZE); }
-          }
-        }
+    if (inputEv.value == 1) { xkb_state_update_key(m_kbState, keycode, XKB_KEY_DOWN); }
 
-        const bool wordSep = !keyStr.empty() && isWordSeparator(keyStr.at(0));
+    if (m_undoTrigger && inputEv.value == 1) {
+      if (inputEv.code == KEY_BACKSPACE) {
+        std::cerr << "SNIPPET UNDO: " << *m_undoTrigger << '\n';
+        emitundoSnippet({.trigger = *m_undoTrigger});
+        m_undoTrigger.reset();
+        return;
+      }
+      m_undoTrigger.reset();
+    }
 
-        for (const auto &snippet : m_snippets) {
-          if (snippet.mode == snippet_gen::ExpansionMode::Keydown) {
-            if (snippet.trigger.size() > m_text.size()) continue;
-            if (m_text.ends_with(snippet.trigger)) {
-              emitExpansion(snippet);
-              break;
-            }
-          } else if (wordSep) {
-            if (snippet.trigger.size() + 1 > m_text.size()) continue;
-            if (std::string_view(m_text).substr(0, m_text.size() - 1).ends_with(snippet.trigger)) {
-              emitExpansion(snippet);
-              break;
-            }
-          }
-        }
+    // snippets tend to be created in bulk, the automaton is only rebuilt once they are in
+    if (m_triggersStale) rebuildTriggers();
+
+    if (!keyStr.empty()) {
+      if (inputEv.code == KEY_BACKSPACE) {
+        m_text.eraseLast();
+      } else if (std::isprint(keyStr.at(0))) {
+        m_text.append(m_triggers, keyStr);
       }
     }
+
+    const bool wordSep = !keyStr.empty() && isWordSeparator(keyStr.at(0));
+
+    if (const Snippet *snippet = findTriggered(wordSep)) { emitExpansion(*snippet); }
+  }
+}
+
+void SnippetService::rebuildTriggers() {
+  std::vector<std::string_view> triggers;
+
+  triggers.reserve(m_snippets.size());
+  for (const auto &snippet : m_snippets) {
+    triggers.emplace_back(snippet.trigger);
   }
+
+  m_triggers = TriggerAutomaton(triggers);
+  m_triggersStale = false;
+  // the text typed so far is kept, so that a trigger being typed still expands
+  m_text.reset(m_triggers);
+}
+
+/**
+ * The longest snippet triggered by the key just typed: keydown snippets whose trigger the text ends with
+ * and, if the key separates words, word snippets whose trigger the text ended with before it.
+ */
+const SnippetService::Snippet *SnippetService::findTriggered(bool wordSeparator) const {
+  const auto longest = [&](size_t length, snippet_gen::ExpansionMode mode) -> const Snippet * {
+    auto const index =
+        m_text.find(m_triggers, length, [&](size_t i) { return m_snippets[i].mode == mode; });
+    return index ? &m_snippets[*index] : nullptr;
+  };
+
+  const Snippet *keydown = longest(m_text.size(), snippet_gen::ExpansionMode::Keydown);
+  const Snippet *word = wordSeparator && m_text.size() > 0
+                            ? longest(m_text.size() - 1, snippet_gen::ExpansionMode::Word)
+                            : nullptr;
+
+  if (keydown && word) return word->trigger.size() > keydown->trigger.size() ? word : keydown;
+  return keydown ? keydown : word;
 }
 
 bool SnippetService::hasActiveModifiers() const {
@@ -0,0 +1,119 @@
+#include "snippet/trigger-automaton.hpp"
+#include <deque>
+#include <limits>
+
+namespace snippet {
+
+static constexpr TriggerAutomaton::State NO_STATE = std::numeric_limits<TriggerAutomaton::State>::max();
+
+TriggerAutomaton::TriggerAutomaton() : m_next(1, ROOT), m_depth(1, 0), m_outputs(1), m_outputLink(1, ROOT) {}
+
+TriggerAutomaton::TriggerAutomaton(std::span<const std::string_view> triggers) {
+  for (auto trigger : triggers) {
+    for (char const c : trigger) {
+      auto &column = m_column[static_cast<uint8_t>(c)];
+      if (column == 0) column = m_columns++;
+    }
+  }
+
+  const auto addState = [&](uint32_t depth) {
+    m_next.resize(m_next.size() + m_columns, NO_STATE);
+    m_depth.push_back(depth);
+    m_outputs.emplace_back();
+    m_outputLink.push_back(ROOT);
+    return static_cast<State>(m_depth.size() - 1);
+  };
+
+  addState(0);
+
+  // the trie of the triggers first, the missing transitions are filled in below
+  for (size_t i = 0; i != triggers.size(); ++i) {
+    if (triggers[i].empty()) continue;
+
+    State state = ROOT;
+
+    for (char const c : triggers[i]) {
+      size_t const slot = state * m_columns + m_column[static_cast<uint8_t>(c)];
+
+      if (m_next[slot] == NO_STATE) {
+        State const child = addState(m_depth[state] + 1);
+        m_next[slot] = child;
+      }
+      state = m_next[slot];
+    }
+
+    m_outputs[state].push_back(static_cast<uint32_t>(i));
+  }
+
+  // Breadth first, so that the state a failed transition falls back to is always complete already. The
+  // fallback of a state is not stored: its transitions are copied into the missing ones instead.
+  std::vector<State> fallback(m_depth.size(), ROOT);
+  std::deque<State> queue;
+
+  for (size_t column = 0; column != m_columns; ++column) {
+    State &child = m_next[column];
+    if (child == NO_STATE) {
+      child = ROOT;
+    } else {
+      queue.push_back(child);
+    }
+  }
+
+  while (!queue.empty()) {
+    State const state = queue.front();
+    State const back = fallback[state];
+
+    queue.pop_front();
+    m_outputLink[state] = m_outputs[back].empty() ? m_outputLink[back] : back;
+
+    for (size_t column = 0; column != m_columns; ++column) {
+      State &child = m_next[state * m_columns + column];
+      State const backChild = m_next[back * m_columns + column];
+
+      if (child == NO_STATE) {
+        child = backChild;
+      } else {
+        fallback[child] = backChild;
+        queue.push_back(child);
+      }
+    }
+  }
+}
+
+void TypedText::append(const TriggerAutomaton &automaton, std::string_view text) {
+  TriggerAutomaton::State state = m_states.empty() ? TriggerAutomaton::ROOT : m_states.back();
+
+  for (char const c : text) {
+    state = automaton.next(state, c);
+    m_states.push_back(state);
+  }
+  m_text.append(text);
+
+  if (m_text.size() > m_capacity) {
+    size_t const excess = m_text.size() - m_capacity;
+    m_text.erase(0, excess);
+    m_states.erase(m_states.begin(), m_states.begin() + excess);
+  }
+}
+
+void TypedText::eraseLast() {
+  if (m_text.empty()) return;
+  m_text.pop_back();
+  m_states.pop_back();
+}
+
+void TypedText::clear() {
+  m_text.clear();
+  m_states.clear();
+}
+
+void TypedText::reset(const TriggerAutomaton &automaton) {
+  TriggerAutomaton::State state = TriggerAutomaton::ROOT;
+
+  for (size_t i = 0; i != m_text.size(); ++i) {
+    state = automaton.next(state, m_text[i]);
+    m_states[i] = state;
+  }
+}
+
+}; // namespace snippet
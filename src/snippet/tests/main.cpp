@@ -1,7 +1,163 @@
-#include <snippet/snippet.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <optional>
+#include <random>
+#include <string>
+#include <string_view>
+#include <vector>
+#include "snippet/trigger-automaton.hpp"
 
-int main() {
-  snippet::Server server;
+using snippet::TriggerAutomaton;
+using snippet::TypedText;
 
-  server.listen();
+namespace {
+
+std::optional<size_t> longestIn(const TriggerAutomaton &automaton, std::string_view text) {
+  return automaton.find(automaton.feed(TriggerAutomaton::ROOT, text), text.size(), [](size_t) { return true; });
+}
+
+// what the automaton replaces: the longest trigger the text ends with, checking every one of them
+std::optional<size_t> longestScanned(const std::vector<std::string_view> &triggers, std::string_view text) {
+  std::optional<size_t> found;
+
+  for (size_t i = 0; i != triggers.size(); ++i) {
+    if (triggers[i].empty() || !text.ends_with(triggers[i])) continue;
+    if (!found || triggers[i].size() > triggers[*found].size()) found = i;
+  }
+
+  return found;
+}
+
+} // namespace
+
+TEST_CASE("finds the longest trigger the text ends with") {
+  std::vector<std::string_view> const triggers = {":sig", "sig", ":date", "e", ":signature"};
+  TriggerAutomaton const automaton(triggers);
+
+  REQUIRE(longestIn(automaton, "hello :sig") == 0);
+  REQUIRE(longestIn(automaton, "xsig") == 1);
+  REQUIRE(longestIn(automaton, "up to :date") == 2);
+  REQUIRE(longestIn(automaton, "the") == 3);
+  REQUIRE(longestIn(automaton, ":signature") == 4);
+  REQUIRE(longestIn(automaton, ":signatur") == std::nullopt);
+  REQUIRE(longestIn(automaton, "") == std::nullopt);
+}
+
+TEST_CASE("shorter triggers are found when longer ones are not accepted") {
+  std::vector<std::string_view> const triggers = {"ab", "cab", "b", "cab"};
+  TriggerAutomaton const automaton(triggers);
+  auto const state = automaton.feed(TriggerAutomaton::ROOT, "xcab");
+
+  REQUIRE(automaton.find(state, 4, [](size_t) { return true; }) == 1);
+  REQUIRE(automaton.find(state, 4, [](size_t i) { return i != 1; }) == 3);
+  REQUIRE(automaton.find(state, 4, [](size_t i) { return i == 2; }) == 2);
+  REQUIRE(automaton.find(state, 2, [](size_t) { return true; }) == 0);
+  REQUIRE(automaton.find(state, 0, [](size_t) { return true; }) == std::nullopt);
+}
+
+TEST_CASE("empty triggers and automatons match nothing") {
+  std::vector<std::string_view> const triggers = {""};
+
+  REQUIRE(longestIn(TriggerAutomaton(triggers), "abc") == std::nullopt);
+  REQUIRE(longestIn(TriggerAutomaton(), "abc") == std::nullopt);
+  REQUIRE(TriggerAutomaton().stateCount() == 1);
+}
+
+TEST_CASE("multi byte triggers") {
+  std::vector<std::string_view> const triggers = {"café", "→", "é"};
+  TriggerAutomaton const automaton(triggers);
+
+  REQUIRE(longestIn(automaton, "un café") == 0);
+  REQUIRE(longestIn(automaton, "a→") == 1);
+  REQUIRE(longestIn(automaton, "thé") == 2);
+}
+
+TEST_CASE("typed text tracks the automaton through edits") {
+  std::vector<std::string_view> const triggers = {":sig", ";;"};
+  TriggerAutomaton const automaton(triggers);
+  TypedText text(8);
+  auto const any = [](size_t) { return true; };
+
+  text.append(automaton, ":sir");
+  REQUIRE(text.find(automaton, text.size(), any) == std::nullopt);
+
+  text.eraseLast();
+  text.append(automaton, "g");
+  REQUIRE(text.text() == ":sig");
+  REQUIRE(text.find(automaton, text.size(), any) == 0);
+
+  // as it was before the last byte
+  text.append(automaton, " ");
+  REQUIRE(text.find(automaton, text.size(), any) == std::nullopt);
+  REQUIRE(text.find(automaton, text.size() - 1, any) == 0);
+
+  text.clear();
+  text.append(automaton, ";");
+  REQUIRE(text.find(automaton, text.size(), any) == std::nullopt);
+  text.append(automaton, ";");
+  REQUIRE(text.find(automaton, text.size(), any) == 1);
+}
+
+TEST_CASE("typed text only matches triggers it still holds") {
+  std::vector<std::string_view> const triggers = {"abcdef"};
+  TriggerAutomaton const automaton(triggers);
+  TypedText text(4);
+  auto const any = [](size_t) { return true; };
+
+  text.append(automaton, "abcdef");
+  REQUIRE(text.text() == "cdef");
+  REQUIRE(text.find(automaton, text.size(), any) == std::nullopt);
+}
+
+TEST_CASE("typed text follows a rebuilt automaton") {
+  std::vector<std::string_view> triggers = {"xyz"};
+  TriggerAutomaton automaton(triggers);
+  TypedText text(16);
+  auto const any = [](size_t) { return true; };
+
+  text.append(automaton, "hello :d");
+  triggers.emplace_back(":da");
+  automaton = TriggerAutomaton(triggers);
+  text.reset(automaton);
+  text.append(automaton, "a");
+
+  REQUIRE(text.find(automaton, text.size(), any) == 1);
+}
+
+TEST_CASE("matches the same triggers as checking every one of them") {
+  std::mt19937 rng{1234};
+  // a small alphabet, so that triggers overlap a lot
+  constexpr std::string_view ALPHABET = "ab:;.";
+
+  const auto randomText = [&](size_t maxLength) {
+    std::string text(1 + rng() % maxLength, '\0');
+    for (auto &c : text) {
+      c = ALPHABET[rng() % ALPHABET.size()];
+    }
+    return text;
+  };
+
+  for (int round = 0; round != 20; ++round) {
+    std::vector<std::string> owned;
+    for (int i = 0; i != 40; ++i) {
+      owned.emplace_back(randomText(6));
+    }
+
+    std::vector<std::string_view> const triggers(owned.begin(), owned.end());
+    TriggerAutomaton const automaton(triggers);
+    TriggerAutomaton::State state = TriggerAutomaton::ROOT;
+    std::string typed;
+
+    for (int i = 0; i != 500; ++i) {
+      char const c = ALPHABET[rng() % ALPHABET.size()];
+      typed.push_back(c);
+      state = automaton.next(state, c);
+
+      auto const found = automaton.find(state, typed.size(), [](size_t) { return true; });
+      auto const expected = longestScanned(triggers, typed);
+
+      // duplicate triggers make the index ambiguous, not the trigger
+      REQUIRE(found.has_value() == expected.has_value());
+      if (found) REQUIRE(triggers[*found] == triggers[*expected]);
+    }
+  }
 }
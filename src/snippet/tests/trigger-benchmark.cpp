@@ -0,0 +1,125 @@
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <algorithm>
+#include <array>
+#include <format>
+#include <random>
+#include <string>
+#include <string_view>
+#include <vector>
+#include "snippet/trigger-automaton.hpp"
+
+using snippet::TriggerAutomaton;
+using snippet::TypedText;
+
+namespace {
+
+// the most bytes of typed text the input server keeps
+constexpr size_t TYPED_TEXT_CAPACITY = 32;
+
+constexpr std::array<std::string_view, 12> WORDS = {
+    "the", "snippet", "expand", "address", "meeting", "regards", "signature", "today", "tomorrow",
+    "email", "phone", "vicinae",
+};
+
+// triggers the way people tend to write them: a prefix sigil and an abbreviation or a word
+std::vector<std::string> syntheticTriggers(size_t count) {
+  constexpr std::array<std::string_view, 4> SIGILS = {":", ";", "//", "!"};
+  std::mt19937 rng{42};
+  std::vector<std::string> triggers;
+
+  triggers.reserve(count);
+  for (size_t i = 0; i != count; ++i) {
+    auto const word = WORDS[rng() % WORDS.size()];
+    auto const length = 2 + rng() % (word.size() - 1);
+    triggers.emplace_back(std::format("{}{}{}", SIGILS[rng() % SIGILS.size()], word.substr(0, length), i));
+  }
+
+  return triggers;
+}
+
+// prose with the odd typo fixed with a backspace, as `\b`
+std::string syntheticTyping(size_t length) {
+  std::mt19937 rng{7};
+  std::string typed;
+
+  while (typed.size() < length) {
+    typed += WORDS[rng() % WORDS.size()];
+    if (rng() % 8 == 0) typed += "x\b";
+    typed += rng() % 6 == 0 ? ". " : " ";
+  }
+
+  return typed;
+}
+
+// the scan the automaton replaced: every trigger against the end of the text, longest first
+struct LinearScan {
+  std::vector<std::string_view> triggers;
+  std::string text{};
+
+  bool type(char c) {
+    if (c == '\b') {
+      if (!text.empty()) text.pop_back();
+    } else {
+      text.push_back(c);
+      if (text.size() > TYPED_TEXT_CAPACITY) text.erase(0, text.size() - TYPED_TEXT_CAPACITY);
+    }
+
+    for (auto trigger : triggers) {
+      if (trigger.size() <= text.size() && text.ends_with(trigger)) return true;
+    }
+    return false;
+  }
+};
+
+struct Automaton {
+  TriggerAutomaton automaton;
+  TypedText text{TYPED_TEXT_CAPACITY};
+
+  bool type(char c) {
+    if (c == '\b') {
+      text.eraseLast();
+    } else {
+      text.append(automaton, {&c, 1});
+    }
+    return text.find(automaton, text.size(), [](size_t) { return true; }).has_value();
+  }
+};
+
+template <typename Matcher> int typeAll(Matcher &matcher, std::string_view typed) {
+  int triggered = 0;
+  for (char const c : typed) {
+    triggered += matcher.type(c);
+  }
+  return triggered;
+}
+
+} // namespace
+
+TEST_CASE("snippet trigger latency per key press", "[!benchmark]") {
+  auto const typed = syntheticTyping(4096);
+
+  for (size_t const count : {10, 100, 500, 2000}) {
+    auto const owned = syntheticTriggers(count);
+    std::vector<std::string_view> triggers(owned.begin(), owned.end());
+
+    // longest first, as the scan expects
+    std::ranges::sort(triggers, [](auto a, auto b) { return a.size() > b.size(); });
+
+    LinearScan scan{.triggers = triggers};
+    Automaton automaton{.automaton = TriggerAutomaton(triggers)};
+
+    REQUIRE(typeAll(scan, typed) == typeAll(automaton, typed));
+
+    // one run types the whole text, divide by its size for the cost of a key press
+    BENCHMARK(std::format("{} snippets, {} keys: linear scan", count, typed.size())) {
+      return typeAll(scan, typed);
+    };
+    BENCHMARK(std::format("{} snippets, {} keys: automaton", count, typed.size())) {
+      return typeAll(automaton, typed);
+    };
+    BENCHMARK(std::format("{} snippets: automaton rebuild", count)) {
+      return TriggerAutomaton(triggers).stateCount();
+    };
+  }
+}
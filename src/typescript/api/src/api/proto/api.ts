@@ -363,6 +363,9 @@ class UIService {
 	viewPushed(handler: () => void): EventSubscription {
 		return this.transport.subscribe("UI/viewPushed", (msg) => handler())
 	}
+	fullRenderRequested(handler: () => void): EventSubscription {
+		return this.transport.subscribe("UI/fullRenderRequested", (msg) => handler())
+	}
 }
 
 class WindowManagementService {
@@ -143,6 +143,7 @@ export type DMenuRequest = {
 	width?: number;
 	height?: number;
 	noFooter: boolean;
+	stream?: boolean;
 }
 
 export type DMenuResponse = {
@@ -217,6 +218,10 @@ class IpcService {
 		return this.transport.request("Ipc/dmenu", { req});	
 	}
 
+	dmenuAppend(chunk: string, done: boolean): Promise<void> {
+		return this.transport.request("Ipc/dmenuAppend", { chunk, done});	
+	}
+
 	browserInit(req: BrowserInitRequest): Promise<void> {
 		return this.transport.request("Ipc/browserInit", { req});	
 	}
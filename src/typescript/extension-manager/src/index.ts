@@ -16,6 +16,14 @@ import { setTimeout } from "node:timers";
 const WORKER_GRACE_PERIOD_MS = 5000;
 const WORKER_MAX_HEAP_SIZE_MB = 1000; // really high limit just to make sure an extension command can't exhaust RAM by itself
 
+// Frames on stdio hold a manager JSON-RPC message, which always starts with `{`, or, once binary framing
+// was negotiated, an extension message: kind, session id length, session id, then the raw message.
+// See bus-frame.hpp on the vicinae side.
+const RPC_FRAME_START = 0x7b;
+const FRAME_EXTENSION_MESSAGE = 1;
+
+type ExtensionMessageWriter = (sessionId: string, data: string) => void;
+
 type WorkerStatus = "unloading" | "running" | "awaiting_handshake";
 
 type WorkerInfo = {
@@ -31,11 +39,19 @@ type WorkerInfo = {
 export const logger = new Logger();
 
 class ExtensionManager extends manager.ManagerService {
-	constructor(transport: manager.RpcTransport) {
+	constructor(
+		transport: manager.RpcTransport,
+		private readonly writeExtensionMessage: ExtensionMessageWriter,
+	) {
 		super(transport);
 		this.workerPool.push(this.createWorker("production"));
 	}
 
+	async setFraming(framing: manager.BusFraming): Promise<boolean> {
+		this.framing = framing;
+		return true;
+	}
+
 	createExtensionClient(worker: Worker) {
 		const transport = new extension.RpcTransport({
 			send: (data) => worker.postMessage(data),
@@ -118,7 +134,12 @@ class ExtensionManager extends manager.ManagerService {
 		worker.on("message", (data) => {
 			client.route(data); // try routing to us
 			if (workerInfo.status !== "running") return;
-			this.emit_extensionMessage(sessionId, data); // regular extension stuff
+			// regular extension stuff
+			if (this.framing === "Binary") {
+				this.writeExtensionMessage(sessionId, data);
+			} else {
+				this.emit_extensionMessage(sessionId, data);
+			}
 		});
 
 		worker.on("messageerror", (error) => {
@@ -275,6 +296,7 @@ class ExtensionManager extends manager.ManagerService {
 		return acquired;
 	}
 
+	private framing: manager.BusFraming = "Json";
 	private readonly workerPool: Worker[] = [];
 	private readonly workerMap = new Map<string, WorkerInfo>();
 }
@@ -292,6 +314,38 @@ class Vicinae {
 		process.stdout.write(packet);
 	}
 
+	private writeExtensionMessage(sessionId: string, data: string) {
+		const idLength = Buffer.byteLength(sessionId);
+		const length = 2 + idLength + Buffer.byteLength(data);
+		const packet = Buffer.allocUnsafe(length + 4);
+
+		packet.writeUint32BE(length, 0);
+		packet[4] = FRAME_EXTENSION_MESSAGE;
+		packet[5] = idLength;
+		packet.write(sessionId, 6, "utf8");
+		packet.write(data, 6 + idLength, "utf8");
+		process.stdout.write(packet);
+	}
+
+	private routeFrame(packet: Buffer) {
+		if (packet[0] === RPC_FRAME_START) {
+			this.server.route(packet.toString("utf8"))?.catch((error) => {
+				logger.error(`Uncaught exception from handler: ${error}`);
+			});
+			return;
+		}
+
+		if (packet.length < 2 || packet[0] !== FRAME_EXTENSION_MESSAGE) {
+			logger.error(`Dropping frame of unknown kind ${packet[0]}`);
+			return;
+		}
+
+		const idEnd = 2 + packet[1];
+		const sessionId = packet.toString("utf8", 2, idEnd);
+
+		this.extensionManager.messageExtension(sessionId, packet.toString("utf8", idEnd));
+	}
+
 	handleRead(data: Buffer) {
 		this.currentMessage.data = Buffer.concat([this.currentMessage.data, data]);
 
@@ -303,9 +357,7 @@ class Vicinae {
 
 			const packet = this.currentMessage.data.subarray(4, length + 4);
 
-			this.server.route(packet.toString("utf8"))?.catch((error) => {
-				logger.error(`Uncaught exception from handler: ${error}`);
-			});
+			this.routeFrame(packet);
 
 			this.currentMessage.data = this.currentMessage.data.subarray(length + 4);
 		}
@@ -318,7 +370,10 @@ class Vicinae {
 			},
 		});
 
-		this.server = new manager.Server(rpc, new ExtensionManager(rpc));
+		this.extensionManager = new ExtensionManager(rpc, (sessionId, data) =>
+			this.writeExtensionMessage(sessionId, data),
+		);
+		this.server = new manager.Server(rpc, this.extensionManager);
 
 		process.stdin.on("error", (error) => {
 			throw new Error(`${error}`);
@@ -326,6 +381,7 @@ class Vicinae {
 		process.stdin.on("data", (buf) => this.handleRead(buf));
 	}
 
+	private extensionManager: ExtensionManager;
 	private server: manager.Server;
 }
 
@@ -57,6 +57,7 @@ export default async function (data: extensionServer.LaunchEventData) {
 		onUpdate: sendRender,
 	});
 	globalState.renderer = renderer;
+	globalState.client.UI.fullRenderRequested(() => renderer.resync());
 
 	renderer.render(
 		<App
@@ -21,6 +21,19 @@ type NoTimeout = number;
 
 const ctx: HostContext = {};
 let frameGen = 0;
+let lastKey = 0;
+
+// List and grid children, which carry a `key` for the server to patch them
+// by instead of receiving the whole tree again. React reuses an instance for
+// as long as its element keeps its key, and so does the key.
+const KEYED_TYPES = new Set([
+	"list-item",
+	"list-section",
+	"grid-item",
+	"grid-section",
+]);
+const SECTION_TYPES = new Set(["list-section", "grid-section"]);
+const PATCHED_ROOTS = new Set(["list", "grid"]);
 
 const initMeta = (
 	instance: Instance,
@@ -29,8 +42,13 @@ const initMeta = (
 ) => {
 	Object.defineProperties(instance, {
 		_dirtyGen: { value: dirty ? frameGen : -1, writable: true },
+		// last frame the own props of the instance changed in
+		_propsGen: { value: -1, writable: true },
 		_parent: { value: undefined, writable: true },
 		_handlers: { value: handlers, writable: true },
+		// what the server was last sent: the keyed children of lists, grids and
+		// sections, the root of view slots
+		_sent: { value: undefined, writable: true },
 	});
 };
 
@@ -96,6 +114,8 @@ const createHostConfig = (hostCtx: HostContext, callback: () => void) => {
 			const handlers = new Set<string>();
 			const instance: Instance = { $t: type };
 
+			if (KEYED_TYPES.has(type)) instance.key = ++lastKey;
+
 			for (const [k, v] of Object.entries(rest)) {
 				if (React.isValidElement(v)) {
 					console.error(`React element in props is ignored for key ${k}`);
@@ -234,7 +254,7 @@ const createHostConfig = (hostCtx: HostContext, callback: () => void) => {
 
 		commitUpdate(instance: Instance, type, prevProps, nextProps, handle) {
 			for (const key of Object.keys(instance)) {
-				if (key === "$t" || key === "children") continue;
+				if (key === "$t" || key === "children" || key === "key") continue;
 				if (!(key in nextProps)) {
 					const old = instance[key];
 					if (typeof old === "string" && instance._handlers.has(old))
@@ -266,6 +286,7 @@ const createHostConfig = (hostCtx: HostContext, callback: () => void) => {
 				instance[k] = v;
 			}
 
+			instance._propsGen = frameGen;
 			emitDirty(instance);
 		},
 
@@ -322,9 +343,142 @@ const createHostConfig = (hostCtx: HostContext, callback: () => void) => {
 	return hostConfig;
 };
 
+export type PatchOp =
+	| { op: "insert"; parent: number; key: number; after: number; node: Instance }
+	| { op: "update"; parent: number; key: number; node: Record<string, any> }
+	| { op: "move"; parent: number; key: number; after: number }
+	| { op: "remove"; parent: number; key: number };
+
+// Changes to the keyed children of a list or grid since the last frame.
+// `parent` is the key of the section an item is in, 0 for the root.
+// Insertions and moves place an item `after` a sibling (0 for first), and come
+// in the new order of the children so that this sibling is in place already.
+export type RenderPatch = {
+	$t: string;
+	// the props of the root, and its children that are not keyed
+	root: Record<string, any>;
+	ops: PatchOp[];
+};
+
+// Views carry their whole `root` when first rendered, then a `patch` where
+// their root allows it.
 export type ViewData = {
 	dirty: boolean;
 	root?: Record<string, any>;
+	patch?: RenderPatch;
+};
+
+const keyedChildren = (instance: Instance) =>
+	(instance.children ?? []).filter((child) => KEYED_TYPES.has(child.$t));
+
+// Positions in `values` of a longest increasing subsequence of them.
+const longestIncreasing = (values: number[]) => {
+	// position of the smallest last value of an increasing run of every length
+	const tails: number[] = [];
+	const previous: number[] = new Array(values.length).fill(-1);
+
+	for (let i = 0; i < values.length; ++i) {
+		let lo = 0;
+		let hi = tails.length;
+		while (lo < hi) {
+			const mid = (lo + hi) >> 1;
+			if (values[tails[mid]] < values[i]) lo = mid + 1;
+			else hi = mid;
+		}
+		if (lo > 0) previous[i] = tails[lo - 1];
+		tails[lo] = i;
+	}
+
+	const members = new Set<number>();
+	for (let i = tails.at(-1) ?? -1; i !== -1; i = previous[i]) members.add(i);
+	return members;
+};
+
+const markSent = (instance: Instance) => {
+	instance._sent = keyedChildren(instance);
+	for (const child of instance._sent) {
+		if (SECTION_TYPES.has(child.$t)) child._sent = keyedChildren(child);
+	}
+};
+
+/**
+ * Keyed diff of the children of `parent` against what was last sent. The
+ * children that keep their relative order, a longest increasing run of their
+ * old positions, do not move. Sections with changed items are collected in
+ * `sections`, to be diffed once the root is.
+ */
+const diffChildren = (
+	parent: Instance,
+	parentKey: number,
+	ops: PatchOp[],
+	sections: Instance[],
+) => {
+	const prev: Instance[] = parent._sent ?? [];
+	const next = keyedChildren(parent);
+	parent._sent = next;
+
+	const kept = new Set(next);
+	for (const child of prev) {
+		if (!kept.has(child))
+			ops.push({ op: "remove", parent: parentKey, key: child.key });
+	}
+
+	const prevIndex = new Map(prev.map((child, idx) => [child, idx]));
+	const survivors = next.filter((child) => prevIndex.has(child));
+	const staying = longestIncreasing(
+		survivors.map((child) => prevIndex.get(child) as number),
+	);
+
+	let after = 0;
+	let survivor = 0;
+
+	for (const child of next) {
+		const key = child.key;
+
+		if (!prevIndex.has(child)) {
+			ops.push({ op: "insert", parent: parentKey, key, after, node: child });
+			if (SECTION_TYPES.has(child.$t)) child._sent = keyedChildren(child);
+			after = key;
+			continue;
+		}
+
+		if (!staying.has(survivor++)) {
+			ops.push({ op: "move", parent: parentKey, key, after });
+		}
+
+		if (SECTION_TYPES.has(child.$t)) {
+			if (child._propsGen === frameGen) {
+				ops.push({
+					op: "update",
+					parent: parentKey,
+					key,
+					node: { ...child, children: undefined },
+				});
+			}
+			if (child._dirtyGen === frameGen) sections.push(child);
+		} else if (child._dirtyGen === frameGen) {
+			ops.push({ op: "update", parent: parentKey, key, node: child });
+		}
+
+		after = key;
+	}
+};
+
+const diffRoot = (root: Instance): RenderPatch => {
+	const ops: PatchOp[] = [];
+	const sections: Instance[] = [];
+
+	diffChildren(root, 0, ops, sections);
+	for (const section of sections) diffChildren(section, section.key, ops, []);
+
+	return {
+		$t: root.$t,
+		root: {
+			...root,
+			children: root.children?.filter((child) => !KEYED_TYPES.has(child.$t)),
+		},
+		ops,
+	};
 };
 
 export type RendererConfig = {
@@ -356,7 +510,15 @@ export const createRenderer = (config: RendererConfig) => {
 					if (!viewRoot) return { dirty: true };
 
 					const dirty = viewRoot._dirtyGen === frameGen;
-					return { dirty, root: dirty ? viewRoot : undefined };
+					if (!dirty) return { dirty };
+
+					if (viewSlot._sent === viewRoot && PATCHED_ROOTS.has(viewRoot.$t)) {
+						return { dirty, patch: diffRoot(viewRoot) };
+					}
+
+					viewSlot._sent = viewRoot;
+					markSent(viewRoot);
+					return { dirty, root: viewRoot };
 				});
 
 				config.onUpdate?.(views);
@@ -375,6 +537,17 @@ export const createRenderer = (config: RendererConfig) => {
 		}
 	};
 
+	// Sends every view whole on the next frame, for when the server could not
+	// apply a patch to what it has.
+	const resync = () => {
+		for (const viewSlot of container.children ?? []) {
+			const viewRoot = viewSlot.children?.at(-1);
+			viewSlot._sent = undefined;
+			if (viewRoot) viewRoot._dirtyGen = frameGen;
+		}
+		renderImpl();
+	};
+
 	const hostConfig = createHostConfig({}, renderImpl);
 	const reconciler = Reconciler(
 		process.env.RECONCILER_TRACE === "1" ? traceWrap(hostConfig) : hostConfig,
@@ -382,6 +555,7 @@ export const createRenderer = (config: RendererConfig) => {
 
 	return {
 		flushSync: (reconciler as any).flushSyncFromReconciler.bind(reconciler),
+		resync,
 		render(element: ReactElement) {
 			if (!root) {
 				root = reconciler.createContainer(